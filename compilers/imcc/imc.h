@@ -446,10 +446,12 @@ SymReg* get_pasm_reg(PARROT_INTERP, ARGIN(const char *name))
 typedef enum _enum_opt {
     OPT_NONE,
     OPT_PRE,
-    OPT_CFG  = 0x002,
-    OPT_SUB  = 0x004,
-    OPT_PASM = 0x100,
-    OPT_J    = 0x200
+    OPT_CFG   = 0x002,
+    OPT_SUB   = 0x004,
+    OPT_SUPER = 0x008,
+    OPT_REGS  = 0x010,
+    OPT_PASM  = 0x100,
+    OPT_J     = 0x200
 } enum_opt_t;
 
 struct nodeType_t;
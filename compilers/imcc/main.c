@@ -287,6 +287,10 @@ imcc_parseflags(PARROT_INTERP, int argc, ARGIN(const char **argv))
                 IMCC_INFO(interp)->optimizer_level |= OPT_PASM;
             if (strchr(opt.opt_arg, 'c'))
                 IMCC_INFO(interp)->optimizer_level |= OPT_SUB;
+            if (strchr(opt.opt_arg, 's'))
+                IMCC_INFO(interp)->optimizer_level |= OPT_SUPER;
+            if (strchr(opt.opt_arg, 'r'))
+                IMCC_INFO(interp)->optimizer_level |= OPT_REGS;
 
             /* currently not ok due to different register allocation */
             if (strchr(opt.opt_arg, '1')) {
@@ -444,6 +448,10 @@ imcc_get_optimization_description(const PARROT_INTERP, int opt_level, ARGMOD(cha
         opt_desc[i++] = 'p';
     if (opt_level & OPT_SUB)
         opt_desc[i++] = 'c';
+    if (opt_level & OPT_SUPER)
+        opt_desc[i++] = 's';
+    if (opt_level & OPT_REGS)
+        opt_desc[i++] = 'r';
 
     opt_desc[i] = '\0';
     return;
@@ -776,6 +784,8 @@ imcc_run(PARROT_INTERP, ARGIN(const char *sourcefile), int argc,
     if (pf_raw) {
         PMC * const _pbcpmc = Parrot_pmc_new(interp, enum_class_UnManagedStruct);
         VTABLE_set_pointer(interp, _pbcpmc, pf_raw);
+        /* The frontend only holds the PMC on its C stack */
+        Parrot_pmc_gc_register(interp, _pbcpmc);
         *pbcpmc = _pbcpmc;
     }
 
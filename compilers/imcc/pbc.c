@@ -11,6 +11,13 @@
 #include "parrot/oplib/core_ops.h"
 #include "pmc/pmc_key.h"
 
+/* the longest sequence of ops, and the longest name, of a superinstruction */
+#define MAX_SUPEROP_OPS  3
+#define MAX_SUPEROP_NAME 128
+
+/* ops in src/ops/ops.lowreg are specialized for registers below this */
+#define MAX_LOWREG 8
+
 /* HEADERIZER HFILE: compilers/imcc/pbc.h */
 
 /*
@@ -129,6 +136,22 @@ static subs_t * find_sub_by_subid(PARROT_INTERP,
         __attribute__nonnull__(4)
         FUNC_MODIFIES(*pc);
 
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static op_info_t * find_superop(PARROT_INTERP,
+    ARGIN(const Instruction *ins))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static op_info_t * find_regop(PARROT_INTERP,
+    ARGIN(const Instruction *ins),
+    ARGIN(op_info_t *op_info))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
 static void fixup_globals(PARROT_INTERP)
         __attribute__nonnull__(1);
 
@@ -232,6 +255,13 @@ static void verify_signature(PARROT_INTERP,
     , PARROT_ASSERT_ARG(lookup) \
     , PARROT_ASSERT_ARG(sym) \
     , PARROT_ASSERT_ARG(pc))
+#define ASSERT_ARGS_find_superop __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(ins))
+#define ASSERT_ARGS_find_regop __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(ins) \
+    , PARROT_ASSERT_ARG(op_info))
 #define ASSERT_ARGS_fixup_globals __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_get_code_size __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
@@ -2129,6 +2159,131 @@ verify_signature(PARROT_INTERP, ARGIN(const Instruction *ins), ARGIN(opcode_t *p
 }
 
 
+/*
+
+=item C<static op_info_t * find_superop(PARROT_INTERP, const Instruction *ins)>
+
+Returns the superinstruction for the longest sequence of ops starting with
+C<ins>, or the op of C<ins> itself if there is none.  Superinstructions are the
+core ops named after the full names of the fused ops, joined with C<__>; see
+F<src/ops/ops.super>.
+
+The rest of the sequence is emitted as usual, so labels between the ops don't
+stop fusion: a branch to one of them still finds a complete op.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static op_info_t *
+find_superop(PARROT_INTERP, ARGIN(const Instruction *ins))
+{
+    ASSERT_ARGS(find_superop)
+    op_lib_t  * const core_ops = PARROT_GET_CORE_OPLIB(interp);
+    op_info_t *superop         = ins->op;
+    char       name[MAX_SUPEROP_NAME];
+    size_t     len             = strlen(ins->op->full_name);
+    int        n;
+
+    if (ins->op->lib != core_ops || len >= sizeof (name))
+        return superop;
+
+    strcpy(name, ins->op->full_name);
+
+    for (n = 1; n < MAX_SUPEROP_OPS; ++n) {
+        op_info_t *op;
+        size_t     op_len;
+
+        do {
+            ins = ins->next;
+        } while (ins && (ins->type & ITLABEL));
+
+        if (!ins || !ins->op || ins->op->lib != core_ops)
+            break;
+
+        op_len = strlen(ins->op->full_name);
+        if (len + 2 + op_len >= sizeof (name))
+            break;
+
+        strcpy(name + len, "__");
+        strcpy(name + len + 2, ins->op->full_name);
+        len += 2 + op_len;
+
+        op = (op_info_t *)parrot_hash_get(interp, interp->op_hash, name);
+        if (op && op->lib == core_ops)
+            superop = op;
+    }
+
+    return superop;
+}
+
+
+/*
+
+=item C<static op_info_t * find_regop(PARROT_INTERP, const Instruction *ins,
+op_info_t *op_info)>
+
+Returns the variant of C<op_info> specialized for the registers of C<ins>, or
+C<op_info> itself if there is none.  The variants are the core ops named after
+the full name of the op and its registers, e.g. C<add_i_i__I0_I3>; see
+F<src/ops/ops.lowreg>.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static op_info_t *
+find_regop(PARROT_INTERP, ARGIN(const Instruction *ins), ARGIN(op_info_t *op_info))
+{
+    ASSERT_ARGS(find_regop)
+    op_lib_t  * const core_ops = PARROT_GET_CORE_OPLIB(interp);
+    op_info_t *regop;
+    char       name[MAX_SUPEROP_NAME];
+    size_t     len             = strlen(op_info->full_name);
+    int        n_regs          = 0;
+    int        i;
+
+    if (op_info->lib != core_ops || len >= sizeof (name))
+        return op_info;
+
+    strcpy(name, op_info->full_name);
+
+    for (i = 0; i < op_info->op_count - 1; i++) {
+        const SymReg *r = ins->symregs[i];
+        char          set;
+
+        switch (op_info->types[i]) {
+          case PARROT_ARG_I: set = 'I'; break;
+          case PARROT_ARG_N: set = 'N'; break;
+          case PARROT_ARG_S: set = 'S'; break;
+          case PARROT_ARG_P: set = 'P'; break;
+          default:           continue;
+        }
+
+        if (r->type & VT_CONSTP)
+            r = r->reg;
+
+        /* "__I0" for the first register, "_I0" for the others */
+        if (r->color < 0 || r->color >= MAX_LOWREG || len + 5 > sizeof (name))
+            return op_info;
+
+        len += snprintf(name + len, sizeof (name) - len, "%s%c%d",
+                n_regs++ ? "_" : "__", set, (int)r->color);
+    }
+
+    if (!n_regs)
+        return op_info;
+
+    regop = (op_info_t *)parrot_hash_get(interp, interp->op_hash, name);
+
+    return regop && regop->lib == core_ops ? regop : op_info;
+}
+
+
 /*
 
 =item C<int e_pbc_emit(PARROT_INTERP, void *param, const IMC_Unit *unit, const
@@ -2277,8 +2432,21 @@ e_pbc_emit(PARROT_INTERP, SHIM(void *param), ARGIN(const IMC_Unit *unit),
         IMCC_debug(interp, DEBUG_PBC, "%d %s", IMCC_INFO(interp)->npc,
             op_info->full_name);
 
-        /* Start generating the bytecode */
-        *(IMCC_INFO(interp)->pc)++ = bytecode_map_op(interp, op_info);
+        /* Start generating the bytecode; a superinstruction, or an op
+         * specialized for its registers, only replaces the opcode, the
+         * arguments are laid out as for the op itself */
+        {
+            op_info_t *emit_op = op_info;
+
+            if (IMCC_INFO(interp)->optimizer_level & OPT_SUPER)
+                emit_op = find_superop(interp, ins);
+
+            if (emit_op == op_info
+            && (IMCC_INFO(interp)->optimizer_level & OPT_REGS))
+                emit_op = find_regop(interp, ins, op_info);
+
+            *(IMCC_INFO(interp)->pc)++ = bytecode_map_op(interp, emit_op);
+        }
 
         for (i = 0; i < op_info->op_count-1; i++) {
             switch (op_info->types[i]) {
@@ -432,10 +432,22 @@ expand_pcc_sub(PARROT_INTERP, ARGMOD(IMC_Unit *unit), ARGIN(Instruction *ins))
      * are no named arguments.  */
     nargs = sub->pcc_sub->nargs;
 
-    if (nargs)
+    if (nargs) {
+        int i;
+
         ins = pcc_get_args(interp, unit, ins, "get_params", nargs,
                 sub->pcc_sub->args, sub->pcc_sub->arg_flags);
 
+        /* Calls can copy positional arguments straight into the params */
+        for (i = 0; i < nargs; i++)
+            if (sub->pcc_sub->arg_flags[i]
+            &   (VT_FLAT | VT_OPTIONAL | VT_OPT_FLAG | VT_NAMED | VT_CALL_SIG))
+                break;
+
+        if (i == nargs)
+            sub->pcc_sub->pragma |= P_FIXED_ARITY;
+    }
+
     /* check if there is a return */
     if (unit->last_ins->type          & (ITPCCSUB)
     &&  unit->last_ins->symreg_count == 1) {
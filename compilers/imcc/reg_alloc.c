@@ -33,6 +33,16 @@ The following parts are just missing:
 #include "imc.h"
 #include "optimizer.h"
 
+/* uses in loops nested deeper than this don't weigh more */
+#define MAX_WEIGHT_DEPTH 6
+
+/* a register to allocate, and how often it's used weighted by loop depth */
+typedef struct reg_weight_t {
+    SymReg      *reg;
+    int          weight;
+    unsigned int order;
+} reg_weight_t;
+
 /* HEADERIZER HFILE: compilers/imcc/imc.h */
 
 /* HEADERIZER BEGIN: static */
@@ -94,6 +104,16 @@ static int reg_sort_f(ARGIN(const void *a), ARGIN(const void *b))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
+PARROT_WARN_UNUSED_RESULT
+static int reg_weight(ARGIN(const IMC_Unit *unit), ARGIN(const SymReg *r))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+PARROT_WARN_UNUSED_RESULT
+static int reg_weight_sort_f(ARGIN(const void *a), ARGIN(const void *b))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
 static void sort_reglist(ARGMOD(IMC_Unit *unit))
         __attribute__nonnull__(1)
         FUNC_MODIFIES(*unit);
@@ -130,6 +150,12 @@ static void vanilla_reg_alloc(PARROT_INTERP, ARGMOD(IMC_Unit *unit))
 #define ASSERT_ARGS_reg_sort_f __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(a) \
     , PARROT_ASSERT_ARG(b))
+#define ASSERT_ARGS_reg_weight __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(unit) \
+    , PARROT_ASSERT_ARG(r))
+#define ASSERT_ARGS_reg_weight_sort_f __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(a) \
+    , PARROT_ASSERT_ARG(b))
 #define ASSERT_ARGS_sort_reglist __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(unit))
 #define ASSERT_ARGS_vanilla_reg_alloc __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
@@ -692,10 +718,74 @@ allocate_uniq(PARROT_INTERP, ARGMOD(IMC_Unit *unit), int usage)
 
 /*
 
+=item C<static int reg_weight(const IMC_Unit *unit, const SymReg *r)>
+
+Returns how often C<r> is used, each use counting 4 times as much as a use
+one loop further out.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static int
+reg_weight(ARGIN(const IMC_Unit *unit), ARGIN(const SymReg *r))
+{
+    ASSERT_ARGS(reg_weight)
+    const Instruction *ins;
+    int                weight = 0;
+
+    for (ins = r->first_ins; ins; ins = ins->next) {
+        if (instruction_writes(ins, r) || instruction_reads(ins, r)) {
+            int depth = 0;
+
+            if (ins->bbindex < unit->n_basic_blocks)
+                depth = unit->bb_list[ins->bbindex]->loop_depth;
+
+            if (depth > MAX_WEIGHT_DEPTH)
+                depth = MAX_WEIGHT_DEPTH;
+
+            weight += 1 << (2 * depth);
+        }
+
+        if (ins == r->last_ins)
+            break;
+    }
+
+    return weight;
+}
+
+/*
+
+=item C<static int reg_weight_sort_f(const void *a, const void *b)>
+
+sort registers by descending weight, then in the order they were found
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static int
+reg_weight_sort_f(ARGIN(const void *a), ARGIN(const void *b))
+{
+    ASSERT_ARGS(reg_weight_sort_f)
+    const reg_weight_t * const ra = (const reg_weight_t *)a;
+    const reg_weight_t * const rb = (const reg_weight_t *)b;
+
+    if (ra->weight != rb->weight)
+        return ra->weight > rb->weight ? -1 : 1;
+
+    return ra->order < rb->order ? -1 : ra->order > rb->order;
+}
+
+/*
+
 =item C<static void vanilla_reg_alloc(PARROT_INTERP, IMC_Unit *unit)>
 
 Vanilla register allocator - assign every virtual register to an actual
-register.
+register.  With C<-Or>, the registers used most in loops are assigned first,
+so they get the lowest numbers.
 
 =cut
 
@@ -705,11 +795,12 @@ static void
 vanilla_reg_alloc(PARROT_INTERP, ARGMOD(IMC_Unit *unit))
 {
     ASSERT_ARGS(vanilla_reg_alloc)
-    const char   type[] = "INSP";
-    SymHash     *hsh    = &unit->hash;
-    Set         *avail;
-    unsigned int i, j;
-    int          reg_set, first_reg;
+    const char    type[] = "INSP";
+    SymHash      *hsh    = &unit->hash;
+    reg_weight_t *regs   = mem_gc_allocate_n_typed(interp, hsh->entries + 1, reg_weight_t);
+    Set          *avail;
+    unsigned int  i, j, n;
+    int           reg_set, first_reg;
 
     /* Clear the pre-assigned colors. */
     for (i = 0; i < hsh->size; i++) {
@@ -726,25 +817,40 @@ vanilla_reg_alloc(PARROT_INTERP, ARGMOD(IMC_Unit *unit))
         reg_set   = type[j];
         first_reg = first_avail(interp, unit, reg_set, &avail);
 
-        /* XXX Use a different loop variable that doesn't shadow outer i */
-        for (i = 0; i < hsh->size; i++) {
+        for (i = n = 0; i < hsh->size; i++) {
             SymReg *r;
             for (r = hsh->data[i]; r; r = r->next) {
                 if (r->set != reg_set)
                     continue;
                 if (REG_NEEDS_ALLOC(r) && (r->color == -1) && r->use_count) {
-                    if (set_contains(avail, first_reg))
-                        first_reg = first_avail(interp, unit, reg_set, NULL);
-
-                    set_add(avail, first_reg);
-                    r->color = first_reg++;
+                    regs[n].reg    = r;
+                    regs[n].weight = 0;
+                    regs[n].order  = n;
+                    n++;
                 }
             }
         }
 
+        if (IMCC_INFO(interp)->optimizer_level & OPT_REGS) {
+            for (i = 0; i < n; i++)
+                regs[i].weight = reg_weight(unit, regs[i].reg);
+
+            qsort(regs, n, sizeof (reg_weight_t), reg_weight_sort_f);
+        }
+
+        for (i = 0; i < n; i++) {
+            if (set_contains(avail, first_reg))
+                first_reg = first_avail(interp, unit, reg_set, NULL);
+
+            set_add(avail, first_reg);
+            regs[i].reg->color = first_reg++;
+        }
+
         set_free(avail);
         unit->first_avail[j] = first_reg;
     }
+
+    mem_gc_free(interp, regs);
 }
 
 /*
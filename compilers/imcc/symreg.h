@@ -94,7 +94,8 @@ typedef enum {
     P_IMMEDIATE      = SUB_FLAG_PF_IMMEDIATE, /* 1<<6 0x40   - private6 */
     P_POSTCOMP       = SUB_FLAG_PF_POSTCOMP,  /* 1<<7 0x80   - private7 */
     P_INIT           = SUB_COMP_FLAG_PF_INIT, /* 1<<10 0x400 - 10       */
-    P_NSENTRY        = SUB_COMP_FLAG_NSENTRY  /* 1<<11 0x800 - 11       */
+    P_NSENTRY        = SUB_COMP_FLAG_NSENTRY, /* 1<<11 0x800 - 11       */
+    P_FIXED_ARITY    = SUB_COMP_FLAG_FIXED_ARITY /* 1<<12 0x1000 - 12   */
 } pragma_enum_t;
 
 typedef struct pcc_sub_t {
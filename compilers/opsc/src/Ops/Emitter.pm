@@ -79,7 +79,7 @@ method print_c_header_files() {
     self.emit_c_op_func_header($fh);
     $fh.close();
 
-    if self.ops_file<core> {
+    if self.ops_file<core> && self.trans.has_op_lib {
         $fh := pir::new__Ps('FileHandle');
         $fh.open(self<enum_header>, 'w')
             || die("Can't open "~ self<enum_header>);
@@ -147,7 +147,7 @@ method emit_opsenum_h_body($fh) {
     my $max_op_num := 0;
     for self.ops_file.ops -> $op {
         if !self.ops_file<core> || !self.ops_file.oplib.op_skip_table.exists( $op.full_name ) {
-            my $space := pir::repeat__SsI(' ', 30 - pir::length__Is($op.full_name));
+            my $space := self._padding($op.full_name, 30);
             $fh.print("    enum_ops_" ~ $op.full_name ~ $space ~ "=");
             $space := pir::repeat__SsI(' ', 5 - pir::length__Is(~$max_op_num));
             $fh.print($space ~ $max_op_num ~ ",\n");
@@ -178,12 +178,14 @@ method emit_c_source_file($fh) {
 
     self.trans.emit_source_part(self, $fh);
 
-    self._emit_op_lib_descriptor($fh);
+    if self.trans.has_op_lib {
+        self._emit_op_lib_descriptor($fh);
 
-    self.trans.emit_op_lookup(self, $fh);
+        self.trans.emit_op_lookup(self, $fh);
 
-    self._emit_init_func($fh);
-    self._emit_dymanic_lib_load($fh);
+        self._emit_init_func($fh);
+        self._emit_dymanic_lib_load($fh);
+    }
     self._emit_coda($fh);
 }
 
@@ -194,7 +196,7 @@ method _emit_c_op_enum_header_part($fh) {
         $sb.append_format("    PARROT_OP_%0%1 %2 /* %3 */\n",
             $op.full_name,
             ($op.code == $last_op_code ?? ' ' !! ','),
-            pir::repeat__SsI(' ', 30 - pir::length__Is($op.full_name)),
+            self._padding($op.full_name, 30),
             $op.code);
     }
     $fh.print(q|
@@ -215,11 +217,15 @@ method _emit_source_preamble($fh) {
 #include "pmc/pmc_callcontext.h"
 
 {self.trans.defines(self)}
+|);
 
+    if self.trans.has_op_lib {
+        $fh.print(qq|
 /* XXX should be static, but C++ doesn't want to play ball */
 extern op_lib_t {self.bs}op_lib;
 
 |);
+    }
 
     $fh.print(self.ops_file.preamble);
 }
@@ -304,6 +310,12 @@ $load_func(PARROT_INTERP)
 |);
 }
 
+# spaces to align text after $str in a column $width characters wide
+method _padding($str, $width) {
+    my $len := $width - pir::length__Is($str);
+    pir::repeat__SsI(' ', $len > 0 ?? $len !! 0);
+}
+
 # given a headerfile name like "include/parrot/oplib/core_ops.h", this
 # returns a string like "PARROT_OPLIB_CORE_OPS_H_GUARD"
 method _generate_guard_macro_name($filename) {
@@ -355,10 +367,14 @@ method _emit_includes($fh) {
 #include "parrot/oplib.h"
 #include "parrot/runcore_api.h"
 
-| ~ (self.flags<core> ?? 'PARROT_EXPORT' !! '') ~ qq|
+|);
+
+    if self.trans.has_op_lib {
+        $fh.print((self.flags<core> ?? 'PARROT_EXPORT' !! '') ~ qq|
 op_lib_t *{self.init_func}(PARROT_INTERP, long init);
 
 |);
+    }
 }
 
 method _emit_preamble($fh) {
@@ -202,6 +202,9 @@ method new(*@files, :$oplib, :$core!, :$nolines, :$quiet? = 0) {
 
     for @files { self.read_ops( $_, $nolines ) }
 
+    self._add_super_ops() if $core;
+    self._add_reg_ops() if $core;
+
     self._calculate_op_codes();
 
     self;
@@ -270,6 +273,68 @@ method compile_ops($str, :$experimental? = 0) {
     $past;
 }
 
+=begin
+
+=item C<_add_super_ops()>
+
+Appends an C<Ops::SuperOp> for every sequence of ops listed in the op
+library's F<ops.super> file.  They come after all ordinary ops, so they don't
+change the numbering of those.  Sequences of ops which weren't read are
+skipped.
+
+=end
+
+method _add_super_ops() {
+    my %ops;
+    for self<ops> -> $op {
+        %ops{$op.full_name} := $op;
+    }
+
+    for self<oplib>.super_ops -> @names {
+        my @ops;
+        for @names -> $name {
+            @ops.push(%ops{$name}) if %ops{$name};
+        }
+
+        if +@ops == +@names {
+            self<ops>.push(Ops::SuperOp.fuse(|@ops));
+            self<op_order>++;
+        }
+        else {
+            self<quiet> || say("# Skipping superinstruction " ~ join(' ', |@names));
+        }
+    }
+}
+
+=begin
+
+=item C<_add_reg_ops()>
+
+Appends the C<Ops::RegOp> variants of every op listed in the op library's
+F<ops.lowreg> file, after all other ops including the superinstructions.
+Ops which weren't read are skipped.
+
+=end
+
+method _add_reg_ops() {
+    my %ops;
+    for self<ops> -> $op {
+        %ops{$op.full_name} := $op;
+    }
+
+    for self<oplib>.lowreg_ops -> $name {
+        if %ops{$name} {
+            for Ops::RegOp.variants(%ops{$name}) -> $reg_op {
+                self<ops>.push($reg_op);
+                self<op_order>++;
+            }
+        }
+        else {
+            self<quiet> || say("# Skipping register specialized " ~ $name);
+        }
+    }
+}
+
 method get_parse_tree($str) {
     my $compiler := pir::compreg__Ps('Ops');
     $compiler.compile($str, :target('parse'));
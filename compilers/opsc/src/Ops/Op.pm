@@ -282,11 +282,23 @@ method get_body( $trans ) {
     join('', |@body);
 }
 
+=begin
+
+=item C<access_arg($trans, $num)>
+
+Returns the C code accessing argument C<$num> of the op, as translated by
+C<$trans>.
+
+=end
+
+method access_arg($trans, $num) {
+    $trans.access_arg( self.arg_type($num - 1), $num);
+}
+
 # Recursively process body chunks returning string.
 
 our multi method process_body_chunk($trans, PAST::Var $chunk) {
-    my $n := +$chunk.name;
-    $trans.access_arg( self.arg_type($n - 1), $n);
+    self.access_arg($trans, +$chunk.name);
 }
 
 our multi method process_body_chunk($trans, PAST::Op $chunk) {
@@ -15,8 +15,8 @@ C<Ops::OpLib> - library of Parrot Operations.
 
 =begin DESCRIPTION
 
-Responsible for loading F<src/ops/ops.skip> files, parse F<.ops> files, sort
-them, etc.
+Responsible for loading F<src/ops/ops.skip>, F<src/ops/ops.super> and
+F<src/ops/ops.lowreg> files, parse F<.ops> files, sort them, etc.
 
 Heavily inspired by Perl5 Parrot::Ops2pm.
 
@@ -26,6 +26,8 @@ Heavily inspired by Perl5 Parrot::Ops2pm.
 
     my $oplib := Ops::OpLib.new(
         :skip_file('../../src/ops/ops.skip'),
+        :super_file('../../src/ops/ops.super'),
+        :lowreg_file('../../src/ops/ops.lowreg'),
     ));
 
 =end SYNOPSIS
@@ -49,6 +51,24 @@ As F<src/ops/ops.skip> states, these are "... opcodes that could be listed in
 F<[src/ops/]ops.num> but aren't ever to be generated or implemented because
 they are useless and/or silly."
 
+=item * C<@.super_ops>
+
+List of the op sequences from F<src/ops/ops.super> to build superinstructions
+for, each a list of full op names.
+
+  'super_ops' => [
+    [ 'set_i_ic', 'lt_i_i_ic' ],
+    [ 'inc_i', 'branch_ic' ],
+    # ...
+  ],
+
+=item * C<@.lowreg_ops>
+
+List of the full names of the ops from F<src/ops/ops.lowreg> to specialize
+for low registers.
+
+  'lowreg_ops' => [ 'inc_i', 'lt_i_i_ic', ... ],
+
 =back
 
 =end ATTRIBUTES
@@ -65,12 +85,16 @@ Build OpLib.
 
 =end METHODS
 
-method new(:$skip_file, :$quiet? = 0) {
-    self<skip_file>  := $skip_file // './src/ops/ops.skip';
-    self<quiet>      := $quiet;
+method new(:$skip_file, :$super_file, :$lowreg_file, :$quiet? = 0) {
+    self<skip_file>   := $skip_file // './src/ops/ops.skip';
+    self<super_file>  := $super_file // './src/ops/ops.super';
+    self<lowreg_file> := $lowreg_file // './src/ops/ops.lowreg';
+    self<quiet>       := $quiet;
 
     # Initialize self.
     self<op_skip_table> := hash();
+    self<super_ops>     := list();
+    self<lowreg_ops>    := list();
     self<ops_past>      := list();
     self<regen_ops_num> := 0;
 
@@ -83,12 +107,14 @@ method new(:$skip_file, :$quiet? = 0) {
 
 =item C<load_op_map_files>
 
-Load ops.num and ops.skip files.
+Load ops.skip, ops.super and ops.lowreg files.
 
 =end METHODS
 
 method load_op_map_files() {
     self._load_skip_file;
+    self._load_super_file;
+    self._load_lowreg_file;
 }
 
 method _load_skip_file() {
@@ -112,6 +138,52 @@ method _load_skip_file() {
     }
 }
 
+method _load_super_file() {
+    my $buf     := slurp(self<super_file>);
+    grammar SUPER {
+        rule TOP { <seq>* }
+
+        token seq { <.ws> <name=.op_name> [ \h+ <name=.op_name> ]+ \h* \n? }
+        token op_name { \w+ }
+        token ws {
+            [
+            | \s+
+            | '#' \N*
+            ]*
+        }
+    }
+
+    my $lines := SUPER.parse($buf);
+
+    for $lines<seq> {
+        my @names;
+        for $_<name> -> $name {
+            @names.push(~$name);
+        }
+        self<super_ops>.push(@names);
+    }
+}
+
+method _load_lowreg_file() {
+    my $buf     := slurp(self<lowreg_file>);
+    grammar LOWREG {
+        rule TOP { <op>* }
+
+        rule op { $<name>=(\w+) }
+        token ws {
+            [
+            | \s+
+            | '#' \N*
+            ]*
+        }
+    }
+
+    my $lines := LOWREG.parse($buf);
+
+    for $lines<op> {
+        self<lowreg_ops>.push(~$_<name>);
+    }
+}
 
 =begin ACCESSORS
 
@@ -121,10 +193,18 @@ Various methods for accessing internals.
 
 =item * C<op_skip_table>
 
+=item * C<super_ops>
+
+=item * C<lowreg_ops>
+
 =end ACCESSORS
 
 method op_skip_table()  { self<op_skip_table>; }
 
+method super_ops()      { self<super_ops>; }
+
+method lowreg_ops()     { self<lowreg_ops>; }
+
 # Local Variables:
 #   mode: perl6
 #   fill-column: 100
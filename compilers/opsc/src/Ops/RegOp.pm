@@ -0,0 +1,197 @@
+#! nqp
+# Copyright (C) 2011, Parrot Foundation.
+
+=begin
+
+=head1 NAME
+
+Ops::RegOp - Parrot op specialized for fixed registers
+
+=head1 SYNOPSIS
+
+    my @ops := Ops::RegOp.variants( $lt_i_i_ic );
+
+=head1 DESCRIPTION
+
+C<Ops::RegOp> is an op whose register arguments are fixed to low register
+numbers.  Its body accesses these registers at a constant offset from the
+register base of the current context instead of reading their numbers from
+the bytecode.  The ops to specialize are listed in F<src/ops/ops.lowreg>.
+
+A specialized op has the same arguments as the op it is made from, so it
+only replaces the opcode in the bytecode and can be read as the general op
+by every other tool.  It also keeps the short name of that op.
+
+=head2 Class Methods
+
+=over 4
+
+=end
+
+class Ops::RegOp is Ops::Op;
+
+=begin
+
+=item C<max_reg()>
+
+The number of low registers ops are specialized for.
+
+=end
+
+method max_reg() { 8 }
+
+=begin
+
+=item C<variants($op)>
+
+Returns the ops specialized from C<$op> for every combination of register
+numbers below C<max_reg()>.  Dies if C<$op> has no register arguments, or more
+than two of them, which would make too many ops.
+
+=end
+
+method variants($op) {
+    my @positions;
+    my $n := 1;
+
+    for $op.arg_types -> $type {
+        @positions.push($n) if is_register($type);
+        $n := $n + 1;
+    }
+
+    if !+@positions || +@positions > 2 {
+        pir::die("Op '" ~ $op.full_name ~ "' needs one or two register arguments to be specialized");
+    }
+
+    my @variants;
+    my @regs;
+    add_variants(self, $op, @positions, @regs, @variants);
+    @variants;
+}
+
+sub add_variants($class, $op, @positions, @regs, @variants) {
+    if +@regs == +@positions {
+        my %regs;
+        my $i := 0;
+        for @positions -> $pos {
+            %regs{~$pos} := @regs[$i++];
+        }
+        @variants.push($class.specialize($op, %regs));
+    }
+    else {
+        my $reg := 0;
+        while $reg < $class.max_reg {
+            @regs.push($reg);
+            add_variants($class, $op, @positions, @regs, @variants);
+            @regs.pop;
+            $reg := $reg + 1;
+        }
+    }
+}
+
+sub is_register($type) {
+    $type eq 'i' || $type eq 'n' || $type eq 's' || $type eq 'p';
+}
+
+=begin
+
+=item C<specialize($op, %regs)>
+
+Returns C<$op> with the register arguments numbered by the keys of C<%regs>
+fixed to the register numbers they map to.
+
+=back
+
+=head2 Instance Methods
+
+=over 4
+
+=item C<op()>
+
+The op this one is specialized from.
+
+=item C<full_name()>
+
+The full name of the general op followed by the fixed registers, e.g.
+C<add_i_i__I0_I3>.
+
+=end
+
+method specialize($op, %regs) {
+    my $reg_op := self.new();
+    my @names;
+
+    my $n := 1;
+    for $op.arg_types -> $type {
+        if pir::exists(%regs, ~$n) {
+            @names.push(pir::upcase__SS($type) ~ %regs{~$n});
+        }
+        $n := $n + 1;
+    }
+
+    for @($op) -> $chunk {
+        $reg_op.push($chunk);
+    }
+
+    if $op.jump {
+        for $op.jump -> $jump {
+            $reg_op.add_jump($jump);
+        }
+    }
+
+    $reg_op.name($op.name);
+    $reg_op<op>              := $op;
+    $reg_op<regs>            := %regs;
+    $reg_op<full_name>       := $op.full_name ~ '__' ~ join('_', |@names);
+    $reg_op<flags>           := $op<flags>;
+    $reg_op<type>            := $op<type>;
+    $reg_op<arg_types>       := $op.arg_types;
+    $reg_op<normalized_args> := $op<normalized_args>;
+
+    $reg_op;
+}
+
+method op() { self<op> }
+
+method full_name() { self<full_name> }
+
+=begin
+
+=item C<access_arg($trans, $num)>
+
+Accesses a fixed register through C<$trans> by its number, and every other
+argument as the general op does.
+
+=end
+
+method access_arg($trans, $num) {
+    if pir::exists(self<regs>, ~$num) {
+        $trans.access_reg(self.arg_type($num - 1), self<regs>{~$num});
+    }
+    else {
+        $trans.access_arg(self.arg_type($num - 1), $num);
+    }
+}
+
+=begin
+
+=back
+
+=head1 SEE ALSO
+
+=over 4
+
+=item C<Ops::Op>
+
+=item F<src/ops/ops.lowreg>
+
+=back
+
+=end
+
+# Local Variables:
+#   mode: cperl
+#   cperl-indent-level: 4
+#   fill-column: 100
+# End:
+# vim: ft=perl6 expandtab shiftwidth=4:
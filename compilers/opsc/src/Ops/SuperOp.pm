@@ -0,0 +1,230 @@
+#! nqp
+# Copyright (C) 2011, Parrot Foundation.
+
+=begin
+
+=head1 NAME
+
+Ops::SuperOp - Parrot superinstruction
+
+=head1 SYNOPSIS
+
+    my $super := Ops::SuperOp.fuse( $set_i_ic, $lt_i_i_ic );
+
+=head1 DESCRIPTION
+
+C<Ops::SuperOp> is an op which runs a sequence of ops with a single dispatch.
+The sequences to fuse are listed in F<src/ops/ops.super>.
+
+A superinstruction doesn't change the layout of the bytecode: it replaces only
+the opcode of the first op of a sequence, and the following ops keep their
+opcodes and arguments.  Its arguments are therefore those of the first op,
+then the opcode and arguments of every following op, and branches into the
+middle of a sequence still find a complete op there.
+
+The body of a superinstruction is the body of each op in turn, with the
+implicit C<goto NEXT()> of every op but the last replaced by advancing the
+current position to the next op.  The bodies of later ops thus see their own
+arguments and compute their branches relative to their own position, exactly
+as if they had been dispatched separately.
+
+=head2 Class Methods
+
+=over 4
+
+=end
+
+class Ops::SuperOp is Ops::Op;
+
+=begin
+
+=item C<fuse(*@ops)>
+
+Returns a superinstruction running C<@ops> in sequence.  Dies if the ops can't
+be fused: all ops but the last must fall through to the next one, and none may
+take a variable number of arguments.
+
+=back
+
+=head2 Instance Methods
+
+=over 4
+
+=item C<ops()>
+
+The ops run by this superinstruction.
+
+=item C<full_name()>
+
+The full names of the ops, joined with double underscores, e.g.
+C<set_i_ic__lt_i_i_ic>.  It's also the short name of the op, so a
+superinstruction can't be chosen by the assembler in place of an ordinary op.
+
+=end
+
+method fuse(*@ops) {
+    my $super := self.new();
+    my @names;
+    my @arg_types;
+    my @norm_args;
+    my %flags;
+    my $last := +@ops - 1;
+    my $index := 0;
+
+    for @ops -> $op {
+        my $full_name := $op.full_name;
+
+        if takes_varargs($full_name) {
+            pir::die("Op '$full_name' takes variable arguments and can't be fused");
+        }
+        if $index < $last && $op<flags><flow> {
+            pir::die("Op '$full_name' is a :flow op and can only end a superinstruction");
+        }
+
+        @names.push($full_name);
+
+        if $index {
+            # The opcode of the next op is an inline constant argument.
+            my $opcode := PAST::Var.new( :isdecl(1) );
+            $opcode<type>      := 'ic';
+            $opcode<direction> := 'i';
+            $opcode<is_label>  := 0;
+
+            @arg_types.push('ic');
+            @norm_args.push($opcode);
+        }
+
+        for $op.arg_types -> $type {
+            @arg_types.push($type);
+        }
+
+        # Branch offsets of later ops are relative to those ops, not to the
+        # superinstruction, so they're plain integers here.
+        for $op<normalized_args> -> $arg {
+            if $index && $arg<is_label> {
+                my $offset := PAST::Var.new( :isdecl(1) );
+                $offset<type>      := $arg<type>;
+                $offset<direction> := $arg<direction>;
+                $offset<is_label>  := 0;
+                @norm_args.push($offset);
+            }
+            else {
+                @norm_args.push($arg);
+            }
+        }
+
+        if $op.jump {
+            for $op.jump -> $jump {
+                $super.add_jump($jump);
+            }
+        }
+
+        for $op<flags> {
+            %flags{~$_} := 1;
+        }
+
+        $index++;
+    }
+
+    $super.name(join('__', |@names));
+    $super<ops>             := @ops;
+    $super<flags>           := %flags;
+    $super<type>            := @ops[0]<type>;
+    $super<arg_types>       := @arg_types;
+    $super<normalized_args> := @norm_args;
+
+    $super;
+}
+
+# Ops whose size depends on their signature argument.
+sub takes_varargs($full_name) {
+    $full_name eq 'set_args_pc'
+        || $full_name eq 'get_results_pc'
+        || $full_name eq 'get_params_pc'
+        || $full_name eq 'set_returns_pc';
+}
+
+method ops() { self<ops> }
+
+method full_name() { self.name }
+
+=begin
+
+=item C<source($trans)>
+
+Returns the bodies of all ops, each in a block of its own, with the position
+advanced from each op to the next by C<$trans>.
+
+=end
+
+method source( $trans ) {
+    my $prelude := $trans.body_prelude;
+    my @ops     := self<ops>;
+    my $last    := +@ops - 1;
+    my $index   := 0;
+    my @body;
+
+    for @ops -> $op {
+        @body.push("  \{\n" ~ $prelude);
+
+        if $index < $last {
+            # Drop the implicit "goto NEXT();" appended to non-flow ops,
+            # which is the last three chunks of the body.
+            my @chunks := @($op);
+            my $end    := +@chunks - 3;
+            my $i      := 0;
+            while $i < $end {
+                @body.push($op.process_body_chunk($trans, @chunks[$i]));
+                $i++;
+            }
+            @body.push("\n  }\n  " ~ $trans.advance_pc($op.size) ~ "\n");
+        }
+        else {
+            @body.push($op.get_body($trans));
+            @body.push("\n  }\n");
+        }
+
+        $index++;
+    }
+
+    join('', |@body);
+}
+
+=begin
+
+=item C<body()>
+
+The bodies of all ops, as used by C<Ops::Op>.
+
+=end
+
+method body() {
+    my $res := '';
+    for self<ops> -> $op {
+        $res := $res ~ $op.body;
+    }
+    $res;
+}
+
+=begin
+
+=back
+
+=head1 SEE ALSO
+
+=over 4
+
+=item C<Ops::Op>
+
+=item F<src/ops/ops.super>
+
+=back
+
+=end
+
+# Local Variables:
+#   mode: cperl
+#   cperl-indent-level: 4
+#   fill-column: 100
+# End:
+# vim: ft=perl6 expandtab shiftwidth=4:
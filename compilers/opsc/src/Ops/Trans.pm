@@ -16,6 +16,11 @@ method suffix() { die("...") }
 
 method core_type() { die("...") }
 
+# Whether the generated source defines an op_lib_t of its own. Transforms
+# which only provide a runcore on top of the core op library return false,
+# and get neither a descriptor, an op lookup nor an init function emitted.
+method has_op_lib() { 1 }
+
 # Prepare internal structures from Ops::File.ops.
 method prepare_ops($emitter, $ops_file) { die('...') }
 
@@ -45,6 +50,9 @@ our %arg_maps := {};
 
 method access_arg($type, $num) { die('...'); }
 
+# Access the register number $reg of type $type, for an Ops::RegOp.
+method access_reg($type, $reg) { die('...'); }
+
 method restart_address($addr) { die('...'); }
 method restart_offset($offset) { die('...'); }
 
@@ -54,4 +62,8 @@ method goto_offset($offset) { die('...'); }
 method expr_address($addr) { die('...'); }
 method expr_offset($offset) { die('...'); }
 
+# Move the current position forward by $offset, between the ops fused into
+# an Ops::SuperOp.
+method advance_pc($offset) { die('...'); }
+
 # vim: expandtab shiftwidth=4 ft=perl6:
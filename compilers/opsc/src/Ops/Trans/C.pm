@@ -31,6 +31,13 @@ method new() {
         :kic("ICONST(NUM)")
     );
 
+    self<reg_maps> := hash(
+        :i("IREG_AT(NUM)"),
+        :n("NREG_AT(NUM)"),
+        :p("PREG_AT(NUM)"),
+        :s("SREG_AT(NUM)")
+    );
+
     self;
 }
 
@@ -80,6 +87,12 @@ method access_arg($type, $num) {
     subst($access, /NUM/, $num);
 }
 
+method access_reg($type, $reg) {
+    my $access := self<reg_maps>{$type};
+    die("unrecognized register type '$type'") unless $access;
+    subst($access, /NUM/, $reg);
+}
+
 method restart_address($addr) {
     "interp->resume_offset = $addr; interp->resume_flag = 1;";
 }
@@ -96,6 +109,8 @@ method expr_address($addr) { $addr; }
 
 method expr_offset($offset) { " cur_opcode + $offset"; }
 
+method advance_pc($offset) { "cur_opcode += $offset;"; }
+
 =begin
 
 =item C<defines()>
@@ -105,6 +120,21 @@ Returns the C C<#define> macros for register access etc.
 =end
 
 method defines($emitter) {
+    return self.register_defines($emitter) ~ q|
+static int get_op(PARROT_INTERP, const char * name, int full);
+|;
+}
+
+=begin
+
+=item C<register_defines()>
+
+Returns the C<#define> macros for register and constant access only, for
+transforms which derive from this one.
+
+=end
+
+method register_defines($emitter) {
     return qq|
 /* defines - Ops::Trans::C */
 #define REL_PC     ((size_t)(cur_opcode - (opcode_t *)interp->code->base.data))
@@ -113,13 +143,15 @@ method defines($emitter) {
 #define NREG(i) (CUR_CTX->bp.regs_n[-1L - cur_opcode[i]])
 #define PREG(i) (CUR_CTX->bp_ps.regs_p[-1L - cur_opcode[i]])
 #define SREG(i) (CUR_CTX->bp_ps.regs_s[cur_opcode[i]])
+#define IREG_AT(r) (CUR_CTX->bp.regs_i[r])
+#define NREG_AT(r) (CUR_CTX->bp.regs_n[-1L - (r)])
+#define PREG_AT(r) (CUR_CTX->bp_ps.regs_p[-1L - (r)])
+#define SREG_AT(r) (CUR_CTX->bp_ps.regs_s[r])
 #define ICONST(i) cur_opcode[i]
 #define NCONST(i) Parrot_pcc_get_num_constants(interp, interp->ctx)[cur_opcode[i]]
 #define SCONST(i) Parrot_pcc_get_str_constants(interp, interp->ctx)[cur_opcode[i]]
 #undef  PCONST
 #define PCONST(i) Parrot_pcc_get_pmc_constants(interp, interp->ctx)[cur_opcode[i]]
-
-static int get_op(PARROT_INTERP, const char * name, int full);
 |;
 }
 
@@ -364,8 +396,9 @@ static void hop_init(PARROT_INTERP)
     for (i = 0; i < [[BS]]op_lib.op_count; i++) {
         store_op(interp, info + i, hops++, info[i].full_name);
 
-        /* plus one short name */
-        if (i && info[i - 1].name != info[i].name)
+        /* plus one short name, except for the register specialized ops
+         * at the end, which share the short name of their general op */
+        if (i && i < [[NAMED]] && info[i - 1].name != info[i].name)
             store_op(interp, info + i, hops++, info[i].name);
     }
 }
@@ -381,6 +414,12 @@ static void hop_deinit(PARROT_INTERP)
     hop_buckets = NULL;
 }|;
 
+    my $named := 0;
+    for $emitter.ops_file.ops -> $op {
+        $named := $named + 1 unless $op ~~ Ops::RegOp;
+    }
+
+    $res := subst($res, /'[[' NAMED ']]'/, $named, :global);
     $fh.print(subst($res, /'[[' BS ']]'/, $emitter.bs, :global));
 }
 
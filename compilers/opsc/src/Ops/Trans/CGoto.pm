@@ -0,0 +1,123 @@
+#! nqp
+# Copyright (C) 2011, Parrot Foundation.
+
+class Ops::Trans::CGoto is Ops::Trans::C;
+
+=begin
+
+Computed goto runcore transformation.
+
+Emits every op as a labelled block inside a single function,
+C<Parrot_cg_core()>. Ops dispatch to each other with C<goto *> through the
+per-segment label table C<interp-E<gt>code-E<gt>cg_ops_addr>, which the
+C<cgoto> runcore in F<src/runcore/cores.c> builds from the core label table.
+The generated file doesn't define an op library of its own: the runcore uses
+the function core library for everything but dispatch.
+
+=end
+
+method suffix() { '_cg' };
+
+method core_type() { 'PARROT_CGOTO_CORE' }
+
+method has_op_lib() { 0 }
+
+method prepare_ops($emitter, $ops_file) {
+
+    my $index := 0;
+    my @op_labels;
+    my @op_funcs;
+
+    for $ops_file.ops -> $op {
+        my $label := 'PC_' ~ $index;
+        my $src   := $op.source( self );
+
+        @op_labels.push(sprintf( "        %-20s /* %6ld */\n", "&&$label,", $index ));
+
+        @op_funcs.push(join('',
+            $label, ': /* ', $op.full_name, " */\n",
+            '  {', "\n", $src, '}', "\n\n"));
+        $index++;
+    }
+
+    self<op_funcs>    := @op_funcs;
+    self<op_labels>   := @op_labels;
+    self<num_entries> := +@op_funcs + 1;
+}
+
+method emit_c_op_funcs_header_part($fh) {
+    $fh.print(q|
+opcode_t * Parrot_cg_core(opcode_t *cur_opcode, PARROT_INTERP);
+|);
+}
+
+method goto_address($addr) {
+    "do \{ if (!(cur_opcode = (opcode_t *)($addr))) return NULL; CG_ENTER; CG_DISPATCH; \} while (0)";
+}
+
+method goto_offset($offset) { "goto *CG_OPS_ADDR[*(cur_opcode += $offset)]"; }
+
+=begin
+
+=item C<defines()>
+
+Returns the register access macros of C<Ops::Trans::C>, plus the dispatch
+macros of the computed goto core.
+
+=end
+
+method defines($emitter) {
+    return self.register_defines($emitter) ~ q|
+#define CG_OPS_ADDR (interp->code->cg_ops_addr)
+#define CG_DISPATCH goto *CG_OPS_ADDR[*cur_opcode]
+
+/* a jump to an absolute address may have entered another segment */
+#define CG_ENTER \
+    if (interp->code->cg_op_count != interp->code->op_count) \
+        Parrot_runcore_cgoto_prepare(interp, interp->code)
+|;
+}
+
+method emit_source_part($emitter, $fh) {
+    $fh.print(q|
+
+/*
+** Op Labels and Bodies:
+*/
+
+opcode_t *
+Parrot_cg_core(opcode_t *cur_opcode, PARROT_INTERP)
+{
+    /* when called with a NULL pc, return the label table */
+    static void *ops_addr[| ~ self<num_entries> ~ q|] = {
+|);
+
+    for self<op_labels> {
+        $fh.print($_)
+    }
+
+    $fh.print(q|        NULL
+    };
+
+    if (!cur_opcode)
+        return (opcode_t *)ops_addr;
+
+    CG_ENTER;
+    CG_DISPATCH;
+
+|);
+
+    for self<op_funcs> -> $op {
+        $fh.print($op);
+    }
+
+    $fh.print(q|
+    /* not reached */
+    return NULL;
+}
+|);
+}
+
+method emit_op_lookup($emitter, $fh) { }
+
+# vim: expandtab shiftwidth=4 ft=perl6:
@@ -0,0 +1,75 @@
+# Copyright (C) 2001-2011, Parrot Foundation.
+
+=head1 NAME
+
+config/auto/cgoto - Computed C<goto>
+
+=head1 DESCRIPTION
+
+Determines whether the compiler supports taking the address of a label and
+jumping through it (C<&&label> and C<goto *ptr>), as GCC and compatible
+compilers do.  If so, the computed goto runcore F<src/ops/core_ops_cg.c> is
+built in.
+
+=cut
+
+package auto::cgoto;
+
+use strict;
+use warnings;
+
+use base qw(Parrot::Configure::Step);
+
+use Parrot::Configure::Utils ':auto';
+
+
+sub _init {
+    my $self = shift;
+    my %data;
+    $data{description} = q{Does your compiler support computed goto};
+    $data{result}      = q{};
+    return \%data;
+}
+
+sub runstep {
+    my ( $self, $conf ) = @_;
+
+    my $errormsg = _probe_for_cgoto($conf);
+    $conf->cc_clean();
+    $self->_evaluate_cgoto($conf, $errormsg);
+    return 1;
+}
+
+sub _probe_for_cgoto {
+    my $conf = shift;
+    my $errormsg;
+    $conf->cc_gen('config/auto/cgoto/test_c.in');
+    eval { $conf->cc_build(); };
+    if ($@) {
+        $errormsg = 1;
+    }
+    else {
+        $errormsg = 1 if $conf->cc_run() !~ /ok/;
+    }
+    return $errormsg;
+}
+
+sub _evaluate_cgoto {
+    my ($self, $conf, $anyerror) = @_;
+    my $test;
+    $test = (! defined $anyerror) ? 1 : 0;
+    $conf->data->set( cgoto => $test );
+    my $test_str = $test ? " (Yep) " : " (no) ";
+    $conf->debug($test_str);
+    $self->set_result( $test ? 'yes' : 'no' );
+    return 1;
+}
+
+1;
+
+# Local Variables:
+#   mode: cperl
+#   cperl-indent-level: 4
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4:
@@ -11,6 +11,10 @@ C<--jitcapable> and C<--execcapable> options to override the default
 value calculated specifically for your CPU architecture and operating
 system.
 
+The tracing JIT core emits x86-64 code for 64-bit C<INTVAL>s and
+C<FLOATVAL>s, following the System V calling convention.  It also needs to
+map memory executable, which is checked by running a small program.
+
 Code formerly found in this step class used to determine characteristics
 of the CPU has been moved into the preceding step class, auto::arch.
 
@@ -34,15 +38,16 @@ sub _init {
 sub runstep {
     my ( $self, $conf ) = @_;
 
-    my $osname  = $conf->data->get('osname');
-    my $cpuarch = $conf->data->get('cpuarch');
+    my $osname     = $conf->data->get('osname');
+    my $cpuarch    = $conf->data->get('cpuarch');
+    my $jitcapable = _jit_capable($conf);
 
     $conf->data->set(
-        jitarchname    => 'nojit',
+        jitarchname    => $jitcapable ? "$cpuarch-$osname" : 'nojit',
         jitcpuarch     => $cpuarch,
         jitcpu         => $cpuarch,
         jitosname      => $osname,
-        jitcapable     => 0,
+        jitcapable     => $jitcapable,
         execcapable    => 0,
         cc_hasjit      => '',
         TEMP_jit_o     => '',
@@ -51,10 +56,44 @@ sub runstep {
         TEMP_exec_dep  => '',
         asmfun_o       => '',
     );
-    $self->set_result('no');
+    $self->set_result( $jitcapable ? 'yes' : 'no' );
     return 1;
 }
 
+sub _jit_capable {
+    my $conf = shift;
+
+    my $osname  = $conf->data->get('osname');
+    my $cpuarch = $conf->data->get('cpuarch');
+
+    if (defined $conf->options->get('jitcapable')) {
+        my $jitcapable = $conf->options->get('jitcapable') ? 1 : 0;
+        $conf->data->set( has_exec_protect => 1 ) if $jitcapable;
+        return $jitcapable;
+    }
+
+    return 0 unless $cpuarch eq 'amd64' || $cpuarch eq 'x86_64';
+    return 0 if $osname =~ /^(?:MSWin32|cygwin)$/;
+    return 0 unless $conf->data->get('intvalsize') == 8
+                 && $conf->data->get('nvsize')     == 8;
+
+    return _exec_memory_usable($conf);
+}
+
+sub _exec_memory_usable {
+    my $conf = shift;
+
+    $conf->cc_gen('config/auto/jit/test_exec_c.in');
+    eval { $conf->cc_build(); };
+    my $usable = !$@ && $conf->cc_run() =~ /ok/;
+    $conf->cc_clean();
+
+    # traces are mapped executable with mem_alloc_executable()
+    $conf->data->set( has_exec_protect => 1 ) if $usable;
+
+    return $usable ? 1 : 0;
+}
+
 1;
 
 # Local Variables:
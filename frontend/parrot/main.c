@@ -396,7 +396,7 @@ help(void)
     "       --hash-seed F00F  specify hex value to use as hash seed\n"
     "    -X --dynext add path to dynamic extension search\n"
     "   <Run core options>\n"
-    "    -R --runcore slow|bounds|fast\n"
+    "    -R --runcore slow|bounds|fast|threaded|cgoto|jit\n"
     "    -R --runcore trace|profiling|gcdebug\n"
     "    -t --trace [flags]\n"
     "   <VM options>\n"
@@ -406,9 +406,15 @@ help(void)
     "    -w --warnings\n"
     "    -G --no-gc\n"
     "       --gc-threshold=percentage    maximum memory wasted by GC\n"
+    "       --gc-max-pause=usec          mark incrementally in pauses of usec\n"
+    "       --gc-mark-threads=count      mark big heaps on count threads\n"
+    "       --gc-precise-roots           scan only the innermost C frames\n"
+    "       --gc-overhead=percentage     target share of time spent in GC\n"
+    "       --gc-max-threshold=kbytes    most memory allocated between GC runs\n"
+    "       --gc-log=file                log each GC run to file, - for stderr\n"
     "       --gc-debug\n"
     "       --leak-test|--destroy-at-end\n"
-    "    -g --gc ms|inf set GC type\n"
+    "    -g --gc ms|gms|inf set GC type\n"
     "    -. --wait    Read a keystroke before starting\n"
     "       --runtime-prefix\n"
     "   <Compiler options>\n"
@@ -456,6 +462,12 @@ Parrot_cmd_options(void)
         { 'R', 'R', OPTION_required_FLAG, { "--runcore" } },
         { 'g', 'g', OPTION_required_FLAG, { "--gc" } },
         { '\0', OPT_GC_THRESHOLD, OPTION_required_FLAG, { "--gc-threshold" } },
+        { '\0', OPT_GC_MAX_PAUSE, OPTION_required_FLAG, { "--gc-max-pause" } },
+        { '\0', OPT_GC_MARK_THREADS, OPTION_required_FLAG, { "--gc-mark-threads" } },
+        { '\0', OPT_GC_PRECISE_ROOTS, (OPTION_flags)0, { "--gc-precise-roots" } },
+        { '\0', OPT_GC_OVERHEAD, OPTION_required_FLAG, { "--gc-overhead" } },
+        { '\0', OPT_GC_MAX_THRESHOLD, OPTION_required_FLAG, { "--gc-max-threshold" } },
+        { '\0', OPT_GC_LOG, OPTION_required_FLAG, { "--gc-log" } },
         { 'V', 'V', (OPTION_flags)0, { "--version" } },
         { 'X', 'X', OPTION_required_FLAG, { "--dynext" } },
         { '\0', OPT_DESTROY_FLAG, (OPTION_flags)0,
@@ -537,7 +549,6 @@ parseflags_minimal(ARGMOD(Parrot_Init_Args * initargs), int argc, ARGIN(const ch
             }
             arg = argv[pos];
             initargs->gc_system = arg;
-            break;
         }
 
         /* arg should start with --gc-threshold *and* contain more chars */
@@ -578,6 +589,46 @@ parseflags_minimal(ARGMOD(Parrot_Init_Args * initargs), int argc, ARGIN(const ch
             ++pos;
             arg = argv[pos];
         }
+        else if (!strncmp(arg, "--gc-max-pause", 14)) {
+
+            if (arg[14] == '=')
+                arg += 15;
+            else if (arg[14] == '\0' && pos < argc - 1)
+                arg = argv[++pos];
+            else {
+                fprintf(stderr, "--gc-max-pause needs an argument");
+                exit(EXIT_FAILURE);
+            }
+
+            if (is_all_digits(arg))
+                initargs->gc_max_pause = strtoul(arg, NULL, 10);
+            else {
+                fprintf(stderr, "error: invalid GC max pause specified:"
+                        "'%s'\n", arg);
+                exit(EXIT_FAILURE);
+            }
+        }
+        else if (!strncmp(arg, "--gc-mark-threads", 17)) {
+
+            if (arg[17] == '=')
+                arg += 18;
+            else if (arg[17] == '\0' && pos < argc - 1)
+                arg = argv[++pos];
+            else {
+                fprintf(stderr, "--gc-mark-threads needs an argument");
+                exit(EXIT_FAILURE);
+            }
+
+            if (is_all_digits(arg))
+                initargs->gc_mark_threads = strtoul(arg, NULL, 10);
+            else {
+                fprintf(stderr, "error: invalid GC mark threads specified:"
+                        "'%s'\n", arg);
+                exit(EXIT_FAILURE);
+            }
+        }
+        else if (!strcmp(arg, "--gc-precise-roots"))
+            initargs->gc_precise_roots = 1;
         else if (!strncmp(arg, "--hash-seed", 11)) {
 
             if ((arg = strrchr(arg, '=')))
@@ -640,6 +691,28 @@ parseflags(Parrot_PMC interp,
           case OPT_GC_THRESHOLD:
             /* handled in parseflags_minimal */
             break;
+          case OPT_GC_MAX_PAUSE:
+            /* handled in parseflags_minimal */
+            break;
+          case OPT_GC_MARK_THREADS:
+            /* handled in parseflags_minimal */
+            break;
+          case OPT_GC_PRECISE_ROOTS:
+            /* handled in parseflags_minimal */
+            break;
+          case OPT_GC_OVERHEAD:
+            result = is_all_digits(opt.opt_arg)
+                  && Parrot_api_set_gc_overhead(interp,
+                        strtol(opt.opt_arg, NULL, 10));
+            break;
+          case OPT_GC_MAX_THRESHOLD:
+            result = is_all_digits(opt.opt_arg)
+                  && Parrot_api_set_gc_max_threshold(interp,
+                        strtol(opt.opt_arg, NULL, 10));
+            break;
+          case OPT_GC_LOG:
+            result = Parrot_api_set_gc_log(interp, opt.opt_arg);
+            break;
           case 't':
             if (opt.opt_arg && is_all_hex_digits(opt.opt_arg)) {
                 const unsigned long _temp = strtoul(opt.opt_arg, NULL, 16);
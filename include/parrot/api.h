@@ -51,6 +51,9 @@ typedef struct _Parrot_Init_Args {
     void *stacktop;
     const char * gc_system;
     Parrot_Int gc_threshold;
+    Parrot_Int gc_max_pause;
+    Parrot_Int gc_mark_threads;
+    Parrot_Int gc_precise_roots;
     Parrot_UInt hash_seed;
 } Parrot_Init_Args;
 
@@ -206,6 +209,22 @@ Parrot_Int Parrot_api_set_executable_name(
     ARGIN(const char * name))
         __attribute__nonnull__(2);
 
+PARROT_API
+Parrot_Int Parrot_api_set_gc_log(
+    Parrot_PMC interp_pmc,
+    ARGIN(const char *filename))
+        __attribute__nonnull__(2);
+
+PARROT_API
+Parrot_Int Parrot_api_set_gc_max_threshold(
+    Parrot_PMC interp_pmc,
+    Parrot_Int kbytes);
+
+PARROT_API
+Parrot_Int Parrot_api_set_gc_overhead(
+    Parrot_PMC interp_pmc,
+    Parrot_Int percent);
+
 PARROT_API
 Parrot_Int Parrot_api_set_output_file(
     Parrot_PMC interp_pmc,
@@ -290,6 +309,11 @@ Parrot_Int Parrot_api_wrap_imcc_hack(
 #define ASSERT_ARGS_Parrot_api_set_executable_name \
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(name))
+#define ASSERT_ARGS_Parrot_api_set_gc_log __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(filename))
+#define ASSERT_ARGS_Parrot_api_set_gc_max_threshold \
+     __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
+#define ASSERT_ARGS_Parrot_api_set_gc_overhead __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
 #define ASSERT_ARGS_Parrot_api_set_output_file __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
 #define ASSERT_ARGS_Parrot_api_set_runcore __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(corename))
@@ -25,6 +25,30 @@ typedef struct _meth_cache_entry {
     struct _meth_cache_entry *next;
 } Meth_cache_entry;
 
+/* receiver types a method call site caches */
+#define METHOD_IC_SIZE 4
+
+/*
+ * inline method cache entry: the method found for a receiver type
+ */
+typedef struct _method_ic_entry {
+    struct _vtable          * vtable;   /* receiver vtable */
+    PMC                     * _class;   /* receiver class, for Object instances */
+    struct parrot_string_t  * name;     /* constant method name */
+    PMC                     * pmc;      /* the method sub pmc */
+} Method_ic_entry;
+
+/*
+ * inline method cache of a call site, see Parrot_find_method_inline_cached
+ */
+typedef struct _method_ic {
+    struct _method_ic *prev;    /* all inline caches, for marking */
+    struct _method_ic *next;
+    UINTVAL generation;         /* cache generation the entries belong to */
+    UINTVAL count;              /* entries used */
+    Method_ic_entry entries[METHOD_IC_SIZE];
+} Method_ic;
+
 /*
  * method cache, continuation freelist, stack chunk freelist, regsave cache
  */
@@ -32,6 +56,8 @@ typedef struct _Caches {
     UINTVAL mc_size;            /* sizeof table */
     Meth_cache_entry ***idx;    /* bufstart idx */
     /* PMC **hash */            /* for non-constant keys */
+    UINTVAL generation;         /* bumped whenever methods are invalidated */
+    Method_ic *ics;             /* inline caches of all call sites */
 } Caches;
 
 #endif   /* PARROT_CACHES_H_GUARD */
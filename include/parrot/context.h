@@ -65,6 +65,15 @@ typedef struct Parrot_CallContext_attributes Parrot_Context;
 #define REGNO_STR 2
 #define REGNO_PMC 3
 
+/* Call where a context, or a continuation or lexpad pointing to one, gets
+ * stored where it can outlive its call.  Parrot_pop_context then keeps the
+ * contexts pushed before instead of recycling them. */
+#define PARROT_CONTEXT_CAPTURED(interp) ((interp)->ctx_mem.captures++)
+
+/* The return continuation of a context if it was made already, NULL while it
+ * is deferred.  Parrot_pcc_get_continuation makes it. */
+#define Parrot_pcc_peek_continuation(i, c) (CONTEXT_STRUCT(c)->current_cont)
+
 /* Context accessors functions */
 
 /*
@@ -107,9 +116,9 @@ Parrot_Context* Parrot_pcc_get_context_struct_func(SHIM_INTERP,
     ARGIN_NULLOK(PMC *ctx));
 
 PARROT_EXPORT
-PARROT_PURE_FUNCTION
 PARROT_CAN_RETURN_NULL
-PMC* Parrot_pcc_get_continuation_func(SHIM_INTERP, ARGIN(PMC *ctx))
+PMC* Parrot_pcc_get_continuation_func(PARROT_INTERP, ARGIN(PMC *ctx))
+        __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
 PARROT_EXPORT
@@ -334,7 +343,8 @@ UINTVAL Parrot_pcc_warnings_test_func(SHIM_INTERP,
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
 #define ASSERT_ARGS_Parrot_pcc_get_continuation_func \
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
-       PARROT_ASSERT_ARG(ctx))
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(ctx))
 #define ASSERT_ARGS_Parrot_pcc_get_handlers_func __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(ctx))
 #define ASSERT_ARGS_Parrot_pcc_get_HLL_func __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
@@ -435,7 +445,8 @@ UINTVAL Parrot_pcc_warnings_test_func(SHIM_INTERP,
     CONTEXT_STRUCT(c)->pmc_constants = (ct)->pmc.constants; \
 } while (0)
 
-#  define Parrot_pcc_get_continuation(i, c) (CONTEXT_STRUCT(c)->current_cont)
+#  define Parrot_pcc_get_continuation(i, c) (CONTEXT_STRUCT(c)->current_cont \
+    ? CONTEXT_STRUCT(c)->current_cont : Parrot_pcc_make_continuation((i), (c)))
 #  define Parrot_pcc_set_continuation(i, c, value) (CONTEXT_STRUCT(c)->current_cont = (value))
 
 #  define Parrot_pcc_get_caller_ctx(i, c) (CONTEXT_STRUCT(c)->caller_ctx)
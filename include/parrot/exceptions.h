@@ -150,9 +150,10 @@ void Parrot_confess(
         __attribute__nonnull__(2);
 
 PARROT_EXPORT
-void Parrot_ex_add_c_handler(PARROT_INTERP, ARGIN(Parrot_runloop *jp))
+void Parrot_ex_add_c_handler(PARROT_INTERP, ARGMOD(Parrot_runloop *jp))
         __attribute__nonnull__(1)
-        __attribute__nonnull__(2);
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*jp);
 
 PARROT_EXPORT
 PARROT_CAN_RETURN_NULL
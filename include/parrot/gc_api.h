@@ -32,12 +32,14 @@
 #define ALIGNED_STRING_SIZE(len) (((len) + sizeof (void*) + WORD_ALIGN_1) & WORD_ALIGN_MASK)
 
 #define GC_DYNAMIC_THRESHOLD_DEFAULT 25
+#define GC_OVERHEAD_DEFAULT 5
 
 typedef enum _gc_sys_type_enum {
     MS,  /* mark and sweep */
     INF, /* infinite memory core */
     TMS, /* tricolor mark and sweep */
-    MS2
+    MS2,
+    GMS  /* generational mark and sweep */
 } gc_sys_type_enum;
 
 /* pool iteration */
@@ -90,6 +92,7 @@ typedef enum {
     CURRENT_CONT,
     CURRENT_OBJECT,
     CURRENT_LEXPAD,
+    GC_EVENTS,
 
     /* interpinfo_s constants */
     EXECUTABLE_FULLNAME,
@@ -107,6 +110,28 @@ typedef enum {
 #define GC_strings_cb_FLAG     (UINTVAL)(1 << 4)   /* Invoked from String GC during mem_alloc to sweep dead strings */
                                                    /* garbage collect. */
 
+/* PMCs C code holds while it calls into Parrot. The GC marks them on every
+ * run, and with interp->gc_precise_roots set it doesn't scan the C stack
+ * below the innermost frame. Frames live on the C stack, in the function
+ * pushing them. */
+typedef struct Parrot_GC_Root_Frame {
+    struct Parrot_GC_Root_Frame *prev;
+    PMC                        **roots;
+    size_t                       num_roots;
+} Parrot_GC_Root_Frame;
+
+/* Push _frame rooting the PMC * array _roots, pop it again */
+#define PARROT_GC_PUSH_ROOT_FRAME(_interp, _frame, _roots) \
+    do { \
+        (_frame).prev             = (_interp)->gc_root_frames; \
+        (_frame).roots            = (_roots); \
+        (_frame).num_roots        = sizeof (_roots) / sizeof (PMC *); \
+        (_interp)->gc_root_frames = &(_frame); \
+    } while (0)
+
+#define PARROT_GC_POP_ROOT_FRAME(_interp, _frame) \
+    ((_interp)->gc_root_frames = (_frame).prev)
+
 /* HEADERIZER BEGIN: src/gc/api.c */
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 
@@ -171,6 +196,11 @@ void Parrot_gc_set_system_type(PARROT_INTERP, ARGIN(const char *name))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
+PARROT_EXPORT
+void Parrot_gc_write_barrier(PARROT_INTERP, ARGIN(PMC *pmc))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
 PARROT_EXPORT
 unsigned int Parrot_is_blocked_GC_mark(PARROT_INTERP)
         __attribute__nonnull__(1);
@@ -321,6 +351,11 @@ void Parrot_gc_reallocate_string_storage(PARROT_INTERP,
         __attribute__nonnull__(2)
         FUNC_MODIFIES(*str);
 
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC * Parrot_gc_recent_events(PARROT_INTERP)
+        __attribute__nonnull__(1);
+
 PARROT_CANNOT_RETURN_NULL
 STRING * Parrot_gc_sys_name(PARROT_INTERP)
         __attribute__nonnull__(1);
@@ -366,6 +401,9 @@ int Parrot_gc_total_sized_buffers(PARROT_INTERP)
 #define ASSERT_ARGS_Parrot_gc_set_system_type __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(name))
+#define ASSERT_ARGS_Parrot_gc_write_barrier __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pmc))
 #define ASSERT_ARGS_Parrot_is_blocked_GC_mark __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_Parrot_is_blocked_GC_sweep __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
@@ -460,6 +498,8 @@ int Parrot_gc_total_sized_buffers(PARROT_INTERP)
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(str))
+#define ASSERT_ARGS_Parrot_gc_recent_events __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_Parrot_gc_sys_name __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_Parrot_gc_total_copied __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
@@ -489,6 +529,15 @@ int Parrot_gc_total_sized_buffers(PARROT_INTERP)
 #  define Parrot_gc_mark_PMC_alive(interp, obj) Parrot_gc_mark_PMC_alive_fun((interp), (obj))
 #endif
 
+/* Call after storing a PMC or STRING into a PMC, so that a generational GC
+ * finds it when the PMC is old, and an incremental GC when it traced the PMC
+ * already. */
+#define PARROT_GC_WRITE_BARRIER(interp, pmc) \
+    do if ((PObj_get_FLAGS(pmc) & (PObj_GC_old_FLAG | PObj_GC_remembered_FLAG)) \
+           == PObj_GC_old_FLAG) \
+        Parrot_gc_write_barrier((interp), (pmc)); \
+    while (0)
+
 #endif /* PARROT_GC_API_H_GUARD */
 
 /*
@@ -57,6 +57,10 @@ typedef enum {
     PARROT_SLOW_CORE,                       /* slow bounds/trace/profile core */
     PARROT_FUNCTION_CORE    = PARROT_SLOW_CORE,
     PARROT_FAST_CORE        = 0x01,         /* fast DO_OP core */
+    PARROT_THREADED_CORE    = 0x02,         /* direct-threaded handler core */
+    PARROT_CGOTO_CORE       = 0x04,         /* computed goto core */
+    PARROT_JIT_CORE         = 0x08,         /* fast core tracing hot loops */
+    PARROT_BOUNDS_CORE      = 0x10,         /* checks pc at control transfers */
     PARROT_EXEC_CORE        = 0x20,         /* TODO Parrot_exec_run variants */
     PARROT_GC_DEBUG_CORE    = 0x40,         /* run GC before each op */
     PARROT_DEBUGGER_CORE    = 0x80,         /* used by parrot debugger */
@@ -155,8 +159,9 @@ struct _Caches;         /* caches .h */
 
 
 typedef struct _context_mem {
-    void **free_list;               /* array of free-lists, per size free slots */
-    int n_free_slots;               /* amount of allocated */
+    PMC   **free_list;              /* array of free-lists, per size free slots */
+    size_t  n_free_slots;           /* amount of allocated */
+    UINTVAL captures;               /* contexts escaped so far, from 1 */
 } context_mem;
 
 struct _handler_node_t; /* forward def - exit.h */
@@ -164,6 +169,7 @@ struct _handler_node_t; /* forward def - exit.h */
 /* The actual interpreter structure */
 struct parrot_interp_t {
     PMC                 *ctx;                 /* current Context */
+    context_mem          ctx_mem;             /* popped Contexts for reuse */
 
     struct Memory_Pools *mem_pools;           /* Pointer to this interpreter's
                                                * arena */
@@ -172,6 +178,22 @@ struct parrot_interp_t {
                                                  to current GC subsystem*/
     UINTVAL  gc_threshold;                    /* maximum percentage of memory
                                                  wasted by GC */
+    UINTVAL  gc_max_pause;                    /* target pause of incremental
+                                                 GC marking in usec, 0 for
+                                                 none */
+    UINTVAL  gc_mark_threads;                 /* threads marking big heaps,
+                                                 0 or 1 for none */
+    UINTVAL  gc_overhead;                     /* target percentage of time
+                                                 spent in GC, 0 for a fixed
+                                                 threshold */
+    UINTVAL  gc_max_threshold;                /* most KB allocated between
+                                                 GC runs, 0 for the default */
+    UINTVAL  gc_precise_roots;                /* scan the C stack only above
+                                                 the innermost root frame */
+    struct Parrot_GC_Root_Frame *gc_root_frames; /* PMCs held by the C code
+                                                    calling into Parrot */
+    FILE    *gc_log;                          /* stream logging an event
+                                                 per collection, or NULL */
 
     PMC     *gc_registry;                     /* root set of registered PMCs */
 
@@ -184,6 +206,7 @@ struct parrot_interp_t {
 
     op_func_t *evc_func_table;                /* event check opcode dispatch */
     size_t     evc_func_table_size;
+    volatile INTVAL events_pending;           /* events for polling runcores */
 
     int         n_libs;                       /* count of libs below */
     op_lib_t  **all_op_libs;                  /* all loaded opcode libraries */
@@ -53,7 +53,38 @@ typedef struct _multi_func_list {
     funcptr_t func_ptr;
 } multi_func_list;
 
-#define MMD_Cache Hash
+/* Calls with more arguments than this aren't cached. */
+#define MMD_CACHE_MAX_TYPES       4
+#define MMD_CACHE_INITIAL_BUCKETS 64
+
+typedef struct _mmd_cache_entry {
+    struct _mmd_cache_entry *next;      /* next entry in the same bucket */
+    char   *name;                       /* name of the multi, or NULL */
+    UINTVAL hashval;
+    INTVAL  num_types;
+    INTVAL  types[MMD_CACHE_MAX_TYPES]; /* type ids of the arguments */
+    PMC    *chosen;                     /* candidate to dispatch to */
+} MMD_Cache_entry;
+
+typedef struct _mmd_cache {
+    MMD_Cache_entry **buckets;
+    UINTVAL           mask;             /* number of buckets - 1 */
+    UINTVAL           entries;
+} MMD_Cache;
+
+/* Number of type tuples a polymorphic cache remembers. */
+#define MMD_PIC_SIZE 4
+
+typedef struct _mmd_pic_entry {
+    INTVAL  num_types;
+    INTVAL  types[MMD_CACHE_MAX_TYPES];
+    PMC    *chosen;
+} MMD_PIC_entry;
+
+typedef struct _mmd_pic {
+    UINTVAL       count;                /* number of stores so far */
+    MMD_PIC_entry entries[MMD_PIC_SIZE];
+} MMD_PIC;
 
 /* HEADERIZER BEGIN: src/multidispatch.c */
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
@@ -106,6 +137,18 @@ void Parrot_mmd_cache_destroy(PARROT_INTERP, ARGMOD(MMD_Cache *cache))
         __attribute__nonnull__(2)
         FUNC_MODIFIES(*cache);
 
+PARROT_EXPORT
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+PMC * Parrot_mmd_cache_lookup_by_ids(PARROT_INTERP,
+    ARGIN(MMD_Cache *cache),
+    ARGIN_NULLOK(const char *name),
+    INTVAL num_types,
+    ARGIN(const INTVAL *types))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(5);
+
 PARROT_EXPORT
 PARROT_WARN_UNUSED_RESULT
 PARROT_CAN_RETURN_NULL
@@ -138,6 +181,19 @@ void Parrot_mmd_cache_mark(PARROT_INTERP, ARGMOD(MMD_Cache *cache))
         __attribute__nonnull__(2)
         FUNC_MODIFIES(*cache);
 
+PARROT_EXPORT
+void Parrot_mmd_cache_store_by_ids(PARROT_INTERP,
+    ARGMOD(MMD_Cache *cache),
+    ARGIN_NULLOK(const char *name),
+    INTVAL num_types,
+    ARGIN(const INTVAL *types),
+    ARGIN(PMC *chosen))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(5)
+        __attribute__nonnull__(6)
+        FUNC_MODIFIES(*cache);
+
 PARROT_EXPORT
 void Parrot_mmd_cache_store_by_types(PARROT_INTERP,
     ARGMOD(MMD_Cache *cache),
@@ -194,6 +250,27 @@ void Parrot_mmd_multi_dispatch_from_c_args(PARROT_INTERP,
         __attribute__nonnull__(2)
         __attribute__nonnull__(3);
 
+PARROT_EXPORT
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+PMC * Parrot_mmd_pic_lookup(PARROT_INTERP,
+    ARGIN(const MMD_PIC *pic),
+    ARGIN(PMC *type_tuple))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
+PARROT_EXPORT
+void Parrot_mmd_pic_store(PARROT_INTERP,
+    ARGMOD(MMD_PIC *pic),
+    ARGIN(PMC *type_tuple),
+    ARGIN(PMC *chosen))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4)
+        FUNC_MODIFIES(*pic);
+
 PARROT_EXPORT
 PARROT_CAN_RETURN_NULL
 PARROT_WARN_UNUSED_RESULT
@@ -230,6 +307,11 @@ PMC * Parrot_mmd_sort_manhattan_by_sig_pmc(PARROT_INTERP,
 #define ASSERT_ARGS_Parrot_mmd_cache_destroy __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(cache))
+#define ASSERT_ARGS_Parrot_mmd_cache_lookup_by_ids \
+     __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(cache) \
+    , PARROT_ASSERT_ARG(types))
 #define ASSERT_ARGS_Parrot_mmd_cache_lookup_by_types \
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
@@ -245,6 +327,11 @@ PMC * Parrot_mmd_sort_manhattan_by_sig_pmc(PARROT_INTERP,
 #define ASSERT_ARGS_Parrot_mmd_cache_mark __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(cache))
+#define ASSERT_ARGS_Parrot_mmd_cache_store_by_ids __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(cache) \
+    , PARROT_ASSERT_ARG(types) \
+    , PARROT_ASSERT_ARG(chosen))
 #define ASSERT_ARGS_Parrot_mmd_cache_store_by_types \
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
@@ -274,6 +361,15 @@ PMC * Parrot_mmd_sort_manhattan_by_sig_pmc(PARROT_INTERP,
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(name) \
     , PARROT_ASSERT_ARG(sig))
+#define ASSERT_ARGS_Parrot_mmd_pic_lookup __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pic) \
+    , PARROT_ASSERT_ARG(type_tuple))
+#define ASSERT_ARGS_Parrot_mmd_pic_store __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pic) \
+    , PARROT_ASSERT_ARG(type_tuple) \
+    , PARROT_ASSERT_ARG(chosen))
 #define ASSERT_ARGS_Parrot_mmd_sort_manhattan_by_sig_pmc \
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
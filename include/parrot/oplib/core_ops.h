@@ -1092,6 +1092,292 @@ op_lib_t *Parrot_DynOp_core_2_11_0(PARROT_INTERP, long init);
  opcode_t * Parrot_root_new_p_pc_ic(opcode_t *, PARROT_INTERP);
  opcode_t * Parrot_finalize_p(opcode_t *, PARROT_INTERP);
  opcode_t * Parrot_finalize_pc(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_le_i_ic_ic__mod_i_i_i__unless_i_ic(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_dec_i__branch_ic(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_inc_i__eq_i_i_ic__branch_ic(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_set_i_ic__lt_i_i_ic(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_inc_i__lt_i_i_ic(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_inc_i__branch_ic(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_inc_i__I0(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_inc_i__I1(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_inc_i__I2(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_inc_i__I3(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_inc_i__I4(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_inc_i__I5(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_inc_i__I6(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_inc_i__I7(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_dec_i__I0(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_dec_i__I1(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_dec_i__I2(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_dec_i__I3(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_dec_i__I4(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_dec_i__I5(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_dec_i__I6(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_dec_i__I7(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_set_i_ic__I0(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_set_i_ic__I1(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_set_i_ic__I2(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_set_i_ic__I3(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_set_i_ic__I4(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_set_i_ic__I5(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_set_i_ic__I6(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_set_i_ic__I7(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_lt_i_i_ic__I0_I0(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_lt_i_i_ic__I0_I1(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_lt_i_i_ic__I0_I2(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_lt_i_i_ic__I0_I3(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_lt_i_i_ic__I0_I4(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_lt_i_i_ic__I0_I5(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_lt_i_i_ic__I0_I6(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_lt_i_i_ic__I0_I7(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_lt_i_i_ic__I1_I0(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_lt_i_i_ic__I1_I1(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_lt_i_i_ic__I1_I2(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_lt_i_i_ic__I1_I3(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_lt_i_i_ic__I1_I4(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_lt_i_i_ic__I1_I5(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_lt_i_i_ic__I1_I6(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_lt_i_i_ic__I1_I7(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_lt_i_i_ic__I2_I0(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_lt_i_i_ic__I2_I1(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_lt_i_i_ic__I2_I2(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_lt_i_i_ic__I2_I3(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_lt_i_i_ic__I2_I4(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_lt_i_i_ic__I2_I5(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_lt_i_i_ic__I2_I6(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_lt_i_i_ic__I2_I7(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_lt_i_i_ic__I3_I0(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_lt_i_i_ic__I3_I1(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_lt_i_i_ic__I3_I2(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_lt_i_i_ic__I3_I3(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_lt_i_i_ic__I3_I4(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_lt_i_i_ic__I3_I5(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_lt_i_i_ic__I3_I6(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_lt_i_i_ic__I3_I7(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_lt_i_i_ic__I4_I0(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_lt_i_i_ic__I4_I1(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_lt_i_i_ic__I4_I2(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_lt_i_i_ic__I4_I3(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_lt_i_i_ic__I4_I4(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_lt_i_i_ic__I4_I5(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_lt_i_i_ic__I4_I6(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_lt_i_i_ic__I4_I7(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_lt_i_i_ic__I5_I0(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_lt_i_i_ic__I5_I1(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_lt_i_i_ic__I5_I2(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_lt_i_i_ic__I5_I3(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_lt_i_i_ic__I5_I4(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_lt_i_i_ic__I5_I5(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_lt_i_i_ic__I5_I6(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_lt_i_i_ic__I5_I7(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_lt_i_i_ic__I6_I0(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_lt_i_i_ic__I6_I1(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_lt_i_i_ic__I6_I2(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_lt_i_i_ic__I6_I3(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_lt_i_i_ic__I6_I4(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_lt_i_i_ic__I6_I5(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_lt_i_i_ic__I6_I6(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_lt_i_i_ic__I6_I7(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_lt_i_i_ic__I7_I0(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_lt_i_i_ic__I7_I1(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_lt_i_i_ic__I7_I2(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_lt_i_i_ic__I7_I3(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_lt_i_i_ic__I7_I4(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_lt_i_i_ic__I7_I5(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_lt_i_i_ic__I7_I6(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_lt_i_i_ic__I7_I7(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_i_i__I0_I0(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_i_i__I0_I1(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_i_i__I0_I2(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_i_i__I0_I3(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_i_i__I0_I4(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_i_i__I0_I5(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_i_i__I0_I6(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_i_i__I0_I7(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_i_i__I1_I0(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_i_i__I1_I1(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_i_i__I1_I2(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_i_i__I1_I3(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_i_i__I1_I4(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_i_i__I1_I5(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_i_i__I1_I6(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_i_i__I1_I7(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_i_i__I2_I0(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_i_i__I2_I1(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_i_i__I2_I2(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_i_i__I2_I3(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_i_i__I2_I4(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_i_i__I2_I5(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_i_i__I2_I6(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_i_i__I2_I7(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_i_i__I3_I0(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_i_i__I3_I1(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_i_i__I3_I2(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_i_i__I3_I3(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_i_i__I3_I4(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_i_i__I3_I5(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_i_i__I3_I6(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_i_i__I3_I7(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_i_i__I4_I0(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_i_i__I4_I1(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_i_i__I4_I2(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_i_i__I4_I3(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_i_i__I4_I4(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_i_i__I4_I5(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_i_i__I4_I6(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_i_i__I4_I7(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_i_i__I5_I0(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_i_i__I5_I1(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_i_i__I5_I2(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_i_i__I5_I3(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_i_i__I5_I4(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_i_i__I5_I5(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_i_i__I5_I6(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_i_i__I5_I7(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_i_i__I6_I0(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_i_i__I6_I1(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_i_i__I6_I2(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_i_i__I6_I3(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_i_i__I6_I4(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_i_i__I6_I5(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_i_i__I6_I6(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_i_i__I6_I7(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_i_i__I7_I0(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_i_i__I7_I1(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_i_i__I7_I2(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_i_i__I7_I3(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_i_i__I7_I4(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_i_i__I7_I5(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_i_i__I7_I6(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_i_i__I7_I7(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_set_i_i__I0_I0(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_set_i_i__I0_I1(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_set_i_i__I0_I2(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_set_i_i__I0_I3(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_set_i_i__I0_I4(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_set_i_i__I0_I5(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_set_i_i__I0_I6(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_set_i_i__I0_I7(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_set_i_i__I1_I0(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_set_i_i__I1_I1(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_set_i_i__I1_I2(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_set_i_i__I1_I3(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_set_i_i__I1_I4(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_set_i_i__I1_I5(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_set_i_i__I1_I6(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_set_i_i__I1_I7(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_set_i_i__I2_I0(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_set_i_i__I2_I1(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_set_i_i__I2_I2(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_set_i_i__I2_I3(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_set_i_i__I2_I4(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_set_i_i__I2_I5(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_set_i_i__I2_I6(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_set_i_i__I2_I7(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_set_i_i__I3_I0(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_set_i_i__I3_I1(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_set_i_i__I3_I2(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_set_i_i__I3_I3(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_set_i_i__I3_I4(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_set_i_i__I3_I5(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_set_i_i__I3_I6(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_set_i_i__I3_I7(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_set_i_i__I4_I0(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_set_i_i__I4_I1(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_set_i_i__I4_I2(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_set_i_i__I4_I3(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_set_i_i__I4_I4(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_set_i_i__I4_I5(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_set_i_i__I4_I6(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_set_i_i__I4_I7(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_set_i_i__I5_I0(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_set_i_i__I5_I1(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_set_i_i__I5_I2(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_set_i_i__I5_I3(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_set_i_i__I5_I4(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_set_i_i__I5_I5(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_set_i_i__I5_I6(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_set_i_i__I5_I7(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_set_i_i__I6_I0(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_set_i_i__I6_I1(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_set_i_i__I6_I2(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_set_i_i__I6_I3(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_set_i_i__I6_I4(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_set_i_i__I6_I5(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_set_i_i__I6_I6(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_set_i_i__I6_I7(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_set_i_i__I7_I0(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_set_i_i__I7_I1(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_set_i_i__I7_I2(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_set_i_i__I7_I3(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_set_i_i__I7_I4(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_set_i_i__I7_I5(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_set_i_i__I7_I6(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_set_i_i__I7_I7(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_n_n__N0_N0(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_n_n__N0_N1(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_n_n__N0_N2(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_n_n__N0_N3(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_n_n__N0_N4(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_n_n__N0_N5(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_n_n__N0_N6(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_n_n__N0_N7(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_n_n__N1_N0(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_n_n__N1_N1(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_n_n__N1_N2(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_n_n__N1_N3(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_n_n__N1_N4(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_n_n__N1_N5(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_n_n__N1_N6(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_n_n__N1_N7(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_n_n__N2_N0(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_n_n__N2_N1(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_n_n__N2_N2(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_n_n__N2_N3(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_n_n__N2_N4(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_n_n__N2_N5(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_n_n__N2_N6(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_n_n__N2_N7(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_n_n__N3_N0(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_n_n__N3_N1(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_n_n__N3_N2(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_n_n__N3_N3(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_n_n__N3_N4(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_n_n__N3_N5(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_n_n__N3_N6(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_n_n__N3_N7(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_n_n__N4_N0(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_n_n__N4_N1(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_n_n__N4_N2(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_n_n__N4_N3(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_n_n__N4_N4(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_n_n__N4_N5(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_n_n__N4_N6(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_n_n__N4_N7(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_n_n__N5_N0(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_n_n__N5_N1(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_n_n__N5_N2(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_n_n__N5_N3(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_n_n__N5_N4(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_n_n__N5_N5(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_n_n__N5_N6(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_n_n__N5_N7(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_n_n__N6_N0(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_n_n__N6_N1(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_n_n__N6_N2(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_n_n__N6_N3(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_n_n__N6_N4(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_n_n__N6_N5(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_n_n__N6_N6(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_n_n__N6_N7(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_n_n__N7_N0(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_n_n__N7_N1(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_n_n__N7_N2(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_n_n__N7_N3(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_n_n__N7_N4(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_n_n__N7_N5(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_n_n__N7_N6(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_n_n__N7_N7(opcode_t *, PARROT_INTERP);
 
 
 #endif /* PARROT_OPLIB_CORE_OPS_H_GUARD */
@@ -1085,7 +1085,293 @@ typedef enum {
     PARROT_OP_root_new_p_p_ic,                 /* 1067 */
     PARROT_OP_root_new_p_pc_ic,                /* 1068 */
     PARROT_OP_finalize_p,                      /* 1069 */
-    PARROT_OP_finalize_pc                      /* 1070 */
+    PARROT_OP_finalize_pc,                     /* 1070 */
+    PARROT_OP_le_i_ic_ic__mod_i_i_i__unless_i_ic,  /* 1071 */
+    PARROT_OP_dec_i__branch_ic,                /* 1072 */
+    PARROT_OP_inc_i__eq_i_i_ic__branch_ic,     /* 1073 */
+    PARROT_OP_set_i_ic__lt_i_i_ic,             /* 1074 */
+    PARROT_OP_inc_i__lt_i_i_ic,                /* 1075 */
+    PARROT_OP_inc_i__branch_ic,                /* 1076 */
+    PARROT_OP_inc_i__I0,                       /* 1077 */
+    PARROT_OP_inc_i__I1,                       /* 1078 */
+    PARROT_OP_inc_i__I2,                       /* 1079 */
+    PARROT_OP_inc_i__I3,                       /* 1080 */
+    PARROT_OP_inc_i__I4,                       /* 1081 */
+    PARROT_OP_inc_i__I5,                       /* 1082 */
+    PARROT_OP_inc_i__I6,                       /* 1083 */
+    PARROT_OP_inc_i__I7,                       /* 1084 */
+    PARROT_OP_dec_i__I0,                       /* 1085 */
+    PARROT_OP_dec_i__I1,                       /* 1086 */
+    PARROT_OP_dec_i__I2,                       /* 1087 */
+    PARROT_OP_dec_i__I3,                       /* 1088 */
+    PARROT_OP_dec_i__I4,                       /* 1089 */
+    PARROT_OP_dec_i__I5,                       /* 1090 */
+    PARROT_OP_dec_i__I6,                       /* 1091 */
+    PARROT_OP_dec_i__I7,                       /* 1092 */
+    PARROT_OP_set_i_ic__I0,                    /* 1093 */
+    PARROT_OP_set_i_ic__I1,                    /* 1094 */
+    PARROT_OP_set_i_ic__I2,                    /* 1095 */
+    PARROT_OP_set_i_ic__I3,                    /* 1096 */
+    PARROT_OP_set_i_ic__I4,                    /* 1097 */
+    PARROT_OP_set_i_ic__I5,                    /* 1098 */
+    PARROT_OP_set_i_ic__I6,                    /* 1099 */
+    PARROT_OP_set_i_ic__I7,                    /* 1100 */
+    PARROT_OP_lt_i_i_ic__I0_I0,                /* 1101 */
+    PARROT_OP_lt_i_i_ic__I0_I1,                /* 1102 */
+    PARROT_OP_lt_i_i_ic__I0_I2,                /* 1103 */
+    PARROT_OP_lt_i_i_ic__I0_I3,                /* 1104 */
+    PARROT_OP_lt_i_i_ic__I0_I4,                /* 1105 */
+    PARROT_OP_lt_i_i_ic__I0_I5,                /* 1106 */
+    PARROT_OP_lt_i_i_ic__I0_I6,                /* 1107 */
+    PARROT_OP_lt_i_i_ic__I0_I7,                /* 1108 */
+    PARROT_OP_lt_i_i_ic__I1_I0,                /* 1109 */
+    PARROT_OP_lt_i_i_ic__I1_I1,                /* 1110 */
+    PARROT_OP_lt_i_i_ic__I1_I2,                /* 1111 */
+    PARROT_OP_lt_i_i_ic__I1_I3,                /* 1112 */
+    PARROT_OP_lt_i_i_ic__I1_I4,                /* 1113 */
+    PARROT_OP_lt_i_i_ic__I1_I5,                /* 1114 */
+    PARROT_OP_lt_i_i_ic__I1_I6,                /* 1115 */
+    PARROT_OP_lt_i_i_ic__I1_I7,                /* 1116 */
+    PARROT_OP_lt_i_i_ic__I2_I0,                /* 1117 */
+    PARROT_OP_lt_i_i_ic__I2_I1,                /* 1118 */
+    PARROT_OP_lt_i_i_ic__I2_I2,                /* 1119 */
+    PARROT_OP_lt_i_i_ic__I2_I3,                /* 1120 */
+    PARROT_OP_lt_i_i_ic__I2_I4,                /* 1121 */
+    PARROT_OP_lt_i_i_ic__I2_I5,                /* 1122 */
+    PARROT_OP_lt_i_i_ic__I2_I6,                /* 1123 */
+    PARROT_OP_lt_i_i_ic__I2_I7,                /* 1124 */
+    PARROT_OP_lt_i_i_ic__I3_I0,                /* 1125 */
+    PARROT_OP_lt_i_i_ic__I3_I1,                /* 1126 */
+    PARROT_OP_lt_i_i_ic__I3_I2,                /* 1127 */
+    PARROT_OP_lt_i_i_ic__I3_I3,                /* 1128 */
+    PARROT_OP_lt_i_i_ic__I3_I4,                /* 1129 */
+    PARROT_OP_lt_i_i_ic__I3_I5,                /* 1130 */
+    PARROT_OP_lt_i_i_ic__I3_I6,                /* 1131 */
+    PARROT_OP_lt_i_i_ic__I3_I7,                /* 1132 */
+    PARROT_OP_lt_i_i_ic__I4_I0,                /* 1133 */
+    PARROT_OP_lt_i_i_ic__I4_I1,                /* 1134 */
+    PARROT_OP_lt_i_i_ic__I4_I2,                /* 1135 */
+    PARROT_OP_lt_i_i_ic__I4_I3,                /* 1136 */
+    PARROT_OP_lt_i_i_ic__I4_I4,                /* 1137 */
+    PARROT_OP_lt_i_i_ic__I4_I5,                /* 1138 */
+    PARROT_OP_lt_i_i_ic__I4_I6,                /* 1139 */
+    PARROT_OP_lt_i_i_ic__I4_I7,                /* 1140 */
+    PARROT_OP_lt_i_i_ic__I5_I0,                /* 1141 */
+    PARROT_OP_lt_i_i_ic__I5_I1,                /* 1142 */
+    PARROT_OP_lt_i_i_ic__I5_I2,                /* 1143 */
+    PARROT_OP_lt_i_i_ic__I5_I3,                /* 1144 */
+    PARROT_OP_lt_i_i_ic__I5_I4,                /* 1145 */
+    PARROT_OP_lt_i_i_ic__I5_I5,                /* 1146 */
+    PARROT_OP_lt_i_i_ic__I5_I6,                /* 1147 */
+    PARROT_OP_lt_i_i_ic__I5_I7,                /* 1148 */
+    PARROT_OP_lt_i_i_ic__I6_I0,                /* 1149 */
+    PARROT_OP_lt_i_i_ic__I6_I1,                /* 1150 */
+    PARROT_OP_lt_i_i_ic__I6_I2,                /* 1151 */
+    PARROT_OP_lt_i_i_ic__I6_I3,                /* 1152 */
+    PARROT_OP_lt_i_i_ic__I6_I4,                /* 1153 */
+    PARROT_OP_lt_i_i_ic__I6_I5,                /* 1154 */
+    PARROT_OP_lt_i_i_ic__I6_I6,                /* 1155 */
+    PARROT_OP_lt_i_i_ic__I6_I7,                /* 1156 */
+    PARROT_OP_lt_i_i_ic__I7_I0,                /* 1157 */
+    PARROT_OP_lt_i_i_ic__I7_I1,                /* 1158 */
+    PARROT_OP_lt_i_i_ic__I7_I2,                /* 1159 */
+    PARROT_OP_lt_i_i_ic__I7_I3,                /* 1160 */
+    PARROT_OP_lt_i_i_ic__I7_I4,                /* 1161 */
+    PARROT_OP_lt_i_i_ic__I7_I5,                /* 1162 */
+    PARROT_OP_lt_i_i_ic__I7_I6,                /* 1163 */
+    PARROT_OP_lt_i_i_ic__I7_I7,                /* 1164 */
+    PARROT_OP_add_i_i__I0_I0,                  /* 1165 */
+    PARROT_OP_add_i_i__I0_I1,                  /* 1166 */
+    PARROT_OP_add_i_i__I0_I2,                  /* 1167 */
+    PARROT_OP_add_i_i__I0_I3,                  /* 1168 */
+    PARROT_OP_add_i_i__I0_I4,                  /* 1169 */
+    PARROT_OP_add_i_i__I0_I5,                  /* 1170 */
+    PARROT_OP_add_i_i__I0_I6,                  /* 1171 */
+    PARROT_OP_add_i_i__I0_I7,                  /* 1172 */
+    PARROT_OP_add_i_i__I1_I0,                  /* 1173 */
+    PARROT_OP_add_i_i__I1_I1,                  /* 1174 */
+    PARROT_OP_add_i_i__I1_I2,                  /* 1175 */
+    PARROT_OP_add_i_i__I1_I3,                  /* 1176 */
+    PARROT_OP_add_i_i__I1_I4,                  /* 1177 */
+    PARROT_OP_add_i_i__I1_I5,                  /* 1178 */
+    PARROT_OP_add_i_i__I1_I6,                  /* 1179 */
+    PARROT_OP_add_i_i__I1_I7,                  /* 1180 */
+    PARROT_OP_add_i_i__I2_I0,                  /* 1181 */
+    PARROT_OP_add_i_i__I2_I1,                  /* 1182 */
+    PARROT_OP_add_i_i__I2_I2,                  /* 1183 */
+    PARROT_OP_add_i_i__I2_I3,                  /* 1184 */
+    PARROT_OP_add_i_i__I2_I4,                  /* 1185 */
+    PARROT_OP_add_i_i__I2_I5,                  /* 1186 */
+    PARROT_OP_add_i_i__I2_I6,                  /* 1187 */
+    PARROT_OP_add_i_i__I2_I7,                  /* 1188 */
+    PARROT_OP_add_i_i__I3_I0,                  /* 1189 */
+    PARROT_OP_add_i_i__I3_I1,                  /* 1190 */
+    PARROT_OP_add_i_i__I3_I2,                  /* 1191 */
+    PARROT_OP_add_i_i__I3_I3,                  /* 1192 */
+    PARROT_OP_add_i_i__I3_I4,                  /* 1193 */
+    PARROT_OP_add_i_i__I3_I5,                  /* 1194 */
+    PARROT_OP_add_i_i__I3_I6,                  /* 1195 */
+    PARROT_OP_add_i_i__I3_I7,                  /* 1196 */
+    PARROT_OP_add_i_i__I4_I0,                  /* 1197 */
+    PARROT_OP_add_i_i__I4_I1,                  /* 1198 */
+    PARROT_OP_add_i_i__I4_I2,                  /* 1199 */
+    PARROT_OP_add_i_i__I4_I3,                  /* 1200 */
+    PARROT_OP_add_i_i__I4_I4,                  /* 1201 */
+    PARROT_OP_add_i_i__I4_I5,                  /* 1202 */
+    PARROT_OP_add_i_i__I4_I6,                  /* 1203 */
+    PARROT_OP_add_i_i__I4_I7,                  /* 1204 */
+    PARROT_OP_add_i_i__I5_I0,                  /* 1205 */
+    PARROT_OP_add_i_i__I5_I1,                  /* 1206 */
+    PARROT_OP_add_i_i__I5_I2,                  /* 1207 */
+    PARROT_OP_add_i_i__I5_I3,                  /* 1208 */
+    PARROT_OP_add_i_i__I5_I4,                  /* 1209 */
+    PARROT_OP_add_i_i__I5_I5,                  /* 1210 */
+    PARROT_OP_add_i_i__I5_I6,                  /* 1211 */
+    PARROT_OP_add_i_i__I5_I7,                  /* 1212 */
+    PARROT_OP_add_i_i__I6_I0,                  /* 1213 */
+    PARROT_OP_add_i_i__I6_I1,                  /* 1214 */
+    PARROT_OP_add_i_i__I6_I2,                  /* 1215 */
+    PARROT_OP_add_i_i__I6_I3,                  /* 1216 */
+    PARROT_OP_add_i_i__I6_I4,                  /* 1217 */
+    PARROT_OP_add_i_i__I6_I5,                  /* 1218 */
+    PARROT_OP_add_i_i__I6_I6,                  /* 1219 */
+    PARROT_OP_add_i_i__I6_I7,                  /* 1220 */
+    PARROT_OP_add_i_i__I7_I0,                  /* 1221 */
+    PARROT_OP_add_i_i__I7_I1,                  /* 1222 */
+    PARROT_OP_add_i_i__I7_I2,                  /* 1223 */
+    PARROT_OP_add_i_i__I7_I3,                  /* 1224 */
+    PARROT_OP_add_i_i__I7_I4,                  /* 1225 */
+    PARROT_OP_add_i_i__I7_I5,                  /* 1226 */
+    PARROT_OP_add_i_i__I7_I6,                  /* 1227 */
+    PARROT_OP_add_i_i__I7_I7,                  /* 1228 */
+    PARROT_OP_set_i_i__I0_I0,                  /* 1229 */
+    PARROT_OP_set_i_i__I0_I1,                  /* 1230 */
+    PARROT_OP_set_i_i__I0_I2,                  /* 1231 */
+    PARROT_OP_set_i_i__I0_I3,                  /* 1232 */
+    PARROT_OP_set_i_i__I0_I4,                  /* 1233 */
+    PARROT_OP_set_i_i__I0_I5,                  /* 1234 */
+    PARROT_OP_set_i_i__I0_I6,                  /* 1235 */
+    PARROT_OP_set_i_i__I0_I7,                  /* 1236 */
+    PARROT_OP_set_i_i__I1_I0,                  /* 1237 */
+    PARROT_OP_set_i_i__I1_I1,                  /* 1238 */
+    PARROT_OP_set_i_i__I1_I2,                  /* 1239 */
+    PARROT_OP_set_i_i__I1_I3,                  /* 1240 */
+    PARROT_OP_set_i_i__I1_I4,                  /* 1241 */
+    PARROT_OP_set_i_i__I1_I5,                  /* 1242 */
+    PARROT_OP_set_i_i__I1_I6,                  /* 1243 */
+    PARROT_OP_set_i_i__I1_I7,                  /* 1244 */
+    PARROT_OP_set_i_i__I2_I0,                  /* 1245 */
+    PARROT_OP_set_i_i__I2_I1,                  /* 1246 */
+    PARROT_OP_set_i_i__I2_I2,                  /* 1247 */
+    PARROT_OP_set_i_i__I2_I3,                  /* 1248 */
+    PARROT_OP_set_i_i__I2_I4,                  /* 1249 */
+    PARROT_OP_set_i_i__I2_I5,                  /* 1250 */
+    PARROT_OP_set_i_i__I2_I6,                  /* 1251 */
+    PARROT_OP_set_i_i__I2_I7,                  /* 1252 */
+    PARROT_OP_set_i_i__I3_I0,                  /* 1253 */
+    PARROT_OP_set_i_i__I3_I1,                  /* 1254 */
+    PARROT_OP_set_i_i__I3_I2,                  /* 1255 */
+    PARROT_OP_set_i_i__I3_I3,                  /* 1256 */
+    PARROT_OP_set_i_i__I3_I4,                  /* 1257 */
+    PARROT_OP_set_i_i__I3_I5,                  /* 1258 */
+    PARROT_OP_set_i_i__I3_I6,                  /* 1259 */
+    PARROT_OP_set_i_i__I3_I7,                  /* 1260 */
+    PARROT_OP_set_i_i__I4_I0,                  /* 1261 */
+    PARROT_OP_set_i_i__I4_I1,                  /* 1262 */
+    PARROT_OP_set_i_i__I4_I2,                  /* 1263 */
+    PARROT_OP_set_i_i__I4_I3,                  /* 1264 */
+    PARROT_OP_set_i_i__I4_I4,                  /* 1265 */
+    PARROT_OP_set_i_i__I4_I5,                  /* 1266 */
+    PARROT_OP_set_i_i__I4_I6,                  /* 1267 */
+    PARROT_OP_set_i_i__I4_I7,                  /* 1268 */
+    PARROT_OP_set_i_i__I5_I0,                  /* 1269 */
+    PARROT_OP_set_i_i__I5_I1,                  /* 1270 */
+    PARROT_OP_set_i_i__I5_I2,                  /* 1271 */
+    PARROT_OP_set_i_i__I5_I3,                  /* 1272 */
+    PARROT_OP_set_i_i__I5_I4,                  /* 1273 */
+    PARROT_OP_set_i_i__I5_I5,                  /* 1274 */
+    PARROT_OP_set_i_i__I5_I6,                  /* 1275 */
+    PARROT_OP_set_i_i__I5_I7,                  /* 1276 */
+    PARROT_OP_set_i_i__I6_I0,                  /* 1277 */
+    PARROT_OP_set_i_i__I6_I1,                  /* 1278 */
+    PARROT_OP_set_i_i__I6_I2,                  /* 1279 */
+    PARROT_OP_set_i_i__I6_I3,                  /* 1280 */
+    PARROT_OP_set_i_i__I6_I4,                  /* 1281 */
+    PARROT_OP_set_i_i__I6_I5,                  /* 1282 */
+    PARROT_OP_set_i_i__I6_I6,                  /* 1283 */
+    PARROT_OP_set_i_i__I6_I7,                  /* 1284 */
+    PARROT_OP_set_i_i__I7_I0,                  /* 1285 */
+    PARROT_OP_set_i_i__I7_I1,                  /* 1286 */
+    PARROT_OP_set_i_i__I7_I2,                  /* 1287 */
+    PARROT_OP_set_i_i__I7_I3,                  /* 1288 */
+    PARROT_OP_set_i_i__I7_I4,                  /* 1289 */
+    PARROT_OP_set_i_i__I7_I5,                  /* 1290 */
+    PARROT_OP_set_i_i__I7_I6,                  /* 1291 */
+    PARROT_OP_set_i_i__I7_I7,                  /* 1292 */
+    PARROT_OP_add_n_n__N0_N0,                  /* 1293 */
+    PARROT_OP_add_n_n__N0_N1,                  /* 1294 */
+    PARROT_OP_add_n_n__N0_N2,                  /* 1295 */
+    PARROT_OP_add_n_n__N0_N3,                  /* 1296 */
+    PARROT_OP_add_n_n__N0_N4,                  /* 1297 */
+    PARROT_OP_add_n_n__N0_N5,                  /* 1298 */
+    PARROT_OP_add_n_n__N0_N6,                  /* 1299 */
+    PARROT_OP_add_n_n__N0_N7,                  /* 1300 */
+    PARROT_OP_add_n_n__N1_N0,                  /* 1301 */
+    PARROT_OP_add_n_n__N1_N1,                  /* 1302 */
+    PARROT_OP_add_n_n__N1_N2,                  /* 1303 */
+    PARROT_OP_add_n_n__N1_N3,                  /* 1304 */
+    PARROT_OP_add_n_n__N1_N4,                  /* 1305 */
+    PARROT_OP_add_n_n__N1_N5,                  /* 1306 */
+    PARROT_OP_add_n_n__N1_N6,                  /* 1307 */
+    PARROT_OP_add_n_n__N1_N7,                  /* 1308 */
+    PARROT_OP_add_n_n__N2_N0,                  /* 1309 */
+    PARROT_OP_add_n_n__N2_N1,                  /* 1310 */
+    PARROT_OP_add_n_n__N2_N2,                  /* 1311 */
+    PARROT_OP_add_n_n__N2_N3,                  /* 1312 */
+    PARROT_OP_add_n_n__N2_N4,                  /* 1313 */
+    PARROT_OP_add_n_n__N2_N5,                  /* 1314 */
+    PARROT_OP_add_n_n__N2_N6,                  /* 1315 */
+    PARROT_OP_add_n_n__N2_N7,                  /* 1316 */
+    PARROT_OP_add_n_n__N3_N0,                  /* 1317 */
+    PARROT_OP_add_n_n__N3_N1,                  /* 1318 */
+    PARROT_OP_add_n_n__N3_N2,                  /* 1319 */
+    PARROT_OP_add_n_n__N3_N3,                  /* 1320 */
+    PARROT_OP_add_n_n__N3_N4,                  /* 1321 */
+    PARROT_OP_add_n_n__N3_N5,                  /* 1322 */
+    PARROT_OP_add_n_n__N3_N6,                  /* 1323 */
+    PARROT_OP_add_n_n__N3_N7,                  /* 1324 */
+    PARROT_OP_add_n_n__N4_N0,                  /* 1325 */
+    PARROT_OP_add_n_n__N4_N1,                  /* 1326 */
+    PARROT_OP_add_n_n__N4_N2,                  /* 1327 */
+    PARROT_OP_add_n_n__N4_N3,                  /* 1328 */
+    PARROT_OP_add_n_n__N4_N4,                  /* 1329 */
+    PARROT_OP_add_n_n__N4_N5,                  /* 1330 */
+    PARROT_OP_add_n_n__N4_N6,                  /* 1331 */
+    PARROT_OP_add_n_n__N4_N7,                  /* 1332 */
+    PARROT_OP_add_n_n__N5_N0,                  /* 1333 */
+    PARROT_OP_add_n_n__N5_N1,                  /* 1334 */
+    PARROT_OP_add_n_n__N5_N2,                  /* 1335 */
+    PARROT_OP_add_n_n__N5_N3,                  /* 1336 */
+    PARROT_OP_add_n_n__N5_N4,                  /* 1337 */
+    PARROT_OP_add_n_n__N5_N5,                  /* 1338 */
+    PARROT_OP_add_n_n__N5_N6,                  /* 1339 */
+    PARROT_OP_add_n_n__N5_N7,                  /* 1340 */
+    PARROT_OP_add_n_n__N6_N0,                  /* 1341 */
+    PARROT_OP_add_n_n__N6_N1,                  /* 1342 */
+    PARROT_OP_add_n_n__N6_N2,                  /* 1343 */
+    PARROT_OP_add_n_n__N6_N3,                  /* 1344 */
+    PARROT_OP_add_n_n__N6_N4,                  /* 1345 */
+    PARROT_OP_add_n_n__N6_N5,                  /* 1346 */
+    PARROT_OP_add_n_n__N6_N6,                  /* 1347 */
+    PARROT_OP_add_n_n__N6_N7,                  /* 1348 */
+    PARROT_OP_add_n_n__N7_N0,                  /* 1349 */
+    PARROT_OP_add_n_n__N7_N1,                  /* 1350 */
+    PARROT_OP_add_n_n__N7_N2,                  /* 1351 */
+    PARROT_OP_add_n_n__N7_N3,                  /* 1352 */
+    PARROT_OP_add_n_n__N7_N4,                  /* 1353 */
+    PARROT_OP_add_n_n__N7_N5,                  /* 1354 */
+    PARROT_OP_add_n_n__N7_N6,                  /* 1355 */
+    PARROT_OP_add_n_n__N7_N7                   /* 1356 */
 
 } parrot_opcode_enums;
 
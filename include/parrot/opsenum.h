@@ -1085,6 +1085,292 @@ enum OPS_ENUM {
     enum_ops_root_new_p_pc_ic              = 1068,
     enum_ops_finalize_p                    = 1069,
     enum_ops_finalize_pc                   = 1070,
+    enum_ops_le_i_ic_ic__mod_i_i_i__unless_i_ic= 1071,
+    enum_ops_dec_i__branch_ic              = 1072,
+    enum_ops_inc_i__eq_i_i_ic__branch_ic   = 1073,
+    enum_ops_set_i_ic__lt_i_i_ic           = 1074,
+    enum_ops_inc_i__lt_i_i_ic              = 1075,
+    enum_ops_inc_i__branch_ic              = 1076,
+    enum_ops_inc_i__I0                     = 1077,
+    enum_ops_inc_i__I1                     = 1078,
+    enum_ops_inc_i__I2                     = 1079,
+    enum_ops_inc_i__I3                     = 1080,
+    enum_ops_inc_i__I4                     = 1081,
+    enum_ops_inc_i__I5                     = 1082,
+    enum_ops_inc_i__I6                     = 1083,
+    enum_ops_inc_i__I7                     = 1084,
+    enum_ops_dec_i__I0                     = 1085,
+    enum_ops_dec_i__I1                     = 1086,
+    enum_ops_dec_i__I2                     = 1087,
+    enum_ops_dec_i__I3                     = 1088,
+    enum_ops_dec_i__I4                     = 1089,
+    enum_ops_dec_i__I5                     = 1090,
+    enum_ops_dec_i__I6                     = 1091,
+    enum_ops_dec_i__I7                     = 1092,
+    enum_ops_set_i_ic__I0                  = 1093,
+    enum_ops_set_i_ic__I1                  = 1094,
+    enum_ops_set_i_ic__I2                  = 1095,
+    enum_ops_set_i_ic__I3                  = 1096,
+    enum_ops_set_i_ic__I4                  = 1097,
+    enum_ops_set_i_ic__I5                  = 1098,
+    enum_ops_set_i_ic__I6                  = 1099,
+    enum_ops_set_i_ic__I7                  = 1100,
+    enum_ops_lt_i_i_ic__I0_I0              = 1101,
+    enum_ops_lt_i_i_ic__I0_I1              = 1102,
+    enum_ops_lt_i_i_ic__I0_I2              = 1103,
+    enum_ops_lt_i_i_ic__I0_I3              = 1104,
+    enum_ops_lt_i_i_ic__I0_I4              = 1105,
+    enum_ops_lt_i_i_ic__I0_I5              = 1106,
+    enum_ops_lt_i_i_ic__I0_I6              = 1107,
+    enum_ops_lt_i_i_ic__I0_I7              = 1108,
+    enum_ops_lt_i_i_ic__I1_I0              = 1109,
+    enum_ops_lt_i_i_ic__I1_I1              = 1110,
+    enum_ops_lt_i_i_ic__I1_I2              = 1111,
+    enum_ops_lt_i_i_ic__I1_I3              = 1112,
+    enum_ops_lt_i_i_ic__I1_I4              = 1113,
+    enum_ops_lt_i_i_ic__I1_I5              = 1114,
+    enum_ops_lt_i_i_ic__I1_I6              = 1115,
+    enum_ops_lt_i_i_ic__I1_I7              = 1116,
+    enum_ops_lt_i_i_ic__I2_I0              = 1117,
+    enum_ops_lt_i_i_ic__I2_I1              = 1118,
+    enum_ops_lt_i_i_ic__I2_I2              = 1119,
+    enum_ops_lt_i_i_ic__I2_I3              = 1120,
+    enum_ops_lt_i_i_ic__I2_I4              = 1121,
+    enum_ops_lt_i_i_ic__I2_I5              = 1122,
+    enum_ops_lt_i_i_ic__I2_I6              = 1123,
+    enum_ops_lt_i_i_ic__I2_I7              = 1124,
+    enum_ops_lt_i_i_ic__I3_I0              = 1125,
+    enum_ops_lt_i_i_ic__I3_I1              = 1126,
+    enum_ops_lt_i_i_ic__I3_I2              = 1127,
+    enum_ops_lt_i_i_ic__I3_I3              = 1128,
+    enum_ops_lt_i_i_ic__I3_I4              = 1129,
+    enum_ops_lt_i_i_ic__I3_I5              = 1130,
+    enum_ops_lt_i_i_ic__I3_I6              = 1131,
+    enum_ops_lt_i_i_ic__I3_I7              = 1132,
+    enum_ops_lt_i_i_ic__I4_I0              = 1133,
+    enum_ops_lt_i_i_ic__I4_I1              = 1134,
+    enum_ops_lt_i_i_ic__I4_I2              = 1135,
+    enum_ops_lt_i_i_ic__I4_I3              = 1136,
+    enum_ops_lt_i_i_ic__I4_I4              = 1137,
+    enum_ops_lt_i_i_ic__I4_I5              = 1138,
+    enum_ops_lt_i_i_ic__I4_I6              = 1139,
+    enum_ops_lt_i_i_ic__I4_I7              = 1140,
+    enum_ops_lt_i_i_ic__I5_I0              = 1141,
+    enum_ops_lt_i_i_ic__I5_I1              = 1142,
+    enum_ops_lt_i_i_ic__I5_I2              = 1143,
+    enum_ops_lt_i_i_ic__I5_I3              = 1144,
+    enum_ops_lt_i_i_ic__I5_I4              = 1145,
+    enum_ops_lt_i_i_ic__I5_I5              = 1146,
+    enum_ops_lt_i_i_ic__I5_I6              = 1147,
+    enum_ops_lt_i_i_ic__I5_I7              = 1148,
+    enum_ops_lt_i_i_ic__I6_I0              = 1149,
+    enum_ops_lt_i_i_ic__I6_I1              = 1150,
+    enum_ops_lt_i_i_ic__I6_I2              = 1151,
+    enum_ops_lt_i_i_ic__I6_I3              = 1152,
+    enum_ops_lt_i_i_ic__I6_I4              = 1153,
+    enum_ops_lt_i_i_ic__I6_I5              = 1154,
+    enum_ops_lt_i_i_ic__I6_I6              = 1155,
+    enum_ops_lt_i_i_ic__I6_I7              = 1156,
+    enum_ops_lt_i_i_ic__I7_I0              = 1157,
+    enum_ops_lt_i_i_ic__I7_I1              = 1158,
+    enum_ops_lt_i_i_ic__I7_I2              = 1159,
+    enum_ops_lt_i_i_ic__I7_I3              = 1160,
+    enum_ops_lt_i_i_ic__I7_I4              = 1161,
+    enum_ops_lt_i_i_ic__I7_I5              = 1162,
+    enum_ops_lt_i_i_ic__I7_I6              = 1163,
+    enum_ops_lt_i_i_ic__I7_I7              = 1164,
+    enum_ops_add_i_i__I0_I0                = 1165,
+    enum_ops_add_i_i__I0_I1                = 1166,
+    enum_ops_add_i_i__I0_I2                = 1167,
+    enum_ops_add_i_i__I0_I3                = 1168,
+    enum_ops_add_i_i__I0_I4                = 1169,
+    enum_ops_add_i_i__I0_I5                = 1170,
+    enum_ops_add_i_i__I0_I6                = 1171,
+    enum_ops_add_i_i__I0_I7                = 1172,
+    enum_ops_add_i_i__I1_I0                = 1173,
+    enum_ops_add_i_i__I1_I1                = 1174,
+    enum_ops_add_i_i__I1_I2                = 1175,
+    enum_ops_add_i_i__I1_I3                = 1176,
+    enum_ops_add_i_i__I1_I4                = 1177,
+    enum_ops_add_i_i__I1_I5                = 1178,
+    enum_ops_add_i_i__I1_I6                = 1179,
+    enum_ops_add_i_i__I1_I7                = 1180,
+    enum_ops_add_i_i__I2_I0                = 1181,
+    enum_ops_add_i_i__I2_I1                = 1182,
+    enum_ops_add_i_i__I2_I2                = 1183,
+    enum_ops_add_i_i__I2_I3                = 1184,
+    enum_ops_add_i_i__I2_I4                = 1185,
+    enum_ops_add_i_i__I2_I5                = 1186,
+    enum_ops_add_i_i__I2_I6                = 1187,
+    enum_ops_add_i_i__I2_I7                = 1188,
+    enum_ops_add_i_i__I3_I0                = 1189,
+    enum_ops_add_i_i__I3_I1                = 1190,
+    enum_ops_add_i_i__I3_I2                = 1191,
+    enum_ops_add_i_i__I3_I3                = 1192,
+    enum_ops_add_i_i__I3_I4                = 1193,
+    enum_ops_add_i_i__I3_I5                = 1194,
+    enum_ops_add_i_i__I3_I6                = 1195,
+    enum_ops_add_i_i__I3_I7                = 1196,
+    enum_ops_add_i_i__I4_I0                = 1197,
+    enum_ops_add_i_i__I4_I1                = 1198,
+    enum_ops_add_i_i__I4_I2                = 1199,
+    enum_ops_add_i_i__I4_I3                = 1200,
+    enum_ops_add_i_i__I4_I4                = 1201,
+    enum_ops_add_i_i__I4_I5                = 1202,
+    enum_ops_add_i_i__I4_I6                = 1203,
+    enum_ops_add_i_i__I4_I7                = 1204,
+    enum_ops_add_i_i__I5_I0                = 1205,
+    enum_ops_add_i_i__I5_I1                = 1206,
+    enum_ops_add_i_i__I5_I2                = 1207,
+    enum_ops_add_i_i__I5_I3                = 1208,
+    enum_ops_add_i_i__I5_I4                = 1209,
+    enum_ops_add_i_i__I5_I5                = 1210,
+    enum_ops_add_i_i__I5_I6                = 1211,
+    enum_ops_add_i_i__I5_I7                = 1212,
+    enum_ops_add_i_i__I6_I0                = 1213,
+    enum_ops_add_i_i__I6_I1                = 1214,
+    enum_ops_add_i_i__I6_I2                = 1215,
+    enum_ops_add_i_i__I6_I3                = 1216,
+    enum_ops_add_i_i__I6_I4                = 1217,
+    enum_ops_add_i_i__I6_I5                = 1218,
+    enum_ops_add_i_i__I6_I6                = 1219,
+    enum_ops_add_i_i__I6_I7                = 1220,
+    enum_ops_add_i_i__I7_I0                = 1221,
+    enum_ops_add_i_i__I7_I1                = 1222,
+    enum_ops_add_i_i__I7_I2                = 1223,
+    enum_ops_add_i_i__I7_I3                = 1224,
+    enum_ops_add_i_i__I7_I4                = 1225,
+    enum_ops_add_i_i__I7_I5                = 1226,
+    enum_ops_add_i_i__I7_I6                = 1227,
+    enum_ops_add_i_i__I7_I7                = 1228,
+    enum_ops_set_i_i__I0_I0                = 1229,
+    enum_ops_set_i_i__I0_I1                = 1230,
+    enum_ops_set_i_i__I0_I2                = 1231,
+    enum_ops_set_i_i__I0_I3                = 1232,
+    enum_ops_set_i_i__I0_I4                = 1233,
+    enum_ops_set_i_i__I0_I5                = 1234,
+    enum_ops_set_i_i__I0_I6                = 1235,
+    enum_ops_set_i_i__I0_I7                = 1236,
+    enum_ops_set_i_i__I1_I0                = 1237,
+    enum_ops_set_i_i__I1_I1                = 1238,
+    enum_ops_set_i_i__I1_I2                = 1239,
+    enum_ops_set_i_i__I1_I3                = 1240,
+    enum_ops_set_i_i__I1_I4                = 1241,
+    enum_ops_set_i_i__I1_I5                = 1242,
+    enum_ops_set_i_i__I1_I6                = 1243,
+    enum_ops_set_i_i__I1_I7                = 1244,
+    enum_ops_set_i_i__I2_I0                = 1245,
+    enum_ops_set_i_i__I2_I1                = 1246,
+    enum_ops_set_i_i__I2_I2                = 1247,
+    enum_ops_set_i_i__I2_I3                = 1248,
+    enum_ops_set_i_i__I2_I4                = 1249,
+    enum_ops_set_i_i__I2_I5                = 1250,
+    enum_ops_set_i_i__I2_I6                = 1251,
+    enum_ops_set_i_i__I2_I7                = 1252,
+    enum_ops_set_i_i__I3_I0                = 1253,
+    enum_ops_set_i_i__I3_I1                = 1254,
+    enum_ops_set_i_i__I3_I2                = 1255,
+    enum_ops_set_i_i__I3_I3                = 1256,
+    enum_ops_set_i_i__I3_I4                = 1257,
+    enum_ops_set_i_i__I3_I5                = 1258,
+    enum_ops_set_i_i__I3_I6                = 1259,
+    enum_ops_set_i_i__I3_I7                = 1260,
+    enum_ops_set_i_i__I4_I0                = 1261,
+    enum_ops_set_i_i__I4_I1                = 1262,
+    enum_ops_set_i_i__I4_I2                = 1263,
+    enum_ops_set_i_i__I4_I3                = 1264,
+    enum_ops_set_i_i__I4_I4                = 1265,
+    enum_ops_set_i_i__I4_I5                = 1266,
+    enum_ops_set_i_i__I4_I6                = 1267,
+    enum_ops_set_i_i__I4_I7                = 1268,
+    enum_ops_set_i_i__I5_I0                = 1269,
+    enum_ops_set_i_i__I5_I1                = 1270,
+    enum_ops_set_i_i__I5_I2                = 1271,
+    enum_ops_set_i_i__I5_I3                = 1272,
+    enum_ops_set_i_i__I5_I4                = 1273,
+    enum_ops_set_i_i__I5_I5                = 1274,
+    enum_ops_set_i_i__I5_I6                = 1275,
+    enum_ops_set_i_i__I5_I7                = 1276,
+    enum_ops_set_i_i__I6_I0                = 1277,
+    enum_ops_set_i_i__I6_I1                = 1278,
+    enum_ops_set_i_i__I6_I2                = 1279,
+    enum_ops_set_i_i__I6_I3                = 1280,
+    enum_ops_set_i_i__I6_I4                = 1281,
+    enum_ops_set_i_i__I6_I5                = 1282,
+    enum_ops_set_i_i__I6_I6                = 1283,
+    enum_ops_set_i_i__I6_I7                = 1284,
+    enum_ops_set_i_i__I7_I0                = 1285,
+    enum_ops_set_i_i__I7_I1                = 1286,
+    enum_ops_set_i_i__I7_I2                = 1287,
+    enum_ops_set_i_i__I7_I3                = 1288,
+    enum_ops_set_i_i__I7_I4                = 1289,
+    enum_ops_set_i_i__I7_I5                = 1290,
+    enum_ops_set_i_i__I7_I6                = 1291,
+    enum_ops_set_i_i__I7_I7                = 1292,
+    enum_ops_add_n_n__N0_N0                = 1293,
+    enum_ops_add_n_n__N0_N1                = 1294,
+    enum_ops_add_n_n__N0_N2                = 1295,
+    enum_ops_add_n_n__N0_N3                = 1296,
+    enum_ops_add_n_n__N0_N4                = 1297,
+    enum_ops_add_n_n__N0_N5                = 1298,
+    enum_ops_add_n_n__N0_N6                = 1299,
+    enum_ops_add_n_n__N0_N7                = 1300,
+    enum_ops_add_n_n__N1_N0                = 1301,
+    enum_ops_add_n_n__N1_N1                = 1302,
+    enum_ops_add_n_n__N1_N2                = 1303,
+    enum_ops_add_n_n__N1_N3                = 1304,
+    enum_ops_add_n_n__N1_N4                = 1305,
+    enum_ops_add_n_n__N1_N5                = 1306,
+    enum_ops_add_n_n__N1_N6                = 1307,
+    enum_ops_add_n_n__N1_N7                = 1308,
+    enum_ops_add_n_n__N2_N0                = 1309,
+    enum_ops_add_n_n__N2_N1                = 1310,
+    enum_ops_add_n_n__N2_N2                = 1311,
+    enum_ops_add_n_n__N2_N3                = 1312,
+    enum_ops_add_n_n__N2_N4                = 1313,
+    enum_ops_add_n_n__N2_N5                = 1314,
+    enum_ops_add_n_n__N2_N6                = 1315,
+    enum_ops_add_n_n__N2_N7                = 1316,
+    enum_ops_add_n_n__N3_N0                = 1317,
+    enum_ops_add_n_n__N3_N1                = 1318,
+    enum_ops_add_n_n__N3_N2                = 1319,
+    enum_ops_add_n_n__N3_N3                = 1320,
+    enum_ops_add_n_n__N3_N4                = 1321,
+    enum_ops_add_n_n__N3_N5                = 1322,
+    enum_ops_add_n_n__N3_N6                = 1323,
+    enum_ops_add_n_n__N3_N7                = 1324,
+    enum_ops_add_n_n__N4_N0                = 1325,
+    enum_ops_add_n_n__N4_N1                = 1326,
+    enum_ops_add_n_n__N4_N2                = 1327,
+    enum_ops_add_n_n__N4_N3                = 1328,
+    enum_ops_add_n_n__N4_N4                = 1329,
+    enum_ops_add_n_n__N4_N5                = 1330,
+    enum_ops_add_n_n__N4_N6                = 1331,
+    enum_ops_add_n_n__N4_N7                = 1332,
+    enum_ops_add_n_n__N5_N0                = 1333,
+    enum_ops_add_n_n__N5_N1                = 1334,
+    enum_ops_add_n_n__N5_N2                = 1335,
+    enum_ops_add_n_n__N5_N3                = 1336,
+    enum_ops_add_n_n__N5_N4                = 1337,
+    enum_ops_add_n_n__N5_N5                = 1338,
+    enum_ops_add_n_n__N5_N6                = 1339,
+    enum_ops_add_n_n__N5_N7                = 1340,
+    enum_ops_add_n_n__N6_N0                = 1341,
+    enum_ops_add_n_n__N6_N1                = 1342,
+    enum_ops_add_n_n__N6_N2                = 1343,
+    enum_ops_add_n_n__N6_N3                = 1344,
+    enum_ops_add_n_n__N6_N4                = 1345,
+    enum_ops_add_n_n__N6_N5                = 1346,
+    enum_ops_add_n_n__N6_N6                = 1347,
+    enum_ops_add_n_n__N6_N7                = 1348,
+    enum_ops_add_n_n__N7_N0                = 1349,
+    enum_ops_add_n_n__N7_N1                = 1350,
+    enum_ops_add_n_n__N7_N2                = 1351,
+    enum_ops_add_n_n__N7_N3                = 1352,
+    enum_ops_add_n_n__N7_N4                = 1353,
+    enum_ops_add_n_n__N7_N5                = 1354,
+    enum_ops_add_n_n__N7_N6                = 1355,
+    enum_ops_add_n_n__N7_N7                = 1356,
 };
 
 
@@ -255,6 +255,18 @@ struct PackFile_ByteCode {
     op_func_t                    *op_func_table;   /* opcode dispatch table */
     op_func_t                    *save_func_table; /* for when we hijack op_func_table */
     op_info_t                   **op_info_table;
+    op_func_t                    *threaded_code;   /* per-pc handlers, threaded core */
+    size_t                        threaded_size;   /* code size threaded_code covers */
+    opcode_t                     *bounds_steps;    /* per-pc op sizes, bounds core */
+    size_t                        bounds_size;     /* code size bounds_steps covers */
+    INTVAL                        verified;        /* passed PackFile_ByteCode_verify */
+    void                        **cg_ops_addr;     /* live label table, cgoto core */
+    void                        **cg_ops_table;    /* labels, then event check labels */
+    size_t                        cg_op_count;     /* ops cg_ops_table covers */
+    struct _method_ic           **method_ics;      /* per-pc inline method caches */
+    size_t                        method_ics_size; /* code size method_ics covers */
+    struct _jit_loop            **jit_loops;       /* per-pc loop headers, jit core */
+    size_t                        jit_loops_size;  /* code size jit_loops covers */
     size_t                        n_libdeps;       /* number of library dependancies */
     STRING                      **libdeps;         /* names of prerequisite libraries */
 };
@@ -1163,6 +1175,31 @@ opcode_t PackFile_pack_size(PARROT_INTERP, ARGMOD(PackFile *self))
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 /* HEADERIZER END: src/packfile/output.c */
 
+/* HEADERIZER BEGIN: src/packfile/verify.c */
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+
+PARROT_EXPORT
+INTVAL PackFile_ByteCode_verify(PARROT_INTERP,
+    ARGMOD(PackFile_ByteCode *self))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*self);
+
+PARROT_EXPORT
+void PackFile_verify(PARROT_INTERP, ARGMOD(PackFile *self))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*self);
+
+#define ASSERT_ARGS_PackFile_ByteCode_verify __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self))
+#define ASSERT_ARGS_PackFile_verify __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self))
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+/* HEADERIZER END: src/packfile/verify.c */
+
 
 /* This is temporary, to make do_sub_pragmas public... */
 /* HEADERIZER BEGIN: src/packfile/execute.c */
@@ -171,6 +171,9 @@ typedef enum PObj_enum {
     PObj_custom_destroy_FLAG    = POBJ_FLAG(22),
     /* For debugging, report when this buffer gets moved around */
     PObj_report_FLAG            = POBJ_FLAG(23),
+    /* The PObj survived a collection of the generational GC, or the
+     * incremental GC traced it already */
+    PObj_GC_old_FLAG            = POBJ_FLAG(24),
 
 /* PMC specific FLAGs */
     /* call object finalizer */
@@ -189,7 +192,10 @@ typedef enum PObj_enum {
     /* True if the PMC is a class */
     PObj_is_class_FLAG          = POBJ_FLAG(29),
     /* True if the PMC is a parrot object */
-    PObj_is_object_FLAG         = POBJ_FLAG(30)
+    PObj_is_object_FLAG         = POBJ_FLAG(30),
+    /* The old PMC is in the remembered set of the generational GC, or the
+     * incremental GC traces it again before sweeping */
+    PObj_GC_remembered_FLAG     = POBJ_FLAG(31)
 
 } PObj_flags;
 #undef POBJ_FLAG
@@ -248,6 +254,14 @@ typedef enum PObj_enum {
 #define PObj_live_SET(o) gc_flag_SET(live, o)
 #define PObj_live_CLEAR(o) gc_flag_CLEAR(live, o)
 
+#define PObj_GC_old_TEST(o) gc_flag_TEST(GC_old, o)
+#define PObj_GC_old_SET(o) gc_flag_SET(GC_old, o)
+#define PObj_GC_old_CLEAR(o) gc_flag_CLEAR(GC_old, o)
+
+#define PObj_GC_remembered_TEST(o) gc_flag_TEST(GC_remembered, o)
+#define PObj_GC_remembered_SET(o) gc_flag_SET(GC_remembered, o)
+#define PObj_GC_remembered_CLEAR(o) gc_flag_CLEAR(GC_remembered, o)
+
 #define PObj_is_string_TEST(o) PObj_flag_TEST(is_string, o)
 #define PObj_is_string_SET(o) PObj_flag_SET(is_string, o)
 #define PObj_is_string_CLEAR(o) PObj_flag_CLEAR(is_string, o)
@@ -321,6 +335,15 @@ typedef enum PObj_enum {
 #define PObj_is_external_CLEARALL(o) (PObj_get_FLAGS(o) &= \
             ~(UINTVAL)(PObj_external_FLAG|PObj_sysmem_FLAG))
 
+/* The generation of a header.  Old headers stay live between collections of
+ * the generational GC, so a header keeping its generation keeps all of these,
+ * and a copy of a header gets none of them. */
+#define PObj_GC_generation_FLAGS \
+        (PObj_GC_old_FLAG | PObj_GC_remembered_FLAG | PObj_live_FLAG)
+
+#define PObj_GC_generation_CLEARALL(o) (PObj_get_FLAGS(o) &= \
+            ~(UINTVAL)PObj_GC_generation_FLAGS)
+
 #define PObj_is_live_or_free_TESTALL(o) (PObj_get_FLAGS(o) & \
         (PObj_live_FLAG | PObj_on_free_list_FLAG))
 
@@ -59,6 +59,21 @@ do {                                                                \
     }                                                               \
 } while (0);
 
+/* Same as POINTER_ARRAY_ITER, over the chunk at _index only */
+#define POINTER_ARRAY_CHUNK_ITER(_array, _index, _code)             \
+do {                                                                \
+    Parrot_Pointer_Array_Chunk  *chunk = (_array)->chunks[_index];  \
+    size_t                       _j;                                \
+                                                                    \
+    for (_j = 0; _j < CELL_PER_CHUNK - chunk->num_free; _j++) {     \
+        void *ptr = chunk->data[_j];                                \
+        if ((UINTVAL)(ptr) & 1)                                     \
+            continue;                                               \
+                                                                    \
+        { _code }                                                   \
+    }                                                               \
+} while (0);
+
 /* HEADERIZER BEGIN: src/pointer_array.c */
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 
@@ -35,7 +35,8 @@ struct runcore_t {
 
 typedef enum Parrot_runcore_flags {
     RUNCORE_REENTRANT_FLAG    = 1 << 0,
-    RUNCORE_FUNC_TABLE_FLAG   = 1 << 1
+    RUNCORE_FUNC_TABLE_FLAG   = 1 << 1,
+    RUNCORE_EVENT_POLL_FLAG   = 1 << 2      /* polls interp->events_pending */
 } Parrot_runcore_flags;
 
 
@@ -49,6 +50,11 @@ typedef enum Parrot_runcore_flags {
 #define PARROT_RUNCORE_FUNC_TABLE_SET(runcore) \
     Runcore_flag_SET(runcore, RUNCORE_FUNC_TABLE_FLAG)
 
+#define PARROT_RUNCORE_EVENT_POLL_TEST(runcore) \
+    Runcore_flag_TEST(runcore, RUNCORE_EVENT_POLL_FLAG)
+#define PARROT_RUNCORE_EVENT_POLL_SET(runcore) \
+    Runcore_flag_SET(runcore, RUNCORE_EVENT_POLL_FLAG)
+
 /* HEADERIZER BEGIN: src/runcore/main.c */
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 
@@ -65,6 +71,10 @@ PARROT_EXPORT
 void enable_event_checking(PARROT_INTERP)
         __attribute__nonnull__(1);
 
+PARROT_EXPORT
+void Parrot_runcore_handle_events(PARROT_INTERP)
+        __attribute__nonnull__(1);
+
 PARROT_EXPORT
 INTVAL Parrot_runcore_register(PARROT_INTERP,
     ARGIN(Parrot_runcore_t *coredata))
@@ -99,6 +109,8 @@ void runops_int(PARROT_INTERP, size_t offset)
     , PARROT_ASSERT_ARG(lib_pmc))
 #define ASSERT_ARGS_enable_event_checking __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_Parrot_runcore_handle_events __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_Parrot_runcore_register __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(coredata))
@@ -128,6 +140,18 @@ oplib_init_f get_core_op_lib_init(SHIM_INTERP,
     ARGIN(Parrot_runcore_t *runcore))
         __attribute__nonnull__(2);
 
+void Parrot_runcore_bounds_init(PARROT_INTERP)
+        __attribute__nonnull__(1);
+
+void Parrot_runcore_cgoto_init(PARROT_INTERP)
+        __attribute__nonnull__(1);
+
+void Parrot_runcore_cgoto_prepare(PARROT_INTERP,
+    ARGMOD(PackFile_ByteCode *cs))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*cs);
+
 void Parrot_runcore_debugger_init(PARROT_INTERP)
         __attribute__nonnull__(1);
 
@@ -143,8 +167,18 @@ void Parrot_runcore_gc_debug_init(PARROT_INTERP)
 void Parrot_runcore_slow_init(PARROT_INTERP)
         __attribute__nonnull__(1);
 
+void Parrot_runcore_threaded_init(PARROT_INTERP)
+        __attribute__nonnull__(1);
+
 #define ASSERT_ARGS_get_core_op_lib_init __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(runcore))
+#define ASSERT_ARGS_Parrot_runcore_bounds_init __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_Parrot_runcore_cgoto_init __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_Parrot_runcore_cgoto_prepare __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(cs))
 #define ASSERT_ARGS_Parrot_runcore_debugger_init __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_Parrot_runcore_exec_init __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
@@ -155,6 +189,8 @@ void Parrot_runcore_slow_init(PARROT_INTERP)
        PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_Parrot_runcore_slow_init __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_Parrot_runcore_threaded_init __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 /* HEADERIZER END: src/runcore/cores.c */
 
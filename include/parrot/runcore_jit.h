@@ -0,0 +1,57 @@
+/* runcore_jit.h
+ *  Copyright (C) 2011, Parrot Foundation.
+ *  Overview:
+ *     Tracing JIT runcore.
+ */
+
+#ifndef PARROT_RUNCORE_JIT_H_GUARD
+#define PARROT_RUNCORE_JIT_H_GUARD
+
+#include "parrot/parrot.h"
+#include "parrot/runcore_api.h"
+
+/* backward branches to a loop header before its loop is traced */
+#define PARROT_JIT_HOT_LOOP  64
+
+/* longest trace recorded, in ops */
+#define PARROT_JIT_MAX_TRACE 256
+
+/* native code of a trace: runs on the registers of a context and returns the
+ * pc to resume interpreting at */
+typedef opcode_t * (*Parrot_jit_trace_fn)(INTVAL *regs_i, FLOATVAL *regs_n);
+
+typedef struct _jit_loop {
+    INTVAL               count;     /* times entered; -1 if it can't be traced */
+    Parrot_jit_trace_fn  code;      /* compiled trace, or NULL */
+    opcode_t            *header;    /* pc the trace was compiled at */
+    size_t               code_size;
+} Parrot_jit_loop;
+
+/* HEADERIZER BEGIN: src/runcore/jit.c */
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+
+void Parrot_jit_destroy_loops(PARROT_INTERP,
+    ARGMOD(PackFile_ByteCode *code))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*code);
+
+void Parrot_runcore_jit_init(PARROT_INTERP)
+        __attribute__nonnull__(1);
+
+#define ASSERT_ARGS_Parrot_jit_destroy_loops __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(code))
+#define ASSERT_ARGS_Parrot_runcore_jit_init __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+/* HEADERIZER END: src/runcore/jit.c */
+
+#endif /* PARROT_RUNCORE_JIT_H_GUARD */
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
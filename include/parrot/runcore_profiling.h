@@ -26,7 +26,8 @@ typedef enum Parrot_profiling_flags {
     PROFILING_FIRST_LOOP_FLAG         = 1 << 1,
     PROFILING_HAVE_PRINTED_CLI_FLAG   = 1 << 2,
     PROFILING_REPORT_ANNOTATIONS_FLAG = 1 << 3,
-    PROFILING_CANONICAL_OUTPUT_FLAG   = 1 << 4
+    PROFILING_CANONICAL_OUTPUT_FLAG   = 1 << 4,
+    PROFILING_REPORT_OP_SEQS_FLAG     = 1 << 5
 } Parrot_profiling_flags;
 
 typedef enum Parrot_profiling_line {
@@ -65,6 +66,13 @@ typedef enum Parrot_profiling_datatype {
     PPROF_DATA_MAX = 3
 } Parrot_profiling_datatype;
 
+/* counts for one pair of ops which ran back to back, falling through from the
+ * first to the second */
+typedef struct profiling_op_seq_t {
+    UHUGEINTVAL  count;
+    Hash        *next;      /* hash of next op -> count of the triple */
+} Parrot_profiling_op_seq_t;
+
 struct profiling_runcore_t {
     STRING                      *name;
     int                          id;
@@ -89,6 +97,11 @@ struct profiling_runcore_t {
     UINTVAL         time_size;  /* how big is the following array */
     UHUGEINTVAL    *time;       /* time spent between DO_OP and start/end of a runcore */
     Hash           *line_cache; /* hash for caching pc -> line mapping */
+    Hash           *op_seqs;    /* hash of op pair -> Parrot_profiling_op_seq_t */
+    STRING         *op_seqs_filename;
+    opcode_t       *seq_next_pc; /* pc the last op falls through to */
+    INTVAL          seq_ops[2];  /* core op numbers of the last two ops */
+    INTVAL          seq_len;     /* number of valid entries in seq_ops */
 };
 
 #define Profiling_flag_SET(runcore, flag) \
@@ -133,6 +146,13 @@ struct profiling_runcore_t {
 #define Profiling_canonical_output_CLEAR(o) \
     Profiling_flag_CLEAR(o, PROFILING_CANONICAL_OUTPUT_FLAG)
 
+#define Profiling_report_op_seqs_TEST(o) \
+    Profiling_flag_TEST(o, PROFILING_REPORT_OP_SEQS_FLAG)
+#define Profiling_report_op_seqs_SET(o) \
+    Profiling_flag_SET(o, PROFILING_REPORT_OP_SEQS_FLAG)
+#define Profiling_report_op_seqs_CLEAR(o) \
+    Profiling_flag_CLEAR(o, PROFILING_REPORT_OP_SEQS_FLAG)
+
 /* HEADERIZER BEGIN: src/runcore/profiling.c */
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 
@@ -68,6 +68,8 @@ typedef enum {
     SUB_COMP_FLAG_BIT_11    = SUB_FLAG(11),
     SUB_COMP_FLAG_NSENTRY   = SUB_COMP_FLAG_BIT_11,
     SUB_COMP_FLAG_BIT_12    = SUB_FLAG(12),
+    /* only required positional params, in a get_params as first op */
+    SUB_COMP_FLAG_FIXED_ARITY = SUB_COMP_FLAG_BIT_12,
     SUB_COMP_FLAG_BIT_13    = SUB_FLAG(13),
     SUB_COMP_FLAG_BIT_14    = SUB_FLAG(14),
     SUB_COMP_FLAG_BIT_15    = SUB_FLAG(15),
@@ -87,6 +89,7 @@ typedef enum {
     SUB_COMP_FLAG_BIT_29    = SUB_FLAG(29),
     SUB_COMP_FLAG_BIT_30    = SUB_FLAG(30),
     SUB_COMP_FLAG_MASK      = SUB_COMP_FLAG_VTABLE | SUB_COMP_FLAG_METHOD | SUB_COMP_FLAG_NSENTRY | SUB_COMP_FLAG_PF_INIT
+                            | SUB_COMP_FLAG_FIXED_ARITY
 } sub_comp_flags_enum;
 #undef SUB_FLAG
 
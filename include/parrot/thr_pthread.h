@@ -53,9 +53,15 @@
 #  define CLEANUP_PUSH(f, a) pthread_cleanup_push((f), (a))
 #  define CLEANUP_POP(a)     pthread_cleanup_pop(a)
 
+#  define THREAD_KEY_CREATE(k) pthread_key_create(&(k), NULL)
+#  define THREAD_KEY_DELETE(k) pthread_key_delete(k)
+#  define THREAD_KEY_SET(k, v) pthread_setspecific((k), (v))
+#  define THREAD_KEY_GET(k)    pthread_getspecific(k)
+
 typedef pthread_mutex_t Parrot_mutex;
 typedef pthread_cond_t Parrot_cond;
 typedef pthread_t Parrot_thread;
+typedef pthread_key_t Parrot_thread_key;
 
 typedef void (*Cleanup_Handler)(void *);
 
@@ -22,6 +22,7 @@ typedef struct Windows_cond
     LONG m_lWaiters;
   } Parrot_cond;
 typedef HANDLE Parrot_thread;
+typedef DWORD Parrot_thread_key;
 
 #  define MUTEX_INIT(m) InitializeCriticalSection((PCRITICAL_SECTION)&(m))
 #  define MUTEX_DESTROY(m) DeleteCriticalSection((PCRITICAL_SECTION)&(m))
@@ -115,6 +116,11 @@ typedef HANDLE Parrot_thread;
 #  define CLEANUP_PUSH(f, a)
 #  define CLEANUP_POP(a)
 
+#  define THREAD_KEY_CREATE(k) ((k) = TlsAlloc())
+#  define THREAD_KEY_DELETE(k) TlsFree(k)
+#  define THREAD_KEY_SET(k, v) TlsSetValue((k), (v))
+#  define THREAD_KEY_GET(k)    TlsGetValue(k)
+
 typedef void (*Cleanup_Handler)(void *);
 
 #ifndef PARROT_HAS_TIMESPEC
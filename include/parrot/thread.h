@@ -38,9 +38,15 @@
 #  define CLEANUP_PUSH(f, a)
 #  define CLEANUP_POP(a)
 
+#  define THREAD_KEY_CREATE(k)
+#  define THREAD_KEY_DELETE(k)
+#  define THREAD_KEY_SET(k, v)
+#  define THREAD_KEY_GET(k) NULL
+
 #  define Parrot_mutex int
 #  define Parrot_cond int
 #  define Parrot_thread int
+#  define Parrot_thread_key int
 
 typedef void (*Cleanup_Handler)(void *);
 
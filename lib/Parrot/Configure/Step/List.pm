@@ -35,6 +35,7 @@ my @steps = qw(
     auto::va_ptr
     auto::format
     auto::isreg
+    auto::cgoto
     auto::jit
     auto::frames
     auto::llvm
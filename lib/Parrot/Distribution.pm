@@ -404,10 +404,12 @@ This is to exclude automatically generated C-language files Parrot might have.
             include/parrot/config.h
             include/parrot/has_header.h
             include/parrot/oplib/core_ops.h
+            include/parrot/oplib/core_ops_cg.h
             include/parrot/oplib/ops.h
             include/parrot/opsenum.h
             src/gc/malloc.c
             src/ops/core_ops.c
+            src/ops/core_ops_cg.c
             t/tools/dev/headerizer/testlib/fixedbooleanarray_pmc.in
             t/tools/dev/headerizer/testlib/function_decls.in
             t/tools/dev/headerizer/testlib/hvalidheader.in
@@ -86,10 +86,12 @@ sub remap_runcore_opts
     my ($opts_ref) = @_;
 
     my %remap      = (
-        'j' => '-runcore=fast',
+        'j' => '-runcore=jit',
         'G' => '-runcore=gcdebug',
         'b' => '-runcore=bounds',
         'f' => '-runcore=fast',
+        'T' => '-runcore=threaded',
+        'g' => '-runcore=cgoto',
         'r' => '-run-pbc',
     );
 
@@ -112,7 +114,9 @@ perl t/harness [options] [testfiles]
     -b         ... run bounds checked
     --run-exec ... run exec core
     -f         ... run fast core
-    -j         ... run fast core
+    -T         ... run threaded core
+    -g         ... run computed goto core
+    -j         ... run tracing JIT core (fast core without JIT support)
     -r         ... run the compiled pbc
     -v         ... run parrot with -v : This is NOT the same as prove -v
                    All tests run with this option will probably fail
@@ -243,13 +243,27 @@ EOA
 EOA
     }
 
-    $decl .= <<"EOA";
+    # Tell a generational GC about the stored PMC or STRING
+    if ($attrtype =~ $isptrtostring || $attrtype =~ $isptrtopmc) {
+        $decl .= <<"EOA";
+        } \\
+        else { \\
+            ((Parrot_${pmcname}_attributes *)PMC_data(pmc))->$attrname = (value); \\
+            PARROT_GC_WRITE_BARRIER(interp, pmc); \\
+        } \\
+    } while (0)
+
+EOA
+    }
+    else {
+        $decl .= <<"EOA";
         } \\
         else \\
             ((Parrot_${pmcname}_attributes *)PMC_data(pmc))->$attrname = (value); \\
     } while (0)
 
 EOA
+    }
 
     $self->{inherit} = $inherit;
 
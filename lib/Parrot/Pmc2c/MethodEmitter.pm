@@ -46,9 +46,16 @@ sub generate_body {
         $self->rewrite_nci_method($pmc);
     }
 
+    my $write_barrier = $self->needs_write_barrier($pmc);
+    if ($write_barrier) {
+        $body->subst( qr{(?<!_self\); )\breturn\s*;},
+            sub { '{ PARROT_GC_WRITE_BARRIER(interp, _self); return; }' } );
+    }
+
     $emit->( $self->decl( $pmc, 'CFILE' ) );
     $emit->("{\n");
     $emit->($body);
+    $emit->("    PARROT_GC_WRITE_BARRIER(interp, _self);\n") if $write_barrier;
     $emit->("}\n");
 
     if ( $self->mmds ) {
@@ -114,6 +121,25 @@ static $decs $ret${newl}Parrot_${pmcname}_$meth(PARROT_INTERP, $pmcarg$args)$sem
 EOC
 }
 
+=item C<needs_write_barrier($pmc)>
+
+Returns true if the vtable method stores into C<SELF>, so that it has to call
+the GC write barrier before it returns.  METHODs get theirs from
+C<Parrot::Pmc2c::PCCMETHOD>.
+
+=cut
+
+sub needs_write_barrier {
+    my ( $self, $pmc ) = @_;
+
+    return 0 unless $self->is_vtable;
+    return 0 if $self->{PCCMETHOD} || $self->pmc_unused;
+    return 0 if $pmc->flag('no_wb');
+    return 0 unless $self->return_type =~ /^void\s*$/;
+
+    return $pmc->vtable_method_does_write( $self->name );
+}
+
 =item C<rewrite_nci_method($self, $pmc )>
 
 Rewrites the method body performing the various macro substitutions for
@@ -224,6 +224,8 @@ sub rewrite_RETURNs {
     croak "return not allowed in pccmethods, use RETURN instead $body"
         if $body and $body =~ m/\breturn\b.*?;\z/s;
 
+    my $return = return_statement($pmc);
+
     while ($body) {
         my $matched;
 
@@ -240,7 +242,7 @@ sub rewrite_RETURNs {
         if ($returns eq 'void') {
             $e->emit( <<"END", __FILE__, __LINE__ + 1 );
     /*BEGIN RETURN $returns */
-    return;
+    $return
     /*END RETURN $returns */
 END
             $matched->replace( $match, $e );
@@ -259,7 +261,7 @@ END
         $e->emit( <<"END", __FILE__, __LINE__ + 1 );
     _ret_object = Parrot_pcc_build_call_from_c_args(interp, _call_object,
         "$returns_signature", $returns_varargs);
-    return;
+    $return
     /*END RETURN $returns */
     }
 END
@@ -267,7 +269,7 @@ END
         else { # if ($returns_signature)
             $e->emit( <<"END", __FILE__, __LINE__ + 1 );
     /*BEGIN RETURN $returns */
-    return;
+    $return
     /*END RETURN $returns */
 END
         }
@@ -277,6 +279,21 @@ END
 
 }
 
+=head3 C<return_statement($pmc)>
+
+Returns the statement returning from a method.  It calls the GC write barrier
+for the invocant first, which the method may have stored a PMC or STRING into,
+unless C<$pmc> has no write barriers.
+
+=cut
+
+sub return_statement {
+    my ($pmc) = @_;
+
+    return 'return;' if $pmc->flag('no_wb');
+    return '{ PARROT_GC_WRITE_BARRIER(interp, _self); return; }';
+}
+
 sub parse_p_args_string {
     my ($parameters) = @_;
     my $linear_args  = [];
@@ -430,11 +447,12 @@ END
     { /* BEGIN PMETHOD BODY */
 END
 
-    $e_post->emit( <<'END', __FILE__, __LINE__ + 1 );
+    my $return = return_statement($pmc);
+    $e_post->emit( <<"END", __FILE__, __LINE__ + 1 );
 
     } /* END PMETHOD BODY */
     } /* END PARAMS SCOPE */
-    return;
+    $return
 END
     $self->return_type('void');
     $self->parameters('');
@@ -372,6 +372,8 @@ sub vtable_flags {
     $vtbl_flag .= '|VTABLE_IS_SHARED_FLAG'    if $self->flag('is_shared');
     $vtbl_flag .= '|VTABLE_IS_READONLY_FLAG'  if $self->flag('is_ro');
     $vtbl_flag .= '|VTABLE_HAS_READONLY_FLAG' if $self->flag('has_ro');
+    $vtbl_flag .= '|VTABLE_NO_WB_FLAG'        if $self->flag('no_wb');
+    $vtbl_flag .= '|VTABLE_PARALLEL_MARK_FLAG' if $self->flag('parallel_mark');
 
     return $vtbl_flag;
 }
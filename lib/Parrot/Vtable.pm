@@ -161,7 +161,9 @@ typedef enum {
     VTABLE_IS_SHARED_FLAG    = 0x020,
     VTABLE_IS_CONST_PMC_FLAG = 0x040,
     VTABLE_HAS_READONLY_FLAG = 0x080,
-    VTABLE_IS_READONLY_FLAG  = 0x100
+    VTABLE_IS_READONLY_FLAG  = 0x100,
+    VTABLE_NO_WB_FLAG        = 0x200, /* stores have no GC write barrier */
+    VTABLE_PARALLEL_MARK_FLAG = 0x400 /* mark is safe on several threads */
 } vtable_flags_t;
 
 typedef struct _vtable {
@@ -20,9 +20,11 @@ passing to and from subroutines following the Parrot Calling Conventions.
 
 #include "parrot/parrot.h"
 #include "parrot/oplib/ops.h"
+#include "parrot/oplib/core_ops.h"
 #include "args.str"
 #include "pmc/pmc_key.h"
 #include "pmc/pmc_fixedintegerarray.h"
+#include "pmc/pmc_sub.h"
 
 /* HEADERIZER HFILE: include/parrot/call.h */
 
@@ -79,6 +81,7 @@ static void dissect_aggregate_arg(PARROT_INTERP,
         FUNC_MODIFIES(*call_object);
 
 static void extract_named_arg_from_op(PARROT_INTERP,
+    ARGIN(PMC *ctx),
     ARGMOD(PMC *call_object),
     ARGIN(STRING *name),
     ARGIN(PMC *raw_sig),
@@ -89,6 +92,7 @@ static void extract_named_arg_from_op(PARROT_INTERP,
         __attribute__nonnull__(3)
         __attribute__nonnull__(4)
         __attribute__nonnull__(5)
+        __attribute__nonnull__(6)
         FUNC_MODIFIES(*call_object);
 
 static void fill_params(PARROT_INTERP,
@@ -201,6 +205,26 @@ static PMC** pmc_param_from_op(PARROT_INTERP,
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
+static void push_args_from_op(PARROT_INTERP,
+    ARGIN(PMC *ctx),
+    ARGMOD(PMC *call_object),
+    ARGIN(PMC *raw_sig),
+    ARGIN(opcode_t *raw_args))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4)
+        __attribute__nonnull__(5)
+        FUNC_MODIFIES(*call_object);
+
+static void store_deferred_args(PARROT_INTERP,
+    ARGIN(PMC *ctx),
+    ARGMOD(PMC *call_object))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*call_object);
+
 PARROT_WARN_UNUSED_RESULT
 PARROT_CAN_RETURN_NULL
 static STRING* string_constant_from_op(PARROT_INTERP,
@@ -243,6 +267,7 @@ static STRING** string_param_from_op(PARROT_INTERP,
     , PARROT_ASSERT_ARG(aggregate))
 #define ASSERT_ARGS_extract_named_arg_from_op __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(ctx) \
     , PARROT_ASSERT_ARG(call_object) \
     , PARROT_ASSERT_ARG(name) \
     , PARROT_ASSERT_ARG(raw_sig) \
@@ -284,6 +309,16 @@ static STRING** string_param_from_op(PARROT_INTERP,
 #define ASSERT_ARGS_pmc_param_from_op __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(raw_params))
+#define ASSERT_ARGS_push_args_from_op __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(ctx) \
+    , PARROT_ASSERT_ARG(call_object) \
+    , PARROT_ASSERT_ARG(raw_sig) \
+    , PARROT_ASSERT_ARG(raw_args))
+#define ASSERT_ARGS_store_deferred_args __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(ctx) \
+    , PARROT_ASSERT_ARG(call_object))
 #define ASSERT_ARGS_string_constant_from_op __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(raw_params))
@@ -316,12 +351,7 @@ Parrot_pcc_build_sig_object_from_op(PARROT_INTERP, ARGIN_NULLOK(PMC *signature),
         ARGIN(PMC *raw_sig), ARGIN(opcode_t *raw_args))
 {
     ASSERT_ARGS(Parrot_pcc_build_sig_object_from_op)
-    PMC            * const ctx = CURRENT_CONTEXT(interp);
-    PMC            *call_object;
-    INTVAL         *int_array;
-    INTVAL          arg_count;
-    INTVAL          arg_index = 0;
-    INTVAL          arg_named_count = 0;
+    PMC *call_object;
 
     if (PMC_IS_NULL(signature))
         call_object = Parrot_pmc_new(interp, enum_class_CallContext);
@@ -332,6 +362,237 @@ Parrot_pcc_build_sig_object_from_op(PARROT_INTERP, ARGIN_NULLOK(PMC *signature),
 
     /* this macro is much, much faster than the VTABLE STRING comparisons */
     SETATTR_CallContext_arg_flags(interp, call_object, raw_sig);
+    push_args_from_op(interp, CURRENT_CONTEXT(interp), call_object, raw_sig,
+            raw_args);
+
+    return call_object;
+}
+
+/*
+
+=item C<PMC* Parrot_pcc_build_call_from_op(PARROT_INTERP, PMC *raw_sig, opcode_t
+*raw_args)>
+
+Builds the CallContext PMC of a call from a set_args opcode.  When all the
+arguments are positional, leaves them in the registers and remembers the op.
+A Sub taking as many positional parameters then copies them straight into its
+registers.  For any other callee, C<Parrot_pcc_prepare_args> stores them in
+the CallContext first.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+PMC*
+Parrot_pcc_build_call_from_op(PARROT_INTERP, ARGIN(PMC *raw_sig),
+        ARGIN(opcode_t *raw_args))
+{
+    ASSERT_ARGS(Parrot_pcc_build_call_from_op)
+    PMC    *call_object;
+    INTVAL *int_array;
+    INTVAL  arg_count;
+    INTVAL  arg_index;
+
+    GETATTR_FixedIntegerArray_size(interp, raw_sig, arg_count);
+    GETATTR_FixedIntegerArray_int_array(interp, raw_sig, int_array);
+
+    for (arg_index = 0; arg_index < arg_count; ++arg_index)
+        if (int_array[arg_index]
+        &   (PARROT_ARG_FLATTEN | PARROT_ARG_NAME | PARROT_ARG_INVOCANT))
+            return Parrot_pcc_build_sig_object_from_op(interp, PMCNULL,
+                    raw_sig, raw_args);
+
+    call_object = Parrot_pmc_new(interp, enum_class_CallContext);
+    SETATTR_CallContext_arg_flags(interp, call_object, raw_sig);
+    SETATTR_CallContext_raw_args(interp, call_object, raw_args);
+
+    return call_object;
+}
+
+/*
+
+=item C<void Parrot_pcc_prepare_args(PARROT_INTERP, PMC *ctx, PMC *sub)>
+
+Stores the arguments the last set_args op of C<ctx> left in its registers in
+its CallContext, unless C<sub> is a plain Sub, which takes them from the
+registers itself.  Ops call this before invoking C<sub>.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+void
+Parrot_pcc_prepare_args(PARROT_INTERP, ARGIN(PMC *ctx), ARGIN(PMC *sub))
+{
+    ASSERT_ARGS(Parrot_pcc_prepare_args)
+    PMC * const call_object = Parrot_pcc_get_signature(interp, ctx);
+
+    if (sub->vtable->base_type != enum_class_Sub && !PMC_IS_NULL(call_object))
+        store_deferred_args(interp, ctx, call_object);
+}
+
+/*
+
+=item C<opcode_t* Parrot_pcc_pass_args_to_sub(PARROT_INTERP, PMC *caller_ctx,
+PMC *ctx, PMC *sub_pmc, opcode_t *pc)>
+
+Passes the arguments the last set_args op of C<caller_ctx> left in its
+registers to the sub C<sub_pmc>, about to run in C<ctx> from C<pc>.  When IMCC
+marked the sub as taking only required positional parameters and the arguments
+match them in number and type, copies them from register to register, and
+returns the pc past the get_params op of the sub.  Otherwise stores them in
+C<ctx> for get_params to fill in the parameters, and returns C<pc>.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+opcode_t*
+Parrot_pcc_pass_args_to_sub(PARROT_INTERP, ARGIN(PMC *caller_ctx),
+        ARGIN(PMC *ctx), ARGIN(PMC *sub_pmc), ARGIN(opcode_t *pc))
+{
+    ASSERT_ARGS(Parrot_pcc_pass_args_to_sub)
+    Parrot_Sub_attributes *sub;
+    opcode_t              *raw_args;
+    PMC                   *raw_sig, *param_sig, *ccont;
+    INTVAL                *arg_flags, *param_flags;
+    INTVAL                 arg_count, param_count, i;
+
+    GETATTR_CallContext_raw_args(interp, ctx, raw_args);
+    if (!raw_args)
+        return pc;
+
+    PMC_get_sub(interp, sub_pmc, sub);
+
+    if (!(sub->comp_flags & SUB_COMP_FLAG_FIXED_ARITY)
+    ||  !OPCODE_IS(interp, sub->seg, *pc, PARROT_GET_CORE_OPLIB(interp),
+                PARROT_OP_get_params_pc)) {
+        store_deferred_args(interp, caller_ctx, ctx);
+        return pc;
+    }
+
+    GETATTR_CallContext_arg_flags(interp, ctx, raw_sig);
+    GETATTR_FixedIntegerArray_size(interp, raw_sig, arg_count);
+    GETATTR_FixedIntegerArray_int_array(interp, raw_sig, arg_flags);
+
+    param_sig = sub->seg->const_table->pmc.constants[pc[1]];
+    GETATTR_FixedIntegerArray_size(interp, param_sig, param_count);
+    GETATTR_FixedIntegerArray_int_array(interp, param_sig, param_flags);
+
+    /* Anything get_params would convert or complain about takes the long way */
+    if (arg_count != param_count) {
+        store_deferred_args(interp, caller_ctx, ctx);
+        return pc;
+    }
+
+    for (i = 0; i < arg_count; ++i)
+        if (PARROT_ARG_TYPE(arg_flags[i]) != PARROT_ARG_TYPE(param_flags[i])) {
+            store_deferred_args(interp, caller_ctx, ctx);
+            return pc;
+        }
+
+    SETATTR_CallContext_raw_args(interp, ctx, NULL);
+
+    for (i = 0; i < arg_count; ++i) {
+        const INTVAL constant  = PARROT_ARG_CONSTANT_ISSET(arg_flags[i]);
+        const INTVAL raw_index = raw_args[i + 2];
+        const INTVAL reg       = pc[i + 2];
+
+        switch (PARROT_ARG_TYPE(arg_flags[i])) {
+          case PARROT_ARG_INTVAL:
+            CTX_REG_INT(ctx, reg) = constant
+                ? raw_index
+                : CTX_REG_INT(caller_ctx, raw_index);
+            break;
+          case PARROT_ARG_FLOATVAL:
+            CTX_REG_NUM(ctx, reg) = constant
+                ? Parrot_pcc_get_num_constant(interp, caller_ctx, raw_index)
+                : CTX_REG_NUM(caller_ctx, raw_index);
+            break;
+          case PARROT_ARG_STRING:
+            CTX_REG_STR(ctx, reg) = constant
+                ? Parrot_pcc_get_string_constant(interp, caller_ctx, raw_index)
+                : CTX_REG_STR(caller_ctx, raw_index);
+            break;
+          case PARROT_ARG_PMC:
+          default:
+            CTX_REG_PMC(ctx, reg) = clone_key_arg(interp, constant
+                ? Parrot_pcc_get_pmc_constant(interp, caller_ctx, raw_index)
+                : CTX_REG_PMC(caller_ctx, raw_index));
+            break;
+        }
+    }
+
+    /* What get_params does after filling the parameters */
+    ccont = Parrot_pcc_peek_continuation(interp, ctx);
+    if (ccont && PObj_get_FLAGS(ccont) & SUB_FLAG_TAILCALL) {
+        PObj_get_FLAGS(ccont) &= ~SUB_FLAG_TAILCALL;
+        Parrot_pcc_dec_recursion_depth(interp, ctx);
+        Parrot_pcc_set_caller_ctx(interp, ctx,
+                Parrot_pcc_get_caller_ctx(interp, caller_ctx));
+    }
+
+    return pc + param_count + 2;
+}
+
+/*
+
+=item C<static void store_deferred_args(PARROT_INTERP, PMC *ctx, PMC
+*call_object)>
+
+Pushes the arguments a set_args op of C<ctx> left in its registers onto
+C<call_object>, if it has any left.
+
+=cut
+
+*/
+
+static void
+store_deferred_args(PARROT_INTERP, ARGIN(PMC *ctx), ARGMOD(PMC *call_object))
+{
+    ASSERT_ARGS(store_deferred_args)
+    opcode_t *raw_args;
+
+    GETATTR_CallContext_raw_args(interp, call_object, raw_args);
+
+    if (raw_args) {
+        PMC *raw_sig;
+
+        GETATTR_CallContext_arg_flags(interp, call_object, raw_sig);
+        SETATTR_CallContext_raw_args(interp, call_object, NULL);
+        push_args_from_op(interp, ctx, call_object, raw_sig, raw_args);
+    }
+}
+
+/*
+
+=item C<static void push_args_from_op(PARROT_INTERP, PMC *ctx, PMC *call_object,
+PMC *raw_sig, opcode_t *raw_args)>
+
+Pushes the arguments of a set_args opcode, taken from the registers and
+constants of C<ctx>, onto C<call_object>.
+
+=cut
+
+*/
+
+static void
+push_args_from_op(PARROT_INTERP, ARGIN(PMC *ctx), ARGMOD(PMC *call_object),
+        ARGIN(PMC *raw_sig), ARGIN(opcode_t *raw_args))
+{
+    ASSERT_ARGS(push_args_from_op)
+    INTVAL         *int_array;
+    INTVAL          arg_count;
+    INTVAL          arg_index = 0;
+    INTVAL          arg_named_count = 0;
+
     GETATTR_FixedIntegerArray_size(interp, raw_sig, arg_count);
     GETATTR_FixedIntegerArray_int_array(interp, raw_sig, int_array);
 
@@ -380,8 +641,8 @@ Parrot_pcc_build_sig_object_from_op(PARROT_INTERP, ARGIN_NULLOK(PMC *signature),
                                 "duplicate named argument in call");
 
                     }
-                    extract_named_arg_from_op(interp, call_object, string_value,
-                            raw_sig, raw_args, arg_index);
+                    extract_named_arg_from_op(interp, ctx, call_object,
+                            string_value, raw_sig, raw_args, arg_index);
                 }
                 else
                     VTABLE_push_string(interp, call_object, string_value);
@@ -414,28 +675,26 @@ Parrot_pcc_build_sig_object_from_op(PARROT_INTERP, ARGIN_NULLOK(PMC *signature),
         }
 
     }
-
-    return call_object;
 }
 
 /*
 
-=item C<static void extract_named_arg_from_op(PARROT_INTERP, PMC *call_object,
-STRING *name, PMC *raw_sig, opcode_t *raw_args, INTVAL arg_index)>
+=item C<static void extract_named_arg_from_op(PARROT_INTERP, PMC *ctx, PMC
+*call_object, STRING *name, PMC *raw_sig, opcode_t *raw_args, INTVAL arg_index)>
 
-Pulls in the next argument from a set_args opcode, and sets it as the
-value of a named argument in the CallContext PMC.
+Pulls in the next argument from a set_args opcode of C<ctx>, and sets it as
+the value of a named argument in the CallContext PMC.
 
 =cut
 
 */
 
 static void
-extract_named_arg_from_op(PARROT_INTERP, ARGMOD(PMC *call_object), ARGIN(STRING *name),
+extract_named_arg_from_op(PARROT_INTERP, ARGIN(PMC *ctx),
+        ARGMOD(PMC *call_object), ARGIN(STRING *name),
         ARGIN(PMC *raw_sig), ARGIN(opcode_t *raw_args), INTVAL arg_index)
 {
     ASSERT_ARGS(extract_named_arg_from_op)
-    PMC   * const ctx = CURRENT_CONTEXT(interp);
     const INTVAL arg_flags = VTABLE_get_integer_keyed_int(interp, raw_sig, arg_index);
     const INTVAL constant  = PARROT_ARG_CONSTANT_ISSET(arg_flags);
     const INTVAL raw_index = raw_args[arg_index + 2];
@@ -785,6 +1044,7 @@ fill_params(PARROT_INTERP, ARGMOD_NULLOK(PMC *call_object),
     else {
         const INTVAL second_flag = raw_params[param_count - 1];
         if (second_flag & PARROT_ARG_CALL_SIG) {
+            PARROT_CONTEXT_CAPTURED(interp);
             *accessor->pmc(interp, arg_info, param_count - 1) = call_object;
             if (param_count == 1)
                 return;
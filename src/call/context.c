@@ -17,6 +17,7 @@ Parrot_Context functions.
 #include "parrot/call.h"
 #include "pmc/pmc_sub.h"
 #include "pmc/pmc_callcontext.h"
+#include "pmc/pmc_continuation.h"
 
 /*
 
@@ -51,6 +52,11 @@ index into the free_list array. Each slot in free_list has a linked list of
 pointers to already allocated contexts available for (re)use.  The slot where
 an available context is stored corresponds to the size of the context.
 
+Contexts get there from C<Parrot_pop_context>, keeping their register storage,
+and are linked through C<caller_ctx>.  A popped context is only recycled when
+nothing captured a context (see C<PARROT_CONTEXT_CAPTURED>) since it was
+pushed; otherwise a closure, continuation or lexpad might still refer to it.
+
 =cut
 
 */
@@ -61,6 +67,8 @@ an available context is stored corresponds to the size of the context.
         / SLOT_CHUNK_SIZE) * SLOT_CHUNK_SIZE)
 #define CALCULATE_SLOT_NUM(size) ((size) / SLOT_CHUNK_SIZE)
 
+#define INITIAL_FREE_SLOTS 8
+
 
 /* HEADERIZER HFILE: include/parrot/call.h */
 
@@ -90,11 +98,24 @@ static void init_context(PARROT_INTERP,
         __attribute__nonnull__(2)
         FUNC_MODIFIES(*pmcctx);
 
+static void layout_registers(PARROT_INTERP,
+    ARGMOD(Parrot_Context *ctx),
+    ARGIN(const UINTVAL *number_regs_used))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*ctx);
+
 static size_t Parrot_pcc_calculate_registers_size(PARROT_INTERP,
     ARGIN(const UINTVAL *number_regs_used))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
+static void recycle_context(PARROT_INTERP, ARGMOD(PMC *pmcctx))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*pmcctx);
+
 #define ASSERT_ARGS_allocate_registers __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(pmcctx) \
@@ -107,10 +128,17 @@ static size_t Parrot_pcc_calculate_registers_size(PARROT_INTERP,
 #define ASSERT_ARGS_init_context __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(pmcctx))
+#define ASSERT_ARGS_layout_registers __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(ctx) \
+    , PARROT_ASSERT_ARG(number_regs_used))
 #define ASSERT_ARGS_Parrot_pcc_calculate_registers_size \
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(number_regs_used))
+#define ASSERT_ARGS_recycle_context __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pmcctx))
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 /* HEADERIZER END: static */
 
@@ -194,9 +222,9 @@ create_initial_context(PARROT_INTERP)
     static UINTVAL   num_regs[] = {32, 32, 32, 32};
     PMC *ignored;
 
-    /* Create some initial free_list slots. */
+    /* contexts pushed from now on can be recycled when popped */
+    interp->ctx_mem.captures = 1;
 
-#define INITIAL_FREE_SLOTS 8
     /* For now create context with 32 regs each. Some src tests (and maybe
      * other extenders) assume the presence of these registers */
     ignored = Parrot_set_new_context(interp, num_regs);
@@ -271,6 +299,7 @@ init_context(PARROT_INTERP, ARGMOD(PMC *pmcctx), ARGIN_NULLOK(PMC *pmcold))
     ctx->lex_pad           = PMCNULL;
     ctx->outer_ctx         = NULL;
     ctx->current_cont      = NULL;
+    ctx->return_seg        = NULL;
     ctx->current_object    = NULL;
     ctx->handlers          = PMCNULL;
     ctx->caller_ctx        = NULL;
@@ -330,6 +359,9 @@ Parrot_push_context(PARROT_INTERP, ARGIN(const UINTVAL *n_regs_used))
     /* doesn't change */
     Parrot_pcc_set_sub(interp, ctx, Parrot_pcc_get_sub(interp, old));
 
+    /* Parrot_pop_context compares this to tell whether ctx escaped */
+    CONTEXT_STRUCT(ctx)->push_mark = interp->ctx_mem.captures;
+
     /* copy more ? */
     return ctx;
 }
@@ -340,7 +372,10 @@ Parrot_push_context(PARROT_INTERP, ARGIN(const UINTVAL *n_regs_used))
 =item C<void Parrot_pop_context(PARROT_INTERP)>
 
 Frees the context created with C<Parrot_push_context> and restores the previous
-context (the caller context).
+context (the caller context).  If no context was captured since the push,
+nothing can refer to the popped context any more, and it goes to the free list
+for reuse by the next C<Parrot_alloc_context>.  Callers must not use the
+popped context afterwards.
 
 =cut
 
@@ -356,6 +391,243 @@ Parrot_pop_context(PARROT_INTERP)
 
     /* restore old, set cached interpreter base pointers */
     CURRENT_CONTEXT(interp) = old;
+
+    if (CONTEXT_STRUCT(ctx)->push_mark == interp->ctx_mem.captures)
+        recycle_context(interp, ctx);
+}
+
+
+/*
+
+=item C<static void recycle_context(PARROT_INTERP, PMC *pmcctx)>
+
+Puts a popped context on the free list for its register size.  Drops all
+references it holds, so that the GC doesn't keep them alive through the free
+list.
+
+=cut
+
+*/
+
+static void
+recycle_context(PARROT_INTERP, ARGMOD(PMC *pmcctx))
+{
+    ASSERT_ARGS(recycle_context)
+    context_mem    * const mem  = &interp->ctx_mem;
+    Parrot_Context * const ctx  = CONTEXT_STRUCT(pmcctx);
+    const size_t           slot = CALCULATE_SLOT_NUM(
+            calculate_registers_size(interp, ctx->n_regs_used));
+
+    if (slot >= mem->n_free_slots) {
+        size_t n_slots = mem->n_free_slots ? mem->n_free_slots : INITIAL_FREE_SLOTS;
+
+        while (n_slots <= slot)
+            n_slots *= 2;
+
+        mem->free_list = mem_gc_realloc_n_typed_zeroed(interp, mem->free_list,
+                n_slots, mem->n_free_slots, PMC *);
+        mem->n_free_slots = n_slots;
+    }
+
+    VTABLE_morph(interp, pmcctx, PMCNULL);
+    clear_regs(interp, ctx);
+
+    ctx->lex_pad           = PMCNULL;
+    ctx->outer_ctx         = NULL;
+    ctx->current_cont      = NULL;
+    ctx->current_object    = NULL;
+    ctx->handlers          = PMCNULL;
+    ctx->current_sig       = PMCNULL;
+    ctx->current_namespace = PMCNULL;
+    ctx->current_pc        = NULL;
+    ctx->push_mark         = 0;
+
+    /* init_context skips contexts which still have a Sub */
+    ctx->current_sub       = PMCNULL;
+
+    ctx->caller_ctx        = mem->free_list[slot];
+    mem->free_list[slot]   = pmcctx;
+}
+
+
+/*
+
+=item C<void Parrot_pcc_mark_context_pool(PARROT_INTERP)>
+
+Marks the contexts waiting on the free lists for reuse.
+
+=cut
+
+*/
+
+void
+Parrot_pcc_mark_context_pool(PARROT_INTERP)
+{
+    ASSERT_ARGS(Parrot_pcc_mark_context_pool)
+    const context_mem * const mem = &interp->ctx_mem;
+    size_t                    slot;
+
+    /* the rest of each list is reachable through caller_ctx */
+    for (slot = 0; slot < mem->n_free_slots; ++slot)
+        if (mem->free_list[slot])
+            Parrot_gc_mark_PMC_alive(interp, mem->free_list[slot]);
+}
+
+
+/*
+
+=item C<void Parrot_pcc_free_context_pool(PARROT_INTERP)>
+
+Frees the free lists of recycled contexts.  The contexts themselves belong to
+the GC.
+
+=cut
+
+*/
+
+void
+Parrot_pcc_free_context_pool(PARROT_INTERP)
+{
+    ASSERT_ARGS(Parrot_pcc_free_context_pool)
+    context_mem * const mem = &interp->ctx_mem;
+
+    mem_gc_free(interp, mem->free_list);
+    mem->free_list    = NULL;
+    mem->n_free_slots = 0;
+}
+
+
+/*
+
+=item C<PMC * Parrot_pcc_new_return_continuation(PARROT_INTERP)>
+
+Creates the continuation a call made from C returns through.  Unlike other
+continuations, creating it doesn't count as capturing the current context: it
+only escapes through the ops handing it out, which count it then.
+
+=cut
+
+*/
+
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC *
+Parrot_pcc_new_return_continuation(PARROT_INTERP)
+{
+    ASSERT_ARGS(Parrot_pcc_new_return_continuation)
+    const UINTVAL captures = interp->ctx_mem.captures;
+    PMC * const   cont     = Parrot_pmc_new(interp, enum_class_Continuation);
+
+    interp->ctx_mem.captures = captures;
+
+    return cont;
+}
+
+
+/*
+
+=item C<void Parrot_pcc_defer_continuation(PARROT_INTERP, PMC *pmcctx, opcode_t
+*next)>
+
+Records that the context returns to its caller at C<next>, in the current code
+segment, without making a Continuation PMC.  Most return continuations are
+only ever invoked by C<returncc>, which C<Parrot_pcc_return_to_caller> does
+without the PMC; C<Parrot_pcc_get_continuation> makes it for everything else.
+
+=cut
+
+*/
+
+void
+Parrot_pcc_defer_continuation(PARROT_INTERP, ARGIN(PMC *pmcctx),
+        ARGIN_NULLOK(opcode_t *next))
+{
+    ASSERT_ARGS(Parrot_pcc_defer_continuation)
+    Parrot_Context * const ctx = CONTEXT_STRUCT(pmcctx);
+
+    PARROT_ASSERT(interp->code);
+
+    ctx->current_cont      = NULL;
+    ctx->return_pc         = next;
+    ctx->return_seg        = interp->code;
+    ctx->return_runloop_id = interp->current_runloop_id;
+}
+
+
+/*
+
+=item C<PMC * Parrot_pcc_make_continuation(PARROT_INTERP, PMC *pmcctx)>
+
+Makes the Continuation PMC of a deferred return continuation, and returns it.
+Returns NULL if the context has no return continuation.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+PARROT_CAN_RETURN_NULL
+PMC *
+Parrot_pcc_make_continuation(PARROT_INTERP, ARGIN(PMC *pmcctx))
+{
+    ASSERT_ARGS(Parrot_pcc_make_continuation)
+    Parrot_Context * const ctx = CONTEXT_STRUCT(pmcctx);
+
+    if (!ctx->current_cont && ctx->return_seg) {
+        PMC * const cont = Parrot_pmc_new(interp, enum_class_Continuation);
+        Parrot_Continuation_attributes * const data = PARROT_CONTINUATION(cont);
+
+        data->to_ctx         = ctx->caller_ctx;
+        data->to_call_object = PMC_IS_NULL(ctx->caller_ctx)
+                             ? PMCNULL
+                             : Parrot_pcc_get_signature(interp, ctx->caller_ctx);
+        data->from_ctx       = pmcctx;
+        data->seg            = ctx->return_seg;
+        data->address        = ctx->return_pc;
+        data->runloop_id     = ctx->return_runloop_id;
+
+        ctx->current_cont    = cont;
+        ctx->return_seg      = NULL;
+    }
+
+    return ctx->current_cont;
+}
+
+
+/*
+
+=item C<opcode_t * Parrot_pcc_return_to_caller(PARROT_INTERP, opcode_t *next)>
+
+Returns from the current context, like invoking its return continuation does,
+and returns the address to continue at.  Deferred return continuations are
+invoked without making them.
+
+=cut
+
+*/
+
+PARROT_CAN_RETURN_NULL
+opcode_t *
+Parrot_pcc_return_to_caller(PARROT_INTERP, ARGIN_NULLOK(opcode_t *next))
+{
+    ASSERT_ARGS(Parrot_pcc_return_to_caller)
+    PMC            * const pmcctx = CURRENT_CONTEXT(interp);
+    Parrot_Context * const ctx    = CONTEXT_STRUCT(pmcctx);
+    PMC            * const to_ctx = ctx->caller_ctx;
+
+    /* leave checks and tracing to the Continuation PMC */
+    if (ctx->current_cont || !ctx->return_seg || PMC_IS_NULL(to_ctx)
+    ||  Interp_trace_TEST(interp, PARROT_TRACE_SUB_CALL_FLAG))
+        return VTABLE_invoke(interp,
+                Parrot_pcc_get_continuation(interp, pmcctx), next);
+
+    CURRENT_CONTEXT(interp) = to_ctx;
+    Parrot_pcc_set_signature(interp, to_ctx, ctx->current_sig);
+
+    if (interp->code != ctx->return_seg)
+        Parrot_switch_to_cs(interp, ctx->return_seg, 1);
+
+    return ctx->return_pc;
 }
 
 /*
@@ -415,20 +687,41 @@ allocate_registers(PARROT_INTERP, ARGIN(PMC *pmcctx), ARGIN(const UINTVAL *numbe
     ASSERT_ARGS(allocate_registers)
     Parrot_CallContext_attributes *ctx = PARROT_CALLCONTEXT(pmcctx);
 
-    const size_t size_i = sizeof (INTVAL)   * number_regs_used[REGNO_INT];
-    const size_t size_n = sizeof (FLOATVAL) * number_regs_used[REGNO_NUM];
-    const size_t size_s = sizeof (STRING *) * number_regs_used[REGNO_STR];
-    const size_t size_p = sizeof (PMC *)    * number_regs_used[REGNO_PMC];
-
-    const size_t size_nip      = size_n + size_i + size_p;
-    const size_t all_regs_size = size_n + size_i + size_p + size_s;
-    const size_t reg_alloc     = ROUND_ALLOC_SIZE(all_regs_size);
+    const size_t reg_alloc = calculate_registers_size(interp, number_regs_used);
 
     /* don't allocate any storage if there are no registers */
     ctx->registers = reg_alloc
         ? (Parrot_Context *)Parrot_gc_allocate_fixed_size_storage(interp, reg_alloc)
         : NULL;
 
+    layout_registers(interp, ctx, number_regs_used);
+}
+
+
+/*
+
+=item C<static void layout_registers(PARROT_INTERP, Parrot_Context *ctx, const
+UINTVAL *number_regs_used)>
+
+Sets up the register base pointers of a context for the given register
+counts, inside its already allocated register storage, and clears the
+registers.
+
+=cut
+
+*/
+
+static void
+layout_registers(PARROT_INTERP, ARGMOD(Parrot_Context *ctx),
+        ARGIN(const UINTVAL *number_regs_used))
+{
+    ASSERT_ARGS(layout_registers)
+    const size_t size_i = sizeof (INTVAL)   * number_regs_used[REGNO_INT];
+    const size_t size_n = sizeof (FLOATVAL) * number_regs_used[REGNO_NUM];
+    const size_t size_p = sizeof (PMC *)    * number_regs_used[REGNO_PMC];
+
+    const size_t size_nip = size_n + size_i + size_p;
+
     ctx->n_regs_used[REGNO_INT] = number_regs_used[REGNO_INT];
     ctx->n_regs_used[REGNO_NUM] = number_regs_used[REGNO_NUM];
     ctx->n_regs_used[REGNO_STR] = number_regs_used[REGNO_STR];
@@ -515,9 +808,26 @@ Parrot_alloc_context(PARROT_INTERP, ARGIN(const UINTVAL *number_regs_used),
     ARGIN_NULLOK(PMC *old))
 {
     ASSERT_ARGS(Parrot_alloc_context)
-    PMC * const pmcctx = Parrot_pmc_new(interp, enum_class_CallContext);
+    context_mem * const mem  = &interp->ctx_mem;
+    const size_t        slot = CALCULATE_SLOT_NUM(
+            calculate_registers_size(interp, number_regs_used));
+    PMC                *pmcctx;
+
+    if (slot < mem->n_free_slots && mem->free_list[slot]) {
+        Parrot_Context * const ctx = CONTEXT_STRUCT(mem->free_list[slot]);
+
+        pmcctx               = mem->free_list[slot];
+        mem->free_list[slot] = ctx->caller_ctx;
+
+        /* same storage size, but maybe split differently */
+        if (memcmp(ctx->n_regs_used, number_regs_used, sizeof (ctx->n_regs_used)))
+            layout_registers(interp, ctx, number_regs_used);
+    }
+    else {
+        pmcctx = Parrot_pmc_new(interp, enum_class_CallContext);
+        allocate_registers(interp, pmcctx, number_regs_used);
+    }
 
-    allocate_registers(interp, pmcctx, number_regs_used);
     init_context(interp, pmcctx, old);
 
     return pmcctx;
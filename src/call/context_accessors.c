@@ -385,22 +385,22 @@ Parrot_pcc_set_handlers_func(SHIM_INTERP, ARGIN(PMC *ctx), ARGIN(PMC *handlers))
 =item C<void Parrot_pcc_set_continuation_func(PARROT_INTERP, PMC *ctx, PMC
 *_continuation)>
 
-Get/set continuation of Context.
+Get/set continuation of Context.  Getting it makes a deferred return
+continuation; see C<Parrot_pcc_defer_continuation>.
 
 =cut
 
 */
 
 PARROT_EXPORT
-PARROT_PURE_FUNCTION
 PARROT_CAN_RETURN_NULL
 PMC*
-Parrot_pcc_get_continuation_func(SHIM_INTERP, ARGIN(PMC *ctx))
+Parrot_pcc_get_continuation_func(PARROT_INTERP, ARGIN(PMC *ctx))
 {
     ASSERT_ARGS(Parrot_pcc_get_continuation_func)
     const Parrot_Context * const c = CONTEXT_STRUCT(ctx);
     PARROT_ASSERT(ctx->vtable->base_type == enum_class_CallContext);
-    return c->current_cont;
+    return c->current_cont ? c->current_cont : Parrot_pcc_make_continuation(interp, ctx);
 }
 
 PARROT_EXPORT
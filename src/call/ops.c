@@ -170,6 +170,7 @@ new_runloop_jump_point(PARROT_INTERP)
 
     jump_point->prev           = interp->current_runloop;
     jump_point->id             = ++runloop_id_counter;
+    jump_point->gc_root_frames = interp->gc_root_frames;
     interp->current_runloop    = jump_point;
     interp->current_runloop_id = jump_point->id;
     ++interp->current_runloop_level;
@@ -290,6 +290,9 @@ Parrot_pcc_do_run_ops(PARROT_INTERP, ARGIN(PMC *sub_obj))
 Follows the same conventions as C<Parrot_pcc_invoke_method_from_c_args>, but
 the signature string and call arguments are passed in a CallSignature PMC.
 
+Roots the PMCs of the call in a GC root frame while the sub runs, so that the
+GC needn't scan the C stack of the caller for them.
+
 =cut
 
 */
@@ -304,7 +307,16 @@ Parrot_pcc_invoke_from_sig_object(PARROT_INTERP, ARGIN(PMC *sub_obj),
     opcode_t    *dest;
     UINTVAL      n_regs_used[] = { 0, 0, 0, 0, 0, 0, 0, 0 };
     PMC         *ctx  = Parrot_push_context(interp, n_regs_used);
-    PMC * const  ret_cont = pmc_new(interp, enum_class_Continuation);
+    PMC * const  ret_cont = Parrot_pcc_new_return_continuation(interp);
+    PMC         *results;
+    PMC         *roots[4];
+    Parrot_GC_Root_Frame root_frame;
+
+    roots[0] = sub_obj;
+    roots[1] = call_object;
+    roots[2] = ctx;
+    roots[3] = ret_cont;
+    PARROT_GC_PUSH_ROOT_FRAME(interp, root_frame, roots);
 
     Parrot_pcc_set_signature(interp, ctx, call_object);
     Parrot_pcc_set_continuation(interp, ctx, ret_cont);
@@ -323,9 +335,12 @@ Parrot_pcc_invoke_from_sig_object(PARROT_INTERP, ARGIN(PMC *sub_obj),
         runops(interp, offset);
         Interp_core_SET(interp, old_core);
     }
+    PARROT_GC_POP_ROOT_FRAME(interp, root_frame);
+
+    /* ctx may be recycled once popped */
+    results = Parrot_pcc_get_signature(interp, ctx);
     Parrot_pop_context(interp);
-    Parrot_pcc_set_signature(interp, CURRENT_CONTEXT(interp),
-            Parrot_pcc_get_signature(interp, ctx));
+    Parrot_pcc_set_signature(interp, CURRENT_CONTEXT(interp), results);
 }
 
 /*
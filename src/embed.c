@@ -348,6 +348,18 @@ Parrot_set_run_core(PARROT_INTERP, Parrot_Run_core_t core)
       case PARROT_FAST_CORE:
         Parrot_runcore_switch(interp, Parrot_str_new_constant(interp, "fast"));
         break;
+      case PARROT_BOUNDS_CORE:
+        Parrot_runcore_switch(interp, Parrot_str_new_constant(interp, "bounds"));
+        break;
+      case PARROT_THREADED_CORE:
+        Parrot_runcore_switch(interp, Parrot_str_new_constant(interp, "threaded"));
+        break;
+      case PARROT_CGOTO_CORE:
+        Parrot_runcore_switch(interp, Parrot_str_new_constant(interp, "cgoto"));
+        break;
+      case PARROT_JIT_CORE:
+        Parrot_runcore_switch(interp, Parrot_str_new_constant(interp, "jit"));
+        break;
       case PARROT_EXEC_CORE:
         Parrot_runcore_switch(interp, Parrot_str_new_constant(interp, "exec"));
         break;
@@ -133,6 +133,12 @@ Parrot_api_make_interpreter(Parrot_PMC parent, Parrot_Int flags,
             Parrot_gc_set_system_type(interp_raw, args->gc_system);
         if (args->gc_threshold)
             interp_raw->gc_threshold = args->gc_threshold;
+        if (args->gc_max_pause)
+            interp_raw->gc_max_pause = args->gc_max_pause;
+        if (args->gc_mark_threads)
+            interp_raw->gc_mark_threads = args->gc_mark_threads;
+        if (args->gc_precise_roots)
+            interp_raw->gc_precise_roots = args->gc_precise_roots;
         if (args->hash_seed)
             interp_raw->hash_seed = args->hash_seed;
     }
@@ -167,11 +173,20 @@ Parrot_api_set_runcore(Parrot_PMC interp_pmc, ARGIN(const char * corename),
         Parrot_runcore_switch(interp, Parrot_str_new_constant(interp, "slow"));
     }
     else {
-        if (!strcmp(corename, "slow") || !strcmp(corename, "bounds"))
+        if (!strcmp(corename, "slow"))
             Parrot_runcore_switch(interp, Parrot_str_new_constant(interp, "slow"));
-        else if (!strcmp(corename, "fast") ||
-            !strcmp(corename, "jit") || !strcmp(corename, "function"))
+        else if (!strcmp(corename, "bounds"))
+            Parrot_runcore_switch(interp, Parrot_str_new_constant(interp, "bounds"));
+        else if (!strcmp(corename, "fast") || !strcmp(corename, "function"))
             Parrot_runcore_switch(interp, Parrot_str_new_constant(interp, "fast"));
+        else if (!strcmp(corename, "jit"))
+            Parrot_runcore_switch(interp, PARROT_JIT_CAPABLE
+                ? Parrot_str_new_constant(interp, "jit")
+                : Parrot_str_new_constant(interp, "fast"));
+        else if (!strcmp(corename, "threaded"))
+            Parrot_runcore_switch(interp, Parrot_str_new_constant(interp, "threaded"));
+        else if (!strcmp(corename, "cgoto"))
+            Parrot_runcore_switch(interp, Parrot_str_new_constant(interp, "cgoto"));
         else if (!strcmp(corename, "exec"))
             Parrot_runcore_switch(interp, Parrot_str_new_constant(interp, "exec"));
         else if (!strcmp(corename, "trace"))
@@ -329,9 +344,13 @@ Parrot_api_load_bytecode_file(Parrot_PMC interp_pmc,
     PackFile * const pf = Parrot_pbc_read(interp, filename, 0);
     if (!pf)
         Parrot_ex_throw_from_c_args(interp, NULL, 1, "Could not load packfile");
+    /* Its constants are only marked once it is the interpreter's packfile */
+    Parrot_pbc_load(interp, pf);
     do_sub_pragmas(interp, pf->cur_cs, PBC_PBC, NULL);
     *pbc = Parrot_pmc_new(interp, enum_class_UnManagedStruct);
     VTABLE_set_pointer(interp, *pbc, pf);
+    /* The caller only holds the PMC on its C stack, which is not traced */
+    Parrot_pmc_gc_register(interp, *pbc);
     EMBED_API_CALLOUT(interp_pmc, interp)
 }
 
@@ -362,9 +381,13 @@ Parrot_api_load_bytecode_bytes(Parrot_PMC interp_pmc,
 
     if (!PackFile_unpack(interp, pf, (const opcode_t *)pbc, bytecode_size))
         Parrot_ex_throw_from_c_args(interp, NULL, 1, "could not unpack packfile");
+    /* Its constants are only marked once it is the interpreter's packfile */
+    Parrot_pbc_load(interp, pf);
     do_sub_pragmas(interp, pf->cur_cs, PBC_PBC, NULL);
     *pbcpmc = Parrot_pmc_new(interp, enum_class_UnManagedStruct);
     VTABLE_set_pointer(interp, *pbcpmc, pf);
+    /* The caller only holds the PMC on its C stack, which is not traced */
+    Parrot_pmc_gc_register(interp, *pbcpmc);
     EMBED_API_CALLOUT(interp_pmc, interp);
 }
 
@@ -515,6 +538,91 @@ Parrot_api_set_warnings(Parrot_PMC interp_pmc, Parrot_Int flags)
 
 /*
 
+=item C<Parrot_Int Parrot_api_set_gc_overhead(Parrot_PMC interp_pmc, Parrot_Int
+percent)>
+
+Sets the percentage of run time the default GC of C<interp_pmc> aims to spend
+collecting. The GC lets more or less memory be allocated between two runs to
+meet it. With 0, the GC runs only once the most memory allowed is allocated.
+This function returns a true value if this call is successful and false value
+otherwise.
+
+=cut
+
+*/
+
+PARROT_API
+Parrot_Int
+Parrot_api_set_gc_overhead(Parrot_PMC interp_pmc, Parrot_Int percent)
+{
+    ASSERT_ARGS(Parrot_api_set_gc_overhead)
+    EMBED_API_CALLIN(interp_pmc, interp)
+    if (percent < 0 || percent > 100)
+        Parrot_ex_throw_from_c_args(interp, NULL, 1,
+            "Invalid GC overhead %d", (int)percent);
+    interp->gc_overhead = percent;
+    EMBED_API_CALLOUT(interp_pmc, interp)
+}
+
+/*
+
+=item C<Parrot_Int Parrot_api_set_gc_max_threshold(Parrot_PMC interp_pmc,
+Parrot_Int kbytes)>
+
+Sets the most memory in kilobytes the default GC of C<interp_pmc> lets be
+allocated between two runs, or with 0 the default, an eighth of the system
+memory. This function returns a true value if this call is successful and
+false value otherwise.
+
+=cut
+
+*/
+
+PARROT_API
+Parrot_Int
+Parrot_api_set_gc_max_threshold(Parrot_PMC interp_pmc, Parrot_Int kbytes)
+{
+    ASSERT_ARGS(Parrot_api_set_gc_max_threshold)
+    EMBED_API_CALLIN(interp_pmc, interp)
+    if (kbytes < 0)
+        Parrot_ex_throw_from_c_args(interp, NULL, 1,
+            "Invalid GC threshold %d", (int)kbytes);
+    interp->gc_max_threshold = kbytes;
+    EMBED_API_CALLOUT(interp_pmc, interp)
+}
+
+/*
+
+=item C<Parrot_Int Parrot_api_set_gc_log(Parrot_PMC interp_pmc, const char
+*filename)>
+
+Makes the GC of C<interp_pmc> log a line per collection to the file
+C<filename>, or to standard error with C<->.  See C<Parrot_gc_record_event>
+for the format.  This function returns a true value if this call is successful
+and false value otherwise.
+
+=cut
+
+*/
+
+PARROT_API
+Parrot_Int
+Parrot_api_set_gc_log(Parrot_PMC interp_pmc, ARGIN(const char *filename))
+{
+    ASSERT_ARGS(Parrot_api_set_gc_log)
+    EMBED_API_CALLIN(interp_pmc, interp)
+    FILE * const log = STREQ(filename, "-") ? stderr : fopen(filename, "w");
+    if (!log)
+        Parrot_ex_throw_from_c_args(interp, NULL, 1,
+            "Cannot open GC log '%s'", filename);
+    if (interp->gc_log && interp->gc_log != stderr)
+        fclose(interp->gc_log);
+    interp->gc_log = log;
+    EMBED_API_CALLOUT(interp_pmc, interp)
+}
+
+/*
+
 =item C<Parrot_Int Parrot_api_set_output_file(Parrot_PMC interp_pmc, const char
 * filename)>
 
@@ -23,6 +23,7 @@
     if (setjmp(env)) {                           \
         Interp * const __interp = GET_INTERP(p); \
         __interp->api_jmp_buf = NULL;            \
+        __interp->gc_root_frames = NULL;         \
         return !__interp->exit_code;             \
     }                                            \
     else {                                       \
@@ -167,13 +167,14 @@ the handler code.
 
 PARROT_EXPORT
 void
-Parrot_ex_add_c_handler(PARROT_INTERP, ARGIN(Parrot_runloop *jp))
+Parrot_ex_add_c_handler(PARROT_INTERP, ARGMOD(Parrot_runloop *jp))
 {
     ASSERT_ARGS(Parrot_ex_add_c_handler)
     PMC * const handler = Parrot_pmc_new(interp, enum_class_ExceptionHandler);
     /* Flag to mark a C exception handler */
     PObj_get_FLAGS(handler) |= SUB_FLAG_C_HANDLER;
     VTABLE_set_pointer(interp, handler, jp);
+    jp->gc_root_frames = interp->gc_root_frames;
     Parrot_cx_add_handler_local(interp, handler);
 }
 
@@ -235,7 +236,8 @@ Parrot_ex_throw_from_op(PARROT_INTERP, ARGIN(PMC *exception), ARGIN_NULLOK(void
     if (PObj_get_FLAGS(handler) & SUB_FLAG_C_HANDLER) {
         /* it's a C exception handler */
         Parrot_runloop * const jump_point = (Parrot_runloop *)address;
-        jump_point->exception = exception;
+        jump_point->exception  = exception;
+        interp->gc_root_frames = jump_point->gc_root_frames;
         longjmp(jump_point->resume, 1);
     }
 
@@ -363,7 +365,8 @@ Parrot_ex_throw_from_c(PARROT_INTERP, ARGIN(PMC *exception))
     if (PObj_get_FLAGS(handler) & SUB_FLAG_C_HANDLER) {
         Parrot_runloop * const jump_point =
             (Parrot_runloop * const)VTABLE_get_pointer(interp, handler);
-        jump_point->exception = exception;
+        jump_point->exception  = exception;
+        interp->gc_root_frames = jump_point->gc_root_frames;
         longjmp(jump_point->resume, 1);
     }
 
@@ -372,6 +375,7 @@ Parrot_ex_throw_from_c(PARROT_INTERP, ARGIN(PMC *exception))
     setup_exception_args(interp, "P", exception);
     PARROT_ASSERT(return_point->handler_start == NULL);
     return_point->handler_start = address;
+    interp->gc_root_frames      = return_point->gc_root_frames;
     longjmp(return_point->resume, 2);
 }
 
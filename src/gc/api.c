@@ -127,6 +127,8 @@ Parrot_gc_set_system_type(PARROT_INTERP, ARGIN(const char *name))
         interp->gc_sys->sys_type = MS2;
     if (STREQ(name, "INF"))
         interp->gc_sys->sys_type = INF;
+    if (STREQ(name, "GMS"))
+        interp->gc_sys->sys_type = GMS;
 }
 
 /*
@@ -231,6 +233,9 @@ Parrot_gc_initialize(PARROT_INTERP, ARGIN(void *stacktop))
       case MS2:
         Parrot_gc_ms2_init(interp);
         break;
+      case GMS:
+        Parrot_gc_gms_init(interp);
+        break;
       default:
         /*die horribly because of invalid GC core specified*/
         break;
@@ -686,7 +691,8 @@ Parrot_gc_mark_and_sweep(PARROT_INTERP, UINTVAL flags)
 
 =item C<void Parrot_gc_compact_memory_pool(PARROT_INTERP)>
 
-Compact string pool if supported by GC.
+Compact string pool, and move PMC attributes out of sparse arenas, if
+supported by GC.
 
 =cut
 
@@ -880,6 +886,71 @@ Parrot_gc_impatient_pmcs(PARROT_INTERP)
 
 /*
 
+=item C<PMC * Parrot_gc_recent_events(PARROT_INTERP)>
+
+Returns an array of the latest collections the GC recorded, oldest first.
+Each is a hash of C<run>, the number of mark runs when it ended, the times in
+microseconds spent in the C<trace>, C<mark>, C<sweep_pmc>, C<sweep_string> and
+C<compact> phases, C<live_pmcs>, C<freed_pmcs>, C<freed_strings> and
+C<freed_bytes>.  Only some collectors record collections.
+
+=cut
+
+*/
+
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC *
+Parrot_gc_recent_events(PARROT_INTERP)
+{
+    ASSERT_ARGS(Parrot_gc_recent_events)
+    const GC_Statistics * const stats  = &interp->gc_sys->stats;
+    PMC                 * const events =
+        Parrot_pmc_new(interp, enum_class_ResizablePMCArray);
+    size_t                      i      = stats->num_events > GC_EVENTS_KEPT
+                                       ? stats->num_events - GC_EVENTS_KEPT
+                                       : 0;
+
+    /* Don't record collections while copying them */
+    Parrot_block_GC_mark(interp);
+
+    for (; i < stats->num_events; ++i) {
+        const GC_Event * const e     = &stats->events[i % GC_EVENTS_KEPT];
+        PMC            * const event = Parrot_pmc_new(interp, enum_class_Hash);
+
+        VTABLE_set_integer_keyed_str(interp, event,
+            Parrot_str_new_constant(interp, "run"), e->run);
+        VTABLE_set_integer_keyed_str(interp, event,
+            Parrot_str_new_constant(interp, "trace"), e->trace_time);
+        VTABLE_set_integer_keyed_str(interp, event,
+            Parrot_str_new_constant(interp, "mark"), e->mark_time);
+        VTABLE_set_integer_keyed_str(interp, event,
+            Parrot_str_new_constant(interp, "sweep_pmc"), e->sweep_pmc_time);
+        VTABLE_set_integer_keyed_str(interp, event,
+            Parrot_str_new_constant(interp, "sweep_string"),
+            e->sweep_string_time);
+        VTABLE_set_integer_keyed_str(interp, event,
+            Parrot_str_new_constant(interp, "compact"), e->compact_time);
+        VTABLE_set_integer_keyed_str(interp, event,
+            Parrot_str_new_constant(interp, "live_pmcs"), e->live_pmcs);
+        VTABLE_set_integer_keyed_str(interp, event,
+            Parrot_str_new_constant(interp, "freed_pmcs"), e->freed_pmcs);
+        VTABLE_set_integer_keyed_str(interp, event,
+            Parrot_str_new_constant(interp, "freed_strings"),
+            e->freed_strings);
+        VTABLE_set_integer_keyed_str(interp, event,
+            Parrot_str_new_constant(interp, "freed_bytes"), e->freed_bytes);
+
+        VTABLE_push_pmc(interp, events, event);
+    }
+
+    Parrot_unblock_GC_mark(interp);
+
+    return events;
+}
+
+/*
+
 =item C<void Parrot_block_GC_mark(PARROT_INTERP)>
 
 Blocks the GC from performing its mark phase.
@@ -1001,6 +1072,28 @@ Parrot_gc_pmc_needs_early_collection(PARROT_INTERP, ARGMOD(PMC *pmc))
 
 /*
 
+=item C<void Parrot_gc_write_barrier(PARROT_INTERP, PMC *pmc)>
+
+Tells a generational GC that a PMC or STRING was stored into the old C<pmc>,
+or an incremental GC that it was stored into a C<pmc> it traced already.  Use
+the C<PARROT_GC_WRITE_BARRIER> macro, which calls this function only for old
+PMCs which aren't in the remembered set yet.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+void
+Parrot_gc_write_barrier(PARROT_INTERP, ARGIN(PMC *pmc))
+{
+    ASSERT_ARGS(Parrot_gc_write_barrier)
+    if (interp->gc_sys->write_barrier)
+        interp->gc_sys->write_barrier(interp, pmc);
+}
+
+/*
+
 =item C<STRING * Parrot_gc_sys_name(PARROT_INTERP)>
 
 Retrieve the name of the currently active GC system.
@@ -1025,6 +1118,9 @@ Parrot_gc_sys_name(PARROT_INTERP)
         case MS2:
             name = Parrot_str_new(interp, "ms2", 3);
             break;
+        case GMS:
+            name = Parrot_str_new(interp, "gms", 3);
+            break;
         default:
             name = Parrot_str_new(interp, "unknown", 7);
             break;
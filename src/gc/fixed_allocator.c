@@ -11,6 +11,11 @@ C<FixedAllocator> used to allocate small chunks of fixed size memory.
 
 C<PoolAllocator> used to allocate memory of particular size.
 
+C<FixedAllocator> keeps a C<PoolAllocator> per size class.  Small sizes get a
+class per pointer size, bigger sizes four classes per power of two.  Every
+pool hands out the most recently freed chunk first, which is still in the
+cache, and bumps a pointer through its newest arena when none is free.
+
 =cut
 
 */
@@ -30,6 +35,18 @@ static void allocate_new_pool_arena(ARGMOD(Pool_Allocator *pool))
 static size_t arena_size(ARGIN(const Pool_Allocator *self))
         __attribute__nonnull__(1);
 
+PARROT_WARN_UNUSED_RESULT
+static int compare_arena_info(ARGIN(const void *a), ARGIN(const void *b))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+PARROT_CAN_RETURN_NULL
+static Pool_Allocator_Arena_Info * find_arena_info(
+    ARGIN(Pool_Allocator *pool),
+    ARGIN(void *ptr))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
 PARROT_CANNOT_RETURN_NULL
 static void * get_free_list_item(ARGMOD(Pool_Allocator *pool))
         __attribute__nonnull__(1)
@@ -45,6 +62,10 @@ static void * pool_allocate(ARGMOD(Pool_Allocator *pool))
         __attribute__nonnull__(1)
         FUNC_MODIFIES(*pool);
 
+static void pool_finish_evacuation(ARGMOD(Pool_Allocator *pool))
+        __attribute__nonnull__(1)
+        FUNC_MODIFIES(*pool);
+
 static void pool_free(ARGMOD(Pool_Allocator *pool), ARGFREE(void *data))
         __attribute__nonnull__(1)
         FUNC_MODIFIES(*pool);
@@ -54,21 +75,51 @@ static int pool_is_owned(ARGMOD(Pool_Allocator *pool), ARGIN(void *ptr))
         __attribute__nonnull__(2)
         FUNC_MODIFIES(*pool);
 
+static void pool_plan_evacuation(ARGMOD(Pool_Allocator *pool))
+        __attribute__nonnull__(1)
+        FUNC_MODIFIES(*pool);
+
+static void pool_start_evacuation(ARGMOD(Pool_Allocator *pool))
+        __attribute__nonnull__(1)
+        FUNC_MODIFIES(*pool);
+
+PARROT_CONST_FUNCTION
+PARROT_WARN_UNUSED_RESULT
+static size_t size_class_index(size_t size);
+
+PARROT_CONST_FUNCTION
+PARROT_WARN_UNUSED_RESULT
+static size_t size_class_size(size_t index);
+
 #define ASSERT_ARGS_allocate_new_pool_arena __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(pool))
 #define ASSERT_ARGS_arena_size __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(self))
+#define ASSERT_ARGS_compare_arena_info __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(a) \
+    , PARROT_ASSERT_ARG(b))
+#define ASSERT_ARGS_find_arena_info __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(pool) \
+    , PARROT_ASSERT_ARG(ptr))
 #define ASSERT_ARGS_get_free_list_item __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(pool))
 #define ASSERT_ARGS_get_newfree_list_item __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(pool))
 #define ASSERT_ARGS_pool_allocate __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(pool))
+#define ASSERT_ARGS_pool_finish_evacuation __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(pool))
 #define ASSERT_ARGS_pool_free __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(pool))
 #define ASSERT_ARGS_pool_is_owned __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(pool) \
     , PARROT_ASSERT_ARG(ptr))
+#define ASSERT_ARGS_pool_plan_evacuation __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(pool))
+#define ASSERT_ARGS_pool_start_evacuation __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(pool))
+#define ASSERT_ARGS_size_class_index __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
+#define ASSERT_ARGS_size_class_size __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 /* HEADERIZER END: static */
 
@@ -136,24 +187,22 @@ Parrot_gc_fixed_allocator_allocate(PARROT_INTERP,
 {
     ASSERT_ARGS(Parrot_gc_fixed_allocator_allocate)
 
-    /* We always align size to 4/8 bytes. */
-    const size_t index = (size - 1) / sizeof (void *);
+    const size_t index = size_class_index(size);
     PARROT_ASSERT(size);
 
     if (index < allocator->num_pools) {
         Pool_Allocator *pool = allocator->pools[index];
 
-        if (!pool) {
-            const size_t alloc_size = (index + 1) * sizeof (void *);
+        if (!pool)
             allocator->pools[index] = pool
-                                    = Parrot_gc_pool_new(interp, alloc_size);
-        }
+                                    = Parrot_gc_pool_new(interp,
+                                        size_class_size(index));
 
         return pool_allocate(pool);
     }
     else {
         const size_t new_size   = index + 1;
-        const size_t alloc_size = new_size * sizeof (void *);
+        const size_t alloc_size = size_class_size(index);
 
         /* (re)allocate pools */
         if (allocator->num_pools)
@@ -181,8 +230,7 @@ Parrot_gc_fixed_allocator_free(PARROT_INTERP,
 {
     ASSERT_ARGS(Parrot_gc_fixed_allocator_free)
 
-    /* We always align size to 4/8 bytes. */
-    size_t index = (size - 1) / sizeof (void*);
+    const size_t index = size_class_index(size);
 
     PARROT_ASSERT(allocator->pools[index]);
 
@@ -191,6 +239,180 @@ Parrot_gc_fixed_allocator_free(PARROT_INTERP,
 
 /*
 
+=item C<void Parrot_gc_fixed_allocator_start_evacuation(PARROT_INTERP,
+Fixed_Allocator *allocator)>
+
+Starts moving objects out of sparse arenas.  Counts the free objects of every
+arena.  Only the owner of all the objects in the allocator can move them, as
+it has to update every pointer to them.
+
+=item C<void Parrot_gc_fixed_allocator_pin(PARROT_INTERP, Fixed_Allocator
+*allocator, void *ptr)>
+
+Keeps the arena C<ptr> points into, if any, from being evacuated.  C<ptr> may
+point anywhere into an object, so the system stack can pin too.
+
+=item C<void Parrot_gc_fixed_allocator_plan_evacuation(PARROT_INTERP,
+Fixed_Allocator *allocator)>
+
+Picks the sparse arenas to evacuate, once all pins are set.  No object gets
+allocated in them anymore.
+
+=item C<void * Parrot_gc_fixed_allocator_evacuate(PARROT_INTERP, Fixed_Allocator
+*allocator, void *data, size_t size)>
+
+Moves the object at C<data> out of its arena if the arena gets evacuated, and
+returns its new address.  Returns C<data> otherwise.
+
+=item C<void Parrot_gc_fixed_allocator_finish_evacuation(PARROT_INTERP,
+Fixed_Allocator *allocator)>
+
+Frees the evacuated arenas.  Every object in them must have been moved.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+void
+Parrot_gc_fixed_allocator_start_evacuation(SHIM_INTERP,
+        ARGIN(Fixed_Allocator *allocator))
+{
+    ASSERT_ARGS(Parrot_gc_fixed_allocator_start_evacuation)
+    size_t i;
+
+    for (i = 0; i < allocator->num_pools; ++i)
+        if (allocator->pools[i])
+            pool_start_evacuation(allocator->pools[i]);
+}
+
+PARROT_EXPORT
+void
+Parrot_gc_fixed_allocator_pin(SHIM_INTERP,
+        ARGIN(Fixed_Allocator *allocator),
+        ARGIN_NULLOK(void *ptr))
+{
+    ASSERT_ARGS(Parrot_gc_fixed_allocator_pin)
+    size_t i;
+
+    for (i = 0; i < allocator->num_pools; ++i) {
+        Pool_Allocator * const pool = allocator->pools[i];
+
+        if (pool && ptr >= pool->lo_arena_ptr && ptr < pool->hi_arena_ptr) {
+            Pool_Allocator_Arena_Info * const info = find_arena_info(pool, ptr);
+
+            if (info) {
+                info->pinned = 1;
+                return;
+            }
+        }
+    }
+}
+
+PARROT_EXPORT
+void
+Parrot_gc_fixed_allocator_plan_evacuation(SHIM_INTERP,
+        ARGIN(Fixed_Allocator *allocator))
+{
+    ASSERT_ARGS(Parrot_gc_fixed_allocator_plan_evacuation)
+    size_t i;
+
+    for (i = 0; i < allocator->num_pools; ++i)
+        if (allocator->pools[i])
+            pool_plan_evacuation(allocator->pools[i]);
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+void *
+Parrot_gc_fixed_allocator_evacuate(SHIM_INTERP,
+        ARGIN(Fixed_Allocator *allocator),
+        ARGIN(void *data), size_t size)
+{
+    ASSERT_ARGS(Parrot_gc_fixed_allocator_evacuate)
+    const size_t                      index = size_class_index(size);
+    Pool_Allocator            * const pool  = allocator->pools[index];
+    Pool_Allocator_Arena_Info * const info  = find_arena_info(pool, data);
+    void                             *moved;
+
+    if (!info || !info->evacuate)
+        return data;
+
+    moved = pool_allocate(pool);
+    memcpy(moved, data, pool->object_size);
+
+    return moved;
+}
+
+PARROT_EXPORT
+void
+Parrot_gc_fixed_allocator_finish_evacuation(SHIM_INTERP,
+        ARGIN(Fixed_Allocator *allocator))
+{
+    ASSERT_ARGS(Parrot_gc_fixed_allocator_finish_evacuation)
+    size_t i;
+
+    for (i = 0; i < allocator->num_pools; ++i)
+        if (allocator->pools[i])
+            pool_finish_evacuation(allocator->pools[i]);
+}
+
+/*
+
+=item C<static size_t size_class_index(size_t size)>
+
+Returns the index of the pool for objects of C<size> bytes.  Sizes up to
+C<GC_FIXED_SIZE_EXACT_WORDS> pointers are aligned to the pointer size; bigger
+ones fall into one of four classes per power of two.
+
+=item C<static size_t size_class_size(size_t index)>
+
+Returns the object size of the pool at C<index>.
+
+=cut
+
+*/
+
+PARROT_CONST_FUNCTION
+PARROT_WARN_UNUSED_RESULT
+static size_t
+size_class_index(size_t size)
+{
+    ASSERT_ARGS(size_class_index)
+    const size_t words = (size - 1) / sizeof (void *);
+    size_t       bits  = 0;
+
+    if (words < GC_FIXED_SIZE_EXACT_WORDS)
+        return words;
+
+    /* words is at least GC_FIXED_SIZE_EXACT_WORDS, a power of two */
+    while (words >> (bits + 1))
+        ++bits;
+
+    return GC_FIXED_SIZE_EXACT_WORDS
+         + (bits - GC_FIXED_SIZE_LOG_EXACT_WORDS) * 4
+         + ((words - ((size_t)1 << bits)) >> (bits - 2));
+}
+
+PARROT_CONST_FUNCTION
+PARROT_WARN_UNUSED_RESULT
+static size_t
+size_class_size(size_t index)
+{
+    ASSERT_ARGS(size_class_size)
+    size_t bits, step;
+
+    if (index < GC_FIXED_SIZE_EXACT_WORDS)
+        return (index + 1) * sizeof (void *);
+
+    bits = GC_FIXED_SIZE_LOG_EXACT_WORDS + (index - GC_FIXED_SIZE_EXACT_WORDS) / 4;
+    step = (index - GC_FIXED_SIZE_EXACT_WORDS) % 4;
+
+    return (((size_t)1 << bits) + ((step + 1) << (bits - 2))) * sizeof (void *);
+}
+
+/*
+
 =back
 
 =head1 PoolAllocator METHODS
@@ -234,7 +456,9 @@ Parrot_gc_pool_new(SHIM_INTERP, size_t object_size)
     const size_t attrib_size = object_size < sizeof (void *) ? sizeof (void*) : object_size;
     const size_t num_objs_raw =
         (GC_FIXED_SIZE_POOL_SIZE - sizeof (Pool_Allocator_Arena)) / attrib_size;
-    const size_t num_objs = (num_objs_raw == 0)?(1):(num_objs_raw);
+    const size_t num_objs = num_objs_raw < GC_FIXED_SIZE_POOL_MIN_OBJECTS
+                          ? GC_FIXED_SIZE_POOL_MIN_OBJECTS
+                          : num_objs_raw;
     Pool_Allocator * const newpool = mem_internal_allocate_typed(Pool_Allocator);
 
     newpool->object_size       = attrib_size;
@@ -247,6 +471,8 @@ Parrot_gc_pool_new(SHIM_INTERP, size_t object_size)
     newpool->hi_arena_ptr      = 0;
     newpool->newfree           = 0;
     newpool->newlast           = 0;
+    newpool->arena_info        = NULL;
+    newpool->num_arenas        = 0;
 
     return newpool;
 }
@@ -440,8 +666,211 @@ allocate_new_pool_arena(ARGMOD(Pool_Allocator *pool))
     if (pool->lo_arena_ptr > (void *)new_arena)
         pool->lo_arena_ptr = new_arena;
 
-    if ((char *)pool->hi_arena_ptr < (char *)new_arena + GC_FIXED_SIZE_POOL_SIZE)
-        pool->hi_arena_ptr = (char *)new_arena + GC_FIXED_SIZE_POOL_SIZE;
+    if ((char *)pool->hi_arena_ptr < (char *)new_arena + arena_size(pool))
+        pool->hi_arena_ptr = (char *)new_arena + arena_size(pool);
+}
+
+/*
+
+=item C<static void pool_start_evacuation(Pool_Allocator *pool)>
+
+Sorts the arenas of the pool by address, and counts their free objects.
+
+=cut
+
+*/
+
+static void
+pool_start_evacuation(ARGMOD(Pool_Allocator *pool))
+{
+    ASSERT_ARGS(pool_start_evacuation)
+    Pool_Allocator_Arena     *arena;
+    Pool_Allocator_Free_List *item;
+    size_t                    i = 0;
+
+    for (arena = pool->top_arena; arena; arena = arena->next)
+        ++i;
+
+    pool->num_arenas = i;
+    pool->arena_info = i
+                     ? mem_internal_allocate_n_zeroed_typed(i,
+                            Pool_Allocator_Arena_Info)
+                     : NULL;
+
+    for (i = 0, arena = pool->top_arena; arena; arena = arena->next)
+        pool->arena_info[i++].arena = arena;
+
+    if (pool->num_arenas > 1)
+        qsort(pool->arena_info, pool->num_arenas,
+            sizeof (Pool_Allocator_Arena_Info), compare_arena_info);
+
+    for (item = pool->free_list; item; item = item->next)
+        ++find_arena_info(pool, item)->num_free;
+
+    if (pool->newfree)
+        find_arena_info(pool, pool->newfree)->num_free +=
+            ((char *)pool->newlast - (char *)pool->newfree) / pool->object_size;
+}
+
+/*
+
+=item C<static void pool_plan_evacuation(Pool_Allocator *pool)>
+
+Picks the unpinned arenas no more than half full to evacuate, and drops their
+free objects.  A single sparse arena is kept when the other arenas have no
+room for its objects, as moving them would only take a new arena.
+
+=cut
+
+*/
+
+static void
+pool_plan_evacuation(ARGMOD(Pool_Allocator *pool))
+{
+    ASSERT_ARGS(pool_plan_evacuation)
+    Pool_Allocator_Free_List **next;
+    size_t                     i;
+    size_t                     candidates = 0;
+    size_t                     moving     = 0;
+    size_t                     room       = 0;
+
+    for (i = 0; i < pool->num_arenas; ++i) {
+        Pool_Allocator_Arena_Info * const info = &pool->arena_info[i];
+        const size_t used = pool->objects_per_alloc - info->num_free;
+
+        if (!info->pinned && used <= pool->objects_per_alloc / 2) {
+            info->evacuate = 1;
+            moving        += used;
+            ++candidates;
+        }
+        else
+            room += info->num_free;
+    }
+
+    if (!candidates)
+        return;
+
+    if (candidates == 1 && moving > room) {
+        for (i = 0; i < pool->num_arenas; ++i)
+            pool->arena_info[i].evacuate = 0;
+        return;
+    }
+
+    /* Allocate only from the arenas kept */
+    next = &pool->free_list;
+    while (*next) {
+        if (find_arena_info(pool, *next)->evacuate) {
+            *next = (*next)->next;
+            --pool->num_free_objects;
+        }
+        else
+            next = &(*next)->next;
+    }
+
+    if (pool->newfree && find_arena_info(pool, pool->newfree)->evacuate) {
+        pool->num_free_objects -=
+            ((char *)pool->newlast - (char *)pool->newfree) / pool->object_size;
+        pool->newfree = NULL;
+        pool->newlast = NULL;
+    }
+}
+
+/*
+
+=item C<static void pool_finish_evacuation(Pool_Allocator *pool)>
+
+Frees the evacuated arenas, and recomputes the arena bounds.
+
+=cut
+
+*/
+
+static void
+pool_finish_evacuation(ARGMOD(Pool_Allocator *pool))
+{
+    ASSERT_ARGS(pool_finish_evacuation)
+    Pool_Allocator_Arena **next = &pool->top_arena;
+    const size_t           size = arena_size(pool);
+
+    pool->lo_arena_ptr = (void *)((size_t)-1);
+    pool->hi_arena_ptr = 0;
+
+    while (*next) {
+        Pool_Allocator_Arena      * const arena = *next;
+        Pool_Allocator_Arena_Info * const info  = find_arena_info(pool, arena);
+
+        if (info && info->evacuate) {
+            *next = arena->next;
+            pool->total_objects -= pool->objects_per_alloc;
+            mem_internal_free(arena);
+            continue;
+        }
+
+        if (pool->lo_arena_ptr > (void *)arena)
+            pool->lo_arena_ptr = arena;
+
+        if ((char *)pool->hi_arena_ptr < (char *)arena + size)
+            pool->hi_arena_ptr = (char *)arena + size;
+
+        next = &arena->next;
+    }
+
+    if (pool->arena_info)
+        mem_internal_free(pool->arena_info);
+
+    pool->arena_info = NULL;
+    pool->num_arenas = 0;
+}
+
+/*
+
+=item C<static Pool_Allocator_Arena_Info * find_arena_info(Pool_Allocator *pool,
+void *ptr)>
+
+Returns what evacuation knows about the arena C<ptr> points into, or NULL if
+the arena is not known.
+
+=item C<static int compare_arena_info(const void *a, const void *b)>
+
+Orders arenas by address for C<qsort>.
+
+=cut
+
+*/
+
+PARROT_CAN_RETURN_NULL
+static Pool_Allocator_Arena_Info *
+find_arena_info(ARGIN(Pool_Allocator *pool), ARGIN(void *ptr))
+{
+    ASSERT_ARGS(find_arena_info)
+    const size_t size = arena_size(pool);
+    size_t       lo   = 0;
+    size_t       hi   = pool->num_arenas;
+
+    while (lo < hi) {
+        const size_t         mid   = (lo + hi) / 2;
+        const char   * const start = (const char *)pool->arena_info[mid].arena;
+
+        if ((const char *)ptr < start)
+            hi = mid;
+        else if ((const char *)ptr >= start + size)
+            lo = mid + 1;
+        else
+            return &pool->arena_info[mid];
+    }
+
+    return NULL;
+}
+
+PARROT_WARN_UNUSED_RESULT
+static int
+compare_arena_info(ARGIN(const void *a), ARGIN(const void *b))
+{
+    ASSERT_ARGS(compare_arena_info)
+    const Pool_Allocator_Arena * const x = ((const Pool_Allocator_Arena_Info *)a)->arena;
+    const Pool_Allocator_Arena * const y = ((const Pool_Allocator_Arena_Info *)b)->arena;
+
+    return x < y ? -1 : x > y;
 }
 
 /*
@@ -18,6 +18,16 @@ src/gc/fixed_allocator.h - implementation of allocator for small-size objects.
 #define GC_ATTRIB_POOLS_HEADROOM 8
 #define GC_FIXED_SIZE_POOL_SIZE 4096
 
+/* Least number of objects carved from an arena, so big objects like register
+   frames get bump allocated too */
+#define GC_FIXED_SIZE_POOL_MIN_OBJECTS 16
+
+/* Sizes up to this many pointers get a pool each. Bigger sizes are rounded up
+   to one of four size classes per power of two, so that register frames of
+   subs with about as many registers share a pool */
+#define GC_FIXED_SIZE_EXACT_WORDS     16
+#define GC_FIXED_SIZE_LOG_EXACT_WORDS 4
+
 /* Use the lazy allocator. Since it amortizes arena allocation costs, turn
    this on at the same time that you increase the size of allocated arenas.
    increase *_HEADERS_PER_ALLOC and GC_FIXED_SIZE_POOL_SIZE to be large
@@ -32,6 +42,14 @@ typedef struct Pool_Allocator_Arena {
     struct Pool_Allocator_Arena * prev;
 } Pool_Allocator_Arena;
 
+/* What evacuation knows about an arena */
+typedef struct Pool_Allocator_Arena_Info {
+    Pool_Allocator_Arena *arena;
+    size_t                num_free;
+    int                   pinned;
+    int                   evacuate;
+} Pool_Allocator_Arena_Info;
+
 typedef struct Pool_Allocator {
     size_t object_size;
     size_t total_objects;
@@ -45,6 +63,10 @@ typedef struct Pool_Allocator {
     /* Pointers of arena bounds. Used in .is_owned check */
     void *lo_arena_ptr;
     void *hi_arena_ptr;
+
+    /* Arenas sorted by address, while evacuating */
+    Pool_Allocator_Arena_Info *arena_info;
+    size_t                     num_arenas;
 } Pool_Allocator;
 
 typedef struct Fixed_Allocator
@@ -71,6 +93,20 @@ void Parrot_gc_fixed_allocator_destroy(PARROT_INTERP,
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+void * Parrot_gc_fixed_allocator_evacuate(SHIM_INTERP,
+    ARGIN(Fixed_Allocator *allocator),
+    ARGIN(void *data),
+    size_t size)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
+PARROT_EXPORT
+void Parrot_gc_fixed_allocator_finish_evacuation(SHIM_INTERP,
+    ARGIN(Fixed_Allocator *allocator))
+        __attribute__nonnull__(2);
+
 PARROT_EXPORT
 void Parrot_gc_fixed_allocator_free(PARROT_INTERP,
     ARGIN(Fixed_Allocator *allocator),
@@ -85,6 +121,22 @@ PARROT_CAN_RETURN_NULL
 struct Fixed_Allocator* Parrot_gc_fixed_allocator_new(PARROT_INTERP)
         __attribute__nonnull__(1);
 
+PARROT_EXPORT
+void Parrot_gc_fixed_allocator_pin(SHIM_INTERP,
+    ARGIN(Fixed_Allocator *allocator),
+    ARGIN_NULLOK(void *ptr))
+        __attribute__nonnull__(2);
+
+PARROT_EXPORT
+void Parrot_gc_fixed_allocator_plan_evacuation(SHIM_INTERP,
+    ARGIN(Fixed_Allocator *allocator))
+        __attribute__nonnull__(2);
+
+PARROT_EXPORT
+void Parrot_gc_fixed_allocator_start_evacuation(SHIM_INTERP,
+    ARGIN(Fixed_Allocator *allocator))
+        __attribute__nonnull__(2);
+
 PARROT_CANNOT_RETURN_NULL
 PARROT_EXPORT
 void * Parrot_gc_pool_allocate(PARROT_INTERP, ARGMOD(Pool_Allocator * pool))
@@ -125,6 +177,13 @@ Pool_Allocator * Parrot_gc_pool_new(SHIM_INTERP, size_t object_size);
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(allocator))
+#define ASSERT_ARGS_Parrot_gc_fixed_allocator_evacuate \
+     __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(allocator) \
+    , PARROT_ASSERT_ARG(data))
+#define ASSERT_ARGS_Parrot_gc_fixed_allocator_finish_evacuation \
+     __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(allocator))
 #define ASSERT_ARGS_Parrot_gc_fixed_allocator_free \
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
@@ -132,6 +191,14 @@ Pool_Allocator * Parrot_gc_pool_new(SHIM_INTERP, size_t object_size);
     , PARROT_ASSERT_ARG(data))
 #define ASSERT_ARGS_Parrot_gc_fixed_allocator_new __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_Parrot_gc_fixed_allocator_pin __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(allocator))
+#define ASSERT_ARGS_Parrot_gc_fixed_allocator_plan_evacuation \
+     __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(allocator))
+#define ASSERT_ARGS_Parrot_gc_fixed_allocator_start_evacuation \
+     __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(allocator))
 #define ASSERT_ARGS_Parrot_gc_pool_allocate __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(pool))
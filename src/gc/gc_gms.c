@@ -0,0 +1,2056 @@
+/*
+Copyright (C) 2011, Parrot Foundation.
+
+=head1 NAME
+
+src/gc/gc_gms.c - Generational M&S
+
+=head1 DESCRIPTION
+
+A mark and sweep collector with two generations, built on the allocators of
+F<src/gc/gc_ms2.c>.
+
+New PMC and STRING headers are young.  They are taken from the pool
+allocators, which bump a pointer through fresh arenas, and once
+C<GC_GMS_NURSERY_SIZE> bytes were allocated a minor collection traces the
+young generation only.  Headers can't move while C code and the system stack
+point to them, so the survivors of a collection are promoted in place: they
+are flagged old and moved to the list of old headers.
+
+Old headers stay live between collections, which stops marking at them.  The
+write barrier (C<PARROT_GC_WRITE_BARRIER>) records the old PMCs stored into
+in the remembered set, whose children are marked by the next minor
+collection.  PMC classes declared C<no_wb> have no write barriers: their old
+instances are always in the remembered set.  So are, until the next
+collection, the PMCs the system stack points to, which C code may still be
+filling in.
+
+A major collection traces the whole heap.  It runs when the old generation has
+doubled since the last one, but not before it holds an eighth of the system
+memory, and for every collection requested through C<Parrot_gc_mark_and_sweep>.
+
+=cut
+
+*/
+
+#include "parrot/parrot.h"
+#include "parrot/gc_api.h"
+#include "parrot/pointer_array.h"
+#include "parrot/sysmem.h"
+#include "gc_private.h"
+#include "fixed_allocator.h"
+
+typedef struct pmc_alloc_struct {
+    void *ptr;
+    PMC   pmc;   /* NB: Value! */
+} pmc_alloc_struct;
+
+typedef struct string_alloc_struct {
+    void    *ptr;
+    STRING   str;   /* NB: Value! */
+} string_alloc_struct;
+
+/* We allocate additional space in front of PObj* to store additional pointer */
+#define PMC2PAC(p) ((pmc_alloc_struct *)((char*)(p) - sizeof (void *)))
+#define STR2PAC(p) ((string_alloc_struct *)((char*)(p) - sizeof (void *)))
+
+#define PANIC_OUT_OF_MEM(size) failed_allocation(__LINE__, (size))
+
+/* Bytes to allocate between two collections */
+#ifndef GC_GMS_NURSERY_SIZE
+#  define GC_GMS_NURSERY_SIZE (8 * 1024 * 1024)
+#endif
+
+/* Report old PMCs stored into without write barrier on minor collections */
+#ifndef GC_GMS_VERIFY
+#  define GC_GMS_VERIFY 0
+#endif
+
+/* Collect when the nursery is full */
+#define MAYBE_COLLECT(interp, self) { \
+    if ((self)->young_size > GC_GMS_NURSERY_SIZE) \
+        gc_gms_collect((interp), (self)); \
+    }
+
+/* Private information */
+typedef struct Generational_GC {
+    /* Allocator for PMC headers */
+    struct Pool_Allocator          *pmc_allocator;
+    /* PMCs allocated since the last collection */
+    struct Parrot_Pointer_Array    *young_objects;
+    /* PMCs which survived a collection */
+    struct Parrot_Pointer_Array    *old_objects;
+    /* During M&S gather new live objects in this list */
+    struct Parrot_Pointer_Array    *new_objects;
+    /* Old PMCs which may point to young objects */
+    struct Parrot_Pointer_Array    *remembered;
+    /* PMCs found on the C stack during a collection */
+    struct Parrot_Pointer_Array    *stack_objects;
+
+    /* Allocator for strings */
+    struct Pool_Allocator          *string_allocator;
+    struct Parrot_Pointer_Array    *young_strings;
+    struct Parrot_Pointer_Array    *old_strings;
+
+    /* Fixed-size allocator */
+    struct Fixed_Allocator *fixed_size_allocator;
+
+    /* String GC */
+    struct String_GC        string_gc;
+
+    /* Bytes allocated since the last collection */
+    size_t young_size;
+
+    /* Approximate size of the old generation */
+    size_t old_size;
+
+    /* Size of the old generation which triggers a major collection */
+    size_t major_threshold;
+
+    /* Lower bound of major_threshold */
+    size_t min_major_threshold;
+
+    /* Set during a collection, to the GC_*_FLAGs of a major one */
+    int    collecting;
+    int    major;
+
+    /* The old PMC verified by gc_gms_verify_remembered */
+    PMC   *verifying;
+
+    /* Set while tracing the C stack */
+    int    tracing_stack;
+
+    /* GC blocking */
+    UINTVAL gc_mark_block_level;  /* How many outstanding GC block
+                                     requests are there? */
+    UINTVAL gc_sweep_block_level; /* How many outstanding GC block
+                                     requests are there? */
+
+    UINTVAL num_early_gc_PMCs;    /* how many PMCs want immediate destruction */
+
+} Generational_GC;
+
+/* HEADERIZER HFILE: src/gc/gc_private.h */
+
+/* HEADERIZER BEGIN: static */
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+
+PARROT_DOES_NOT_RETURN
+static void failed_allocation(unsigned int line, unsigned long size);
+
+PARROT_MALLOC
+PARROT_CAN_RETURN_NULL
+static Buffer* gc_gms_allocate_buffer_header(PARROT_INTERP,
+    SHIM(size_t size))
+        __attribute__nonnull__(1);
+
+static void gc_gms_allocate_buffer_storage(PARROT_INTERP,
+    ARGIN(Buffer *str),
+    size_t size)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+PARROT_CAN_RETURN_NULL
+static void* gc_gms_allocate_fixed_size_storage(PARROT_INTERP, size_t size)
+        __attribute__nonnull__(1);
+
+PARROT_MALLOC
+PARROT_CAN_RETURN_NULL
+static void * gc_gms_allocate_memory_chunk(SHIM_INTERP, size_t size);
+
+PARROT_MALLOC
+PARROT_CAN_RETURN_NULL
+static void * gc_gms_allocate_memory_chunk_zeroed(SHIM_INTERP, size_t size);
+
+PARROT_MALLOC
+PARROT_CAN_RETURN_NULL
+static void* gc_gms_allocate_pmc_attributes(PARROT_INTERP, ARGMOD(PMC *pmc))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*pmc);
+
+PARROT_MALLOC
+PARROT_CAN_RETURN_NULL
+static PMC* gc_gms_allocate_pmc_header(PARROT_INTERP, SHIM(UINTVAL flags))
+        __attribute__nonnull__(1);
+
+PARROT_MALLOC
+PARROT_CAN_RETURN_NULL
+static STRING* gc_gms_allocate_string_header(PARROT_INTERP,
+    SHIM(UINTVAL flags))
+        __attribute__nonnull__(1);
+
+static void gc_gms_allocate_string_storage(PARROT_INTERP,
+    ARGIN(STRING *str),
+    size_t size)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+static void gc_gms_block_GC_mark(PARROT_INTERP)
+        __attribute__nonnull__(1);
+
+static void gc_gms_block_GC_sweep(PARROT_INTERP)
+        __attribute__nonnull__(1);
+
+static void gc_gms_collect(PARROT_INTERP, ARGIN(Generational_GC *self))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+static void gc_gms_compact_memory_pool(PARROT_INTERP)
+        __attribute__nonnull__(1);
+
+static void gc_gms_destroy_pmc_pool(PARROT_INTERP,
+    ARGIN(Pool_Allocator *pool),
+    ARGIN(Parrot_Pointer_Array *list))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
+static void gc_gms_finalize(PARROT_INTERP)
+        __attribute__nonnull__(1);
+
+static void gc_gms_finish_collection(PARROT_INTERP,
+    ARGIN(Generational_GC *self))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+static void gc_gms_free_buffer_header(PARROT_INTERP,
+    ARGFREE(Buffer *s),
+    SHIM(size_t size))
+        __attribute__nonnull__(1);
+
+static void gc_gms_free_fixed_size_storage(PARROT_INTERP,
+    size_t size,
+    ARGMOD(void *data))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*data);
+
+static void gc_gms_free_memory_chunk(SHIM_INTERP, ARGFREE(void *data));
+static void gc_gms_free_pmc_attributes(PARROT_INTERP, ARGMOD(PMC *pmc))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*pmc);
+
+static void gc_gms_free_pmc_header(PARROT_INTERP, ARGFREE(PMC *pmc))
+        __attribute__nonnull__(1);
+
+static void gc_gms_free_string_header(PARROT_INTERP, ARGFREE(STRING *s))
+        __attribute__nonnull__(1);
+
+static size_t gc_gms_get_gc_info(PARROT_INTERP, Interpinfo_enum which)
+        __attribute__nonnull__(1);
+
+static unsigned int gc_gms_is_blocked_GC_mark(PARROT_INTERP)
+        __attribute__nonnull__(1);
+
+static unsigned int gc_gms_is_blocked_GC_sweep(PARROT_INTERP)
+        __attribute__nonnull__(1);
+
+static int gc_gms_is_live_pmc(PARROT_INTERP,
+    ARGIN(Generational_GC *self),
+    ARGIN_NULLOK(void *ptr))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+static int gc_gms_is_pmc_ptr(PARROT_INTERP, ARGIN_NULLOK(void *ptr))
+        __attribute__nonnull__(1);
+
+static int gc_gms_is_ptr_owned(PARROT_INTERP,
+    ARGIN_NULLOK(void *ptr),
+    ARGIN(Pool_Allocator *pool),
+    ARGIN(Parrot_Pointer_Array *young),
+    ARGIN(Parrot_Pointer_Array *old))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4)
+        __attribute__nonnull__(5);
+
+static int gc_gms_is_string_ptr(PARROT_INTERP, ARGIN_NULLOK(void *ptr))
+        __attribute__nonnull__(1);
+
+static void gc_gms_iterate_live_strings(PARROT_INTERP,
+    string_iterator_callback callback,
+    ARGIN_NULLOK(void *data))
+        __attribute__nonnull__(1);
+
+static void gc_gms_major_collection(PARROT_INTERP,
+    ARGIN(Generational_GC *self),
+    UINTVAL flags)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+static void gc_gms_mark_and_sweep(PARROT_INTERP, UINTVAL flags)
+        __attribute__nonnull__(1);
+
+static void gc_gms_mark_children(PARROT_INTERP, ARGIN(PMC *pmc))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+static void gc_gms_mark_pmc_header(PARROT_INTERP, ARGIN(PMC *pmc))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+static void gc_gms_mark_pobj_header(PARROT_INTERP, ARGIN_NULLOK(PObj * obj))
+        __attribute__nonnull__(1);
+
+static void gc_gms_mark_roots(PARROT_INTERP, ARGIN(Generational_GC *self))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+static void gc_gms_minor_collection(PARROT_INTERP,
+    ARGIN(Generational_GC *self))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+static void gc_gms_pmc_needs_early_collection(PARROT_INTERP, SHIM(PMC *pmc))
+        __attribute__nonnull__(1);
+
+static void gc_gms_promote_pmc(PARROT_INTERP,
+    ARGIN(Generational_GC *self),
+    ARGMOD(PMC *pmc))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*pmc);
+
+static void gc_gms_reallocate_buffer_storage(PARROT_INTERP,
+    ARGIN(Buffer *str),
+    size_t size)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+PARROT_MALLOC
+PARROT_CAN_RETURN_NULL
+static void * gc_gms_reallocate_memory_chunk(SHIM_INTERP,
+    ARGFREE(void *from),
+    size_t size);
+
+PARROT_MALLOC
+PARROT_CANNOT_RETURN_NULL
+static void * gc_gms_reallocate_memory_chunk_zeroed(SHIM_INTERP,
+    ARGFREE(void *data),
+    size_t newsize,
+    size_t oldsize);
+
+static void gc_gms_reallocate_string_storage(PARROT_INTERP,
+    ARGIN(STRING *str),
+    size_t size)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+static void gc_gms_remember_stack_objects(PARROT_INTERP,
+    ARGIN(Generational_GC *self))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+static void gc_gms_report_young(SHIM_INTERP,
+    ARGIN(Generational_GC *self),
+    ARGIN(PObj *obj))
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
+static void gc_gms_sweep_pmc_pool(PARROT_INTERP,
+    ARGIN(Generational_GC *self),
+    ARGIN(Parrot_Pointer_Array *list))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
+static void gc_gms_sweep_string_pool(PARROT_INTERP,
+    ARGIN(Generational_GC *self),
+    ARGIN(Parrot_Pointer_Array *list))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
+static void gc_gms_unblock_GC_mark(PARROT_INTERP)
+        __attribute__nonnull__(1);
+
+static void gc_gms_unblock_GC_sweep(PARROT_INTERP)
+        __attribute__nonnull__(1);
+
+static void gc_gms_verify_remembered(PARROT_INTERP,
+    ARGIN(Generational_GC *self))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+static void gc_gms_write_barrier(PARROT_INTERP, ARGIN(PMC *pmc))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+#define ASSERT_ARGS_failed_allocation __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
+#define ASSERT_ARGS_gc_gms_allocate_buffer_header __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_gc_gms_allocate_buffer_storage \
+     __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(str))
+#define ASSERT_ARGS_gc_gms_allocate_fixed_size_storage \
+     __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_gc_gms_allocate_memory_chunk __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
+#define ASSERT_ARGS_gc_gms_allocate_memory_chunk_zeroed \
+     __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
+#define ASSERT_ARGS_gc_gms_allocate_pmc_attributes \
+     __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pmc))
+#define ASSERT_ARGS_gc_gms_allocate_pmc_header __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_gc_gms_allocate_string_header __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_gc_gms_allocate_string_storage \
+     __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(str))
+#define ASSERT_ARGS_gc_gms_block_GC_mark __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_gc_gms_block_GC_sweep __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_gc_gms_collect __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self))
+#define ASSERT_ARGS_gc_gms_compact_memory_pool __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_gc_gms_destroy_pmc_pool __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pool) \
+    , PARROT_ASSERT_ARG(list))
+#define ASSERT_ARGS_gc_gms_finalize __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_gc_gms_finish_collection __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self))
+#define ASSERT_ARGS_gc_gms_free_buffer_header __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_gc_gms_free_fixed_size_storage \
+     __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(data))
+#define ASSERT_ARGS_gc_gms_free_memory_chunk __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
+#define ASSERT_ARGS_gc_gms_free_pmc_attributes __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pmc))
+#define ASSERT_ARGS_gc_gms_free_pmc_header __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_gc_gms_free_string_header __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_gc_gms_get_gc_info __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_gc_gms_is_blocked_GC_mark __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_gc_gms_is_blocked_GC_sweep __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_gc_gms_is_live_pmc __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self))
+#define ASSERT_ARGS_gc_gms_is_pmc_ptr __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_gc_gms_is_ptr_owned __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pool) \
+    , PARROT_ASSERT_ARG(young) \
+    , PARROT_ASSERT_ARG(old))
+#define ASSERT_ARGS_gc_gms_is_string_ptr __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_gc_gms_iterate_live_strings __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_gc_gms_major_collection __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self))
+#define ASSERT_ARGS_gc_gms_mark_and_sweep __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_gc_gms_mark_children __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pmc))
+#define ASSERT_ARGS_gc_gms_mark_pmc_header __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pmc))
+#define ASSERT_ARGS_gc_gms_mark_pobj_header __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_gc_gms_mark_roots __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self))
+#define ASSERT_ARGS_gc_gms_minor_collection __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self))
+#define ASSERT_ARGS_gc_gms_pmc_needs_early_collection \
+     __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_gc_gms_promote_pmc __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self) \
+    , PARROT_ASSERT_ARG(pmc))
+#define ASSERT_ARGS_gc_gms_reallocate_buffer_storage \
+     __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(str))
+#define ASSERT_ARGS_gc_gms_reallocate_memory_chunk \
+     __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
+#define ASSERT_ARGS_gc_gms_reallocate_memory_chunk_zeroed \
+     __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
+#define ASSERT_ARGS_gc_gms_reallocate_string_storage \
+     __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(str))
+#define ASSERT_ARGS_gc_gms_remember_stack_objects __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self))
+#define ASSERT_ARGS_gc_gms_report_young __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(self) \
+    , PARROT_ASSERT_ARG(obj))
+#define ASSERT_ARGS_gc_gms_sweep_pmc_pool __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self) \
+    , PARROT_ASSERT_ARG(list))
+#define ASSERT_ARGS_gc_gms_sweep_string_pool __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self) \
+    , PARROT_ASSERT_ARG(list))
+#define ASSERT_ARGS_gc_gms_unblock_GC_mark __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_gc_gms_unblock_GC_sweep __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_gc_gms_verify_remembered __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self))
+#define ASSERT_ARGS_gc_gms_write_barrier __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pmc))
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+/* HEADERIZER END: static */
+
+/*
+
+=head1 Functions
+
+=over 4
+
+=item C<static void gc_gms_compact_memory_pool(PARROT_INTERP)>
+
+Compacts the string pool.
+
+=cut
+
+*/
+
+static void
+gc_gms_compact_memory_pool(PARROT_INTERP)
+{
+    ASSERT_ARGS(gc_gms_compact_memory_pool)
+    Generational_GC *self = (Generational_GC *)interp->gc_sys->gc_private;
+    Parrot_gc_str_compact_pool(interp, &self->string_gc);
+}
+
+
+/*
+
+=item C<static void* gc_gms_allocate_pmc_attributes(PARROT_INTERP, PMC *pmc)>
+
+=item C<static void gc_gms_free_pmc_attributes(PARROT_INTERP, PMC *pmc)>
+
+=item C<static void* gc_gms_allocate_fixed_size_storage(PARROT_INTERP, size_t
+size)>
+
+=item C<static void gc_gms_free_fixed_size_storage(PARROT_INTERP, size_t size,
+void *data)>
+
+Functions for allocating/deallocating various objects.
+
+=cut
+
+*/
+
+PARROT_MALLOC
+PARROT_CAN_RETURN_NULL
+static void*
+gc_gms_allocate_pmc_attributes(PARROT_INTERP, ARGMOD(PMC *pmc))
+{
+    ASSERT_ARGS(gc_gms_allocate_pmc_attributes)
+    Generational_GC *self      = (Generational_GC *)interp->gc_sys->gc_private;
+    const size_t     attr_size = pmc->vtable->attr_size;
+
+    PMC_data(pmc)              = Parrot_gc_fixed_allocator_allocate(interp,
+                                    self->fixed_size_allocator, attr_size);
+
+    memset(PMC_data(pmc), 0, attr_size);
+    interp->gc_sys->stats.mem_used_last_collect += attr_size;
+    self->young_size                            += attr_size;
+
+    return PMC_data(pmc);
+}
+
+
+static void
+gc_gms_free_pmc_attributes(PARROT_INTERP, ARGMOD(PMC *pmc))
+{
+    ASSERT_ARGS(gc_gms_free_pmc_attributes)
+
+    if (PMC_data(pmc)) {
+        Generational_GC *self = (Generational_GC *)interp->gc_sys->gc_private;
+        Parrot_gc_fixed_allocator_free(interp, self->fixed_size_allocator,
+                PMC_data(pmc), pmc->vtable->attr_size);
+
+        interp->gc_sys->stats.mem_used_last_collect -= pmc->vtable->attr_size;
+    }
+}
+
+
+PARROT_CAN_RETURN_NULL
+static void*
+gc_gms_allocate_fixed_size_storage(PARROT_INTERP, size_t size)
+{
+    ASSERT_ARGS(gc_gms_allocate_fixed_size_storage)
+    Generational_GC *self = (Generational_GC *)interp->gc_sys->gc_private;
+
+    interp->gc_sys->stats.memory_allocated      += size;
+    interp->gc_sys->stats.mem_used_last_collect += size;
+    self->young_size                            += size;
+
+    return Parrot_gc_fixed_allocator_allocate(interp,
+                self->fixed_size_allocator, size);
+}
+
+
+static void
+gc_gms_free_fixed_size_storage(PARROT_INTERP, size_t size, ARGMOD(void *data))
+{
+    ASSERT_ARGS(gc_gms_free_fixed_size_storage)
+    if (data) {
+        Generational_GC *self = (Generational_GC *)interp->gc_sys->gc_private;
+
+        interp->gc_sys->stats.memory_allocated      -= size;
+        interp->gc_sys->stats.mem_used_last_collect -= size;
+
+        Parrot_gc_fixed_allocator_free(interp, self->fixed_size_allocator,
+                                         data, size);
+    }
+}
+
+
+/*
+
+=item C<static size_t gc_gms_get_gc_info(PARROT_INTERP, Interpinfo_enum which)>
+
+GC introspection function.
+gets stats based on enum which
+
+=cut
+
+*/
+
+static size_t
+gc_gms_get_gc_info(PARROT_INTERP, Interpinfo_enum which)
+{
+    ASSERT_ARGS(gc_gms_get_gc_info)
+    Generational_GC *self = (Generational_GC *)interp->gc_sys->gc_private;
+
+    if (which == IMPATIENT_PMCS)
+        return self->num_early_gc_PMCs;
+
+    return Parrot_gc_get_info(interp, which, &interp->gc_sys->stats);
+}
+
+
+/*
+
+=item C<void Parrot_gc_gms_init(PARROT_INTERP)>
+
+Initializes the generational collector. Installs the necessary function
+pointers into the GC_Subsystem structure, including the C<write_barrier> hook
+which no other collector needs.
+
+=cut
+
+*/
+
+void
+Parrot_gc_gms_init(PARROT_INTERP)
+{
+    ASSERT_ARGS(Parrot_gc_gms_init)
+    struct Generational_GC *self;
+
+    interp->gc_sys->finalize_gc_system          = gc_gms_finalize;
+
+    interp->gc_sys->do_gc_mark                  = gc_gms_mark_and_sweep;
+    interp->gc_sys->compact_string_pool         = gc_gms_compact_memory_pool;
+
+    interp->gc_sys->pmc_needs_early_collection  = gc_gms_pmc_needs_early_collection;
+
+    interp->gc_sys->allocate_pmc_header         = gc_gms_allocate_pmc_header;
+    interp->gc_sys->free_pmc_header             = gc_gms_free_pmc_header;
+
+    interp->gc_sys->allocate_string_header      = gc_gms_allocate_string_header;
+    interp->gc_sys->free_string_header          = gc_gms_free_string_header;
+
+    interp->gc_sys->allocate_bufferlike_header  = gc_gms_allocate_buffer_header;
+    interp->gc_sys->free_bufferlike_header      = gc_gms_free_buffer_header;
+
+    interp->gc_sys->allocate_pmc_attributes     = gc_gms_allocate_pmc_attributes;
+    interp->gc_sys->free_pmc_attributes         = gc_gms_free_pmc_attributes;
+
+    interp->gc_sys->is_pmc_ptr                  = gc_gms_is_pmc_ptr;
+    interp->gc_sys->is_string_ptr               = gc_gms_is_string_ptr;
+    interp->gc_sys->mark_pmc_header             = gc_gms_mark_pmc_header;
+    interp->gc_sys->mark_pobj_header            = gc_gms_mark_pobj_header;
+
+    interp->gc_sys->block_mark                  = gc_gms_block_GC_mark;
+    interp->gc_sys->unblock_mark                = gc_gms_unblock_GC_mark;
+    interp->gc_sys->is_blocked_mark             = gc_gms_is_blocked_GC_mark;
+
+    interp->gc_sys->block_sweep                 = gc_gms_block_GC_sweep;
+    interp->gc_sys->unblock_sweep               = gc_gms_unblock_GC_sweep;
+    interp->gc_sys->is_blocked_sweep            = gc_gms_is_blocked_GC_sweep;
+
+    interp->gc_sys->allocate_string_storage     = gc_gms_allocate_string_storage;
+    interp->gc_sys->reallocate_string_storage   = gc_gms_reallocate_string_storage;
+
+    interp->gc_sys->allocate_buffer_storage     = gc_gms_allocate_buffer_storage;
+    interp->gc_sys->reallocate_buffer_storage   = gc_gms_reallocate_buffer_storage;
+
+    interp->gc_sys->allocate_fixed_size_storage = gc_gms_allocate_fixed_size_storage;
+    interp->gc_sys->free_fixed_size_storage     = gc_gms_free_fixed_size_storage;
+
+    /* We don't distinguish between chunk and chunk_with_pointers */
+    interp->gc_sys->allocate_memory_chunk   = gc_gms_allocate_memory_chunk;
+    interp->gc_sys->reallocate_memory_chunk = gc_gms_reallocate_memory_chunk;
+
+    interp->gc_sys->allocate_memory_chunk_with_interior_pointers
+                = gc_gms_allocate_memory_chunk_zeroed;
+    interp->gc_sys->reallocate_memory_chunk_with_interior_pointers
+                = gc_gms_reallocate_memory_chunk_zeroed;
+    interp->gc_sys->free_memory_chunk       = gc_gms_free_memory_chunk;
+
+    interp->gc_sys->iterate_live_strings    = gc_gms_iterate_live_strings;
+
+    interp->gc_sys->get_gc_info             = gc_gms_get_gc_info;
+
+    interp->gc_sys->write_barrier           = gc_gms_write_barrier;
+
+    if (interp->parent_interpreter && interp->parent_interpreter->gc_sys) {
+        /* This is a "child" interpreter. Just reuse parent one */
+        self = (Generational_GC*)interp->parent_interpreter->gc_sys->gc_private;
+    }
+    else {
+        self = mem_allocate_zeroed_typed(Generational_GC);
+
+        self->pmc_allocator = Parrot_gc_pool_new(interp,
+            sizeof (pmc_alloc_struct));
+        self->young_objects = Parrot_pa_new(interp);
+        self->old_objects   = Parrot_pa_new(interp);
+        self->remembered    = Parrot_pa_new(interp);
+
+        self->string_allocator = Parrot_gc_pool_new(interp,
+            sizeof (string_alloc_struct));
+        self->young_strings = Parrot_pa_new(interp);
+        self->old_strings   = Parrot_pa_new(interp);
+
+        self->fixed_size_allocator = Parrot_gc_fixed_allocator_new(interp);
+
+        self->min_major_threshold = Parrot_sysmem_amount(interp) / 8;
+        self->major_threshold     = self->min_major_threshold;
+
+        Parrot_gc_str_initialize(interp, &self->string_gc);
+    }
+
+    interp->gc_sys->gc_private = self;
+}
+
+
+/*
+
+=item C<static void gc_gms_finalize(PARROT_INTERP)>
+
+Finalize GC subsystem.
+
+=cut
+
+*/
+
+static void
+gc_gms_finalize(PARROT_INTERP)
+{
+    ASSERT_ARGS(gc_gms_finalize)
+
+    if (!interp->parent_interpreter) {
+        Generational_GC *self = (Generational_GC *)interp->gc_sys->gc_private;
+
+        Parrot_gc_str_finalize(interp, &self->string_gc);
+
+        Parrot_pa_destroy(interp, self->young_objects);
+        Parrot_pa_destroy(interp, self->old_objects);
+        Parrot_pa_destroy(interp, self->remembered);
+        Parrot_pa_destroy(interp, self->young_strings);
+        Parrot_pa_destroy(interp, self->old_strings);
+        Parrot_gc_pool_destroy(interp, self->pmc_allocator);
+        Parrot_gc_pool_destroy(interp, self->string_allocator);
+        Parrot_gc_fixed_allocator_destroy(interp, self->fixed_size_allocator);
+
+        /* now free this GC system */
+        mem_sys_free(self);
+        interp->gc_sys->gc_private = NULL;
+    }
+}
+
+
+/*
+
+=item C<static PMC* gc_gms_allocate_pmc_header(PARROT_INTERP, UINTVAL flags)>
+
+=item C<static void gc_gms_free_pmc_header(PARROT_INTERP, PMC *pmc)>
+
+Allocates a young PMC header, or frees a PMC header.  Headers are moved
+between lists during a collection, so they aren't freed before the next one.
+
+=cut
+
+*/
+
+PARROT_MALLOC
+PARROT_CAN_RETURN_NULL
+static PMC*
+gc_gms_allocate_pmc_header(PARROT_INTERP, SHIM(UINTVAL flags))
+{
+    ASSERT_ARGS(gc_gms_allocate_pmc_header)
+    Generational_GC  *self = (Generational_GC *)interp->gc_sys->gc_private;
+    Pool_Allocator   *pool = self->pmc_allocator;
+    pmc_alloc_struct *ptr;
+
+    MAYBE_COLLECT(interp, self);
+
+    /* Increase used memory. Not precisely accurate due Pool_Allocator paging */
+    ++interp->gc_sys->stats.header_allocs_since_last_collect;
+
+    interp->gc_sys->stats.memory_allocated      += sizeof (PMC);
+    interp->gc_sys->stats.mem_used_last_collect += sizeof (PMC);
+    self->young_size                            += sizeof (PMC);
+
+    ptr = (pmc_alloc_struct *)Parrot_gc_pool_allocate(interp, pool);
+    ptr->ptr = Parrot_pa_insert(interp, self->young_objects, ptr);
+
+    return &ptr->pmc;
+}
+
+
+static void
+gc_gms_free_pmc_header(PARROT_INTERP, ARGFREE(PMC *pmc))
+{
+    ASSERT_ARGS(gc_gms_free_pmc_header)
+    Generational_GC *self = (Generational_GC *)interp->gc_sys->gc_private;
+
+    if (pmc && !self->collecting) {
+        pmc_alloc_struct * const item = PMC2PAC(pmc);
+
+        if (PObj_on_free_list_TEST(pmc))
+            return;
+
+        /* Constants aren't listed after their first collection */
+        if (item->ptr)
+            Parrot_pa_remove(interp, PObj_GC_old_TEST(pmc)
+                    ? self->old_objects : self->young_objects, item->ptr);
+
+        /* Leave the cell in the remembered set, it's skipped */
+        PObj_GC_remembered_CLEAR(pmc);
+        PObj_on_free_list_SET(pmc);
+
+        Parrot_pmc_destroy(interp, pmc);
+
+        Parrot_gc_pool_free(interp, self->pmc_allocator, item);
+
+        --interp->gc_sys->stats.header_allocs_since_last_collect;
+        interp->gc_sys->stats.memory_allocated      -= sizeof (PMC);
+        interp->gc_sys->stats.mem_used_last_collect -= sizeof (PMC);
+    }
+}
+
+
+/*
+
+=item C<static void gc_gms_mark_pmc_header(PARROT_INTERP, PMC *pmc)>
+
+Marks a PMC as grey, unless it's old and the collection is a minor one.
+
+=cut
+
+*/
+
+static void
+gc_gms_mark_pmc_header(PARROT_INTERP, ARGIN(PMC *pmc))
+{
+    ASSERT_ARGS(gc_gms_mark_pmc_header)
+    Generational_GC   *self = (Generational_GC *)interp->gc_sys->gc_private;
+    pmc_alloc_struct  *item = PMC2PAC(pmc);
+
+    if (self->tracing_stack && !PObj_constant_TEST(pmc))
+        Parrot_pa_insert(interp, self->stack_objects, pmc);
+
+    /* Object was already marked as grey. Or live. Or old. Or dead. Skip it */
+    if (PObj_is_live_or_free_TESTALL(pmc))
+        return;
+
+    if (GC_GMS_VERIFY && self->verifying) {
+        if (!PObj_constant_TEST(pmc))
+            gc_gms_report_young(interp, self, (PObj *)pmc);
+        return;
+    }
+
+    /* mark it live */
+    PObj_live_SET(pmc);
+
+    if (!PObj_constant_TEST(pmc)) {
+        Parrot_pa_remove(interp, PObj_GC_old_TEST(pmc)
+                ? self->old_objects : self->young_objects, item->ptr);
+        item->ptr = Parrot_pa_insert(interp, self->new_objects, item);
+    }
+}
+
+
+/*
+
+=item C<static void gc_gms_mark_children(PARROT_INTERP, PMC *pmc)>
+
+Marks the PMCs and STRINGs C<pmc> points to.
+
+=cut
+
+*/
+
+static void
+gc_gms_mark_children(PARROT_INTERP, ARGIN(PMC *pmc))
+{
+    ASSERT_ARGS(gc_gms_mark_children)
+
+    /* if object is a PMC and contains buffers or PMCs, then attach the PMC
+     * to the chained mark list. */
+    if (PObj_custom_mark_TEST(pmc))
+        VTABLE_mark(interp, pmc);
+
+    if (PMC_metadata(pmc))
+        Parrot_gc_mark_PMC_alive(interp, PMC_metadata(pmc));
+}
+
+
+/*
+
+=item C<static int gc_gms_is_pmc_ptr(PARROT_INTERP, void *ptr)>
+
+Establish if *ptr is.owned.  While tracing the C stack, also gathers the live
+PMCs C<ptr> points to into C<stack_objects>, as marking skips them.
+
+=item C<static int gc_gms_is_live_pmc(PARROT_INTERP, Generational_GC *self, void
+*ptr)>
+
+Establish if *ptr is an owned PMC marked live already.
+
+=cut
+
+*/
+
+static int
+gc_gms_is_pmc_ptr(PARROT_INTERP, ARGIN_NULLOK(void *ptr))
+{
+    ASSERT_ARGS(gc_gms_is_pmc_ptr)
+    Generational_GC *self = (Generational_GC *)interp->gc_sys->gc_private;
+
+    if (self->tracing_stack && gc_gms_is_live_pmc(interp, self, ptr))
+        Parrot_pa_insert(interp, self->stack_objects, ptr);
+
+    return gc_gms_is_ptr_owned(interp, ptr, self->pmc_allocator,
+            self->young_objects, self->old_objects);
+}
+
+
+static int
+gc_gms_is_live_pmc(PARROT_INTERP, ARGIN(Generational_GC *self),
+        ARGIN_NULLOK(void *ptr))
+{
+    ASSERT_ARGS(gc_gms_is_live_pmc)
+    PMC              *pmc  = (PMC *)ptr;
+    pmc_alloc_struct *item = PMC2PAC(ptr);
+
+    if (!pmc || !item
+    ||  !Parrot_gc_pool_is_owned(interp, self->pmc_allocator, item))
+        return 0;
+
+    if (!PObj_live_TEST(pmc) || PObj_on_free_list_TEST(pmc)
+    ||   PObj_constant_TEST(pmc))
+        return 0;
+
+    /* Old ones stay in their list on minor collections */
+    return Parrot_pa_is_owned(interp, self->new_objects, item, item->ptr)
+        || Parrot_pa_is_owned(interp, self->old_objects, item, item->ptr);
+}
+
+
+/*
+
+=item C<static STRING* gc_gms_allocate_string_header(PARROT_INTERP, UINTVAL
+flags)>
+
+=item C<static void gc_gms_free_string_header(PARROT_INTERP, STRING *s)>
+
+=item C<static Buffer* gc_gms_allocate_buffer_header(PARROT_INTERP, size_t
+size)>
+
+=item C<static void gc_gms_free_buffer_header(PARROT_INTERP, Buffer *s, size_t
+size)>
+
+Allocate/free string/buffer headers.
+
+=cut
+
+*/
+
+PARROT_MALLOC
+PARROT_CAN_RETURN_NULL
+static STRING*
+gc_gms_allocate_string_header(PARROT_INTERP, SHIM(UINTVAL flags))
+{
+    ASSERT_ARGS(gc_gms_allocate_string_header)
+    Generational_GC     *self = (Generational_GC *)interp->gc_sys->gc_private;
+    Pool_Allocator      *pool = self->string_allocator;
+    string_alloc_struct *ptr;
+    STRING              *ret;
+
+    MAYBE_COLLECT(interp, self);
+
+    /* Increase used memory. Not precisely accurate due Pool_Allocator paging */
+    ++interp->gc_sys->stats.header_allocs_since_last_collect;
+    interp->gc_sys->stats.memory_allocated      += sizeof (STRING);
+    interp->gc_sys->stats.mem_used_last_collect += sizeof (STRING);
+    self->young_size                            += sizeof (STRING);
+
+    ptr = (string_alloc_struct *)Parrot_gc_pool_allocate(interp, pool);
+    ptr->ptr = Parrot_pa_insert(interp, self->young_strings, ptr);
+
+    ret = &ptr->str;
+    memset(ret, 0, sizeof (STRING));
+    return ret;
+}
+
+
+static void
+gc_gms_free_string_header(PARROT_INTERP, ARGFREE(STRING *s))
+{
+    ASSERT_ARGS(gc_gms_free_string_header)
+
+    if (s && !PObj_on_free_list_TEST(s)) {
+        Generational_GC     * const self = (Generational_GC *)interp->gc_sys->gc_private;
+        string_alloc_struct * const item = STR2PAC(s);
+
+        if (item->ptr)
+            Parrot_pa_remove(interp, PObj_GC_old_TEST(s)
+                    ? self->old_strings : self->young_strings, item->ptr);
+
+        if (Buffer_bufstart(s) && !PObj_external_TEST(s))
+            Parrot_gc_str_free_buffer_storage(interp,
+                &self->string_gc, (Buffer *)s);
+
+        PObj_on_free_list_SET(s);
+
+        Parrot_gc_pool_free(interp, self->string_allocator, item);
+
+        --interp->gc_sys->stats.header_allocs_since_last_collect;
+        interp->gc_sys->stats.memory_allocated      -= sizeof (STRING);
+        interp->gc_sys->stats.mem_used_last_collect -= sizeof (STRING);
+    }
+}
+
+
+PARROT_MALLOC
+PARROT_CAN_RETURN_NULL
+static Buffer*
+gc_gms_allocate_buffer_header(PARROT_INTERP, SHIM(size_t size))
+{
+    ASSERT_ARGS(gc_gms_allocate_buffer_header)
+    return (Buffer *)gc_gms_allocate_string_header(interp, 0);
+}
+
+
+static void
+gc_gms_free_buffer_header(PARROT_INTERP, ARGFREE(Buffer *s), SHIM(size_t size))
+{
+    ASSERT_ARGS(gc_gms_free_buffer_header)
+    gc_gms_free_string_header(interp, (STRING*)s);
+}
+
+
+/*
+
+=item C<static int gc_gms_is_string_ptr(PARROT_INTERP, void *ptr)>
+
+Establish if STRING *ptr is owned.
+
+=cut
+
+*/
+
+static int
+gc_gms_is_string_ptr(PARROT_INTERP, ARGIN_NULLOK(void *ptr))
+{
+    ASSERT_ARGS(gc_gms_is_string_ptr)
+    Generational_GC *self = (Generational_GC *)interp->gc_sys->gc_private;
+    return gc_gms_is_ptr_owned(interp, ptr, self->string_allocator,
+            self->young_strings, self->old_strings);
+}
+
+
+/*
+
+=item C<static void gc_gms_allocate_string_storage(PARROT_INTERP, STRING *str,
+size_t size)>
+
+=item C<static void gc_gms_reallocate_string_storage(PARROT_INTERP, STRING *str,
+size_t size)>
+
+=item C<static void gc_gms_allocate_buffer_storage(PARROT_INTERP, Buffer *str,
+size_t size)>
+
+=item C<static void gc_gms_reallocate_buffer_storage(PARROT_INTERP, Buffer *str,
+size_t size)>
+
+Functions for allocating strings/buffers storage.
+
+=cut
+
+*/
+
+static void
+gc_gms_allocate_string_storage(PARROT_INTERP, ARGIN(STRING *str), size_t size)
+{
+    ASSERT_ARGS(gc_gms_allocate_string_storage)
+    Generational_GC *self = (Generational_GC *)interp->gc_sys->gc_private;
+    Parrot_gc_str_allocate_string_storage(interp, &self->string_gc, str, size);
+    interp->gc_sys->stats.mem_used_last_collect += size;
+    self->young_size                            += size;
+}
+
+
+static void
+gc_gms_reallocate_string_storage(PARROT_INTERP, ARGIN(STRING *str), size_t size)
+{
+    ASSERT_ARGS(gc_gms_reallocate_string_storage)
+    Generational_GC *self = (Generational_GC *)interp->gc_sys->gc_private;
+    Parrot_gc_str_reallocate_string_storage(interp, &self->string_gc, str, size);
+    interp->gc_sys->stats.mem_used_last_collect += size;
+    self->young_size                            += size;
+}
+
+
+static void
+gc_gms_allocate_buffer_storage(PARROT_INTERP, ARGIN(Buffer *str), size_t size)
+{
+    ASSERT_ARGS(gc_gms_allocate_buffer_storage)
+    Generational_GC *self = (Generational_GC *)interp->gc_sys->gc_private;
+    Parrot_gc_str_allocate_buffer_storage(interp, &self->string_gc, str, size);
+    interp->gc_sys->stats.mem_used_last_collect += size;
+    self->young_size                            += size;
+}
+
+
+static void
+gc_gms_reallocate_buffer_storage(PARROT_INTERP, ARGIN(Buffer *str), size_t size)
+{
+    ASSERT_ARGS(gc_gms_reallocate_buffer_storage)
+    Generational_GC *self = (Generational_GC *)interp->gc_sys->gc_private;
+    Parrot_gc_str_reallocate_buffer_storage(interp, &self->string_gc, str, size);
+    interp->gc_sys->stats.mem_used_last_collect += size;
+    self->young_size                            += size;
+}
+
+
+/*
+
+=item C<static void gc_gms_mark_pobj_header(PARROT_INTERP, PObj * obj)>
+
+Marks PObj as live.
+
+=cut
+
+*/
+
+static void
+gc_gms_mark_pobj_header(PARROT_INTERP, ARGIN_NULLOK(PObj * obj))
+{
+    ASSERT_ARGS(gc_gms_mark_pobj_header)
+    if (obj) {
+        if (PObj_is_PMC_TEST(obj))
+            gc_gms_mark_pmc_header(interp, (PMC *)obj);
+        else
+            PObj_live_SET(obj);
+    }
+}
+
+
+/*
+
+=item C<static void gc_gms_iterate_live_strings(PARROT_INTERP,
+string_iterator_callback callback, void *data)>
+
+Iterates over live strings invoking callback for each of them. Used during
+compacting of string pool.
+
+=cut
+
+*/
+
+static void
+gc_gms_iterate_live_strings(PARROT_INTERP,
+        string_iterator_callback callback,
+        ARGIN_NULLOK(void *data))
+{
+    ASSERT_ARGS(gc_gms_iterate_live_strings)
+
+    Generational_GC *self = (Generational_GC *)interp->gc_sys->gc_private;
+
+    POINTER_ARRAY_ITER(self->old_strings,
+        STRING *s = &((string_alloc_struct *)ptr)->str;
+        callback(interp, (Buffer *)s, data););
+
+    POINTER_ARRAY_ITER(self->young_strings,
+        STRING *s = &((string_alloc_struct *)ptr)->str;
+        callback(interp, (Buffer *)s, data););
+}
+
+
+/*
+
+=item C<static void gc_gms_write_barrier(PARROT_INTERP, PMC *pmc)>
+
+Adds the old C<pmc> to the remembered set.
+
+=cut
+
+*/
+
+static void
+gc_gms_write_barrier(PARROT_INTERP, ARGIN(PMC *pmc))
+{
+    ASSERT_ARGS(gc_gms_write_barrier)
+    Generational_GC *self = (Generational_GC *)interp->gc_sys->gc_private;
+
+    PObj_GC_remembered_SET(pmc);
+    Parrot_pa_insert(interp, self->remembered, pmc);
+}
+
+
+/*
+
+=item C<static void gc_gms_mark_and_sweep(PARROT_INTERP, UINTVAL flags)>
+
+Performs a major collection.  This function is called from the GC API function
+C<Parrot_gc_mark_and_sweep>.
+
+Flags can be a combination of these values:
+
+  GC_finish_FLAG
+  GC_lazy_FLAG
+  GC_trace_stack_FLAG
+
+=cut
+
+*/
+
+static void
+gc_gms_mark_and_sweep(PARROT_INTERP, UINTVAL flags)
+{
+    ASSERT_ARGS(gc_gms_mark_and_sweep)
+    Generational_GC * const self = (Generational_GC *)interp->gc_sys->gc_private;
+
+    /* GC is blocked */
+    if (self->gc_mark_block_level || self->collecting)
+        return;
+
+    /* Ignore calls from String GC. We know better when to trigger GC */
+    if (flags & GC_strings_cb_FLAG)
+        return;
+
+    /* avoid global destruction for child interps */
+    if (flags & GC_finish_FLAG && interp->parent_interpreter)
+        return;
+
+    gc_gms_major_collection(interp, self, flags);
+}
+
+
+/*
+
+=item C<static void gc_gms_collect(PARROT_INTERP, Generational_GC *self)>
+
+Performs the collection due after filling the nursery: a major one if the old
+generation outgrew C<major_threshold>, a minor one otherwise.
+
+=cut
+
+*/
+
+static void
+gc_gms_collect(PARROT_INTERP, ARGIN(Generational_GC *self))
+{
+    ASSERT_ARGS(gc_gms_collect)
+
+    if (self->gc_mark_block_level || self->collecting)
+        return;
+
+    if (self->old_size > self->major_threshold)
+        gc_gms_major_collection(interp, self, 0);
+    else
+        gc_gms_minor_collection(interp, self);
+}
+
+
+/*
+
+=item C<static void gc_gms_mark_roots(PARROT_INTERP, Generational_GC *self)>
+
+Marks the root set into C<new_objects>.  The PMCs found on the C stack are
+gathered into C<stack_objects> on the way.
+
+=item C<static void gc_gms_remember_stack_objects(PARROT_INTERP, Generational_GC
+*self)>
+
+Puts the PMCs found on the C stack into the remembered set once the collection
+promoted them.  C code may still be filling them in, e.g. a clone promoted by a
+collection the cloning of its contents triggered, and it stores into a PMC it
+just created without write barrier.
+
+=cut
+
+*/
+
+static void
+gc_gms_mark_roots(PARROT_INTERP, ARGIN(Generational_GC *self))
+{
+    ASSERT_ARGS(gc_gms_mark_roots)
+
+    /* Trace "roots" into new_objects */
+    gc_gms_mark_pmc_header(interp, PMCNULL);
+
+    Parrot_gc_trace_root(interp, NULL, GC_TRACE_ROOT_ONLY);
+
+    self->stack_objects = Parrot_pa_new(interp);
+    self->tracing_stack = 1;
+    Parrot_gc_trace_root(interp, NULL, GC_TRACE_SYSTEM_ONLY);
+    self->tracing_stack = 0;
+
+    if (interp->pdb && interp->pdb->debugger)
+        Parrot_gc_trace_root(interp->pdb->debugger, NULL,
+            (Parrot_gc_trace_type)0);
+}
+
+
+static void
+gc_gms_remember_stack_objects(PARROT_INTERP, ARGIN(Generational_GC *self))
+{
+    ASSERT_ARGS(gc_gms_remember_stack_objects)
+
+    if (!self->stack_objects)
+        return;
+
+    POINTER_ARRAY_ITER(self->stack_objects,
+        PMC *pmc = (PMC *)ptr;
+        if (!PObj_GC_remembered_TEST(pmc))
+            gc_gms_write_barrier(interp, pmc););
+
+    Parrot_pa_destroy(interp, self->stack_objects);
+    self->stack_objects = NULL;
+}
+
+
+/*
+
+=item C<static void gc_gms_minor_collection(PARROT_INTERP, Generational_GC
+*self)>
+
+Collects the young generation.  The roots and the remembered set are marked,
+but marking stops at old objects, which are live.  Live young objects are
+promoted and the rest is freed.
+
+=cut
+
+*/
+
+static void
+gc_gms_minor_collection(PARROT_INTERP, ARGIN(Generational_GC *self))
+{
+    ASSERT_ARGS(gc_gms_minor_collection)
+    Parrot_Pointer_Array *remembered;
+
+    self->collecting = 1;
+    ++self->gc_mark_block_level;
+
+    self->new_objects = Parrot_pa_new(interp);
+
+    gc_gms_mark_roots(interp, self);
+
+    /* The old objects which may point to young ones */
+    POINTER_ARRAY_ITER(self->remembered,
+        PMC *pmc = (PMC *)ptr;
+        if (PObj_GC_remembered_TEST(pmc))
+            gc_gms_mark_children(interp, pmc););
+
+    /* new_objects are "gray" until fully marked */
+    POINTER_ARRAY_ITER(self->new_objects,
+        gc_gms_mark_children(interp, &((pmc_alloc_struct *)ptr)->pmc););
+
+    if (GC_GMS_VERIFY)
+        gc_gms_verify_remembered(interp, self);
+
+    /* young_objects contains "dead" or "constant" PMCs, new_objects the live
+     * young ones, which are promoted */
+    gc_gms_sweep_pmc_pool(interp, self, self->young_objects);
+    gc_gms_sweep_string_pool(interp, self, self->young_strings);
+
+    /* Only old objects which have no write barriers stay remembered */
+    remembered = Parrot_pa_new(interp);
+
+    POINTER_ARRAY_ITER(self->remembered,
+        PMC *pmc = (PMC *)ptr;
+        if (PObj_GC_remembered_TEST(pmc)) {
+            if (PMC_has_no_wb(pmc))
+                Parrot_pa_insert(interp, remembered, pmc);
+            else
+                PObj_GC_remembered_CLEAR(pmc);
+        });
+
+    Parrot_pa_destroy(interp, self->remembered);
+    self->remembered = remembered;
+
+    POINTER_ARRAY_ITER(self->new_objects,
+        pmc_alloc_struct *item = (pmc_alloc_struct *)ptr;
+        gc_gms_promote_pmc(interp, self, &item->pmc);
+        item->ptr = Parrot_pa_insert(interp, self->old_objects, item););
+
+    Parrot_pa_destroy(interp, self->new_objects);
+    self->new_objects = NULL;
+
+    gc_gms_remember_stack_objects(interp, self);
+
+    gc_gms_finish_collection(interp, self);
+}
+
+
+/*
+
+=item C<static void gc_gms_major_collection(PARROT_INTERP, Generational_GC
+*self, UINTVAL flags)>
+
+Collects both generations.  If this occurs during global destruction, makes
+sure to keep around the two PMCs for which order of destruction matters.
+
+=cut
+
+*/
+
+static void
+gc_gms_major_collection(PARROT_INTERP, ARGIN(Generational_GC *self),
+    UINTVAL flags)
+{
+    ASSERT_ARGS(gc_gms_major_collection)
+
+    self->collecting = 1;
+    self->major      = 1;
+    ++self->gc_mark_block_level;
+
+    /* Old objects are marked again */
+    POINTER_ARRAY_ITER(self->old_objects,
+        PObj_live_CLEAR(&((pmc_alloc_struct *)ptr)->pmc););
+    POINTER_ARRAY_ITER(self->old_strings,
+        PObj_live_CLEAR(&((string_alloc_struct *)ptr)->str););
+
+    /* All live objects end up in the old generation: nothing is remembered */
+    Parrot_pa_destroy(interp, self->remembered);
+    self->remembered = Parrot_pa_new(interp);
+
+    self->new_objects = Parrot_pa_new(interp);
+
+    /* destroy root set and constants, but watch ordered destruction */
+    if (flags & GC_finish_FLAG) {
+        PObj_live_SET(interp->gc_registry);
+        PObj_live_SET(interp->scheduler);
+    }
+    else
+        gc_gms_mark_roots(interp, self);
+
+    POINTER_ARRAY_ITER(self->new_objects,
+        gc_gms_mark_children(interp, &((pmc_alloc_struct *)ptr)->pmc););
+
+    gc_gms_sweep_pmc_pool(interp, self, self->young_objects);
+    gc_gms_sweep_pmc_pool(interp, self, self->old_objects);
+    gc_gms_sweep_string_pool(interp, self, self->old_strings);
+    gc_gms_sweep_string_pool(interp, self, self->young_strings);
+
+    /* destroy the rest */
+    if (flags & GC_finish_FLAG) {
+        gc_gms_destroy_pmc_pool(interp, self->pmc_allocator, self->young_objects);
+        gc_gms_destroy_pmc_pool(interp, self->pmc_allocator, self->old_objects);
+        gc_gms_destroy_pmc_pool(interp, self->pmc_allocator, self->new_objects);
+    }
+
+    /* new_objects are the old generation now */
+    self->old_size = 0;
+
+    POINTER_ARRAY_ITER(self->new_objects,
+        gc_gms_promote_pmc(interp, self, &((pmc_alloc_struct *)ptr)->pmc););
+
+    POINTER_ARRAY_ITER(self->old_strings,
+        STRING *s = &((string_alloc_struct *)ptr)->str;
+        self->old_size += sizeof (STRING) + Buffer_buflen(s););
+
+    Parrot_pa_destroy(interp, self->old_objects);
+    self->old_objects = self->new_objects;
+    self->new_objects = NULL;
+
+    gc_gms_remember_stack_objects(interp, self);
+
+    self->major_threshold = 2 * self->old_size;
+    if (self->major_threshold < self->min_major_threshold)
+        self->major_threshold = self->min_major_threshold;
+
+    gc_gms_finish_collection(interp, self);
+
+    gc_gms_compact_memory_pool(interp);
+}
+
+
+/*
+
+=item C<static void gc_gms_verify_remembered(PARROT_INTERP, Generational_GC
+*self)>
+
+Marks the children of the old PMCs out of the remembered set after the mark
+phase of a minor collection, and reports the young objects left unmarked.  The
+old PMCs pointing to them were stored into without write barrier.
+
+=item C<static void gc_gms_report_young(PARROT_INTERP, Generational_GC *self,
+PObj *obj)>
+
+Reports the unmarked young C<obj> found by C<gc_gms_verify_remembered>.
+
+=cut
+
+*/
+
+static void
+gc_gms_verify_remembered(PARROT_INTERP, ARGIN(Generational_GC *self))
+{
+    ASSERT_ARGS(gc_gms_verify_remembered)
+    int missed = 0;
+
+    /* Core code marks strings live without calling the GC, so flag the dead
+     * young strings first */
+    POINTER_ARRAY_ITER(self->young_strings,
+        STRING *s = &((string_alloc_struct *)ptr)->str;
+        if (!PObj_live_TEST(s) && !PObj_constant_TEST(s))
+            PObj_GC_remembered_SET(s););
+
+    POINTER_ARRAY_ITER(self->old_objects,
+        PMC *pmc = &((pmc_alloc_struct *)ptr)->pmc;
+        if (!PObj_GC_remembered_TEST(pmc)) {
+            self->verifying = pmc;
+            gc_gms_mark_children(interp, pmc);
+        });
+
+    POINTER_ARRAY_ITER(self->young_strings,
+        STRING *s = &((string_alloc_struct *)ptr)->str;
+        if (PObj_GC_remembered_TEST(s) && PObj_live_TEST(s)) {
+            PObj_live_CLEAR(s);
+            missed = 1;
+        });
+
+    /* Find the PMCs pointing to the strings marked again, one by one */
+    if (missed)
+        POINTER_ARRAY_ITER(self->old_objects,
+            PMC *pmc = &((pmc_alloc_struct *)ptr)->pmc;
+            if (!PObj_GC_remembered_TEST(pmc)) {
+                self->verifying = pmc;
+                gc_gms_mark_children(interp, pmc);
+
+                POINTER_ARRAY_ITER(self->young_strings,
+                    STRING *s = &((string_alloc_struct *)ptr)->str;
+                    if (PObj_GC_remembered_TEST(s) && PObj_live_TEST(s)) {
+                        gc_gms_report_young(interp, self, (PObj *)s);
+                        PObj_live_CLEAR(s);
+                    });
+            });
+
+    POINTER_ARRAY_ITER(self->young_strings,
+        PObj_GC_remembered_CLEAR(&((string_alloc_struct *)ptr)->str););
+
+    self->verifying = NULL;
+}
+
+
+static void
+gc_gms_report_young(SHIM_INTERP, ARGIN(Generational_GC *self), ARGIN(PObj *obj))
+{
+    ASSERT_ARGS(gc_gms_report_young)
+    PMC * const pmc = self->verifying;
+
+    fprintf(stderr, "gc_gms: %s %p points to young %s %p without write barrier\n",
+            pmc->vtable->whoami->strstart, (void *)pmc,
+            PObj_is_PMC_TEST(obj)
+                ? ((PMC *)obj)->vtable->whoami->strstart : "STRING",
+            (void *)obj);
+}
+
+
+/*
+
+=item C<static void gc_gms_promote_pmc(PARROT_INTERP, Generational_GC *self, PMC
+*pmc)>
+
+Makes the live C<pmc> old, and remembers it for good if its class has no write
+barriers.
+
+=cut
+
+*/
+
+static void
+gc_gms_promote_pmc(PARROT_INTERP, ARGIN(Generational_GC *self), ARGMOD(PMC *pmc))
+{
+    ASSERT_ARGS(gc_gms_promote_pmc)
+
+    PObj_GC_old_SET(pmc);
+    PObj_GC_remembered_CLEAR(pmc);
+
+    if (PMC_has_no_wb(pmc)) {
+        PObj_GC_remembered_SET(pmc);
+        Parrot_pa_insert(interp, self->remembered, pmc);
+    }
+
+    self->old_size += sizeof (PMC) + pmc->vtable->attr_size;
+}
+
+
+/*
+
+=item C<static void gc_gms_finish_collection(PARROT_INTERP, Generational_GC
+*self)>
+
+Resets the statistics and the nursery after a collection.
+
+=cut
+
+*/
+
+static void
+gc_gms_finish_collection(PARROT_INTERP, ARGIN(Generational_GC *self))
+{
+    ASSERT_ARGS(gc_gms_finish_collection)
+
+    /* We swept all dead objects */
+    self->num_early_gc_PMCs                                = 0;
+    self->young_size                                       = 0;
+    interp->gc_sys->stats.mem_used_last_collect            = 0;
+    interp->gc_sys->stats.header_allocs_since_last_collect = 0;
+    interp->gc_sys->stats.gc_mark_runs++;
+
+    self->gc_mark_block_level--;
+    self->collecting = 0;
+    self->major      = 0;
+}
+
+
+/*
+
+=item C<static void gc_gms_sweep_pmc_pool(PARROT_INTERP, Generational_GC *self,
+Parrot_Pointer_Array *list)>
+
+Helper function to sweep a list of PMCs which weren't marked.  Constants are
+dropped from the list.
+
+=cut
+
+*/
+
+static void
+gc_gms_sweep_pmc_pool(PARROT_INTERP,
+        ARGIN(Generational_GC *self),
+        ARGIN(Parrot_Pointer_Array *list))
+{
+    ASSERT_ARGS(gc_gms_sweep_pmc_pool)
+
+    POINTER_ARRAY_ITER(list,
+        pmc_alloc_struct *item = (pmc_alloc_struct *)ptr;
+        PMC              *pmc  = &item->pmc;
+
+        if (PObj_constant_TEST(pmc)) {
+            PObj_live_CLEAR(pmc);
+            Parrot_pa_remove(interp, list, item->ptr);
+            item->ptr = NULL;
+        }
+
+        /* Paint live objects white */
+        else if (PObj_live_TEST(pmc))
+            PObj_live_CLEAR(pmc);
+
+        else {
+            Parrot_pa_remove(interp, list, item->ptr);
+
+            /* this is manual inlining of Parrot_pmc_destroy() */
+            if (PObj_custom_destroy_TEST(pmc))
+                VTABLE_destroy(interp, pmc);
+
+            if (pmc->vtable->attr_size && PMC_data(pmc))
+                Parrot_gc_free_pmc_attributes(interp, pmc);
+            PMC_data(pmc) = NULL;
+
+            PObj_on_free_list_SET(pmc);
+            PObj_gc_CLEAR(pmc);
+            PObj_GC_generation_CLEARALL(pmc);
+
+            Parrot_gc_pool_free(interp, self->pmc_allocator, ptr);
+        });
+}
+
+
+/*
+
+=item C<static void gc_gms_destroy_pmc_pool(PARROT_INTERP, Pool_Allocator *pool,
+Parrot_Pointer_Array *list)>
+
+Helper function to perform final destruction of root set PMCs.
+
+=cut
+
+*/
+
+static void
+gc_gms_destroy_pmc_pool(PARROT_INTERP,
+        ARGIN(Pool_Allocator *pool),
+        ARGIN(Parrot_Pointer_Array *list))
+{
+    ASSERT_ARGS(gc_gms_destroy_pmc_pool)
+
+    POINTER_ARRAY_ITER(list,
+        PMC *pmc = &(((pmc_alloc_struct*)ptr)->pmc);
+        Parrot_pa_remove(interp, list, PMC2PAC(pmc)->ptr);
+
+        Parrot_pmc_destroy(interp, pmc);
+        PObj_on_free_list_SET(pmc);
+
+        Parrot_gc_pool_free(interp, pool, ptr););
+}
+
+
+/*
+
+=item C<static void gc_gms_sweep_string_pool(PARROT_INTERP, Generational_GC
+*self, Parrot_Pointer_Array *list)>
+
+Helper function to sweep a list of STRINGs.  Dead ones are freed, live young
+ones are promoted and constants are dropped from the list.
+
+=cut
+
+*/
+
+static void
+gc_gms_sweep_string_pool(PARROT_INTERP,
+        ARGIN(Generational_GC *self),
+        ARGIN(Parrot_Pointer_Array *list))
+{
+    ASSERT_ARGS(gc_gms_sweep_string_pool)
+
+    POINTER_ARRAY_ITER(list,
+        string_alloc_struct *item = (string_alloc_struct *)ptr;
+        STRING              *obj  = &item->str;
+
+        PARROT_ASSERT(!PObj_on_free_list_TEST(obj));
+
+        if (PObj_constant_TEST(obj)) {
+            PObj_live_CLEAR(obj);
+            Parrot_pa_remove(interp, list, item->ptr);
+            item->ptr = NULL;
+        }
+
+        /* Promote live young strings. Old ones stay live */
+        else if (PObj_live_TEST(obj)) {
+            if (!PObj_GC_old_TEST(obj)) {
+                Parrot_pa_remove(interp, list, item->ptr);
+                item->ptr = Parrot_pa_insert(interp, self->old_strings, item);
+                PObj_GC_old_SET(obj);
+                self->old_size += sizeof (STRING) + Buffer_buflen(obj);
+            }
+        }
+
+        else {
+            Parrot_pa_remove(interp, list, item->ptr);
+            if (Buffer_bufstart(obj) && !PObj_external_TEST(obj))
+                Parrot_gc_str_free_buffer_storage(interp, &self->string_gc, (Buffer*)obj);
+
+            PObj_on_free_list_SET(obj);
+            PObj_GC_generation_CLEARALL(obj);
+
+            Parrot_gc_pool_free(interp, self->string_allocator, ptr);
+        });
+}
+
+
+/*
+
+=item C<static int gc_gms_is_ptr_owned(PARROT_INTERP, void *ptr, Pool_Allocator
+*pool, Parrot_Pointer_Array *young, Parrot_Pointer_Array *old)>
+
+Helper function to check that we own PObj
+
+=cut
+
+*/
+
+static int
+gc_gms_is_ptr_owned(PARROT_INTERP,
+        ARGIN_NULLOK(void *ptr),
+        ARGIN(Pool_Allocator *pool),
+        ARGIN(Parrot_Pointer_Array *young),
+        ARGIN(Parrot_Pointer_Array *old))
+{
+    ASSERT_ARGS(gc_gms_is_ptr_owned)
+    PObj             *obj  = (PObj *)ptr;
+    pmc_alloc_struct *item = PMC2PAC(ptr);
+
+    if (!obj || !item)
+        return 0;
+
+    if (!Parrot_gc_pool_is_owned(interp, pool, item))
+        return 0;
+
+    /* black or white objects marked already. Old ones, unless the
+     * collection is a major one. */
+    if (PObj_is_live_or_free_TESTALL(obj))
+        return 0;
+
+    /* Pool.is_owned isn't precise enough (yet) */
+    return Parrot_pa_is_owned(interp, PObj_GC_old_TEST(obj) ? old : young,
+            item, item->ptr);
+}
+
+
+/*
+
+=item C<static void gc_gms_block_GC_mark(PARROT_INTERP)>
+
+Blocks the GC from performing its mark phase.
+
+=item C<static void gc_gms_unblock_GC_mark(PARROT_INTERP)>
+
+Unblocks the GC mark.
+
+=item C<static void gc_gms_block_GC_sweep(PARROT_INTERP)>
+
+Blocks the GC from performing its sweep phase.
+
+=item C<static void gc_gms_unblock_GC_sweep(PARROT_INTERP)>
+
+Unblocks GC sweep.
+
+=item C<static unsigned int gc_gms_is_blocked_GC_mark(PARROT_INTERP)>
+
+Determines if the GC mark is currently blocked.
+
+=item C<static unsigned int gc_gms_is_blocked_GC_sweep(PARROT_INTERP)>
+
+Determines if the GC sweep is currently blocked.
+
+=cut
+
+*/
+
+static void
+gc_gms_block_GC_mark(PARROT_INTERP)
+{
+    ASSERT_ARGS(gc_gms_block_GC_mark)
+    Generational_GC *self = (Generational_GC *)interp->gc_sys->gc_private;
+    ++self->gc_mark_block_level;
+    Parrot_shared_gc_block(interp);
+}
+
+
+static void
+gc_gms_unblock_GC_mark(PARROT_INTERP)
+{
+    ASSERT_ARGS(gc_gms_unblock_GC_mark)
+    Generational_GC *self = (Generational_GC *)interp->gc_sys->gc_private;
+    if (self->gc_mark_block_level) {
+        --self->gc_mark_block_level;
+        Parrot_shared_gc_unblock(interp);
+    }
+}
+
+
+static void
+gc_gms_block_GC_sweep(PARROT_INTERP)
+{
+    ASSERT_ARGS(gc_gms_block_GC_sweep)
+    Generational_GC *self = (Generational_GC *)interp->gc_sys->gc_private;
+    ++self->gc_sweep_block_level;
+}
+
+
+static void
+gc_gms_unblock_GC_sweep(PARROT_INTERP)
+{
+    ASSERT_ARGS(gc_gms_unblock_GC_sweep)
+    Generational_GC *self = (Generational_GC *)interp->gc_sys->gc_private;
+    if (self->gc_sweep_block_level)
+        --self->gc_sweep_block_level;
+}
+
+
+static unsigned int
+gc_gms_is_blocked_GC_mark(PARROT_INTERP)
+{
+    ASSERT_ARGS(gc_gms_is_blocked_GC_mark)
+    Generational_GC *self = (Generational_GC *)interp->gc_sys->gc_private;
+    return self->gc_mark_block_level;
+}
+
+
+static unsigned int
+gc_gms_is_blocked_GC_sweep(PARROT_INTERP)
+{
+    ASSERT_ARGS(gc_gms_is_blocked_GC_sweep)
+    Generational_GC *self = (Generational_GC *)interp->gc_sys->gc_private;
+    return self->gc_sweep_block_level;
+}
+
+
+/*
+
+=item C<static void * gc_gms_allocate_memory_chunk(PARROT_INTERP, size_t size)>
+
+=item C<static void * gc_gms_reallocate_memory_chunk(PARROT_INTERP, void *from,
+size_t size)>
+
+=item C<static void * gc_gms_allocate_memory_chunk_zeroed(PARROT_INTERP, size_t
+size)>
+
+=item C<static void * gc_gms_reallocate_memory_chunk_zeroed(PARROT_INTERP, void
+*data, size_t newsize, size_t oldsize)>
+
+=item C<static void gc_gms_free_memory_chunk(PARROT_INTERP, void *data)>
+
+=item C<static void failed_allocation(unsigned int line, unsigned long size)>
+
+Functions for allocating memory from the system, and for panicking if that
+fails.
+
+=cut
+
+*/
+
+PARROT_MALLOC
+PARROT_CAN_RETURN_NULL
+static void *
+gc_gms_allocate_memory_chunk(SHIM_INTERP, size_t size)
+{
+    ASSERT_ARGS(gc_gms_allocate_memory_chunk)
+    void * const ptr = malloc(size);
+    if (!ptr && size)
+        PANIC_OUT_OF_MEM(size);
+    return ptr;
+}
+
+
+PARROT_MALLOC
+PARROT_CAN_RETURN_NULL
+static void *
+gc_gms_reallocate_memory_chunk(SHIM_INTERP, ARGFREE(void *from), size_t size)
+{
+    ASSERT_ARGS(gc_gms_reallocate_memory_chunk)
+    void *ptr;
+    if (from)
+        ptr = realloc(from, size);
+    else
+        ptr = calloc(1, size);
+    if (!ptr && size)
+        PANIC_OUT_OF_MEM(size);
+    return ptr;
+}
+
+
+PARROT_MALLOC
+PARROT_CAN_RETURN_NULL
+static void *
+gc_gms_allocate_memory_chunk_zeroed(SHIM_INTERP, size_t size)
+{
+    ASSERT_ARGS(gc_gms_allocate_memory_chunk_zeroed)
+    void * const ptr = calloc(1, (size_t)size);
+    if (!ptr && size)
+        PANIC_OUT_OF_MEM(size);
+    return ptr;
+}
+
+
+PARROT_MALLOC
+PARROT_CANNOT_RETURN_NULL
+static void *
+gc_gms_reallocate_memory_chunk_zeroed(SHIM_INTERP, ARGFREE(void *data),
+        size_t newsize, size_t oldsize)
+{
+    ASSERT_ARGS(gc_gms_reallocate_memory_chunk_zeroed)
+    void * const ptr = realloc(data, newsize);
+    if (newsize > oldsize)
+        memset((char*)ptr + oldsize, 0, newsize - oldsize);
+    return ptr;
+}
+
+
+static void
+gc_gms_free_memory_chunk(SHIM_INTERP, ARGFREE(void *data))
+{
+    ASSERT_ARGS(gc_gms_free_memory_chunk)
+    if (data)
+        free(data);
+}
+
+
+PARROT_DOES_NOT_RETURN
+static void
+failed_allocation(unsigned int line, unsigned long size)
+{
+    ASSERT_ARGS(failed_allocation)
+    fprintf(stderr, "Failed allocation of %lu bytes\n", size);
+    do_panic(NULL, "Out of mem", __FILE__, line);
+}
+
+
+/*
+
+=item C<static void gc_gms_pmc_needs_early_collection(PARROT_INTERP, PMC *pmc)>
+
+Marks a PMC as needing timely destruction.
+
+=cut
+
+*/
+
+static void
+gc_gms_pmc_needs_early_collection(PARROT_INTERP, SHIM(PMC *pmc))
+{
+    ASSERT_ARGS(gc_gms_pmc_needs_early_collection)
+    Generational_GC *self = (Generational_GC *)interp->gc_sys->gc_private;
+    ++self->num_early_gc_PMCs;
+}
+
+/*
+
+=back
+
+=head1 SEE ALSO
+
+F<src/gc/gc_ms2.c>, F<include/parrot/pobj.h>
+
+=cut
+
+*/
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
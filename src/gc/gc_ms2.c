@@ -7,6 +7,42 @@ src/gc/gc_ms2.c - Non-recursive M&S
 
 =head1 DESCRIPTION
 
+A collection runs once the memory allocated since the last one exceeds a
+threshold.  With a GC overhead target (C<--gc-overhead>, 5% by default), each
+run adapts the threshold so that marking takes about the target share of the
+run time, between C<GC_MS2_MIN_THRESHOLD> and the maximum threshold
+(C<--gc-max-threshold>, or an eighth of the system memory).  Without one the
+threshold is the maximum.
+
+With a maximum pause set (C<--gc-max-pause>), marking is incremental: once
+the threshold is reached, every allocation of C<GC_MS2_SLICE_SIZE> bytes runs
+a marking slice which stops when it used up the pause.  Marked PMCs whose
+children are marked too are black, painted with C<PObj_GC_old_FLAG>, so that
+stores into them hit the write barrier, which turns them gray again.  PMCs of
+C<no_wb> classes and PMCs found on the system stack are traced again right
+before sweeping, together with the roots.  Objects allocated while marking
+are white.
+
+With several marking threads (C<--gc-mark-threads>), a full mark of a heap of
+at least C<GC_MS2_PARALLEL_MIN> PMCs marks the children of the PMCs the roots
+reached on all the threads.  The threads steal gray PMCs from each other.
+Only classes declared C<parallel_mark> mark on any thread.  Marking sets the
+live flag without locking, so two threads can mark the same PMC, which only
+wastes a bit of work.
+
+Collections started by the allocators sweep lazily.  The dead PMCs and STRINGs
+stay in lists of their own, and are swept one chunk at a time whenever the
+allocator of their kind runs out of free headers.  Each chunk of dead PMCs
+also paints a share of the survivors white.  STRING storage is compacted once
+all STRINGs are swept.  Explicit collections, and the next collection, sweep
+whatever is left at once.
+
+Compacting the memory pools, as the C<collect> op does, also evacuates the
+attributes of non-constant PMCs out of arenas no more than half full, and
+frees those arenas.  Arenas the system stack points into are pinned, as are
+the attributes of PMCs with C<PObj_external_FLAG> set, for NCI code holding
+on to them.
+
 =cut
 
 */
@@ -37,10 +73,64 @@ typedef struct string_alloc_struct {
 /* Maybe M&S. Depends on total allocated memory, memory allocated since last
 alloc, and phase of the Moon. */
 #define MAYBE_MARK_AND_SWEEP(interp, self) { \
-    if ((interp)->gc_sys->stats.mem_used_last_collect > (self)->gc_threshold) \
-        gc_ms2_mark_and_sweep((interp), 0); \
+    if ((interp)->gc_sys->stats.mem_used_last_collect > (self)->gc_threshold) { \
+        if ((self)->max_pause) \
+            gc_ms2_mark_slice((interp), (self)); \
+        else \
+            gc_ms2_mark_and_sweep((interp), GC_MS2_LAZY_SWEEP_FLAG); \
+    } \
     }
 
+/* Run triggered by allocation: sweep as the allocators run out of headers */
+#define GC_MS2_LAZY_SWEEP_FLAG (UINTVAL)(1 << 8)
+
+/* Memory allocated between two incremental marking slices */
+#define GC_MS2_SLICE_SIZE (256 * 1024)
+
+/* Number of PMCs a marking slice traces between two looks at the clock */
+#define GC_MS2_SLICE_CHECK 64
+
+/* Number of PMC headers from which marking runs in parallel */
+#define GC_MS2_PARALLEL_MIN (128 * 1024)
+
+/* Number of gray PMCs a marking thread keeps before sharing the rest */
+#define GC_MS2_SHARE_MIN 256
+
+/* Adaptive threshold. Bounds and start of gc_threshold */
+#define GC_MS2_MIN_THRESHOLD     (1024 * 1024)
+#define GC_MS2_INITIAL_THRESHOLD (8 * 1024 * 1024)
+
+/* Factors gc_threshold grows or shrinks by at most in one run */
+#define GC_MS2_MAX_GROWTH 4.0
+#define GC_MS2_MAX_SHRINK 0.5
+
+/* Percentage of PMCs surviving a run from which gc_threshold doesn't shrink:
+   collecting more often would hardly free memory */
+#define GC_MS2_HIGH_SURVIVAL 90
+
+/* Stack of PMCs */
+typedef struct MarkSweep_Stack {
+    PMC    **items;
+    size_t   size;
+    size_t   alloced;
+} MarkSweep_Stack;
+
+/* Thread of the parallel mark */
+typedef struct MarkSweep_Worker {
+    struct MarkSweep_GC *gc;
+    Interp              *interp;
+    Parrot_thread        thread;
+    size_t               id;
+
+    /* Gray PMCs only this thread uses */
+    MarkSweep_Stack      gray;
+    /* Gray PMCs other threads can steal, guarded by lock */
+    MarkSweep_Stack      shared;
+    Parrot_mutex         lock;
+    /* Gray PMCs which mark themselves on the interpreter's thread only */
+    MarkSweep_Stack      deferred;
+} MarkSweep_Worker;
+
 /* Private information */
 typedef struct MarkSweep_GC {
     /* Allocator for PMC headers */
@@ -57,12 +147,27 @@ typedef struct MarkSweep_GC {
     /* Fixed-size allocator */
     struct Fixed_Allocator *fixed_size_allocator;
 
+    /* Allocator for attributes of non-constant PMCs, which get evacuated.
+       Constant PMCs are in no list after a run, so their attributes come
+       from fixed_size_allocator */
+    struct Fixed_Allocator *attrib_allocator;
+
     /* String GC */
     struct String_GC        string_gc;
 
     /* Number of allocated objects before trigger gc */
     size_t gc_threshold;
 
+    /* Bound of gc_threshold, unless the interpreter sets one */
+    size_t      max_threshold;
+    /* Timer ticks spent marking since gc_threshold was last adapted, and the
+       time of that */
+    UHUGEINTVAL mark_ticks;
+    UHUGEINTVAL last_adapt;
+
+    /* Timer ticks and counts of the run being done, recorded once swept */
+    GC_Event    event;
+
     /* GC blocking */
     UINTVAL gc_mark_block_level;  /* How many outstanding GC block
                                      requests are there? */
@@ -71,6 +176,52 @@ typedef struct MarkSweep_GC {
 
     UINTVAL num_early_gc_PMCs;    /* how many PMCs want immediate destruction */
 
+    /* Incremental marking. Pause of a marking slice in timer ticks, or 0 to
+       mark everything at once */
+    UHUGEINTVAL max_pause;
+    /* A marking cycle is running */
+    int         marking;
+    /* Run the next marking slice once this much memory is used */
+    size_t      next_slice;
+
+    /* Marked PMCs with children to mark */
+    MarkSweep_Stack gray;
+
+    /* PMCs to trace again before sweeping */
+    struct Parrot_Pointer_Array    *rescan;
+    /* Remember the live PMCs found while tracing the system stack */
+    int         tracing_stack;
+
+    /* Pin the attribute arenas the system stack points into */
+    int         pinning;
+
+    /* Lazy sweeping. Dead and constant PMCs of the last run, or NULL once
+       swept */
+    struct Parrot_Pointer_Array    *dead_objects;
+    size_t      dead_chunk;
+    /* Chunks of objects with live PMCs to paint white */
+    size_t      live_chunk;
+    size_t      live_chunks;
+    /* Chunks of objects painted per chunk of dead_objects */
+    size_t      live_chunks_per_step;
+    /* STRINGs of the last run, or NULL once swept. Live ones move to
+       strings */
+    struct Parrot_Pointer_Array    *dead_strings;
+    size_t      dead_string_chunk;
+
+    /* Parallel marking. Number of marking threads, or 0 to mark on the
+       interpreter's thread only */
+    size_t             mark_threads;
+    MarkSweep_Worker  *workers;
+    /* Workers are marking */
+    int                parallel_marking;
+    /* Worker of the running thread */
+    Parrot_thread_key  worker_key;
+    /* Guards idle_workers. Idle workers wait for work_cond */
+    Parrot_mutex       mark_lock;
+    Parrot_cond        work_cond;
+    size_t             idle_workers;
+
 } MarkSweep_GC;
 
 /* HEADERIZER HFILE: src/gc/gc_private.h */
@@ -81,6 +232,13 @@ typedef struct MarkSweep_GC {
 PARROT_DOES_NOT_RETURN
 static void failed_allocation(unsigned int line, unsigned long size);
 
+static void gc_ms2_adapt_threshold(PARROT_INTERP,
+    ARGIN(MarkSweep_GC *self),
+    size_t live,
+    size_t dead)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
 PARROT_MALLOC
 PARROT_CAN_RETURN_NULL
 static Buffer* gc_ms2_allocate_buffer_header(PARROT_INTERP,
@@ -138,6 +296,16 @@ static void gc_ms2_block_GC_sweep(PARROT_INTERP)
 static void gc_ms2_compact_memory_pool(PARROT_INTERP)
         __attribute__nonnull__(1);
 
+static void gc_ms2_compact_string_pool(PARROT_INTERP,
+    ARGIN(MarkSweep_GC *self))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_PURE_FUNCTION
+static size_t gc_ms2_count_objects(ARGIN(const Parrot_Pointer_Array *list))
+        __attribute__nonnull__(1);
+
 static void gc_ms2_destroy_pmc_pool(PARROT_INTERP,
     ARGIN(Pool_Allocator *pool),
     ARGIN(Parrot_Pointer_Array *list))
@@ -145,9 +313,30 @@ static void gc_ms2_destroy_pmc_pool(PARROT_INTERP,
         __attribute__nonnull__(2)
         __attribute__nonnull__(3);
 
+static void gc_ms2_destroy_workers(ARGMOD(MarkSweep_GC *self))
+        __attribute__nonnull__(1)
+        FUNC_MODIFIES(*self);
+
+static void gc_ms2_end_run(PARROT_INTERP, ARGIN(MarkSweep_GC *self))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+static void gc_ms2_evacuate_attributes(PARROT_INTERP,
+    ARGIN(MarkSweep_GC *self))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
 static void gc_ms2_finalize(PARROT_INTERP)
         __attribute__nonnull__(1);
 
+static void gc_ms2_finish_marking(PARROT_INTERP, ARGIN(MarkSweep_GC *self))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+static void gc_ms2_finish_sweep(PARROT_INTERP, ARGIN(MarkSweep_GC *self))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
 static void gc_ms2_free_buffer_header(PARROT_INTERP,
     ARGFREE(Buffer *s),
     SHIM(size_t size))
@@ -175,12 +364,26 @@ static void gc_ms2_free_string_header(PARROT_INTERP, ARGFREE(STRING *s))
 static size_t gc_ms2_get_gc_info(PARROT_INTERP, Interpinfo_enum which)
         __attribute__nonnull__(1);
 
+static void gc_ms2_grow_stack(ARGMOD(MarkSweep_Stack *stack), size_t count)
+        __attribute__nonnull__(1)
+        FUNC_MODIFIES(*stack);
+
+static void gc_ms2_init_workers(ARGMOD(MarkSweep_GC *self))
+        __attribute__nonnull__(1)
+        FUNC_MODIFIES(*self);
+
 static unsigned int gc_ms2_is_blocked_GC_mark(PARROT_INTERP)
         __attribute__nonnull__(1);
 
 static unsigned int gc_ms2_is_blocked_GC_sweep(PARROT_INTERP)
         __attribute__nonnull__(1);
 
+static int gc_ms2_is_live_pmc(PARROT_INTERP,
+    ARGIN(MarkSweep_GC *self),
+    ARGIN_NULLOK(void *ptr))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
 static int gc_ms2_is_pmc_ptr(PARROT_INTERP, ARGIN_NULLOK(void *ptr))
         __attribute__nonnull__(1);
 
@@ -203,12 +406,22 @@ static void gc_ms2_iterate_live_strings(PARROT_INTERP,
 static void gc_ms2_mark_and_sweep(PARROT_INTERP, UINTVAL flags)
         __attribute__nonnull__(1);
 
+static int gc_ms2_mark_gray(PARROT_INTERP,
+    ARGIN(MarkSweep_GC *self),
+    UHUGEINTVAL deadline)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
 static void gc_ms2_mark_live_objects(PARROT_INTERP,
     ARGIN(MarkSweep_GC *self),
     UINTVAL flags)
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
+static void gc_ms2_mark_parallel(PARROT_INTERP, ARGIN(MarkSweep_GC *self))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
 static void gc_ms2_mark_pmc_header(PARROT_INTERP, ARGIN(PMC *pmc))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
@@ -216,12 +429,42 @@ static void gc_ms2_mark_pmc_header(PARROT_INTERP, ARGIN(PMC *pmc))
 static void gc_ms2_mark_pobj_header(PARROT_INTERP, ARGIN_NULLOK(PObj * obj))
         __attribute__nonnull__(1);
 
+static void gc_ms2_mark_slice(PARROT_INTERP, ARGIN(MarkSweep_GC *self))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+PARROT_CAN_RETURN_NULL
+static void * gc_ms2_mark_worker(ARGMOD(void *data))
+        __attribute__nonnull__(1)
+        FUNC_MODIFIES(*data);
+
+static void gc_ms2_move_attributes(PARROT_INTERP,
+    ARGIN(MarkSweep_GC *self),
+    ARGIN(Parrot_Pointer_Array *list))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
+static void gc_ms2_pin_attributes(PARROT_INTERP,
+    ARGIN(MarkSweep_GC *self),
+    ARGIN(Parrot_Pointer_Array *list))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
 static void gc_ms2_pmc_needs_early_collection(PARROT_INTERP,
     ARGMOD(PMC *pmc))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2)
         FUNC_MODIFIES(*pmc);
 
+static void gc_ms2_push_gray(
+    ARGMOD(MarkSweep_Stack *stack),
+    ARGIN(PMC *pmc))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*stack);
+
 static void gc_ms2_reallocate_buffer_storage(PARROT_INTERP,
     ARGIN(Buffer *str),
     size_t size)
@@ -247,6 +490,64 @@ static void gc_ms2_reallocate_string_storage(PARROT_INTERP,
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
+static void gc_ms2_remember(PARROT_INTERP,
+    ARGIN(MarkSweep_GC *self),
+    ARGIN(PMC *pmc))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
+static void gc_ms2_share_gray(
+    ARGMOD(MarkSweep_GC *self),
+    ARGMOD(MarkSweep_Worker *worker))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*self)
+        FUNC_MODIFIES(*worker);
+
+static void gc_ms2_start_lazy_sweep(PARROT_INTERP,
+    ARGIN(MarkSweep_GC *self))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+static void gc_ms2_start_marking(PARROT_INTERP, ARGIN(MarkSweep_GC *self))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+static int gc_ms2_steal_gray(
+    ARGMOD(MarkSweep_GC *self),
+    ARGMOD(MarkSweep_Worker *worker))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*self)
+        FUNC_MODIFIES(*worker);
+
+static void gc_ms2_sweep_dead_pmc(PARROT_INTERP,
+    ARGIN(Pool_Allocator *pool),
+    ARGIN(Parrot_Pointer_Array *list),
+    ARGIN(PMC *pmc))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4);
+
+static void gc_ms2_sweep_dead_string(PARROT_INTERP,
+    ARGIN(Pool_Allocator *pool),
+    ARGIN(Parrot_Pointer_Array *list),
+    ARGIN(STRING *str))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4);
+
+static void gc_ms2_sweep_lazily(PARROT_INTERP, ARGIN(MarkSweep_GC *self))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+static void gc_ms2_sweep_pmc_chunk(PARROT_INTERP, ARGIN(MarkSweep_GC *self))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
 static void gc_ms2_sweep_pmc_pool(PARROT_INTERP,
     ARGIN(Pool_Allocator *pool),
     ARGIN(Parrot_Pointer_Array *list))
@@ -254,6 +555,11 @@ static void gc_ms2_sweep_pmc_pool(PARROT_INTERP,
         __attribute__nonnull__(2)
         __attribute__nonnull__(3);
 
+static int gc_ms2_sweep_string_chunk(PARROT_INTERP,
+    ARGIN(MarkSweep_GC *self))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
 static void gc_ms2_sweep_string_pool(PARROT_INTERP,
     ARGIN(Pool_Allocator *pool),
     ARGIN(Parrot_Pointer_Array *list))
@@ -261,13 +567,28 @@ static void gc_ms2_sweep_string_pool(PARROT_INTERP,
         __attribute__nonnull__(2)
         __attribute__nonnull__(3);
 
+static int gc_ms2_take_gray(
+    ARGMOD(MarkSweep_Worker *thief),
+    ARGMOD(MarkSweep_Worker *victim))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*thief)
+        FUNC_MODIFIES(*victim);
+
 static void gc_ms2_unblock_GC_mark(PARROT_INTERP)
         __attribute__nonnull__(1);
 
 static void gc_ms2_unblock_GC_sweep(PARROT_INTERP)
         __attribute__nonnull__(1);
 
+static void gc_ms2_write_barrier(PARROT_INTERP, ARGIN(PMC *pmc))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
 #define ASSERT_ARGS_failed_allocation __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
+#define ASSERT_ARGS_gc_ms2_adapt_threshold __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self))
 #define ASSERT_ARGS_gc_ms2_allocate_buffer_header __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_gc_ms2_allocate_buffer_storage \
@@ -298,12 +619,31 @@ static void gc_ms2_unblock_GC_sweep(PARROT_INTERP)
        PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_gc_ms2_compact_memory_pool __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_gc_ms2_compact_string_pool __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self))
+#define ASSERT_ARGS_gc_ms2_count_objects __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(list))
 #define ASSERT_ARGS_gc_ms2_destroy_pmc_pool __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(pool) \
     , PARROT_ASSERT_ARG(list))
+#define ASSERT_ARGS_gc_ms2_destroy_workers __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(self))
+#define ASSERT_ARGS_gc_ms2_end_run __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self))
+#define ASSERT_ARGS_gc_ms2_evacuate_attributes __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self))
 #define ASSERT_ARGS_gc_ms2_finalize __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_gc_ms2_finish_marking __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self))
+#define ASSERT_ARGS_gc_ms2_finish_sweep __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self))
 #define ASSERT_ARGS_gc_ms2_free_buffer_header __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_gc_ms2_free_fixed_size_storage \
@@ -320,10 +660,17 @@ static void gc_ms2_unblock_GC_sweep(PARROT_INTERP)
        PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_gc_ms2_get_gc_info __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_gc_ms2_grow_stack __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(stack))
+#define ASSERT_ARGS_gc_ms2_init_workers __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(self))
 #define ASSERT_ARGS_gc_ms2_is_blocked_GC_mark __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_gc_ms2_is_blocked_GC_sweep __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_gc_ms2_is_live_pmc __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self))
 #define ASSERT_ARGS_gc_ms2_is_pmc_ptr __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_gc_ms2_is_ptr_owned __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
@@ -336,18 +683,40 @@ static void gc_ms2_unblock_GC_sweep(PARROT_INTERP)
        PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_gc_ms2_mark_and_sweep __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_gc_ms2_mark_gray __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self))
 #define ASSERT_ARGS_gc_ms2_mark_live_objects __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(self))
+#define ASSERT_ARGS_gc_ms2_mark_parallel __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self))
 #define ASSERT_ARGS_gc_ms2_mark_pmc_header __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(pmc))
 #define ASSERT_ARGS_gc_ms2_mark_pobj_header __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_gc_ms2_mark_slice __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self))
+#define ASSERT_ARGS_gc_ms2_mark_worker __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(data))
+#define ASSERT_ARGS_gc_ms2_move_attributes __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self) \
+    , PARROT_ASSERT_ARG(list))
+#define ASSERT_ARGS_gc_ms2_pin_attributes __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self) \
+    , PARROT_ASSERT_ARG(list))
 #define ASSERT_ARGS_gc_ms2_pmc_needs_early_collection \
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(pmc))
+#define ASSERT_ARGS_gc_ms2_push_gray __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(stack) \
+    , PARROT_ASSERT_ARG(pmc))
 #define ASSERT_ARGS_gc_ms2_reallocate_buffer_storage \
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
@@ -360,18 +729,59 @@ static void gc_ms2_unblock_GC_sweep(PARROT_INTERP)
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(str))
+#define ASSERT_ARGS_gc_ms2_remember __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self) \
+    , PARROT_ASSERT_ARG(pmc))
+#define ASSERT_ARGS_gc_ms2_share_gray __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(self) \
+    , PARROT_ASSERT_ARG(worker))
+#define ASSERT_ARGS_gc_ms2_start_lazy_sweep __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self))
+#define ASSERT_ARGS_gc_ms2_start_marking __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self))
+#define ASSERT_ARGS_gc_ms2_steal_gray __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(self) \
+    , PARROT_ASSERT_ARG(worker))
+#define ASSERT_ARGS_gc_ms2_sweep_dead_pmc __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pool) \
+    , PARROT_ASSERT_ARG(list) \
+    , PARROT_ASSERT_ARG(pmc))
+#define ASSERT_ARGS_gc_ms2_sweep_dead_string __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pool) \
+    , PARROT_ASSERT_ARG(list) \
+    , PARROT_ASSERT_ARG(str))
+#define ASSERT_ARGS_gc_ms2_sweep_lazily __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self))
+#define ASSERT_ARGS_gc_ms2_sweep_pmc_chunk __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self))
 #define ASSERT_ARGS_gc_ms2_sweep_pmc_pool __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(pool) \
     , PARROT_ASSERT_ARG(list))
+#define ASSERT_ARGS_gc_ms2_sweep_string_chunk __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self))
 #define ASSERT_ARGS_gc_ms2_sweep_string_pool __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(pool) \
     , PARROT_ASSERT_ARG(list))
+#define ASSERT_ARGS_gc_ms2_take_gray __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(thief) \
+    , PARROT_ASSERT_ARG(victim))
 #define ASSERT_ARGS_gc_ms2_unblock_GC_mark __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_gc_ms2_unblock_GC_sweep __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_gc_ms2_write_barrier __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pmc))
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 /* HEADERIZER END: static */
 
@@ -401,7 +811,8 @@ Flags can be a combination of these values:
 
 =item C<static void gc_ms2_compact_memory_pool(PARROT_INTERP)>
 
-Stub for compacting memory pools.
+Compacts the STRING storage, and evacuates the PMC attributes out of sparse
+arenas unless the GC is blocked.
 
 =cut
 
@@ -412,7 +823,134 @@ gc_ms2_compact_memory_pool(PARROT_INTERP)
 {
     ASSERT_ARGS(gc_ms2_compact_memory_pool)
     MarkSweep_GC *self = (MarkSweep_GC *)interp->gc_sys->gc_private;
+
+    gc_ms2_compact_string_pool(interp, self);
+
+    if (!self->gc_mark_block_level)
+        gc_ms2_evacuate_attributes(interp, self);
+}
+
+
+/*
+
+=item C<static void gc_ms2_compact_string_pool(PARROT_INTERP, MarkSweep_GC
+*self)>
+
+Compacts the STRING storage.
+
+=cut
+
+*/
+
+static void
+gc_ms2_compact_string_pool(PARROT_INTERP, ARGIN(MarkSweep_GC *self))
+{
+    ASSERT_ARGS(gc_ms2_compact_string_pool)
+    UHUGEINTVAL start;
+
+    /* Only live STRINGs get moved */
+    while (self->dead_strings)
+        gc_ms2_sweep_string_chunk(interp, self);
+
+    start = Parrot_hires_get_time();
     Parrot_gc_str_compact_pool(interp, &self->string_gc);
+    self->event.compact_time += Parrot_hires_get_time() - start;
+}
+
+
+/*
+
+=item C<static void gc_ms2_evacuate_attributes(PARROT_INTERP, MarkSweep_GC
+*self)>
+
+Moves the attributes of non-constant PMCs out of sparse arenas, and frees the
+arenas.  C code may hold pointers to attributes, so the arenas the system stack
+points into stay, as do the attributes of PMCs flagged external, which NCI code
+may keep.  All of the system stack counts here, even with precise roots.
+
+=cut
+
+*/
+
+static void
+gc_ms2_evacuate_attributes(PARROT_INTERP, ARGIN(MarkSweep_GC *self))
+{
+    ASSERT_ARGS(gc_ms2_evacuate_attributes)
+    Fixed_Allocator * const allocator     = self->attrib_allocator;
+    const UINTVAL           precise_roots = interp->gc_precise_roots;
+    UHUGEINTVAL             start;
+
+    ++self->gc_mark_block_level;
+    gc_ms2_finish_sweep(interp, self);
+
+    start = Parrot_hires_get_time();
+    Parrot_gc_fixed_allocator_start_evacuation(interp, allocator);
+
+    self->pinning            = 1;
+    interp->gc_precise_roots = 0;
+    Parrot_gc_trace_root(interp, NULL, GC_TRACE_SYSTEM_ONLY);
+    interp->gc_precise_roots = precise_roots;
+    self->pinning            = 0;
+
+    gc_ms2_pin_attributes(interp, self, self->objects);
+    if (self->marking)
+        gc_ms2_pin_attributes(interp, self, self->new_objects);
+
+    Parrot_gc_fixed_allocator_plan_evacuation(interp, allocator);
+
+    gc_ms2_move_attributes(interp, self, self->objects);
+    if (self->marking)
+        gc_ms2_move_attributes(interp, self, self->new_objects);
+
+    Parrot_gc_fixed_allocator_finish_evacuation(interp, allocator);
+    self->event.compact_time += Parrot_hires_get_time() - start;
+    --self->gc_mark_block_level;
+}
+
+
+/*
+
+=item C<static void gc_ms2_pin_attributes(PARROT_INTERP, MarkSweep_GC *self,
+Parrot_Pointer_Array *list)>
+
+Pins the attributes of the external PMCs in C<list>.
+
+=item C<static void gc_ms2_move_attributes(PARROT_INTERP, MarkSweep_GC *self,
+Parrot_Pointer_Array *list)>
+
+Moves the attributes of the other PMCs in C<list> out of evacuated arenas.
+
+=cut
+
+*/
+
+static void
+gc_ms2_pin_attributes(PARROT_INTERP, ARGIN(MarkSweep_GC *self),
+        ARGIN(Parrot_Pointer_Array *list))
+{
+    ASSERT_ARGS(gc_ms2_pin_attributes)
+
+    POINTER_ARRAY_ITER(list,
+        PMC *pmc = &(((pmc_alloc_struct *)ptr)->pmc);
+
+        if (pmc->vtable->attr_size && PMC_data(pmc) && PObj_external_TEST(pmc))
+            Parrot_gc_fixed_allocator_pin(interp, self->attrib_allocator,
+                PMC_data(pmc)););
+}
+
+static void
+gc_ms2_move_attributes(PARROT_INTERP, ARGIN(MarkSweep_GC *self),
+        ARGIN(Parrot_Pointer_Array *list))
+{
+    ASSERT_ARGS(gc_ms2_move_attributes)
+
+    POINTER_ARRAY_ITER(list,
+        PMC *pmc = &(((pmc_alloc_struct *)ptr)->pmc);
+
+        if (pmc->vtable->attr_size && PMC_data(pmc) && !PObj_constant_TEST(pmc))
+            PMC_data(pmc) = Parrot_gc_fixed_allocator_evacuate(interp,
+                self->attrib_allocator, PMC_data(pmc),
+                pmc->vtable->attr_size););
 }
 
 
@@ -464,7 +1002,10 @@ gc_ms2_allocate_pmc_attributes(PARROT_INTERP, ARGMOD(PMC *pmc))
     const size_t  attr_size = pmc->vtable->attr_size;
 
     PMC_data(pmc)           = Parrot_gc_fixed_allocator_allocate(interp,
-                                self->fixed_size_allocator, attr_size);
+                                PObj_constant_TEST(pmc)
+                                    ? self->fixed_size_allocator
+                                    : self->attrib_allocator,
+                                attr_size);
 
     memset(PMC_data(pmc), 0, attr_size);
     interp->gc_sys->stats.mem_used_last_collect += attr_size;
@@ -480,7 +1021,10 @@ gc_ms2_free_pmc_attributes(PARROT_INTERP, ARGMOD(PMC *pmc))
 
     if (PMC_data(pmc)) {
         MarkSweep_GC *self = (MarkSweep_GC *)interp->gc_sys->gc_private;
-        Parrot_gc_fixed_allocator_free(interp, self->fixed_size_allocator,
+        Parrot_gc_fixed_allocator_free(interp,
+                PObj_constant_TEST(pmc)
+                    ? self->fixed_size_allocator
+                    : self->attrib_allocator,
                 PMC_data(pmc), pmc->vtable->attr_size);
 
         interp->gc_sys->stats.mem_used_last_collect -= pmc->vtable->attr_size;
@@ -623,6 +1167,8 @@ Parrot_gc_ms2_init(PARROT_INTERP)
 
     interp->gc_sys->get_gc_info             = gc_ms2_get_gc_info;
 
+    interp->gc_sys->write_barrier           = gc_ms2_write_barrier;
+
     if (interp->parent_interpreter && interp->parent_interpreter->gc_sys) {
         /* This is a "child" interpreter. Just reuse parent one */
         self = (MarkSweep_GC*)interp->parent_interpreter->gc_sys->gc_private;
@@ -639,8 +1185,23 @@ Parrot_gc_ms2_init(PARROT_INTERP)
         self->strings = Parrot_pa_new(interp);
 
         self->fixed_size_allocator = Parrot_gc_fixed_allocator_new(interp);
+        self->attrib_allocator     = Parrot_gc_fixed_allocator_new(interp);
 
-        self->gc_threshold = Parrot_sysmem_amount(interp) / 8;
+        self->max_threshold = Parrot_sysmem_amount(interp) / 8;
+        self->gc_threshold  = interp->gc_overhead
+                            ? GC_MS2_INITIAL_THRESHOLD
+                            : self->max_threshold;
+        self->last_adapt    = Parrot_hires_get_time();
+
+        /* gc_max_pause is in microseconds */
+        self->max_pause = (UHUGEINTVAL)interp->gc_max_pause * 1000
+                        / Parrot_hires_get_tick_duration();
+
+#ifdef PARROT_HAS_THREADS
+        self->mark_threads = interp->gc_mark_threads;
+#endif
+        if (self->mark_threads > 1)
+            gc_ms2_init_workers(self);
 
         Parrot_gc_str_initialize(interp, &self->string_gc);
     }
@@ -671,9 +1232,20 @@ gc_ms2_finalize(PARROT_INTERP)
 
         Parrot_pa_destroy(interp, self->objects);
         Parrot_pa_destroy(interp, self->strings);
+        if (self->dead_objects)
+            Parrot_pa_destroy(interp, self->dead_objects);
+        if (self->dead_strings)
+            Parrot_pa_destroy(interp, self->dead_strings);
+        if (self->rescan)
+            Parrot_pa_destroy(interp, self->rescan);
+        if (self->gray.items)
+            mem_sys_free(self->gray.items);
+        if (self->workers)
+            gc_ms2_destroy_workers(self);
         Parrot_gc_pool_destroy(interp, self->pmc_allocator);
         Parrot_gc_pool_destroy(interp, self->string_allocator);
         Parrot_gc_fixed_allocator_destroy(interp, self->fixed_size_allocator);
+        Parrot_gc_fixed_allocator_destroy(interp, self->attrib_allocator);
 
         /* now free this GC system */
         mem_sys_free(self);
@@ -694,6 +1266,10 @@ gc_ms2_allocate_pmc_header(PARROT_INTERP, UINTVAL flags)
 
     MAYBE_MARK_AND_SWEEP(interp, self);
 
+    /* Reuse dead PMCs before allocating a new arena */
+    if (self->dead_objects && !pool->num_free_objects)
+        gc_ms2_sweep_lazily(interp, self);
+
     /* Increase used memory. Not precisely accurate due Pool_Allocator paging */
     ++interp->gc_sys->stats.header_allocs_since_last_collect;
 
@@ -716,7 +1292,18 @@ gc_ms2_free_pmc_header(PARROT_INTERP, ARGFREE(PMC *pmc))
     if (pmc) {
         if (PObj_on_free_list_TEST(pmc))
             return;
-        Parrot_pa_remove(interp, self->objects, PMC2PAC(pmc)->ptr);
+
+        /* Marking moves PMCs to new_objects */
+        if (self->marking && PObj_live_TEST(pmc) && !PObj_constant_TEST(pmc))
+            Parrot_pa_remove(interp, self->new_objects, PMC2PAC(pmc)->ptr);
+
+        /* Constant PMCs stay where the last run left them */
+        else if (self->dead_objects && PObj_constant_TEST(pmc)
+             &&  Parrot_pa_is_owned(interp, self->dead_objects,
+                    PMC2PAC(pmc), PMC2PAC(pmc)->ptr))
+            Parrot_pa_remove(interp, self->dead_objects, PMC2PAC(pmc)->ptr);
+        else
+            Parrot_pa_remove(interp, self->objects, PMC2PAC(pmc)->ptr);
         PObj_on_free_list_SET(pmc);
 
         Parrot_pmc_destroy(interp, pmc);
@@ -754,9 +1341,22 @@ gc_ms2_mark_pmc_header(PARROT_INTERP, ARGIN(PMC *pmc))
     /* mark it live */
     PObj_live_SET(pmc);
 
+    /* Parallel marking moves live PMCs to new_objects afterwards */
+    if (self->parallel_marking) {
+        if (!PObj_constant_TEST(pmc)) {
+            MarkSweep_Worker * const worker =
+                (MarkSweep_Worker *)THREAD_KEY_GET(self->worker_key);
+            gc_ms2_push_gray(&worker->gray, pmc);
+        }
+        return;
+    }
+
     if (!PObj_constant_TEST(pmc)) {
         Parrot_pa_remove(interp, self->objects, item->ptr);
         item->ptr = Parrot_pa_insert(interp, self->new_objects, item);
+
+        if (self->marking)
+            gc_ms2_push_gray(&self->gray, pmc);
     }
 
 }
@@ -768,6 +1368,10 @@ gc_ms2_mark_pmc_header(PARROT_INTERP, ARGIN(PMC *pmc))
 
 Establish if *ptr is.owned.
 
+While tracing the system stack at the end of an incremental marking cycle,
+live PMCs are remembered instead: C code may still be filling them in without
+having reached the write barrier.
+
 =cut
 
 */
@@ -777,9 +1381,51 @@ gc_ms2_is_pmc_ptr(PARROT_INTERP, ARGIN_NULLOK(void *ptr))
 {
     ASSERT_ARGS(gc_ms2_is_pmc_ptr)
     MarkSweep_GC      *self = (MarkSweep_GC *)interp->gc_sys->gc_private;
+
+    if (self->pinning) {
+        Parrot_gc_fixed_allocator_pin(interp, self->attrib_allocator, ptr);
+        return 0;
+    }
+
+    if (self->tracing_stack && gc_ms2_is_live_pmc(interp, self, ptr)) {
+        gc_ms2_remember(interp, self, (PMC *)ptr);
+        return 0;
+    }
+
     return gc_ms2_is_ptr_owned(interp, ptr, self->pmc_allocator, self->objects);
 }
 
+
+/*
+
+=item C<static int gc_ms2_is_live_pmc(PARROT_INTERP, MarkSweep_GC *self, void
+*ptr)>
+
+Establish if *ptr is a PMC marked in the running cycle.
+
+=cut
+
+*/
+
+static int
+gc_ms2_is_live_pmc(PARROT_INTERP, ARGIN(MarkSweep_GC *self),
+        ARGIN_NULLOK(void *ptr))
+{
+    ASSERT_ARGS(gc_ms2_is_live_pmc)
+    PMC              *pmc  = (PMC *)ptr;
+    pmc_alloc_struct *item = PMC2PAC(ptr);
+
+    if (!pmc || !item
+    ||  !Parrot_gc_pool_is_owned(interp, self->pmc_allocator, item))
+        return 0;
+
+    if (!PObj_live_TEST(pmc) || PObj_on_free_list_TEST(pmc)
+    ||   PObj_constant_TEST(pmc))
+        return 0;
+
+    return Parrot_pa_is_owned(interp, self->new_objects, item, item->ptr);
+}
+
 /*
 
 =item C<gc_ms2_allocate_string_header()>
@@ -809,6 +1455,10 @@ gc_ms2_allocate_string_header(PARROT_INTERP, SHIM(UINTVAL flags))
 
     MAYBE_MARK_AND_SWEEP(interp, self);
 
+    /* Reuse dead STRINGs before allocating a new arena */
+    if (self->dead_strings && !pool->num_free_objects)
+        gc_ms2_sweep_lazily(interp, self);
+
     /* Increase used memory. Not precisely accurate due Pool_Allocator paging */
     ++interp->gc_sys->stats.header_allocs_since_last_collect;
     interp->gc_sys->stats.memory_allocated      += sizeof (STRING);
@@ -832,7 +1482,12 @@ gc_ms2_free_string_header(PARROT_INTERP, ARGFREE(STRING *s))
     && !PObj_on_free_list_TEST(s)) {
         MarkSweep_GC *self = (MarkSweep_GC *)interp->gc_sys->gc_private;
 
-        Parrot_pa_remove(interp, self->strings, STR2PAC(s)->ptr);
+        if (self->dead_strings
+        &&  Parrot_pa_is_owned(interp, self->dead_strings, STR2PAC(s),
+                STR2PAC(s)->ptr))
+            Parrot_pa_remove(interp, self->dead_strings, STR2PAC(s)->ptr);
+        else
+            Parrot_pa_remove(interp, self->strings, STR2PAC(s)->ptr);
 
         if (Buffer_bufstart(s) && !PObj_external_TEST(s))
             Parrot_gc_str_free_buffer_storage(interp,
@@ -882,6 +1537,10 @@ gc_ms2_is_string_ptr(PARROT_INTERP, ARGIN_NULLOK(void *ptr))
 {
     ASSERT_ARGS(gc_ms2_is_string_ptr)
     MarkSweep_GC      *self = (MarkSweep_GC *)interp->gc_sys->gc_private;
+
+    if (self->pinning)
+        return 0;
+
     return gc_ms2_is_ptr_owned(interp, ptr, self->string_allocator, self->strings);
 }
 
@@ -1014,6 +1673,7 @@ gc_ms2_mark_live_objects(PARROT_INTERP, ARGIN(MarkSweep_GC *self),
     UINTVAL flags)
 {
     ASSERT_ARGS(gc_ms2_mark_live_objects)
+    UHUGEINTVAL start = Parrot_hires_get_time();
 
     /* Allocate list for gray objects */
     self->new_objects = Parrot_pa_new(interp);
@@ -1034,19 +1694,340 @@ gc_ms2_mark_live_objects(PARROT_INTERP, ARGIN(MarkSweep_GC *self),
                 (Parrot_gc_trace_type)0);
     }
 
-    /* new_objects are "gray" until fully marked */
-    /* Additional gray objects will append to new_objects list */
-    /* So, iterate over them in one go */
+    self->event.trace_time += Parrot_hires_get_time() - start;
+    start                   = Parrot_hires_get_time();
+
+    /* Big heaps are marked on several threads */
+    if (self->mark_threads > 1
+    &&  self->pmc_allocator->total_objects >= GC_MS2_PARALLEL_MIN)
+        gc_ms2_mark_parallel(interp, self);
+    else {
+        /* new_objects are "gray" until fully marked */
+        /* Additional gray objects will append to new_objects list */
+        /* So, iterate over them in one go */
+        POINTER_ARRAY_ITER(self->new_objects,
+            PMC *pmc = &((pmc_alloc_struct *)ptr)->pmc;
+
+            /* if object is a PMC and contains buffers or PMCs, then attach
+             * the PMC to the chained mark list. */
+            if (PObj_custom_mark_TEST(pmc))
+                VTABLE_mark(interp, pmc);
+
+            if (PMC_metadata(pmc))
+                Parrot_gc_mark_PMC_alive(interp, PMC_metadata(pmc)););
+    }
+
+    self->event.mark_time += Parrot_hires_get_time() - start;
+}
+
+
+/*
+
+=item C<static void gc_ms2_mark_parallel(PARROT_INTERP, MarkSweep_GC *self)>
+
+Marks the children of the PMCs in C<new_objects> on C<mark_threads> threads,
+the interpreter's one included.  Each thread marks from its own stack of gray
+PMCs, sharing half of it when the stack grows, for the threads which ran out
+of PMCs to steal.
+
+C<VTABLE_mark> of classes not declared C<parallel_mark> runs on the
+interpreter's thread once the threads are done, then the threads mark the
+PMCs it reached.  Last, the PMCs the threads marked move from C<objects> to
+C<new_objects>.
+
+=cut
+
+*/
+
+static void
+gc_ms2_mark_parallel(PARROT_INTERP, ARGIN(MarkSweep_GC *self))
+{
+    ASSERT_ARGS(gc_ms2_mark_parallel)
+    MarkSweep_Worker * const workers = self->workers;
+    const size_t             count   = self->mark_threads;
+    size_t                   i       = 0;
+
+    /* Deal the PMCs the roots reached to the threads */
     POINTER_ARRAY_ITER(self->new_objects,
         PMC *pmc = &((pmc_alloc_struct *)ptr)->pmc;
+        gc_ms2_push_gray(&workers[i++ % count].gray, pmc););
 
-        /* if object is a PMC and contains buffers or PMCs, then attach the PMC
-         * to the chained mark list. */
-        if (PObj_custom_mark_TEST(pmc))
-            VTABLE_mark(interp, pmc);
+    for (i = 0; i < count; ++i)
+        workers[i].interp = interp;
 
-        if (PMC_metadata(pmc))
-            Parrot_gc_mark_PMC_alive(interp, PMC_metadata(pmc)););
+    self->parallel_marking = 1;
+
+    do {
+        void *ret;
+
+        self->idle_workers = 0;
+
+        for (i = 1; i < count; ++i)
+            THREAD_CREATE_JOINABLE(workers[i].thread, gc_ms2_mark_worker,
+                &workers[i]);
+
+        gc_ms2_mark_worker(&workers[0]);
+
+        for (i = 1; i < count; ++i)
+            JOIN(workers[i].thread, ret);
+
+        UNUSED(ret);
+
+        /* The PMCs these reach go to the stack of the first thread */
+        for (i = 0; i < count; ++i) {
+            MarkSweep_Stack * const deferred = &workers[i].deferred;
+
+            while (deferred->size) {
+                PMC * const pmc = deferred->items[--deferred->size];
+                VTABLE_mark(interp, pmc);
+            }
+        }
+    } while (workers[0].gray.size);
+
+    self->parallel_marking = 0;
+
+    POINTER_ARRAY_ITER(self->objects,
+        pmc_alloc_struct *item = (pmc_alloc_struct *)ptr;
+
+        if (PObj_live_TEST(&item->pmc) && !PObj_constant_TEST(&item->pmc)) {
+            Parrot_pa_remove(interp, self->objects, item->ptr);
+            item->ptr = Parrot_pa_insert(interp, self->new_objects, item);
+        });
+}
+
+
+/*
+
+=item C<static void * gc_ms2_mark_worker(void *data)>
+
+Marks the children of gray PMCs on one thread of the parallel mark, until no
+thread has gray PMCs left.
+
+=cut
+
+*/
+
+PARROT_CAN_RETURN_NULL
+static void *
+gc_ms2_mark_worker(ARGMOD(void *data))
+{
+    ASSERT_ARGS(gc_ms2_mark_worker)
+    MarkSweep_Worker * const worker = (MarkSweep_Worker *)data;
+    MarkSweep_GC     * const self   = worker->gc;
+    Interp           * const interp = worker->interp;
+    MarkSweep_Stack  * const gray   = &worker->gray;
+
+    THREAD_KEY_SET(self->worker_key, worker);
+
+    do {
+        while (gray->size) {
+            PMC * const pmc = gray->items[--gray->size];
+
+            /* Only this thread fills its shared stack, so reading the size
+               without the lock only risks sharing a bit late */
+            if (gray->size > GC_MS2_SHARE_MIN && !worker->shared.size)
+                gc_ms2_share_gray(self, worker);
+
+            if (PObj_custom_mark_TEST(pmc)) {
+                if (PMC_has_parallel_mark(pmc))
+                    VTABLE_mark(interp, pmc);
+                else
+                    gc_ms2_push_gray(&worker->deferred, pmc);
+            }
+
+            if (PMC_metadata(pmc))
+                Parrot_gc_mark_PMC_alive(interp, PMC_metadata(pmc));
+        }
+    } while (gc_ms2_steal_gray(self, worker));
+
+    return NULL;
+}
+
+
+/*
+
+=item C<static void gc_ms2_share_gray(MarkSweep_GC *self, MarkSweep_Worker
+*worker)>
+
+Moves half of the gray PMCs of C<worker> to its empty shared stack, and wakes
+up the idle threads.
+
+=cut
+
+*/
+
+static void
+gc_ms2_share_gray(ARGMOD(MarkSweep_GC *self), ARGMOD(MarkSweep_Worker *worker))
+{
+    ASSERT_ARGS(gc_ms2_share_gray)
+    MarkSweep_Stack * const gray   = &worker->gray;
+    MarkSweep_Stack * const shared = &worker->shared;
+    const size_t            count  = gray->size / 2;
+
+    LOCK(worker->lock);
+    gc_ms2_grow_stack(shared, count);
+    memcpy(shared->items + shared->size, gray->items + gray->size - count,
+            count * sizeof (PMC *));
+    shared->size += count;
+    gray->size   -= count;
+    UNLOCK(worker->lock);
+
+    LOCK(self->mark_lock);
+    if (self->idle_workers)
+        COND_BROADCAST(self->work_cond);
+    UNLOCK(self->mark_lock);
+}
+
+
+/*
+
+=item C<static int gc_ms2_steal_gray(MarkSweep_GC *self, MarkSweep_Worker
+*worker)>
+
+Refills the empty stack of C<worker>, taking back its shared PMCs or stealing
+half of the shared PMCs of another thread, and waiting for some when no thread
+shares any.  Returns false once all the threads ran out of gray PMCs, which
+ends the mark.
+
+Stealing happens under C<mark_lock>, so that no thread takes the last idle
+thread for done while another is still getting PMCs.
+
+=cut
+
+*/
+
+static int
+gc_ms2_steal_gray(ARGMOD(MarkSweep_GC *self), ARGMOD(MarkSweep_Worker *worker))
+{
+    ASSERT_ARGS(gc_ms2_steal_gray)
+    const size_t count = self->mark_threads;
+
+    if (gc_ms2_take_gray(worker, worker))
+        return 1;
+
+    LOCK(self->mark_lock);
+    ++self->idle_workers;
+
+    for (;;) {
+        size_t i;
+
+        if (self->idle_workers == count) {
+            COND_BROADCAST(self->work_cond);
+            UNLOCK(self->mark_lock);
+            return 0;
+        }
+
+        for (i = 1; i < count; ++i)
+            if (gc_ms2_take_gray(worker,
+                    &self->workers[(worker->id + i) % count])) {
+                --self->idle_workers;
+                UNLOCK(self->mark_lock);
+                return 1;
+            }
+
+        COND_WAIT(self->work_cond, self->mark_lock);
+    }
+}
+
+
+/*
+
+=item C<static int gc_ms2_take_gray(MarkSweep_Worker *thief, MarkSweep_Worker
+*victim)>
+
+Moves the shared PMCs of C<victim> to the stack of C<thief>: all of them when
+both are the same, else half.  Returns the number of PMCs moved.
+
+=cut
+
+*/
+
+static int
+gc_ms2_take_gray(ARGMOD(MarkSweep_Worker *thief),
+        ARGMOD(MarkSweep_Worker *victim))
+{
+    ASSERT_ARGS(gc_ms2_take_gray)
+    MarkSweep_Stack * const from = &victim->shared;
+    MarkSweep_Stack * const to   = &thief->gray;
+    size_t                  count;
+
+    LOCK(victim->lock);
+    count = thief == victim ? from->size : (from->size + 1) / 2;
+    if (count) {
+        gc_ms2_grow_stack(to, count);
+        memcpy(to->items + to->size, from->items + from->size - count,
+                count * sizeof (PMC *));
+        to->size   += count;
+        from->size -= count;
+    }
+    UNLOCK(victim->lock);
+
+    return count != 0;
+}
+
+
+/*
+
+=item C<static void gc_ms2_init_workers(MarkSweep_GC *self)>
+
+Sets up C<mark_threads> threads for parallel marking.
+
+=cut
+
+*/
+
+static void
+gc_ms2_init_workers(ARGMOD(MarkSweep_GC *self))
+{
+    ASSERT_ARGS(gc_ms2_init_workers)
+    size_t i;
+
+    self->workers = mem_allocate_n_zeroed_typed(self->mark_threads,
+                        MarkSweep_Worker);
+
+    for (i = 0; i < self->mark_threads; ++i) {
+        self->workers[i].gc = self;
+        self->workers[i].id = i;
+        MUTEX_INIT(self->workers[i].lock);
+    }
+
+    MUTEX_INIT(self->mark_lock);
+    COND_INIT(self->work_cond);
+    THREAD_KEY_CREATE(self->worker_key);
+}
+
+
+/*
+
+=item C<static void gc_ms2_destroy_workers(MarkSweep_GC *self)>
+
+Frees the threads for parallel marking.
+
+=cut
+
+*/
+
+static void
+gc_ms2_destroy_workers(ARGMOD(MarkSweep_GC *self))
+{
+    ASSERT_ARGS(gc_ms2_destroy_workers)
+    size_t i;
+
+    for (i = 0; i < self->mark_threads; ++i) {
+        MarkSweep_Worker * const worker = &self->workers[i];
+
+        mem_sys_free(worker->gray.items);
+        mem_sys_free(worker->shared.items);
+        mem_sys_free(worker->deferred.items);
+        MUTEX_DESTROY(worker->lock);
+    }
+
+    MUTEX_DESTROY(self->mark_lock);
+    COND_DESTROY(self->work_cond);
+    THREAD_KEY_DELETE(self->worker_key);
+
+    mem_sys_free(self->workers);
+    self->workers = NULL;
 }
 
 static void
@@ -1054,6 +2035,8 @@ gc_ms2_mark_and_sweep(PARROT_INTERP, UINTVAL flags)
 {
     ASSERT_ARGS(gc_ms2_mark_and_sweep)
     MarkSweep_GC * const self = (MarkSweep_GC *)interp->gc_sys->gc_private;
+    UHUGEINTVAL          start;
+    size_t               live, dead;
 
     /* GC is blocked */
     if (self->gc_mark_block_level)
@@ -1067,16 +2050,46 @@ gc_ms2_mark_and_sweep(PARROT_INTERP, UINTVAL flags)
     if (flags & GC_finish_FLAG && interp->parent_interpreter)
         return;
 
+    /* complete the running marking cycle before global destruction */
+    if (self->marking && flags & GC_finish_FLAG)
+        gc_ms2_mark_and_sweep(interp, 0);
+
     ++self->gc_mark_block_level;
-    gc_ms2_mark_live_objects(interp, self, flags);
+    if (self->marking) {
+        start = Parrot_hires_get_time();
+        gc_ms2_finish_marking(interp, self);
+    }
+    else {
+        gc_ms2_finish_sweep(interp, self);
+        start = Parrot_hires_get_time();
+        gc_ms2_mark_live_objects(interp, self, flags);
+    }
 
     /* At this point of time new_objects contains only live PMCs */
     /* objects contains "dead" or "constant" PMCs */
+    live = gc_ms2_count_objects(self->new_objects);
+    dead = gc_ms2_count_objects(self->objects);
+
+    self->mark_ticks     += Parrot_hires_get_time() - start;
+    self->event.live_pmcs = live;
+    gc_ms2_adapt_threshold(interp, self, live, dead);
+
+    if (flags & GC_MS2_LAZY_SWEEP_FLAG) {
+        gc_ms2_start_lazy_sweep(interp, self);
+        gc_ms2_end_run(interp, self);
+        return;
+    }
+
     /* sweep of new_objects will repaint them white */
     /* sweep of objects will destroy dead objects leaving only "constant" */
+    start = Parrot_hires_get_time();
     gc_ms2_sweep_pmc_pool(interp, self->pmc_allocator, self->new_objects);
     gc_ms2_sweep_pmc_pool(interp, self->pmc_allocator, self->objects);
+    self->event.sweep_pmc_time += Parrot_hires_get_time() - start;
+
+    start = Parrot_hires_get_time();
     gc_ms2_sweep_string_pool(interp, self->string_allocator, self->strings);
+    self->event.sweep_string_time += Parrot_hires_get_time() - start;
 
     /* destroy the rest */
     if (flags & GC_finish_FLAG) {
@@ -1091,14 +2104,617 @@ gc_ms2_mark_and_sweep(PARROT_INTERP, UINTVAL flags)
         Parrot_pa_destroy(interp, tmp);
     } while (0);
 
-    /* We swept all dead objects */
+    gc_ms2_end_run(interp, self);
+    gc_ms2_compact_string_pool(interp, self);
+    Parrot_gc_record_event(interp, &self->event);
+}
+
+
+/*
+
+=item C<static void gc_ms2_adapt_threshold(PARROT_INTERP, MarkSweep_GC *self,
+size_t live, size_t dead)>
+
+Adapts C<gc_threshold> after a run which found C<live> PMCs alive and C<dead>
+ones dead.  Without a GC overhead target, collects once the largest threshold
+is used.  With one, scales the threshold by the share of time spent marking
+since the last run over the target, so that runs get rarer when they cost too
+much and more frequent when they are cheap.  Only marking counts, as it costs
+the same however much garbage there is, while sweeping costs the same per
+object however often the GC runs.  The threshold doesn't shrink when most PMCs
+survive, as collecting more often would hardly free memory.
+
+=cut
+
+*/
+
+static void
+gc_ms2_adapt_threshold(PARROT_INTERP, ARGIN(MarkSweep_GC *self),
+        size_t live, size_t dead)
+{
+    ASSERT_ARGS(gc_ms2_adapt_threshold)
+    const UHUGEINTVAL now     = Parrot_hires_get_time();
+    const UHUGEINTVAL elapsed = now - self->last_adapt;
+    const size_t      max     = interp->gc_max_threshold
+                              ? interp->gc_max_threshold * 1024
+                              : self->max_threshold;
+    size_t            threshold = max;
+
+    if (interp->gc_overhead && elapsed) {
+        /* percentage of the time spent in GC */
+        const FLOATVAL overhead = 100.0 * self->mark_ticks / elapsed;
+        FLOATVAL       factor   = overhead / interp->gc_overhead;
+
+        if (factor > GC_MS2_MAX_GROWTH)
+            factor = GC_MS2_MAX_GROWTH;
+        else if (factor < GC_MS2_MAX_SHRINK)
+            factor = GC_MS2_MAX_SHRINK;
+
+        if (factor < 1.0 && live * 100 >= (live + dead) * GC_MS2_HIGH_SURVIVAL)
+            factor = 1.0;
+
+        threshold = (size_t)(self->gc_threshold * factor);
+
+        if (threshold < GC_MS2_MIN_THRESHOLD)
+            threshold = GC_MS2_MIN_THRESHOLD;
+        if (threshold > max)
+            threshold = max;
+    }
+
+    self->gc_threshold = threshold;
+    self->mark_ticks   = 0;
+    self->last_adapt   = now;
+}
+
+
+/*
+
+=item C<static size_t gc_ms2_count_objects(const Parrot_Pointer_Array *list)>
+
+Counts the objects in C<list>.  Cells freed between used ones count too.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_PURE_FUNCTION
+static size_t
+gc_ms2_count_objects(ARGIN(const Parrot_Pointer_Array *list))
+{
+    ASSERT_ARGS(gc_ms2_count_objects)
+    size_t count = 0;
+    size_t i;
+
+    for (i = 0; i < list->total_chunks; ++i)
+        count += CELL_PER_CHUNK - list->chunks[i]->num_free;
+
+    return count;
+}
+
+
+/*
+
+=item C<static void gc_ms2_end_run(PARROT_INTERP, MarkSweep_GC *self)>
+
+Resets the statistics after a GC run, and unblocks the GC.
+
+=cut
+
+*/
+
+static void
+gc_ms2_end_run(PARROT_INTERP, ARGIN(MarkSweep_GC *self))
+{
+    ASSERT_ARGS(gc_ms2_end_run)
+
+    /* We swept all dead objects, or will */
     self->num_early_gc_PMCs                                = 0;
     interp->gc_sys->stats.mem_used_last_collect            = 0;
     interp->gc_sys->stats.header_allocs_since_last_collect = 0;
     interp->gc_sys->stats.gc_mark_runs++;
     self->gc_mark_block_level--;
+}
+
+
+/*
+
+=item C<static void gc_ms2_start_lazy_sweep(PARROT_INTERP, MarkSweep_GC *self)>
+
+Sets the dead PMCs and STRINGs aside for sweeping them later, and starts
+allocating into new lists.  The live PMCs stay painted until swept.
+
+=cut
+
+*/
+
+static void
+gc_ms2_start_lazy_sweep(PARROT_INTERP, ARGIN(MarkSweep_GC *self))
+{
+    ASSERT_ARGS(gc_ms2_start_lazy_sweep)
+
+    self->dead_objects      = self->objects;
+    self->objects           = self->new_objects;
+    self->dead_chunk        = 0;
+    self->live_chunk        = 0;
+    self->live_chunks       = self->objects->total_chunks;
+
+    self->live_chunks_per_step = self->dead_objects->total_chunks
+            ? self->live_chunks / self->dead_objects->total_chunks + 1
+            : self->live_chunks;
+
+    self->dead_strings      = self->strings;
+    self->strings           = Parrot_pa_new(interp);
+    self->dead_string_chunk = 0;
+}
+
+
+/*
+
+=item C<static void gc_ms2_sweep_lazily(PARROT_INTERP, MarkSweep_GC *self)>
+
+Sweeps chunks of the dead PMCs or STRINGs until their allocator has a free
+header again, or nothing is left to sweep.  Once all STRINGs are swept,
+compacts their storage.  Records the run once all is swept.
+
+=cut
+
+*/
+
+static void
+gc_ms2_sweep_lazily(PARROT_INTERP, ARGIN(MarkSweep_GC *self))
+{
+    ASSERT_ARGS(gc_ms2_sweep_lazily)
+    const int sweeping = self->dead_objects || self->dead_strings;
+
+    /* Destroying PMCs can allocate */
+    if (self->gc_mark_block_level)
+        return;
+
+    ++self->gc_mark_block_level;
+
+    while (self->dead_objects && !self->pmc_allocator->num_free_objects)
+        gc_ms2_sweep_pmc_chunk(interp, self);
+
+    while (self->dead_strings && !self->string_allocator->num_free_objects)
+        if (!gc_ms2_sweep_string_chunk(interp, self))
+            gc_ms2_compact_string_pool(interp, self);
+
+    /* The last run is done with */
+    if (sweeping && !self->dead_objects && !self->dead_strings)
+        Parrot_gc_record_event(interp, &self->event);
+
+    --self->gc_mark_block_level;
+}
+
+
+/*
+
+=item C<static void gc_ms2_finish_sweep(PARROT_INTERP, MarkSweep_GC *self)>
+
+Sweeps what the allocators left of the last lazy sweep.  When STRINGs were
+still left, compacts the STRING storage; the allocators didn't get to it.
+Records the run, unless it was recorded already.
+
+=cut
+
+*/
+
+static void
+gc_ms2_finish_sweep(PARROT_INTERP, ARGIN(MarkSweep_GC *self))
+{
+    ASSERT_ARGS(gc_ms2_finish_sweep)
+    const int sweeping = self->dead_objects || self->dead_strings;
+
+    while (self->dead_objects)
+        gc_ms2_sweep_pmc_chunk(interp, self);
+
+    if (self->dead_strings)
+        gc_ms2_compact_string_pool(interp, self);
+
+    if (sweeping)
+        Parrot_gc_record_event(interp, &self->event);
+}
+
+
+/*
+
+=item C<static void gc_ms2_sweep_pmc_chunk(PARROT_INTERP, MarkSweep_GC *self)>
+
+Destroys the dead PMCs of the next chunk of C<dead_objects>, and paints the
+live PMCs of the next chunks of C<objects> white.  PMCs allocated since the
+run are white already.
+
+=cut
+
+*/
+
+static void
+gc_ms2_sweep_pmc_chunk(PARROT_INTERP, ARGIN(MarkSweep_GC *self))
+{
+    ASSERT_ARGS(gc_ms2_sweep_pmc_chunk)
+    Parrot_Pointer_Array * const dead = self->dead_objects;
+    const size_t                 used =
+        interp->gc_sys->stats.mem_used_last_collect;
+    const UHUGEINTVAL            start = Parrot_hires_get_time();
+    size_t                       i;
+
+    if (self->dead_chunk < dead->total_chunks) {
+        POINTER_ARRAY_CHUNK_ITER(dead, self->dead_chunk,
+            PMC *pmc = &(((pmc_alloc_struct *)ptr)->pmc);
+
+            if (PObj_live_TEST(pmc))
+                PObj_GC_generation_CLEARALL(pmc);
+            else if (!PObj_constant_TEST(pmc))
+                gc_ms2_sweep_dead_pmc(interp, self->pmc_allocator, dead, pmc););
+        ++self->dead_chunk;
+    }
+
+    /* Memory of the last run's garbage doesn't count against the next run.
+       Subtracting it would wrap the counter below 0 and trigger a run */
+    interp->gc_sys->stats.mem_used_last_collect = used;
+
+    for (i = 0; i < self->live_chunks_per_step
+             && self->live_chunk < self->live_chunks; ++i) {
+        POINTER_ARRAY_CHUNK_ITER(self->objects, self->live_chunk,
+            PMC *pmc = &(((pmc_alloc_struct *)ptr)->pmc);
+            PObj_GC_generation_CLEARALL(pmc););
+        ++self->live_chunk;
+    }
+
+    /* Constant PMCs are dropped, as after an eager sweep */
+    if (self->dead_chunk == dead->total_chunks
+    &&  self->live_chunk == self->live_chunks) {
+        Parrot_pa_destroy(interp, dead);
+        self->dead_objects = NULL;
+    }
+
+    self->event.sweep_pmc_time += Parrot_hires_get_time() - start;
+}
+
+
+/*
+
+=item C<static int gc_ms2_sweep_string_chunk(PARROT_INTERP, MarkSweep_GC *self)>
+
+Frees the dead STRINGs of the next chunk of C<dead_strings>, and moves the
+others to C<strings>, painted white.  Returns false once all are swept.
+
+=cut
+
+*/
+
+static int
+gc_ms2_sweep_string_chunk(PARROT_INTERP, ARGIN(MarkSweep_GC *self))
+{
+    ASSERT_ARGS(gc_ms2_sweep_string_chunk)
+    Parrot_Pointer_Array * const dead = self->dead_strings;
+    const size_t                 used =
+        interp->gc_sys->stats.mem_used_last_collect;
+    const UHUGEINTVAL            start = Parrot_hires_get_time();
+
+    if (self->dead_string_chunk < dead->total_chunks) {
+        POINTER_ARRAY_CHUNK_ITER(dead, self->dead_string_chunk,
+            string_alloc_struct *item = (string_alloc_struct *)ptr;
+            STRING              *str  = &item->str;
+
+            if (PObj_live_TEST(str) || PObj_constant_TEST(str)) {
+                PObj_live_CLEAR(str);
+                Parrot_pa_remove(interp, dead, item->ptr);
+                item->ptr = Parrot_pa_insert(interp, self->strings, item);
+            }
+            else
+                gc_ms2_sweep_dead_string(interp, self->string_allocator, dead,
+                        str););
+        ++self->dead_string_chunk;
+    }
+
+    /* As for PMCs */
+    interp->gc_sys->stats.mem_used_last_collect = used;
+
+    if (self->dead_string_chunk < dead->total_chunks) {
+        self->event.sweep_string_time += Parrot_hires_get_time() - start;
+        return 1;
+    }
+
+    Parrot_pa_destroy(interp, dead);
+    self->dead_strings             = NULL;
+    self->event.sweep_string_time += Parrot_hires_get_time() - start;
+    return 0;
+}
+
+
+/*
+
+=item C<static void gc_ms2_mark_slice(PARROT_INTERP, MarkSweep_GC *self)>
+
+Runs a slice of incremental marking, starting a marking cycle if none is
+running.  The slice marks gray PMCs until it used up C<max_pause>.  When no
+gray PMC is left, finishes the cycle and sweeps.
+
+=cut
+
+*/
+
+static void
+gc_ms2_mark_slice(PARROT_INTERP, ARGIN(MarkSweep_GC *self))
+{
+    ASSERT_ARGS(gc_ms2_mark_slice)
+    const size_t used = interp->gc_sys->stats.mem_used_last_collect;
+    UHUGEINTVAL  start;
+    int          done;
+
+    /* GC is blocked */
+    if (self->gc_mark_block_level)
+        return;
+
+    if (self->marking) {
+        if (used < self->next_slice)
+            return;
+
+        /* Allocation outran marking. Finish at once */
+        if (used > 2 * self->gc_threshold) {
+            gc_ms2_mark_and_sweep(interp, GC_MS2_LAZY_SWEEP_FLAG);
+            return;
+        }
+    }
+
+    ++self->gc_mark_block_level;
+    start = Parrot_hires_get_time();
+
+    if (!self->marking)
+        gc_ms2_start_marking(interp, self);
+
+    done = gc_ms2_mark_gray(interp, self, start + self->max_pause);
+
+    self->mark_ticks      += Parrot_hires_get_time() - start;
+    self->event.mark_time += Parrot_hires_get_time() - start;
+    self->gc_mark_block_level--;
+
+    if (done)
+        gc_ms2_mark_and_sweep(interp, GC_MS2_LAZY_SWEEP_FLAG);
+    else
+        self->next_slice = used + GC_MS2_SLICE_SIZE;
+}
+
+
+/*
+
+=item C<static void gc_ms2_start_marking(PARROT_INTERP, MarkSweep_GC *self)>
+
+Starts an incremental marking cycle by marking the roots gray.  The system
+stack is traced only when finishing the cycle.
+
+=cut
+
+*/
+
+static void
+gc_ms2_start_marking(PARROT_INTERP, ARGIN(MarkSweep_GC *self))
+{
+    ASSERT_ARGS(gc_ms2_start_marking)
+    UHUGEINTVAL start;
+
+    gc_ms2_finish_sweep(interp, self);
+
+    self->new_objects = Parrot_pa_new(interp);
+    self->rescan      = Parrot_pa_new(interp);
+    self->marking     = 1;
+
+    start = Parrot_hires_get_time();
+    gc_ms2_mark_pmc_header(interp, PMCNULL);
+
+    Parrot_gc_trace_root(interp, NULL, GC_TRACE_ROOT_ONLY);
+
+    if (interp->pdb && interp->pdb->debugger)
+        Parrot_gc_trace_root(interp->pdb->debugger, NULL,
+            (Parrot_gc_trace_type)0);
+
+    self->event.trace_time += Parrot_hires_get_time() - start;
+}
+
+
+/*
+
+=item C<static void gc_ms2_finish_marking(PARROT_INTERP, MarkSweep_GC *self)>
+
+Finishes an incremental marking cycle.  Traces the roots and the system stack
+again, then the PMCs which can change without write barrier, and marks all the
+gray PMCs left.
+
+=cut
+
+*/
+
+static void
+gc_ms2_finish_marking(PARROT_INTERP, ARGIN(MarkSweep_GC *self))
+{
+    ASSERT_ARGS(gc_ms2_finish_marking)
+    UHUGEINTVAL start = Parrot_hires_get_time();
+
+    Parrot_gc_trace_root(interp, NULL, GC_TRACE_ROOT_ONLY);
+
+    self->tracing_stack = 1;
+    Parrot_gc_trace_root(interp, NULL, GC_TRACE_SYSTEM_ONLY);
+    self->tracing_stack = 0;
+
+    if (interp->pdb && interp->pdb->debugger)
+        Parrot_gc_trace_root(interp->pdb->debugger, NULL,
+            (Parrot_gc_trace_type)0);
+
+    self->event.trace_time += Parrot_hires_get_time() - start;
+    start                   = Parrot_hires_get_time();
+
+    POINTER_ARRAY_ITER(self->rescan,
+        PMC *pmc = (PMC *)ptr;
+
+        /* Skip PMCs freed since */
+        if (PObj_live_TEST(pmc) && !PObj_on_free_list_TEST(pmc)) {
+            if (PObj_custom_mark_TEST(pmc))
+                VTABLE_mark(interp, pmc);
+
+            if (PMC_metadata(pmc))
+                Parrot_gc_mark_PMC_alive(interp, PMC_metadata(pmc));
+        });
+
+    gc_ms2_mark_gray(interp, self, 0);
+    self->event.mark_time += Parrot_hires_get_time() - start;
+
+    Parrot_pa_destroy(interp, self->rescan);
+    self->rescan  = NULL;
+    self->marking = 0;
+}
+
+
+/*
+
+=item C<static int gc_ms2_mark_gray(PARROT_INTERP, MarkSweep_GC *self,
+UHUGEINTVAL deadline)>
+
+Marks the children of gray PMCs, painting the PMCs black, until none is left
+or the timer passed C<deadline>.  A C<deadline> of 0 means no limit.  Returns
+true when no gray PMC is left.
+
+PMCs of C<no_wb> classes and remembered ones stay gray, to be traced again
+when finishing the cycle.
+
+=cut
+
+*/
+
+static int
+gc_ms2_mark_gray(PARROT_INTERP, ARGIN(MarkSweep_GC *self),
+        UHUGEINTVAL deadline)
+{
+    ASSERT_ARGS(gc_ms2_mark_gray)
+    size_t count = 0;
+
+    while (self->gray.size) {
+        PMC * const pmc = self->gray.items[--self->gray.size];
+
+        /* Skip PMCs freed since */
+        if (!PObj_live_TEST(pmc) || PObj_on_free_list_TEST(pmc))
+            continue;
+
+        if (PObj_custom_mark_TEST(pmc))
+            VTABLE_mark(interp, pmc);
+
+        if (PMC_metadata(pmc))
+            Parrot_gc_mark_PMC_alive(interp, PMC_metadata(pmc));
+
+        if (PMC_has_no_wb(pmc))
+            gc_ms2_remember(interp, self, pmc);
+        else if (!PObj_GC_remembered_TEST(pmc))
+            PObj_GC_old_SET(pmc);
+
+        if (deadline && ++count % GC_MS2_SLICE_CHECK == 0
+        &&  Parrot_hires_get_time() > deadline)
+            break;
+    }
+
+    return !self->gray.size;
+}
+
+
+/*
+
+=item C<static void gc_ms2_push_gray(MarkSweep_Stack *stack, PMC *pmc)>
+
+Queues a marked PMC for marking its children.
+
+=cut
+
+*/
 
-    gc_ms2_compact_memory_pool(interp);
+static void
+gc_ms2_push_gray(ARGMOD(MarkSweep_Stack *stack), ARGIN(PMC *pmc))
+{
+    ASSERT_ARGS(gc_ms2_push_gray)
+
+    if (stack->size == stack->alloced)
+        gc_ms2_grow_stack(stack, 1);
+
+    stack->items[stack->size++] = pmc;
+}
+
+
+/*
+
+=item C<static void gc_ms2_grow_stack(MarkSweep_Stack *stack, size_t count)>
+
+Makes room for C<count> more PMCs on C<stack>.
+
+=cut
+
+*/
+
+static void
+gc_ms2_grow_stack(ARGMOD(MarkSweep_Stack *stack), size_t count)
+{
+    ASSERT_ARGS(gc_ms2_grow_stack)
+
+    if (stack->size + count > stack->alloced) {
+        size_t alloced = stack->alloced ? stack->alloced * 2 : 1024;
+
+        while (alloced < stack->size + count)
+            alloced *= 2;
+
+        stack->items   = (PMC **)mem_sys_realloc(stack->items,
+                            alloced * sizeof (PMC *));
+        stack->alloced = alloced;
+    }
+}
+
+
+/*
+
+=item C<static void gc_ms2_remember(PARROT_INTERP, MarkSweep_GC *self, PMC
+*pmc)>
+
+Adds a marked PMC to the PMCs traced again when finishing the marking cycle.
+
+=cut
+
+*/
+
+static void
+gc_ms2_remember(PARROT_INTERP, ARGIN(MarkSweep_GC *self), ARGIN(PMC *pmc))
+{
+    ASSERT_ARGS(gc_ms2_remember)
+
+    if (!PObj_GC_remembered_TEST(pmc)) {
+        PObj_GC_remembered_SET(pmc);
+        Parrot_pa_insert(interp, self->rescan, pmc);
+    }
+}
+
+
+/*
+
+=item C<static void gc_ms2_write_barrier(PARROT_INTERP, PMC *pmc)>
+
+Turns a black PMC, stored into while marking, gray again.  It stays gray until
+the cycle finishes, as C code may store more into it after the barrier.
+Outside of marking, only PMCs the lazy sweep has not painted white yet get
+here.
+
+=cut
+
+*/
+
+static void
+gc_ms2_write_barrier(PARROT_INTERP, ARGIN(PMC *pmc))
+{
+    ASSERT_ARGS(gc_ms2_write_barrier)
+    MarkSweep_GC * const self = (MarkSweep_GC *)interp->gc_sys->gc_private;
+
+    PObj_GC_old_CLEAR(pmc);
+
+    if (!self->marking)
+        return;
+
+    gc_ms2_remember(interp, self, pmc);
+    gc_ms2_push_gray(&self->gray, pmc);
 }
 
 
@@ -1125,24 +2741,52 @@ gc_ms2_sweep_pmc_pool(PARROT_INTERP,
 
         /* Paint live objects white */
         if (PObj_live_TEST(pmc))
-            PObj_live_CLEAR(pmc);
+            PObj_GC_generation_CLEARALL(pmc);
+
+        else if (!PObj_constant_TEST(pmc))
+            gc_ms2_sweep_dead_pmc(interp, pool, list, pmc););
+}
 
-        else if (!PObj_constant_TEST(pmc)) {
-            Parrot_pa_remove(interp, list, PMC2PAC(pmc)->ptr);
 
-            /* this is manual inlining of Parrot_pmc_destroy() */
-            if (PObj_custom_destroy_TEST(pmc))
-                VTABLE_destroy(interp, pmc);
+/*
 
-            if (pmc->vtable->attr_size && PMC_data(pmc))
-                Parrot_gc_free_pmc_attributes(interp, pmc);
-            PMC_data(pmc) = NULL;
+=item C<static void gc_ms2_sweep_dead_pmc(PARROT_INTERP, Pool_Allocator *pool,
+Parrot_Pointer_Array *list, PMC *pmc)>
 
-            PObj_on_free_list_SET(pmc);
-            PObj_gc_CLEAR(pmc);
+Destroys a dead PMC, and returns its header to the pool.
 
-            Parrot_gc_pool_free(interp, pool, ptr);
-        });
+=cut
+
+*/
+
+static void
+gc_ms2_sweep_dead_pmc(PARROT_INTERP,
+        ARGIN(Pool_Allocator *pool),
+        ARGIN(Parrot_Pointer_Array *list),
+        ARGIN(PMC *pmc))
+{
+    ASSERT_ARGS(gc_ms2_sweep_dead_pmc)
+    MarkSweep_GC * const self = (MarkSweep_GC *)interp->gc_sys->gc_private;
+
+    Parrot_pa_remove(interp, list, PMC2PAC(pmc)->ptr);
+
+    /* this is manual inlining of Parrot_pmc_destroy() */
+    if (PObj_custom_destroy_TEST(pmc))
+        VTABLE_destroy(interp, pmc);
+
+    ++self->event.freed_pmcs;
+    self->event.freed_bytes += sizeof (pmc_alloc_struct);
+
+    if (pmc->vtable->attr_size && PMC_data(pmc)) {
+        self->event.freed_bytes += pmc->vtable->attr_size;
+        Parrot_gc_free_pmc_attributes(interp, pmc);
+    }
+    PMC_data(pmc) = NULL;
+
+    PObj_on_free_list_SET(pmc);
+    PObj_gc_CLEAR(pmc);
+
+    Parrot_gc_pool_free(interp, pool, PMC2PAC(pmc));
 }
 
 
@@ -1192,8 +2836,6 @@ gc_ms2_sweep_string_pool(PARROT_INTERP,
 {
     ASSERT_ARGS(gc_ms2_sweep_string_pool)
 
-    MarkSweep_GC     *self = (MarkSweep_GC *)interp->gc_sys->gc_private;
-
     POINTER_ARRAY_ITER(list,
         STRING *obj = &(((string_alloc_struct*)ptr)->str);
 
@@ -1203,15 +2845,44 @@ gc_ms2_sweep_string_pool(PARROT_INTERP,
         if (PObj_live_TEST(obj))
             PObj_live_CLEAR(obj);
 
-        else if (!PObj_constant_TEST(obj)) {
-            Parrot_pa_remove(interp, list, STR2PAC(obj)->ptr);
-            if (Buffer_bufstart(obj) && !PObj_external_TEST(obj))
-                Parrot_gc_str_free_buffer_storage(interp, &self->string_gc, (Buffer*)obj);
+        else if (!PObj_constant_TEST(obj))
+            gc_ms2_sweep_dead_string(interp, pool, list, obj););
+}
+
+
+/*
 
-            PObj_on_free_list_SET(obj);
+=item C<static void gc_ms2_sweep_dead_string(PARROT_INTERP, Pool_Allocator
+*pool, Parrot_Pointer_Array *list, STRING *str)>
 
-            Parrot_gc_pool_free(interp, pool, ptr);
-        });
+Frees the storage of a dead STRING, and returns its header to the pool.
+
+=cut
+
+*/
+
+static void
+gc_ms2_sweep_dead_string(PARROT_INTERP,
+        ARGIN(Pool_Allocator *pool),
+        ARGIN(Parrot_Pointer_Array *list),
+        ARGIN(STRING *str))
+{
+    ASSERT_ARGS(gc_ms2_sweep_dead_string)
+    MarkSweep_GC * const self = (MarkSweep_GC *)interp->gc_sys->gc_private;
+
+    Parrot_pa_remove(interp, list, STR2PAC(str)->ptr);
+
+    ++self->event.freed_strings;
+    self->event.freed_bytes += sizeof (string_alloc_struct);
+
+    if (Buffer_bufstart(str) && !PObj_external_TEST(str)) {
+        self->event.freed_bytes += Buffer_buflen(str);
+        Parrot_gc_str_free_buffer_storage(interp, &self->string_gc, (Buffer*)str);
+    }
+
+    PObj_on_free_list_SET(str);
+
+    Parrot_gc_pool_free(interp, pool, STR2PAC(str));
 }
 
 
@@ -64,6 +64,15 @@ extern void *flush_reg_store(void);
    to allocate these things using mem_sys_allocate instead */
 #define GC_USE_FIXED_SIZE_ALLOCATOR 1
 
+/* PMCs of classes declared no_wb don't call the write barrier when stored
+   into, so a collector tracing them early has to trace them again */
+#define PMC_has_no_wb(pmc) ((pmc)->vtable->flags & VTABLE_NO_WB_FLAG)
+
+/* VTABLE_mark of classes declared parallel_mark only reads the PMC, so it can
+   run on several threads at once */
+#define PMC_has_parallel_mark(pmc) \
+    ((pmc)->vtable->flags & VTABLE_PARALLEL_MARK_FLAG)
+
 /* We're using this here to add an additional pointer to a PObj without
    having to actually add an entire pointer to every PObj-alike structure
    in Parrot. Astute observers may notice that if the PObj is comprised of
@@ -85,6 +94,24 @@ typedef enum _gc_skip_type_enum {
     GC_NEVER_SKIP       /* unused */
 } gc_skip_type_enum;
 
+/* Number of the latest collections GC_Statistics keeps the events of */
+#define GC_EVENTS_KEPT 64
+
+/* What a collection cost and freed. Times are in microseconds once recorded,
+   in timer ticks while a collector adds them up */
+typedef struct GC_Event {
+    size_t      run;                /* gc_mark_runs when recorded */
+    UHUGEINTVAL trace_time;         /* tracing the roots and system stack */
+    UHUGEINTVAL mark_time;          /* marking from the roots */
+    UHUGEINTVAL sweep_pmc_time;
+    UHUGEINTVAL sweep_string_time;
+    UHUGEINTVAL compact_time;       /* compacting STRINGs and attributes */
+    size_t      live_pmcs;
+    size_t      freed_pmcs;
+    size_t      freed_strings;
+    size_t      freed_bytes;        /* headers, attributes and buffers */
+} GC_Event;
+
 /** statistics for GC **/
 typedef struct GC_Statistics {
     size_t  gc_mark_runs;       /* Number of times we've done a mark run */
@@ -114,6 +141,10 @@ typedef struct GC_Statistics {
                                        * the last GC run */
     UINTVAL memory_collected;     /* Total amount of memory copied
                                      during collection */
+    GC_Event events[GC_EVENTS_KEPT];  /* Ring of the latest collections */
+    size_t   num_events;          /* Collections recorded. The latest is
+                                   * events[(num_events - 1) %
+                                   * GC_EVENTS_KEPT] */
 
 } GC_Statistics;
 
@@ -192,6 +223,9 @@ typedef struct GC_Subsystem {
      *These will be called via the GC API functions Parrot_gc_func_name
      *e.g. read barrier && write barrier hooks can go here later ...*/
 
+    /* Called by Parrot_gc_write_barrier for old PMCs */
+    void (*write_barrier)(PARROT_INTERP, PMC *);
+
     /* Holds system-specific data structures */
     void * gc_private;
 } GC_Subsystem;
@@ -408,6 +442,11 @@ void Parrot_gc_clear_live_bits(SHIM_INTERP,
     ARGIN(const Fixed_Size_Pool *pool))
         __attribute__nonnull__(2);
 
+void Parrot_gc_record_event(PARROT_INTERP, ARGMOD(GC_Event *event))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*event);
+
 void Parrot_gc_run_init(SHIM_INTERP, ARGMOD(Memory_Pools *mem_pools))
         __attribute__nonnull__(2)
         FUNC_MODIFIES(*mem_pools);
@@ -453,6 +492,9 @@ int Parrot_gc_trace_root(PARROT_INTERP,
     , PARROT_ASSERT_ARG(new_arena))
 #define ASSERT_ARGS_Parrot_gc_clear_live_bits __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(pool))
+#define ASSERT_ARGS_Parrot_gc_record_event __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(event))
 #define ASSERT_ARGS_Parrot_gc_run_init __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(mem_pools))
 #define ASSERT_ARGS_Parrot_gc_sweep_pool __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
@@ -639,6 +681,17 @@ void Parrot_gc_inf_init(PARROT_INTERP)
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 /* HEADERIZER END: src/gc/gc_inf.c */
 
+/* HEADERIZER BEGIN: src/gc/gc_gms.c */
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+
+void Parrot_gc_gms_init(PARROT_INTERP)
+        __attribute__nonnull__(1);
+
+#define ASSERT_ARGS_Parrot_gc_gms_init __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+/* HEADERIZER END: src/gc/gc_gms.c */
+
 /* HEADERIZER BEGIN: src/gc/gc_ms2.c */
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 
@@ -680,9 +733,8 @@ void Parrot_gc_str_finalize(SHIM_INTERP, ARGMOD(String_GC *gc))
         FUNC_MODIFIES(*gc);
 
 void Parrot_gc_str_free_buffer_storage(SHIM_INTERP,
-    ARGIN(String_GC *gc),
+    SHIM(String_GC *gc),
     ARGMOD(Buffer *b))
-        __attribute__nonnull__(2)
         __attribute__nonnull__(3)
         FUNC_MODIFIES(*b);
 
@@ -726,8 +778,7 @@ void Parrot_gc_str_reallocate_string_storage(PARROT_INTERP,
        PARROT_ASSERT_ARG(gc))
 #define ASSERT_ARGS_Parrot_gc_str_free_buffer_storage \
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
-       PARROT_ASSERT_ARG(gc) \
-    , PARROT_ASSERT_ARG(b))
+       PARROT_ASSERT_ARG(b))
 #define ASSERT_ARGS_Parrot_gc_str_initialize __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(gc))
@@ -48,6 +48,9 @@ static void free_pmc_in_pool(PARROT_INTERP,
         __attribute__nonnull__(4)
         FUNC_MODIFIES(*p);
 
+static void mark_root_frames(PARROT_INTERP)
+        __attribute__nonnull__(1);
+
 PARROT_WARN_UNUSED_RESULT
 PARROT_CANNOT_RETURN_NULL
 static Fixed_Size_Pool * new_bufferlike_pool(PARROT_INTERP,
@@ -84,6 +87,8 @@ static Fixed_Size_Pool * new_string_pool(PARROT_INTERP,
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(mem_pools) \
     , PARROT_ASSERT_ARG(p))
+#define ASSERT_ARGS_mark_root_frames __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_new_bufferlike_pool __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(mem_pools))
@@ -203,6 +208,7 @@ Parrot_gc_trace_root(PARROT_INTERP,
 
     /* mark caches and freelists */
     mark_object_cache(interp);
+    Parrot_pcc_mark_context_pool(interp);
 
     /* Now mark the class hash */
     Parrot_gc_mark_PMC_alive(interp, interp->class_hash);
@@ -225,6 +231,10 @@ Parrot_gc_trace_root(PARROT_INTERP,
     if (!PMC_IS_NULL(interp->final_exception))
         Parrot_gc_mark_PMC_alive(interp, interp->final_exception);
 
+    /* Mark the PMCs of the C code calling into Parrot */
+    if (interp->gc_root_frames)
+        mark_root_frames(interp);
+
     if (trace == GC_TRACE_FULL)
         trace_system_areas(interp, mem_pools);
 
@@ -239,6 +249,31 @@ Parrot_gc_trace_root(PARROT_INTERP,
     return 1;
 }
 
+/*
+
+=item C<static void mark_root_frames(PARROT_INTERP)>
+
+Marks the PMCs of all the root frames pushed by C code calling into Parrot.
+See C<PARROT_GC_PUSH_ROOT_FRAME> in F<include/parrot/gc_api.h>.
+
+=cut
+
+*/
+
+static void
+mark_root_frames(PARROT_INTERP)
+{
+    ASSERT_ARGS(mark_root_frames)
+    const Parrot_GC_Root_Frame *frame;
+
+    for (frame = interp->gc_root_frames; frame; frame = frame->prev) {
+        size_t i;
+
+        for (i = 0; i < frame->num_roots; ++i)
+            Parrot_gc_mark_PMC_alive(interp, frame->roots[i]);
+    }
+}
+
 
 /*
 
@@ -314,6 +349,63 @@ next:
 }
 
 
+/*
+
+=item C<void Parrot_gc_record_event(PARROT_INTERP, GC_Event *event)>
+
+Records the collection C<event> describes in the ring of the latest
+collections, converting its times from timer ticks to microseconds, and
+writes it to C<interp-E<gt>gc_log> if any.  Clears C<event>, so the collector
+can add the next collection up in it.
+
+Each line of the log is one collection, C<gc> followed by C<key=value> pairs
+with the keys C<interpinfo .INTERPINFO_GC_EVENTS> uses.
+
+=cut
+
+*/
+
+void
+Parrot_gc_record_event(PARROT_INTERP, ARGMOD(GC_Event *event))
+{
+    ASSERT_ARGS(Parrot_gc_record_event)
+    GC_Statistics * const stats = &interp->gc_sys->stats;
+    GC_Event      * const entry =
+        &stats->events[stats->num_events++ % GC_EVENTS_KEPT];
+    const UINTVAL         tick  = Parrot_hires_get_tick_duration();
+
+    entry->run               = stats->gc_mark_runs;
+    entry->trace_time        = event->trace_time        * tick / 1000;
+    entry->mark_time         = event->mark_time         * tick / 1000;
+    entry->sweep_pmc_time    = event->sweep_pmc_time    * tick / 1000;
+    entry->sweep_string_time = event->sweep_string_time * tick / 1000;
+    entry->compact_time      = event->compact_time      * tick / 1000;
+    entry->live_pmcs         = event->live_pmcs;
+    entry->freed_pmcs        = event->freed_pmcs;
+    entry->freed_strings     = event->freed_strings;
+    entry->freed_bytes       = event->freed_bytes;
+
+    memset(event, 0, sizeof (GC_Event));
+
+    if (interp->gc_log) {
+        fprintf(interp->gc_log, "gc run=%lu trace=%lu mark=%lu sweep_pmc=%lu "
+                "sweep_string=%lu compact=%lu live_pmcs=%lu freed_pmcs=%lu "
+                "freed_strings=%lu freed_bytes=%lu\n",
+                (unsigned long)entry->run,
+                (unsigned long)entry->trace_time,
+                (unsigned long)entry->mark_time,
+                (unsigned long)entry->sweep_pmc_time,
+                (unsigned long)entry->sweep_string_time,
+                (unsigned long)entry->compact_time,
+                (unsigned long)entry->live_pmcs,
+                (unsigned long)entry->freed_pmcs,
+                (unsigned long)entry->freed_strings,
+                (unsigned long)entry->freed_bytes);
+        fflush(interp->gc_log);
+    }
+}
+
+
 /*
 
 =item C<INTVAL contained_in_pool(const Fixed_Size_Pool *pool, const void *ptr)>
@@ -72,6 +72,11 @@ static void compact_pool(PARROT_INTERP,
         FUNC_MODIFIES(*stats)
         FUNC_MODIFIES(*pool);
 
+static void count_live_callback(SHIM_INTERP,
+    ARGIN(Buffer *b),
+    SHIM(void *data))
+        __attribute__nonnull__(2);
+
 static void debug_print_buf(PARROT_INTERP, ARGIN(const Buffer *b))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
@@ -79,18 +84,17 @@ static void debug_print_buf(PARROT_INTERP, ARGIN(const Buffer *b))
 static void free_memory_pool(ARGFREE(Variable_Size_Pool *pool));
 static void free_old_mem_blocks(
      ARGMOD(GC_Statistics *stats),
-    ARGMOD(Variable_Size_Pool *pool),
-    ARGMOD(Memory_Block *new_block),
-    UINTVAL total_size)
+    ARGMOD(Variable_Size_Pool *pool))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2)
-        __attribute__nonnull__(3)
         FUNC_MODIFIES(*stats)
-        FUNC_MODIFIES(*pool)
-        FUNC_MODIFIES(*new_block);
+        FUNC_MODIFIES(*pool);
 
-static int is_block_almost_full(ARGIN(const Memory_Block *block))
-        __attribute__nonnull__(1);
+static int is_block_sparse(
+    ARGIN(const Variable_Size_Pool *pool),
+    ARGIN(const Memory_Block *block))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
 
 PARROT_MALLOC
 PARROT_CANNOT_RETURN_NULL
@@ -131,9 +135,11 @@ static Variable_Size_Pool * new_memory_pool(
     size_t min_block,
     NULLOK(compact_f compact));
 
-PARROT_CANNOT_RETURN_NULL
-static UINTVAL pad_pool_size(ARGIN(const Variable_Size_Pool *pool))
-        __attribute__nonnull__(1);
+static UINTVAL pad_pool_size(PARROT_INTERP,
+    ARGMOD(Variable_Size_Pool *pool))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*pool);
 
 #define ASSERT_ARGS_aligned_mem __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(mem))
@@ -148,16 +154,18 @@ static UINTVAL pad_pool_size(ARGIN(const Variable_Size_Pool *pool))
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(stats) \
     , PARROT_ASSERT_ARG(pool))
+#define ASSERT_ARGS_count_live_callback __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(b))
 #define ASSERT_ARGS_debug_print_buf __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(b))
 #define ASSERT_ARGS_free_memory_pool __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
 #define ASSERT_ARGS_free_old_mem_blocks __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(stats) \
-    , PARROT_ASSERT_ARG(pool) \
-    , PARROT_ASSERT_ARG(new_block))
-#define ASSERT_ARGS_is_block_almost_full __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
-       PARROT_ASSERT_ARG(block))
+    , PARROT_ASSERT_ARG(pool))
+#define ASSERT_ARGS_is_block_sparse __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(pool) \
+    , PARROT_ASSERT_ARG(block))
 #define ASSERT_ARGS_mem_allocate __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(stats) \
@@ -173,7 +181,8 @@ static UINTVAL pad_pool_size(ARGIN(const Variable_Size_Pool *pool))
     , PARROT_ASSERT_ARG(new_pool_ptr))
 #define ASSERT_ARGS_new_memory_pool __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
 #define ASSERT_ARGS_pad_pool_size __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
-       PARROT_ASSERT_ARG(pool))
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pool))
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 /* HEADERIZER END: static */
 
@@ -433,17 +442,12 @@ Parrot_gc_str_reallocate_string_storage(PARROT_INTERP,
     mem = (char *)mem_allocate(interp, &interp->gc_sys->stats, new_size, pool);
     mem += sizeof (void *);
 
-    /* Update Memory_Block usage */
     /* We must not reallocate non-movable buffers! */
     PARROT_ASSERT(PObj_is_movable_TESTALL(str));
 
     /* We must not reallocate shared buffers! */
     PARROT_ASSERT(!(*Buffer_bufflagsptr(str) & Buffer_shared_FLAG));
 
-    /* Decrease usage */
-    PARROT_ASSERT(Buffer_pool(str));
-    Buffer_pool(str)->freed += old_size;
-
     /* copy mem from strstart, *not* bufstart */
     oldmem             = str->strstart;
     Buffer_bufstart(str) = (void *)mem;
@@ -487,34 +491,11 @@ reuse later.
 
 void
 Parrot_gc_str_free_buffer_storage(SHIM_INTERP,
-        ARGIN(String_GC *gc),
+        SHIM(String_GC *gc),
         ARGMOD(Buffer *b))
 {
     ASSERT_ARGS(Parrot_gc_str_free_buffer_storage)
-    Variable_Size_Pool * const mem_pool = gc->memory_pool;
-
-    /* If there is no allocated buffer - bail out */
-    if (!Buffer_buflen(b))
-        return;
-
-    if (mem_pool) {
-        /* Update Memory_Block usage */
-        if (PObj_is_movable_TESTALL(b)) {
-            INTVAL *buffer_flags = Buffer_bufflagsptr(b);
-
-            /* Mask low 2 bits used for flags */
-            Memory_Block * block = Buffer_pool(b);
-
-            PARROT_ASSERT(block);
-
-            /* We can have shared buffers. Don't count them (yet) */
-            if (!(*buffer_flags & Buffer_shared_FLAG)) {
-                block->freed  += ALIGNED_STRING_SIZE(Buffer_buflen(b));
-            }
-
-        }
-    }
-
+    /* Block usage is measured from the live buffers when compacting */
     Buffer_buflen(b) = 0;
 }
 
@@ -789,6 +770,12 @@ debug_print_buf(PARROT_INTERP, ARGIN(const Buffer *b))
 
 =head2 Compaction Code
 
+Compaction works per block.  The live buffers are counted first, so every
+block knows how many of its bytes are still in use.  Only sparse blocks are
+evacuated: their live buffers are copied, bump-pointer style, into the free
+tail of the top block or into one new block, and the emptied blocks are
+freed.  Dense blocks stay where they are and their buffers are not copied.
+
 =over 4
 
 =item C<static void compact_pool(PARROT_INTERP, GC_Statistics *stats,
@@ -808,6 +795,7 @@ compact_pool(PARROT_INTERP,
 {
     ASSERT_ARGS(compact_pool)
     UINTVAL       total_size;
+    char         *old_top;
 
     /* Contains new_block and cur_spot */
     string_callback_data cb_data;
@@ -824,21 +812,26 @@ compact_pool(PARROT_INTERP,
     stats->header_allocs_since_last_collect = 0;
     ++stats->gc_collect_runs;
 
-    /* Snag a block big enough for everything */
-    total_size = pad_pool_size(pool);
+    /* Pick the blocks to evacuate and the room their live buffers need */
+    total_size = pad_pool_size(interp, pool);
 
     if (total_size == 0) {
-        free_old_mem_blocks(stats, pool, pool->top_block, total_size);
+        free_old_mem_blocks(stats, pool);
         Parrot_unblock_GC_sweep(interp);
         return;
     }
 
-    alloc_new_block(stats, total_size, pool, "inside compact");
+    /* Copy into the tail of the top block when it is kept and has room */
+    if (pool->top_block->evacuate
+    ||  pool->top_block->free < total_size + WORD_ALIGN_1)
+        alloc_new_block(stats, total_size, pool, "inside compact");
 
     cb_data.new_block = pool->top_block;
 
-    /* Start at the beginning */
-    cb_data.cur_spot  = cb_data.new_block->start;
+    /* Start at the first aligned spot after the used part */
+    old_top           = cb_data.new_block->top;
+    cb_data.cur_spot  = (char *)(((UINTVAL)old_top + WORD_ALIGN_1)
+                                 & WORD_ALIGN_MASK);
 
     /* Run through all the Buffer header pools and copy */
     interp->gc_sys->iterate_live_strings(interp, move_buffer_callback, &cb_data);
@@ -854,14 +847,30 @@ compact_pool(PARROT_INTERP,
     /* How much is free. That's the total size minus the amount we used */
     cb_data.new_block->free     = cb_data.new_block->size
                                   - (cb_data.cur_spot - cb_data.new_block->start);
-    stats->memory_collected += (cb_data.cur_spot - cb_data.new_block->start);
-    stats->memory_used      += (cb_data.cur_spot - cb_data.new_block->start);
+    stats->memory_collected += (cb_data.cur_spot - old_top);
+    stats->memory_used      += (cb_data.cur_spot - old_top);
 
-    free_old_mem_blocks(stats, pool, cb_data.new_block, total_size);
+    free_old_mem_blocks(stats, pool);
 
     Parrot_unblock_GC_sweep(interp);
 }
 
+/*
+=item C<static void count_live_callback(PARROT_INTERP, Buffer *b, void *data)>
+
+Callback for live STRING/Buffer to account its storage to its block.
+
+=cut
+*/
+static void
+count_live_callback(SHIM_INTERP, ARGIN(Buffer *b), SHIM(void *data))
+{
+    ASSERT_ARGS(count_live_callback)
+
+    if (Buffer_buflen(b) && PObj_is_movable_TESTALL(b))
+        Buffer_pool(b)->live += ALIGNED_STRING_SIZE(Buffer_buflen(b));
+}
+
 /*
 =item C<static void move_buffer_callback(PARROT_INTERP, Buffer *b, void *data)>
 
@@ -878,7 +887,7 @@ move_buffer_callback(PARROT_INTERP, ARGIN(Buffer *b), ARGIN(void *data))
     if (Buffer_buflen(b) && PObj_is_movable_TESTALL(b)) {
         Memory_Block *old_block = Buffer_pool(b);
 
-        if (!is_block_almost_full(old_block))
+        if (old_block->evacuate)
             cb->cur_spot = move_one_buffer(interp, cb->new_block, b, cb->cur_spot);
     }
 
@@ -886,50 +895,45 @@ move_buffer_callback(PARROT_INTERP, ARGIN(Buffer *b), ARGIN(void *data))
 
 /*
 
-=item C<static UINTVAL pad_pool_size(const Variable_Size_Pool *pool)>
-
-Calculate the size of the new pool. The currently used size equals the total
-size minus the reclaimable size. Add a minimum block to the current amount, so
-we can avoid having to allocate it in the future.
-
-Returns 0 if all blocks below the top block are almost full. In this case
-compacting is not needed.
+=item C<static UINTVAL pad_pool_size(PARROT_INTERP, Variable_Size_Pool *pool)>
 
-TODO - Big blocks
+Calculate the size needed to evacuate the sparse blocks of the pool.  Counts
+the live bytes of every block, flags the blocks which are worth evacuating
+and returns the sum of their live bytes.
 
-Currently all available blocks are compacted into one new
-block with total_size. This is suboptimal, if the block has
-just one live item from a big allocation.
-
-But currently it's unknown if the buffer memory is alive
-as the live bits are in Buffer headers. We have to run the
-compaction loop to check liveness. OTOH if this compaction
-is running through all the buffer headers, there is no
-relation to the block.
-
-Moving the live bit into the buffer thus also solves this
-problem easily.
+Returns 0 if no sparse block holds live buffers. In this case copying is not
+needed, but the sparse blocks can still be freed.
 
 =cut
 
 */
 
-PARROT_CANNOT_RETURN_NULL
 static UINTVAL
-pad_pool_size(ARGIN(const Variable_Size_Pool *pool))
+pad_pool_size(PARROT_INTERP, ARGMOD(Variable_Size_Pool *pool))
 {
     ASSERT_ARGS(pad_pool_size)
-    Memory_Block *cur_block = pool->top_block->prev;
+    Memory_Block *cur_block;
 
     UINTVAL total_size   = 0;
 #if RESOURCE_DEBUG
-    size_t  total_blocks = 1;
+    size_t  total_blocks = 0;
+    size_t  sparse_blocks = 0;
 #endif
 
-    while (cur_block) {
-        if (!is_block_almost_full(cur_block))
-            total_size += cur_block->size - cur_block->freed - cur_block->free;
-        cur_block   = cur_block->prev;
+    for (cur_block = pool->top_block; cur_block; cur_block = cur_block->prev)
+        cur_block->live = 0;
+
+    interp->gc_sys->iterate_live_strings(interp, count_live_callback, NULL);
+
+    for (cur_block = pool->top_block; cur_block; cur_block = cur_block->prev) {
+        cur_block->evacuate = is_block_sparse(pool, cur_block);
+
+        if (cur_block->evacuate) {
+            total_size += cur_block->live;
+#if RESOURCE_DEBUG
+            ++sparse_blocks;
+#endif
+        }
 #if RESOURCE_DEBUG
         ++total_blocks;
 #endif
@@ -938,17 +942,14 @@ pad_pool_size(ARGIN(const Variable_Size_Pool *pool))
     if (total_size == 0)
         return 0;
 
-    cur_block = pool->top_block;
-    if (!is_block_almost_full(cur_block))
-        total_size += cur_block->size - cur_block->freed - cur_block->free;
-
     /* this makes for ever increasing allocations but fewer collect runs */
 #if WE_WANT_EVER_GROWING_ALLOCATIONS
     total_size += pool->minimum_block_size;
 #endif
 
 #if RESOURCE_DEBUG
-    fprintf(stderr, "Total blocks: %d\n", total_blocks);
+    fprintf(stderr, "Total blocks: %d, sparse: %d\n",
+        total_blocks, sparse_blocks);
 #endif
 
     return total_size;
@@ -1056,15 +1057,13 @@ move_one_buffer(PARROT_INTERP, ARGIN(Memory_Block *pool),
 /*
 
 =item C<static void free_old_mem_blocks( GC_Statistics *stats,
-Variable_Size_Pool *pool, Memory_Block *new_block, UINTVAL total_size)>
+Variable_Size_Pool *pool)>
 
-The compact_pool operation collects disjointed blocks of memory allocated on a
-given pool's free list into one large block of memory, setting it as the new
-top block for the pool. Once that is done, and all items have been moved into
-the new block of memory, this function iterates through the old blocks and
-frees each one. It also performs the necessary housekeeping to record the
-freed memory blocks. At the end of this function, the pool will have only one
-block of memory on its free list.
+The compact_pool operation moves the live buffers out of the sparse blocks.
+Once that is done, this function frees each of the evacuated blocks and
+unlinks it from the pool.  An evacuated top block is reset instead, so it can
+be reused for bump-pointer allocation. It also performs the necessary
+housekeeping to record the freed memory blocks.
 
 =cut
 
@@ -1073,21 +1072,27 @@ block of memory on its free list.
 static void
 free_old_mem_blocks(
         ARGMOD(GC_Statistics *stats),
-        ARGMOD(Variable_Size_Pool *pool),
-        ARGMOD(Memory_Block *new_block),
-        UINTVAL total_size)
+        ARGMOD(Variable_Size_Pool *pool))
 {
     ASSERT_ARGS(free_old_mem_blocks)
-    Memory_Block *prev_block = new_block;
-    Memory_Block *cur_block  = new_block->prev;
+    Memory_Block *prev_block = pool->top_block;
+    Memory_Block *cur_block  = prev_block->prev;
+
+    if (prev_block->evacuate) {
+        stats->memory_used -= prev_block->size - prev_block->free;
+        prev_block->top      = prev_block->start;
+        prev_block->free     = prev_block->size;
+        prev_block->evacuate = 0;
+    }
 
-    PARROT_ASSERT(new_block == pool->top_block);
+    pool->total_allocated = prev_block->size;
 
     while (cur_block) {
         Memory_Block * const next_block = cur_block->prev;
 
-        if (is_block_almost_full(cur_block)) {
+        if (!cur_block->evacuate) {
             /* Skip block */
+            pool->total_allocated += cur_block->size;
             prev_block = cur_block;
             cur_block  = next_block;
         }
@@ -1103,39 +1108,47 @@ free_old_mem_blocks(
 
             /* Unlink it from list */
             prev_block->prev = next_block;
+            if (next_block)
+                next_block->next = prev_block;
         }
     }
 
     /* Terminate list */
     prev_block->prev = NULL;
 
-
-    /* ANR: I suspect this should be set to new_block->size, instead of passing
-     * in the raw value of total_size, because alloc_new_block pads the size of
-     * the new block under certain conditions. Leaving it unmodified for now,
-     * so this refactor has no functionality changes, only code cleanups.*/
-    pool->total_allocated        = total_size;
     pool->guaranteed_reclaimable = 0;
     pool->possibly_reclaimable   = 0;
 }
 
 /*
 
-=item C<static int is_block_almost_full(const Memory_Block *block)>
+=item C<static int is_block_sparse(const Variable_Size_Pool *pool, const
+Memory_Block *block)>
 
-Tests if the block is almost full and should be skipped during compacting.
+Tests if the block is sparse enough to be evacuated during compacting.
 
-Returns true if less that 20% of block is available
+Returns true if at least 20% of the block would be reclaimed.  Only the bytes
+of live buffers count as used; the unallocated tail of the top block doesn't
+count as reclaimable because new buffers are still bumped into it.
 
 =cut
 
 */
 
 static int
-is_block_almost_full(ARGIN(const Memory_Block *block))
+is_block_sparse(ARGIN(const Variable_Size_Pool *pool),
+        ARGIN(const Memory_Block *block))
 {
-    ASSERT_ARGS(is_block_almost_full)
-    return 5 * (block->free + block->freed) < block->size;
+    ASSERT_ARGS(is_block_sparse)
+    const size_t used = block == pool->top_block
+                      ? block->size - block->free
+                      : block->size;
+
+    /* Shared buffers are counted once per header */
+    if (block->live >= used)
+        return 0;
+
+    return 5 * (used - block->live) >= block->size;
 }
 
 /*
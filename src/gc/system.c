@@ -227,6 +227,10 @@ the interpreter's lifecycle. We trace until the address of another local stack
 variable in this function, which should be at the "top" of the stack. For this
 reason, this function must never be inlined.
 
+With C<< interp->gc_precise_roots >> set, the trace starts at the innermost
+root frame instead: the frames below it belong to C code which called into
+Parrot, and the PMCs this code holds are in the root frames.
+
 =cut
 
 */
@@ -240,7 +244,9 @@ trace_system_stack(PARROT_INTERP, ARGIN_NULLOK(const Memory_Pools *mem_pools))
        "top" of the stack. A value stored in interp->lo_var_ptr represents
        the "bottom" of the stack. We must trace the entire area between the
        top and bottom. */
-    const size_t lo_var_ptr = (size_t)interp->lo_var_ptr;
+    const size_t lo_var_ptr = interp->gc_precise_roots && interp->gc_root_frames
+                            ? (size_t)interp->gc_root_frames
+                            : (size_t)interp->lo_var_ptr;
     PARROT_ASSERT(lo_var_ptr);
 
     trace_mem_block(interp, mem_pools, (size_t)lo_var_ptr,
@@ -25,8 +25,11 @@ typedef struct Memory_Block {
     char *start;
     char *top;
 
-    /* Amount of freed memory. Used in compact_pool */
-    size_t freed;
+    /* Bytes held by live buffers, measured by compact_pool */
+    size_t live;
+
+    /* Set by compact_pool for sparse blocks to be evacuated */
+    int evacuate;
 } Memory_Block;
 
 typedef struct Variable_Size_Pool {
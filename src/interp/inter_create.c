@@ -165,6 +165,7 @@ allocate_interpreter(ARGIN_NULLOK(Interp *parent), INTVAL flags)
                                     ? parent->gc_sys->sys_type
                                     : PARROT_GC_DEFAULT_TYPE;
     interp->gc_threshold     = GC_DYNAMIC_THRESHOLD_DEFAULT;
+    interp->gc_overhead      = GC_OVERHEAD_DEFAULT;
 
     /* Done. Return and be done with it */
     return interp;
@@ -410,6 +411,13 @@ Parrot_really_destroy(PARROT_INTERP, SHIM(int exit_code), SHIM(void *arg))
     }
   */
 
+    /* the GC doesn't log the final run */
+    if (interp->gc_log) {
+        if (interp->gc_log != stderr)
+            fclose(interp->gc_log);
+        interp->gc_log = NULL;
+    }
+
     /* we destroy all child interpreters and the last one too,
      * if the --leak-test commandline was given */
     if (! (interp->parent_interpreter
@@ -439,6 +447,9 @@ Parrot_really_destroy(PARROT_INTERP, SHIM(int exit_code), SHIM(void *arg))
     /* cache structure */
     destroy_object_cache(interp);
 
+    /* recycled contexts, already swept above */
+    Parrot_pcc_free_context_pool(interp);
+
     if (interp->evc_func_table) {
         mem_gc_free(interp, interp->evc_func_table);
         interp->evc_func_table      = NULL;
@@ -319,14 +319,19 @@ interpinfo_p(PARROT_INTERP, INTVAL what)
         result = Parrot_pcc_get_sub(interp, CURRENT_CONTEXT(interp));
         break;
       case CURRENT_CONT:
+        PARROT_CONTEXT_CAPTURED(interp);
         result = Parrot_pcc_get_continuation(interp, CURRENT_CONTEXT(interp));
         break;
       case CURRENT_OBJECT:
         result = Parrot_pcc_get_object(interp, CURRENT_CONTEXT(interp));
         break;
       case CURRENT_LEXPAD:
+        PARROT_CONTEXT_CAPTURED(interp);
         result = Parrot_pcc_get_lex_pad(interp, CURRENT_CONTEXT(interp));
         break;
+      case GC_EVENTS:
+        result = Parrot_gc_recent_events(interp);
+        break;
       default:        /* or a warning only? */
         Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_UNIMPLEMENTED,
                 "illegal argument in interpinfo");
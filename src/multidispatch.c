@@ -83,21 +83,45 @@ static PMC* mmd_build_type_tuple_from_type_list(PARROT_INTERP,
 
 PARROT_WARN_UNUSED_RESULT
 PARROT_CAN_RETURN_NULL
-static STRING * mmd_cache_key_from_types(PARROT_INTERP,
-    ARGIN(const char *name),
-    ARGIN(PMC *types))
+static MMD_Cache_entry * mmd_cache_find(
+    ARGIN(const MMD_Cache *cache),
+    ARGIN_NULLOK(const char *name),
+    UINTVAL hashval,
+    INTVAL num_types,
+    ARGIN(const INTVAL *types))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(5);
+
+static void mmd_cache_grow(PARROT_INTERP, ARGMOD(MMD_Cache *cache))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2)
+        FUNC_MODIFIES(*cache);
+
+PARROT_PURE_FUNCTION
+PARROT_WARN_UNUSED_RESULT
+static UINTVAL mmd_cache_hash(
+    ARGIN_NULLOK(const char *name),
+    INTVAL num_types,
+    ARGIN(const INTVAL *types))
         __attribute__nonnull__(3);
 
 PARROT_WARN_UNUSED_RESULT
-PARROT_CAN_RETURN_NULL
-static STRING * mmd_cache_key_from_values(PARROT_INTERP,
-    ARGIN(const char *name),
-    ARGIN(PMC *values))
+static INTVAL mmd_cache_ids_from_types(PARROT_INTERP,
+    ARGIN(PMC *type_tuple),
+    ARGOUT(INTVAL *types))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2)
-        __attribute__nonnull__(3);
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*types);
+
+PARROT_WARN_UNUSED_RESULT
+static INTVAL mmd_cache_ids_from_values(PARROT_INTERP,
+    ARGIN(PMC *values),
+    ARGOUT(INTVAL *types))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*types);
 
 PARROT_WARN_UNUSED_RESULT
 PARROT_CAN_RETURN_NULL
@@ -128,6 +152,17 @@ static void mmd_search_global(PARROT_INTERP,
         __attribute__nonnull__(2)
         __attribute__nonnull__(3);
 
+PARROT_WARN_UNUSED_RESULT
+static INTVAL mmd_type_ids_from_c_args(PARROT_INTERP,
+    ARGIN(const char *arg_sig),
+    ARGIN(PMC *call_obj),
+    ARGOUT(INTVAL *types))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4)
+        FUNC_MODIFIES(*types);
+
 PARROT_WARN_UNUSED_RESULT
 PARROT_CAN_RETURN_NULL
 static PMC * Parrot_mmd_get_cached_multi_sig(PARROT_INTERP,
@@ -167,14 +202,22 @@ static PMC * Parrot_mmd_sort_candidates(PARROT_INTERP,
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(type_list))
-#define ASSERT_ARGS_mmd_cache_key_from_types __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+#define ASSERT_ARGS_mmd_cache_find __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(cache) \
+    , PARROT_ASSERT_ARG(types))
+#define ASSERT_ARGS_mmd_cache_grow __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
-    , PARROT_ASSERT_ARG(name) \
+    , PARROT_ASSERT_ARG(cache))
+#define ASSERT_ARGS_mmd_cache_hash __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(types))
+#define ASSERT_ARGS_mmd_cache_ids_from_types __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(type_tuple) \
     , PARROT_ASSERT_ARG(types))
-#define ASSERT_ARGS_mmd_cache_key_from_values __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+#define ASSERT_ARGS_mmd_cache_ids_from_values __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
-    , PARROT_ASSERT_ARG(name) \
-    , PARROT_ASSERT_ARG(values))
+    , PARROT_ASSERT_ARG(values) \
+    , PARROT_ASSERT_ARG(types))
 #define ASSERT_ARGS_mmd_cvt_to_types __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(multi_sig))
@@ -191,6 +234,11 @@ static PMC * Parrot_mmd_sort_candidates(PARROT_INTERP,
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(name) \
     , PARROT_ASSERT_ARG(cl))
+#define ASSERT_ARGS_mmd_type_ids_from_c_args __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(arg_sig) \
+    , PARROT_ASSERT_ARG(call_obj) \
+    , PARROT_ASSERT_ARG(types))
 #define ASSERT_ARGS_Parrot_mmd_get_cached_multi_sig \
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
@@ -267,23 +315,28 @@ Parrot_mmd_multi_dispatch_from_c_args(PARROT_INTERP,
     PMC *call_obj, *sub;
     va_list args;
     const char *arg_sig, *ret_sig;
+    INTVAL types[MMD_CACHE_MAX_TYPES];
+    INTVAL num_types;
 
     Parrot_pcc_split_signature_string(sig, &arg_sig, &ret_sig);
 
     va_start(args, sig);
     call_obj = Parrot_pcc_build_call_from_varargs(interp, PMCNULL, arg_sig, &args);
 
-    /* Check the cache. */
-    sub = Parrot_mmd_cache_lookup_by_types(interp, interp->op_mmd_cache, name,
-            VTABLE_get_pmc(interp, call_obj));
+    /* Check the cache, without building the type tuple of the call. */
+    num_types = mmd_type_ids_from_c_args(interp, arg_sig, call_obj, types);
+    sub       = num_types < 0
+              ? PMCNULL
+              : Parrot_mmd_cache_lookup_by_ids(interp, interp->op_mmd_cache,
+                    name, num_types, types);
 
     if (PMC_IS_NULL(sub)) {
         sub = Parrot_mmd_find_multi_from_sig_obj(interp,
             Parrot_str_new_constant(interp, name), call_obj);
 
-        if (!PMC_IS_NULL(sub))
-            Parrot_mmd_cache_store_by_types(interp, interp->op_mmd_cache, name,
-                    VTABLE_get_pmc(interp, call_obj), sub);
+        if (!PMC_IS_NULL(sub) && num_types >= 0)
+            Parrot_mmd_cache_store_by_ids(interp, interp->op_mmd_cache, name,
+                    num_types, types, sub);
     }
 
     if (PMC_IS_NULL(sub))
@@ -306,6 +359,68 @@ Parrot_mmd_multi_dispatch_from_c_args(PARROT_INTERP,
 }
 
 
+/*
+
+=item C<static INTVAL mmd_type_ids_from_c_args(PARROT_INTERP, const char
+*arg_sig, PMC *call_obj, INTVAL *types)>
+
+Fills C<types> with the type ids of the arguments of a call built from the C
+signature C<arg_sig>, the same ids the type tuple of C<call_obj> would hold.
+Returns the number of arguments, or -1 if the call can't be cached because it
+has too many arguments or flattens an aggregate.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static INTVAL
+mmd_type_ids_from_c_args(PARROT_INTERP, ARGIN(const char *arg_sig),
+        ARGIN(PMC *call_obj), ARGOUT(INTVAL *types))
+{
+    ASSERT_ARGS(mmd_type_ids_from_c_args)
+    INTVAL num_types = 0;
+
+    for (; *arg_sig; ++arg_sig) {
+        if (num_types == MMD_CACHE_MAX_TYPES)
+            return -1;
+
+        switch (*arg_sig) {
+          case 'P':
+            {
+                PMC *arg;
+
+                if (arg_sig[1] == 'f')
+                    return -1;
+                if (arg_sig[1] == 'i')
+                    ++arg_sig;
+
+                arg = VTABLE_get_pmc_keyed_int(interp, call_obj, num_types);
+                types[num_types] = PMC_IS_NULL(arg)
+                                 ? (INTVAL)enum_type_PMC
+                                 : VTABLE_type(interp, arg);
+                break;
+            }
+          case 'S':
+            types[num_types] = enum_type_STRING;
+            break;
+          case 'I':
+            types[num_types] = enum_type_INTVAL;
+            break;
+          case 'N':
+            types[num_types] = enum_type_FLOATVAL;
+            break;
+          default:
+            return -1;
+        }
+
+        ++num_types;
+    }
+
+    return num_types;
+}
+
+
 /*
 
 =item C<PMC * Parrot_mmd_find_multi_from_long_sig(PARROT_INTERP, STRING *name,
@@ -560,6 +675,7 @@ Parrot_mmd_get_cached_multi_sig(PARROT_INTERP, ARGIN(PMC *sub_pmc))
                 return PMCNULL;
 
             multi_sig = sub->multi_signature = converted_sig;
+            PARROT_GC_WRITE_BARRIER(interp, sub_pmc);
         }
 
         return multi_sig;
@@ -987,6 +1103,7 @@ Parrot_mmd_add_multi_from_long_sig(PARROT_INTERP,
     else if (VTABLE_isa(interp, sub_obj, sub_str)) {
         PMC_get_sub(interp, sub_obj, sub);
         sub->multi_signature = multi_sig;
+        PARROT_GC_WRITE_BARRIER(interp, sub_obj);
     }
 
     mmd_add_multi_to_namespace(interp, ns_name, sub_name, sub_obj);
@@ -1089,6 +1206,12 @@ Parrot_mmd_add_multi_list_from_c_args(PARROT_INTERP,
 
 Creates and returns a new MMD cache.
 
+The cache maps the name of a multi and the type ids of the arguments of a call
+to the chosen candidate.  Entries are keyed on the raw ids, so neither lookups
+nor stores of calls already cached allocate anything.  Calls with more than
+C<MMD_CACHE_MAX_TYPES> arguments, or with an argument whose type id is 0, are
+never cached.
+
 =cut
 
 */
@@ -1099,57 +1222,242 @@ MMD_Cache *
 Parrot_mmd_cache_create(PARROT_INTERP)
 {
     ASSERT_ARGS(Parrot_mmd_cache_create)
-    /* String hash. */
-    Hash *cache = parrot_new_hash(interp);
+    MMD_Cache * const cache = mem_gc_allocate_zeroed_typed(interp, MMD_Cache);
+
+    cache->mask    = MMD_CACHE_INITIAL_BUCKETS - 1;
+    cache->buckets = mem_gc_allocate_n_zeroed_typed(interp,
+                        MMD_CACHE_INITIAL_BUCKETS, MMD_Cache_entry *);
+
     return cache;
 }
 
 
 /*
 
-=item C<static STRING * mmd_cache_key_from_values(PARROT_INTERP, const char
-*name, PMC *values)>
+=item C<static UINTVAL mmd_cache_hash(const char *name, INTVAL num_types, const
+INTVAL *types)>
 
-Generates an MMD cache key from an array of values.
+Hashes the name of a multi and the type ids of a call.
 
 =cut
 
 */
 
+PARROT_PURE_FUNCTION
 PARROT_WARN_UNUSED_RESULT
-PARROT_CAN_RETURN_NULL
-static STRING *
-mmd_cache_key_from_values(PARROT_INTERP, ARGIN(const char *name),
-    ARGIN(PMC *values))
+static UINTVAL
+mmd_cache_hash(ARGIN_NULLOK(const char *name), INTVAL num_types,
+        ARGIN(const INTVAL *types))
 {
-    ASSERT_ARGS(mmd_cache_key_from_values)
-    /* Build array of type IDs, which we'll then use as a string to key into
-     * the hash. */
-    const INTVAL num_values = VTABLE_elements(interp, values);
-    const INTVAL name_len   = name ? strlen(name) + 1: 0;
-    const size_t id_size    = num_values * sizeof (INTVAL) + name_len;
-    INTVAL *type_ids        = mem_gc_allocate_n_typed(interp, num_values + name_len, INTVAL);
-    STRING *key;
+    ASSERT_ARGS(mmd_cache_hash)
+    UINTVAL hashval = 5381 + num_types;
     INTVAL  i;
 
-    for (i = 0; i < num_values; ++i) {
-        const INTVAL id = VTABLE_type(interp, VTABLE_get_pmc_keyed_int(interp, values, i));
-        if (id == 0) {
-            mem_gc_free(interp, type_ids);
-            return NULL;
+    if (name)
+        for (; *name; ++name)
+            hashval = hashval * 33 + (unsigned char)*name;
+
+    for (i = 0; i < num_types; ++i)
+        hashval = (hashval * 33) ^ (UINTVAL)types[i];
+
+    return hashval;
+}
+
+
+/*
+
+=item C<static MMD_Cache_entry * mmd_cache_find(const MMD_Cache *cache, const
+char *name, UINTVAL hashval, INTVAL num_types, const INTVAL *types)>
+
+Returns the entry of the cache for the given name and type ids, or NULL.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static MMD_Cache_entry *
+mmd_cache_find(ARGIN(const MMD_Cache *cache), ARGIN_NULLOK(const char *name),
+        UINTVAL hashval, INTVAL num_types, ARGIN(const INTVAL *types))
+{
+    ASSERT_ARGS(mmd_cache_find)
+    MMD_Cache_entry *e = cache->buckets[hashval & cache->mask];
+
+    for (; e; e = e->next) {
+        if (e->hashval != hashval || e->num_types != num_types)
+            continue;
+        if (memcmp(e->types, types, num_types * sizeof (INTVAL)))
+            continue;
+        if (name ? (e->name && STREQ(e->name, name)) : !e->name)
+            return e;
+    }
+
+    return NULL;
+}
+
+
+/*
+
+=item C<static void mmd_cache_grow(PARROT_INTERP, MMD_Cache *cache)>
+
+Doubles the number of buckets of the cache.
+
+=cut
+
+*/
+
+static void
+mmd_cache_grow(PARROT_INTERP, ARGMOD(MMD_Cache *cache))
+{
+    ASSERT_ARGS(mmd_cache_grow)
+    const UINTVAL      old_size = cache->mask + 1;
+    const UINTVAL      new_mask = old_size * 2 - 1;
+    MMD_Cache_entry  **buckets  = mem_gc_allocate_n_zeroed_typed(interp,
+                                    old_size * 2, MMD_Cache_entry *);
+    UINTVAL            i;
+
+    for (i = 0; i < old_size; ++i) {
+        MMD_Cache_entry *e = cache->buckets[i];
+
+        while (e) {
+            MMD_Cache_entry * const next = e->next;
+            MMD_Cache_entry ** const b   = &buckets[e->hashval & new_mask];
+
+            e->next = *b;
+            *b      = e;
+            e       = next;
         }
+    }
+
+    mem_gc_free(interp, cache->buckets);
+    cache->buckets = buckets;
+    cache->mask    = new_mask;
+}
+
+
+/*
 
-        type_ids[i] = id;
+=item C<PMC * Parrot_mmd_cache_lookup_by_ids(PARROT_INTERP, MMD_Cache *cache,
+const char *name, INTVAL num_types, const INTVAL *types)>
+
+Takes the type ids of the arguments of a call and does a lookup in the MMD
+cache.  The name is optional, and can be null if the cache is tied to an
+individual multi.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+PMC *
+Parrot_mmd_cache_lookup_by_ids(PARROT_INTERP, ARGIN(MMD_Cache *cache),
+    ARGIN_NULLOK(const char *name), INTVAL num_types, ARGIN(const INTVAL *types))
+{
+    ASSERT_ARGS(Parrot_mmd_cache_lookup_by_ids)
+    const MMD_Cache_entry *e;
+    INTVAL                 i;
+
+    if (num_types > MMD_CACHE_MAX_TYPES)
+        return PMCNULL;
+
+    for (i = 0; i < num_types; ++i)
+        if (types[i] == 0)
+            return PMCNULL;
+
+    e = mmd_cache_find(cache, name,
+            mmd_cache_hash(name, num_types, types), num_types, types);
+
+    return e ? e->chosen : PMCNULL;
+}
+
+
+/*
+
+=item C<void Parrot_mmd_cache_store_by_ids(PARROT_INTERP, MMD_Cache *cache,
+const char *name, INTVAL num_types, const INTVAL *types, PMC *chosen)>
+
+Takes the type ids of the arguments of a call along with a chosen candidate
+and puts it into the cache.  The name is optional, and can be null if the
+cache is tied to an individual multi.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+void
+Parrot_mmd_cache_store_by_ids(PARROT_INTERP, ARGMOD(MMD_Cache *cache),
+    ARGIN_NULLOK(const char *name), INTVAL num_types, ARGIN(const INTVAL *types),
+    ARGIN(PMC *chosen))
+{
+    ASSERT_ARGS(Parrot_mmd_cache_store_by_ids)
+    MMD_Cache_entry  *e;
+    MMD_Cache_entry **bucket;
+    UINTVAL           hashval;
+    INTVAL            i;
+
+    if (num_types > MMD_CACHE_MAX_TYPES)
+        return;
+
+    for (i = 0; i < num_types; ++i)
+        if (types[i] == 0)
+            return;
+
+    hashval = mmd_cache_hash(name, num_types, types);
+    e       = mmd_cache_find(cache, name, hashval, num_types, types);
+
+    if (e) {
+        e->chosen = chosen;
+        return;
     }
 
-    if (name)
-        strcpy((char *)(type_ids + num_values), name);
+    if (cache->entries > 2 * cache->mask)
+        mmd_cache_grow(interp, cache);
 
-    key = Parrot_str_new_init(interp, (char *)type_ids, id_size,
-            Parrot_binary_encoding_ptr, 0);
-    mem_gc_free(interp, type_ids);
+    e            = mem_gc_allocate_zeroed_typed(interp, MMD_Cache_entry);
+    e->name      = name ? mem_sys_strdup(name) : NULL;
+    e->hashval   = hashval;
+    e->num_types = num_types;
+    e->chosen    = chosen;
+    memcpy(e->types, types, num_types * sizeof (INTVAL));
 
-    return key;
+    bucket  = &cache->buckets[hashval & cache->mask];
+    e->next = *bucket;
+    *bucket = e;
+    ++cache->entries;
+}
+
+
+/*
+
+=item C<static INTVAL mmd_cache_ids_from_values(PARROT_INTERP, PMC *values,
+INTVAL *types)>
+
+Fills C<types> with the type ids of an array of values.  Returns the number of
+values, or -1 if there are too many of them to cache.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static INTVAL
+mmd_cache_ids_from_values(PARROT_INTERP, ARGIN(PMC *values), ARGOUT(INTVAL *types))
+{
+    ASSERT_ARGS(mmd_cache_ids_from_values)
+    const INTVAL num_values = VTABLE_elements(interp, values);
+    INTVAL       i;
+
+    if (num_values > MMD_CACHE_MAX_TYPES)
+        return -1;
+
+    for (i = 0; i < num_values; ++i)
+        types[i] = VTABLE_type(interp, VTABLE_get_pmc_keyed_int(interp, values, i));
+
+    return num_values;
 }
 
 
@@ -1172,12 +1480,13 @@ Parrot_mmd_cache_lookup_by_values(PARROT_INTERP, ARGMOD(MMD_Cache *cache),
     ARGIN(const char *name), ARGIN(PMC *values))
 {
     ASSERT_ARGS(Parrot_mmd_cache_lookup_by_values)
-    STRING * const key = mmd_cache_key_from_values(interp, name, values);
+    INTVAL       types[MMD_CACHE_MAX_TYPES];
+    const INTVAL num_types = mmd_cache_ids_from_values(interp, values, types);
 
-    if (key)
-        return (PMC *)parrot_hash_get(interp, cache, key);
+    if (num_types < 0)
+        return PMCNULL;
 
-    return PMCNULL;
+    return Parrot_mmd_cache_lookup_by_ids(interp, cache, name, num_types, types);
 }
 
 
@@ -1199,60 +1508,41 @@ Parrot_mmd_cache_store_by_values(PARROT_INTERP, ARGMOD(MMD_Cache *cache),
     ARGIN(const char *name), ARGIN(PMC *values), ARGIN(PMC *chosen))
 {
     ASSERT_ARGS(Parrot_mmd_cache_store_by_values)
-    STRING * const key = mmd_cache_key_from_values(interp, name, values);
+    INTVAL       types[MMD_CACHE_MAX_TYPES];
+    const INTVAL num_types = mmd_cache_ids_from_values(interp, values, types);
 
-    if (key)
-        parrot_hash_put(interp, cache, key, chosen);
+    if (num_types >= 0)
+        Parrot_mmd_cache_store_by_ids(interp, cache, name, num_types, types, chosen);
 }
 
 
 /*
 
-=item C<static STRING * mmd_cache_key_from_types(PARROT_INTERP, const char
-*name, PMC *types)>
+=item C<static INTVAL mmd_cache_ids_from_types(PARROT_INTERP, PMC *type_tuple,
+INTVAL *types)>
 
-Generates an MMD cache key from an array of types.
+Copies the type ids of a type tuple to C<types>.  Returns the number of ids,
+or -1 if there are too many of them to cache.
 
 =cut
 
 */
 
 PARROT_WARN_UNUSED_RESULT
-PARROT_CAN_RETURN_NULL
-static STRING *
-mmd_cache_key_from_types(PARROT_INTERP, ARGIN(const char *name),
-    ARGIN(PMC *types))
+static INTVAL
+mmd_cache_ids_from_types(PARROT_INTERP, ARGIN(PMC *type_tuple), ARGOUT(INTVAL *types))
 {
-    ASSERT_ARGS(mmd_cache_key_from_types)
-    /* Build array of type IDs, which we'll then use as a string to key into
-     * the hash. */
-    const INTVAL num_types  = VTABLE_elements(interp, types);
-    const INTVAL name_len   = name ? strlen(name) + 1: 0;
-    const size_t id_size    = num_types * sizeof (INTVAL) + name_len;
-    INTVAL * const type_ids = mem_gc_allocate_n_typed(interp, num_types + name_len, INTVAL);
-
-    STRING *key;
-    INTVAL  i;
-
-    for (i = 0; i < num_types; ++i) {
-        const INTVAL id = VTABLE_get_integer_keyed_int(interp, types, i);
-
-        if (id == 0) {
-            mem_gc_free(interp, type_ids);
-            return NULL;
-        }
-
-        type_ids[i] = id;
-    }
+    ASSERT_ARGS(mmd_cache_ids_from_types)
+    const INTVAL num_types = VTABLE_elements(interp, type_tuple);
+    INTVAL       i;
 
-    if (name)
-        strcpy((char *)(type_ids + num_types), name);
+    if (num_types > MMD_CACHE_MAX_TYPES)
+        return -1;
 
-    key = Parrot_str_new_init(interp, (char *)type_ids, id_size,
-            Parrot_binary_encoding_ptr, 0);
+    for (i = 0; i < num_types; ++i)
+        types[i] = VTABLE_get_integer_keyed_int(interp, type_tuple, i);
 
-    mem_gc_free(interp, type_ids);
-    return key;
+    return num_types;
 }
 
 
@@ -1275,12 +1565,13 @@ Parrot_mmd_cache_lookup_by_types(PARROT_INTERP, ARGMOD(MMD_Cache *cache),
     ARGIN(const char *name), ARGIN(PMC *types))
 {
     ASSERT_ARGS(Parrot_mmd_cache_lookup_by_types)
-    const STRING * const key = mmd_cache_key_from_types(interp, name, types);
+    INTVAL       ids[MMD_CACHE_MAX_TYPES];
+    const INTVAL num_types = mmd_cache_ids_from_types(interp, types, ids);
 
-    if (key)
-        return (PMC *)parrot_hash_get(interp, cache, key);
+    if (num_types < 0)
+        return PMCNULL;
 
-    return PMCNULL;
+    return Parrot_mmd_cache_lookup_by_ids(interp, cache, name, num_types, ids);
 }
 
 
@@ -1303,10 +1594,11 @@ Parrot_mmd_cache_store_by_types(PARROT_INTERP, ARGMOD(MMD_Cache *cache),
     ARGIN(const char *name), ARGIN(PMC *types), ARGIN(PMC *chosen))
 {
     ASSERT_ARGS(Parrot_mmd_cache_store_by_types)
-    STRING * const key = mmd_cache_key_from_types(interp, name, types);
+    INTVAL       ids[MMD_CACHE_MAX_TYPES];
+    const INTVAL num_types = mmd_cache_ids_from_types(interp, types, ids);
 
-    if (key)
-        parrot_hash_put(interp, cache, key, chosen);
+    if (num_types >= 0)
+        Parrot_mmd_cache_store_by_ids(interp, cache, name, num_types, ids, chosen);
 }
 
 
@@ -1325,10 +1617,15 @@ void
 Parrot_mmd_cache_mark(PARROT_INTERP, ARGMOD(MMD_Cache *cache))
 {
     ASSERT_ARGS(Parrot_mmd_cache_mark)
-    /* As a small future optimization, note that we only *really* need to mark
-    * keys - the candidates will be referenced outside the cache, provided it's
-    * invalidated properly. */
-    parrot_mark_hash(interp, cache);
+    UINTVAL i;
+
+    /* The keys are plain type ids, so only the candidates need marking. */
+    for (i = 0; i <= cache->mask; ++i) {
+        const MMD_Cache_entry *e;
+
+        for (e = cache->buckets[i]; e; e = e->next)
+            Parrot_gc_mark_PMC_alive(interp, e->chosen);
+    }
 }
 
 
@@ -1347,7 +1644,103 @@ void
 Parrot_mmd_cache_destroy(PARROT_INTERP, ARGMOD(MMD_Cache *cache))
 {
     ASSERT_ARGS(Parrot_mmd_cache_destroy)
-    parrot_hash_destroy(interp, cache);
+    UINTVAL i;
+
+    for (i = 0; i <= cache->mask; ++i) {
+        MMD_Cache_entry *e = cache->buckets[i];
+
+        while (e) {
+            MMD_Cache_entry * const next = e->next;
+
+            if (e->name)
+                mem_sys_free(e->name);
+            mem_gc_free(interp, e);
+            e = next;
+        }
+    }
+
+    mem_gc_free(interp, cache->buckets);
+    mem_gc_free(interp, cache);
+}
+
+
+/*
+
+=item C<PMC * Parrot_mmd_pic_lookup(PARROT_INTERP, const MMD_PIC *pic, PMC
+*type_tuple)>
+
+Returns the candidate a polymorphic cache holds for the type ids in
+C<type_tuple>, or PMCNULL.
+
+A polymorphic cache belongs to a single multi and remembers the candidates
+chosen for the last C<MMD_PIC_SIZE> distinct type tuples it was called with,
+so a multi called with only a few combinations of types dispatches by
+comparing the ids without searching its candidates.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+PMC *
+Parrot_mmd_pic_lookup(PARROT_INTERP, ARGIN(const MMD_PIC *pic), ARGIN(PMC *type_tuple))
+{
+    ASSERT_ARGS(Parrot_mmd_pic_lookup)
+    INTVAL       types[MMD_CACHE_MAX_TYPES];
+    const INTVAL num_types = mmd_cache_ids_from_types(interp, type_tuple, types);
+    UINTVAL      i;
+
+    if (num_types < 0)
+        return PMCNULL;
+
+    for (i = 0; i < pic->count && i < MMD_PIC_SIZE; ++i) {
+        const MMD_PIC_entry * const e = &pic->entries[i];
+
+        if (e->num_types == num_types
+        && !memcmp(e->types, types, num_types * sizeof (INTVAL)))
+            return e->chosen;
+    }
+
+    return PMCNULL;
+}
+
+
+/*
+
+=item C<void Parrot_mmd_pic_store(PARROT_INTERP, MMD_PIC *pic, PMC *type_tuple,
+PMC *chosen)>
+
+Remembers the candidate chosen for the type ids in C<type_tuple>.  Once the
+cache is full, the oldest entry is replaced.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+void
+Parrot_mmd_pic_store(PARROT_INTERP, ARGMOD(MMD_PIC *pic), ARGIN(PMC *type_tuple),
+    ARGIN(PMC *chosen))
+{
+    ASSERT_ARGS(Parrot_mmd_pic_store)
+    INTVAL         types[MMD_CACHE_MAX_TYPES];
+    const INTVAL   num_types = mmd_cache_ids_from_types(interp, type_tuple, types);
+    MMD_PIC_entry *e;
+    INTVAL         i;
+
+    if (num_types < 0)
+        return;
+
+    for (i = 0; i < num_types; ++i)
+        if (types[i] == 0)
+            return;
+
+    e            = &pic->entries[pic->count++ % MMD_PIC_SIZE];
+    e->num_types = num_types;
+    e->chosen    = chosen;
+    memcpy(e->types, types, num_types * sizeof (INTVAL));
 }
 
 
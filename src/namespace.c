@@ -738,6 +738,7 @@ Parrot_ns_store_sub(PARROT_INTERP, ARGIN(PMC *sub_pmc))
 
     /* attach a namespace to the sub for lookups */
     sub->namespace_stash = ns;
+    PARROT_GC_WRITE_BARRIER(interp, sub_pmc);
 
     /* store a :multi sub */
     if (!PMC_IS_NULL(sub->multi_signature))
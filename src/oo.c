@@ -711,9 +711,10 @@ Parrot_oo_register_type(PARROT_INTERP, ARGIN(PMC *name), ARGIN(PMC *_namespace))
 
 =item C<void mark_object_cache(PARROT_INTERP)>
 
-Marks all PMCs in the object method cache as live.  This shouldn't strictly be
-necessary, as they're likely all reachable from namespaces and classes, but
-it's unlikely to hurt anything except mark phase performance.
+Marks all PMCs in the object method cache and the inline method caches as live.
+This shouldn't strictly be necessary, as they're likely all reachable from
+namespaces and classes, but it's unlikely to hurt anything except mark phase
+performance.
 
 =cut
 
@@ -727,6 +728,7 @@ mark_object_cache(PARROT_INTERP)
 {
     ASSERT_ARGS(mark_object_cache)
     Caches * const mc = interp->caches;
+    Method_ic *ic;
     UINTVAL type, entry;
 
     if (!mc)
@@ -744,6 +746,14 @@ mark_object_cache(PARROT_INTERP)
             }
         }
     }
+
+    /* the classes are marked too, so no other class can take their place */
+    for (ic = mc->ics; ic; ic = ic->next) {
+        for (entry = 0; entry < ic->count; ++entry) {
+            Parrot_gc_mark_PMC_alive(interp, ic->entries[entry].pmc);
+            Parrot_gc_mark_PMC_alive(interp, ic->entries[entry]._class);
+        }
+    }
 }
 
 
@@ -771,7 +781,7 @@ init_object_cache(PARROT_INTERP)
 =item C<void destroy_object_cache(PARROT_INTERP)>
 
 Destroy the object cache. Loop over all caches and invalidate them. Then
-free the caches back to the OS.
+free the caches, and any inline caches left, back to the OS.
 
 =cut
 
@@ -790,6 +800,13 @@ destroy_object_cache(PARROT_INTERP)
             invalidate_type_caches(interp, i);
     }
 
+    /* inline caches of code segments which outlived the packfile */
+    while (mc->ics) {
+        Method_ic * const next = mc->ics->next;
+        mem_gc_free(interp, mc->ics);
+        mc->ics = next;
+    }
+
     mem_gc_free(interp, mc->idx);
     mem_gc_free(interp, mc);
 }
@@ -860,7 +877,8 @@ invalidate_all_caches(PARROT_INTERP)
 =item C<void Parrot_invalidate_method_cache(PARROT_INTERP, STRING *_class)>
 
 Clear method cache for the given class. If class is NULL, caches for
-all classes are invalidated.
+all classes are invalidated.  The inline caches of all call sites are
+invalidated in either case.
 
 =cut
 
@@ -873,6 +891,10 @@ Parrot_invalidate_method_cache(PARROT_INTERP, ARGIN_NULLOK(STRING *_class))
     ASSERT_ARGS(Parrot_invalidate_method_cache)
     INTVAL type;
 
+    /* all inline caches start over */
+    if (interp->caches)
+        ++interp->caches->generation;
+
     /* during interp creation and NCI registration the class_hash
      * isn't yet up */
     if (!interp->class_hash)
@@ -1027,6 +1049,154 @@ Parrot_find_method_with_cache(PARROT_INTERP, ARGIN(PMC *_class), ARGIN(STRING *m
 }
 
 
+/*
+
+=item C<PMC * Parrot_find_method_inline_cached(PARROT_INTERP, PMC *object,
+STRING *method_name, opcode_t *pc)>
+
+Find a method PMC for a named method of C<object>, as C<VTABLE_find_method>
+does, for the call site at C<pc> in the current code segment.
+
+Every call site remembers the methods it found for the last
+C<METHOD_IC_SIZE> receiver types, keyed on the receiver's vtable, and for
+instances of Parrot classes on the class too, as they all share the vtable
+of C<Object>.  Methods of further receiver types are found with
+C<VTABLE_find_method> every time.  All caches are invalidated by
+C<Parrot_invalidate_method_cache>.
+
+Only receivers whose method lookup depends on nothing but their type and the
+name are cached, that is those using the C<find_method> of C<default> or of
+C<Object>, and only lookups of constant names which found a method.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+PARROT_CAN_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC *
+Parrot_find_method_inline_cached(PARROT_INTERP, ARGIN(PMC *object),
+        ARGIN(STRING *method_name), ARGIN(opcode_t *pc))
+{
+    ASSERT_ARGS(Parrot_find_method_inline_cached)
+    PackFile_ByteCode * const code   = interp->code;
+    VTABLE            * const vtable = object->vtable;
+    Caches            * const mc     = interp->caches;
+    PMC                      *_class = PMCNULL;
+    PMC                      *method;
+    Method_ic                *ic;
+    size_t                    offset;
+    UINTVAL                   i;
+
+    /* child interpreters share code segments, but not methods */
+    if (!PObj_constant_TEST(method_name) || interp->parent_interpreter
+    ||  !code || pc < code->base.data || pc >= code->base.data + code->base.size)
+        return VTABLE_find_method(interp, object, method_name);
+
+    if (vtable->find_method == interp->vtables[enum_class_Object]->find_method)
+        _class = PARROT_OBJECT(object)->_class;
+    else if (vtable->find_method != interp->vtables[enum_class_default]->find_method)
+        return VTABLE_find_method(interp, object, method_name);
+
+    offset = pc - code->base.data;
+
+    /* IMCC appends to the segment it runs */
+    if (offset >= code->method_ics_size) {
+        const size_t size = code->base.size;
+
+        if (code->method_ics)
+            code->method_ics = mem_gc_realloc_n_typed_zeroed(interp,
+                    code->method_ics, size, code->method_ics_size, Method_ic *);
+        else
+            code->method_ics = mem_gc_allocate_n_zeroed_typed(interp, size,
+                    Method_ic *);
+
+        code->method_ics_size = size;
+    }
+
+    ic = code->method_ics[offset];
+
+    if (!ic) {
+        ic = code->method_ics[offset] = mem_gc_allocate_zeroed_typed(interp, Method_ic);
+        ic->generation = mc->generation;
+        ic->next       = mc->ics;
+
+        if (mc->ics)
+            mc->ics->prev = ic;
+
+        mc->ics = ic;
+    }
+    else if (ic->generation != mc->generation) {
+        ic->generation = mc->generation;
+        ic->count      = 0;
+    }
+
+    for (i = 0; i < ic->count; ++i) {
+        const Method_ic_entry * const e = ic->entries + i;
+
+        if (e->vtable == vtable && e->_class == _class && e->name == method_name)
+            return e->pmc;
+    }
+
+    /* finding the method may run code invalidating this cache */
+    method = VTABLE_find_method(interp, object, method_name);
+
+    if (ic->count < METHOD_IC_SIZE && ic->generation == mc->generation
+    &&  !PMC_IS_NULL(method)) {
+        Method_ic_entry * const e = ic->entries + ic->count++;
+
+        e->vtable = vtable;
+        e->_class = _class;
+        e->name   = method_name;
+        e->pmc    = method;
+    }
+
+    return method;
+}
+
+
+/*
+
+=item C<void Parrot_destroy_method_inline_caches(PARROT_INTERP,
+PackFile_ByteCode *code)>
+
+Frees the inline method caches of the call sites in C<code>.
+
+=cut
+
+*/
+
+void
+Parrot_destroy_method_inline_caches(PARROT_INTERP, ARGMOD(PackFile_ByteCode *code))
+{
+    ASSERT_ARGS(Parrot_destroy_method_inline_caches)
+    Caches * const mc = interp->caches;
+    size_t         i;
+
+    for (i = 0; i < code->method_ics_size; ++i) {
+        Method_ic * const ic = code->method_ics[i];
+
+        if (!ic)
+            continue;
+
+        if (ic->prev)
+            ic->prev->next = ic->next;
+        else
+            mc->ics = ic->next;
+
+        if (ic->next)
+            ic->next->prev = ic->prev;
+
+        mem_gc_free(interp, ic);
+    }
+
+    mem_gc_free(interp, code->method_ics);
+    code->method_ics      = NULL;
+    code->method_ics_size = 0;
+}
+
+
 /*
 
 =item C<static PMC* C3_merge(PARROT_INTERP, PMC *merge_list)>
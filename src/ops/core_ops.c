@@ -22,6 +22,10 @@
 #define NREG(i) (CUR_CTX->bp.regs_n[-1L - cur_opcode[i]])
 #define PREG(i) (CUR_CTX->bp_ps.regs_p[-1L - cur_opcode[i]])
 #define SREG(i) (CUR_CTX->bp_ps.regs_s[cur_opcode[i]])
+#define IREG_AT(r) (CUR_CTX->bp.regs_i[r])
+#define NREG_AT(r) (CUR_CTX->bp.regs_n[-1L - (r)])
+#define PREG_AT(r) (CUR_CTX->bp_ps.regs_p[-1L - (r)])
+#define SREG_AT(r) (CUR_CTX->bp_ps.regs_s[r])
 #define ICONST(i) cur_opcode[i]
 #define NCONST(i) Parrot_pcc_get_num_constants(interp, interp->ctx)[cur_opcode[i]]
 #define SCONST(i) Parrot_pcc_get_str_constants(interp, interp->ctx)[cur_opcode[i]]
@@ -68,13 +72,13 @@ extern op_lib_t core_op_lib;
 
 
 
-INTVAL core_numops = 1072;
+INTVAL core_numops = 1358;
 
 /*
 ** Op Function Table:
 */
 
-static op_func_t core_op_func_table[1072] = {
+static op_func_t core_op_func_table[1358] = {
   Parrot_end,                                        /*      0 */
   Parrot_noop,                                       /*      1 */
   Parrot_check_events,                               /*      2 */
@@ -1146,6 +1150,292 @@ static op_func_t core_op_func_table[1072] = {
   Parrot_root_new_p_pc_ic,                           /*   1068 */
   Parrot_finalize_p,                                 /*   1069 */
   Parrot_finalize_pc,                                /*   1070 */
+  Parrot_le_i_ic_ic__mod_i_i_i__unless_i_ic,         /*   1071 */
+  Parrot_dec_i__branch_ic,                           /*   1072 */
+  Parrot_inc_i__eq_i_i_ic__branch_ic,                /*   1073 */
+  Parrot_set_i_ic__lt_i_i_ic,                        /*   1074 */
+  Parrot_inc_i__lt_i_i_ic,                           /*   1075 */
+  Parrot_inc_i__branch_ic,                           /*   1076 */
+  Parrot_inc_i__I0,                                  /*   1077 */
+  Parrot_inc_i__I1,                                  /*   1078 */
+  Parrot_inc_i__I2,                                  /*   1079 */
+  Parrot_inc_i__I3,                                  /*   1080 */
+  Parrot_inc_i__I4,                                  /*   1081 */
+  Parrot_inc_i__I5,                                  /*   1082 */
+  Parrot_inc_i__I6,                                  /*   1083 */
+  Parrot_inc_i__I7,                                  /*   1084 */
+  Parrot_dec_i__I0,                                  /*   1085 */
+  Parrot_dec_i__I1,                                  /*   1086 */
+  Parrot_dec_i__I2,                                  /*   1087 */
+  Parrot_dec_i__I3,                                  /*   1088 */
+  Parrot_dec_i__I4,                                  /*   1089 */
+  Parrot_dec_i__I5,                                  /*   1090 */
+  Parrot_dec_i__I6,                                  /*   1091 */
+  Parrot_dec_i__I7,                                  /*   1092 */
+  Parrot_set_i_ic__I0,                               /*   1093 */
+  Parrot_set_i_ic__I1,                               /*   1094 */
+  Parrot_set_i_ic__I2,                               /*   1095 */
+  Parrot_set_i_ic__I3,                               /*   1096 */
+  Parrot_set_i_ic__I4,                               /*   1097 */
+  Parrot_set_i_ic__I5,                               /*   1098 */
+  Parrot_set_i_ic__I6,                               /*   1099 */
+  Parrot_set_i_ic__I7,                               /*   1100 */
+  Parrot_lt_i_i_ic__I0_I0,                           /*   1101 */
+  Parrot_lt_i_i_ic__I0_I1,                           /*   1102 */
+  Parrot_lt_i_i_ic__I0_I2,                           /*   1103 */
+  Parrot_lt_i_i_ic__I0_I3,                           /*   1104 */
+  Parrot_lt_i_i_ic__I0_I4,                           /*   1105 */
+  Parrot_lt_i_i_ic__I0_I5,                           /*   1106 */
+  Parrot_lt_i_i_ic__I0_I6,                           /*   1107 */
+  Parrot_lt_i_i_ic__I0_I7,                           /*   1108 */
+  Parrot_lt_i_i_ic__I1_I0,                           /*   1109 */
+  Parrot_lt_i_i_ic__I1_I1,                           /*   1110 */
+  Parrot_lt_i_i_ic__I1_I2,                           /*   1111 */
+  Parrot_lt_i_i_ic__I1_I3,                           /*   1112 */
+  Parrot_lt_i_i_ic__I1_I4,                           /*   1113 */
+  Parrot_lt_i_i_ic__I1_I5,                           /*   1114 */
+  Parrot_lt_i_i_ic__I1_I6,                           /*   1115 */
+  Parrot_lt_i_i_ic__I1_I7,                           /*   1116 */
+  Parrot_lt_i_i_ic__I2_I0,                           /*   1117 */
+  Parrot_lt_i_i_ic__I2_I1,                           /*   1118 */
+  Parrot_lt_i_i_ic__I2_I2,                           /*   1119 */
+  Parrot_lt_i_i_ic__I2_I3,                           /*   1120 */
+  Parrot_lt_i_i_ic__I2_I4,                           /*   1121 */
+  Parrot_lt_i_i_ic__I2_I5,                           /*   1122 */
+  Parrot_lt_i_i_ic__I2_I6,                           /*   1123 */
+  Parrot_lt_i_i_ic__I2_I7,                           /*   1124 */
+  Parrot_lt_i_i_ic__I3_I0,                           /*   1125 */
+  Parrot_lt_i_i_ic__I3_I1,                           /*   1126 */
+  Parrot_lt_i_i_ic__I3_I2,                           /*   1127 */
+  Parrot_lt_i_i_ic__I3_I3,                           /*   1128 */
+  Parrot_lt_i_i_ic__I3_I4,                           /*   1129 */
+  Parrot_lt_i_i_ic__I3_I5,                           /*   1130 */
+  Parrot_lt_i_i_ic__I3_I6,                           /*   1131 */
+  Parrot_lt_i_i_ic__I3_I7,                           /*   1132 */
+  Parrot_lt_i_i_ic__I4_I0,                           /*   1133 */
+  Parrot_lt_i_i_ic__I4_I1,                           /*   1134 */
+  Parrot_lt_i_i_ic__I4_I2,                           /*   1135 */
+  Parrot_lt_i_i_ic__I4_I3,                           /*   1136 */
+  Parrot_lt_i_i_ic__I4_I4,                           /*   1137 */
+  Parrot_lt_i_i_ic__I4_I5,                           /*   1138 */
+  Parrot_lt_i_i_ic__I4_I6,                           /*   1139 */
+  Parrot_lt_i_i_ic__I4_I7,                           /*   1140 */
+  Parrot_lt_i_i_ic__I5_I0,                           /*   1141 */
+  Parrot_lt_i_i_ic__I5_I1,                           /*   1142 */
+  Parrot_lt_i_i_ic__I5_I2,                           /*   1143 */
+  Parrot_lt_i_i_ic__I5_I3,                           /*   1144 */
+  Parrot_lt_i_i_ic__I5_I4,                           /*   1145 */
+  Parrot_lt_i_i_ic__I5_I5,                           /*   1146 */
+  Parrot_lt_i_i_ic__I5_I6,                           /*   1147 */
+  Parrot_lt_i_i_ic__I5_I7,                           /*   1148 */
+  Parrot_lt_i_i_ic__I6_I0,                           /*   1149 */
+  Parrot_lt_i_i_ic__I6_I1,                           /*   1150 */
+  Parrot_lt_i_i_ic__I6_I2,                           /*   1151 */
+  Parrot_lt_i_i_ic__I6_I3,                           /*   1152 */
+  Parrot_lt_i_i_ic__I6_I4,                           /*   1153 */
+  Parrot_lt_i_i_ic__I6_I5,                           /*   1154 */
+  Parrot_lt_i_i_ic__I6_I6,                           /*   1155 */
+  Parrot_lt_i_i_ic__I6_I7,                           /*   1156 */
+  Parrot_lt_i_i_ic__I7_I0,                           /*   1157 */
+  Parrot_lt_i_i_ic__I7_I1,                           /*   1158 */
+  Parrot_lt_i_i_ic__I7_I2,                           /*   1159 */
+  Parrot_lt_i_i_ic__I7_I3,                           /*   1160 */
+  Parrot_lt_i_i_ic__I7_I4,                           /*   1161 */
+  Parrot_lt_i_i_ic__I7_I5,                           /*   1162 */
+  Parrot_lt_i_i_ic__I7_I6,                           /*   1163 */
+  Parrot_lt_i_i_ic__I7_I7,                           /*   1164 */
+  Parrot_add_i_i__I0_I0,                             /*   1165 */
+  Parrot_add_i_i__I0_I1,                             /*   1166 */
+  Parrot_add_i_i__I0_I2,                             /*   1167 */
+  Parrot_add_i_i__I0_I3,                             /*   1168 */
+  Parrot_add_i_i__I0_I4,                             /*   1169 */
+  Parrot_add_i_i__I0_I5,                             /*   1170 */
+  Parrot_add_i_i__I0_I6,                             /*   1171 */
+  Parrot_add_i_i__I0_I7,                             /*   1172 */
+  Parrot_add_i_i__I1_I0,                             /*   1173 */
+  Parrot_add_i_i__I1_I1,                             /*   1174 */
+  Parrot_add_i_i__I1_I2,                             /*   1175 */
+  Parrot_add_i_i__I1_I3,                             /*   1176 */
+  Parrot_add_i_i__I1_I4,                             /*   1177 */
+  Parrot_add_i_i__I1_I5,                             /*   1178 */
+  Parrot_add_i_i__I1_I6,                             /*   1179 */
+  Parrot_add_i_i__I1_I7,                             /*   1180 */
+  Parrot_add_i_i__I2_I0,                             /*   1181 */
+  Parrot_add_i_i__I2_I1,                             /*   1182 */
+  Parrot_add_i_i__I2_I2,                             /*   1183 */
+  Parrot_add_i_i__I2_I3,                             /*   1184 */
+  Parrot_add_i_i__I2_I4,                             /*   1185 */
+  Parrot_add_i_i__I2_I5,                             /*   1186 */
+  Parrot_add_i_i__I2_I6,                             /*   1187 */
+  Parrot_add_i_i__I2_I7,                             /*   1188 */
+  Parrot_add_i_i__I3_I0,                             /*   1189 */
+  Parrot_add_i_i__I3_I1,                             /*   1190 */
+  Parrot_add_i_i__I3_I2,                             /*   1191 */
+  Parrot_add_i_i__I3_I3,                             /*   1192 */
+  Parrot_add_i_i__I3_I4,                             /*   1193 */
+  Parrot_add_i_i__I3_I5,                             /*   1194 */
+  Parrot_add_i_i__I3_I6,                             /*   1195 */
+  Parrot_add_i_i__I3_I7,                             /*   1196 */
+  Parrot_add_i_i__I4_I0,                             /*   1197 */
+  Parrot_add_i_i__I4_I1,                             /*   1198 */
+  Parrot_add_i_i__I4_I2,                             /*   1199 */
+  Parrot_add_i_i__I4_I3,                             /*   1200 */
+  Parrot_add_i_i__I4_I4,                             /*   1201 */
+  Parrot_add_i_i__I4_I5,                             /*   1202 */
+  Parrot_add_i_i__I4_I6,                             /*   1203 */
+  Parrot_add_i_i__I4_I7,                             /*   1204 */
+  Parrot_add_i_i__I5_I0,                             /*   1205 */
+  Parrot_add_i_i__I5_I1,                             /*   1206 */
+  Parrot_add_i_i__I5_I2,                             /*   1207 */
+  Parrot_add_i_i__I5_I3,                             /*   1208 */
+  Parrot_add_i_i__I5_I4,                             /*   1209 */
+  Parrot_add_i_i__I5_I5,                             /*   1210 */
+  Parrot_add_i_i__I5_I6,                             /*   1211 */
+  Parrot_add_i_i__I5_I7,                             /*   1212 */
+  Parrot_add_i_i__I6_I0,                             /*   1213 */
+  Parrot_add_i_i__I6_I1,                             /*   1214 */
+  Parrot_add_i_i__I6_I2,                             /*   1215 */
+  Parrot_add_i_i__I6_I3,                             /*   1216 */
+  Parrot_add_i_i__I6_I4,                             /*   1217 */
+  Parrot_add_i_i__I6_I5,                             /*   1218 */
+  Parrot_add_i_i__I6_I6,                             /*   1219 */
+  Parrot_add_i_i__I6_I7,                             /*   1220 */
+  Parrot_add_i_i__I7_I0,                             /*   1221 */
+  Parrot_add_i_i__I7_I1,                             /*   1222 */
+  Parrot_add_i_i__I7_I2,                             /*   1223 */
+  Parrot_add_i_i__I7_I3,                             /*   1224 */
+  Parrot_add_i_i__I7_I4,                             /*   1225 */
+  Parrot_add_i_i__I7_I5,                             /*   1226 */
+  Parrot_add_i_i__I7_I6,                             /*   1227 */
+  Parrot_add_i_i__I7_I7,                             /*   1228 */
+  Parrot_set_i_i__I0_I0,                             /*   1229 */
+  Parrot_set_i_i__I0_I1,                             /*   1230 */
+  Parrot_set_i_i__I0_I2,                             /*   1231 */
+  Parrot_set_i_i__I0_I3,                             /*   1232 */
+  Parrot_set_i_i__I0_I4,                             /*   1233 */
+  Parrot_set_i_i__I0_I5,                             /*   1234 */
+  Parrot_set_i_i__I0_I6,                             /*   1235 */
+  Parrot_set_i_i__I0_I7,                             /*   1236 */
+  Parrot_set_i_i__I1_I0,                             /*   1237 */
+  Parrot_set_i_i__I1_I1,                             /*   1238 */
+  Parrot_set_i_i__I1_I2,                             /*   1239 */
+  Parrot_set_i_i__I1_I3,                             /*   1240 */
+  Parrot_set_i_i__I1_I4,                             /*   1241 */
+  Parrot_set_i_i__I1_I5,                             /*   1242 */
+  Parrot_set_i_i__I1_I6,                             /*   1243 */
+  Parrot_set_i_i__I1_I7,                             /*   1244 */
+  Parrot_set_i_i__I2_I0,                             /*   1245 */
+  Parrot_set_i_i__I2_I1,                             /*   1246 */
+  Parrot_set_i_i__I2_I2,                             /*   1247 */
+  Parrot_set_i_i__I2_I3,                             /*   1248 */
+  Parrot_set_i_i__I2_I4,                             /*   1249 */
+  Parrot_set_i_i__I2_I5,                             /*   1250 */
+  Parrot_set_i_i__I2_I6,                             /*   1251 */
+  Parrot_set_i_i__I2_I7,                             /*   1252 */
+  Parrot_set_i_i__I3_I0,                             /*   1253 */
+  Parrot_set_i_i__I3_I1,                             /*   1254 */
+  Parrot_set_i_i__I3_I2,                             /*   1255 */
+  Parrot_set_i_i__I3_I3,                             /*   1256 */
+  Parrot_set_i_i__I3_I4,                             /*   1257 */
+  Parrot_set_i_i__I3_I5,                             /*   1258 */
+  Parrot_set_i_i__I3_I6,                             /*   1259 */
+  Parrot_set_i_i__I3_I7,                             /*   1260 */
+  Parrot_set_i_i__I4_I0,                             /*   1261 */
+  Parrot_set_i_i__I4_I1,                             /*   1262 */
+  Parrot_set_i_i__I4_I2,                             /*   1263 */
+  Parrot_set_i_i__I4_I3,                             /*   1264 */
+  Parrot_set_i_i__I4_I4,                             /*   1265 */
+  Parrot_set_i_i__I4_I5,                             /*   1266 */
+  Parrot_set_i_i__I4_I6,                             /*   1267 */
+  Parrot_set_i_i__I4_I7,                             /*   1268 */
+  Parrot_set_i_i__I5_I0,                             /*   1269 */
+  Parrot_set_i_i__I5_I1,                             /*   1270 */
+  Parrot_set_i_i__I5_I2,                             /*   1271 */
+  Parrot_set_i_i__I5_I3,                             /*   1272 */
+  Parrot_set_i_i__I5_I4,                             /*   1273 */
+  Parrot_set_i_i__I5_I5,                             /*   1274 */
+  Parrot_set_i_i__I5_I6,                             /*   1275 */
+  Parrot_set_i_i__I5_I7,                             /*   1276 */
+  Parrot_set_i_i__I6_I0,                             /*   1277 */
+  Parrot_set_i_i__I6_I1,                             /*   1278 */
+  Parrot_set_i_i__I6_I2,                             /*   1279 */
+  Parrot_set_i_i__I6_I3,                             /*   1280 */
+  Parrot_set_i_i__I6_I4,                             /*   1281 */
+  Parrot_set_i_i__I6_I5,                             /*   1282 */
+  Parrot_set_i_i__I6_I6,                             /*   1283 */
+  Parrot_set_i_i__I6_I7,                             /*   1284 */
+  Parrot_set_i_i__I7_I0,                             /*   1285 */
+  Parrot_set_i_i__I7_I1,                             /*   1286 */
+  Parrot_set_i_i__I7_I2,                             /*   1287 */
+  Parrot_set_i_i__I7_I3,                             /*   1288 */
+  Parrot_set_i_i__I7_I4,                             /*   1289 */
+  Parrot_set_i_i__I7_I5,                             /*   1290 */
+  Parrot_set_i_i__I7_I6,                             /*   1291 */
+  Parrot_set_i_i__I7_I7,                             /*   1292 */
+  Parrot_add_n_n__N0_N0,                             /*   1293 */
+  Parrot_add_n_n__N0_N1,                             /*   1294 */
+  Parrot_add_n_n__N0_N2,                             /*   1295 */
+  Parrot_add_n_n__N0_N3,                             /*   1296 */
+  Parrot_add_n_n__N0_N4,                             /*   1297 */
+  Parrot_add_n_n__N0_N5,                             /*   1298 */
+  Parrot_add_n_n__N0_N6,                             /*   1299 */
+  Parrot_add_n_n__N0_N7,                             /*   1300 */
+  Parrot_add_n_n__N1_N0,                             /*   1301 */
+  Parrot_add_n_n__N1_N1,                             /*   1302 */
+  Parrot_add_n_n__N1_N2,                             /*   1303 */
+  Parrot_add_n_n__N1_N3,                             /*   1304 */
+  Parrot_add_n_n__N1_N4,                             /*   1305 */
+  Parrot_add_n_n__N1_N5,                             /*   1306 */
+  Parrot_add_n_n__N1_N6,                             /*   1307 */
+  Parrot_add_n_n__N1_N7,                             /*   1308 */
+  Parrot_add_n_n__N2_N0,                             /*   1309 */
+  Parrot_add_n_n__N2_N1,                             /*   1310 */
+  Parrot_add_n_n__N2_N2,                             /*   1311 */
+  Parrot_add_n_n__N2_N3,                             /*   1312 */
+  Parrot_add_n_n__N2_N4,                             /*   1313 */
+  Parrot_add_n_n__N2_N5,                             /*   1314 */
+  Parrot_add_n_n__N2_N6,                             /*   1315 */
+  Parrot_add_n_n__N2_N7,                             /*   1316 */
+  Parrot_add_n_n__N3_N0,                             /*   1317 */
+  Parrot_add_n_n__N3_N1,                             /*   1318 */
+  Parrot_add_n_n__N3_N2,                             /*   1319 */
+  Parrot_add_n_n__N3_N3,                             /*   1320 */
+  Parrot_add_n_n__N3_N4,                             /*   1321 */
+  Parrot_add_n_n__N3_N5,                             /*   1322 */
+  Parrot_add_n_n__N3_N6,                             /*   1323 */
+  Parrot_add_n_n__N3_N7,                             /*   1324 */
+  Parrot_add_n_n__N4_N0,                             /*   1325 */
+  Parrot_add_n_n__N4_N1,                             /*   1326 */
+  Parrot_add_n_n__N4_N2,                             /*   1327 */
+  Parrot_add_n_n__N4_N3,                             /*   1328 */
+  Parrot_add_n_n__N4_N4,                             /*   1329 */
+  Parrot_add_n_n__N4_N5,                             /*   1330 */
+  Parrot_add_n_n__N4_N6,                             /*   1331 */
+  Parrot_add_n_n__N4_N7,                             /*   1332 */
+  Parrot_add_n_n__N5_N0,                             /*   1333 */
+  Parrot_add_n_n__N5_N1,                             /*   1334 */
+  Parrot_add_n_n__N5_N2,                             /*   1335 */
+  Parrot_add_n_n__N5_N3,                             /*   1336 */
+  Parrot_add_n_n__N5_N4,                             /*   1337 */
+  Parrot_add_n_n__N5_N5,                             /*   1338 */
+  Parrot_add_n_n__N5_N6,                             /*   1339 */
+  Parrot_add_n_n__N5_N7,                             /*   1340 */
+  Parrot_add_n_n__N6_N0,                             /*   1341 */
+  Parrot_add_n_n__N6_N1,                             /*   1342 */
+  Parrot_add_n_n__N6_N2,                             /*   1343 */
+  Parrot_add_n_n__N6_N3,                             /*   1344 */
+  Parrot_add_n_n__N6_N4,                             /*   1345 */
+  Parrot_add_n_n__N6_N5,                             /*   1346 */
+  Parrot_add_n_n__N6_N6,                             /*   1347 */
+  Parrot_add_n_n__N6_N7,                             /*   1348 */
+  Parrot_add_n_n__N7_N0,                             /*   1349 */
+  Parrot_add_n_n__N7_N1,                             /*   1350 */
+  Parrot_add_n_n__N7_N2,                             /*   1351 */
+  Parrot_add_n_n__N7_N3,                             /*   1352 */
+  Parrot_add_n_n__N7_N4,                             /*   1353 */
+  Parrot_add_n_n__N7_N5,                             /*   1354 */
+  Parrot_add_n_n__N7_N6,                             /*   1355 */
+  Parrot_add_n_n__N7_N7,                             /*   1356 */
 
   NULL /* NULL function pointer */
 };
@@ -1156,7 +1446,7 @@ static op_func_t core_op_func_table[1072] = {
 ** Op Info Table:
 */
 
-static op_info_t core_op_info_table[1072] = {
+static op_info_t core_op_info_table[1358] = {
   { /* 0 */
     /* type PARROT_INLINE_OP, */
     "end",
@@ -15080,10742 +15370,16608 @@ static op_info_t core_op_info_table[1072] = {
     { 0 },
     &core_op_lib
   },
+  { /* 1071 */
+    /* type PARROT_INLINE_OP, */
+    "le_i_ic_ic__mod_i_i_i__unless_i_ic",
+    "le_i_ic_ic__mod_i_i_i__unless_i_ic",
+    "Parrot_le_i_ic_ic__mod_i_i_i__unless_i_ic",
+    /* "",  body */
+    PARROT_JUMP_RELATIVE,
+    11,
+    { PARROT_ARG_I, PARROT_ARG_IC, PARROT_ARG_IC, PARROT_ARG_IC, PARROT_ARG_I, PARROT_ARG_I, PARROT_ARG_I, PARROT_ARG_IC, PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 1, 0, 0, 0, 0, 0, 0, 0 },
+    &core_op_lib
+  },
+  { /* 1072 */
+    /* type PARROT_INLINE_OP, */
+    "dec_i__branch_ic",
+    "dec_i__branch_ic",
+    "Parrot_dec_i__branch_ic",
+    /* "",  body */
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_IC, PARROT_ARG_IC },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &core_op_lib
+  },
+  { /* 1073 */
+    /* type PARROT_INLINE_OP, */
+    "inc_i__eq_i_i_ic__branch_ic",
+    "inc_i__eq_i_i_ic__branch_ic",
+    "Parrot_inc_i__eq_i_i_ic__branch_ic",
+    /* "",  body */
+    PARROT_JUMP_RELATIVE,
+    8,
+    { PARROT_ARG_I, PARROT_ARG_IC, PARROT_ARG_I, PARROT_ARG_I, PARROT_ARG_IC, PARROT_ARG_IC, PARROT_ARG_IC },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0, 0, 0, 0, 0 },
+    &core_op_lib
+  },
+  { /* 1074 */
+    /* type PARROT_INLINE_OP, */
+    "set_i_ic__lt_i_i_ic",
+    "set_i_ic__lt_i_i_ic",
+    "Parrot_set_i_ic__lt_i_i_ic",
+    /* "",  body */
+    PARROT_JUMP_RELATIVE,
+    7,
+    { PARROT_ARG_I, PARROT_ARG_IC, PARROT_ARG_IC, PARROT_ARG_I, PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0, 0, 0, 0 },
+    &core_op_lib
+  },
+  { /* 1075 */
+    /* type PARROT_INLINE_OP, */
+    "inc_i__lt_i_i_ic",
+    "inc_i__lt_i_i_ic",
+    "Parrot_inc_i__lt_i_i_ic",
+    /* "",  body */
+    PARROT_JUMP_RELATIVE,
+    6,
+    { PARROT_ARG_I, PARROT_ARG_IC, PARROT_ARG_I, PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0, 0, 0 },
+    &core_op_lib
+  },
+  { /* 1076 */
+    /* type PARROT_INLINE_OP, */
+    "inc_i__branch_ic",
+    "inc_i__branch_ic",
+    "Parrot_inc_i__branch_ic",
+    /* "",  body */
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_IC, PARROT_ARG_IC },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &core_op_lib
+  },
+  { /* 1077 */
+    /* type PARROT_INLINE_OP, */
+    "inc",
+    "inc_i__I0",
+    "Parrot_inc_i__I0",
+    /* "",  body */
+    0,
+    2,
+    { PARROT_ARG_I },
+    { PARROT_ARGDIR_INOUT },
+    { 0 },
+    &core_op_lib
+  },
+  { /* 1078 */
+    /* type PARROT_INLINE_OP, */
+    "inc",
+    "inc_i__I1",
+    "Parrot_inc_i__I1",
+    /* "",  body */
+    0,
+    2,
+    { PARROT_ARG_I },
+    { PARROT_ARGDIR_INOUT },
+    { 0 },
+    &core_op_lib
+  },
+  { /* 1079 */
+    /* type PARROT_INLINE_OP, */
+    "inc",
+    "inc_i__I2",
+    "Parrot_inc_i__I2",
+    /* "",  body */
+    0,
+    2,
+    { PARROT_ARG_I },
+    { PARROT_ARGDIR_INOUT },
+    { 0 },
+    &core_op_lib
+  },
+  { /* 1080 */
+    /* type PARROT_INLINE_OP, */
+    "inc",
+    "inc_i__I3",
+    "Parrot_inc_i__I3",
+    /* "",  body */
+    0,
+    2,
+    { PARROT_ARG_I },
+    { PARROT_ARGDIR_INOUT },
+    { 0 },
+    &core_op_lib
+  },
+  { /* 1081 */
+    /* type PARROT_INLINE_OP, */
+    "inc",
+    "inc_i__I4",
+    "Parrot_inc_i__I4",
+    /* "",  body */
+    0,
+    2,
+    { PARROT_ARG_I },
+    { PARROT_ARGDIR_INOUT },
+    { 0 },
+    &core_op_lib
+  },
+  { /* 1082 */
+    /* type PARROT_INLINE_OP, */
+    "inc",
+    "inc_i__I5",
+    "Parrot_inc_i__I5",
+    /* "",  body */
+    0,
+    2,
+    { PARROT_ARG_I },
+    { PARROT_ARGDIR_INOUT },
+    { 0 },
+    &core_op_lib
+  },
+  { /* 1083 */
+    /* type PARROT_INLINE_OP, */
+    "inc",
+    "inc_i__I6",
+    "Parrot_inc_i__I6",
+    /* "",  body */
+    0,
+    2,
+    { PARROT_ARG_I },
+    { PARROT_ARGDIR_INOUT },
+    { 0 },
+    &core_op_lib
+  },
+  { /* 1084 */
+    /* type PARROT_INLINE_OP, */
+    "inc",
+    "inc_i__I7",
+    "Parrot_inc_i__I7",
+    /* "",  body */
+    0,
+    2,
+    { PARROT_ARG_I },
+    { PARROT_ARGDIR_INOUT },
+    { 0 },
+    &core_op_lib
+  },
+  { /* 1085 */
+    /* type PARROT_INLINE_OP, */
+    "dec",
+    "dec_i__I0",
+    "Parrot_dec_i__I0",
+    /* "",  body */
+    0,
+    2,
+    { PARROT_ARG_I },
+    { PARROT_ARGDIR_INOUT },
+    { 0 },
+    &core_op_lib
+  },
+  { /* 1086 */
+    /* type PARROT_INLINE_OP, */
+    "dec",
+    "dec_i__I1",
+    "Parrot_dec_i__I1",
+    /* "",  body */
+    0,
+    2,
+    { PARROT_ARG_I },
+    { PARROT_ARGDIR_INOUT },
+    { 0 },
+    &core_op_lib
+  },
+  { /* 1087 */
+    /* type PARROT_INLINE_OP, */
+    "dec",
+    "dec_i__I2",
+    "Parrot_dec_i__I2",
+    /* "",  body */
+    0,
+    2,
+    { PARROT_ARG_I },
+    { PARROT_ARGDIR_INOUT },
+    { 0 },
+    &core_op_lib
+  },
+  { /* 1088 */
+    /* type PARROT_INLINE_OP, */
+    "dec",
+    "dec_i__I3",
+    "Parrot_dec_i__I3",
+    /* "",  body */
+    0,
+    2,
+    { PARROT_ARG_I },
+    { PARROT_ARGDIR_INOUT },
+    { 0 },
+    &core_op_lib
+  },
+  { /* 1089 */
+    /* type PARROT_INLINE_OP, */
+    "dec",
+    "dec_i__I4",
+    "Parrot_dec_i__I4",
+    /* "",  body */
+    0,
+    2,
+    { PARROT_ARG_I },
+    { PARROT_ARGDIR_INOUT },
+    { 0 },
+    &core_op_lib
+  },
+  { /* 1090 */
+    /* type PARROT_INLINE_OP, */
+    "dec",
+    "dec_i__I5",
+    "Parrot_dec_i__I5",
+    /* "",  body */
+    0,
+    2,
+    { PARROT_ARG_I },
+    { PARROT_ARGDIR_INOUT },
+    { 0 },
+    &core_op_lib
+  },
+  { /* 1091 */
+    /* type PARROT_INLINE_OP, */
+    "dec",
+    "dec_i__I6",
+    "Parrot_dec_i__I6",
+    /* "",  body */
+    0,
+    2,
+    { PARROT_ARG_I },
+    { PARROT_ARGDIR_INOUT },
+    { 0 },
+    &core_op_lib
+  },
+  { /* 1092 */
+    /* type PARROT_INLINE_OP, */
+    "dec",
+    "dec_i__I7",
+    "Parrot_dec_i__I7",
+    /* "",  body */
+    0,
+    2,
+    { PARROT_ARG_I },
+    { PARROT_ARGDIR_INOUT },
+    { 0 },
+    &core_op_lib
+  },
+  { /* 1093 */
+    /* type PARROT_INLINE_OP, */
+    "set",
+    "set_i_ic__I0",
+    "Parrot_set_i_ic__I0",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1094 */
+    /* type PARROT_INLINE_OP, */
+    "set",
+    "set_i_ic__I1",
+    "Parrot_set_i_ic__I1",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1095 */
+    /* type PARROT_INLINE_OP, */
+    "set",
+    "set_i_ic__I2",
+    "Parrot_set_i_ic__I2",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1096 */
+    /* type PARROT_INLINE_OP, */
+    "set",
+    "set_i_ic__I3",
+    "Parrot_set_i_ic__I3",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1097 */
+    /* type PARROT_INLINE_OP, */
+    "set",
+    "set_i_ic__I4",
+    "Parrot_set_i_ic__I4",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1098 */
+    /* type PARROT_INLINE_OP, */
+    "set",
+    "set_i_ic__I5",
+    "Parrot_set_i_ic__I5",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1099 */
+    /* type PARROT_INLINE_OP, */
+    "set",
+    "set_i_ic__I6",
+    "Parrot_set_i_ic__I6",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1100 */
+    /* type PARROT_INLINE_OP, */
+    "set",
+    "set_i_ic__I7",
+    "Parrot_set_i_ic__I7",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1101 */
+    /* type PARROT_INLINE_OP, */
+    "lt",
+    "lt_i_i_ic__I0_I0",
+    "Parrot_lt_i_i_ic__I0_I0",
+    /* "",  body */
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 1 },
+    &core_op_lib
+  },
+  { /* 1102 */
+    /* type PARROT_INLINE_OP, */
+    "lt",
+    "lt_i_i_ic__I0_I1",
+    "Parrot_lt_i_i_ic__I0_I1",
+    /* "",  body */
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 1 },
+    &core_op_lib
+  },
+  { /* 1103 */
+    /* type PARROT_INLINE_OP, */
+    "lt",
+    "lt_i_i_ic__I0_I2",
+    "Parrot_lt_i_i_ic__I0_I2",
+    /* "",  body */
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 1 },
+    &core_op_lib
+  },
+  { /* 1104 */
+    /* type PARROT_INLINE_OP, */
+    "lt",
+    "lt_i_i_ic__I0_I3",
+    "Parrot_lt_i_i_ic__I0_I3",
+    /* "",  body */
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 1 },
+    &core_op_lib
+  },
+  { /* 1105 */
+    /* type PARROT_INLINE_OP, */
+    "lt",
+    "lt_i_i_ic__I0_I4",
+    "Parrot_lt_i_i_ic__I0_I4",
+    /* "",  body */
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 1 },
+    &core_op_lib
+  },
+  { /* 1106 */
+    /* type PARROT_INLINE_OP, */
+    "lt",
+    "lt_i_i_ic__I0_I5",
+    "Parrot_lt_i_i_ic__I0_I5",
+    /* "",  body */
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 1 },
+    &core_op_lib
+  },
+  { /* 1107 */
+    /* type PARROT_INLINE_OP, */
+    "lt",
+    "lt_i_i_ic__I0_I6",
+    "Parrot_lt_i_i_ic__I0_I6",
+    /* "",  body */
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 1 },
+    &core_op_lib
+  },
+  { /* 1108 */
+    /* type PARROT_INLINE_OP, */
+    "lt",
+    "lt_i_i_ic__I0_I7",
+    "Parrot_lt_i_i_ic__I0_I7",
+    /* "",  body */
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 1 },
+    &core_op_lib
+  },
+  { /* 1109 */
+    /* type PARROT_INLINE_OP, */
+    "lt",
+    "lt_i_i_ic__I1_I0",
+    "Parrot_lt_i_i_ic__I1_I0",
+    /* "",  body */
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 1 },
+    &core_op_lib
+  },
+  { /* 1110 */
+    /* type PARROT_INLINE_OP, */
+    "lt",
+    "lt_i_i_ic__I1_I1",
+    "Parrot_lt_i_i_ic__I1_I1",
+    /* "",  body */
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 1 },
+    &core_op_lib
+  },
+  { /* 1111 */
+    /* type PARROT_INLINE_OP, */
+    "lt",
+    "lt_i_i_ic__I1_I2",
+    "Parrot_lt_i_i_ic__I1_I2",
+    /* "",  body */
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 1 },
+    &core_op_lib
+  },
+  { /* 1112 */
+    /* type PARROT_INLINE_OP, */
+    "lt",
+    "lt_i_i_ic__I1_I3",
+    "Parrot_lt_i_i_ic__I1_I3",
+    /* "",  body */
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 1 },
+    &core_op_lib
+  },
+  { /* 1113 */
+    /* type PARROT_INLINE_OP, */
+    "lt",
+    "lt_i_i_ic__I1_I4",
+    "Parrot_lt_i_i_ic__I1_I4",
+    /* "",  body */
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 1 },
+    &core_op_lib
+  },
+  { /* 1114 */
+    /* type PARROT_INLINE_OP, */
+    "lt",
+    "lt_i_i_ic__I1_I5",
+    "Parrot_lt_i_i_ic__I1_I5",
+    /* "",  body */
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 1 },
+    &core_op_lib
+  },
+  { /* 1115 */
+    /* type PARROT_INLINE_OP, */
+    "lt",
+    "lt_i_i_ic__I1_I6",
+    "Parrot_lt_i_i_ic__I1_I6",
+    /* "",  body */
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 1 },
+    &core_op_lib
+  },
+  { /* 1116 */
+    /* type PARROT_INLINE_OP, */
+    "lt",
+    "lt_i_i_ic__I1_I7",
+    "Parrot_lt_i_i_ic__I1_I7",
+    /* "",  body */
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 1 },
+    &core_op_lib
+  },
+  { /* 1117 */
+    /* type PARROT_INLINE_OP, */
+    "lt",
+    "lt_i_i_ic__I2_I0",
+    "Parrot_lt_i_i_ic__I2_I0",
+    /* "",  body */
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 1 },
+    &core_op_lib
+  },
+  { /* 1118 */
+    /* type PARROT_INLINE_OP, */
+    "lt",
+    "lt_i_i_ic__I2_I1",
+    "Parrot_lt_i_i_ic__I2_I1",
+    /* "",  body */
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 1 },
+    &core_op_lib
+  },
+  { /* 1119 */
+    /* type PARROT_INLINE_OP, */
+    "lt",
+    "lt_i_i_ic__I2_I2",
+    "Parrot_lt_i_i_ic__I2_I2",
+    /* "",  body */
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 1 },
+    &core_op_lib
+  },
+  { /* 1120 */
+    /* type PARROT_INLINE_OP, */
+    "lt",
+    "lt_i_i_ic__I2_I3",
+    "Parrot_lt_i_i_ic__I2_I3",
+    /* "",  body */
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 1 },
+    &core_op_lib
+  },
+  { /* 1121 */
+    /* type PARROT_INLINE_OP, */
+    "lt",
+    "lt_i_i_ic__I2_I4",
+    "Parrot_lt_i_i_ic__I2_I4",
+    /* "",  body */
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 1 },
+    &core_op_lib
+  },
+  { /* 1122 */
+    /* type PARROT_INLINE_OP, */
+    "lt",
+    "lt_i_i_ic__I2_I5",
+    "Parrot_lt_i_i_ic__I2_I5",
+    /* "",  body */
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 1 },
+    &core_op_lib
+  },
+  { /* 1123 */
+    /* type PARROT_INLINE_OP, */
+    "lt",
+    "lt_i_i_ic__I2_I6",
+    "Parrot_lt_i_i_ic__I2_I6",
+    /* "",  body */
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 1 },
+    &core_op_lib
+  },
+  { /* 1124 */
+    /* type PARROT_INLINE_OP, */
+    "lt",
+    "lt_i_i_ic__I2_I7",
+    "Parrot_lt_i_i_ic__I2_I7",
+    /* "",  body */
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 1 },
+    &core_op_lib
+  },
+  { /* 1125 */
+    /* type PARROT_INLINE_OP, */
+    "lt",
+    "lt_i_i_ic__I3_I0",
+    "Parrot_lt_i_i_ic__I3_I0",
+    /* "",  body */
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 1 },
+    &core_op_lib
+  },
+  { /* 1126 */
+    /* type PARROT_INLINE_OP, */
+    "lt",
+    "lt_i_i_ic__I3_I1",
+    "Parrot_lt_i_i_ic__I3_I1",
+    /* "",  body */
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 1 },
+    &core_op_lib
+  },
+  { /* 1127 */
+    /* type PARROT_INLINE_OP, */
+    "lt",
+    "lt_i_i_ic__I3_I2",
+    "Parrot_lt_i_i_ic__I3_I2",
+    /* "",  body */
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 1 },
+    &core_op_lib
+  },
+  { /* 1128 */
+    /* type PARROT_INLINE_OP, */
+    "lt",
+    "lt_i_i_ic__I3_I3",
+    "Parrot_lt_i_i_ic__I3_I3",
+    /* "",  body */
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 1 },
+    &core_op_lib
+  },
+  { /* 1129 */
+    /* type PARROT_INLINE_OP, */
+    "lt",
+    "lt_i_i_ic__I3_I4",
+    "Parrot_lt_i_i_ic__I3_I4",
+    /* "",  body */
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 1 },
+    &core_op_lib
+  },
+  { /* 1130 */
+    /* type PARROT_INLINE_OP, */
+    "lt",
+    "lt_i_i_ic__I3_I5",
+    "Parrot_lt_i_i_ic__I3_I5",
+    /* "",  body */
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 1 },
+    &core_op_lib
+  },
+  { /* 1131 */
+    /* type PARROT_INLINE_OP, */
+    "lt",
+    "lt_i_i_ic__I3_I6",
+    "Parrot_lt_i_i_ic__I3_I6",
+    /* "",  body */
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 1 },
+    &core_op_lib
+  },
+  { /* 1132 */
+    /* type PARROT_INLINE_OP, */
+    "lt",
+    "lt_i_i_ic__I3_I7",
+    "Parrot_lt_i_i_ic__I3_I7",
+    /* "",  body */
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 1 },
+    &core_op_lib
+  },
+  { /* 1133 */
+    /* type PARROT_INLINE_OP, */
+    "lt",
+    "lt_i_i_ic__I4_I0",
+    "Parrot_lt_i_i_ic__I4_I0",
+    /* "",  body */
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 1 },
+    &core_op_lib
+  },
+  { /* 1134 */
+    /* type PARROT_INLINE_OP, */
+    "lt",
+    "lt_i_i_ic__I4_I1",
+    "Parrot_lt_i_i_ic__I4_I1",
+    /* "",  body */
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 1 },
+    &core_op_lib
+  },
+  { /* 1135 */
+    /* type PARROT_INLINE_OP, */
+    "lt",
+    "lt_i_i_ic__I4_I2",
+    "Parrot_lt_i_i_ic__I4_I2",
+    /* "",  body */
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 1 },
+    &core_op_lib
+  },
+  { /* 1136 */
+    /* type PARROT_INLINE_OP, */
+    "lt",
+    "lt_i_i_ic__I4_I3",
+    "Parrot_lt_i_i_ic__I4_I3",
+    /* "",  body */
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 1 },
+    &core_op_lib
+  },
+  { /* 1137 */
+    /* type PARROT_INLINE_OP, */
+    "lt",
+    "lt_i_i_ic__I4_I4",
+    "Parrot_lt_i_i_ic__I4_I4",
+    /* "",  body */
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 1 },
+    &core_op_lib
+  },
+  { /* 1138 */
+    /* type PARROT_INLINE_OP, */
+    "lt",
+    "lt_i_i_ic__I4_I5",
+    "Parrot_lt_i_i_ic__I4_I5",
+    /* "",  body */
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 1 },
+    &core_op_lib
+  },
+  { /* 1139 */
+    /* type PARROT_INLINE_OP, */
+    "lt",
+    "lt_i_i_ic__I4_I6",
+    "Parrot_lt_i_i_ic__I4_I6",
+    /* "",  body */
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 1 },
+    &core_op_lib
+  },
+  { /* 1140 */
+    /* type PARROT_INLINE_OP, */
+    "lt",
+    "lt_i_i_ic__I4_I7",
+    "Parrot_lt_i_i_ic__I4_I7",
+    /* "",  body */
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 1 },
+    &core_op_lib
+  },
+  { /* 1141 */
+    /* type PARROT_INLINE_OP, */
+    "lt",
+    "lt_i_i_ic__I5_I0",
+    "Parrot_lt_i_i_ic__I5_I0",
+    /* "",  body */
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 1 },
+    &core_op_lib
+  },
+  { /* 1142 */
+    /* type PARROT_INLINE_OP, */
+    "lt",
+    "lt_i_i_ic__I5_I1",
+    "Parrot_lt_i_i_ic__I5_I1",
+    /* "",  body */
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 1 },
+    &core_op_lib
+  },
+  { /* 1143 */
+    /* type PARROT_INLINE_OP, */
+    "lt",
+    "lt_i_i_ic__I5_I2",
+    "Parrot_lt_i_i_ic__I5_I2",
+    /* "",  body */
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 1 },
+    &core_op_lib
+  },
+  { /* 1144 */
+    /* type PARROT_INLINE_OP, */
+    "lt",
+    "lt_i_i_ic__I5_I3",
+    "Parrot_lt_i_i_ic__I5_I3",
+    /* "",  body */
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 1 },
+    &core_op_lib
+  },
+  { /* 1145 */
+    /* type PARROT_INLINE_OP, */
+    "lt",
+    "lt_i_i_ic__I5_I4",
+    "Parrot_lt_i_i_ic__I5_I4",
+    /* "",  body */
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 1 },
+    &core_op_lib
+  },
+  { /* 1146 */
+    /* type PARROT_INLINE_OP, */
+    "lt",
+    "lt_i_i_ic__I5_I5",
+    "Parrot_lt_i_i_ic__I5_I5",
+    /* "",  body */
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 1 },
+    &core_op_lib
+  },
+  { /* 1147 */
+    /* type PARROT_INLINE_OP, */
+    "lt",
+    "lt_i_i_ic__I5_I6",
+    "Parrot_lt_i_i_ic__I5_I6",
+    /* "",  body */
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 1 },
+    &core_op_lib
+  },
+  { /* 1148 */
+    /* type PARROT_INLINE_OP, */
+    "lt",
+    "lt_i_i_ic__I5_I7",
+    "Parrot_lt_i_i_ic__I5_I7",
+    /* "",  body */
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 1 },
+    &core_op_lib
+  },
+  { /* 1149 */
+    /* type PARROT_INLINE_OP, */
+    "lt",
+    "lt_i_i_ic__I6_I0",
+    "Parrot_lt_i_i_ic__I6_I0",
+    /* "",  body */
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 1 },
+    &core_op_lib
+  },
+  { /* 1150 */
+    /* type PARROT_INLINE_OP, */
+    "lt",
+    "lt_i_i_ic__I6_I1",
+    "Parrot_lt_i_i_ic__I6_I1",
+    /* "",  body */
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 1 },
+    &core_op_lib
+  },
+  { /* 1151 */
+    /* type PARROT_INLINE_OP, */
+    "lt",
+    "lt_i_i_ic__I6_I2",
+    "Parrot_lt_i_i_ic__I6_I2",
+    /* "",  body */
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 1 },
+    &core_op_lib
+  },
+  { /* 1152 */
+    /* type PARROT_INLINE_OP, */
+    "lt",
+    "lt_i_i_ic__I6_I3",
+    "Parrot_lt_i_i_ic__I6_I3",
+    /* "",  body */
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 1 },
+    &core_op_lib
+  },
+  { /* 1153 */
+    /* type PARROT_INLINE_OP, */
+    "lt",
+    "lt_i_i_ic__I6_I4",
+    "Parrot_lt_i_i_ic__I6_I4",
+    /* "",  body */
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 1 },
+    &core_op_lib
+  },
+  { /* 1154 */
+    /* type PARROT_INLINE_OP, */
+    "lt",
+    "lt_i_i_ic__I6_I5",
+    "Parrot_lt_i_i_ic__I6_I5",
+    /* "",  body */
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 1 },
+    &core_op_lib
+  },
+  { /* 1155 */
+    /* type PARROT_INLINE_OP, */
+    "lt",
+    "lt_i_i_ic__I6_I6",
+    "Parrot_lt_i_i_ic__I6_I6",
+    /* "",  body */
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 1 },
+    &core_op_lib
+  },
+  { /* 1156 */
+    /* type PARROT_INLINE_OP, */
+    "lt",
+    "lt_i_i_ic__I6_I7",
+    "Parrot_lt_i_i_ic__I6_I7",
+    /* "",  body */
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 1 },
+    &core_op_lib
+  },
+  { /* 1157 */
+    /* type PARROT_INLINE_OP, */
+    "lt",
+    "lt_i_i_ic__I7_I0",
+    "Parrot_lt_i_i_ic__I7_I0",
+    /* "",  body */
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 1 },
+    &core_op_lib
+  },
+  { /* 1158 */
+    /* type PARROT_INLINE_OP, */
+    "lt",
+    "lt_i_i_ic__I7_I1",
+    "Parrot_lt_i_i_ic__I7_I1",
+    /* "",  body */
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 1 },
+    &core_op_lib
+  },
+  { /* 1159 */
+    /* type PARROT_INLINE_OP, */
+    "lt",
+    "lt_i_i_ic__I7_I2",
+    "Parrot_lt_i_i_ic__I7_I2",
+    /* "",  body */
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 1 },
+    &core_op_lib
+  },
+  { /* 1160 */
+    /* type PARROT_INLINE_OP, */
+    "lt",
+    "lt_i_i_ic__I7_I3",
+    "Parrot_lt_i_i_ic__I7_I3",
+    /* "",  body */
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 1 },
+    &core_op_lib
+  },
+  { /* 1161 */
+    /* type PARROT_INLINE_OP, */
+    "lt",
+    "lt_i_i_ic__I7_I4",
+    "Parrot_lt_i_i_ic__I7_I4",
+    /* "",  body */
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 1 },
+    &core_op_lib
+  },
+  { /* 1162 */
+    /* type PARROT_INLINE_OP, */
+    "lt",
+    "lt_i_i_ic__I7_I5",
+    "Parrot_lt_i_i_ic__I7_I5",
+    /* "",  body */
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 1 },
+    &core_op_lib
+  },
+  { /* 1163 */
+    /* type PARROT_INLINE_OP, */
+    "lt",
+    "lt_i_i_ic__I7_I6",
+    "Parrot_lt_i_i_ic__I7_I6",
+    /* "",  body */
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 1 },
+    &core_op_lib
+  },
+  { /* 1164 */
+    /* type PARROT_INLINE_OP, */
+    "lt",
+    "lt_i_i_ic__I7_I7",
+    "Parrot_lt_i_i_ic__I7_I7",
+    /* "",  body */
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 1 },
+    &core_op_lib
+  },
+  { /* 1165 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_i_i__I0_I0",
+    "Parrot_add_i_i__I0_I0",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1166 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_i_i__I0_I1",
+    "Parrot_add_i_i__I0_I1",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1167 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_i_i__I0_I2",
+    "Parrot_add_i_i__I0_I2",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1168 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_i_i__I0_I3",
+    "Parrot_add_i_i__I0_I3",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1169 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_i_i__I0_I4",
+    "Parrot_add_i_i__I0_I4",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1170 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_i_i__I0_I5",
+    "Parrot_add_i_i__I0_I5",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1171 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_i_i__I0_I6",
+    "Parrot_add_i_i__I0_I6",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1172 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_i_i__I0_I7",
+    "Parrot_add_i_i__I0_I7",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1173 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_i_i__I1_I0",
+    "Parrot_add_i_i__I1_I0",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1174 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_i_i__I1_I1",
+    "Parrot_add_i_i__I1_I1",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1175 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_i_i__I1_I2",
+    "Parrot_add_i_i__I1_I2",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1176 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_i_i__I1_I3",
+    "Parrot_add_i_i__I1_I3",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1177 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_i_i__I1_I4",
+    "Parrot_add_i_i__I1_I4",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1178 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_i_i__I1_I5",
+    "Parrot_add_i_i__I1_I5",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1179 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_i_i__I1_I6",
+    "Parrot_add_i_i__I1_I6",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1180 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_i_i__I1_I7",
+    "Parrot_add_i_i__I1_I7",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1181 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_i_i__I2_I0",
+    "Parrot_add_i_i__I2_I0",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1182 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_i_i__I2_I1",
+    "Parrot_add_i_i__I2_I1",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1183 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_i_i__I2_I2",
+    "Parrot_add_i_i__I2_I2",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1184 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_i_i__I2_I3",
+    "Parrot_add_i_i__I2_I3",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1185 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_i_i__I2_I4",
+    "Parrot_add_i_i__I2_I4",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1186 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_i_i__I2_I5",
+    "Parrot_add_i_i__I2_I5",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1187 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_i_i__I2_I6",
+    "Parrot_add_i_i__I2_I6",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1188 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_i_i__I2_I7",
+    "Parrot_add_i_i__I2_I7",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1189 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_i_i__I3_I0",
+    "Parrot_add_i_i__I3_I0",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1190 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_i_i__I3_I1",
+    "Parrot_add_i_i__I3_I1",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1191 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_i_i__I3_I2",
+    "Parrot_add_i_i__I3_I2",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1192 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_i_i__I3_I3",
+    "Parrot_add_i_i__I3_I3",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1193 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_i_i__I3_I4",
+    "Parrot_add_i_i__I3_I4",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1194 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_i_i__I3_I5",
+    "Parrot_add_i_i__I3_I5",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1195 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_i_i__I3_I6",
+    "Parrot_add_i_i__I3_I6",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1196 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_i_i__I3_I7",
+    "Parrot_add_i_i__I3_I7",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1197 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_i_i__I4_I0",
+    "Parrot_add_i_i__I4_I0",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1198 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_i_i__I4_I1",
+    "Parrot_add_i_i__I4_I1",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1199 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_i_i__I4_I2",
+    "Parrot_add_i_i__I4_I2",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1200 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_i_i__I4_I3",
+    "Parrot_add_i_i__I4_I3",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1201 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_i_i__I4_I4",
+    "Parrot_add_i_i__I4_I4",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1202 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_i_i__I4_I5",
+    "Parrot_add_i_i__I4_I5",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1203 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_i_i__I4_I6",
+    "Parrot_add_i_i__I4_I6",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1204 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_i_i__I4_I7",
+    "Parrot_add_i_i__I4_I7",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1205 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_i_i__I5_I0",
+    "Parrot_add_i_i__I5_I0",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1206 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_i_i__I5_I1",
+    "Parrot_add_i_i__I5_I1",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1207 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_i_i__I5_I2",
+    "Parrot_add_i_i__I5_I2",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1208 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_i_i__I5_I3",
+    "Parrot_add_i_i__I5_I3",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1209 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_i_i__I5_I4",
+    "Parrot_add_i_i__I5_I4",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1210 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_i_i__I5_I5",
+    "Parrot_add_i_i__I5_I5",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1211 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_i_i__I5_I6",
+    "Parrot_add_i_i__I5_I6",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1212 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_i_i__I5_I7",
+    "Parrot_add_i_i__I5_I7",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1213 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_i_i__I6_I0",
+    "Parrot_add_i_i__I6_I0",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1214 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_i_i__I6_I1",
+    "Parrot_add_i_i__I6_I1",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1215 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_i_i__I6_I2",
+    "Parrot_add_i_i__I6_I2",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1216 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_i_i__I6_I3",
+    "Parrot_add_i_i__I6_I3",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1217 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_i_i__I6_I4",
+    "Parrot_add_i_i__I6_I4",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1218 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_i_i__I6_I5",
+    "Parrot_add_i_i__I6_I5",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1219 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_i_i__I6_I6",
+    "Parrot_add_i_i__I6_I6",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1220 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_i_i__I6_I7",
+    "Parrot_add_i_i__I6_I7",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1221 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_i_i__I7_I0",
+    "Parrot_add_i_i__I7_I0",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1222 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_i_i__I7_I1",
+    "Parrot_add_i_i__I7_I1",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1223 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_i_i__I7_I2",
+    "Parrot_add_i_i__I7_I2",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1224 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_i_i__I7_I3",
+    "Parrot_add_i_i__I7_I3",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1225 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_i_i__I7_I4",
+    "Parrot_add_i_i__I7_I4",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1226 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_i_i__I7_I5",
+    "Parrot_add_i_i__I7_I5",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1227 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_i_i__I7_I6",
+    "Parrot_add_i_i__I7_I6",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1228 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_i_i__I7_I7",
+    "Parrot_add_i_i__I7_I7",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1229 */
+    /* type PARROT_INLINE_OP, */
+    "set",
+    "set_i_i__I0_I0",
+    "Parrot_set_i_i__I0_I0",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1230 */
+    /* type PARROT_INLINE_OP, */
+    "set",
+    "set_i_i__I0_I1",
+    "Parrot_set_i_i__I0_I1",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1231 */
+    /* type PARROT_INLINE_OP, */
+    "set",
+    "set_i_i__I0_I2",
+    "Parrot_set_i_i__I0_I2",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1232 */
+    /* type PARROT_INLINE_OP, */
+    "set",
+    "set_i_i__I0_I3",
+    "Parrot_set_i_i__I0_I3",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1233 */
+    /* type PARROT_INLINE_OP, */
+    "set",
+    "set_i_i__I0_I4",
+    "Parrot_set_i_i__I0_I4",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1234 */
+    /* type PARROT_INLINE_OP, */
+    "set",
+    "set_i_i__I0_I5",
+    "Parrot_set_i_i__I0_I5",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1235 */
+    /* type PARROT_INLINE_OP, */
+    "set",
+    "set_i_i__I0_I6",
+    "Parrot_set_i_i__I0_I6",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1236 */
+    /* type PARROT_INLINE_OP, */
+    "set",
+    "set_i_i__I0_I7",
+    "Parrot_set_i_i__I0_I7",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1237 */
+    /* type PARROT_INLINE_OP, */
+    "set",
+    "set_i_i__I1_I0",
+    "Parrot_set_i_i__I1_I0",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1238 */
+    /* type PARROT_INLINE_OP, */
+    "set",
+    "set_i_i__I1_I1",
+    "Parrot_set_i_i__I1_I1",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1239 */
+    /* type PARROT_INLINE_OP, */
+    "set",
+    "set_i_i__I1_I2",
+    "Parrot_set_i_i__I1_I2",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1240 */
+    /* type PARROT_INLINE_OP, */
+    "set",
+    "set_i_i__I1_I3",
+    "Parrot_set_i_i__I1_I3",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1241 */
+    /* type PARROT_INLINE_OP, */
+    "set",
+    "set_i_i__I1_I4",
+    "Parrot_set_i_i__I1_I4",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1242 */
+    /* type PARROT_INLINE_OP, */
+    "set",
+    "set_i_i__I1_I5",
+    "Parrot_set_i_i__I1_I5",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1243 */
+    /* type PARROT_INLINE_OP, */
+    "set",
+    "set_i_i__I1_I6",
+    "Parrot_set_i_i__I1_I6",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1244 */
+    /* type PARROT_INLINE_OP, */
+    "set",
+    "set_i_i__I1_I7",
+    "Parrot_set_i_i__I1_I7",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1245 */
+    /* type PARROT_INLINE_OP, */
+    "set",
+    "set_i_i__I2_I0",
+    "Parrot_set_i_i__I2_I0",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1246 */
+    /* type PARROT_INLINE_OP, */
+    "set",
+    "set_i_i__I2_I1",
+    "Parrot_set_i_i__I2_I1",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1247 */
+    /* type PARROT_INLINE_OP, */
+    "set",
+    "set_i_i__I2_I2",
+    "Parrot_set_i_i__I2_I2",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1248 */
+    /* type PARROT_INLINE_OP, */
+    "set",
+    "set_i_i__I2_I3",
+    "Parrot_set_i_i__I2_I3",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1249 */
+    /* type PARROT_INLINE_OP, */
+    "set",
+    "set_i_i__I2_I4",
+    "Parrot_set_i_i__I2_I4",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1250 */
+    /* type PARROT_INLINE_OP, */
+    "set",
+    "set_i_i__I2_I5",
+    "Parrot_set_i_i__I2_I5",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1251 */
+    /* type PARROT_INLINE_OP, */
+    "set",
+    "set_i_i__I2_I6",
+    "Parrot_set_i_i__I2_I6",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1252 */
+    /* type PARROT_INLINE_OP, */
+    "set",
+    "set_i_i__I2_I7",
+    "Parrot_set_i_i__I2_I7",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1253 */
+    /* type PARROT_INLINE_OP, */
+    "set",
+    "set_i_i__I3_I0",
+    "Parrot_set_i_i__I3_I0",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1254 */
+    /* type PARROT_INLINE_OP, */
+    "set",
+    "set_i_i__I3_I1",
+    "Parrot_set_i_i__I3_I1",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1255 */
+    /* type PARROT_INLINE_OP, */
+    "set",
+    "set_i_i__I3_I2",
+    "Parrot_set_i_i__I3_I2",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1256 */
+    /* type PARROT_INLINE_OP, */
+    "set",
+    "set_i_i__I3_I3",
+    "Parrot_set_i_i__I3_I3",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1257 */
+    /* type PARROT_INLINE_OP, */
+    "set",
+    "set_i_i__I3_I4",
+    "Parrot_set_i_i__I3_I4",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1258 */
+    /* type PARROT_INLINE_OP, */
+    "set",
+    "set_i_i__I3_I5",
+    "Parrot_set_i_i__I3_I5",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1259 */
+    /* type PARROT_INLINE_OP, */
+    "set",
+    "set_i_i__I3_I6",
+    "Parrot_set_i_i__I3_I6",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1260 */
+    /* type PARROT_INLINE_OP, */
+    "set",
+    "set_i_i__I3_I7",
+    "Parrot_set_i_i__I3_I7",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1261 */
+    /* type PARROT_INLINE_OP, */
+    "set",
+    "set_i_i__I4_I0",
+    "Parrot_set_i_i__I4_I0",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1262 */
+    /* type PARROT_INLINE_OP, */
+    "set",
+    "set_i_i__I4_I1",
+    "Parrot_set_i_i__I4_I1",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1263 */
+    /* type PARROT_INLINE_OP, */
+    "set",
+    "set_i_i__I4_I2",
+    "Parrot_set_i_i__I4_I2",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1264 */
+    /* type PARROT_INLINE_OP, */
+    "set",
+    "set_i_i__I4_I3",
+    "Parrot_set_i_i__I4_I3",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1265 */
+    /* type PARROT_INLINE_OP, */
+    "set",
+    "set_i_i__I4_I4",
+    "Parrot_set_i_i__I4_I4",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1266 */
+    /* type PARROT_INLINE_OP, */
+    "set",
+    "set_i_i__I4_I5",
+    "Parrot_set_i_i__I4_I5",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1267 */
+    /* type PARROT_INLINE_OP, */
+    "set",
+    "set_i_i__I4_I6",
+    "Parrot_set_i_i__I4_I6",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1268 */
+    /* type PARROT_INLINE_OP, */
+    "set",
+    "set_i_i__I4_I7",
+    "Parrot_set_i_i__I4_I7",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1269 */
+    /* type PARROT_INLINE_OP, */
+    "set",
+    "set_i_i__I5_I0",
+    "Parrot_set_i_i__I5_I0",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1270 */
+    /* type PARROT_INLINE_OP, */
+    "set",
+    "set_i_i__I5_I1",
+    "Parrot_set_i_i__I5_I1",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1271 */
+    /* type PARROT_INLINE_OP, */
+    "set",
+    "set_i_i__I5_I2",
+    "Parrot_set_i_i__I5_I2",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1272 */
+    /* type PARROT_INLINE_OP, */
+    "set",
+    "set_i_i__I5_I3",
+    "Parrot_set_i_i__I5_I3",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1273 */
+    /* type PARROT_INLINE_OP, */
+    "set",
+    "set_i_i__I5_I4",
+    "Parrot_set_i_i__I5_I4",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1274 */
+    /* type PARROT_INLINE_OP, */
+    "set",
+    "set_i_i__I5_I5",
+    "Parrot_set_i_i__I5_I5",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1275 */
+    /* type PARROT_INLINE_OP, */
+    "set",
+    "set_i_i__I5_I6",
+    "Parrot_set_i_i__I5_I6",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1276 */
+    /* type PARROT_INLINE_OP, */
+    "set",
+    "set_i_i__I5_I7",
+    "Parrot_set_i_i__I5_I7",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1277 */
+    /* type PARROT_INLINE_OP, */
+    "set",
+    "set_i_i__I6_I0",
+    "Parrot_set_i_i__I6_I0",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1278 */
+    /* type PARROT_INLINE_OP, */
+    "set",
+    "set_i_i__I6_I1",
+    "Parrot_set_i_i__I6_I1",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1279 */
+    /* type PARROT_INLINE_OP, */
+    "set",
+    "set_i_i__I6_I2",
+    "Parrot_set_i_i__I6_I2",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1280 */
+    /* type PARROT_INLINE_OP, */
+    "set",
+    "set_i_i__I6_I3",
+    "Parrot_set_i_i__I6_I3",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1281 */
+    /* type PARROT_INLINE_OP, */
+    "set",
+    "set_i_i__I6_I4",
+    "Parrot_set_i_i__I6_I4",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1282 */
+    /* type PARROT_INLINE_OP, */
+    "set",
+    "set_i_i__I6_I5",
+    "Parrot_set_i_i__I6_I5",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1283 */
+    /* type PARROT_INLINE_OP, */
+    "set",
+    "set_i_i__I6_I6",
+    "Parrot_set_i_i__I6_I6",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1284 */
+    /* type PARROT_INLINE_OP, */
+    "set",
+    "set_i_i__I6_I7",
+    "Parrot_set_i_i__I6_I7",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1285 */
+    /* type PARROT_INLINE_OP, */
+    "set",
+    "set_i_i__I7_I0",
+    "Parrot_set_i_i__I7_I0",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1286 */
+    /* type PARROT_INLINE_OP, */
+    "set",
+    "set_i_i__I7_I1",
+    "Parrot_set_i_i__I7_I1",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1287 */
+    /* type PARROT_INLINE_OP, */
+    "set",
+    "set_i_i__I7_I2",
+    "Parrot_set_i_i__I7_I2",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1288 */
+    /* type PARROT_INLINE_OP, */
+    "set",
+    "set_i_i__I7_I3",
+    "Parrot_set_i_i__I7_I3",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1289 */
+    /* type PARROT_INLINE_OP, */
+    "set",
+    "set_i_i__I7_I4",
+    "Parrot_set_i_i__I7_I4",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1290 */
+    /* type PARROT_INLINE_OP, */
+    "set",
+    "set_i_i__I7_I5",
+    "Parrot_set_i_i__I7_I5",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1291 */
+    /* type PARROT_INLINE_OP, */
+    "set",
+    "set_i_i__I7_I6",
+    "Parrot_set_i_i__I7_I6",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1292 */
+    /* type PARROT_INLINE_OP, */
+    "set",
+    "set_i_i__I7_I7",
+    "Parrot_set_i_i__I7_I7",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1293 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_n_n__N0_N0",
+    "Parrot_add_n_n__N0_N0",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1294 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_n_n__N0_N1",
+    "Parrot_add_n_n__N0_N1",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1295 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_n_n__N0_N2",
+    "Parrot_add_n_n__N0_N2",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1296 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_n_n__N0_N3",
+    "Parrot_add_n_n__N0_N3",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1297 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_n_n__N0_N4",
+    "Parrot_add_n_n__N0_N4",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1298 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_n_n__N0_N5",
+    "Parrot_add_n_n__N0_N5",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1299 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_n_n__N0_N6",
+    "Parrot_add_n_n__N0_N6",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1300 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_n_n__N0_N7",
+    "Parrot_add_n_n__N0_N7",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1301 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_n_n__N1_N0",
+    "Parrot_add_n_n__N1_N0",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1302 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_n_n__N1_N1",
+    "Parrot_add_n_n__N1_N1",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1303 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_n_n__N1_N2",
+    "Parrot_add_n_n__N1_N2",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1304 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_n_n__N1_N3",
+    "Parrot_add_n_n__N1_N3",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1305 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_n_n__N1_N4",
+    "Parrot_add_n_n__N1_N4",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1306 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_n_n__N1_N5",
+    "Parrot_add_n_n__N1_N5",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1307 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_n_n__N1_N6",
+    "Parrot_add_n_n__N1_N6",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1308 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_n_n__N1_N7",
+    "Parrot_add_n_n__N1_N7",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1309 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_n_n__N2_N0",
+    "Parrot_add_n_n__N2_N0",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1310 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_n_n__N2_N1",
+    "Parrot_add_n_n__N2_N1",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1311 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_n_n__N2_N2",
+    "Parrot_add_n_n__N2_N2",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1312 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_n_n__N2_N3",
+    "Parrot_add_n_n__N2_N3",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1313 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_n_n__N2_N4",
+    "Parrot_add_n_n__N2_N4",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1314 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_n_n__N2_N5",
+    "Parrot_add_n_n__N2_N5",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1315 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_n_n__N2_N6",
+    "Parrot_add_n_n__N2_N6",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1316 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_n_n__N2_N7",
+    "Parrot_add_n_n__N2_N7",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1317 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_n_n__N3_N0",
+    "Parrot_add_n_n__N3_N0",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1318 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_n_n__N3_N1",
+    "Parrot_add_n_n__N3_N1",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1319 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_n_n__N3_N2",
+    "Parrot_add_n_n__N3_N2",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1320 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_n_n__N3_N3",
+    "Parrot_add_n_n__N3_N3",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1321 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_n_n__N3_N4",
+    "Parrot_add_n_n__N3_N4",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1322 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_n_n__N3_N5",
+    "Parrot_add_n_n__N3_N5",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1323 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_n_n__N3_N6",
+    "Parrot_add_n_n__N3_N6",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1324 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_n_n__N3_N7",
+    "Parrot_add_n_n__N3_N7",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1325 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_n_n__N4_N0",
+    "Parrot_add_n_n__N4_N0",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1326 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_n_n__N4_N1",
+    "Parrot_add_n_n__N4_N1",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1327 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_n_n__N4_N2",
+    "Parrot_add_n_n__N4_N2",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1328 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_n_n__N4_N3",
+    "Parrot_add_n_n__N4_N3",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1329 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_n_n__N4_N4",
+    "Parrot_add_n_n__N4_N4",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1330 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_n_n__N4_N5",
+    "Parrot_add_n_n__N4_N5",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1331 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_n_n__N4_N6",
+    "Parrot_add_n_n__N4_N6",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1332 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_n_n__N4_N7",
+    "Parrot_add_n_n__N4_N7",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1333 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_n_n__N5_N0",
+    "Parrot_add_n_n__N5_N0",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1334 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_n_n__N5_N1",
+    "Parrot_add_n_n__N5_N1",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1335 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_n_n__N5_N2",
+    "Parrot_add_n_n__N5_N2",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1336 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_n_n__N5_N3",
+    "Parrot_add_n_n__N5_N3",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1337 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_n_n__N5_N4",
+    "Parrot_add_n_n__N5_N4",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1338 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_n_n__N5_N5",
+    "Parrot_add_n_n__N5_N5",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1339 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_n_n__N5_N6",
+    "Parrot_add_n_n__N5_N6",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1340 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_n_n__N5_N7",
+    "Parrot_add_n_n__N5_N7",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1341 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_n_n__N6_N0",
+    "Parrot_add_n_n__N6_N0",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1342 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_n_n__N6_N1",
+    "Parrot_add_n_n__N6_N1",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1343 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_n_n__N6_N2",
+    "Parrot_add_n_n__N6_N2",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1344 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_n_n__N6_N3",
+    "Parrot_add_n_n__N6_N3",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1345 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_n_n__N6_N4",
+    "Parrot_add_n_n__N6_N4",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1346 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_n_n__N6_N5",
+    "Parrot_add_n_n__N6_N5",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1347 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_n_n__N6_N6",
+    "Parrot_add_n_n__N6_N6",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1348 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_n_n__N6_N7",
+    "Parrot_add_n_n__N6_N7",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1349 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_n_n__N7_N0",
+    "Parrot_add_n_n__N7_N0",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1350 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_n_n__N7_N1",
+    "Parrot_add_n_n__N7_N1",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1351 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_n_n__N7_N2",
+    "Parrot_add_n_n__N7_N2",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1352 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_n_n__N7_N3",
+    "Parrot_add_n_n__N7_N3",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1353 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_n_n__N7_N4",
+    "Parrot_add_n_n__N7_N4",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1354 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_n_n__N7_N5",
+    "Parrot_add_n_n__N7_N5",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1355 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_n_n__N7_N6",
+    "Parrot_add_n_n__N7_N6",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1356 */
+    /* type PARROT_INLINE_OP, */
+    "add",
+    "add_n_n__N7_N7",
+    "Parrot_add_n_n__N7_N7",
+    /* "",  body */
+    0,
+    3,
+    { PARROT_ARG_N, PARROT_ARG_N },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+
+};
+
+
+/*
+** Op Function Definitions:
+*/
+
+opcode_t *
+Parrot_end(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);return (opcode_t *)0;
+}
+
+opcode_t *
+Parrot_noop(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+
+return (opcode_t *)cur_opcode + 1;}
+
+opcode_t *
+Parrot_check_events(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    opcode_t * const next = cur_opcode + 1;
+    Parrot_cx_check_tasks(interp, interp->scheduler);return (opcode_t *)next;   /* force this being a branch op */
+}
+
+opcode_t *
+Parrot_check_events__(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    opcode_t * const _this = CUR_OPCODE;
+    /* Restore op_func_table. */
+    disable_event_checking(interp);
+    Parrot_cx_handle_tasks(interp, interp->scheduler);return (opcode_t *)_this;   /* force this being a branch op */
+}
+
+opcode_t *
+Parrot_wrapper__(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    opcode_t *pc = CUR_OPCODE;
+    DO_OP(pc, interp);return (opcode_t *)pc;
+}
+
+opcode_t *
+Parrot_load_bytecode_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    Parrot_load_bytecode(interp, SREG(1));
+
+return (opcode_t *)cur_opcode + 2;}
+
+opcode_t *
+Parrot_load_bytecode_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    Parrot_load_bytecode(interp, SCONST(1));
+
+return (opcode_t *)cur_opcode + 2;}
+
+opcode_t *
+Parrot_load_language_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    Parrot_load_language(interp, SREG(1));
+
+return (opcode_t *)cur_opcode + 2;}
+
+opcode_t *
+Parrot_load_language_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    Parrot_load_language(interp, SCONST(1));
+
+return (opcode_t *)cur_opcode + 2;}
+
+opcode_t *
+Parrot_branch_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);return (opcode_t *)cur_opcode + IREG(1);
+}
+
+opcode_t *
+Parrot_branch_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);return (opcode_t *)cur_opcode + ICONST(1);
+}
+
+opcode_t *
+Parrot_local_branch_p_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    INTVAL return_addr;
+    opcode_t * const dest = cur_opcode + 3;
+
+    if (PMC_IS_NULL(PREG(1)) || PREG(1)->vtable->base_type != enum_class_ResizableIntegerArray) {
+        opcode_t * const handler = Parrot_ex_throw_from_op_args(interp, dest,
+            EXCEPTION_INVALID_OPERATION,
+            "Must pass a valid integer array to 'local_branch'");return (opcode_t *)handler;
+    }
+
+    return_addr = PTR2INTVAL(dest);
+    VTABLE_push_integer(interp, PREG(1), return_addr);return (opcode_t *)cur_opcode + IREG(2);
+}
+
+opcode_t *
+Parrot_local_branch_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    INTVAL return_addr;
+    opcode_t * const dest = cur_opcode + 3;
+
+    if (PMC_IS_NULL(PREG(1)) || PREG(1)->vtable->base_type != enum_class_ResizableIntegerArray) {
+        opcode_t * const handler = Parrot_ex_throw_from_op_args(interp, dest,
+            EXCEPTION_INVALID_OPERATION,
+            "Must pass a valid integer array to 'local_branch'");return (opcode_t *)handler;
+    }
+
+    return_addr = PTR2INTVAL(dest);
+    VTABLE_push_integer(interp, PREG(1), return_addr);return (opcode_t *)cur_opcode + ICONST(2);
+}
+
+opcode_t *
+Parrot_local_return_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    INTVAL return_addr;
+    opcode_t *next;
+    opcode_t * const dest = cur_opcode + 2;
+
+    if (PMC_IS_NULL(PREG(1)) || PREG(1)->vtable->base_type != enum_class_ResizableIntegerArray) {
+        opcode_t * const handler = Parrot_ex_throw_from_op_args(interp, dest,
+            EXCEPTION_INVALID_OPERATION,
+            "Must pass a valid integer array to 'local_return'");return (opcode_t *)handler;
+    }
+
+    return_addr = VTABLE_pop_integer(interp, PREG(1));
+    next = INTVAL2PTR(opcode_t *, return_addr);
+
+    /* The return address must be within the current code segment. */
+    if (! (next >= interp->code->base.data
+           && next < (interp->code->base.data + interp->code->base.size))) {
+        opcode_t * const handler = Parrot_ex_throw_from_op_args(interp, dest,
+            EXCEPTION_INVALID_OPERATION,
+            "Address for 'local_return' must be within the current code segment");return (opcode_t *)handler;
+    }return (opcode_t *)next;
+}
+
+opcode_t *
+Parrot_jump_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    opcode_t * const loc = INTVAL2PTR(opcode_t *, IREG(1));return (opcode_t *)loc;
+}
+
+opcode_t *
+Parrot_jump_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    opcode_t * const loc = INTVAL2PTR(opcode_t *, ICONST(1));return (opcode_t *)loc;
+}
+
+opcode_t *
+Parrot_enternative(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    opcode_t * const addr = run_native(interp, CUR_OPCODE,
+            interp->code->base.data);return (opcode_t *)addr;
+}
+
+opcode_t *
+Parrot_if_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (IREG(1) != 0)return (opcode_t *)cur_opcode + ICONST(2);
+
+return (opcode_t *)cur_opcode + 3;}
+
+opcode_t *
+Parrot_if_n_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (!FLOAT_IS_ZERO(NREG(1)))return (opcode_t *)cur_opcode + ICONST(2);
+
+return (opcode_t *)cur_opcode + 3;}
+
+opcode_t *
+Parrot_if_s_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (Parrot_str_boolean(interp, SREG(1)))return (opcode_t *)cur_opcode + ICONST(2);
+
+return (opcode_t *)cur_opcode + 3;}
+
+opcode_t *
+Parrot_if_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (VTABLE_get_bool(interp, PREG(1)))return (opcode_t *)cur_opcode + ICONST(2);
+
+return (opcode_t *)cur_opcode + 3;}
+
+opcode_t *
+Parrot_unless_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (IREG(1) == 0)return (opcode_t *)cur_opcode + ICONST(2);
+
+return (opcode_t *)cur_opcode + 3;}
+
+opcode_t *
+Parrot_unless_n_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (FLOAT_IS_ZERO(NREG(1)))return (opcode_t *)cur_opcode + ICONST(2);
+
+return (opcode_t *)cur_opcode + 3;}
+
+opcode_t *
+Parrot_unless_s_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (!Parrot_str_boolean(interp, SREG(1)))return (opcode_t *)cur_opcode + ICONST(2);
+
+return (opcode_t *)cur_opcode + 3;}
+
+opcode_t *
+Parrot_unless_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (!VTABLE_get_bool(interp, PREG(1)))return (opcode_t *)cur_opcode + ICONST(2);
+
+return (opcode_t *)cur_opcode + 3;}
+
+opcode_t *
+Parrot_invokecc_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC      * const p     = PREG(1);
+    opcode_t *dest         = cur_opcode + 2;
+    PMC      * const signature = Parrot_pcc_get_signature(interp,
+                                    CURRENT_CONTEXT(interp));
+
+    Parrot_pcc_set_pc_func(interp, CURRENT_CONTEXT(interp), dest);
+
+    if (!PMC_IS_NULL(signature))
+        Parrot_pcc_set_object(interp, signature, NULL);
+    interp->current_cont   = NEED_CONTINUATION;
+    Parrot_pcc_prepare_args(interp, CURRENT_CONTEXT(interp), p);
+    dest                   = VTABLE_invoke(interp, p, dest);return (opcode_t *)dest;
+}
+
+opcode_t *
+Parrot_invoke_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    opcode_t   *dest       = cur_opcode + 3;
+    PMC * const p          = PREG(1);
+    PMC * const signature  = Parrot_pcc_get_signature(interp,
+                                    CURRENT_CONTEXT(interp));
+
+    Parrot_pcc_set_pc_func(interp, CURRENT_CONTEXT(interp), dest);
+
+    if (!PMC_IS_NULL(signature))
+        Parrot_pcc_set_object(interp, signature, NULL);
+    interp->current_cont   = PREG(2);
+
+    Parrot_pcc_prepare_args(interp, CURRENT_CONTEXT(interp), p);
+    dest = VTABLE_invoke(interp, p, dest);return (opcode_t *)dest;
+}
+
+opcode_t *
+Parrot_yield(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    opcode_t   *dest = cur_opcode + 1;
+    PMC * const p    = Parrot_pcc_get_sub(interp, CURRENT_CONTEXT(interp));
+
+    VTABLE_increment(interp, p);
+    dest = VTABLE_invoke(interp, p, dest);return (opcode_t *)dest;
+}
+
+opcode_t *
+Parrot_tailcall_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const p               = PREG(1);
+    opcode_t   *dest            = cur_opcode + 2;
+    PMC * const ctx             = CURRENT_CONTEXT(interp);
+    PMC * const parent_ctx      = Parrot_pcc_get_caller_ctx(interp, ctx);
+    PMC * const this_call_sig   = Parrot_pcc_get_signature(interp, ctx);
+    PMC * const parent_call_sig = Parrot_pcc_get_signature(interp, parent_ctx);
+    interp->current_cont        = Parrot_pcc_get_continuation(interp, ctx);
+
+    Parrot_pcc_merge_signature_for_tailcall(interp, parent_call_sig, this_call_sig);
+
+    SUB_FLAG_TAILCALL_SET(interp->current_cont);
+    Parrot_pcc_prepare_args(interp, ctx, p);
+    dest = VTABLE_invoke(interp, p, dest);return (opcode_t *)dest;
+}
+
+opcode_t *
+Parrot_returncc(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    opcode_t * const dest = Parrot_pcc_return_to_caller(interp, cur_opcode + 1);return (opcode_t *)dest;
+}
+
+opcode_t *
+Parrot_capture_lex_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    Parrot_sub_capture_lex(interp, PREG(1));
+
+return (opcode_t *)cur_opcode + 2;}
+
+opcode_t *
+Parrot_newclosure_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = Parrot_sub_new_closure(interp, PREG(2));
+
+return (opcode_t *)cur_opcode + 3;}
+
+opcode_t *
+Parrot_set_args_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    opcode_t * const raw_args = CUR_OPCODE;
+    PMC * const signature = PCONST(1);
+    PMC * const call_sig = Parrot_pcc_build_call_from_op(interp,
+            signature, raw_args);
+    const INTVAL argc = VTABLE_elements(interp, signature);
+    Parrot_pcc_set_signature(interp, CURRENT_CONTEXT(interp), call_sig);return (opcode_t *)cur_opcode + argc + 2;
+}
+
+opcode_t *
+Parrot_get_params_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    opcode_t * const raw_params  = CUR_OPCODE;
+    PMC      * const signature   = PCONST(1);
+    PMC      * const ctx         = CURRENT_CONTEXT(interp);
+    PMC      * const ccont       = Parrot_pcc_peek_continuation(interp, ctx);
+    PMC      * const caller_ctx  = Parrot_pcc_get_caller_ctx(interp, ctx);
+    PMC      * const call_object = Parrot_pcc_get_signature(interp, caller_ctx);
+    INTVAL argc;
+
+    Parrot_pcc_fill_params_from_op(interp, call_object, signature, raw_params,
+            PARROT_ERRORS_PARAM_COUNT_FLAG);
+
+    /* TODO Factor out with Sub.invoke */
+    if (ccont && PObj_get_FLAGS(ccont) & SUB_FLAG_TAILCALL) {
+        PObj_get_FLAGS(ccont) &= ~SUB_FLAG_TAILCALL;
+        Parrot_pcc_dec_recursion_depth(interp, ctx);
+        Parrot_pcc_set_caller_ctx(interp, ctx, Parrot_pcc_get_caller_ctx(interp, caller_ctx));
+    }
+    argc = VTABLE_elements(interp, signature);return (opcode_t *)cur_opcode + argc + 2;
+}
+
+opcode_t *
+Parrot_set_returns_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    opcode_t * const raw_args  = CUR_OPCODE;
+    PMC      * const signature = PCONST(1);
+    PMC      * const call_sig  = Parrot_pcc_build_sig_object_from_op(interp,
+                Parrot_pcc_get_signature(interp,
+                Parrot_pcc_get_caller_ctx(interp, CURRENT_CONTEXT(interp))),
+                    signature, raw_args);
+    INTVAL argc;
+
+    Parrot_pcc_set_signature(interp, CURRENT_CONTEXT(interp), call_sig);
+
+    argc = VTABLE_elements(interp, signature);return (opcode_t *)cur_opcode + argc + 2;
+}
+
+opcode_t *
+Parrot_get_results_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    opcode_t * const raw_params  = CUR_OPCODE;
+    PMC      * const signature   = PCONST(1);
+    PMC             *ctx         = CURRENT_CONTEXT(interp);
+    PMC             *call_object = Parrot_pcc_get_signature(interp, ctx);
+
+    INTVAL argc;
+
+    Parrot_pcc_fill_params_from_op(interp, call_object, signature, raw_params,
+            PARROT_ERRORS_RESULT_COUNT_FLAG);
+
+    argc = VTABLE_elements(interp, signature);
+    Parrot_pcc_set_signature(interp, CURRENT_CONTEXT(interp), PMCNULL);return (opcode_t *)cur_opcode + argc + 2;
+}
+
+opcode_t *
+Parrot_set_result_info_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const ctx = CURRENT_CONTEXT(interp);
+
+    VTABLE_set_attr_str(interp, ctx,
+            Parrot_str_new_constant(interp, "return_flags"),
+            PREG(1));
+
+return (opcode_t *)cur_opcode + 2;}
+
+opcode_t *
+Parrot_set_result_info_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const ctx = CURRENT_CONTEXT(interp);
+
+    VTABLE_set_attr_str(interp, ctx,
+            Parrot_str_new_constant(interp, "return_flags"),
+            PCONST(1));
+
+return (opcode_t *)cur_opcode + 2;}
+
+opcode_t *
+Parrot_result_info_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const caller_ctx = Parrot_pcc_get_caller_ctx(interp, CURRENT_CONTEXT(interp));
+    PMC * const sig        = VTABLE_get_attr_str(interp, caller_ctx,
+            Parrot_str_new_constant(interp, "return_flags"));
+
+    /* If no elements, hand back empty array; otherwise PMC. */
+    if (!sig)
+        PREG(1) = Parrot_pmc_new(interp, enum_class_FixedIntegerArray);
+    else
+        PREG(1) = sig;
+
+return (opcode_t *)cur_opcode + 2;}
+
+opcode_t *
+Parrot_set_addr_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = PTR2INTVAL(CUR_OPCODE + ICONST(2));
+
+return (opcode_t *)cur_opcode + 3;}
+
+opcode_t *
+Parrot_set_addr_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_set_pointer(interp, PREG(1), (CUR_OPCODE + ICONST(2)));
+
+return (opcode_t *)cur_opcode + 3;}
+
+opcode_t *
+Parrot_set_addr_p_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_set_pointer(interp, PREG(1), (void*)IREG(2));
+
+return (opcode_t *)cur_opcode + 3;}
+
+opcode_t *
+Parrot_get_addr_i_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    void *ptr = VTABLE_get_pointer(interp, PREG(2));
+    IREG(1)        = (INTVAL)ptr;
+
+return (opcode_t *)cur_opcode + 3;}
+
+opcode_t *
+Parrot_schedule_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    Parrot_cx_schedule_task(interp, PREG(1));
+
+return (opcode_t *)cur_opcode + 2;}
+
+opcode_t *
+Parrot_addhandler_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    Parrot_cx_add_handler(interp, PREG(1));
+
+return (opcode_t *)cur_opcode + 2;}
+
+opcode_t *
+Parrot_push_eh_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const eh = Parrot_pmc_new(interp, enum_class_ExceptionHandler);
+    VTABLE_set_pointer(interp, eh, CUR_OPCODE + ICONST(1));
+    Parrot_cx_add_handler_local(interp, eh);
+
+return (opcode_t *)cur_opcode + 2;}
+
+opcode_t *
+Parrot_push_eh_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    Parrot_cx_add_handler_local(interp, PREG(1));
+
+return (opcode_t *)cur_opcode + 2;}
+
+opcode_t *
+Parrot_pop_eh(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    Parrot_cx_delete_handler_local(interp,
+            Parrot_str_new_constant(interp, "exception"));
+
+return (opcode_t *)cur_opcode + 1;}
+
+opcode_t *
+Parrot_throw_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * except = PREG(1);
+    opcode_t *dest;
+    opcode_t * const ret    = cur_opcode + 2;
+    PMC      * const resume = pmc_new(interp, enum_class_Continuation);
+
+    VTABLE_set_pointer(interp, resume, ret);
+
+    if (PMC_IS_NULL(except) || except->vtable->base_type != enum_class_Exception)
+        except = Parrot_ex_build_exception(interp, EXCEPT_fatal,
+                EXCEPTION_UNIMPLEMENTED,
+                Parrot_str_new_constant(interp, "Not a throwable object"));
+
+    VTABLE_set_attr_str(interp, except, Parrot_str_new_constant(interp, "resume"), resume);
+    dest = Parrot_ex_throw_from_op(interp, except, ret);return (opcode_t *)dest;
+}
+
+opcode_t *
+Parrot_throw_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    opcode_t * dest;
+    PMC * except = PREG(1);
+    if (PMC_IS_NULL(except) || except->vtable->base_type != enum_class_Exception)
+        except = Parrot_ex_build_exception(interp, EXCEPT_fatal,
+                EXCEPTION_UNIMPLEMENTED,
+                Parrot_str_new_constant(interp, "Not a throwable object"));
+    dest = Parrot_ex_throw_from_op(interp, PREG(1),
+                                VTABLE_get_pointer(interp, PREG(2)));return (opcode_t *)dest;
+}
+
+opcode_t *
+Parrot_rethrow_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    opcode_t * dest;
+    if (PMC_IS_NULL(PREG(1)) || PREG(1)->vtable->base_type != enum_class_Exception) {
+        opcode_t * const ret    = cur_opcode + 2;
+        PMC      * const except = Parrot_ex_build_exception(interp, EXCEPT_fatal,
+                EXCEPTION_UNIMPLEMENTED,
+                Parrot_str_new_constant(interp, "Not a throwable object"));
+        dest = Parrot_ex_throw_from_op(interp, except, ret);return (opcode_t *)dest;
+    }
+    dest = Parrot_ex_rethrow_from_op(interp, PREG(1));return (opcode_t *)dest;
+}
+
+opcode_t *
+Parrot_count_eh_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = Parrot_cx_count_handlers_local(interp,
+            Parrot_str_new_constant(interp, "exception"));
+
+return (opcode_t *)cur_opcode + 2;}
+
+opcode_t *
+Parrot_die_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    opcode_t        *dest;
+    opcode_t * const ret       = cur_opcode + 2;
+    PMC      * const resume    = pmc_new(interp, enum_class_Continuation);
+    PMC      * const exception = Parrot_ex_build_exception(interp, EXCEPT_error,
+                                    CONTROL_ERROR, SREG(1));
+
+    VTABLE_set_pointer(interp, resume, ret);
+
+    VTABLE_set_attr_str(interp, exception,
+                        Parrot_str_new_constant(interp, "resume"), resume);
+    dest = Parrot_ex_throw_from_op(interp, exception, ret);return (opcode_t *)dest;
+}
+
+opcode_t *
+Parrot_die_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    opcode_t        *dest;
+    opcode_t * const ret       = cur_opcode + 2;
+    PMC      * const resume    = pmc_new(interp, enum_class_Continuation);
+    PMC      * const exception = Parrot_ex_build_exception(interp, EXCEPT_error,
+                                    CONTROL_ERROR, SCONST(1));
+
+    VTABLE_set_pointer(interp, resume, ret);
+
+    VTABLE_set_attr_str(interp, exception,
+                        Parrot_str_new_constant(interp, "resume"), resume);
+    dest = Parrot_ex_throw_from_op(interp, exception, ret);return (opcode_t *)dest;
+}
+
+opcode_t *
+Parrot_die_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    opcode_t        *dest;
+    opcode_t * const ret       = cur_opcode + 2;
+    PMC      * const resume    = pmc_new(interp, enum_class_Continuation);
+    STRING   * const msg       = PMC_IS_NULL(PREG(1)) ? NULL : VTABLE_get_string(interp, PREG(1));
+    PMC      * const exception =
+        Parrot_ex_build_exception(interp, EXCEPT_error, CONTROL_ERROR, msg);
+
+    VTABLE_set_pointer(interp, resume, ret);
+
+    VTABLE_set_attr_str(interp, exception,
+                        Parrot_str_new_constant(interp, "resume"), resume);
+    dest = Parrot_ex_throw_from_op(interp, exception, ret);return (opcode_t *)dest;
+}
+
+opcode_t *
+Parrot_die_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    opcode_t        *dest;
+    opcode_t * const ret       = cur_opcode + 2;
+    PMC      * const resume    = pmc_new(interp, enum_class_Continuation);
+    STRING   * const msg       = PMC_IS_NULL(PCONST(1)) ? NULL : VTABLE_get_string(interp, PCONST(1));
+    PMC      * const exception =
+        Parrot_ex_build_exception(interp, EXCEPT_error, CONTROL_ERROR, msg);
+
+    VTABLE_set_pointer(interp, resume, ret);
+
+    VTABLE_set_attr_str(interp, exception,
+                        Parrot_str_new_constant(interp, "resume"), resume);
+    dest = Parrot_ex_throw_from_op(interp, exception, ret);return (opcode_t *)dest;
+}
+
+opcode_t *
+Parrot_die_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (IREG(1) == EXCEPT_doomed)
+        _exit(IREG(2));
+    else {
+        opcode_t * const ret       = cur_opcode + 3;
+        PMC      * const exception = Parrot_ex_build_exception(interp, IREG(1), IREG(2), NULL);
+        opcode_t * const dest      = Parrot_ex_throw_from_op(interp, exception, ret);return (opcode_t *)dest;
+    }
+}
+
+opcode_t *
+Parrot_die_ic_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (ICONST(1) == EXCEPT_doomed)
+        _exit(IREG(2));
+    else {
+        opcode_t * const ret       = cur_opcode + 3;
+        PMC      * const exception = Parrot_ex_build_exception(interp, ICONST(1), IREG(2), NULL);
+        opcode_t * const dest      = Parrot_ex_throw_from_op(interp, exception, ret);return (opcode_t *)dest;
+    }
+}
+
+opcode_t *
+Parrot_die_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (IREG(1) == EXCEPT_doomed)
+        _exit(ICONST(2));
+    else {
+        opcode_t * const ret       = cur_opcode + 3;
+        PMC      * const exception = Parrot_ex_build_exception(interp, IREG(1), ICONST(2), NULL);
+        opcode_t * const dest      = Parrot_ex_throw_from_op(interp, exception, ret);return (opcode_t *)dest;
+    }
+}
+
+opcode_t *
+Parrot_die_ic_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (ICONST(1) == EXCEPT_doomed)
+        _exit(ICONST(2));
+    else {
+        opcode_t * const ret       = cur_opcode + 3;
+        PMC      * const exception = Parrot_ex_build_exception(interp, ICONST(1), ICONST(2), NULL);
+        opcode_t * const dest      = Parrot_ex_throw_from_op(interp, exception, ret);return (opcode_t *)dest;
+    }
+}
+
+opcode_t *
+Parrot_exit_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    opcode_t        *dest;
+    opcode_t * const ret       = cur_opcode + 2;
+    PMC      * const resume    = pmc_new(interp, enum_class_Continuation);
+    PMC      * const exception = Parrot_ex_build_exception(interp, EXCEPT_exit,
+                                                           CONTROL_EXIT, NULL);
+
+    VTABLE_set_pointer(interp, resume, ret);
+
+    VTABLE_set_attr_str(interp, exception,
+                        Parrot_str_new_constant(interp, "resume"), resume);
+    VTABLE_set_integer_keyed_str(interp, exception,
+        Parrot_str_new_constant(interp, "exit_code"), IREG(1));
+    dest = Parrot_ex_throw_from_op(interp, exception, ret);return (opcode_t *)dest;
+}
+
+opcode_t *
+Parrot_exit_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    opcode_t        *dest;
+    opcode_t * const ret       = cur_opcode + 2;
+    PMC      * const resume    = pmc_new(interp, enum_class_Continuation);
+    PMC      * const exception = Parrot_ex_build_exception(interp, EXCEPT_exit,
+                                                           CONTROL_EXIT, NULL);
+
+    VTABLE_set_pointer(interp, resume, ret);
+
+    VTABLE_set_attr_str(interp, exception,
+                        Parrot_str_new_constant(interp, "resume"), resume);
+    VTABLE_set_integer_keyed_str(interp, exception,
+        Parrot_str_new_constant(interp, "exit_code"), ICONST(1));
+    dest = Parrot_ex_throw_from_op(interp, exception, ret);return (opcode_t *)dest;
+}
+
+opcode_t *
+Parrot_debug_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (IREG(1) != 0) { Interp_debug_SET(interp,   IREG(1)); }
+    else         { Interp_debug_CLEAR(interp, PARROT_ALL_DEBUG_FLAGS); }interp->resume_offset = REL_PC + 2; interp->resume_flag = 1;return (opcode_t *)0;
+}
+
+opcode_t *
+Parrot_debug_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (ICONST(1) != 0) { Interp_debug_SET(interp,   ICONST(1)); }
+    else         { Interp_debug_CLEAR(interp, PARROT_ALL_DEBUG_FLAGS); }interp->resume_offset = REL_PC + 2; interp->resume_flag = 1;return (opcode_t *)0;
+}
+
+opcode_t *
+Parrot_bounds_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (IREG(1) != 0) { Parrot_set_flag(interp,   PARROT_BOUNDS_FLAG); }
+    else         { Interp_flags_CLEAR(interp, PARROT_BOUNDS_FLAG); }interp->resume_offset = REL_PC + 2; interp->resume_flag = 1;return (opcode_t *)0;
+}
+
+opcode_t *
+Parrot_bounds_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (ICONST(1) != 0) { Parrot_set_flag(interp,   PARROT_BOUNDS_FLAG); }
+    else         { Interp_flags_CLEAR(interp, PARROT_BOUNDS_FLAG); }interp->resume_offset = REL_PC + 2; interp->resume_flag = 1;return (opcode_t *)0;
+}
+
+opcode_t *
+Parrot_profile_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (IREG(1) != 0) { Parrot_set_flag(interp,   PARROT_PROFILE_FLAG); }
+    else         { Interp_flags_CLEAR(interp, PARROT_PROFILE_FLAG); }interp->resume_offset = REL_PC + 2; interp->resume_flag = 1;return (opcode_t *)0;
+}
+
+opcode_t *
+Parrot_profile_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (ICONST(1) != 0) { Parrot_set_flag(interp,   PARROT_PROFILE_FLAG); }
+    else         { Interp_flags_CLEAR(interp, PARROT_PROFILE_FLAG); }interp->resume_offset = REL_PC + 2; interp->resume_flag = 1;return (opcode_t *)0;
+}
+
+opcode_t *
+Parrot_trace_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (IREG(1) != 0) { Parrot_set_trace(interp,   IREG(1)); }
+    else         { Parrot_clear_trace(interp, PARROT_ALL_TRACE_FLAGS); }interp->resume_offset = REL_PC + 2; interp->resume_flag = 1;return (opcode_t *)0;
+}
+
+opcode_t *
+Parrot_trace_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (ICONST(1) != 0) { Parrot_set_trace(interp,   ICONST(1)); }
+    else         { Parrot_clear_trace(interp, PARROT_ALL_TRACE_FLAGS); }interp->resume_offset = REL_PC + 2; interp->resume_flag = 1;return (opcode_t *)0;
+}
+
+opcode_t *
+Parrot_gc_debug_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (IREG(1) != 0) { Interp_flags_SET(interp,   PARROT_GC_DEBUG_FLAG); }
+    else         { Interp_flags_CLEAR(interp, PARROT_GC_DEBUG_FLAG); }
+
+return (opcode_t *)cur_opcode + 2;}
+
+opcode_t *
+Parrot_gc_debug_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (ICONST(1) != 0) { Interp_flags_SET(interp,   PARROT_GC_DEBUG_FLAG); }
+    else         { Interp_flags_CLEAR(interp, PARROT_GC_DEBUG_FLAG); }
+
+return (opcode_t *)cur_opcode + 2;}
+
+opcode_t *
+Parrot_interpinfo_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = interpinfo(interp, IREG(2));
+
+return (opcode_t *)cur_opcode + 3;}
+
+opcode_t *
+Parrot_interpinfo_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = interpinfo(interp, ICONST(2));
+
+return (opcode_t *)cur_opcode + 3;}
+
+opcode_t *
+Parrot_interpinfo_p_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = interpinfo_p(interp, IREG(2));
+
+return (opcode_t *)cur_opcode + 3;}
+
+opcode_t *
+Parrot_interpinfo_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = interpinfo_p(interp, ICONST(2));
+
+return (opcode_t *)cur_opcode + 3;}
+
+opcode_t *
+Parrot_interpinfo_s_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    STRING * const s = interpinfo_s(interp, IREG(2));
+    SREG(1) = s;
+
+return (opcode_t *)cur_opcode + 3;}
+
+opcode_t *
+Parrot_interpinfo_s_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    STRING * const s = interpinfo_s(interp, ICONST(2));
+    SREG(1) = s;
+
+return (opcode_t *)cur_opcode + 3;}
+
+opcode_t *
+Parrot_warningson_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PARROT_WARNINGS_on(interp, IREG(1));
+
+return (opcode_t *)cur_opcode + 2;}
+
+opcode_t *
+Parrot_warningson_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PARROT_WARNINGS_on(interp, ICONST(1));
+
+return (opcode_t *)cur_opcode + 2;}
+
+opcode_t *
+Parrot_warningsoff_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PARROT_WARNINGS_off(interp, IREG(1));
+
+return (opcode_t *)cur_opcode + 2;}
+
+opcode_t *
+Parrot_warningsoff_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PARROT_WARNINGS_off(interp, ICONST(1));
+
+return (opcode_t *)cur_opcode + 2;}
+
+opcode_t *
+Parrot_errorson_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PARROT_ERRORS_on(interp, IREG(1));
+
+return (opcode_t *)cur_opcode + 2;}
+
+opcode_t *
+Parrot_errorson_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PARROT_ERRORS_on(interp, ICONST(1));
+
+return (opcode_t *)cur_opcode + 2;}
+
+opcode_t *
+Parrot_errorsoff_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PARROT_ERRORS_off(interp, IREG(1));
+
+return (opcode_t *)cur_opcode + 2;}
+
+opcode_t *
+Parrot_errorsoff_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PARROT_ERRORS_off(interp, ICONST(1));
+
+return (opcode_t *)cur_opcode + 2;}
+
+opcode_t *
+Parrot_runinterp_p_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    Interp * const new_interp = (Interp *)VTABLE_get_pointer(interp, PREG(1));
+    Interp_flags_SET(new_interp, PARROT_EXTERN_CODE_FLAG);
+    Parrot_switch_to_cs(new_interp, interp->code, 1);
+    runops(new_interp, REL_PC + IREG(2));
+
+return (opcode_t *)cur_opcode + 3;}
+
+opcode_t *
+Parrot_runinterp_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    Interp * const new_interp = (Interp *)VTABLE_get_pointer(interp, PREG(1));
+    Interp_flags_SET(new_interp, PARROT_EXTERN_CODE_FLAG);
+    Parrot_switch_to_cs(new_interp, interp->code, 1);
+    runops(new_interp, REL_PC + ICONST(2));
+
+return (opcode_t *)cur_opcode + 3;}
+
+opcode_t *
+Parrot_getinterp_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, interp->iglobals,
+           IGLOBALS_INTERPRETER);
+
+return (opcode_t *)cur_opcode + 2;}
+
+opcode_t *
+Parrot_sweep_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (ICONST(1))
+        Parrot_gc_mark_and_sweep(interp, GC_trace_normal_FLAG);
+    else
+        if (Parrot_gc_impatient_pmcs(interp))
+            Parrot_gc_mark_and_sweep(interp, GC_lazy_FLAG);
+
+return (opcode_t *)cur_opcode + 2;}
+
+opcode_t *
+Parrot_collect(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    Parrot_gc_compact_memory_pool(interp);
+
+return (opcode_t *)cur_opcode + 1;}
+
+opcode_t *
+Parrot_sweepoff(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    Parrot_block_GC_mark(interp);
+
+return (opcode_t *)cur_opcode + 1;}
+
+opcode_t *
+Parrot_sweepon(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    Parrot_unblock_GC_mark(interp);
+
+return (opcode_t *)cur_opcode + 1;}
+
+opcode_t *
+Parrot_collectoff(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    Parrot_block_GC_sweep(interp);
+
+return (opcode_t *)cur_opcode + 1;}
+
+opcode_t *
+Parrot_collecton(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    Parrot_unblock_GC_sweep(interp);
+
+return (opcode_t *)cur_opcode + 1;}
+
+opcode_t *
+Parrot_needs_destroy_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    Parrot_gc_pmc_needs_early_collection(interp, PREG(1));
+
+return (opcode_t *)cur_opcode + 2;}
+
+opcode_t *
+Parrot_loadlib_p_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = Parrot_dyn_load_lib(interp, SREG(2), NULL);
+
+return (opcode_t *)cur_opcode + 3;}
+
+opcode_t *
+Parrot_loadlib_p_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = Parrot_dyn_load_lib(interp, SCONST(2), NULL);
+
+return (opcode_t *)cur_opcode + 3;}
+
+opcode_t *
+Parrot_loadlib_p_s_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = Parrot_dyn_load_lib(interp, SREG(2), PREG(3));
+
+return (opcode_t *)cur_opcode + 4;}
+
+opcode_t *
+Parrot_loadlib_p_sc_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = Parrot_dyn_load_lib(interp, SCONST(2), PREG(3));
+
+return (opcode_t *)cur_opcode + 4;}
+
+opcode_t *
+Parrot_loadlib_p_s_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = Parrot_dyn_load_lib(interp, SREG(2), PCONST(3));
+
+return (opcode_t *)cur_opcode + 4;}
+
+opcode_t *
+Parrot_loadlib_p_sc_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = Parrot_dyn_load_lib(interp, SCONST(2), PCONST(3));
+
+return (opcode_t *)cur_opcode + 4;}
+
+opcode_t *
+Parrot_dlfunc_p_p_s_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    void         *dl_handle = NULL;
+    void         *ptr       = NULL;
+    funcptr_t     p;
+
+    if (!PMC_IS_NULL(PREG(2))
+    && PREG(2)->vtable->base_type == enum_class_ParrotLibrary
+    && VTABLE_defined(interp, PREG(2))) {
+        dl_handle = ((Parrot_ParrotLibrary_attributes*)PMC_data(PREG(2)))->dl_handle;
+    }
+
+    ptr = Parrot_dyn_dlsym_str(interp, dl_handle, SREG(3));
+    p = D2FPTR(ptr);
+
+    if (p == NULLfunc) {
+        const char * err = Parrot_dlerror();
+        Parrot_warn(interp, PARROT_WARNINGS_UNDEF_FLAG,
+                "Symbol '%Ss' not found: %s\n", SREG(3), err ? err : "unknown reason");
+        PREG(1) = Parrot_pmc_new(interp, enum_class_Undef);
+    }
+    else {
+        PREG(1) = Parrot_pmc_new(interp, enum_class_NCI);
+        VTABLE_set_pointer_keyed_str(interp, PREG(1), SREG(4), F2DPTR(p));
+    }
+
+return (opcode_t *)cur_opcode + 5;}
+
+opcode_t *
+Parrot_dlfunc_p_p_sc_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    void         *dl_handle = NULL;
+    void         *ptr       = NULL;
+    funcptr_t     p;
+
+    if (!PMC_IS_NULL(PREG(2))
+    && PREG(2)->vtable->base_type == enum_class_ParrotLibrary
+    && VTABLE_defined(interp, PREG(2))) {
+        dl_handle = ((Parrot_ParrotLibrary_attributes*)PMC_data(PREG(2)))->dl_handle;
+    }
+
+    ptr = Parrot_dyn_dlsym_str(interp, dl_handle, SCONST(3));
+    p = D2FPTR(ptr);
+
+    if (p == NULLfunc) {
+        const char * err = Parrot_dlerror();
+        Parrot_warn(interp, PARROT_WARNINGS_UNDEF_FLAG,
+                "Symbol '%Ss' not found: %s\n", SCONST(3), err ? err : "unknown reason");
+        PREG(1) = Parrot_pmc_new(interp, enum_class_Undef);
+    }
+    else {
+        PREG(1) = Parrot_pmc_new(interp, enum_class_NCI);
+        VTABLE_set_pointer_keyed_str(interp, PREG(1), SREG(4), F2DPTR(p));
+    }
+
+return (opcode_t *)cur_opcode + 5;}
+
+opcode_t *
+Parrot_dlfunc_p_p_s_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    void         *dl_handle = NULL;
+    void         *ptr       = NULL;
+    funcptr_t     p;
+
+    if (!PMC_IS_NULL(PREG(2))
+    && PREG(2)->vtable->base_type == enum_class_ParrotLibrary
+    && VTABLE_defined(interp, PREG(2))) {
+        dl_handle = ((Parrot_ParrotLibrary_attributes*)PMC_data(PREG(2)))->dl_handle;
+    }
+
+    ptr = Parrot_dyn_dlsym_str(interp, dl_handle, SREG(3));
+    p = D2FPTR(ptr);
+
+    if (p == NULLfunc) {
+        const char * err = Parrot_dlerror();
+        Parrot_warn(interp, PARROT_WARNINGS_UNDEF_FLAG,
+                "Symbol '%Ss' not found: %s\n", SREG(3), err ? err : "unknown reason");
+        PREG(1) = Parrot_pmc_new(interp, enum_class_Undef);
+    }
+    else {
+        PREG(1) = Parrot_pmc_new(interp, enum_class_NCI);
+        VTABLE_set_pointer_keyed_str(interp, PREG(1), SCONST(4), F2DPTR(p));
+    }
+
+return (opcode_t *)cur_opcode + 5;}
+
+opcode_t *
+Parrot_dlfunc_p_p_sc_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    void         *dl_handle = NULL;
+    void         *ptr       = NULL;
+    funcptr_t     p;
+
+    if (!PMC_IS_NULL(PREG(2))
+    && PREG(2)->vtable->base_type == enum_class_ParrotLibrary
+    && VTABLE_defined(interp, PREG(2))) {
+        dl_handle = ((Parrot_ParrotLibrary_attributes*)PMC_data(PREG(2)))->dl_handle;
+    }
+
+    ptr = Parrot_dyn_dlsym_str(interp, dl_handle, SCONST(3));
+    p = D2FPTR(ptr);
+
+    if (p == NULLfunc) {
+        const char * err = Parrot_dlerror();
+        Parrot_warn(interp, PARROT_WARNINGS_UNDEF_FLAG,
+                "Symbol '%Ss' not found: %s\n", SCONST(3), err ? err : "unknown reason");
+        PREG(1) = Parrot_pmc_new(interp, enum_class_Undef);
+    }
+    else {
+        PREG(1) = Parrot_pmc_new(interp, enum_class_NCI);
+        VTABLE_set_pointer_keyed_str(interp, PREG(1), SCONST(4), F2DPTR(p));
+    }
+
+return (opcode_t *)cur_opcode + 5;}
+
+opcode_t *
+Parrot_dlvar_p_p_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    void *        dl_handle = NULL;
+    void *        p         = NULL;
+
+    if (!PMC_IS_NULL(PREG(2))
+    && PREG(2)->vtable->base_type == enum_class_ParrotLibrary
+    && VTABLE_defined(interp, PREG(2))) {
+        dl_handle = ((Parrot_ParrotLibrary_attributes*)PMC_data(PREG(2)))->dl_handle;
+    }
+
+    p = Parrot_dyn_dlsym_str(interp, dl_handle, SREG(3));
+
+    if (p == NULL) {
+        const char * const err = Parrot_dlerror();
+        Parrot_warn(interp, PARROT_WARNINGS_UNDEF_FLAG,
+                "Symbol '%Ss' not found: %s\n", SREG(3), err ? err : "unknown reason");
+        PREG(1) = Parrot_pmc_new(interp, enum_class_Undef);
+    }
+    else {
+        /* At this point we have the symbol's address. We just need to build
+           a PMC with it so we can get and set the value */
+        PREG(1) = Parrot_pmc_new(interp, enum_class_UnManagedStruct);
+        VTABLE_set_pointer(interp, PREG(1), p);
+    }
+
+return (opcode_t *)cur_opcode + 4;}
+
+opcode_t *
+Parrot_dlvar_p_p_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    void *        dl_handle = NULL;
+    void *        p         = NULL;
+
+    if (!PMC_IS_NULL(PREG(2))
+    && PREG(2)->vtable->base_type == enum_class_ParrotLibrary
+    && VTABLE_defined(interp, PREG(2))) {
+        dl_handle = ((Parrot_ParrotLibrary_attributes*)PMC_data(PREG(2)))->dl_handle;
+    }
+
+    p = Parrot_dyn_dlsym_str(interp, dl_handle, SCONST(3));
+
+    if (p == NULL) {
+        const char * const err = Parrot_dlerror();
+        Parrot_warn(interp, PARROT_WARNINGS_UNDEF_FLAG,
+                "Symbol '%Ss' not found: %s\n", SCONST(3), err ? err : "unknown reason");
+        PREG(1) = Parrot_pmc_new(interp, enum_class_Undef);
+    }
+    else {
+        /* At this point we have the symbol's address. We just need to build
+           a PMC with it so we can get and set the value */
+        PREG(1) = Parrot_pmc_new(interp, enum_class_UnManagedStruct);
+        VTABLE_set_pointer(interp, PREG(1), p);
+    }
+
+return (opcode_t *)cur_opcode + 4;}
+
+opcode_t *
+Parrot_compreg_s_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const compreg_hash = VTABLE_get_pmc_keyed_int(interp,
+            interp->iglobals, IGLOBALS_COMPREG_HASH);
+    VTABLE_set_pmc_keyed_str(interp, compreg_hash, SREG(1), PREG(2));
+
+return (opcode_t *)cur_opcode + 3;}
+
+opcode_t *
+Parrot_compreg_sc_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const compreg_hash = VTABLE_get_pmc_keyed_int(interp,
+            interp->iglobals, IGLOBALS_COMPREG_HASH);
+    VTABLE_set_pmc_keyed_str(interp, compreg_hash, SCONST(1), PREG(2));
+
+return (opcode_t *)cur_opcode + 3;}
+
+opcode_t *
+Parrot_compreg_p_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const compreg_hash = VTABLE_get_pmc_keyed_int(interp,
+            interp->iglobals, IGLOBALS_COMPREG_HASH);
+    PREG(1) = VTABLE_get_pmc_keyed_str(interp, compreg_hash, SREG(2));
+
+return (opcode_t *)cur_opcode + 3;}
+
+opcode_t *
+Parrot_compreg_p_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const compreg_hash = VTABLE_get_pmc_keyed_int(interp,
+            interp->iglobals, IGLOBALS_COMPREG_HASH);
+    PREG(1) = VTABLE_get_pmc_keyed_str(interp, compreg_hash, SCONST(2));
+
+return (opcode_t *)cur_opcode + 3;}
+
+opcode_t *
+Parrot_new_callback_p_p_p_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = Parrot_make_cb(interp, PREG(2), PREG(3), SREG(4));
+
+return (opcode_t *)cur_opcode + 5;}
+
+opcode_t *
+Parrot_new_callback_p_p_p_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = Parrot_make_cb(interp, PREG(2), PREG(3), SCONST(4));
+
+return (opcode_t *)cur_opcode + 5;}
+
+opcode_t *
+Parrot_annotations_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (interp->code->annotations) {
+        const opcode_t cur_pos = ( cur_opcode + 2) - interp->code->base.data;
+        PREG(1) = PackFile_Annotations_lookup(interp, interp->code->annotations,
+                cur_pos, NULL);
+    }
+    else {
+        PREG(1) = Parrot_pmc_new(interp, enum_class_Hash);
+    }
+
+return (opcode_t *)cur_opcode + 2;}
+
+opcode_t *
+Parrot_annotations_p_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (interp->code->annotations) {
+        const opcode_t cur_pos = ( cur_opcode + 3) - interp->code->base.data;
+        PREG(1) = PackFile_Annotations_lookup(interp, interp->code->annotations,
+                cur_pos, SREG(2));
+    }
+    else {
+        PREG(1) = PMCNULL;
+    }
+
+return (opcode_t *)cur_opcode + 3;}
+
+opcode_t *
+Parrot_annotations_p_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (interp->code->annotations) {
+        const opcode_t cur_pos = ( cur_opcode + 3) - interp->code->base.data;
+        PREG(1) = PackFile_Annotations_lookup(interp, interp->code->annotations,
+                cur_pos, SCONST(2));
+    }
+    else {
+        PREG(1) = PMCNULL;
+    }
+
+return (opcode_t *)cur_opcode + 3;}
+
+opcode_t *
+Parrot_band_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) &= IREG(2);
+
+return (opcode_t *)cur_opcode + 3;}
+
+opcode_t *
+Parrot_band_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) &= ICONST(2);
+
+return (opcode_t *)cur_opcode + 3;}
+
+opcode_t *
+Parrot_band_i_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = IREG(2) & IREG(3);
+
+return (opcode_t *)cur_opcode + 4;}
+
+opcode_t *
+Parrot_band_i_ic_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = ICONST(2) & IREG(3);
+
+return (opcode_t *)cur_opcode + 4;}
+
+opcode_t *
+Parrot_band_i_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = IREG(2) & ICONST(3);
+
+return (opcode_t *)cur_opcode + 4;}
+
+opcode_t *
+Parrot_bor_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) |= IREG(2);
+
+return (opcode_t *)cur_opcode + 3;}
+
+opcode_t *
+Parrot_bor_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) |= ICONST(2);
+
+return (opcode_t *)cur_opcode + 3;}
+
+opcode_t *
+Parrot_bor_i_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = IREG(2) | IREG(3);
+
+return (opcode_t *)cur_opcode + 4;}
+
+opcode_t *
+Parrot_bor_i_ic_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = ICONST(2) | IREG(3);
+
+return (opcode_t *)cur_opcode + 4;}
+
+opcode_t *
+Parrot_bor_i_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = IREG(2) | ICONST(3);
+
+return (opcode_t *)cur_opcode + 4;}
+
+opcode_t *
+Parrot_shl_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = bit_shift_left(IREG(1), IREG(2));
+
+return (opcode_t *)cur_opcode + 3;}
+
+opcode_t *
+Parrot_shl_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = bit_shift_left(IREG(1), ICONST(2));
+
+return (opcode_t *)cur_opcode + 3;}
+
+opcode_t *
+Parrot_shl_i_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = bit_shift_left(IREG(2), IREG(3));
+
+return (opcode_t *)cur_opcode + 4;}
+
+opcode_t *
+Parrot_shl_i_ic_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = bit_shift_left(ICONST(2), IREG(3));
+
+return (opcode_t *)cur_opcode + 4;}
+
+opcode_t *
+Parrot_shl_i_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = bit_shift_left(IREG(2), ICONST(3));
+
+return (opcode_t *)cur_opcode + 4;}
+
+opcode_t *
+Parrot_shr_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    const INTVAL signed_shift = -IREG(2);
+    IREG(1) = bit_shift_left(IREG(1), signed_shift);
+
+return (opcode_t *)cur_opcode + 3;}
+
+opcode_t *
+Parrot_shr_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    const INTVAL signed_shift = -ICONST(2);
+    IREG(1) = bit_shift_left(IREG(1), signed_shift);
+
+return (opcode_t *)cur_opcode + 3;}
+
+opcode_t *
+Parrot_shr_i_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    const INTVAL signed_shift = -IREG(3);
+    IREG(1) = bit_shift_left(IREG(2), signed_shift);
+
+return (opcode_t *)cur_opcode + 4;}
+
+opcode_t *
+Parrot_shr_i_ic_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    const INTVAL signed_shift = -IREG(3);
+    IREG(1) = bit_shift_left(ICONST(2), signed_shift);
+
+return (opcode_t *)cur_opcode + 4;}
+
+opcode_t *
+Parrot_shr_i_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    const INTVAL signed_shift = -ICONST(3);
+    IREG(1) = bit_shift_left(IREG(2), signed_shift);
+
+return (opcode_t *)cur_opcode + 4;}
+
+opcode_t *
+Parrot_lsr_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    const UINTVAL a = (UINTVAL)IREG(1);
+    const UINTVAL b = a >> IREG(2);
+    IREG(1) = (INTVAL)b;
+
+return (opcode_t *)cur_opcode + 3;}
+
+opcode_t *
+Parrot_lsr_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    const UINTVAL a = (UINTVAL)IREG(1);
+    const UINTVAL b = a >> ICONST(2);
+    IREG(1) = (INTVAL)b;
+
+return (opcode_t *)cur_opcode + 3;}
+
+opcode_t *
+Parrot_lsr_i_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = (INTVAL)((UINTVAL)IREG(2) >> IREG(3));
+
+return (opcode_t *)cur_opcode + 4;}
+
+opcode_t *
+Parrot_lsr_i_ic_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = (INTVAL)((UINTVAL)ICONST(2) >> IREG(3));
+
+return (opcode_t *)cur_opcode + 4;}
+
+opcode_t *
+Parrot_lsr_i_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = (INTVAL)((UINTVAL)IREG(2) >> ICONST(3));
+
+return (opcode_t *)cur_opcode + 4;}
+
+opcode_t *
+Parrot_bxor_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) ^= IREG(2);
+
+return (opcode_t *)cur_opcode + 3;}
+
+opcode_t *
+Parrot_bxor_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) ^= ICONST(2);
+
+return (opcode_t *)cur_opcode + 3;}
+
+opcode_t *
+Parrot_bxor_i_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = IREG(2) ^ IREG(3);
+
+return (opcode_t *)cur_opcode + 4;}
+
+opcode_t *
+Parrot_bxor_i_ic_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = ICONST(2) ^ IREG(3);
+
+return (opcode_t *)cur_opcode + 4;}
+
+opcode_t *
+Parrot_bxor_i_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = IREG(2) ^ ICONST(3);
+
+return (opcode_t *)cur_opcode + 4;}
+
+opcode_t *
+Parrot_eq_i_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (IREG(1) == IREG(2)) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
+
+return (opcode_t *)cur_opcode + 4;}
+
+opcode_t *
+Parrot_eq_ic_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (ICONST(1) == IREG(2)) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
+
+return (opcode_t *)cur_opcode + 4;}
+
+opcode_t *
+Parrot_eq_i_ic_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (IREG(1) == ICONST(2)) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
+
+return (opcode_t *)cur_opcode + 4;}
+
+opcode_t *
+Parrot_eq_n_n_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (NREG(1) == NREG(2)) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
+
+return (opcode_t *)cur_opcode + 4;}
+
+opcode_t *
+Parrot_eq_nc_n_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (NCONST(1) == NREG(2)) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
+
+return (opcode_t *)cur_opcode + 4;}
+
+opcode_t *
+Parrot_eq_n_nc_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (NREG(1) == NCONST(2)) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
+
+return (opcode_t *)cur_opcode + 4;}
+
+opcode_t *
+Parrot_eq_s_s_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (STRING_equal(interp, SREG(1), SREG(2))) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
+
+return (opcode_t *)cur_opcode + 4;}
+
+opcode_t *
+Parrot_eq_sc_s_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (STRING_equal(interp, SCONST(1), SREG(2))) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
+
+return (opcode_t *)cur_opcode + 4;}
+
+opcode_t *
+Parrot_eq_s_sc_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (STRING_equal(interp, SREG(1), SCONST(2))) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
+
+return (opcode_t *)cur_opcode + 4;}
+
+opcode_t *
+Parrot_eq_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (VTABLE_is_equal(interp, PREG(1), PREG(2))) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
+
+return (opcode_t *)cur_opcode + 4;}
+
+opcode_t *
+Parrot_eq_p_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const temp = Parrot_pmc_new_temporary(interp, enum_class_Integer);
+    VTABLE_set_integer_native(interp, temp, IREG(2));
+
+    if (VTABLE_is_equal(interp, PREG(1), temp)) {
+        Parrot_pmc_free_temporary(interp, temp);return (opcode_t *)cur_opcode + ICONST(3);
+    }
+
+    Parrot_pmc_free_temporary(interp, temp);
+
+return (opcode_t *)cur_opcode + 4;}
+
+opcode_t *
+Parrot_eq_p_ic_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const temp = Parrot_pmc_new_temporary(interp, enum_class_Integer);
+    VTABLE_set_integer_native(interp, temp, ICONST(2));
+
+    if (VTABLE_is_equal(interp, PREG(1), temp)) {
+        Parrot_pmc_free_temporary(interp, temp);return (opcode_t *)cur_opcode + ICONST(3);
+    }
+
+    Parrot_pmc_free_temporary(interp, temp);
+
+return (opcode_t *)cur_opcode + 4;}
+
+opcode_t *
+Parrot_eq_p_n_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    /*
+     * the get_number and get_string should probably
+     * be also replaced with code like above, as
+     * overriding the compare multi subs wouldn't
+     * have any effect with the current code
+     */
+    if (VTABLE_get_number(interp, PREG(1)) == NREG(2)) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
+
+return (opcode_t *)cur_opcode + 4;}
+
+opcode_t *
+Parrot_eq_p_nc_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    /*
+     * the get_number and get_string should probably
+     * be also replaced with code like above, as
+     * overriding the compare multi subs wouldn't
+     * have any effect with the current code
+     */
+    if (VTABLE_get_number(interp, PREG(1)) == NCONST(2)) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
+
+return (opcode_t *)cur_opcode + 4;}
+
+opcode_t *
+Parrot_eq_p_s_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (STRING_equal(interp, VTABLE_get_string(interp, PREG(1)), SREG(2))) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
+
+return (opcode_t *)cur_opcode + 4;}
+
+opcode_t *
+Parrot_eq_p_sc_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (STRING_equal(interp, VTABLE_get_string(interp, PREG(1)), SCONST(2))) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
+
+return (opcode_t *)cur_opcode + 4;}
+
+opcode_t *
+Parrot_eq_str_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (VTABLE_is_equal_string(interp, PREG(1), PREG(2))) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
+
+return (opcode_t *)cur_opcode + 4;}
+
+opcode_t *
+Parrot_eq_num_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (VTABLE_is_equal_num(interp, PREG(1), PREG(2))) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
+
+return (opcode_t *)cur_opcode + 4;}
+
+opcode_t *
+Parrot_eq_addr_s_s_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (SREG(1) == SREG(2)) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
+
+return (opcode_t *)cur_opcode + 4;}
+
+opcode_t *
+Parrot_eq_addr_sc_s_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (SCONST(1) == SREG(2)) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
+
+return (opcode_t *)cur_opcode + 4;}
+
+opcode_t *
+Parrot_eq_addr_s_sc_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (SREG(1) == SCONST(2)) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
+
+return (opcode_t *)cur_opcode + 4;}
+
+opcode_t *
+Parrot_eq_addr_sc_sc_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (SCONST(1) == SCONST(2)) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
+
+return (opcode_t *)cur_opcode + 4;}
+
+opcode_t *
+Parrot_eq_addr_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (PREG(1) == PREG(2)) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
+
+return (opcode_t *)cur_opcode + 4;}
+
+opcode_t *
+Parrot_ne_i_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (IREG(1) != IREG(2)) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
+
+return (opcode_t *)cur_opcode + 4;}
+
+opcode_t *
+Parrot_ne_ic_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (ICONST(1) != IREG(2)) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
+
+return (opcode_t *)cur_opcode + 4;}
+
+opcode_t *
+Parrot_ne_i_ic_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (IREG(1) != ICONST(2)) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
+
+return (opcode_t *)cur_opcode + 4;}
+
+opcode_t *
+Parrot_ne_n_n_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (NREG(1) != NREG(2)) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
+
+return (opcode_t *)cur_opcode + 4;}
+
+opcode_t *
+Parrot_ne_nc_n_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (NCONST(1) != NREG(2)) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
+
+return (opcode_t *)cur_opcode + 4;}
+
+opcode_t *
+Parrot_ne_n_nc_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (NREG(1) != NCONST(2)) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
+
+return (opcode_t *)cur_opcode + 4;}
+
+opcode_t *
+Parrot_ne_s_s_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (!STRING_equal(interp, SREG(1), SREG(2))) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
+
+return (opcode_t *)cur_opcode + 4;}
+
+opcode_t *
+Parrot_ne_sc_s_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (!STRING_equal(interp, SCONST(1), SREG(2))) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
+
+return (opcode_t *)cur_opcode + 4;}
+
+opcode_t *
+Parrot_ne_s_sc_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (!STRING_equal(interp, SREG(1), SCONST(2))) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
+
+return (opcode_t *)cur_opcode + 4;}
+
+opcode_t *
+Parrot_ne_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (!VTABLE_is_equal(interp, PREG(1), PREG(2))) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
+
+return (opcode_t *)cur_opcode + 4;}
+
+opcode_t *
+Parrot_ne_p_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const temp = Parrot_pmc_new_temporary(interp, enum_class_Integer);
+    VTABLE_set_integer_native(interp, temp, IREG(2));
+
+    if (!VTABLE_is_equal(interp, PREG(1), temp)) {
+        Parrot_pmc_free_temporary(interp, temp);return (opcode_t *)cur_opcode + ICONST(3);
+    }
+
+    Parrot_pmc_free_temporary(interp, temp);
+
+return (opcode_t *)cur_opcode + 4;}
+
+opcode_t *
+Parrot_ne_p_ic_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const temp = Parrot_pmc_new_temporary(interp, enum_class_Integer);
+    VTABLE_set_integer_native(interp, temp, ICONST(2));
+
+    if (!VTABLE_is_equal(interp, PREG(1), temp)) {
+        Parrot_pmc_free_temporary(interp, temp);return (opcode_t *)cur_opcode + ICONST(3);
+    }
+
+    Parrot_pmc_free_temporary(interp, temp);
+
+return (opcode_t *)cur_opcode + 4;}
+
+opcode_t *
+Parrot_ne_p_n_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (VTABLE_get_number(interp, PREG(1)) != NREG(2)) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
+
+return (opcode_t *)cur_opcode + 4;}
+
+opcode_t *
+Parrot_ne_p_nc_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (VTABLE_get_number(interp, PREG(1)) != NCONST(2)) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
+
+return (opcode_t *)cur_opcode + 4;}
+
+opcode_t *
+Parrot_ne_p_s_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (!STRING_equal(interp, VTABLE_get_string(interp, PREG(1)), SREG(2))) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
+
+return (opcode_t *)cur_opcode + 4;}
+
+opcode_t *
+Parrot_ne_p_sc_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (!STRING_equal(interp, VTABLE_get_string(interp, PREG(1)), SCONST(2))) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
+
+return (opcode_t *)cur_opcode + 4;}
+
+opcode_t *
+Parrot_ne_str_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (VTABLE_cmp_string(interp, PREG(1), PREG(2)) != 0) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
+
+return (opcode_t *)cur_opcode + 4;}
+
+opcode_t *
+Parrot_ne_num_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (VTABLE_cmp_num(interp, PREG(1), PREG(2)) != 0) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
+
+return (opcode_t *)cur_opcode + 4;}
+
+opcode_t *
+Parrot_ne_addr_s_s_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (SREG(1) != SREG(2)) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
+
+return (opcode_t *)cur_opcode + 4;}
+
+opcode_t *
+Parrot_ne_addr_sc_s_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (SCONST(1) != SREG(2)) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
+
+return (opcode_t *)cur_opcode + 4;}
+
+opcode_t *
+Parrot_ne_addr_s_sc_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (SREG(1) != SCONST(2)) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
+
+return (opcode_t *)cur_opcode + 4;}
+
+opcode_t *
+Parrot_ne_addr_sc_sc_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (SCONST(1) != SCONST(2)) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
+
+return (opcode_t *)cur_opcode + 4;}
+
+opcode_t *
+Parrot_ne_addr_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (PREG(1) != PREG(2)) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
+
+return (opcode_t *)cur_opcode + 4;}
 
-};
+opcode_t *
+Parrot_lt_i_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (IREG(1) < IREG(2)) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
 
+return (opcode_t *)cur_opcode + 4;}
 
-/*
-** Op Function Definitions:
-*/
+opcode_t *
+Parrot_lt_ic_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (ICONST(1) < IREG(2)) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
+
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_end(opcode_t *cur_opcode, PARROT_INTERP)  {
-    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);return (opcode_t *)0;
-}
+Parrot_lt_i_ic_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (IREG(1) < ICONST(2)) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
+
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_noop(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_lt_n_n_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (NREG(1) < NREG(2)) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
 
-return (opcode_t *)cur_opcode + 1;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_check_events(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_lt_nc_n_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    opcode_t * const next = cur_opcode + 1;
-    Parrot_cx_check_tasks(interp, interp->scheduler);return (opcode_t *)next;   /* force this being a branch op */
-}
+    if (NCONST(1) < NREG(2)) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
+
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_check_events__(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_lt_n_nc_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    opcode_t * const _this = CUR_OPCODE;
-    /* Restore op_func_table. */
-    disable_event_checking(interp);
-    Parrot_cx_handle_tasks(interp, interp->scheduler);return (opcode_t *)_this;   /* force this being a branch op */
-}
+    if (NREG(1) < NCONST(2)) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
+
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_wrapper__(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_lt_s_s_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    opcode_t *pc = CUR_OPCODE;
-    DO_OP(pc, interp);return (opcode_t *)pc;
-}
+    if (STRING_compare(interp, SREG(1), SREG(2)) < 0) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
+
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_load_bytecode_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_lt_sc_s_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    Parrot_load_bytecode(interp, SREG(1));
+    if (STRING_compare(interp, SCONST(1), SREG(2)) < 0) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
 
-return (opcode_t *)cur_opcode + 2;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_load_bytecode_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_lt_s_sc_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    Parrot_load_bytecode(interp, SCONST(1));
+    if (STRING_compare(interp, SREG(1), SCONST(2)) < 0) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
 
-return (opcode_t *)cur_opcode + 2;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_load_language_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_lt_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    Parrot_load_language(interp, SREG(1));
+    if (VTABLE_cmp(interp, PREG(1), PREG(2)) < 0) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
 
-return (opcode_t *)cur_opcode + 2;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_load_language_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_lt_p_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    Parrot_load_language(interp, SCONST(1));
+    PMC * const temp = Parrot_pmc_new_temporary(interp, enum_class_Integer);
+    VTABLE_set_integer_native(interp, temp, IREG(2));
 
-return (opcode_t *)cur_opcode + 2;}
+    if (VTABLE_cmp(interp, PREG(1), temp) < 0) {
+        Parrot_pmc_free_temporary(interp, temp);return (opcode_t *)cur_opcode + ICONST(3);
+    }
+
+    Parrot_pmc_free_temporary(interp, temp);
+
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_branch_i(opcode_t *cur_opcode, PARROT_INTERP)  {
-    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);return (opcode_t *)cur_opcode + IREG(1);
-}
+Parrot_lt_p_ic_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const temp = Parrot_pmc_new_temporary(interp, enum_class_Integer);
+    VTABLE_set_integer_native(interp, temp, ICONST(2));
+
+    if (VTABLE_cmp(interp, PREG(1), temp) < 0) {
+        Parrot_pmc_free_temporary(interp, temp);return (opcode_t *)cur_opcode + ICONST(3);
+    }
+
+    Parrot_pmc_free_temporary(interp, temp);
+
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_branch_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
-    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);return (opcode_t *)cur_opcode + ICONST(1);
-}
+Parrot_lt_p_n_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (VTABLE_get_number(interp, PREG(1)) < NREG(2)) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
+
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_local_branch_p_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_lt_p_nc_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    INTVAL return_addr;
-    opcode_t * const dest = cur_opcode + 3;
+    if (VTABLE_get_number(interp, PREG(1)) < NCONST(2)) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
 
-    if (PMC_IS_NULL(PREG(1)) || PREG(1)->vtable->base_type != enum_class_ResizableIntegerArray) {
-        opcode_t * const handler = Parrot_ex_throw_from_op_args(interp, dest,
-            EXCEPTION_INVALID_OPERATION,
-            "Must pass a valid integer array to 'local_branch'");return (opcode_t *)handler;
+return (opcode_t *)cur_opcode + 4;}
+
+opcode_t *
+Parrot_lt_p_s_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (STRING_compare(interp, VTABLE_get_string(interp, PREG(1)), SREG(2)) < 0) {return (opcode_t *)cur_opcode + ICONST(3);
     }
 
-    return_addr = PTR2INTVAL(dest);
-    VTABLE_push_integer(interp, PREG(1), return_addr);return (opcode_t *)cur_opcode + IREG(2);
-}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_local_branch_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_lt_p_sc_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    INTVAL return_addr;
-    opcode_t * const dest = cur_opcode + 3;
+    if (STRING_compare(interp, VTABLE_get_string(interp, PREG(1)), SCONST(2)) < 0) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
 
-    if (PMC_IS_NULL(PREG(1)) || PREG(1)->vtable->base_type != enum_class_ResizableIntegerArray) {
-        opcode_t * const handler = Parrot_ex_throw_from_op_args(interp, dest,
-            EXCEPTION_INVALID_OPERATION,
-            "Must pass a valid integer array to 'local_branch'");return (opcode_t *)handler;
+return (opcode_t *)cur_opcode + 4;}
+
+opcode_t *
+Parrot_lt_str_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (VTABLE_cmp_string(interp, PREG(1), PREG(2)) < 0) {return (opcode_t *)cur_opcode + ICONST(3);
     }
 
-    return_addr = PTR2INTVAL(dest);
-    VTABLE_push_integer(interp, PREG(1), return_addr);return (opcode_t *)cur_opcode + ICONST(2);
-}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_local_return_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_lt_num_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    INTVAL return_addr;
-    opcode_t *next;
-    opcode_t * const dest = cur_opcode + 2;
+    if (VTABLE_cmp_num(interp, PREG(1), PREG(2)) < 0) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
 
-    if (PMC_IS_NULL(PREG(1)) || PREG(1)->vtable->base_type != enum_class_ResizableIntegerArray) {
-        opcode_t * const handler = Parrot_ex_throw_from_op_args(interp, dest,
-            EXCEPTION_INVALID_OPERATION,
-            "Must pass a valid integer array to 'local_return'");return (opcode_t *)handler;
+return (opcode_t *)cur_opcode + 4;}
+
+opcode_t *
+Parrot_le_i_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (IREG(1) <= IREG(2)) {return (opcode_t *)cur_opcode + ICONST(3);
     }
 
-    return_addr = VTABLE_pop_integer(interp, PREG(1));
-    next = INTVAL2PTR(opcode_t *, return_addr);
+return (opcode_t *)cur_opcode + 4;}
 
-    /* The return address must be within the current code segment. */
-    if (! (next >= interp->code->base.data
-           && next < (interp->code->base.data + interp->code->base.size))) {
-        opcode_t * const handler = Parrot_ex_throw_from_op_args(interp, dest,
-            EXCEPTION_INVALID_OPERATION,
-            "Address for 'local_return' must be within the current code segment");return (opcode_t *)handler;
-    }return (opcode_t *)next;
-}
+opcode_t *
+Parrot_le_ic_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (ICONST(1) <= IREG(2)) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
+
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_jump_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_le_i_ic_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    opcode_t * const loc = INTVAL2PTR(opcode_t *, IREG(1));return (opcode_t *)loc;
-}
+    if (IREG(1) <= ICONST(2)) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
+
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_jump_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_le_n_n_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    opcode_t * const loc = INTVAL2PTR(opcode_t *, ICONST(1));return (opcode_t *)loc;
-}
+    if (NREG(1) <= NREG(2)) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
+
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_enternative(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_le_nc_n_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    opcode_t * const addr = run_native(interp, CUR_OPCODE,
-            interp->code->base.data);return (opcode_t *)addr;
-}
+    if (NCONST(1) <= NREG(2)) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
+
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_if_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_le_n_nc_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (IREG(1) != 0)return (opcode_t *)cur_opcode + ICONST(2);
+    if (NREG(1) <= NCONST(2)) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
+
+return (opcode_t *)cur_opcode + 4;}
+
+opcode_t *
+Parrot_le_s_s_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (STRING_compare(interp, SREG(1), SREG(2)) <= 0) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
+
+return (opcode_t *)cur_opcode + 4;}
+
+opcode_t *
+Parrot_le_sc_s_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (STRING_compare(interp, SCONST(1), SREG(2)) <= 0) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
+
+return (opcode_t *)cur_opcode + 4;}
+
+opcode_t *
+Parrot_le_s_sc_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (STRING_compare(interp, SREG(1), SCONST(2)) <= 0) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
+
+return (opcode_t *)cur_opcode + 4;}
+
+opcode_t *
+Parrot_le_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (VTABLE_cmp(interp, PREG(1), PREG(2)) <= 0) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_if_n_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_le_p_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (!FLOAT_IS_ZERO(NREG(1)))return (opcode_t *)cur_opcode + ICONST(2);
+    PMC * const temp = Parrot_pmc_new_temporary(interp, enum_class_Integer);
+    VTABLE_set_integer_native(interp, temp, IREG(2));
 
-return (opcode_t *)cur_opcode + 3;}
+    if (VTABLE_cmp(interp, PREG(1), temp) <= 0) {
+        Parrot_pmc_free_temporary(interp, temp);return (opcode_t *)cur_opcode + ICONST(3);
+    }
 
-opcode_t *
-Parrot_if_s_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
-    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (Parrot_str_boolean(interp, SREG(1)))return (opcode_t *)cur_opcode + ICONST(2);
+    Parrot_pmc_free_temporary(interp, temp);
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_if_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_le_p_ic_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (VTABLE_get_bool(interp, PREG(1)))return (opcode_t *)cur_opcode + ICONST(2);
+    PMC * const temp = Parrot_pmc_new_temporary(interp, enum_class_Integer);
+    VTABLE_set_integer_native(interp, temp, ICONST(2));
 
-return (opcode_t *)cur_opcode + 3;}
+    if (VTABLE_cmp(interp, PREG(1), temp) <= 0) {
+        Parrot_pmc_free_temporary(interp, temp);return (opcode_t *)cur_opcode + ICONST(3);
+    }
 
-opcode_t *
-Parrot_unless_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
-    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (IREG(1) == 0)return (opcode_t *)cur_opcode + ICONST(2);
+    Parrot_pmc_free_temporary(interp, temp);
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_unless_n_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_le_p_n_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (FLOAT_IS_ZERO(NREG(1)))return (opcode_t *)cur_opcode + ICONST(2);
+    if (VTABLE_get_number(interp, PREG(1)) <= NREG(2)) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_unless_s_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_le_p_nc_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (!Parrot_str_boolean(interp, SREG(1)))return (opcode_t *)cur_opcode + ICONST(2);
+    if (VTABLE_get_number(interp, PREG(1)) <= NCONST(2)) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_unless_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_le_p_s_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (!VTABLE_get_bool(interp, PREG(1)))return (opcode_t *)cur_opcode + ICONST(2);
+    if (STRING_compare(interp, VTABLE_get_string(interp, PREG(1)), SREG(2)) <= 0) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_invokecc_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_le_p_sc_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC      * const p     = PREG(1);
-    opcode_t *dest         = cur_opcode + 2;
-    PMC      * const signature = Parrot_pcc_get_signature(interp,
-                                    CURRENT_CONTEXT(interp));
-
-    Parrot_pcc_set_pc_func(interp, CURRENT_CONTEXT(interp), dest);
+    if (STRING_compare(interp, VTABLE_get_string(interp, PREG(1)), SCONST(2)) <= 0) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
 
-    if (!PMC_IS_NULL(signature))
-        Parrot_pcc_set_object(interp, signature, NULL);
-    interp->current_cont   = NEED_CONTINUATION;
-    dest                   = VTABLE_invoke(interp, p, dest);return (opcode_t *)dest;
-}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_invoke_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_le_str_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    opcode_t   *dest       = cur_opcode + 3;
-    PMC * const p          = PREG(1);
-    PMC * const signature  = Parrot_pcc_get_signature(interp,
-                                    CURRENT_CONTEXT(interp));
+    if (VTABLE_cmp_string(interp, PREG(1), PREG(2)) <= 0) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
 
-    Parrot_pcc_set_pc_func(interp, CURRENT_CONTEXT(interp), dest);
+return (opcode_t *)cur_opcode + 4;}
 
-    if (!PMC_IS_NULL(signature))
-        Parrot_pcc_set_object(interp, signature, NULL);
-    interp->current_cont   = PREG(2);
+opcode_t *
+Parrot_le_num_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (VTABLE_cmp_num(interp, PREG(1), PREG(2)) <= 0) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
 
-    dest = VTABLE_invoke(interp, p, dest);return (opcode_t *)dest;
-}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_yield(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_gt_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    opcode_t   *dest = cur_opcode + 1;
-    PMC * const p    = Parrot_pcc_get_sub(interp, CURRENT_CONTEXT(interp));
+    if (VTABLE_cmp(interp, PREG(1), PREG(2)) > 0) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
 
-    VTABLE_increment(interp, p);
-    dest = VTABLE_invoke(interp, p, dest);return (opcode_t *)dest;
-}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_tailcall_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_gt_p_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const p               = PREG(1);
-    opcode_t   *dest            = cur_opcode + 2;
-    PMC * const ctx             = CURRENT_CONTEXT(interp);
-    PMC * const parent_ctx      = Parrot_pcc_get_caller_ctx(interp, ctx);
-    PMC * const this_call_sig   = Parrot_pcc_get_signature(interp, ctx);
-    PMC * const parent_call_sig = Parrot_pcc_get_signature(interp, parent_ctx);
-    interp->current_cont        = Parrot_pcc_get_continuation(interp, ctx);
+    PMC * const temp = Parrot_pmc_new_temporary(interp, enum_class_Integer);
+    VTABLE_set_integer_native(interp, temp, IREG(2));
 
-    Parrot_pcc_merge_signature_for_tailcall(interp, parent_call_sig, this_call_sig);
+    if (VTABLE_cmp(interp, PREG(1), temp) > 0) {
+        Parrot_pmc_free_temporary(interp, temp);return (opcode_t *)cur_opcode + ICONST(3);
+    }
 
-    SUB_FLAG_TAILCALL_SET(interp->current_cont);
-    dest = VTABLE_invoke(interp, p, dest);return (opcode_t *)dest;
-}
+    Parrot_pmc_free_temporary(interp, temp);
 
-opcode_t *
-Parrot_returncc(opcode_t *cur_opcode, PARROT_INTERP)  {
-    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const p = Parrot_pcc_get_continuation(interp, CURRENT_CONTEXT(interp));
-    opcode_t * const dest = VTABLE_invoke(interp, p, cur_opcode + 1);return (opcode_t *)dest;
-}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_capture_lex_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_gt_p_ic_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    Parrot_sub_capture_lex(interp, PREG(1));
+    PMC * const temp = Parrot_pmc_new_temporary(interp, enum_class_Integer);
+    VTABLE_set_integer_native(interp, temp, ICONST(2));
 
-return (opcode_t *)cur_opcode + 2;}
+    if (VTABLE_cmp(interp, PREG(1), temp) > 0) {
+        Parrot_pmc_free_temporary(interp, temp);return (opcode_t *)cur_opcode + ICONST(3);
+    }
 
-opcode_t *
-Parrot_newclosure_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
-    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = Parrot_sub_new_closure(interp, PREG(2));
+    Parrot_pmc_free_temporary(interp, temp);
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_set_args_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_gt_p_n_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    opcode_t * const raw_args = CUR_OPCODE;
-    PMC * const signature = PCONST(1);
-    PMC * const call_sig = Parrot_pcc_build_sig_object_from_op(interp,
-            PMCNULL, signature, raw_args);
-    const INTVAL argc = VTABLE_elements(interp, signature);
-    Parrot_pcc_set_signature(interp, CURRENT_CONTEXT(interp), call_sig);return (opcode_t *)cur_opcode + argc + 2;
-}
+    if (VTABLE_get_number(interp, PREG(1)) > NREG(2)) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
+
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_get_params_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_gt_p_nc_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    opcode_t * const raw_params  = CUR_OPCODE;
-    PMC      * const signature   = PCONST(1);
-    PMC      * const ctx         = CURRENT_CONTEXT(interp);
-    PMC      * const ccont       = Parrot_pcc_get_continuation(interp, ctx);
-    PMC      * const caller_ctx  = Parrot_pcc_get_caller_ctx(interp, ctx);
-    PMC      * const call_object = Parrot_pcc_get_signature(interp, caller_ctx);
-    INTVAL argc;
-
-    Parrot_pcc_fill_params_from_op(interp, call_object, signature, raw_params,
-            PARROT_ERRORS_PARAM_COUNT_FLAG);
-
-    /* TODO Factor out with Sub.invoke */
-    if (PObj_get_FLAGS(ccont) & SUB_FLAG_TAILCALL) {
-        PObj_get_FLAGS(ccont) &= ~SUB_FLAG_TAILCALL;
-        Parrot_pcc_dec_recursion_depth(interp, ctx);
-        Parrot_pcc_set_caller_ctx(interp, ctx, Parrot_pcc_get_caller_ctx(interp, caller_ctx));
+    if (VTABLE_get_number(interp, PREG(1)) > NCONST(2)) {return (opcode_t *)cur_opcode + ICONST(3);
     }
-    argc = VTABLE_elements(interp, signature);return (opcode_t *)cur_opcode + argc + 2;
-}
+
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_set_returns_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_gt_p_s_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    opcode_t * const raw_args  = CUR_OPCODE;
-    PMC      * const signature = PCONST(1);
-    PMC      * const call_sig  = Parrot_pcc_build_sig_object_from_op(interp,
-                Parrot_pcc_get_signature(interp,
-                Parrot_pcc_get_caller_ctx(interp, CURRENT_CONTEXT(interp))),
-                    signature, raw_args);
-    INTVAL argc;
-
-    Parrot_pcc_set_signature(interp, CURRENT_CONTEXT(interp), call_sig);
+    if (STRING_compare(interp, VTABLE_get_string(interp, PREG(1)), SREG(2)) > 0) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
 
-    argc = VTABLE_elements(interp, signature);return (opcode_t *)cur_opcode + argc + 2;
-}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_get_results_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_gt_p_sc_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    opcode_t * const raw_params  = CUR_OPCODE;
-    PMC      * const signature   = PCONST(1);
-    PMC             *ctx         = CURRENT_CONTEXT(interp);
-    PMC             *ccont       = Parrot_pcc_get_continuation(interp, ctx);
-    PMC             *call_object = Parrot_pcc_get_signature(interp, ctx);
-
-    INTVAL argc;
-
-    Parrot_pcc_fill_params_from_op(interp, call_object, signature, raw_params,
-            PARROT_ERRORS_RESULT_COUNT_FLAG);
+    if (STRING_compare(interp, VTABLE_get_string(interp, PREG(1)), SCONST(2)) > 0) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
 
-    argc = VTABLE_elements(interp, signature);
-    Parrot_pcc_set_signature(interp, CURRENT_CONTEXT(interp), PMCNULL);return (opcode_t *)cur_opcode + argc + 2;
-}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_set_result_info_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_gt_str_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const ctx = CURRENT_CONTEXT(interp);
-
-    VTABLE_set_attr_str(interp, ctx,
-            Parrot_str_new_constant(interp, "return_flags"),
-            PREG(1));
+    if (VTABLE_cmp_string(interp, PREG(1), PREG(2)) > 0) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
 
-return (opcode_t *)cur_opcode + 2;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_set_result_info_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_gt_num_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const ctx = CURRENT_CONTEXT(interp);
-
-    VTABLE_set_attr_str(interp, ctx,
-            Parrot_str_new_constant(interp, "return_flags"),
-            PCONST(1));
+    if (VTABLE_cmp_num(interp, PREG(1), PREG(2)) > 0) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
 
-return (opcode_t *)cur_opcode + 2;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_result_info_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_ge_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const caller_ctx = Parrot_pcc_get_caller_ctx(interp, CURRENT_CONTEXT(interp));
-    PMC * const sig        = VTABLE_get_attr_str(interp, caller_ctx,
-            Parrot_str_new_constant(interp, "return_flags"));
-
-    /* If no elements, hand back empty array; otherwise PMC. */
-    if (!sig)
-        PREG(1) = Parrot_pmc_new(interp, enum_class_FixedIntegerArray);
-    else
-        PREG(1) = sig;
+    if (VTABLE_cmp(interp, PREG(1), PREG(2)) >= 0) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
 
-return (opcode_t *)cur_opcode + 2;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_set_addr_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_ge_p_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = PTR2INTVAL(CUR_OPCODE + ICONST(2));
+    PMC * const temp = Parrot_pmc_new_temporary(interp, enum_class_Integer);
+    VTABLE_set_integer_native(interp, temp, IREG(2));
 
-return (opcode_t *)cur_opcode + 3;}
+    if (VTABLE_cmp(interp, PREG(1), temp) >= 0) {
+        Parrot_pmc_free_temporary(interp, temp);return (opcode_t *)cur_opcode + ICONST(3);
+    }
+
+    Parrot_pmc_free_temporary(interp, temp);
+
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_set_addr_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_ge_p_ic_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_set_pointer(interp, PREG(1), (CUR_OPCODE + ICONST(2)));
+    PMC * const temp = Parrot_pmc_new_temporary(interp, enum_class_Integer);
+    VTABLE_set_integer_native(interp, temp, ICONST(2));
 
-return (opcode_t *)cur_opcode + 3;}
+    if (VTABLE_cmp(interp, PREG(1), temp) >= 0) {
+        Parrot_pmc_free_temporary(interp, temp);return (opcode_t *)cur_opcode + ICONST(3);
+    }
 
-opcode_t *
-Parrot_set_addr_p_i(opcode_t *cur_opcode, PARROT_INTERP)  {
-    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_set_pointer(interp, PREG(1), (void*)IREG(2));
+    Parrot_pmc_free_temporary(interp, temp);
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_get_addr_i_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_ge_p_n_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    void *ptr = VTABLE_get_pointer(interp, PREG(2));
-    IREG(1)        = (INTVAL)ptr;
+    if (VTABLE_get_number(interp, PREG(1)) >= NREG(2)) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_schedule_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_ge_p_nc_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    Parrot_cx_schedule_task(interp, PREG(1));
+    if (VTABLE_get_number(interp, PREG(1)) >= NCONST(2)) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
 
-return (opcode_t *)cur_opcode + 2;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_addhandler_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_ge_p_s_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    Parrot_cx_add_handler(interp, PREG(1));
+    if (STRING_compare(interp, VTABLE_get_string(interp, PREG(1)), SREG(2)) >= 0) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
 
-return (opcode_t *)cur_opcode + 2;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_push_eh_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_ge_p_sc_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const eh = Parrot_pmc_new(interp, enum_class_ExceptionHandler);
-    VTABLE_set_pointer(interp, eh, CUR_OPCODE + ICONST(1));
-    Parrot_cx_add_handler_local(interp, eh);
+    if (STRING_compare(interp, VTABLE_get_string(interp, PREG(1)), SCONST(2)) >= 0) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
 
-return (opcode_t *)cur_opcode + 2;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_push_eh_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_ge_str_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    Parrot_cx_add_handler_local(interp, PREG(1));
+    if (VTABLE_cmp_string(interp, PREG(1), PREG(2)) >= 0) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
 
-return (opcode_t *)cur_opcode + 2;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_pop_eh(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_ge_num_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    Parrot_cx_delete_handler_local(interp,
-            Parrot_str_new_constant(interp, "exception"));
+    if (VTABLE_cmp_num(interp, PREG(1), PREG(2)) >= 0) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
 
-return (opcode_t *)cur_opcode + 1;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_throw_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_if_null_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * except = PREG(1);
-    opcode_t *dest;
-    opcode_t * const ret    = cur_opcode + 2;
-    PMC      * const resume = pmc_new(interp, enum_class_Continuation);
-
-    VTABLE_set_pointer(interp, resume, ret);
-
-    if (PMC_IS_NULL(except) || except->vtable->base_type != enum_class_Exception)
-        except = Parrot_ex_build_exception(interp, EXCEPT_fatal,
-                EXCEPTION_UNIMPLEMENTED,
-                Parrot_str_new_constant(interp, "Not a throwable object"));
+    if (PMC_IS_NULL(PREG(1))) {return (opcode_t *)cur_opcode + ICONST(2);
+    }
 
-    VTABLE_set_attr_str(interp, except, Parrot_str_new_constant(interp, "resume"), resume);
-    dest = Parrot_ex_throw_from_op(interp, except, ret);return (opcode_t *)dest;
-}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_throw_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_if_null_s_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    opcode_t * dest;
-    PMC * except = PREG(1);
-    if (PMC_IS_NULL(except) || except->vtable->base_type != enum_class_Exception)
-        except = Parrot_ex_build_exception(interp, EXCEPT_fatal,
-                EXCEPTION_UNIMPLEMENTED,
-                Parrot_str_new_constant(interp, "Not a throwable object"));
-    dest = Parrot_ex_throw_from_op(interp, PREG(1),
-                                VTABLE_get_pointer(interp, PREG(2)));return (opcode_t *)dest;
-}
+    if (STRING_IS_NULL(SREG(1))) {return (opcode_t *)cur_opcode + ICONST(2);
+    }
+
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_rethrow_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_unless_null_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    opcode_t * dest;
-    if (PMC_IS_NULL(PREG(1)) || PREG(1)->vtable->base_type != enum_class_Exception) {
-        opcode_t * const ret    = cur_opcode + 2;
-        PMC      * const except = Parrot_ex_build_exception(interp, EXCEPT_fatal,
-                EXCEPTION_UNIMPLEMENTED,
-                Parrot_str_new_constant(interp, "Not a throwable object"));
-        dest = Parrot_ex_throw_from_op(interp, except, ret);return (opcode_t *)dest;
+    if (!PMC_IS_NULL(PREG(1))) {return (opcode_t *)cur_opcode + ICONST(2);
     }
-    dest = Parrot_ex_rethrow_from_op(interp, PREG(1));return (opcode_t *)dest;
-}
+
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_count_eh_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_unless_null_s_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = Parrot_cx_count_handlers_local(interp,
-            Parrot_str_new_constant(interp, "exception"));
+    if (!STRING_IS_NULL(SREG(1))) {return (opcode_t *)cur_opcode + ICONST(2);
+    }
 
-return (opcode_t *)cur_opcode + 2;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_die_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_cmp_i_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    opcode_t        *dest;
-    opcode_t * const ret       = cur_opcode + 2;
-    PMC      * const resume    = pmc_new(interp, enum_class_Continuation);
-    PMC      * const exception = Parrot_ex_build_exception(interp, EXCEPT_error,
-                                    CONTROL_ERROR, SREG(1));
-
-    VTABLE_set_pointer(interp, resume, ret);
+    IREG(1) = IREG(2) < IREG(3) ? -1 :
+         IREG(2) > IREG(3) ? +1 :
+         0;
 
-    VTABLE_set_attr_str(interp, exception,
-                        Parrot_str_new_constant(interp, "resume"), resume);
-    dest = Parrot_ex_throw_from_op(interp, exception, ret);return (opcode_t *)dest;
-}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_die_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_cmp_i_ic_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    opcode_t        *dest;
-    opcode_t * const ret       = cur_opcode + 2;
-    PMC      * const resume    = pmc_new(interp, enum_class_Continuation);
-    PMC      * const exception = Parrot_ex_build_exception(interp, EXCEPT_error,
-                                    CONTROL_ERROR, SCONST(1));
-
-    VTABLE_set_pointer(interp, resume, ret);
+    IREG(1) = ICONST(2) < IREG(3) ? -1 :
+         ICONST(2) > IREG(3) ? +1 :
+         0;
 
-    VTABLE_set_attr_str(interp, exception,
-                        Parrot_str_new_constant(interp, "resume"), resume);
-    dest = Parrot_ex_throw_from_op(interp, exception, ret);return (opcode_t *)dest;
-}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_die_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_cmp_i_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    opcode_t        *dest;
-    opcode_t * const ret       = cur_opcode + 2;
-    PMC      * const resume    = pmc_new(interp, enum_class_Continuation);
-    STRING   * const msg       = PMC_IS_NULL(PREG(1)) ? NULL : VTABLE_get_string(interp, PREG(1));
-    PMC      * const exception =
-        Parrot_ex_build_exception(interp, EXCEPT_error, CONTROL_ERROR, msg);
-
-    VTABLE_set_pointer(interp, resume, ret);
+    IREG(1) = IREG(2) < ICONST(3) ? -1 :
+         IREG(2) > ICONST(3) ? +1 :
+         0;
 
-    VTABLE_set_attr_str(interp, exception,
-                        Parrot_str_new_constant(interp, "resume"), resume);
-    dest = Parrot_ex_throw_from_op(interp, exception, ret);return (opcode_t *)dest;
-}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_die_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_cmp_i_n_n(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    opcode_t        *dest;
-    opcode_t * const ret       = cur_opcode + 2;
-    PMC      * const resume    = pmc_new(interp, enum_class_Continuation);
-    STRING   * const msg       = PMC_IS_NULL(PCONST(1)) ? NULL : VTABLE_get_string(interp, PCONST(1));
-    PMC      * const exception =
-        Parrot_ex_build_exception(interp, EXCEPT_error, CONTROL_ERROR, msg);
-
-    VTABLE_set_pointer(interp, resume, ret);
+    IREG(1) = NREG(2) < NREG(3) ? -1 :
+         NREG(2) > NREG(3) ? +1 :
+         0;
 
-    VTABLE_set_attr_str(interp, exception,
-                        Parrot_str_new_constant(interp, "resume"), resume);
-    dest = Parrot_ex_throw_from_op(interp, exception, ret);return (opcode_t *)dest;
-}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_die_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_cmp_i_nc_n(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (IREG(1) == EXCEPT_doomed)
-        _exit(IREG(2));
-    else {
-        opcode_t * const ret       = cur_opcode + 3;
-        PMC      * const exception = Parrot_ex_build_exception(interp, IREG(1), IREG(2), NULL);
-        opcode_t * const dest      = Parrot_ex_throw_from_op(interp, exception, ret);return (opcode_t *)dest;
-    }
-}
+    IREG(1) = NCONST(2) < NREG(3) ? -1 :
+         NCONST(2) > NREG(3) ? +1 :
+         0;
 
-opcode_t *
-Parrot_die_ic_i(opcode_t *cur_opcode, PARROT_INTERP)  {
-    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (ICONST(1) == EXCEPT_doomed)
-        _exit(IREG(2));
-    else {
-        opcode_t * const ret       = cur_opcode + 3;
-        PMC      * const exception = Parrot_ex_build_exception(interp, ICONST(1), IREG(2), NULL);
-        opcode_t * const dest      = Parrot_ex_throw_from_op(interp, exception, ret);return (opcode_t *)dest;
-    }
-}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_die_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_cmp_i_n_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (IREG(1) == EXCEPT_doomed)
-        _exit(ICONST(2));
-    else {
-        opcode_t * const ret       = cur_opcode + 3;
-        PMC      * const exception = Parrot_ex_build_exception(interp, IREG(1), ICONST(2), NULL);
-        opcode_t * const dest      = Parrot_ex_throw_from_op(interp, exception, ret);return (opcode_t *)dest;
-    }
-}
+    IREG(1) = NREG(2) < NCONST(3) ? -1 :
+         NREG(2) > NCONST(3) ? +1 :
+         0;
 
-opcode_t *
-Parrot_die_ic_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
-    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (ICONST(1) == EXCEPT_doomed)
-        _exit(ICONST(2));
-    else {
-        opcode_t * const ret       = cur_opcode + 3;
-        PMC      * const exception = Parrot_ex_build_exception(interp, ICONST(1), ICONST(2), NULL);
-        opcode_t * const dest      = Parrot_ex_throw_from_op(interp, exception, ret);return (opcode_t *)dest;
-    }
-}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_exit_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_cmp_i_s_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    opcode_t        *dest;
-    opcode_t * const ret       = cur_opcode + 2;
-    PMC      * const resume    = pmc_new(interp, enum_class_Continuation);
-    PMC      * const exception = Parrot_ex_build_exception(interp, EXCEPT_exit,
-                                                           CONTROL_EXIT, NULL);
-
-    VTABLE_set_pointer(interp, resume, ret);
+    IREG(1) = STRING_compare(interp, SREG(2), SREG(3));
 
-    VTABLE_set_attr_str(interp, exception,
-                        Parrot_str_new_constant(interp, "resume"), resume);
-    VTABLE_set_integer_keyed_str(interp, exception,
-        Parrot_str_new_constant(interp, "exit_code"), IREG(1));
-    dest = Parrot_ex_throw_from_op(interp, exception, ret);return (opcode_t *)dest;
-}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_exit_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_cmp_i_sc_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    opcode_t        *dest;
-    opcode_t * const ret       = cur_opcode + 2;
-    PMC      * const resume    = pmc_new(interp, enum_class_Continuation);
-    PMC      * const exception = Parrot_ex_build_exception(interp, EXCEPT_exit,
-                                                           CONTROL_EXIT, NULL);
+    IREG(1) = STRING_compare(interp, SCONST(2), SREG(3));
 
-    VTABLE_set_pointer(interp, resume, ret);
+return (opcode_t *)cur_opcode + 4;}
 
-    VTABLE_set_attr_str(interp, exception,
-                        Parrot_str_new_constant(interp, "resume"), resume);
-    VTABLE_set_integer_keyed_str(interp, exception,
-        Parrot_str_new_constant(interp, "exit_code"), ICONST(1));
-    dest = Parrot_ex_throw_from_op(interp, exception, ret);return (opcode_t *)dest;
-}
+opcode_t *
+Parrot_cmp_i_s_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = STRING_compare(interp, SREG(2), SCONST(3));
+
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_debug_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_cmp_i_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (IREG(1) != 0) { Interp_debug_SET(interp,   IREG(1)); }
-    else         { Interp_debug_CLEAR(interp, PARROT_ALL_DEBUG_FLAGS); }interp->resume_offset = REL_PC + 2; interp->resume_flag = 1;return (opcode_t *)0;
-}
+    IREG(1) = VTABLE_cmp(interp, PREG(2), PREG(3));
+
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_debug_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_cmp_i_p_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (ICONST(1) != 0) { Interp_debug_SET(interp,   ICONST(1)); }
-    else         { Interp_debug_CLEAR(interp, PARROT_ALL_DEBUG_FLAGS); }interp->resume_offset = REL_PC + 2; interp->resume_flag = 1;return (opcode_t *)0;
-}
+    const INTVAL l = VTABLE_get_integer(interp, PREG(2));
+    IREG(1) = l < IREG(3) ? -1 :
+         l > IREG(3) ? +1 :
+         0;
+
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_bounds_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_cmp_i_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (IREG(1) != 0) { Parrot_set_flag(interp,   PARROT_BOUNDS_FLAG); }
-    else         { Interp_flags_CLEAR(interp, PARROT_BOUNDS_FLAG); }interp->resume_offset = REL_PC + 2; interp->resume_flag = 1;return (opcode_t *)0;
-}
+    const INTVAL l = VTABLE_get_integer(interp, PREG(2));
+    IREG(1) = l < ICONST(3) ? -1 :
+         l > ICONST(3) ? +1 :
+         0;
+
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_bounds_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_cmp_i_p_n(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (ICONST(1) != 0) { Parrot_set_flag(interp,   PARROT_BOUNDS_FLAG); }
-    else         { Interp_flags_CLEAR(interp, PARROT_BOUNDS_FLAG); }interp->resume_offset = REL_PC + 2; interp->resume_flag = 1;return (opcode_t *)0;
-}
+    const FLOATVAL l = VTABLE_get_number(interp, PREG(2));
+    IREG(1) = l < NREG(3) ? -1 :
+         l > NREG(3) ? +1 :
+         0;
+
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_profile_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_cmp_i_p_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (IREG(1) != 0) { Parrot_set_flag(interp,   PARROT_PROFILE_FLAG); }
-    else         { Interp_flags_CLEAR(interp, PARROT_PROFILE_FLAG); }interp->resume_offset = REL_PC + 2; interp->resume_flag = 1;return (opcode_t *)0;
-}
+    const FLOATVAL l = VTABLE_get_number(interp, PREG(2));
+    IREG(1) = l < NCONST(3) ? -1 :
+         l > NCONST(3) ? +1 :
+         0;
+
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_profile_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_cmp_i_p_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (ICONST(1) != 0) { Parrot_set_flag(interp,   PARROT_PROFILE_FLAG); }
-    else         { Interp_flags_CLEAR(interp, PARROT_PROFILE_FLAG); }interp->resume_offset = REL_PC + 2; interp->resume_flag = 1;return (opcode_t *)0;
-}
+    STRING* const l = VTABLE_get_string(interp, PREG(2));
+    IREG(1) = STRING_compare(interp, l, SREG(3));
+
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_trace_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_cmp_i_p_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (IREG(1) != 0) { Parrot_set_trace(interp,   IREG(1)); }
-    else         { Parrot_clear_trace(interp, PARROT_ALL_TRACE_FLAGS); }interp->resume_offset = REL_PC + 2; interp->resume_flag = 1;return (opcode_t *)0;
-}
+    STRING* const l = VTABLE_get_string(interp, PREG(2));
+    IREG(1) = STRING_compare(interp, l, SCONST(3));
+
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_trace_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_cmp_str_i_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (ICONST(1) != 0) { Parrot_set_trace(interp,   ICONST(1)); }
-    else         { Parrot_clear_trace(interp, PARROT_ALL_TRACE_FLAGS); }interp->resume_offset = REL_PC + 2; interp->resume_flag = 1;return (opcode_t *)0;
-}
+    IREG(1) = VTABLE_cmp_string(interp, PREG(2), PREG(3));
+
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_gc_debug_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_cmp_num_i_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (IREG(1) != 0) { Interp_flags_SET(interp,   PARROT_GC_DEBUG_FLAG); }
-    else         { Interp_flags_CLEAR(interp, PARROT_GC_DEBUG_FLAG); }
+    IREG(1) = VTABLE_cmp_num(interp, PREG(2), PREG(3));
 
-return (opcode_t *)cur_opcode + 2;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_gc_debug_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_cmp_pmc_p_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (ICONST(1) != 0) { Interp_flags_SET(interp,   PARROT_GC_DEBUG_FLAG); }
-    else         { Interp_flags_CLEAR(interp, PARROT_GC_DEBUG_FLAG); }
+    PREG(1) = VTABLE_cmp_pmc(interp, PREG(2), PREG(3));
 
-return (opcode_t *)cur_opcode + 2;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_interpinfo_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_issame_i_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = interpinfo(interp, IREG(2));
+    if (PREG(2) == PREG(3))
+        IREG(1) = 1;
+    else
+        IREG(1) = VTABLE_is_same(interp, PREG(2), PREG(3));
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_interpinfo_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_issame_i_s_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = interpinfo(interp, ICONST(2));
+    IREG(1) = SREG(2) == SREG(3);
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_interpinfo_p_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_issame_i_sc_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = interpinfo_p(interp, IREG(2));
+    IREG(1) = SCONST(2) == SREG(3);
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_interpinfo_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_issame_i_s_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = interpinfo_p(interp, ICONST(2));
+    IREG(1) = SREG(2) == SCONST(3);
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_interpinfo_s_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_issame_i_sc_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    STRING * const s = interpinfo_s(interp, IREG(2));
-    SREG(1) = s;
+    IREG(1) = SCONST(2) == SCONST(3);
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_interpinfo_s_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_isntsame_i_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    STRING * const s = interpinfo_s(interp, ICONST(2));
-    SREG(1) = s;
+    if (PREG(2) == PREG(3))
+        IREG(1) = 0;
+    else
+        IREG(1) = !VTABLE_is_same(interp, PREG(2), PREG(3));
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_warningson_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_isntsame_i_s_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PARROT_WARNINGS_on(interp, IREG(1));
+    IREG(1) = SREG(2) != SREG(3);
 
-return (opcode_t *)cur_opcode + 2;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_warningson_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_isntsame_i_sc_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PARROT_WARNINGS_on(interp, ICONST(1));
+    IREG(1) = SCONST(2) != SREG(3);
 
-return (opcode_t *)cur_opcode + 2;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_warningsoff_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_isntsame_i_s_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PARROT_WARNINGS_off(interp, IREG(1));
+    IREG(1) = SREG(2) != SCONST(3);
 
-return (opcode_t *)cur_opcode + 2;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_warningsoff_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_isntsame_i_sc_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PARROT_WARNINGS_off(interp, ICONST(1));
+    IREG(1) = SCONST(2) != SCONST(3);
 
-return (opcode_t *)cur_opcode + 2;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_errorson_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_istrue_i_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PARROT_ERRORS_on(interp, IREG(1));
+    IREG(1) = VTABLE_get_bool(interp, PREG(2));
 
-return (opcode_t *)cur_opcode + 2;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_errorson_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_isfalse_i_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PARROT_ERRORS_on(interp, ICONST(1));
+    IREG(1) = !VTABLE_get_bool(interp, PREG(2));
 
-return (opcode_t *)cur_opcode + 2;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_errorsoff_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_isnull_i_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PARROT_ERRORS_off(interp, IREG(1));
+    IREG(1) = PMC_IS_NULL(PREG(2));
 
-return (opcode_t *)cur_opcode + 2;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_errorsoff_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_isnull_i_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PARROT_ERRORS_off(interp, ICONST(1));
+    IREG(1) = PMC_IS_NULL(PCONST(2));
 
-return (opcode_t *)cur_opcode + 2;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_runinterp_p_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_isnull_i_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    Interp * const new_interp = (Interp *)VTABLE_get_pointer(interp, PREG(1));
-    Interp_flags_SET(new_interp, PARROT_EXTERN_CODE_FLAG);
-    Parrot_switch_to_cs(new_interp, interp->code, 1);
-    runops(new_interp, REL_PC + IREG(2));
+    IREG(1) = STRING_IS_NULL(SREG(2));
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_runinterp_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_isnull_i_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    Interp * const new_interp = (Interp *)VTABLE_get_pointer(interp, PREG(1));
-    Interp_flags_SET(new_interp, PARROT_EXTERN_CODE_FLAG);
-    Parrot_switch_to_cs(new_interp, interp->code, 1);
-    runops(new_interp, REL_PC + ICONST(2));
+    IREG(1) = STRING_IS_NULL(SCONST(2));
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_getinterp_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_isgt_i_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_get_pmc_keyed_int(interp, interp->iglobals,
-           IGLOBALS_INTERPRETER);
+    IREG(1) = (VTABLE_cmp(interp, PREG(2), PREG(3)) > 0);
 
-return (opcode_t *)cur_opcode + 2;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_sweep_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_isge_i_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (ICONST(1))
-        Parrot_gc_mark_and_sweep(interp, GC_trace_normal_FLAG);
-    else
-        if (Parrot_gc_impatient_pmcs(interp))
-            Parrot_gc_mark_and_sweep(interp, GC_lazy_FLAG);
+    IREG(1) = (VTABLE_cmp(interp, PREG(2), PREG(3)) >= 0);
 
-return (opcode_t *)cur_opcode + 2;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_collect(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_isle_i_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    Parrot_gc_compact_memory_pool(interp);
+    IREG(1) = IREG(2) <= IREG(3);
 
-return (opcode_t *)cur_opcode + 1;}
+return (opcode_t *)cur_opcode + 4;}
+
+opcode_t *
+Parrot_isle_i_ic_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = ICONST(2) <= IREG(3);
+
+return (opcode_t *)cur_opcode + 4;}
+
+opcode_t *
+Parrot_isle_i_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = IREG(2) <= ICONST(3);
+
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_sweepoff(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_isle_i_n_n(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    Parrot_block_GC_mark(interp);
+    IREG(1) = NREG(2) <= NREG(3);
 
-return (opcode_t *)cur_opcode + 1;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_sweepon(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_isle_i_nc_n(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    Parrot_unblock_GC_mark(interp);
+    IREG(1) = NCONST(2) <= NREG(3);
 
-return (opcode_t *)cur_opcode + 1;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_collectoff(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_isle_i_n_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    Parrot_block_GC_sweep(interp);
+    IREG(1) = NREG(2) <= NCONST(3);
 
-return (opcode_t *)cur_opcode + 1;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_collecton(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_isle_i_s_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    Parrot_unblock_GC_sweep(interp);
+    IREG(1) = STRING_compare(interp, SREG(2), SREG(3)) <= 0;
 
-return (opcode_t *)cur_opcode + 1;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_needs_destroy_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_isle_i_sc_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    Parrot_gc_pmc_needs_early_collection(interp, PREG(1));
+    IREG(1) = STRING_compare(interp, SCONST(2), SREG(3)) <= 0;
 
-return (opcode_t *)cur_opcode + 2;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_loadlib_p_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_isle_i_s_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = Parrot_dyn_load_lib(interp, SREG(2), NULL);
+    IREG(1) = STRING_compare(interp, SREG(2), SCONST(3)) <= 0;
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_loadlib_p_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_isle_i_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = Parrot_dyn_load_lib(interp, SCONST(2), NULL);
+    IREG(1) = (VTABLE_cmp(interp, PREG(2), PREG(3)) <= 0);
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_loadlib_p_s_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_islt_i_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = Parrot_dyn_load_lib(interp, SREG(2), PREG(3));
+    IREG(1) = (IREG(2) < IREG(3)) ? 1 : 0;
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_loadlib_p_sc_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_islt_i_ic_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = Parrot_dyn_load_lib(interp, SCONST(2), PREG(3));
+    IREG(1) = (ICONST(2) < IREG(3)) ? 1 : 0;
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_loadlib_p_s_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_islt_i_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = Parrot_dyn_load_lib(interp, SREG(2), PCONST(3));
+    IREG(1) = (IREG(2) < ICONST(3)) ? 1 : 0;
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_loadlib_p_sc_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_islt_i_n_n(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = Parrot_dyn_load_lib(interp, SCONST(2), PCONST(3));
+    IREG(1) = NREG(2) < NREG(3);
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_dlfunc_p_p_s_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_islt_i_nc_n(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    void         *dl_handle = NULL;
-    void         *ptr       = NULL;
-    funcptr_t     p;
-
-    if (!PMC_IS_NULL(PREG(2))
-    && PREG(2)->vtable->base_type == enum_class_ParrotLibrary
-    && VTABLE_defined(interp, PREG(2))) {
-        dl_handle = ((Parrot_ParrotLibrary_attributes*)PMC_data(PREG(2)))->dl_handle;
-    }
+    IREG(1) = NCONST(2) < NREG(3);
 
-    ptr = Parrot_dyn_dlsym_str(interp, dl_handle, SREG(3));
-    p = D2FPTR(ptr);
+return (opcode_t *)cur_opcode + 4;}
 
-    if (p == NULLfunc) {
-        const char * err = Parrot_dlerror();
-        Parrot_warn(interp, PARROT_WARNINGS_UNDEF_FLAG,
-                "Symbol '%Ss' not found: %s\n", SREG(3), err ? err : "unknown reason");
-        PREG(1) = Parrot_pmc_new(interp, enum_class_Undef);
-    }
-    else {
-        PREG(1) = Parrot_pmc_new(interp, enum_class_NCI);
-        VTABLE_set_pointer_keyed_str(interp, PREG(1), SREG(4), F2DPTR(p));
-    }
+opcode_t *
+Parrot_islt_i_n_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = NREG(2) < NCONST(3);
 
-return (opcode_t *)cur_opcode + 5;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_dlfunc_p_p_sc_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_islt_i_s_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    void         *dl_handle = NULL;
-    void         *ptr       = NULL;
-    funcptr_t     p;
-
-    if (!PMC_IS_NULL(PREG(2))
-    && PREG(2)->vtable->base_type == enum_class_ParrotLibrary
-    && VTABLE_defined(interp, PREG(2))) {
-        dl_handle = ((Parrot_ParrotLibrary_attributes*)PMC_data(PREG(2)))->dl_handle;
-    }
+    IREG(1) = STRING_compare(interp, SREG(2), SREG(3)) < 0;
 
-    ptr = Parrot_dyn_dlsym_str(interp, dl_handle, SCONST(3));
-    p = D2FPTR(ptr);
+return (opcode_t *)cur_opcode + 4;}
 
-    if (p == NULLfunc) {
-        const char * err = Parrot_dlerror();
-        Parrot_warn(interp, PARROT_WARNINGS_UNDEF_FLAG,
-                "Symbol '%Ss' not found: %s\n", SCONST(3), err ? err : "unknown reason");
-        PREG(1) = Parrot_pmc_new(interp, enum_class_Undef);
-    }
-    else {
-        PREG(1) = Parrot_pmc_new(interp, enum_class_NCI);
-        VTABLE_set_pointer_keyed_str(interp, PREG(1), SREG(4), F2DPTR(p));
-    }
+opcode_t *
+Parrot_islt_i_sc_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = STRING_compare(interp, SCONST(2), SREG(3)) < 0;
 
-return (opcode_t *)cur_opcode + 5;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_dlfunc_p_p_s_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_islt_i_s_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    void         *dl_handle = NULL;
-    void         *ptr       = NULL;
-    funcptr_t     p;
-
-    if (!PMC_IS_NULL(PREG(2))
-    && PREG(2)->vtable->base_type == enum_class_ParrotLibrary
-    && VTABLE_defined(interp, PREG(2))) {
-        dl_handle = ((Parrot_ParrotLibrary_attributes*)PMC_data(PREG(2)))->dl_handle;
-    }
+    IREG(1) = STRING_compare(interp, SREG(2), SCONST(3)) < 0;
 
-    ptr = Parrot_dyn_dlsym_str(interp, dl_handle, SREG(3));
-    p = D2FPTR(ptr);
+return (opcode_t *)cur_opcode + 4;}
 
-    if (p == NULLfunc) {
-        const char * err = Parrot_dlerror();
-        Parrot_warn(interp, PARROT_WARNINGS_UNDEF_FLAG,
-                "Symbol '%Ss' not found: %s\n", SREG(3), err ? err : "unknown reason");
-        PREG(1) = Parrot_pmc_new(interp, enum_class_Undef);
-    }
-    else {
-        PREG(1) = Parrot_pmc_new(interp, enum_class_NCI);
-        VTABLE_set_pointer_keyed_str(interp, PREG(1), SCONST(4), F2DPTR(p));
-    }
+opcode_t *
+Parrot_islt_i_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = (VTABLE_cmp(interp, PREG(2), PREG(3)) < 0);
 
-return (opcode_t *)cur_opcode + 5;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_dlfunc_p_p_sc_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_iseq_i_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    void         *dl_handle = NULL;
-    void         *ptr       = NULL;
-    funcptr_t     p;
-
-    if (!PMC_IS_NULL(PREG(2))
-    && PREG(2)->vtable->base_type == enum_class_ParrotLibrary
-    && VTABLE_defined(interp, PREG(2))) {
-        dl_handle = ((Parrot_ParrotLibrary_attributes*)PMC_data(PREG(2)))->dl_handle;
-    }
+    IREG(1) = (IREG(2) == IREG(3)) ? 1 : 0;
 
-    ptr = Parrot_dyn_dlsym_str(interp, dl_handle, SCONST(3));
-    p = D2FPTR(ptr);
+return (opcode_t *)cur_opcode + 4;}
 
-    if (p == NULLfunc) {
-        const char * err = Parrot_dlerror();
-        Parrot_warn(interp, PARROT_WARNINGS_UNDEF_FLAG,
-                "Symbol '%Ss' not found: %s\n", SCONST(3), err ? err : "unknown reason");
-        PREG(1) = Parrot_pmc_new(interp, enum_class_Undef);
-    }
-    else {
-        PREG(1) = Parrot_pmc_new(interp, enum_class_NCI);
-        VTABLE_set_pointer_keyed_str(interp, PREG(1), SCONST(4), F2DPTR(p));
-    }
+opcode_t *
+Parrot_iseq_i_ic_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = (ICONST(2) == IREG(3)) ? 1 : 0;
 
-return (opcode_t *)cur_opcode + 5;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_dlvar_p_p_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_iseq_i_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    void *        dl_handle = NULL;
-    void *        p         = NULL;
-
-    if (!PMC_IS_NULL(PREG(2))
-    && PREG(2)->vtable->base_type == enum_class_ParrotLibrary
-    && VTABLE_defined(interp, PREG(2))) {
-        dl_handle = ((Parrot_ParrotLibrary_attributes*)PMC_data(PREG(2)))->dl_handle;
-    }
+    IREG(1) = (IREG(2) == ICONST(3)) ? 1 : 0;
 
-    p = Parrot_dyn_dlsym_str(interp, dl_handle, SREG(3));
+return (opcode_t *)cur_opcode + 4;}
 
-    if (p == NULL) {
-        const char * const err = Parrot_dlerror();
-        Parrot_warn(interp, PARROT_WARNINGS_UNDEF_FLAG,
-                "Symbol '%Ss' not found: %s\n", SREG(3), err ? err : "unknown reason");
-        PREG(1) = Parrot_pmc_new(interp, enum_class_Undef);
-    }
-    else {
-        /* At this point we have the symbol's address. We just need to build
-           a PMC with it so we can get and set the value */
-        PREG(1) = Parrot_pmc_new(interp, enum_class_UnManagedStruct);
-        VTABLE_set_pointer(interp, PREG(1), p);
-    }
+opcode_t *
+Parrot_iseq_i_n_n(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = NREG(2) == NREG(3);
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_dlvar_p_p_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_iseq_i_nc_n(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    void *        dl_handle = NULL;
-    void *        p         = NULL;
-
-    if (!PMC_IS_NULL(PREG(2))
-    && PREG(2)->vtable->base_type == enum_class_ParrotLibrary
-    && VTABLE_defined(interp, PREG(2))) {
-        dl_handle = ((Parrot_ParrotLibrary_attributes*)PMC_data(PREG(2)))->dl_handle;
-    }
+    IREG(1) = NCONST(2) == NREG(3);
 
-    p = Parrot_dyn_dlsym_str(interp, dl_handle, SCONST(3));
+return (opcode_t *)cur_opcode + 4;}
 
-    if (p == NULL) {
-        const char * const err = Parrot_dlerror();
-        Parrot_warn(interp, PARROT_WARNINGS_UNDEF_FLAG,
-                "Symbol '%Ss' not found: %s\n", SCONST(3), err ? err : "unknown reason");
-        PREG(1) = Parrot_pmc_new(interp, enum_class_Undef);
-    }
-    else {
-        /* At this point we have the symbol's address. We just need to build
-           a PMC with it so we can get and set the value */
-        PREG(1) = Parrot_pmc_new(interp, enum_class_UnManagedStruct);
-        VTABLE_set_pointer(interp, PREG(1), p);
-    }
+opcode_t *
+Parrot_iseq_i_n_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = NREG(2) == NCONST(3);
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_compreg_s_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_iseq_i_s_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const compreg_hash = VTABLE_get_pmc_keyed_int(interp,
-            interp->iglobals, IGLOBALS_COMPREG_HASH);
-    VTABLE_set_pmc_keyed_str(interp, compreg_hash, SREG(1), PREG(2));
+    IREG(1) = STRING_equal(interp, SREG(2), SREG(3));
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_compreg_sc_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_iseq_i_sc_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const compreg_hash = VTABLE_get_pmc_keyed_int(interp,
-            interp->iglobals, IGLOBALS_COMPREG_HASH);
-    VTABLE_set_pmc_keyed_str(interp, compreg_hash, SCONST(1), PREG(2));
+    IREG(1) = STRING_equal(interp, SCONST(2), SREG(3));
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_compreg_p_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_iseq_i_s_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const compreg_hash = VTABLE_get_pmc_keyed_int(interp,
-            interp->iglobals, IGLOBALS_COMPREG_HASH);
-    PREG(1) = VTABLE_get_pmc_keyed_str(interp, compreg_hash, SREG(2));
+    IREG(1) = STRING_equal(interp, SREG(2), SCONST(3));
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_compreg_p_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_iseq_i_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const compreg_hash = VTABLE_get_pmc_keyed_int(interp,
-            interp->iglobals, IGLOBALS_COMPREG_HASH);
-    PREG(1) = VTABLE_get_pmc_keyed_str(interp, compreg_hash, SCONST(2));
+    if (&PREG(2) == &PREG(3))
+        IREG(1) = 1;
+    else
+        IREG(1) = VTABLE_is_equal(interp, PREG(2), PREG(3));
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_new_callback_p_p_p_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_isne_i_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = Parrot_make_cb(interp, PREG(2), PREG(3), SREG(4));
+    IREG(1) = (IREG(2) == IREG(3)) ? 0 : 1;
 
-return (opcode_t *)cur_opcode + 5;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_new_callback_p_p_p_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_isne_i_ic_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = Parrot_make_cb(interp, PREG(2), PREG(3), SCONST(4));
+    IREG(1) = (ICONST(2) == IREG(3)) ? 0 : 1;
 
-return (opcode_t *)cur_opcode + 5;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_annotations_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_isne_i_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (interp->code->annotations) {
-        const opcode_t cur_pos = ( cur_opcode + 2) - interp->code->base.data;
-        PREG(1) = PackFile_Annotations_lookup(interp, interp->code->annotations,
-                cur_pos, NULL);
-    }
-    else {
-        PREG(1) = Parrot_pmc_new(interp, enum_class_Hash);
-    }
+    IREG(1) = (IREG(2) == ICONST(3)) ? 0 : 1;
 
-return (opcode_t *)cur_opcode + 2;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_annotations_p_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_isne_i_n_n(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (interp->code->annotations) {
-        const opcode_t cur_pos = ( cur_opcode + 3) - interp->code->base.data;
-        PREG(1) = PackFile_Annotations_lookup(interp, interp->code->annotations,
-                cur_pos, SREG(2));
-    }
-    else {
-        PREG(1) = PMCNULL;
-    }
+    IREG(1) = NREG(2) != NREG(3);
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_annotations_p_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_isne_i_nc_n(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (interp->code->annotations) {
-        const opcode_t cur_pos = ( cur_opcode + 3) - interp->code->base.data;
-        PREG(1) = PackFile_Annotations_lookup(interp, interp->code->annotations,
-                cur_pos, SCONST(2));
-    }
-    else {
-        PREG(1) = PMCNULL;
-    }
+    IREG(1) = NCONST(2) != NREG(3);
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_band_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_isne_i_n_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) &= IREG(2);
+    IREG(1) = NREG(2) != NCONST(3);
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_band_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_isne_i_s_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) &= ICONST(2);
+    IREG(1) = !STRING_equal(interp, SREG(2), SREG(3));
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_band_i_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_isne_i_sc_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = IREG(2) & IREG(3);
+    IREG(1) = !STRING_equal(interp, SCONST(2), SREG(3));
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_band_i_ic_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_isne_i_s_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = ICONST(2) & IREG(3);
+    IREG(1) = !STRING_equal(interp, SREG(2), SCONST(3));
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_band_i_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_isne_i_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = IREG(2) & ICONST(3);
+    if (&PREG(2) == &PREG(3))
+        IREG(1) = 0;
+    else
+        IREG(1) = !VTABLE_is_equal(interp, PREG(2), PREG(3));
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_bor_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_and_i_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) |= IREG(2);
+    IREG(1) = IREG(2) ? IREG(3) : IREG(2);
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_bor_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_and_i_ic_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) |= ICONST(2);
+    IREG(1) = ICONST(2) ? IREG(3) : ICONST(2);
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_bor_i_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_and_i_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = IREG(2) | IREG(3);
+    IREG(1) = IREG(2) ? ICONST(3) : IREG(2);
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_bor_i_ic_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_and_p_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = ICONST(2) | IREG(3);
+    PREG(1) = VTABLE_get_bool(interp, PREG(2)) ? PREG(3) : PREG(2);
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_bor_i_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_not_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = IREG(2) | ICONST(3);
+    IREG(1) = ! IREG(1);
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 2;}
 
 opcode_t *
-Parrot_shl_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_not_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = bit_shift_left(IREG(1), IREG(2));
+    IREG(1) = ! IREG(2);
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_shl_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_not_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = bit_shift_left(IREG(1), ICONST(2));
+    VTABLE_set_bool(interp, PREG(1), !VTABLE_get_bool(interp, PREG(1)));
+
+return (opcode_t *)cur_opcode + 2;}
+
+opcode_t *
+Parrot_not_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    const INTVAL a = ! VTABLE_get_bool(interp, PREG(2));
+    if (PMC_IS_NULL(PREG(1)))
+        PREG(1) = Parrot_pmc_new(interp, Parrot_hll_get_ctx_HLL_type(interp, enum_class_Boolean));
+    VTABLE_set_bool(interp, PREG(1), a);
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_shl_i_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_or_i_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = bit_shift_left(IREG(2), IREG(3));
+    IREG(1) = IREG(2) ? IREG(2) : IREG(3);
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_shl_i_ic_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_or_i_ic_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = bit_shift_left(ICONST(2), IREG(3));
+    IREG(1) = ICONST(2) ? ICONST(2) : IREG(3);
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_shl_i_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_or_i_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = bit_shift_left(IREG(2), ICONST(3));
+    IREG(1) = IREG(2) ? IREG(2) : ICONST(3);
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_shr_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_or_p_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    const INTVAL signed_shift = -IREG(2);
-    IREG(1) = bit_shift_left(IREG(1), signed_shift);
+    PREG(1) = VTABLE_get_bool(interp, PREG(2)) ? PREG(2) : PREG(3);
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_shr_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_xor_i_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    const INTVAL signed_shift = -ICONST(2);
-    IREG(1) = bit_shift_left(IREG(1), signed_shift);
+    IREG(1) = (IREG(2) && ! IREG(3)) ? IREG(2) : (IREG(3) && ! IREG(2)) ? IREG(3) : 0;
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_shr_i_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_xor_i_ic_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    const INTVAL signed_shift = -IREG(3);
-    IREG(1) = bit_shift_left(IREG(2), signed_shift);
+    IREG(1) = (ICONST(2) && ! IREG(3)) ? ICONST(2) : (IREG(3) && ! ICONST(2)) ? IREG(3) : 0;
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_shr_i_ic_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_xor_i_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    const INTVAL signed_shift = -IREG(3);
-    IREG(1) = bit_shift_left(ICONST(2), signed_shift);
+    IREG(1) = (IREG(2) && ! ICONST(3)) ? IREG(2) : (ICONST(3) && ! IREG(2)) ? ICONST(3) : 0;
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_shr_i_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_xor_p_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    const INTVAL signed_shift = -ICONST(3);
-    IREG(1) = bit_shift_left(IREG(2), signed_shift);
+    const INTVAL a = VTABLE_get_bool(interp, PREG(2));
+    const INTVAL b = VTABLE_get_bool(interp, PREG(3));
+    if (a && ! b)
+        PREG(1) = PREG(2);
+    else
+        if (b && ! a)
+            PREG(1) = PREG(3) ;
+        else{
+            PREG(1) = Parrot_pmc_new(interp, VTABLE_type(interp, PREG(2)));
+            VTABLE_set_bool(interp, PREG(1), 0);
+        }
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_lsr_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_print_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    const UINTVAL a = (UINTVAL)IREG(1);
-    const UINTVAL b = a >> IREG(2);
-    IREG(1) = (INTVAL)b;
+    Parrot_io_printf(interp, INTVAL_FMT, (INTVAL)IREG(1));
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 2;}
 
 opcode_t *
-Parrot_lsr_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_print_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    const UINTVAL a = (UINTVAL)IREG(1);
-    const UINTVAL b = a >> ICONST(2);
-    IREG(1) = (INTVAL)b;
+    Parrot_io_printf(interp, INTVAL_FMT, (INTVAL)ICONST(1));
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 2;}
 
 opcode_t *
-Parrot_lsr_i_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_print_n(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = (INTVAL)((UINTVAL)IREG(2) >> IREG(3));
+#ifdef PARROT_HAS_NEGATIVE_ZERO
+    Parrot_io_printf(interp, FLOATVAL_FMT, NREG(1));
+#else
+    /* Workaround for older msvcrt and openbsd. TT #313 */
+    if (Parrot_is_nzero(NREG(1))) {
+        Parrot_io_printf(interp, "-0");
+    }
+    else {
+        Parrot_io_printf(interp, FLOATVAL_FMT, NREG(1));
+    }
+#endif
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 2;}
 
 opcode_t *
-Parrot_lsr_i_ic_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_print_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = (INTVAL)((UINTVAL)ICONST(2) >> IREG(3));
+#ifdef PARROT_HAS_NEGATIVE_ZERO
+    Parrot_io_printf(interp, FLOATVAL_FMT, NCONST(1));
+#else
+    /* Workaround for older msvcrt and openbsd. TT #313 */
+    if (Parrot_is_nzero(NCONST(1))) {
+        Parrot_io_printf(interp, "-0");
+    }
+    else {
+        Parrot_io_printf(interp, FLOATVAL_FMT, NCONST(1));
+    }
+#endif
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 2;}
 
 opcode_t *
-Parrot_lsr_i_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_print_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = (INTVAL)((UINTVAL)IREG(2) >> ICONST(3));
+    STRING * const s = SREG(1);
+    if (s && Parrot_str_byte_length(interp, s))
+        Parrot_io_putps(interp, _PIO_STDOUT(interp), s);
+
+return (opcode_t *)cur_opcode + 2;}
+
+opcode_t *
+Parrot_print_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    STRING * const s = SCONST(1);
+    if (s && Parrot_str_byte_length(interp, s))
+        Parrot_io_putps(interp, _PIO_STDOUT(interp), s);
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 2;}
 
 opcode_t *
-Parrot_bxor_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_print_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) ^= IREG(2);
+    PMC * const p = PREG(1);
+    STRING * const s = (VTABLE_get_string(interp, p));
+    if (s)
+        Parrot_io_putps(interp, _PIO_STDOUT(interp), s);
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 2;}
 
 opcode_t *
-Parrot_bxor_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_say_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) ^= ICONST(2);
+    Parrot_io_printf(interp, INTVAL_FMT "\n", (INTVAL)IREG(1));
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 2;}
 
 opcode_t *
-Parrot_bxor_i_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_say_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = IREG(2) ^ IREG(3);
+    Parrot_io_printf(interp, INTVAL_FMT "\n", (INTVAL)ICONST(1));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 2;}
 
 opcode_t *
-Parrot_bxor_i_ic_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_say_n(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = ICONST(2) ^ IREG(3);
+#ifdef PARROT_HAS_NEGATIVE_ZERO
+    Parrot_io_printf(interp, FLOATVAL_FMT "\n", NREG(1));
+#else
+    /* Workaround for older msvcrt and openbsd. TT #313 */
+    if (Parrot_is_nzero(NREG(1))) {
+        Parrot_io_printf(interp, "-0\n");
+    }
+    else {
+        Parrot_io_printf(interp, FLOATVAL_FMT "\n", NREG(1));
+    }
+#endif
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 2;}
 
 opcode_t *
-Parrot_bxor_i_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_say_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = IREG(2) ^ ICONST(3);
+#ifdef PARROT_HAS_NEGATIVE_ZERO
+    Parrot_io_printf(interp, FLOATVAL_FMT "\n", NCONST(1));
+#else
+    /* Workaround for older msvcrt and openbsd. TT #313 */
+    if (Parrot_is_nzero(NCONST(1))) {
+        Parrot_io_printf(interp, "-0\n");
+    }
+    else {
+        Parrot_io_printf(interp, FLOATVAL_FMT "\n", NCONST(1));
+    }
+#endif
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 2;}
 
 opcode_t *
-Parrot_eq_i_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_say_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (IREG(1) == IREG(2)) {return (opcode_t *)cur_opcode + ICONST(3);
-    }
+    STRING * const s = SREG(1);
+    if (s && Parrot_str_byte_length(interp, s))
+        Parrot_io_putps(interp, _PIO_STDOUT(interp), s);
+    Parrot_io_putps(interp, _PIO_STDOUT(interp), Parrot_str_new_constant(interp, "\n"));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 2;}
 
 opcode_t *
-Parrot_eq_ic_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_say_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (ICONST(1) == IREG(2)) {return (opcode_t *)cur_opcode + ICONST(3);
-    }
+    STRING * const s = SCONST(1);
+    if (s && Parrot_str_byte_length(interp, s))
+        Parrot_io_putps(interp, _PIO_STDOUT(interp), s);
+    Parrot_io_putps(interp, _PIO_STDOUT(interp), Parrot_str_new_constant(interp, "\n"));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 2;}
 
 opcode_t *
-Parrot_eq_i_ic_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_say_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (IREG(1) == ICONST(2)) {return (opcode_t *)cur_opcode + ICONST(3);
+    PMC * const p = PREG(1);
+
+    if (PMC_IS_NULL(p)) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, cur_opcode + 2,
+             EXCEPTION_UNEXPECTED_NULL,
+            "Null PMC in say");return (opcode_t *)handler;
+    }
+    else {
+        STRING * const s = VTABLE_get_string(interp, p);
+        if (s)
+            Parrot_io_putps(interp, _PIO_STDOUT(interp), s);
+        Parrot_io_putps(interp, _PIO_STDOUT(interp), Parrot_str_new_constant(interp, "\n"));
     }
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 2;}
 
 opcode_t *
-Parrot_eq_n_n_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_print_p_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (NREG(1) == NREG(2)) {return (opcode_t *)cur_opcode + ICONST(3);
+    if (PREG(1)) {
+        STRING * const s = Parrot_str_from_int(interp, IREG(2));
+        Parrot_io_putps(interp, PREG(1), s);
     }
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_eq_nc_n_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_print_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (NCONST(1) == NREG(2)) {return (opcode_t *)cur_opcode + ICONST(3);
+    if (PREG(1)) {
+        STRING * const s = Parrot_str_from_int(interp, ICONST(2));
+        Parrot_io_putps(interp, PREG(1), s);
     }
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_eq_n_nc_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_print_p_n(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (NREG(1) == NCONST(2)) {return (opcode_t *)cur_opcode + ICONST(3);
+    if (PREG(1)) {
+        STRING * const s = Parrot_sprintf_c(interp, FLOATVAL_FMT, NREG(2));
+        Parrot_io_putps(interp, PREG(1), s);
     }
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_eq_s_s_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_print_p_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (STRING_equal(interp, SREG(1), SREG(2))) {return (opcode_t *)cur_opcode + ICONST(3);
+    if (PREG(1)) {
+        STRING * const s = Parrot_sprintf_c(interp, FLOATVAL_FMT, NCONST(2));
+        Parrot_io_putps(interp, PREG(1), s);
     }
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_eq_sc_s_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_print_p_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (STRING_equal(interp, SCONST(1), SREG(2))) {return (opcode_t *)cur_opcode + ICONST(3);
+    if (SREG(2) && PREG(1)) {
+        Parrot_io_putps(interp, PREG(1), SREG(2));
     }
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_eq_s_sc_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_print_p_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (STRING_equal(interp, SREG(1), SCONST(2))) {return (opcode_t *)cur_opcode + ICONST(3);
+    if (SCONST(2) && PREG(1)) {
+        Parrot_io_putps(interp, PREG(1), SCONST(2));
     }
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_eq_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_print_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (VTABLE_is_equal(interp, PREG(1), PREG(2))) {return (opcode_t *)cur_opcode + ICONST(3);
+    if (PREG(2) && PREG(1)) {
+        STRING * const s = VTABLE_get_string(interp, PREG(2));
+        Parrot_io_putps(interp, PREG(1), s);
     }
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_eq_p_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_getstdin_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const temp = Parrot_pmc_new_temporary(interp, enum_class_Integer);
-    VTABLE_set_integer_native(interp, temp, IREG(2));
-
-    if (VTABLE_is_equal(interp, PREG(1), temp)) {
-        Parrot_pmc_free_temporary(interp, temp);return (opcode_t *)cur_opcode + ICONST(3);
-    }
-
-    Parrot_pmc_free_temporary(interp, temp);
+    PREG(1) = _PIO_STDIN(interp);
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 2;}
 
 opcode_t *
-Parrot_eq_p_ic_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_getstdout_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const temp = Parrot_pmc_new_temporary(interp, enum_class_Integer);
-    VTABLE_set_integer_native(interp, temp, ICONST(2));
+    PREG(1) = _PIO_STDOUT(interp);
 
-    if (VTABLE_is_equal(interp, PREG(1), temp)) {
-        Parrot_pmc_free_temporary(interp, temp);return (opcode_t *)cur_opcode + ICONST(3);
-    }
+return (opcode_t *)cur_opcode + 2;}
 
-    Parrot_pmc_free_temporary(interp, temp);
+opcode_t *
+Parrot_getstderr_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = _PIO_STDERR(interp);
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 2;}
 
 opcode_t *
-Parrot_eq_p_n_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_abs_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    /*
-     * the get_number and get_string should probably
-     * be also replaced with code like above, as
-     * overriding the compare multi subs wouldn't
-     * have any effect with the current code
-     */
-    if (VTABLE_get_number(interp, PREG(1)) == NREG(2)) {return (opcode_t *)cur_opcode + ICONST(3);
-    }
+    IREG(1) = abs(IREG(1));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 2;}
 
 opcode_t *
-Parrot_eq_p_nc_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_abs_n(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    /*
-     * the get_number and get_string should probably
-     * be also replaced with code like above, as
-     * overriding the compare multi subs wouldn't
-     * have any effect with the current code
-     */
-    if (VTABLE_get_number(interp, PREG(1)) == NCONST(2)) {return (opcode_t *)cur_opcode + ICONST(3);
-    }
+    NREG(1) = fabs(NREG(1));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 2;}
 
 opcode_t *
-Parrot_eq_p_s_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_abs_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (STRING_equal(interp, VTABLE_get_string(interp, PREG(1)), SREG(2))) {return (opcode_t *)cur_opcode + ICONST(3);
-    }
+    IREG(1) = abs(IREG(2));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_eq_p_sc_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_abs_n_n(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (STRING_equal(interp, VTABLE_get_string(interp, PREG(1)), SCONST(2))) {return (opcode_t *)cur_opcode + ICONST(3);
-    }
+    NREG(1) = fabs(NREG(2));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_eq_str_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_abs_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (VTABLE_is_equal_string(interp, PREG(1), PREG(2))) {return (opcode_t *)cur_opcode + ICONST(3);
-    }
+    VTABLE_i_absolute(interp, PREG(1));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 2;}
 
 opcode_t *
-Parrot_eq_num_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_abs_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (VTABLE_is_equal_num(interp, PREG(1), PREG(2))) {return (opcode_t *)cur_opcode + ICONST(3);
-    }
+    PREG(1) = VTABLE_absolute(interp, PREG(2), PREG(1));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_eq_addr_s_s_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (SREG(1) == SREG(2)) {return (opcode_t *)cur_opcode + ICONST(3);
-    }
+    IREG(1) += IREG(2);
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_eq_addr_sc_s_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (SCONST(1) == SREG(2)) {return (opcode_t *)cur_opcode + ICONST(3);
-    }
+    IREG(1) += ICONST(2);
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_eq_addr_s_sc_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_n_n(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (SREG(1) == SCONST(2)) {return (opcode_t *)cur_opcode + ICONST(3);
-    }
+    NREG(1) += NREG(2);
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_eq_addr_sc_sc_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_n_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (SCONST(1) == SCONST(2)) {return (opcode_t *)cur_opcode + ICONST(3);
-    }
+    NREG(1) += NCONST(2);
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_eq_addr_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (PREG(1) == PREG(2)) {return (opcode_t *)cur_opcode + ICONST(3);
-    }
+    VTABLE_i_add(interp, PREG(1), PREG(2));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_ne_i_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_p_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (IREG(1) != IREG(2)) {return (opcode_t *)cur_opcode + ICONST(3);
-    }
+    VTABLE_i_add_int(interp, PREG(1), IREG(2));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_ne_ic_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (ICONST(1) != IREG(2)) {return (opcode_t *)cur_opcode + ICONST(3);
-    }
+    VTABLE_i_add_int(interp, PREG(1), ICONST(2));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_ne_i_ic_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_p_n(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (IREG(1) != ICONST(2)) {return (opcode_t *)cur_opcode + ICONST(3);
-    }
+    VTABLE_i_add_float(interp, PREG(1), NREG(2));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_ne_n_n_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_p_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (NREG(1) != NREG(2)) {return (opcode_t *)cur_opcode + ICONST(3);
-    }
+    VTABLE_i_add_float(interp, PREG(1), NCONST(2));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_ne_nc_n_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_i_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (NCONST(1) != NREG(2)) {return (opcode_t *)cur_opcode + ICONST(3);
-    }
+    IREG(1) = IREG(2) + IREG(3);
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_ne_n_nc_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_i_ic_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (NREG(1) != NCONST(2)) {return (opcode_t *)cur_opcode + ICONST(3);
-    }
+    IREG(1) = ICONST(2) + IREG(3);
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_ne_s_s_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_i_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (!STRING_equal(interp, SREG(1), SREG(2))) {return (opcode_t *)cur_opcode + ICONST(3);
-    }
+    IREG(1) = IREG(2) + ICONST(3);
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_ne_sc_s_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_n_n_n(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (!STRING_equal(interp, SCONST(1), SREG(2))) {return (opcode_t *)cur_opcode + ICONST(3);
-    }
+    NREG(1) = NREG(2) + NREG(3);
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_ne_s_sc_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_n_nc_n(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (!STRING_equal(interp, SREG(1), SCONST(2))) {return (opcode_t *)cur_opcode + ICONST(3);
-    }
+    NREG(1) = NCONST(2) + NREG(3);
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_ne_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_n_n_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (!VTABLE_is_equal(interp, PREG(1), PREG(2))) {return (opcode_t *)cur_opcode + ICONST(3);
-    }
+    NREG(1) = NREG(2) + NCONST(3);
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_ne_p_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_p_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const temp = Parrot_pmc_new_temporary(interp, enum_class_Integer);
-    VTABLE_set_integer_native(interp, temp, IREG(2));
-
-    if (!VTABLE_is_equal(interp, PREG(1), temp)) {
-        Parrot_pmc_free_temporary(interp, temp);return (opcode_t *)cur_opcode + ICONST(3);
-    }
-
-    Parrot_pmc_free_temporary(interp, temp);
+    PREG(1) = VTABLE_add(interp, PREG(2), PREG(3), PREG(1));
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_ne_p_ic_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_p_p_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const temp = Parrot_pmc_new_temporary(interp, enum_class_Integer);
-    VTABLE_set_integer_native(interp, temp, ICONST(2));
-
-    if (!VTABLE_is_equal(interp, PREG(1), temp)) {
-        Parrot_pmc_free_temporary(interp, temp);return (opcode_t *)cur_opcode + ICONST(3);
-    }
-
-    Parrot_pmc_free_temporary(interp, temp);
+    PREG(1) = VTABLE_add_int(interp, PREG(2), IREG(3), PREG(1));
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_ne_p_n_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (VTABLE_get_number(interp, PREG(1)) != NREG(2)) {return (opcode_t *)cur_opcode + ICONST(3);
-    }
+    PREG(1) = VTABLE_add_int(interp, PREG(2), ICONST(3), PREG(1));
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_ne_p_nc_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_p_p_n(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (VTABLE_get_number(interp, PREG(1)) != NCONST(2)) {return (opcode_t *)cur_opcode + ICONST(3);
-    }
+    PREG(1) = VTABLE_add_float(interp, PREG(2), NREG(3), PREG(1));
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_ne_p_s_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_p_p_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (!STRING_equal(interp, VTABLE_get_string(interp, PREG(1)), SREG(2))) {return (opcode_t *)cur_opcode + ICONST(3);
-    }
+    PREG(1) = VTABLE_add_float(interp, PREG(2), NCONST(3), PREG(1));
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_ne_p_sc_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_dec_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (!STRING_equal(interp, VTABLE_get_string(interp, PREG(1)), SCONST(2))) {return (opcode_t *)cur_opcode + ICONST(3);
-    }
+    IREG(1)--;
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 2;}
 
 opcode_t *
-Parrot_ne_str_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_dec_n(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (VTABLE_cmp_string(interp, PREG(1), PREG(2)) != 0) {return (opcode_t *)cur_opcode + ICONST(3);
-    }
+    NREG(1)--;
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 2;}
 
 opcode_t *
-Parrot_ne_num_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_dec_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (VTABLE_cmp_num(interp, PREG(1), PREG(2)) != 0) {return (opcode_t *)cur_opcode + ICONST(3);
-    }
+    VTABLE_decrement(interp, PREG(1));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 2;}
 
 opcode_t *
-Parrot_ne_addr_s_s_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_div_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (SREG(1) != SREG(2)) {return (opcode_t *)cur_opcode + ICONST(3);
+    INTVAL den = IREG(2);
+    if (den == 0) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, cur_opcode + 3,
+            EXCEPTION_DIV_BY_ZERO,
+            "Divide by zero");return (opcode_t *)handler;
     }
+    IREG(1) /= den;
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_ne_addr_sc_s_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_div_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (SCONST(1) != SREG(2)) {return (opcode_t *)cur_opcode + ICONST(3);
+    INTVAL den = ICONST(2);
+    if (den == 0) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, cur_opcode + 3,
+            EXCEPTION_DIV_BY_ZERO,
+            "Divide by zero");return (opcode_t *)handler;
     }
+    IREG(1) /= den;
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_ne_addr_s_sc_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_div_n_n(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (SREG(1) != SCONST(2)) {return (opcode_t *)cur_opcode + ICONST(3);
+    FLOATVAL den = NREG(2);
+    if (FLOAT_IS_ZERO(den)) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, cur_opcode + 3,
+            EXCEPTION_DIV_BY_ZERO,
+            "Divide by zero");return (opcode_t *)handler;
     }
+    NREG(1) /= den;
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_ne_addr_sc_sc_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_div_n_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (SCONST(1) != SCONST(2)) {return (opcode_t *)cur_opcode + ICONST(3);
+    FLOATVAL den = NCONST(2);
+    if (FLOAT_IS_ZERO(den)) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, cur_opcode + 3,
+            EXCEPTION_DIV_BY_ZERO,
+            "Divide by zero");return (opcode_t *)handler;
     }
+    NREG(1) /= den;
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_ne_addr_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_div_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (PREG(1) != PREG(2)) {return (opcode_t *)cur_opcode + ICONST(3);
-    }
+    VTABLE_i_divide(interp, PREG(1), PREG(2));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_lt_i_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_div_p_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (IREG(1) < IREG(2)) {return (opcode_t *)cur_opcode + ICONST(3);
-    }
+    VTABLE_i_divide_int(interp, PREG(1), IREG(2));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_lt_ic_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_div_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (ICONST(1) < IREG(2)) {return (opcode_t *)cur_opcode + ICONST(3);
-    }
+    VTABLE_i_divide_int(interp, PREG(1), ICONST(2));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_lt_i_ic_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_div_p_n(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (IREG(1) < ICONST(2)) {return (opcode_t *)cur_opcode + ICONST(3);
-    }
+    VTABLE_i_divide_float(interp, PREG(1), NREG(2));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_lt_n_n_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_div_p_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (NREG(1) < NREG(2)) {return (opcode_t *)cur_opcode + ICONST(3);
-    }
+    VTABLE_i_divide_float(interp, PREG(1), NCONST(2));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_lt_nc_n_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_div_i_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (NCONST(1) < NREG(2)) {return (opcode_t *)cur_opcode + ICONST(3);
+    INTVAL den = IREG(3);
+    if (den == 0) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
+            EXCEPTION_DIV_BY_ZERO,
+            "Divide by zero");return (opcode_t *)handler;
     }
+    IREG(1) = IREG(2) / den;
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_lt_n_nc_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_div_i_ic_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (NREG(1) < NCONST(2)) {return (opcode_t *)cur_opcode + ICONST(3);
+    INTVAL den = IREG(3);
+    if (den == 0) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
+            EXCEPTION_DIV_BY_ZERO,
+            "Divide by zero");return (opcode_t *)handler;
     }
+    IREG(1) = ICONST(2) / den;
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_lt_s_s_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_div_i_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (STRING_compare(interp, SREG(1), SREG(2)) < 0) {return (opcode_t *)cur_opcode + ICONST(3);
+    INTVAL den = ICONST(3);
+    if (den == 0) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
+            EXCEPTION_DIV_BY_ZERO,
+            "Divide by zero");return (opcode_t *)handler;
     }
+    IREG(1) = IREG(2) / den;
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_lt_sc_s_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_div_i_ic_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (STRING_compare(interp, SCONST(1), SREG(2)) < 0) {return (opcode_t *)cur_opcode + ICONST(3);
+    INTVAL den = ICONST(3);
+    if (den == 0) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
+            EXCEPTION_DIV_BY_ZERO,
+            "Divide by zero");return (opcode_t *)handler;
     }
+    IREG(1) = ICONST(2) / den;
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_lt_s_sc_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_div_n_n_n(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (STRING_compare(interp, SREG(1), SCONST(2)) < 0) {return (opcode_t *)cur_opcode + ICONST(3);
+    FLOATVAL den = NREG(3);
+    if (FLOAT_IS_ZERO(den)) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
+            EXCEPTION_DIV_BY_ZERO,
+            "Divide by zero");return (opcode_t *)handler;
     }
+    NREG(1) = NREG(2) / den;
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_lt_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_div_n_nc_n(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (VTABLE_cmp(interp, PREG(1), PREG(2)) < 0) {return (opcode_t *)cur_opcode + ICONST(3);
+    FLOATVAL den = NREG(3);
+    if (FLOAT_IS_ZERO(den)) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
+            EXCEPTION_DIV_BY_ZERO,
+            "Divide by zero");return (opcode_t *)handler;
     }
+    NREG(1) = NCONST(2) / den;
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_lt_p_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_div_n_n_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const temp = Parrot_pmc_new_temporary(interp, enum_class_Integer);
-    VTABLE_set_integer_native(interp, temp, IREG(2));
-
-    if (VTABLE_cmp(interp, PREG(1), temp) < 0) {
-        Parrot_pmc_free_temporary(interp, temp);return (opcode_t *)cur_opcode + ICONST(3);
+    FLOATVAL den = NCONST(3);
+    if (FLOAT_IS_ZERO(den)) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
+            EXCEPTION_DIV_BY_ZERO,
+            "Divide by zero");return (opcode_t *)handler;
     }
-
-    Parrot_pmc_free_temporary(interp, temp);
+    NREG(1) = NREG(2) / den;
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_lt_p_ic_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_div_n_nc_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const temp = Parrot_pmc_new_temporary(interp, enum_class_Integer);
-    VTABLE_set_integer_native(interp, temp, ICONST(2));
-
-    if (VTABLE_cmp(interp, PREG(1), temp) < 0) {
-        Parrot_pmc_free_temporary(interp, temp);return (opcode_t *)cur_opcode + ICONST(3);
+    FLOATVAL den = NCONST(3);
+    if (FLOAT_IS_ZERO(den)) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
+            EXCEPTION_DIV_BY_ZERO,
+            "Divide by zero");return (opcode_t *)handler;
     }
-
-    Parrot_pmc_free_temporary(interp, temp);
+    NREG(1) = NCONST(2) / den;
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_lt_p_n_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_div_p_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (VTABLE_get_number(interp, PREG(1)) < NREG(2)) {return (opcode_t *)cur_opcode + ICONST(3);
-    }
+    PREG(1) = VTABLE_divide(interp, PREG(2), PREG(3), PREG(1));
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_lt_p_nc_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_div_p_p_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (VTABLE_get_number(interp, PREG(1)) < NCONST(2)) {return (opcode_t *)cur_opcode + ICONST(3);
-    }
+    PREG(1) = VTABLE_divide_int(interp, PREG(2), IREG(3), PREG(1));
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_lt_p_s_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_div_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (STRING_compare(interp, VTABLE_get_string(interp, PREG(1)), SREG(2)) < 0) {return (opcode_t *)cur_opcode + ICONST(3);
-    }
+    PREG(1) = VTABLE_divide_int(interp, PREG(2), ICONST(3), PREG(1));
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_lt_p_sc_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_div_p_p_n(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (STRING_compare(interp, VTABLE_get_string(interp, PREG(1)), SCONST(2)) < 0) {return (opcode_t *)cur_opcode + ICONST(3);
-    }
+    PREG(1) = VTABLE_divide_float(interp, PREG(2), NREG(3), PREG(1));
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_lt_str_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_div_p_p_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (VTABLE_cmp_string(interp, PREG(1), PREG(2)) < 0) {return (opcode_t *)cur_opcode + ICONST(3);
-    }
+    PREG(1) = VTABLE_divide_float(interp, PREG(2), NCONST(3), PREG(1));
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_lt_num_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_fdiv_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (VTABLE_cmp_num(interp, PREG(1), PREG(2)) < 0) {return (opcode_t *)cur_opcode + ICONST(3);
+    INTVAL   den = IREG(2);
+    FLOATVAL f;
+
+    if (den == 0) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, cur_opcode + 3,
+            EXCEPTION_DIV_BY_ZERO,
+            "Divide by zero");return (opcode_t *)handler;
     }
 
-return (opcode_t *)cur_opcode + 4;}
+    f  = floor(((FLOATVAL)IREG(1)) / den);
+    IREG(1) = (INTVAL)f;
+
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_le_i_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_fdiv_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (IREG(1) <= IREG(2)) {return (opcode_t *)cur_opcode + ICONST(3);
+    INTVAL   den = ICONST(2);
+    FLOATVAL f;
+
+    if (den == 0) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, cur_opcode + 3,
+            EXCEPTION_DIV_BY_ZERO,
+            "Divide by zero");return (opcode_t *)handler;
     }
 
-return (opcode_t *)cur_opcode + 4;}
+    f  = floor(((FLOATVAL)IREG(1)) / den);
+    IREG(1) = (INTVAL)f;
+
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_le_ic_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_fdiv_n_n(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (ICONST(1) <= IREG(2)) {return (opcode_t *)cur_opcode + ICONST(3);
+    FLOATVAL den = NREG(2);
+    if (FLOAT_IS_ZERO(den)) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, cur_opcode + 3,
+            EXCEPTION_DIV_BY_ZERO,
+            "Divide by zero");return (opcode_t *)handler;
     }
+    NREG(1) = floor(NREG(1) / den);
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_le_i_ic_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_fdiv_n_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (IREG(1) <= ICONST(2)) {return (opcode_t *)cur_opcode + ICONST(3);
+    FLOATVAL den = NCONST(2);
+    if (FLOAT_IS_ZERO(den)) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, cur_opcode + 3,
+            EXCEPTION_DIV_BY_ZERO,
+            "Divide by zero");return (opcode_t *)handler;
     }
+    NREG(1) = floor(NREG(1) / den);
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_le_n_n_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_fdiv_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (NREG(1) <= NREG(2)) {return (opcode_t *)cur_opcode + ICONST(3);
-    }
+    VTABLE_i_floor_divide(interp, PREG(1), PREG(2));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_le_nc_n_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_fdiv_p_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (NCONST(1) <= NREG(2)) {return (opcode_t *)cur_opcode + ICONST(3);
-    }
+    VTABLE_i_floor_divide_int(interp, PREG(1), IREG(2));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_le_n_nc_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_fdiv_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (NREG(1) <= NCONST(2)) {return (opcode_t *)cur_opcode + ICONST(3);
-    }
+    VTABLE_i_floor_divide_int(interp, PREG(1), ICONST(2));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_le_s_s_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_fdiv_p_n(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (STRING_compare(interp, SREG(1), SREG(2)) <= 0) {return (opcode_t *)cur_opcode + ICONST(3);
-    }
+    VTABLE_i_floor_divide_float(interp, PREG(1), NREG(2));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_le_sc_s_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_fdiv_p_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (STRING_compare(interp, SCONST(1), SREG(2)) <= 0) {return (opcode_t *)cur_opcode + ICONST(3);
-    }
+    VTABLE_i_floor_divide_float(interp, PREG(1), NCONST(2));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_le_s_sc_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_fdiv_i_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (STRING_compare(interp, SREG(1), SCONST(2)) <= 0) {return (opcode_t *)cur_opcode + ICONST(3);
+    INTVAL   den = IREG(3);
+    FLOATVAL f;
+
+    if (den == 0) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
+            EXCEPTION_DIV_BY_ZERO,
+            "Divide by zero");return (opcode_t *)handler;
     }
 
+    f  = floor((FLOATVAL)IREG(2) / den);
+    IREG(1) = (INTVAL)f;
+
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_le_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_fdiv_i_ic_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (VTABLE_cmp(interp, PREG(1), PREG(2)) <= 0) {return (opcode_t *)cur_opcode + ICONST(3);
+    INTVAL   den = IREG(3);
+    FLOATVAL f;
+
+    if (den == 0) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
+            EXCEPTION_DIV_BY_ZERO,
+            "Divide by zero");return (opcode_t *)handler;
     }
 
+    f  = floor((FLOATVAL)ICONST(2) / den);
+    IREG(1) = (INTVAL)f;
+
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_le_p_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_fdiv_i_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const temp = Parrot_pmc_new_temporary(interp, enum_class_Integer);
-    VTABLE_set_integer_native(interp, temp, IREG(2));
+    INTVAL   den = ICONST(3);
+    FLOATVAL f;
 
-    if (VTABLE_cmp(interp, PREG(1), temp) <= 0) {
-        Parrot_pmc_free_temporary(interp, temp);return (opcode_t *)cur_opcode + ICONST(3);
+    if (den == 0) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
+            EXCEPTION_DIV_BY_ZERO,
+            "Divide by zero");return (opcode_t *)handler;
     }
 
-    Parrot_pmc_free_temporary(interp, temp);
+    f  = floor((FLOATVAL)IREG(2) / den);
+    IREG(1) = (INTVAL)f;
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_le_p_ic_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_fdiv_n_n_n(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const temp = Parrot_pmc_new_temporary(interp, enum_class_Integer);
-    VTABLE_set_integer_native(interp, temp, ICONST(2));
-
-    if (VTABLE_cmp(interp, PREG(1), temp) <= 0) {
-        Parrot_pmc_free_temporary(interp, temp);return (opcode_t *)cur_opcode + ICONST(3);
+    FLOATVAL den = NREG(3);
+    if (FLOAT_IS_ZERO(den)) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
+            EXCEPTION_DIV_BY_ZERO,
+            "Divide by zero");return (opcode_t *)handler;
     }
-
-    Parrot_pmc_free_temporary(interp, temp);
+    NREG(1) = floor(NREG(2) / den);
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_le_p_n_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_fdiv_n_nc_n(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (VTABLE_get_number(interp, PREG(1)) <= NREG(2)) {return (opcode_t *)cur_opcode + ICONST(3);
+    FLOATVAL den = NREG(3);
+    if (FLOAT_IS_ZERO(den)) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
+            EXCEPTION_DIV_BY_ZERO,
+            "Divide by zero");return (opcode_t *)handler;
     }
+    NREG(1) = floor(NCONST(2) / den);
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_le_p_nc_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_fdiv_n_n_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (VTABLE_get_number(interp, PREG(1)) <= NCONST(2)) {return (opcode_t *)cur_opcode + ICONST(3);
+    FLOATVAL den = NCONST(3);
+    if (FLOAT_IS_ZERO(den)) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
+            EXCEPTION_DIV_BY_ZERO,
+            "Divide by zero");return (opcode_t *)handler;
     }
+    NREG(1) = floor(NREG(2) / den);
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_le_p_s_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_fdiv_p_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (STRING_compare(interp, VTABLE_get_string(interp, PREG(1)), SREG(2)) <= 0) {return (opcode_t *)cur_opcode + ICONST(3);
-    }
+    PREG(1) = VTABLE_floor_divide(interp, PREG(2), PREG(3), PREG(1));
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_le_p_sc_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_fdiv_p_p_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (STRING_compare(interp, VTABLE_get_string(interp, PREG(1)), SCONST(2)) <= 0) {return (opcode_t *)cur_opcode + ICONST(3);
-    }
+    PREG(1) = VTABLE_floor_divide_int(interp, PREG(2), IREG(3), PREG(1));
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_le_str_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_fdiv_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (VTABLE_cmp_string(interp, PREG(1), PREG(2)) <= 0) {return (opcode_t *)cur_opcode + ICONST(3);
-    }
+    PREG(1) = VTABLE_floor_divide_int(interp, PREG(2), ICONST(3), PREG(1));
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_le_num_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_fdiv_p_p_n(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (VTABLE_cmp_num(interp, PREG(1), PREG(2)) <= 0) {return (opcode_t *)cur_opcode + ICONST(3);
-    }
+    PREG(1) = VTABLE_floor_divide_float(interp, PREG(2), NREG(3), PREG(1));
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_gt_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_fdiv_p_p_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (VTABLE_cmp(interp, PREG(1), PREG(2)) > 0) {return (opcode_t *)cur_opcode + ICONST(3);
-    }
+    PREG(1) = VTABLE_floor_divide_float(interp, PREG(2), NCONST(3), PREG(1));
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_gt_p_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_ceil_n(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    NREG(1) = ceil(NREG(1));
+
+return (opcode_t *)cur_opcode + 2;}
+
+opcode_t *
+Parrot_ceil_i_n(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    FLOATVAL f = ceil(NREG(2));
+    IREG(1)         = (INTVAL)f;
+
+return (opcode_t *)cur_opcode + 3;}
+
+opcode_t *
+Parrot_ceil_n_n(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const temp = Parrot_pmc_new_temporary(interp, enum_class_Integer);
-    VTABLE_set_integer_native(interp, temp, IREG(2));
-
-    if (VTABLE_cmp(interp, PREG(1), temp) > 0) {
-        Parrot_pmc_free_temporary(interp, temp);return (opcode_t *)cur_opcode + ICONST(3);
-    }
-
-    Parrot_pmc_free_temporary(interp, temp);
+    NREG(1) = ceil(NREG(2));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_gt_p_ic_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_floor_n(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const temp = Parrot_pmc_new_temporary(interp, enum_class_Integer);
-    VTABLE_set_integer_native(interp, temp, ICONST(2));
+    NREG(1) = floor(NREG(1));
 
-    if (VTABLE_cmp(interp, PREG(1), temp) > 0) {
-        Parrot_pmc_free_temporary(interp, temp);return (opcode_t *)cur_opcode + ICONST(3);
-    }
+return (opcode_t *)cur_opcode + 2;}
 
-    Parrot_pmc_free_temporary(interp, temp);
+opcode_t *
+Parrot_floor_i_n(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    FLOATVAL f = floor(NREG(2));
+    IREG(1)         = (INTVAL)f;
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_gt_p_n_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_floor_n_n(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (VTABLE_get_number(interp, PREG(1)) > NREG(2)) {return (opcode_t *)cur_opcode + ICONST(3);
-    }
+    NREG(1) = floor(NREG(2));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_gt_p_nc_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_inc_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (VTABLE_get_number(interp, PREG(1)) > NCONST(2)) {return (opcode_t *)cur_opcode + ICONST(3);
-    }
+    IREG(1)++;
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 2;}
 
 opcode_t *
-Parrot_gt_p_s_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_inc_n(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (STRING_compare(interp, VTABLE_get_string(interp, PREG(1)), SREG(2)) > 0) {return (opcode_t *)cur_opcode + ICONST(3);
-    }
+    NREG(1)++;
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 2;}
 
 opcode_t *
-Parrot_gt_p_sc_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_inc_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (STRING_compare(interp, VTABLE_get_string(interp, PREG(1)), SCONST(2)) > 0) {return (opcode_t *)cur_opcode + ICONST(3);
-    }
+    VTABLE_increment(interp, PREG(1));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 2;}
 
 opcode_t *
-Parrot_gt_str_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_mod_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (VTABLE_cmp_string(interp, PREG(1), PREG(2)) > 0) {return (opcode_t *)cur_opcode + ICONST(3);
-    }
+    IREG(1) = Parrot_util_intval_mod(IREG(1), IREG(2));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_gt_num_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_mod_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (VTABLE_cmp_num(interp, PREG(1), PREG(2)) > 0) {return (opcode_t *)cur_opcode + ICONST(3);
-    }
+    IREG(1) = Parrot_util_intval_mod(IREG(1), ICONST(2));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_ge_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_mod_n_n(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (VTABLE_cmp(interp, PREG(1), PREG(2)) >= 0) {return (opcode_t *)cur_opcode + ICONST(3);
-    }
+    NREG(1) = Parrot_util_floatval_mod(NREG(1), NREG(2));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_ge_p_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_mod_n_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const temp = Parrot_pmc_new_temporary(interp, enum_class_Integer);
-    VTABLE_set_integer_native(interp, temp, IREG(2));
+    NREG(1) = Parrot_util_floatval_mod(NREG(1), NCONST(2));
 
-    if (VTABLE_cmp(interp, PREG(1), temp) >= 0) {
-        Parrot_pmc_free_temporary(interp, temp);return (opcode_t *)cur_opcode + ICONST(3);
-    }
+return (opcode_t *)cur_opcode + 3;}
 
-    Parrot_pmc_free_temporary(interp, temp);
+opcode_t *
+Parrot_mod_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_i_modulus(interp, PREG(1), PREG(2));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_ge_p_ic_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_mod_p_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const temp = Parrot_pmc_new_temporary(interp, enum_class_Integer);
-    VTABLE_set_integer_native(interp, temp, ICONST(2));
+    VTABLE_i_modulus_int(interp, PREG(1), IREG(2));
 
-    if (VTABLE_cmp(interp, PREG(1), temp) >= 0) {
-        Parrot_pmc_free_temporary(interp, temp);return (opcode_t *)cur_opcode + ICONST(3);
-    }
+return (opcode_t *)cur_opcode + 3;}
 
-    Parrot_pmc_free_temporary(interp, temp);
+opcode_t *
+Parrot_mod_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_i_modulus_int(interp, PREG(1), ICONST(2));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_ge_p_n_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_mod_p_n(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (VTABLE_get_number(interp, PREG(1)) >= NREG(2)) {return (opcode_t *)cur_opcode + ICONST(3);
-    }
+    VTABLE_i_modulus_float(interp, PREG(1), NREG(2));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_ge_p_nc_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_mod_p_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (VTABLE_get_number(interp, PREG(1)) >= NCONST(2)) {return (opcode_t *)cur_opcode + ICONST(3);
-    }
+    VTABLE_i_modulus_float(interp, PREG(1), NCONST(2));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_ge_p_s_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_mod_i_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (STRING_compare(interp, VTABLE_get_string(interp, PREG(1)), SREG(2)) >= 0) {return (opcode_t *)cur_opcode + ICONST(3);
-    }
+    IREG(1) = Parrot_util_intval_mod(IREG(2), IREG(3));
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_ge_p_sc_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_mod_i_ic_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (STRING_compare(interp, VTABLE_get_string(interp, PREG(1)), SCONST(2)) >= 0) {return (opcode_t *)cur_opcode + ICONST(3);
-    }
+    IREG(1) = Parrot_util_intval_mod(ICONST(2), IREG(3));
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_ge_str_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_mod_i_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (VTABLE_cmp_string(interp, PREG(1), PREG(2)) >= 0) {return (opcode_t *)cur_opcode + ICONST(3);
-    }
+    IREG(1) = Parrot_util_intval_mod(IREG(2), ICONST(3));
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_ge_num_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_mod_n_n_n(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (VTABLE_cmp_num(interp, PREG(1), PREG(2)) >= 0) {return (opcode_t *)cur_opcode + ICONST(3);
-    }
+    NREG(1) = Parrot_util_floatval_mod(NREG(2), NREG(3));
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_if_null_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_mod_n_nc_n(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (PMC_IS_NULL(PREG(1))) {return (opcode_t *)cur_opcode + ICONST(2);
-    }
+    NREG(1) = Parrot_util_floatval_mod(NCONST(2), NREG(3));
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_if_null_s_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_mod_n_n_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (STRING_IS_NULL(SREG(1))) {return (opcode_t *)cur_opcode + ICONST(2);
-    }
+    NREG(1) = Parrot_util_floatval_mod(NREG(2), NCONST(3));
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_unless_null_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_mod_p_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (!PMC_IS_NULL(PREG(1))) {return (opcode_t *)cur_opcode + ICONST(2);
-    }
+    PREG(1) = VTABLE_modulus(interp, PREG(2), PREG(3), PREG(1));
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_unless_null_s_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_mod_p_p_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (!STRING_IS_NULL(SREG(1))) {return (opcode_t *)cur_opcode + ICONST(2);
-    }
+    PREG(1) = VTABLE_modulus_int(interp, PREG(2), IREG(3), PREG(1));
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_cmp_i_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_mod_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = IREG(2) < IREG(3) ? -1 :
-         IREG(2) > IREG(3) ? +1 :
-         0;
+    PREG(1) = VTABLE_modulus_int(interp, PREG(2), ICONST(3), PREG(1));
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_cmp_i_ic_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_mod_p_p_n(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = ICONST(2) < IREG(3) ? -1 :
-         ICONST(2) > IREG(3) ? +1 :
-         0;
+    PREG(1) = VTABLE_modulus_float(interp, PREG(2), NREG(3), PREG(1));
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_cmp_i_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_mod_p_p_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = IREG(2) < ICONST(3) ? -1 :
-         IREG(2) > ICONST(3) ? +1 :
-         0;
+    PREG(1) = VTABLE_modulus_float(interp, PREG(2), NCONST(3), PREG(1));
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_cmp_i_n_n(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_mul_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = NREG(2) < NREG(3) ? -1 :
-         NREG(2) > NREG(3) ? +1 :
-         0;
+    IREG(1) *= IREG(2);
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_cmp_i_nc_n(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_mul_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = NCONST(2) < NREG(3) ? -1 :
-         NCONST(2) > NREG(3) ? +1 :
-         0;
+    IREG(1) *= ICONST(2);
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_cmp_i_n_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_mul_n_n(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = NREG(2) < NCONST(3) ? -1 :
-         NREG(2) > NCONST(3) ? +1 :
-         0;
+    NREG(1) *= NREG(2);
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_cmp_i_s_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_mul_n_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = STRING_compare(interp, SREG(2), SREG(3));
+    NREG(1) *= NCONST(2);
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_cmp_i_sc_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_mul_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = STRING_compare(interp, SCONST(2), SREG(3));
+    VTABLE_i_multiply(interp, PREG(1), PREG(2));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_cmp_i_s_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_mul_p_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = STRING_compare(interp, SREG(2), SCONST(3));
+    VTABLE_i_multiply_int(interp, PREG(1), IREG(2));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_cmp_i_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_mul_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = VTABLE_cmp(interp, PREG(2), PREG(3));
+    VTABLE_i_multiply_int(interp, PREG(1), ICONST(2));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_cmp_i_p_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_mul_p_n(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    const INTVAL l = VTABLE_get_integer(interp, PREG(2));
-    IREG(1) = l < IREG(3) ? -1 :
-         l > IREG(3) ? +1 :
-         0;
+    VTABLE_i_multiply_float(interp, PREG(1), NREG(2));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_cmp_i_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_mul_p_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    const INTVAL l = VTABLE_get_integer(interp, PREG(2));
-    IREG(1) = l < ICONST(3) ? -1 :
-         l > ICONST(3) ? +1 :
-         0;
+    VTABLE_i_multiply_float(interp, PREG(1), NCONST(2));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_cmp_i_p_n(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_mul_i_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    const FLOATVAL l = VTABLE_get_number(interp, PREG(2));
-    IREG(1) = l < NREG(3) ? -1 :
-         l > NREG(3) ? +1 :
-         0;
+    IREG(1) = IREG(2) * IREG(3);
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_cmp_i_p_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_mul_i_ic_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    const FLOATVAL l = VTABLE_get_number(interp, PREG(2));
-    IREG(1) = l < NCONST(3) ? -1 :
-         l > NCONST(3) ? +1 :
-         0;
+    IREG(1) = ICONST(2) * IREG(3);
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_cmp_i_p_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_mul_i_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    STRING* const l = VTABLE_get_string(interp, PREG(2));
-    IREG(1) = STRING_compare(interp, l, SREG(3));
+    IREG(1) = IREG(2) * ICONST(3);
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_cmp_i_p_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_mul_n_n_n(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    STRING* const l = VTABLE_get_string(interp, PREG(2));
-    IREG(1) = STRING_compare(interp, l, SCONST(3));
+    NREG(1) = NREG(2) * NREG(3);
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_cmp_str_i_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_mul_n_nc_n(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = VTABLE_cmp_string(interp, PREG(2), PREG(3));
+    NREG(1) = NCONST(2) * NREG(3);
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_cmp_num_i_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_mul_n_n_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = VTABLE_cmp_num(interp, PREG(2), PREG(3));
+    NREG(1) = NREG(2) * NCONST(3);
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_cmp_pmc_p_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_mul_p_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_cmp_pmc(interp, PREG(2), PREG(3));
+    PREG(1) = VTABLE_multiply(interp, PREG(2), PREG(3), PREG(1));
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_issame_i_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_mul_p_p_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (PREG(2) == PREG(3))
-        IREG(1) = 1;
-    else
-        IREG(1) = VTABLE_is_same(interp, PREG(2), PREG(3));
+    PREG(1) = VTABLE_multiply_int(interp, PREG(2), IREG(3), PREG(1));
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_issame_i_s_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_mul_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = SREG(2) == SREG(3);
+    PREG(1) = VTABLE_multiply_int(interp, PREG(2), ICONST(3), PREG(1));
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_issame_i_sc_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_mul_p_p_n(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = SCONST(2) == SREG(3);
+    PREG(1) = VTABLE_multiply_float(interp, PREG(2), NREG(3), PREG(1));
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_issame_i_s_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_mul_p_p_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = SREG(2) == SCONST(3);
+    PREG(1) = VTABLE_multiply_float(interp, PREG(2), NCONST(3), PREG(1));
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_issame_i_sc_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_neg_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = SCONST(2) == SCONST(3);
+    IREG(1) = - IREG(1);
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 2;}
 
 opcode_t *
-Parrot_isntsame_i_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_neg_n(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (PREG(2) == PREG(3))
-        IREG(1) = 0;
-    else
-        IREG(1) = !VTABLE_is_same(interp, PREG(2), PREG(3));
+    NREG(1) = - NREG(1);
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 2;}
 
 opcode_t *
-Parrot_isntsame_i_s_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_neg_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = SREG(2) != SREG(3);
+    VTABLE_i_neg(interp, PREG(1));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 2;}
 
 opcode_t *
-Parrot_isntsame_i_sc_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_neg_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = SCONST(2) != SREG(3);
+    IREG(1) = - IREG(2);
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_isntsame_i_s_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_neg_n_n(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = SREG(2) != SCONST(3);
+    NREG(1) = - NREG(2);
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_isntsame_i_sc_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_neg_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = SCONST(2) != SCONST(3);
+    PREG(1) = VTABLE_neg(interp, PREG(2), PREG(1));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_istrue_i_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_sub_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = VTABLE_get_bool(interp, PREG(2));
+    IREG(1) -= IREG(2);
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_isfalse_i_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_sub_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = !VTABLE_get_bool(interp, PREG(2));
+    IREG(1) -= ICONST(2);
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_isnull_i_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_sub_n_n(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = PMC_IS_NULL(PREG(2));
+    NREG(1) -= NREG(2);
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_isnull_i_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_sub_n_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = PMC_IS_NULL(PCONST(2));
+    NREG(1) -= NCONST(2);
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_isnull_i_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_sub_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = STRING_IS_NULL(SREG(2));
+    VTABLE_i_subtract(interp, PREG(1), PREG(2));
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_isnull_i_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_sub_p_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = STRING_IS_NULL(SCONST(2));
+    VTABLE_i_subtract_int(interp, PREG(1), IREG(2));
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_isgt_i_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_sub_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = (VTABLE_cmp(interp, PREG(2), PREG(3)) > 0);
+    VTABLE_i_subtract_int(interp, PREG(1), ICONST(2));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_isge_i_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_sub_p_n(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = (VTABLE_cmp(interp, PREG(2), PREG(3)) >= 0);
+    VTABLE_i_subtract_float(interp, PREG(1), NREG(2));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_isle_i_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_sub_p_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = IREG(2) <= IREG(3);
+    VTABLE_i_subtract_float(interp, PREG(1), NCONST(2));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_isle_i_ic_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_sub_i_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = ICONST(2) <= IREG(3);
+    IREG(1) = IREG(2) - IREG(3);
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_isle_i_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_sub_i_ic_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = IREG(2) <= ICONST(3);
+    IREG(1) = ICONST(2) - IREG(3);
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_isle_i_n_n(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_sub_i_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = NREG(2) <= NREG(3);
+    IREG(1) = IREG(2) - ICONST(3);
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_isle_i_nc_n(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_sub_n_n_n(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = NCONST(2) <= NREG(3);
+    NREG(1) = NREG(2) - NREG(3);
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_isle_i_n_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_sub_n_nc_n(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = NREG(2) <= NCONST(3);
+    NREG(1) = NCONST(2) - NREG(3);
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_isle_i_s_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_sub_n_n_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = STRING_compare(interp, SREG(2), SREG(3)) <= 0;
+    NREG(1) = NREG(2) - NCONST(3);
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_isle_i_sc_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_sub_p_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = STRING_compare(interp, SCONST(2), SREG(3)) <= 0;
+    PREG(1) = VTABLE_subtract(interp, PREG(2), PREG(3), PREG(1));
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_isle_i_s_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_sub_p_p_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = STRING_compare(interp, SREG(2), SCONST(3)) <= 0;
+    PREG(1) = VTABLE_subtract_int(interp, PREG(2), IREG(3), PREG(1));
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_isle_i_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_sub_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = (VTABLE_cmp(interp, PREG(2), PREG(3)) <= 0);
+    PREG(1) = VTABLE_subtract_int(interp, PREG(2), ICONST(3), PREG(1));
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_islt_i_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_sub_p_p_n(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = (IREG(2) < IREG(3)) ? 1 : 0;
+    PREG(1) = VTABLE_subtract_float(interp, PREG(2), NREG(3), PREG(1));
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_islt_i_ic_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_sub_p_p_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = (ICONST(2) < IREG(3)) ? 1 : 0;
+    PREG(1) = VTABLE_subtract_float(interp, PREG(2), NCONST(3), PREG(1));
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_islt_i_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_sqrt_n_n(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = (IREG(2) < ICONST(3)) ? 1 : 0;
+    NREG(1) = sqrt((FLOATVAL)NREG(2));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_islt_i_n_n(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_callmethodcc_p_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = NREG(2) < NREG(3);
+    PMC      * const object     = PREG(1);
+    STRING   * const meth       = SREG(2);
+    opcode_t * const next       = cur_opcode + 3;
 
-return (opcode_t *)cur_opcode + 4;}
+    PMC      * const method_pmc =
+        Parrot_find_method_inline_cached(interp, object, meth, CUR_OPCODE);
+    opcode_t *dest              = NULL;
+
+    Parrot_pcc_set_pc_func(interp, CURRENT_CONTEXT(interp), next);
+
+    if (!PMC_IS_NULL(method_pmc)) {
+        PMC * const signature = Parrot_pcc_get_signature(interp,
+                                    CURRENT_CONTEXT(interp));
+        if (!PMC_IS_NULL(signature))
+            Parrot_pcc_set_object(interp, signature, object);
+
+        interp->current_cont = NEED_CONTINUATION;
+        Parrot_pcc_prepare_args(interp, CURRENT_CONTEXT(interp), method_pmc);
+        dest                 = VTABLE_invoke(interp, method_pmc, next);
+    }
+    else {
+        PMC * const _class = VTABLE_get_class(interp, object);
+        if (PMC_IS_NULL(_class)) {
+            dest = Parrot_ex_throw_from_op_args(interp, next,
+                EXCEPTION_METHOD_NOT_FOUND,
+                "Method '%Ss' not found for non-object", meth);
+        }
+        else {
+            dest = Parrot_ex_throw_from_op_args(interp, next,
+                EXCEPTION_METHOD_NOT_FOUND,
+                "Method '%Ss' not found for invocant of class '%Ss'", meth,
+                VTABLE_get_string(interp, _class));
+        }
+    }return (opcode_t *)dest;
+}
 
 opcode_t *
-Parrot_islt_i_nc_n(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_callmethodcc_p_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = NCONST(2) < NREG(3);
+    PMC      * const object     = PREG(1);
+    STRING   * const meth       = SCONST(2);
+    opcode_t * const next       = cur_opcode + 3;
 
-return (opcode_t *)cur_opcode + 4;}
+    PMC      * const method_pmc =
+        Parrot_find_method_inline_cached(interp, object, meth, CUR_OPCODE);
+    opcode_t *dest              = NULL;
+
+    Parrot_pcc_set_pc_func(interp, CURRENT_CONTEXT(interp), next);
+
+    if (!PMC_IS_NULL(method_pmc)) {
+        PMC * const signature = Parrot_pcc_get_signature(interp,
+                                    CURRENT_CONTEXT(interp));
+        if (!PMC_IS_NULL(signature))
+            Parrot_pcc_set_object(interp, signature, object);
+
+        interp->current_cont = NEED_CONTINUATION;
+        Parrot_pcc_prepare_args(interp, CURRENT_CONTEXT(interp), method_pmc);
+        dest                 = VTABLE_invoke(interp, method_pmc, next);
+    }
+    else {
+        PMC * const _class = VTABLE_get_class(interp, object);
+        if (PMC_IS_NULL(_class)) {
+            dest = Parrot_ex_throw_from_op_args(interp, next,
+                EXCEPTION_METHOD_NOT_FOUND,
+                "Method '%Ss' not found for non-object", meth);
+        }
+        else {
+            dest = Parrot_ex_throw_from_op_args(interp, next,
+                EXCEPTION_METHOD_NOT_FOUND,
+                "Method '%Ss' not found for invocant of class '%Ss'", meth,
+                VTABLE_get_string(interp, _class));
+        }
+    }return (opcode_t *)dest;
+}
 
 opcode_t *
-Parrot_islt_i_n_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_callmethodcc_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = NREG(2) < NCONST(3);
-
-return (opcode_t *)cur_opcode + 4;}
+    opcode_t        *dest;
+    opcode_t * const next  = cur_opcode + 3;
+    PMC      *       signature  = Parrot_pcc_get_signature(interp,
+                                    CURRENT_CONTEXT(interp));
 
-opcode_t *
-Parrot_islt_i_s_s(opcode_t *cur_opcode, PARROT_INTERP)  {
-    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = STRING_compare(interp, SREG(2), SREG(3)) < 0;
+    Parrot_pcc_set_pc_func(interp, CURRENT_CONTEXT(interp), next);
 
-return (opcode_t *)cur_opcode + 4;}
+    if (!PMC_IS_NULL(signature))
+        Parrot_pcc_set_object(interp, signature, PREG(1));
+    interp->current_cont   = NEED_CONTINUATION;
+    Parrot_pcc_prepare_args(interp, CURRENT_CONTEXT(interp), PREG(2));
+    dest                   = VTABLE_invoke(interp, PREG(2), next);return (opcode_t *)dest;
+}
 
 opcode_t *
-Parrot_islt_i_sc_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_callmethod_p_s_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = STRING_compare(interp, SCONST(2), SREG(3)) < 0;
+    PMC      * const object     = PREG(1);
+    STRING   * const meth       = SREG(2);
+    opcode_t * const next       = cur_opcode + 4;
 
-return (opcode_t *)cur_opcode + 4;}
+    PMC      * const method_pmc =
+        Parrot_find_method_inline_cached(interp, object, meth, CUR_OPCODE);
+    opcode_t *dest              = NULL;
+    PMC      *       signature  = Parrot_pcc_get_signature(interp,
+                                    CURRENT_CONTEXT(interp));
 
-opcode_t *
-Parrot_islt_i_s_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
-    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = STRING_compare(interp, SREG(2), SCONST(3)) < 0;
+    Parrot_pcc_set_pc_func(interp, CURRENT_CONTEXT(interp), next);
 
-return (opcode_t *)cur_opcode + 4;}
+    if (PMC_IS_NULL(method_pmc)) {
+        dest = Parrot_ex_throw_from_op_args(interp, next, EXCEPTION_METHOD_NOT_FOUND,
+            "Method '%Ss' not found for invocant of class '%Ss'", meth,
+            VTABLE_get_string(interp, VTABLE_get_class(interp, object)));
+    }
+    else {
+        if (!PMC_IS_NULL(signature))
+            Parrot_pcc_set_object(interp, signature, object);
+        interp->current_cont = PREG(3);
+        Parrot_pcc_prepare_args(interp, CURRENT_CONTEXT(interp), method_pmc);
+        dest = (opcode_t *)VTABLE_invoke(interp, method_pmc, next);
+    }return (opcode_t *)dest;
+}
 
 opcode_t *
-Parrot_islt_i_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_callmethod_p_sc_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = (VTABLE_cmp(interp, PREG(2), PREG(3)) < 0);
+    PMC      * const object     = PREG(1);
+    STRING   * const meth       = SCONST(2);
+    opcode_t * const next       = cur_opcode + 4;
 
-return (opcode_t *)cur_opcode + 4;}
+    PMC      * const method_pmc =
+        Parrot_find_method_inline_cached(interp, object, meth, CUR_OPCODE);
+    opcode_t *dest              = NULL;
+    PMC      *       signature  = Parrot_pcc_get_signature(interp,
+                                    CURRENT_CONTEXT(interp));
 
-opcode_t *
-Parrot_iseq_i_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
-    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = (IREG(2) == IREG(3)) ? 1 : 0;
+    Parrot_pcc_set_pc_func(interp, CURRENT_CONTEXT(interp), next);
 
-return (opcode_t *)cur_opcode + 4;}
+    if (PMC_IS_NULL(method_pmc)) {
+        dest = Parrot_ex_throw_from_op_args(interp, next, EXCEPTION_METHOD_NOT_FOUND,
+            "Method '%Ss' not found for invocant of class '%Ss'", meth,
+            VTABLE_get_string(interp, VTABLE_get_class(interp, object)));
+    }
+    else {
+        if (!PMC_IS_NULL(signature))
+            Parrot_pcc_set_object(interp, signature, object);
+        interp->current_cont = PREG(3);
+        Parrot_pcc_prepare_args(interp, CURRENT_CONTEXT(interp), method_pmc);
+        dest = (opcode_t *)VTABLE_invoke(interp, method_pmc, next);
+    }return (opcode_t *)dest;
+}
 
 opcode_t *
-Parrot_iseq_i_ic_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_callmethod_p_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = (ICONST(2) == IREG(3)) ? 1 : 0;
+    PMC      * const object     = PREG(1);
+    PMC      * const method_pmc = PREG(2);
+    opcode_t * const next       = cur_opcode + 4;
 
-return (opcode_t *)cur_opcode + 4;}
+    opcode_t *dest;
+    PMC      *       signature  = Parrot_pcc_get_signature(interp,
+                                    CURRENT_CONTEXT(interp));
 
-opcode_t *
-Parrot_iseq_i_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
-    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = (IREG(2) == ICONST(3)) ? 1 : 0;
+    Parrot_pcc_set_pc_func(interp, CURRENT_CONTEXT(interp), next);
 
-return (opcode_t *)cur_opcode + 4;}
+    if (!PMC_IS_NULL(signature))
+        Parrot_pcc_set_object(interp, signature, object);
+    interp->current_cont = PREG(3);
+    Parrot_pcc_prepare_args(interp, CURRENT_CONTEXT(interp), method_pmc);
+    dest = (opcode_t *)VTABLE_invoke(interp, method_pmc, next);return (opcode_t *)dest;
+}
 
 opcode_t *
-Parrot_iseq_i_n_n(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_tailcallmethod_p_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = NREG(2) == NREG(3);
-
-return (opcode_t *)cur_opcode + 4;}
+    opcode_t * const next       = cur_opcode + 3;
+    PMC      * const object     = PREG(1);
+    STRING   * const meth       = SREG(2);
+    PMC      * const method_pmc =
+        Parrot_find_method_inline_cached(interp, object, meth, CUR_OPCODE);
 
-opcode_t *
-Parrot_iseq_i_nc_n(opcode_t *cur_opcode, PARROT_INTERP)  {
-    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = NCONST(2) == NREG(3);
+    opcode_t *dest;
+    PMC      *       signature  = Parrot_pcc_get_signature(interp,
+                                    CURRENT_CONTEXT(interp));
 
-return (opcode_t *)cur_opcode + 4;}
+    if (PMC_IS_NULL(method_pmc)) {
+        dest = Parrot_ex_throw_from_op_args(interp, next, EXCEPTION_METHOD_NOT_FOUND,
+            "Method '%Ss' not found for invocant of class '%Ss'", meth,
+            VTABLE_get_string(interp, VTABLE_get_class(interp, object)));
+    }
+    else {
+        interp->current_cont = Parrot_pcc_get_continuation(interp, CURRENT_CONTEXT(interp));
+        PObj_get_FLAGS(interp->current_cont) |= SUB_FLAG_TAILCALL;
+        if (!PMC_IS_NULL(signature))
+            Parrot_pcc_set_object(interp, signature, object);
+        Parrot_pcc_prepare_args(interp, CURRENT_CONTEXT(interp), method_pmc);
+        dest = (opcode_t *)VTABLE_invoke(interp, method_pmc, next);
+    }return (opcode_t *)dest;
+}
 
 opcode_t *
-Parrot_iseq_i_n_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_tailcallmethod_p_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = NREG(2) == NCONST(3);
+    opcode_t * const next       = cur_opcode + 3;
+    PMC      * const object     = PREG(1);
+    STRING   * const meth       = SCONST(2);
+    PMC      * const method_pmc =
+        Parrot_find_method_inline_cached(interp, object, meth, CUR_OPCODE);
 
-return (opcode_t *)cur_opcode + 4;}
+    opcode_t *dest;
+    PMC      *       signature  = Parrot_pcc_get_signature(interp,
+                                    CURRENT_CONTEXT(interp));
+
+    if (PMC_IS_NULL(method_pmc)) {
+        dest = Parrot_ex_throw_from_op_args(interp, next, EXCEPTION_METHOD_NOT_FOUND,
+            "Method '%Ss' not found for invocant of class '%Ss'", meth,
+            VTABLE_get_string(interp, VTABLE_get_class(interp, object)));
+    }
+    else {
+        interp->current_cont = Parrot_pcc_get_continuation(interp, CURRENT_CONTEXT(interp));
+        PObj_get_FLAGS(interp->current_cont) |= SUB_FLAG_TAILCALL;
+        if (!PMC_IS_NULL(signature))
+            Parrot_pcc_set_object(interp, signature, object);
+        Parrot_pcc_prepare_args(interp, CURRENT_CONTEXT(interp), method_pmc);
+        dest = (opcode_t *)VTABLE_invoke(interp, method_pmc, next);
+    }return (opcode_t *)dest;
+}
 
 opcode_t *
-Parrot_iseq_i_s_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_tailcallmethod_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = STRING_equal(interp, SREG(2), SREG(3));
+    opcode_t * const next       = cur_opcode + 3;
+    PMC      * const object     = PREG(1);
+    PMC      * const method_pmc = PREG(2);
 
-return (opcode_t *)cur_opcode + 4;}
+    opcode_t *dest;
+    PMC      *       signature  = Parrot_pcc_get_signature(interp,
+                                    CURRENT_CONTEXT(interp));
 
-opcode_t *
-Parrot_iseq_i_sc_s(opcode_t *cur_opcode, PARROT_INTERP)  {
-    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = STRING_equal(interp, SCONST(2), SREG(3));
+    interp->current_cont = Parrot_pcc_get_continuation(interp, CURRENT_CONTEXT(interp));
+    PObj_get_FLAGS(interp->current_cont) |= SUB_FLAG_TAILCALL;
 
-return (opcode_t *)cur_opcode + 4;}
+    if (!PMC_IS_NULL(signature))
+        Parrot_pcc_set_object(interp, signature, object);
+    Parrot_pcc_prepare_args(interp, CURRENT_CONTEXT(interp), method_pmc);
+    dest = (opcode_t *)VTABLE_invoke(interp, method_pmc, next);return (opcode_t *)dest;
+}
 
 opcode_t *
-Parrot_iseq_i_s_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_addmethod_p_s_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = STRING_equal(interp, SREG(2), SCONST(3));
+    VTABLE_add_method(interp, PREG(1), SREG(2), PREG(3));
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_iseq_i_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_addmethod_p_sc_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (&PREG(2) == &PREG(3))
-        IREG(1) = 1;
-    else
-        IREG(1) = VTABLE_is_equal(interp, PREG(2), PREG(3));
+    VTABLE_add_method(interp, PREG(1), SCONST(2), PREG(3));
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_isne_i_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_can_i_p_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = (IREG(2) == IREG(3)) ? 0 : 1;
+    IREG(1) = VTABLE_can(interp, PREG(2), SREG(3));
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_isne_i_ic_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_can_i_p_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = (ICONST(2) == IREG(3)) ? 0 : 1;
+    IREG(1) = VTABLE_can(interp, PREG(2), SCONST(3));
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_isne_i_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_does_i_p_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = (IREG(2) == ICONST(3)) ? 0 : 1;
+    IREG(1) = SREG(3) ? VTABLE_does(interp, PREG(2), SREG(3)) : 0;
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_isne_i_n_n(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_does_i_p_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = NREG(2) != NREG(3);
+    IREG(1) = SCONST(3) ? VTABLE_does(interp, PREG(2), SCONST(3)) : 0;
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_isne_i_nc_n(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_does_i_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = NCONST(2) != NREG(3);
+    IREG(1) = PREG(3) ? VTABLE_does_pmc(interp, PREG(2), PREG(3)) : 0;
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_isne_i_n_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_does_i_p_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = NREG(2) != NCONST(3);
+    IREG(1) = PCONST(3) ? VTABLE_does_pmc(interp, PREG(2), PCONST(3)) : 0;
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_isne_i_s_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_isa_i_p_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = !STRING_equal(interp, SREG(2), SREG(3));
+    IREG(1) = SREG(3) ? VTABLE_isa(interp, PREG(2), SREG(3)) : 0;
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_isne_i_sc_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_isa_i_p_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = !STRING_equal(interp, SCONST(2), SREG(3));
+    IREG(1) = SCONST(3) ? VTABLE_isa(interp, PREG(2), SCONST(3)) : 0;
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_isne_i_s_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_isa_i_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = !STRING_equal(interp, SREG(2), SCONST(3));
+    IREG(1) = PREG(3) ? VTABLE_isa_pmc(interp, PREG(2), PREG(3)) : 0;
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_isne_i_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_isa_i_p_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (&PREG(2) == &PREG(3))
-        IREG(1) = 0;
-    else
-        IREG(1) = !VTABLE_is_equal(interp, PREG(2), PREG(3));
+    IREG(1) = PCONST(3) ? VTABLE_isa_pmc(interp, PREG(2), PCONST(3)) : 0;
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_and_i_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_newclass_p_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = IREG(2) ? IREG(3) : IREG(2);
+    PMC * const name = Parrot_pmc_new(interp, enum_class_String);
+    VTABLE_set_string_native(interp, name, SREG(2));
+    PREG(1) = Parrot_pmc_new_init(interp, enum_class_Class, name);
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_and_i_ic_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_newclass_p_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = ICONST(2) ? IREG(3) : ICONST(2);
+    PMC * const name = Parrot_pmc_new(interp, enum_class_String);
+    VTABLE_set_string_native(interp, name, SCONST(2));
+    PREG(1) = Parrot_pmc_new_init(interp, enum_class_Class, name);
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_and_i_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_newclass_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = IREG(2) ? ICONST(3) : IREG(2);
+    PREG(1) = Parrot_pmc_new_init(interp, enum_class_Class, PREG(2));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_and_p_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_newclass_p_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_get_bool(interp, PREG(2)) ? PREG(3) : PREG(2);
+    PREG(1) = Parrot_pmc_new_init(interp, enum_class_Class, PCONST(2));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_not_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_subclass_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = ! IREG(1);
+    PMC      * const parent_class = Parrot_oo_get_class(interp, PREG(2));
+    opcode_t * const next         = cur_opcode + 3;
 
-return (opcode_t *)cur_opcode + 2;}
+    if (PMC_IS_NULL(parent_class)) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, next,
+            EXCEPTION_NO_CLASS,
+            "Class '%Ss' doesn't exist", VTABLE_get_string(interp, PREG(2)));return (opcode_t *)handler;
+    }
+    PREG(1) = Parrot_pmc_new(interp, enum_class_Class);
+    VTABLE_add_parent(interp, PREG(1), parent_class);return (opcode_t *)next;
+}
 
 opcode_t *
-Parrot_not_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_subclass_p_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = ! IREG(2);
+    PMC      * const parent_class = Parrot_oo_get_class(interp, PCONST(2));
+    opcode_t * const next         = cur_opcode + 3;
 
-return (opcode_t *)cur_opcode + 3;}
+    if (PMC_IS_NULL(parent_class)) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, next,
+            EXCEPTION_NO_CLASS,
+            "Class '%Ss' doesn't exist", VTABLE_get_string(interp, PCONST(2)));return (opcode_t *)handler;
+    }
+    PREG(1) = Parrot_pmc_new(interp, enum_class_Class);
+    VTABLE_add_parent(interp, PREG(1), parent_class);return (opcode_t *)next;
+}
 
 opcode_t *
-Parrot_not_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_subclass_p_p_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_set_bool(interp, PREG(1), !VTABLE_get_bool(interp, PREG(1)));
+    PMC      * const parent_class = Parrot_oo_get_class(interp, PREG(2));
+    opcode_t * const next         = cur_opcode + 4;
 
-return (opcode_t *)cur_opcode + 2;}
+    if (PMC_IS_NULL(parent_class)) {
+        opcode_t * handler = Parrot_ex_throw_from_op_args(interp, next,
+            EXCEPTION_NO_CLASS,
+            "Class '%Ss' doesn't exist", VTABLE_get_string(interp, PREG(2)));return (opcode_t *)handler;
+    }
+    PREG(1) = Parrot_oo_newclass_from_str(interp, SREG(3));
+    VTABLE_add_parent(interp, PREG(1), parent_class);return (opcode_t *)next;
+}
 
 opcode_t *
-Parrot_not_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_subclass_p_pc_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    const INTVAL a = ! VTABLE_get_bool(interp, PREG(2));
-    if (PMC_IS_NULL(PREG(1)))
-        PREG(1) = Parrot_pmc_new(interp, Parrot_hll_get_ctx_HLL_type(interp, enum_class_Boolean));
-    VTABLE_set_bool(interp, PREG(1), a);
+    PMC      * const parent_class = Parrot_oo_get_class(interp, PCONST(2));
+    opcode_t * const next         = cur_opcode + 4;
 
-return (opcode_t *)cur_opcode + 3;}
+    if (PMC_IS_NULL(parent_class)) {
+        opcode_t * handler = Parrot_ex_throw_from_op_args(interp, next,
+            EXCEPTION_NO_CLASS,
+            "Class '%Ss' doesn't exist", VTABLE_get_string(interp, PCONST(2)));return (opcode_t *)handler;
+    }
+    PREG(1) = Parrot_oo_newclass_from_str(interp, SREG(3));
+    VTABLE_add_parent(interp, PREG(1), parent_class);return (opcode_t *)next;
+}
 
 opcode_t *
-Parrot_or_i_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_subclass_p_p_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = IREG(2) ? IREG(2) : IREG(3);
+    PMC      * const parent_class = Parrot_oo_get_class(interp, PREG(2));
+    opcode_t * const next         = cur_opcode + 4;
 
-return (opcode_t *)cur_opcode + 4;}
+    if (PMC_IS_NULL(parent_class)) {
+        opcode_t * handler = Parrot_ex_throw_from_op_args(interp, next,
+            EXCEPTION_NO_CLASS,
+            "Class '%Ss' doesn't exist", VTABLE_get_string(interp, PREG(2)));return (opcode_t *)handler;
+    }
+    PREG(1) = Parrot_oo_newclass_from_str(interp, SCONST(3));
+    VTABLE_add_parent(interp, PREG(1), parent_class);return (opcode_t *)next;
+}
 
 opcode_t *
-Parrot_or_i_ic_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_subclass_p_pc_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = ICONST(2) ? ICONST(2) : IREG(3);
+    PMC      * const parent_class = Parrot_oo_get_class(interp, PCONST(2));
+    opcode_t * const next         = cur_opcode + 4;
 
-return (opcode_t *)cur_opcode + 4;}
+    if (PMC_IS_NULL(parent_class)) {
+        opcode_t * handler = Parrot_ex_throw_from_op_args(interp, next,
+            EXCEPTION_NO_CLASS,
+            "Class '%Ss' doesn't exist", VTABLE_get_string(interp, PCONST(2)));return (opcode_t *)handler;
+    }
+    PREG(1) = Parrot_oo_newclass_from_str(interp, SCONST(3));
+    VTABLE_add_parent(interp, PREG(1), parent_class);return (opcode_t *)next;
+}
 
 opcode_t *
-Parrot_or_i_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_subclass_p_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = IREG(2) ? IREG(2) : ICONST(3);
+    PMC      * const parent_class = Parrot_oo_get_class(interp, PREG(2));
+    opcode_t * const next         = cur_opcode + 4;
 
-return (opcode_t *)cur_opcode + 4;}
+    if (PMC_IS_NULL(parent_class)) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, next,
+            EXCEPTION_NO_CLASS,
+            "Class '%Ss' doesn't exist", VTABLE_get_string(interp, PREG(2)));return (opcode_t *)handler;
+    }
+    PREG(1) = Parrot_pmc_new_init(interp, enum_class_Class, PREG(3));
+    VTABLE_add_parent(interp, PREG(1), parent_class);return (opcode_t *)next;
+}
 
 opcode_t *
-Parrot_or_p_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_subclass_p_pc_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_get_bool(interp, PREG(2)) ? PREG(2) : PREG(3);
+    PMC      * const parent_class = Parrot_oo_get_class(interp, PCONST(2));
+    opcode_t * const next         = cur_opcode + 4;
 
-return (opcode_t *)cur_opcode + 4;}
+    if (PMC_IS_NULL(parent_class)) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, next,
+            EXCEPTION_NO_CLASS,
+            "Class '%Ss' doesn't exist", VTABLE_get_string(interp, PCONST(2)));return (opcode_t *)handler;
+    }
+    PREG(1) = Parrot_pmc_new_init(interp, enum_class_Class, PREG(3));
+    VTABLE_add_parent(interp, PREG(1), parent_class);return (opcode_t *)next;
+}
 
 opcode_t *
-Parrot_xor_i_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_subclass_p_p_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = (IREG(2) && ! IREG(3)) ? IREG(2) : (IREG(3) && ! IREG(2)) ? IREG(3) : 0;
+    PMC      * const parent_class = Parrot_oo_get_class(interp, PREG(2));
+    opcode_t * const next         = cur_opcode + 4;
 
-return (opcode_t *)cur_opcode + 4;}
+    if (PMC_IS_NULL(parent_class)) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, next,
+            EXCEPTION_NO_CLASS,
+            "Class '%Ss' doesn't exist", VTABLE_get_string(interp, PREG(2)));return (opcode_t *)handler;
+    }
+    PREG(1) = Parrot_pmc_new_init(interp, enum_class_Class, PCONST(3));
+    VTABLE_add_parent(interp, PREG(1), parent_class);return (opcode_t *)next;
+}
 
 opcode_t *
-Parrot_xor_i_ic_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_subclass_p_pc_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = (ICONST(2) && ! IREG(3)) ? ICONST(2) : (IREG(3) && ! ICONST(2)) ? IREG(3) : 0;
+    PMC      * const parent_class = Parrot_oo_get_class(interp, PCONST(2));
+    opcode_t * const next         = cur_opcode + 4;
 
-return (opcode_t *)cur_opcode + 4;}
+    if (PMC_IS_NULL(parent_class)) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, next,
+            EXCEPTION_NO_CLASS,
+            "Class '%Ss' doesn't exist", VTABLE_get_string(interp, PCONST(2)));return (opcode_t *)handler;
+    }
+    PREG(1) = Parrot_pmc_new_init(interp, enum_class_Class, PCONST(3));
+    VTABLE_add_parent(interp, PREG(1), parent_class);return (opcode_t *)next;
+}
 
 opcode_t *
-Parrot_xor_i_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_subclass_p_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = (IREG(2) && ! ICONST(3)) ? IREG(2) : (ICONST(3) && ! IREG(2)) ? ICONST(3) : 0;
+    PMC      * const parent_class = Parrot_oo_get_class_str(interp, SREG(2));
+    opcode_t * const next         = cur_opcode + 3;
 
-return (opcode_t *)cur_opcode + 4;}
+    if (PMC_IS_NULL(parent_class)) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, next,
+            EXCEPTION_NO_CLASS,
+            "Class '%Ss' doesn't exist", SREG(2));return (opcode_t *)handler;
+    }
+
+    PREG(1) = Parrot_pmc_new(interp, enum_class_Class);
+    VTABLE_add_parent(interp, PREG(1), parent_class);return (opcode_t *)next;
+}
 
 opcode_t *
-Parrot_xor_p_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_subclass_p_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    const INTVAL a = VTABLE_get_bool(interp, PREG(2));
-    const INTVAL b = VTABLE_get_bool(interp, PREG(3));
-    if (a && ! b)
-        PREG(1) = PREG(2);
-    else
-        if (b && ! a)
-            PREG(1) = PREG(3) ;
-        else{
-            PREG(1) = Parrot_pmc_new(interp, VTABLE_type(interp, PREG(2)));
-            VTABLE_set_bool(interp, PREG(1), 0);
-        }
+    PMC      * const parent_class = Parrot_oo_get_class_str(interp, SCONST(2));
+    opcode_t * const next         = cur_opcode + 3;
 
-return (opcode_t *)cur_opcode + 4;}
+    if (PMC_IS_NULL(parent_class)) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, next,
+            EXCEPTION_NO_CLASS,
+            "Class '%Ss' doesn't exist", SCONST(2));return (opcode_t *)handler;
+    }
+
+    PREG(1) = Parrot_pmc_new(interp, enum_class_Class);
+    VTABLE_add_parent(interp, PREG(1), parent_class);return (opcode_t *)next;
+}
 
 opcode_t *
-Parrot_print_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_subclass_p_s_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    Parrot_io_printf(interp, INTVAL_FMT, (INTVAL)IREG(1));
+    PMC      * const parent_class = Parrot_oo_get_class_str(interp, SREG(2));
+    opcode_t * const next         = cur_opcode + 4;
 
-return (opcode_t *)cur_opcode + 2;}
+    if (PMC_IS_NULL(parent_class)) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, next,
+            EXCEPTION_NO_CLASS,
+            "Class '%Ss' doesn't exist", SREG(2));return (opcode_t *)handler;
+    }
+
+    PREG(1)  = Parrot_oo_newclass_from_str(interp, SREG(3));
+    VTABLE_add_parent(interp, PREG(1), parent_class);return (opcode_t *)next;
+}
 
 opcode_t *
-Parrot_print_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_subclass_p_sc_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    Parrot_io_printf(interp, INTVAL_FMT, (INTVAL)ICONST(1));
+    PMC      * const parent_class = Parrot_oo_get_class_str(interp, SCONST(2));
+    opcode_t * const next         = cur_opcode + 4;
 
-return (opcode_t *)cur_opcode + 2;}
+    if (PMC_IS_NULL(parent_class)) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, next,
+            EXCEPTION_NO_CLASS,
+            "Class '%Ss' doesn't exist", SCONST(2));return (opcode_t *)handler;
+    }
+
+    PREG(1)  = Parrot_oo_newclass_from_str(interp, SREG(3));
+    VTABLE_add_parent(interp, PREG(1), parent_class);return (opcode_t *)next;
+}
 
 opcode_t *
-Parrot_print_n(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_subclass_p_s_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-#ifdef PARROT_HAS_NEGATIVE_ZERO
-    Parrot_io_printf(interp, FLOATVAL_FMT, NREG(1));
-#else
-    /* Workaround for older msvcrt and openbsd. TT #313 */
-    if (Parrot_is_nzero(NREG(1))) {
-        Parrot_io_printf(interp, "-0");
-    }
-    else {
-        Parrot_io_printf(interp, FLOATVAL_FMT, NREG(1));
+    PMC      * const parent_class = Parrot_oo_get_class_str(interp, SREG(2));
+    opcode_t * const next         = cur_opcode + 4;
+
+    if (PMC_IS_NULL(parent_class)) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, next,
+            EXCEPTION_NO_CLASS,
+            "Class '%Ss' doesn't exist", SREG(2));return (opcode_t *)handler;
     }
-#endif
 
-return (opcode_t *)cur_opcode + 2;}
+    PREG(1)  = Parrot_oo_newclass_from_str(interp, SCONST(3));
+    VTABLE_add_parent(interp, PREG(1), parent_class);return (opcode_t *)next;
+}
 
 opcode_t *
-Parrot_print_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_subclass_p_sc_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-#ifdef PARROT_HAS_NEGATIVE_ZERO
-    Parrot_io_printf(interp, FLOATVAL_FMT, NCONST(1));
-#else
-    /* Workaround for older msvcrt and openbsd. TT #313 */
-    if (Parrot_is_nzero(NCONST(1))) {
-        Parrot_io_printf(interp, "-0");
-    }
-    else {
-        Parrot_io_printf(interp, FLOATVAL_FMT, NCONST(1));
+    PMC      * const parent_class = Parrot_oo_get_class_str(interp, SCONST(2));
+    opcode_t * const next         = cur_opcode + 4;
+
+    if (PMC_IS_NULL(parent_class)) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, next,
+            EXCEPTION_NO_CLASS,
+            "Class '%Ss' doesn't exist", SCONST(2));return (opcode_t *)handler;
     }
-#endif
 
-return (opcode_t *)cur_opcode + 2;}
+    PREG(1)  = Parrot_oo_newclass_from_str(interp, SCONST(3));
+    VTABLE_add_parent(interp, PREG(1), parent_class);return (opcode_t *)next;
+}
 
 opcode_t *
-Parrot_print_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_subclass_p_s_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    STRING * const s = SREG(1);
-    if (s && Parrot_str_byte_length(interp, s))
-        Parrot_io_putps(interp, _PIO_STDOUT(interp), s);
+    PMC      * const parent_class = Parrot_oo_get_class_str(interp, SREG(2));
+    opcode_t * const next         = cur_opcode + 4;
 
-return (opcode_t *)cur_opcode + 2;}
+    if (PMC_IS_NULL(parent_class)) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, next,
+            EXCEPTION_NO_CLASS,
+            "Class '%Ss' doesn't exist", SREG(2));return (opcode_t *)handler;
+    }
+
+    PREG(1) = Parrot_pmc_new_init(interp, enum_class_Class, PREG(3));
+    VTABLE_add_parent(interp, PREG(1), parent_class);return (opcode_t *)next;
+}
 
 opcode_t *
-Parrot_print_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_subclass_p_sc_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    STRING * const s = SCONST(1);
-    if (s && Parrot_str_byte_length(interp, s))
-        Parrot_io_putps(interp, _PIO_STDOUT(interp), s);
+    PMC      * const parent_class = Parrot_oo_get_class_str(interp, SCONST(2));
+    opcode_t * const next         = cur_opcode + 4;
 
-return (opcode_t *)cur_opcode + 2;}
+    if (PMC_IS_NULL(parent_class)) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, next,
+            EXCEPTION_NO_CLASS,
+            "Class '%Ss' doesn't exist", SCONST(2));return (opcode_t *)handler;
+    }
+
+    PREG(1) = Parrot_pmc_new_init(interp, enum_class_Class, PREG(3));
+    VTABLE_add_parent(interp, PREG(1), parent_class);return (opcode_t *)next;
+}
 
 opcode_t *
-Parrot_print_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_subclass_p_s_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const p = PREG(1);
-    STRING * const s = (VTABLE_get_string(interp, p));
-    if (s)
-        Parrot_io_putps(interp, _PIO_STDOUT(interp), s);
+    PMC      * const parent_class = Parrot_oo_get_class_str(interp, SREG(2));
+    opcode_t * const next         = cur_opcode + 4;
 
-return (opcode_t *)cur_opcode + 2;}
+    if (PMC_IS_NULL(parent_class)) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, next,
+            EXCEPTION_NO_CLASS,
+            "Class '%Ss' doesn't exist", SREG(2));return (opcode_t *)handler;
+    }
+
+    PREG(1) = Parrot_pmc_new_init(interp, enum_class_Class, PCONST(3));
+    VTABLE_add_parent(interp, PREG(1), parent_class);return (opcode_t *)next;
+}
 
 opcode_t *
-Parrot_say_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_subclass_p_sc_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    Parrot_io_printf(interp, INTVAL_FMT "\n", (INTVAL)IREG(1));
+    PMC      * const parent_class = Parrot_oo_get_class_str(interp, SCONST(2));
+    opcode_t * const next         = cur_opcode + 4;
 
-return (opcode_t *)cur_opcode + 2;}
+    if (PMC_IS_NULL(parent_class)) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, next,
+            EXCEPTION_NO_CLASS,
+            "Class '%Ss' doesn't exist", SCONST(2));return (opcode_t *)handler;
+    }
+
+    PREG(1) = Parrot_pmc_new_init(interp, enum_class_Class, PCONST(3));
+    VTABLE_add_parent(interp, PREG(1), parent_class);return (opcode_t *)next;
+}
 
 opcode_t *
-Parrot_say_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_get_class_p_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    Parrot_io_printf(interp, INTVAL_FMT "\n", (INTVAL)ICONST(1));
+    PREG(1) = Parrot_oo_get_class_str(interp, SREG(2));
 
-return (opcode_t *)cur_opcode + 2;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_say_n(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_get_class_p_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-#ifdef PARROT_HAS_NEGATIVE_ZERO
-    Parrot_io_printf(interp, FLOATVAL_FMT "\n", NREG(1));
-#else
-    /* Workaround for older msvcrt and openbsd. TT #313 */
-    if (Parrot_is_nzero(NREG(1))) {
-        Parrot_io_printf(interp, "-0\n");
-    }
-    else {
-        Parrot_io_printf(interp, FLOATVAL_FMT "\n", NREG(1));
-    }
-#endif
+    PREG(1) = Parrot_oo_get_class_str(interp, SCONST(2));
 
-return (opcode_t *)cur_opcode + 2;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_say_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_get_class_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-#ifdef PARROT_HAS_NEGATIVE_ZERO
-    Parrot_io_printf(interp, FLOATVAL_FMT "\n", NCONST(1));
-#else
-    /* Workaround for older msvcrt and openbsd. TT #313 */
-    if (Parrot_is_nzero(NCONST(1))) {
-        Parrot_io_printf(interp, "-0\n");
-    }
-    else {
-        Parrot_io_printf(interp, FLOATVAL_FMT "\n", NCONST(1));
-    }
-#endif
+    PREG(1) = Parrot_oo_get_class(interp, PREG(2));
 
-return (opcode_t *)cur_opcode + 2;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_say_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_get_class_p_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    STRING * const s = SREG(1);
-    if (s && Parrot_str_byte_length(interp, s))
-        Parrot_io_putps(interp, _PIO_STDOUT(interp), s);
-    Parrot_io_putps(interp, _PIO_STDOUT(interp), Parrot_str_new_constant(interp, "\n"));
+    PREG(1) = Parrot_oo_get_class(interp, PCONST(2));
 
-return (opcode_t *)cur_opcode + 2;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_say_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_class_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    STRING * const s = SCONST(1);
-    if (s && Parrot_str_byte_length(interp, s))
-        Parrot_io_putps(interp, _PIO_STDOUT(interp), s);
-    Parrot_io_putps(interp, _PIO_STDOUT(interp), Parrot_str_new_constant(interp, "\n"));
+    PREG(1) = VTABLE_get_class(interp, PREG(2));
 
-return (opcode_t *)cur_opcode + 2;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_say_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_addparent_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const p = PREG(1);
-
-    if (PMC_IS_NULL(p)) {
-        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, cur_opcode + 2,
-             EXCEPTION_UNEXPECTED_NULL,
-            "Null PMC in say");return (opcode_t *)handler;
-    }
-    else {
-        STRING * const s = VTABLE_get_string(interp, p);
-        if (s)
-            Parrot_io_putps(interp, _PIO_STDOUT(interp), s);
-        Parrot_io_putps(interp, _PIO_STDOUT(interp), Parrot_str_new_constant(interp, "\n"));
-    }
+    VTABLE_add_parent(interp, PREG(1), PREG(2));
 
-return (opcode_t *)cur_opcode + 2;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_print_p_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_removeparent_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (PREG(1)) {
-        STRING * const s = Parrot_str_from_int(interp, IREG(2));
-        Parrot_io_putps(interp, PREG(1), s);
-    }
+    VTABLE_remove_parent(interp, PREG(1), PREG(2));
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_print_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_addrole_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (PREG(1)) {
-        STRING * const s = Parrot_str_from_int(interp, ICONST(2));
-        Parrot_io_putps(interp, PREG(1), s);
-    }
+    VTABLE_add_role(interp, PREG(1), PREG(2));
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_print_p_n(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_addattribute_p_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (PREG(1)) {
-        STRING * const s = Parrot_sprintf_c(interp, FLOATVAL_FMT, NREG(2));
-        Parrot_io_putps(interp, PREG(1), s);
-    }
+    VTABLE_add_attribute(interp, PREG(1), SREG(2), PMCNULL);
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_print_p_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_addattribute_p_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (PREG(1)) {
-        STRING * const s = Parrot_sprintf_c(interp, FLOATVAL_FMT, NCONST(2));
-        Parrot_io_putps(interp, PREG(1), s);
-    }
+    VTABLE_add_attribute(interp, PREG(1), SCONST(2), PMCNULL);
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_print_p_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_removeattribute_p_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (SREG(2) && PREG(1)) {
-        Parrot_io_putps(interp, PREG(1), SREG(2));
-    }
+    VTABLE_remove_attribute(interp, PREG(1), SREG(2));
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_print_p_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_removeattribute_p_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (SCONST(2) && PREG(1)) {
-        Parrot_io_putps(interp, PREG(1), SCONST(2));
-    }
+    VTABLE_remove_attribute(interp, PREG(1), SCONST(2));
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_print_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_getattribute_p_p_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (PREG(2) && PREG(1)) {
-        STRING * const s = VTABLE_get_string(interp, PREG(2));
-        Parrot_io_putps(interp, PREG(1), s);
-    }
+    PREG(1) = VTABLE_get_attr_str(interp, PREG(2), SREG(3));
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_getstdin_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_getattribute_p_p_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = _PIO_STDIN(interp);
+    PREG(1) = VTABLE_get_attr_str(interp, PREG(2), SCONST(3));
 
-return (opcode_t *)cur_opcode + 2;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_getstdout_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_getattribute_p_p_p_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = _PIO_STDOUT(interp);
+    PREG(1) = VTABLE_get_attr_keyed(interp, PREG(2), PREG(3), SREG(4));
 
-return (opcode_t *)cur_opcode + 2;}
+return (opcode_t *)cur_opcode + 5;}
 
 opcode_t *
-Parrot_getstderr_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_getattribute_p_p_pc_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = _PIO_STDERR(interp);
+    PREG(1) = VTABLE_get_attr_keyed(interp, PREG(2), PCONST(3), SREG(4));
 
-return (opcode_t *)cur_opcode + 2;}
+return (opcode_t *)cur_opcode + 5;}
 
 opcode_t *
-Parrot_abs_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_getattribute_p_p_p_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = abs(IREG(1));
+    PREG(1) = VTABLE_get_attr_keyed(interp, PREG(2), PREG(3), SCONST(4));
 
-return (opcode_t *)cur_opcode + 2;}
+return (opcode_t *)cur_opcode + 5;}
 
 opcode_t *
-Parrot_abs_n(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_getattribute_p_p_pc_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    NREG(1) = fabs(NREG(1));
+    PREG(1) = VTABLE_get_attr_keyed(interp, PREG(2), PCONST(3), SCONST(4));
 
-return (opcode_t *)cur_opcode + 2;}
+return (opcode_t *)cur_opcode + 5;}
 
 opcode_t *
-Parrot_abs_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_setattribute_p_s_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = abs(IREG(2));
+    VTABLE_set_attr_str(interp, PREG(1), SREG(2), PREG(3));
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_abs_n_n(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_setattribute_p_sc_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    NREG(1) = fabs(NREG(2));
+    VTABLE_set_attr_str(interp, PREG(1), SCONST(2), PREG(3));
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_abs_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_setattribute_p_p_s_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_i_absolute(interp, PREG(1));
+    VTABLE_set_attr_keyed(interp, PREG(1), PREG(2), SREG(3), PREG(4));
 
-return (opcode_t *)cur_opcode + 2;}
+return (opcode_t *)cur_opcode + 5;}
 
 opcode_t *
-Parrot_abs_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_setattribute_p_pc_s_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_absolute(interp, PREG(2), PREG(1));
+    VTABLE_set_attr_keyed(interp, PREG(1), PCONST(2), SREG(3), PREG(4));
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 5;}
 
 opcode_t *
-Parrot_add_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_setattribute_p_p_sc_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) += IREG(2);
+    VTABLE_set_attr_keyed(interp, PREG(1), PREG(2), SCONST(3), PREG(4));
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 5;}
 
 opcode_t *
-Parrot_add_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_setattribute_p_pc_sc_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) += ICONST(2);
+    VTABLE_set_attr_keyed(interp, PREG(1), PCONST(2), SCONST(3), PREG(4));
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 5;}
 
 opcode_t *
-Parrot_add_n_n(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_inspect_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    NREG(1) += NREG(2);
+    PREG(1) = VTABLE_inspect(interp, PREG(2));
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_add_n_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_inspect_p_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    NREG(1) += NCONST(2);
+    PREG(1) = VTABLE_inspect(interp, PCONST(2));
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_add_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_inspect_p_p_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_i_add(interp, PREG(1), PREG(2));
+    PREG(1) = VTABLE_inspect_str(interp, PREG(2), SREG(3));
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_add_p_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_inspect_p_pc_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_i_add_int(interp, PREG(1), IREG(2));
+    PREG(1) = VTABLE_inspect_str(interp, PCONST(2), SREG(3));
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_add_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_inspect_p_p_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_i_add_int(interp, PREG(1), ICONST(2));
+    PREG(1) = VTABLE_inspect_str(interp, PREG(2), SCONST(3));
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_add_p_n(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_inspect_p_pc_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_i_add_float(interp, PREG(1), NREG(2));
+    PREG(1) = VTABLE_inspect_str(interp, PCONST(2), SCONST(3));
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_add_p_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_new_p_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_i_add_float(interp, PREG(1), NCONST(2));
+    STRING * const name   = SREG(2);
+    PMC    * const _class = Parrot_pcc_get_HLL(interp, CURRENT_CONTEXT(interp))
+                          ? Parrot_oo_get_class_str(interp, name)
+                          : PMCNULL;
+
+    if (!PMC_IS_NULL(_class))
+        PREG(1) = VTABLE_instantiate(interp, _class, PMCNULL);
+    else {
+        const INTVAL type = Parrot_pmc_get_type_str(interp, name);
+        if (type <= 0) {
+            opcode_t * const dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 3,
+                EXCEPTION_NO_CLASS,
+                "Class '%Ss' not found", name);return (opcode_t *)dest;
+        }
+        PREG(1) = Parrot_pmc_new(interp, type);
+    }
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_add_i_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_new_p_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = IREG(2) + IREG(3);
+    STRING * const name   = SCONST(2);
+    PMC    * const _class = Parrot_pcc_get_HLL(interp, CURRENT_CONTEXT(interp))
+                          ? Parrot_oo_get_class_str(interp, name)
+                          : PMCNULL;
 
-return (opcode_t *)cur_opcode + 4;}
+    if (!PMC_IS_NULL(_class))
+        PREG(1) = VTABLE_instantiate(interp, _class, PMCNULL);
+    else {
+        const INTVAL type = Parrot_pmc_get_type_str(interp, name);
+        if (type <= 0) {
+            opcode_t * const dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 3,
+                EXCEPTION_NO_CLASS,
+                "Class '%Ss' not found", name);return (opcode_t *)dest;
+        }
+        PREG(1) = Parrot_pmc_new(interp, type);
+    }
+
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_add_i_ic_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_new_p_s_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = ICONST(2) + IREG(3);
+    STRING * const name   = SREG(2);
+    PMC    * const _class = Parrot_pcc_get_HLL(interp, CURRENT_CONTEXT(interp))
+                          ? Parrot_oo_get_class_str(interp, name)
+                          : PMCNULL;
+
+    if (!PMC_IS_NULL(_class))
+        PREG(1) = VTABLE_instantiate(interp, _class, PREG(3));
+    else {
+        const INTVAL type = Parrot_pmc_get_type_str(interp, name);
+        if (type <= 0) {
+            opcode_t * const dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
+                EXCEPTION_NO_CLASS,
+                "Class '%Ss' not found", name);return (opcode_t *)dest;
+        }
+        PREG(1) = Parrot_pmc_new_init(interp, type, PREG(3));
+    }
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_add_i_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_new_p_sc_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = IREG(2) + ICONST(3);
+    STRING * const name   = SCONST(2);
+    PMC    * const _class = Parrot_pcc_get_HLL(interp, CURRENT_CONTEXT(interp))
+                          ? Parrot_oo_get_class_str(interp, name)
+                          : PMCNULL;
+
+    if (!PMC_IS_NULL(_class))
+        PREG(1) = VTABLE_instantiate(interp, _class, PREG(3));
+    else {
+        const INTVAL type = Parrot_pmc_get_type_str(interp, name);
+        if (type <= 0) {
+            opcode_t * const dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
+                EXCEPTION_NO_CLASS,
+                "Class '%Ss' not found", name);return (opcode_t *)dest;
+        }
+        PREG(1) = Parrot_pmc_new_init(interp, type, PREG(3));
+    }
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_add_n_n_n(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_new_p_s_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    NREG(1) = NREG(2) + NREG(3);
+    STRING * const name   = SREG(2);
+    PMC    * const _class = Parrot_pcc_get_HLL(interp, CURRENT_CONTEXT(interp))
+                          ? Parrot_oo_get_class_str(interp, name)
+                          : PMCNULL;
+
+    if (!PMC_IS_NULL(_class))
+        PREG(1) = VTABLE_instantiate(interp, _class, PCONST(3));
+    else {
+        const INTVAL type = Parrot_pmc_get_type_str(interp, name);
+        if (type <= 0) {
+            opcode_t * const dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
+                EXCEPTION_NO_CLASS,
+                "Class '%Ss' not found", name);return (opcode_t *)dest;
+        }
+        PREG(1) = Parrot_pmc_new_init(interp, type, PCONST(3));
+    }
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_add_n_nc_n(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_new_p_sc_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    NREG(1) = NCONST(2) + NREG(3);
+    STRING * const name   = SCONST(2);
+    PMC    * const _class = Parrot_pcc_get_HLL(interp, CURRENT_CONTEXT(interp))
+                          ? Parrot_oo_get_class_str(interp, name)
+                          : PMCNULL;
+
+    if (!PMC_IS_NULL(_class))
+        PREG(1) = VTABLE_instantiate(interp, _class, PCONST(3));
+    else {
+        const INTVAL type = Parrot_pmc_get_type_str(interp, name);
+        if (type <= 0) {
+            opcode_t * const dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
+                EXCEPTION_NO_CLASS,
+                "Class '%Ss' not found", name);return (opcode_t *)dest;
+        }
+        PREG(1) = Parrot_pmc_new_init(interp, type, PCONST(3));
+    }
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_add_n_n_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_new_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    NREG(1) = NREG(2) + NCONST(3);
+    PMC * const name_key = PREG(2);
+    PMC * const _class   = Parrot_oo_get_class(interp, name_key);
 
-return (opcode_t *)cur_opcode + 4;}
+    if (!PMC_IS_NULL(_class))
+        PREG(1) = VTABLE_instantiate(interp, _class, PMCNULL);
+    else {
+        const INTVAL type = Parrot_pmc_get_type(interp, name_key);
+        if (type <= 0) {
+            opcode_t * const dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 3,
+                EXCEPTION_NO_CLASS,
+                "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));return (opcode_t *)dest;
+        }
+        PREG(1) = Parrot_pmc_new(interp, type);
+    }
+
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_add_p_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_new_p_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_add(interp, PREG(2), PREG(3), PREG(1));
+    PMC * const name_key = PCONST(2);
+    PMC * const _class   = Parrot_oo_get_class(interp, name_key);
 
-return (opcode_t *)cur_opcode + 4;}
+    if (!PMC_IS_NULL(_class))
+        PREG(1) = VTABLE_instantiate(interp, _class, PMCNULL);
+    else {
+        const INTVAL type = Parrot_pmc_get_type(interp, name_key);
+        if (type <= 0) {
+            opcode_t * const dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 3,
+                EXCEPTION_NO_CLASS,
+                "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));return (opcode_t *)dest;
+        }
+        PREG(1) = Parrot_pmc_new(interp, type);
+    }
+
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_add_p_p_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_new_p_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_add_int(interp, PREG(2), IREG(3), PREG(1));
+    PMC * const name_key = PREG(2);
+    PMC * const _class   = Parrot_oo_get_class(interp, name_key);
+
+    if (!PMC_IS_NULL(_class))
+        PREG(1) = VTABLE_instantiate(interp, _class, PREG(3));
+    else {
+        const INTVAL type = Parrot_pmc_get_type(interp, name_key);
+        if (type <= 0) {
+            opcode_t * const dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
+                EXCEPTION_NO_CLASS,
+                "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));return (opcode_t *)dest;
+        }
+        PREG(1) = Parrot_pmc_new_init(interp, type, PREG(3));
+    }
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_add_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_new_p_pc_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_add_int(interp, PREG(2), ICONST(3), PREG(1));
+    PMC * const name_key = PCONST(2);
+    PMC * const _class   = Parrot_oo_get_class(interp, name_key);
+
+    if (!PMC_IS_NULL(_class))
+        PREG(1) = VTABLE_instantiate(interp, _class, PREG(3));
+    else {
+        const INTVAL type = Parrot_pmc_get_type(interp, name_key);
+        if (type <= 0) {
+            opcode_t * const dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
+                EXCEPTION_NO_CLASS,
+                "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));return (opcode_t *)dest;
+        }
+        PREG(1) = Parrot_pmc_new_init(interp, type, PREG(3));
+    }
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_add_p_p_n(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_new_p_p_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_add_float(interp, PREG(2), NREG(3), PREG(1));
+    PMC * const name_key = PREG(2);
+    PMC * const _class   = Parrot_oo_get_class(interp, name_key);
+
+    if (!PMC_IS_NULL(_class))
+        PREG(1) = VTABLE_instantiate(interp, _class, PCONST(3));
+    else {
+        const INTVAL type = Parrot_pmc_get_type(interp, name_key);
+        if (type <= 0) {
+            opcode_t * const dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
+                EXCEPTION_NO_CLASS,
+                "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));return (opcode_t *)dest;
+        }
+        PREG(1) = Parrot_pmc_new_init(interp, type, PCONST(3));
+    }
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_add_p_p_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_new_p_pc_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_add_float(interp, PREG(2), NCONST(3), PREG(1));
+    PMC * const name_key = PCONST(2);
+    PMC * const _class   = Parrot_oo_get_class(interp, name_key);
+
+    if (!PMC_IS_NULL(_class))
+        PREG(1) = VTABLE_instantiate(interp, _class, PCONST(3));
+    else {
+        const INTVAL type = Parrot_pmc_get_type(interp, name_key);
+        if (type <= 0) {
+            opcode_t * const dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
+                EXCEPTION_NO_CLASS,
+                "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));return (opcode_t *)dest;
+        }
+        PREG(1) = Parrot_pmc_new_init(interp, type, PCONST(3));
+    }
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_dec_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_root_new_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1)--;
-
-return (opcode_t *)cur_opcode + 2;}
+    PMC * const key      = PREG(2);
+    PMC * const root_ns  = interp->root_namespace;
+    PMC * const ns       = Parrot_ns_get_namespace_keyed(interp, root_ns, key);
+    PMC * classobj       = PMCNULL;
 
-opcode_t *
-Parrot_dec_n(opcode_t *cur_opcode, PARROT_INTERP)  {
-    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    NREG(1)--;
+    if (!PMC_IS_NULL(ns))
+        classobj = Parrot_oo_get_class(interp, ns);
+    if (!PMC_IS_NULL(classobj))
+        PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+    else {
+        opcode_t * const dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 3,
+            EXCEPTION_NO_CLASS,
+            "Class '%Ss' not found", VTABLE_get_repr(interp, key));return (opcode_t *)dest;
+    }
 
-return (opcode_t *)cur_opcode + 2;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_dec_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_root_new_p_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_decrement(interp, PREG(1));
+    PMC * const key      = PCONST(2);
+    PMC * const root_ns  = interp->root_namespace;
+    PMC * const ns       = Parrot_ns_get_namespace_keyed(interp, root_ns, key);
+    PMC * classobj       = PMCNULL;
 
-return (opcode_t *)cur_opcode + 2;}
+    if (!PMC_IS_NULL(ns))
+        classobj = Parrot_oo_get_class(interp, ns);
+    if (!PMC_IS_NULL(classobj))
+        PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+    else {
+        opcode_t * const dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 3,
+            EXCEPTION_NO_CLASS,
+            "Class '%Ss' not found", VTABLE_get_repr(interp, key));return (opcode_t *)dest;
+    }
+
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_div_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_root_new_p_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    INTVAL den = IREG(2);
-    if (den == 0) {
-        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, cur_opcode + 3,
-            EXCEPTION_DIV_BY_ZERO,
-            "Divide by zero");return (opcode_t *)handler;
+    PMC * const key      = PREG(2);
+    PMC * const root_ns  = interp->root_namespace;
+    PMC * const ns       = Parrot_ns_get_namespace_keyed(interp, root_ns, key);
+    PMC * classobj       = PMCNULL;
+
+    if (!PMC_IS_NULL(ns))
+        classobj = Parrot_oo_get_class(interp, ns);
+    if (!PMC_IS_NULL(classobj))
+        PREG(1) = VTABLE_instantiate(interp, classobj, PREG(3));
+    else {
+        opcode_t * const dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
+            EXCEPTION_NO_CLASS,
+            "Class '%Ss' not found", VTABLE_get_repr(interp, key));return (opcode_t *)dest;
     }
-    IREG(1) /= den;
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_div_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_root_new_p_pc_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    INTVAL den = ICONST(2);
-    if (den == 0) {
-        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, cur_opcode + 3,
-            EXCEPTION_DIV_BY_ZERO,
-            "Divide by zero");return (opcode_t *)handler;
+    PMC * const key      = PCONST(2);
+    PMC * const root_ns  = interp->root_namespace;
+    PMC * const ns       = Parrot_ns_get_namespace_keyed(interp, root_ns, key);
+    PMC * classobj       = PMCNULL;
+
+    if (!PMC_IS_NULL(ns))
+        classobj = Parrot_oo_get_class(interp, ns);
+    if (!PMC_IS_NULL(classobj))
+        PREG(1) = VTABLE_instantiate(interp, classobj, PREG(3));
+    else {
+        opcode_t * const dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
+            EXCEPTION_NO_CLASS,
+            "Class '%Ss' not found", VTABLE_get_repr(interp, key));return (opcode_t *)dest;
     }
-    IREG(1) /= den;
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_div_n_n(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_root_new_p_p_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    FLOATVAL den = NREG(2);
-    if (FLOAT_IS_ZERO(den)) {
-        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, cur_opcode + 3,
-            EXCEPTION_DIV_BY_ZERO,
-            "Divide by zero");return (opcode_t *)handler;
+    PMC * const key      = PREG(2);
+    PMC * const root_ns  = interp->root_namespace;
+    PMC * const ns       = Parrot_ns_get_namespace_keyed(interp, root_ns, key);
+    PMC * classobj       = PMCNULL;
+
+    if (!PMC_IS_NULL(ns))
+        classobj = Parrot_oo_get_class(interp, ns);
+    if (!PMC_IS_NULL(classobj))
+        PREG(1) = VTABLE_instantiate(interp, classobj, PCONST(3));
+    else {
+        opcode_t * const dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
+            EXCEPTION_NO_CLASS,
+            "Class '%Ss' not found", VTABLE_get_repr(interp, key));return (opcode_t *)dest;
     }
-    NREG(1) /= den;
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_div_n_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_root_new_p_pc_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    FLOATVAL den = NCONST(2);
-    if (FLOAT_IS_ZERO(den)) {
-        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, cur_opcode + 3,
-            EXCEPTION_DIV_BY_ZERO,
-            "Divide by zero");return (opcode_t *)handler;
+    PMC * const key      = PCONST(2);
+    PMC * const root_ns  = interp->root_namespace;
+    PMC * const ns       = Parrot_ns_get_namespace_keyed(interp, root_ns, key);
+    PMC * classobj       = PMCNULL;
+
+    if (!PMC_IS_NULL(ns))
+        classobj = Parrot_oo_get_class(interp, ns);
+    if (!PMC_IS_NULL(classobj))
+        PREG(1) = VTABLE_instantiate(interp, classobj, PCONST(3));
+    else {
+        opcode_t * const dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
+            EXCEPTION_NO_CLASS,
+            "Class '%Ss' not found", VTABLE_get_repr(interp, key));return (opcode_t *)dest;
     }
-    NREG(1) /= den;
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_div_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_typeof_s_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_i_divide(interp, PREG(1), PREG(2));
+    SREG(1) = VTABLE_name(interp, PREG(2));
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_div_p_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_typeof_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_i_divide_int(interp, PREG(1), IREG(2));
+    PREG(1) = VTABLE_get_class(interp, PREG(2));
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_div_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_get_repr_s_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_i_divide_int(interp, PREG(1), ICONST(2));
+    SREG(1) = VTABLE_get_repr(interp, PREG(2));
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_div_p_n(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_find_method_p_p_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_i_divide_float(interp, PREG(1), NREG(2));
+    opcode_t * const resume = cur_opcode + 4;
+    PREG(1) = Parrot_find_method_inline_cached(interp, PREG(2), SREG(3), CUR_OPCODE);
+    if (PMC_IS_NULL(PREG(1)) || !VTABLE_defined(interp, PREG(1))) {
+        opcode_t * const dest = Parrot_ex_throw_from_op_args(interp, resume,
+            EXCEPTION_METHOD_NOT_FOUND,
+            "Method '%Ss' not found for invocant of class '%Ss'", SREG(3),
+            VTABLE_get_string(interp, VTABLE_get_class(interp, PREG(2))));return (opcode_t *)dest;
+    }return (opcode_t *)resume;
+}
 
-return (opcode_t *)cur_opcode + 3;}
+opcode_t *
+Parrot_find_method_p_p_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    opcode_t * const resume = cur_opcode + 4;
+    PREG(1) = Parrot_find_method_inline_cached(interp, PREG(2), SCONST(3), CUR_OPCODE);
+    if (PMC_IS_NULL(PREG(1)) || !VTABLE_defined(interp, PREG(1))) {
+        opcode_t * const dest = Parrot_ex_throw_from_op_args(interp, resume,
+            EXCEPTION_METHOD_NOT_FOUND,
+            "Method '%Ss' not found for invocant of class '%Ss'", SCONST(3),
+            VTABLE_get_string(interp, VTABLE_get_class(interp, PREG(2))));return (opcode_t *)dest;
+    }return (opcode_t *)resume;
+}
 
 opcode_t *
-Parrot_div_p_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_defined_i_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_i_divide_float(interp, PREG(1), NCONST(2));
+    IREG(1) = PMC_IS_NULL(PREG(2)) ? 0 : VTABLE_defined(interp, PREG(2));
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_div_i_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_defined_i_p_ki(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    INTVAL den = IREG(3);
-    if (den == 0) {
-        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
-            EXCEPTION_DIV_BY_ZERO,
-            "Divide by zero");return (opcode_t *)handler;
-    }
-    IREG(1) = IREG(2) / den;
+    IREG(1) = PMC_IS_NULL(PREG(2)) ? 0 : VTABLE_defined_keyed_int(interp, PREG(2), IREG(3));
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_div_i_ic_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_defined_i_p_kic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    INTVAL den = IREG(3);
-    if (den == 0) {
-        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
-            EXCEPTION_DIV_BY_ZERO,
-            "Divide by zero");return (opcode_t *)handler;
-    }
-    IREG(1) = ICONST(2) / den;
+    IREG(1) = PMC_IS_NULL(PREG(2)) ? 0 : VTABLE_defined_keyed_int(interp, PREG(2), ICONST(3));
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_div_i_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_defined_i_p_k(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    INTVAL den = ICONST(3);
-    if (den == 0) {
-        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
-            EXCEPTION_DIV_BY_ZERO,
-            "Divide by zero");return (opcode_t *)handler;
-    }
-    IREG(1) = IREG(2) / den;
+    IREG(1) = PMC_IS_NULL(PREG(2)) ? 0 : VTABLE_defined_keyed(interp, PREG(2), PREG(3));
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_div_i_ic_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_defined_i_p_kc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    INTVAL den = ICONST(3);
-    if (den == 0) {
-        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
-            EXCEPTION_DIV_BY_ZERO,
-            "Divide by zero");return (opcode_t *)handler;
-    }
-    IREG(1) = ICONST(2) / den;
+    IREG(1) = PMC_IS_NULL(PREG(2)) ? 0 : VTABLE_defined_keyed(interp, PREG(2), PCONST(3));
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_div_n_n_n(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_exists_i_p_ki(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    FLOATVAL den = NREG(3);
-    if (FLOAT_IS_ZERO(den)) {
-        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
-            EXCEPTION_DIV_BY_ZERO,
-            "Divide by zero");return (opcode_t *)handler;
-    }
-    NREG(1) = NREG(2) / den;
+    IREG(1) = PMC_IS_NULL(PREG(2)) ? 0 : VTABLE_exists_keyed_int(interp, PREG(2), IREG(3));
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_div_n_nc_n(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_exists_i_p_kic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    FLOATVAL den = NREG(3);
-    if (FLOAT_IS_ZERO(den)) {
-        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
-            EXCEPTION_DIV_BY_ZERO,
-            "Divide by zero");return (opcode_t *)handler;
-    }
-    NREG(1) = NCONST(2) / den;
+    IREG(1) = PMC_IS_NULL(PREG(2)) ? 0 : VTABLE_exists_keyed_int(interp, PREG(2), ICONST(3));
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_div_n_n_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_exists_i_p_k(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    FLOATVAL den = NCONST(3);
-    if (FLOAT_IS_ZERO(den)) {
-        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
-            EXCEPTION_DIV_BY_ZERO,
-            "Divide by zero");return (opcode_t *)handler;
-    }
-    NREG(1) = NREG(2) / den;
+    IREG(1) = PMC_IS_NULL(PREG(2)) ? 0: VTABLE_exists_keyed(interp, PREG(2), PREG(3));
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_div_n_nc_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_exists_i_p_kc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    FLOATVAL den = NCONST(3);
-    if (FLOAT_IS_ZERO(den)) {
-        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
-            EXCEPTION_DIV_BY_ZERO,
-            "Divide by zero");return (opcode_t *)handler;
-    }
-    NREG(1) = NCONST(2) / den;
+    IREG(1) = PMC_IS_NULL(PREG(2)) ? 0: VTABLE_exists_keyed(interp, PREG(2), PCONST(3));
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_div_p_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_delete_p_k(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_divide(interp, PREG(2), PREG(3), PREG(1));
+    VTABLE_delete_keyed(interp, PREG(1), PREG(2));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_div_p_p_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_delete_p_kc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_divide_int(interp, PREG(2), IREG(3), PREG(1));
+    VTABLE_delete_keyed(interp, PREG(1), PCONST(2));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_div_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_delete_p_ki(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_divide_int(interp, PREG(2), ICONST(3), PREG(1));
+    VTABLE_delete_keyed_int(interp, PREG(1), IREG(2));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_div_p_p_n(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_delete_p_kic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_divide_float(interp, PREG(2), NREG(3), PREG(1));
+    VTABLE_delete_keyed_int(interp, PREG(1), ICONST(2));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_div_p_p_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_elements_i_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_divide_float(interp, PREG(2), NCONST(3), PREG(1));
+    IREG(1) = VTABLE_elements(interp, PREG(2));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_fdiv_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_push_p_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    INTVAL   den = IREG(2);
-    FLOATVAL f;
+    VTABLE_push_integer(interp, PREG(1), IREG(2));
 
-    if (den == 0) {
-        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, cur_opcode + 3,
-            EXCEPTION_DIV_BY_ZERO,
-            "Divide by zero");return (opcode_t *)handler;
-    }
+return (opcode_t *)cur_opcode + 3;}
 
-    f  = floor(((FLOATVAL)IREG(1)) / den);
-    IREG(1) = (INTVAL)f;
+opcode_t *
+Parrot_push_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_push_integer(interp, PREG(1), ICONST(2));
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_fdiv_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_push_p_n(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    INTVAL   den = ICONST(2);
-    FLOATVAL f;
+    VTABLE_push_float(interp, PREG(1), NREG(2));
 
-    if (den == 0) {
-        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, cur_opcode + 3,
-            EXCEPTION_DIV_BY_ZERO,
-            "Divide by zero");return (opcode_t *)handler;
-    }
+return (opcode_t *)cur_opcode + 3;}
 
-    f  = floor(((FLOATVAL)IREG(1)) / den);
-    IREG(1) = (INTVAL)f;
+opcode_t *
+Parrot_push_p_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_push_float(interp, PREG(1), NCONST(2));
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_fdiv_n_n(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_push_p_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    FLOATVAL den = NREG(2);
-    if (FLOAT_IS_ZERO(den)) {
-        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, cur_opcode + 3,
-            EXCEPTION_DIV_BY_ZERO,
-            "Divide by zero");return (opcode_t *)handler;
-    }
-    NREG(1) = floor(NREG(1) / den);
+    VTABLE_push_string(interp, PREG(1), SREG(2));
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_fdiv_n_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_push_p_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    FLOATVAL den = NCONST(2);
-    if (FLOAT_IS_ZERO(den)) {
-        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, cur_opcode + 3,
-            EXCEPTION_DIV_BY_ZERO,
-            "Divide by zero");return (opcode_t *)handler;
-    }
-    NREG(1) = floor(NREG(1) / den);
+    VTABLE_push_string(interp, PREG(1), SCONST(2));
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_fdiv_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_push_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_i_floor_divide(interp, PREG(1), PREG(2));
+    VTABLE_push_pmc(interp, PREG(1), PREG(2));
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_fdiv_p_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_pop_i_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_i_floor_divide_int(interp, PREG(1), IREG(2));
+    IREG(1) = VTABLE_pop_integer(interp, PREG(2));
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_fdiv_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_pop_n_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_i_floor_divide_int(interp, PREG(1), ICONST(2));
+    NREG(1) = VTABLE_pop_float(interp, PREG(2));
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_fdiv_p_n(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_pop_s_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_i_floor_divide_float(interp, PREG(1), NREG(2));
+    SREG(1) = VTABLE_pop_string(interp, PREG(2));
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_fdiv_p_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_pop_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_i_floor_divide_float(interp, PREG(1), NCONST(2));
+    PREG(1) = VTABLE_pop_pmc(interp, PREG(2));
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_fdiv_i_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_unshift_p_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    INTVAL   den = IREG(3);
-    FLOATVAL f;
+    VTABLE_unshift_integer(interp, PREG(1), IREG(2));
 
-    if (den == 0) {
-        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
-            EXCEPTION_DIV_BY_ZERO,
-            "Divide by zero");return (opcode_t *)handler;
-    }
+return (opcode_t *)cur_opcode + 3;}
 
-    f  = floor((FLOATVAL)IREG(2) / den);
-    IREG(1) = (INTVAL)f;
+opcode_t *
+Parrot_unshift_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_unshift_integer(interp, PREG(1), ICONST(2));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_fdiv_i_ic_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_unshift_p_n(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    INTVAL   den = IREG(3);
-    FLOATVAL f;
+    VTABLE_unshift_float(interp, PREG(1), NREG(2));
 
-    if (den == 0) {
-        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
-            EXCEPTION_DIV_BY_ZERO,
-            "Divide by zero");return (opcode_t *)handler;
-    }
+return (opcode_t *)cur_opcode + 3;}
 
-    f  = floor((FLOATVAL)ICONST(2) / den);
-    IREG(1) = (INTVAL)f;
+opcode_t *
+Parrot_unshift_p_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_unshift_float(interp, PREG(1), NCONST(2));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_fdiv_i_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_unshift_p_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    INTVAL   den = ICONST(3);
-    FLOATVAL f;
+    VTABLE_unshift_string(interp, PREG(1), SREG(2));
 
-    if (den == 0) {
-        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
-            EXCEPTION_DIV_BY_ZERO,
-            "Divide by zero");return (opcode_t *)handler;
-    }
+return (opcode_t *)cur_opcode + 3;}
 
-    f  = floor((FLOATVAL)IREG(2) / den);
-    IREG(1) = (INTVAL)f;
+opcode_t *
+Parrot_unshift_p_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_unshift_string(interp, PREG(1), SCONST(2));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_fdiv_n_n_n(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_unshift_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    FLOATVAL den = NREG(3);
-    if (FLOAT_IS_ZERO(den)) {
-        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
-            EXCEPTION_DIV_BY_ZERO,
-            "Divide by zero");return (opcode_t *)handler;
-    }
-    NREG(1) = floor(NREG(2) / den);
+    VTABLE_unshift_pmc(interp, PREG(1), PREG(2));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_fdiv_n_nc_n(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_shift_i_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    FLOATVAL den = NREG(3);
-    if (FLOAT_IS_ZERO(den)) {
-        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
-            EXCEPTION_DIV_BY_ZERO,
-            "Divide by zero");return (opcode_t *)handler;
-    }
-    NREG(1) = floor(NCONST(2) / den);
+    IREG(1) = VTABLE_shift_integer(interp, PREG(2));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_fdiv_n_n_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_shift_n_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    FLOATVAL den = NCONST(3);
-    if (FLOAT_IS_ZERO(den)) {
-        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
-            EXCEPTION_DIV_BY_ZERO,
-            "Divide by zero");return (opcode_t *)handler;
-    }
-    NREG(1) = floor(NREG(2) / den);
+    NREG(1) = VTABLE_shift_float(interp, PREG(2));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_fdiv_p_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_shift_s_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_floor_divide(interp, PREG(2), PREG(3), PREG(1));
+    SREG(1) = VTABLE_shift_string(interp, PREG(2));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_fdiv_p_p_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_shift_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_floor_divide_int(interp, PREG(2), IREG(3), PREG(1));
+    PREG(1) = VTABLE_shift_pmc(interp, PREG(2));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_fdiv_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_splice_p_p_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_floor_divide_int(interp, PREG(2), ICONST(3), PREG(1));
+    VTABLE_splice(interp, PREG(1), PREG(2), IREG(3), IREG(4));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 5;}
 
 opcode_t *
-Parrot_fdiv_p_p_n(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_splice_p_p_ic_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_floor_divide_float(interp, PREG(2), NREG(3), PREG(1));
+    VTABLE_splice(interp, PREG(1), PREG(2), ICONST(3), IREG(4));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 5;}
 
 opcode_t *
-Parrot_fdiv_p_p_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_splice_p_p_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_floor_divide_float(interp, PREG(2), NCONST(3), PREG(1));
+    VTABLE_splice(interp, PREG(1), PREG(2), IREG(3), ICONST(4));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 5;}
 
 opcode_t *
-Parrot_ceil_n(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_splice_p_p_ic_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    NREG(1) = ceil(NREG(1));
+    VTABLE_splice(interp, PREG(1), PREG(2), ICONST(3), ICONST(4));
 
-return (opcode_t *)cur_opcode + 2;}
+return (opcode_t *)cur_opcode + 5;}
 
 opcode_t *
-Parrot_ceil_i_n(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_setprop_p_s_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    FLOATVAL f = ceil(NREG(2));
-    IREG(1)         = (INTVAL)f;
+    VTABLE_setprop(interp, PREG(1), SREG(2), PREG(3));
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_ceil_n_n(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_setprop_p_sc_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    NREG(1) = ceil(NREG(2));
+    VTABLE_setprop(interp, PREG(1), SCONST(2), PREG(3));
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_floor_n(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_getprop_p_s_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    NREG(1) = floor(NREG(1));
+    PREG(1) = VTABLE_getprop(interp, PREG(3), SREG(2));
 
-return (opcode_t *)cur_opcode + 2;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_floor_i_n(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_getprop_p_sc_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    FLOATVAL f = floor(NREG(2));
-    IREG(1)         = (INTVAL)f;
+    PREG(1) = VTABLE_getprop(interp, PREG(3), SCONST(2));
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_floor_n_n(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_delprop_p_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    NREG(1) = floor(NREG(2));
+    VTABLE_delprop(interp, PREG(1), SREG(2));
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_inc_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_delprop_p_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1)++;
+    VTABLE_delprop(interp, PREG(1), SCONST(2));
 
-return (opcode_t *)cur_opcode + 2;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_inc_n(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_prophash_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    NREG(1)++;
+    PREG(1) = VTABLE_getprops(interp, PREG(2));
 
-return (opcode_t *)cur_opcode + 2;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_inc_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_freeze_s_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_increment(interp, PREG(1));
+    SREG(1) = Parrot_freeze(interp, PREG(2));
 
-return (opcode_t *)cur_opcode + 2;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_mod_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_thaw_p_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = Parrot_util_intval_mod(IREG(1), IREG(2));
+    PREG(1) = Parrot_thaw(interp, SREG(2));
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_mod_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_thaw_p_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = Parrot_util_intval_mod(IREG(1), ICONST(2));
+    PREG(1) = Parrot_thaw(interp, SCONST(2));
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_mod_n_n(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_multi_s_s_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    NREG(1) = Parrot_util_floatval_mod(NREG(1), NREG(2));
+    Parrot_mmd_add_multi_from_long_sig(interp, SREG(1), SREG(2), PREG(3));
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_mod_n_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_multi_sc_s_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    NREG(1) = Parrot_util_floatval_mod(NREG(1), NCONST(2));
+    Parrot_mmd_add_multi_from_long_sig(interp, SCONST(1), SREG(2), PREG(3));
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_mod_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_multi_s_sc_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_i_modulus(interp, PREG(1), PREG(2));
+    Parrot_mmd_add_multi_from_long_sig(interp, SREG(1), SCONST(2), PREG(3));
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_mod_p_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_multi_sc_sc_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_i_modulus_int(interp, PREG(1), IREG(2));
+    Parrot_mmd_add_multi_from_long_sig(interp, SCONST(1), SCONST(2), PREG(3));
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_mod_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_find_multi_p_s_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_i_modulus_int(interp, PREG(1), ICONST(2));
+    PREG(1) = Parrot_mmd_find_multi_from_long_sig(interp, SREG(2), SREG(3));
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_mod_p_n(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_find_multi_p_sc_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_i_modulus_float(interp, PREG(1), NREG(2));
+    PREG(1) = Parrot_mmd_find_multi_from_long_sig(interp, SCONST(2), SREG(3));
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_mod_p_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_find_multi_p_s_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_i_modulus_float(interp, PREG(1), NCONST(2));
+    PREG(1) = Parrot_mmd_find_multi_from_long_sig(interp, SREG(2), SCONST(3));
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_mod_i_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_find_multi_p_sc_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = Parrot_util_intval_mod(IREG(2), IREG(3));
+    PREG(1) = Parrot_mmd_find_multi_from_long_sig(interp, SCONST(2), SCONST(3));
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_mod_i_ic_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_register_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = Parrot_util_intval_mod(ICONST(2), IREG(3));
+    Parrot_pmc_gc_register(interp, PREG(1));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 2;}
 
 opcode_t *
-Parrot_mod_i_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_unregister_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = Parrot_util_intval_mod(IREG(2), ICONST(3));
+    Parrot_pmc_gc_unregister(interp, PREG(1));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 2;}
 
 opcode_t *
-Parrot_mod_n_n_n(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_box_p_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    NREG(1) = Parrot_util_floatval_mod(NREG(2), NREG(3));
+    PREG(1) = Parrot_pmc_box_integer(interp, IREG(2));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_mod_n_nc_n(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_box_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    NREG(1) = Parrot_util_floatval_mod(NCONST(2), NREG(3));
+    PREG(1) = Parrot_pmc_box_integer(interp, ICONST(2));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_mod_n_n_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_box_p_n(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    NREG(1) = Parrot_util_floatval_mod(NREG(2), NCONST(3));
+    PREG(1) = Parrot_pmc_box_number(interp, NREG(2));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_mod_p_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_box_p_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_modulus(interp, PREG(2), PREG(3), PREG(1));
+    PREG(1) = Parrot_pmc_box_number(interp, NCONST(2));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_mod_p_p_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_box_p_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_modulus_int(interp, PREG(2), IREG(3), PREG(1));
+    PREG(1) = Parrot_pmc_box_string(interp, SREG(2));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_mod_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_box_p_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_modulus_int(interp, PREG(2), ICONST(3), PREG(1));
+    PREG(1) = Parrot_pmc_box_string(interp, SCONST(2));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_mod_p_p_n(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_iter_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_modulus_float(interp, PREG(2), NREG(3), PREG(1));
+    PREG(1) = VTABLE_get_iter(interp, PREG(2));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_mod_p_p_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_morph_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_modulus_float(interp, PREG(2), NCONST(3), PREG(1));
+    VTABLE_morph(interp, PREG(1), PREG(2));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_mul_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_morph_p_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) *= IREG(2);
+    VTABLE_morph(interp, PREG(1), PCONST(2));
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_mul_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_clone_s_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) *= ICONST(2);
+    /* cloning a NULL STRING produces an empty STRING; TT #964 */
+    SREG(1) = STRING_IS_NULL(SREG(2))
+       ? Parrot_str_new(interp, NULL, 0)
+       : SREG(2);
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_mul_n_n(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_clone_s_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    NREG(1) *= NREG(2);
+    /* cloning a NULL STRING produces an empty STRING; TT #964 */
+    SREG(1) = STRING_IS_NULL(SCONST(2))
+       ? Parrot_str_new(interp, NULL, 0)
+       : SCONST(2);
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_mul_n_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    NREG(1) *= NCONST(2);
+    IREG(1) = IREG(2);
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_mul_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_i_multiply(interp, PREG(1), PREG(2));
+    IREG(1) = ICONST(2);
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_mul_p_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_i_n(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_i_multiply_int(interp, PREG(1), IREG(2));
+    IREG(1) = (INTVAL)(NREG(2));
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_mul_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_i_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_i_multiply_int(interp, PREG(1), ICONST(2));
+    IREG(1) = (INTVAL)(NCONST(2));
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_mul_p_n(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_i_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_i_multiply_float(interp, PREG(1), NREG(2));
+    IREG(1) = Parrot_str_to_int(interp, SREG(2));
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_mul_p_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_i_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_i_multiply_float(interp, PREG(1), NCONST(2));
+    IREG(1) = Parrot_str_to_int(interp, SCONST(2));
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_mul_i_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_n_n(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = IREG(2) * IREG(3);
+    NREG(1) = NREG(2);
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_mul_i_ic_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_n_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = ICONST(2) * IREG(3);
+    NREG(1) = NCONST(2);
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_mul_i_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_n_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = IREG(2) * ICONST(3);
+    NREG(1) = (FLOATVAL)IREG(2);
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_mul_n_n_n(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_n_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    NREG(1) = NREG(2) * NREG(3);
+    NREG(1) = (FLOATVAL)ICONST(2);
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_mul_n_nc_n(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_n_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    NREG(1) = NCONST(2) * NREG(3);
+    NREG(1) = Parrot_str_to_num(interp, SREG(2));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_mul_n_n_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_n_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    NREG(1) = NREG(2) * NCONST(3);
+    NREG(1) = Parrot_str_to_num(interp, SCONST(2));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_mul_p_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_n_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_multiply(interp, PREG(2), PREG(3), PREG(1));
+    NREG(1) = VTABLE_get_number(interp, PREG(2));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_mul_p_p_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_s_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_multiply_int(interp, PREG(2), IREG(3), PREG(1));
+    SREG(1) = VTABLE_get_string(interp, PREG(2));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_mul_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_s_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_multiply_int(interp, PREG(2), ICONST(3), PREG(1));
+    SREG(1) = SREG(2);
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_mul_p_p_n(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_s_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_multiply_float(interp, PREG(2), NREG(3), PREG(1));
+    SREG(1) = SCONST(2);
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_mul_p_p_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_s_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_multiply_float(interp, PREG(2), NCONST(3), PREG(1));
+    SREG(1) = Parrot_str_from_int(interp, IREG(2));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_neg_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_s_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = - IREG(1);
+    SREG(1) = Parrot_str_from_int(interp, ICONST(2));
 
-return (opcode_t *)cur_opcode + 2;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_neg_n(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_s_n(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    NREG(1) = - NREG(1);
+    SREG(1) = Parrot_str_from_num(interp, NREG(2));
 
-return (opcode_t *)cur_opcode + 2;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_neg_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_s_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_i_neg(interp, PREG(1));
+    SREG(1) = Parrot_str_from_num(interp, NCONST(2));
 
-return (opcode_t *)cur_opcode + 2;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_neg_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_p_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = - IREG(2);
+    PREG(1) = PCONST(2);
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_neg_n_n(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    NREG(1) = - NREG(2);
+    PREG(1) = PREG(2);
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_neg_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_p_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_neg(interp, PREG(2), PREG(1));
+    VTABLE_set_integer_native(interp, PREG(1), IREG(2));
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_sub_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) -= IREG(2);
+    VTABLE_set_integer_native(interp, PREG(1), ICONST(2));
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_sub_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_p_n(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) -= ICONST(2);
+    VTABLE_set_number_native(interp, PREG(1), NREG(2));
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_sub_n_n(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_p_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    NREG(1) -= NREG(2);
+    VTABLE_set_number_native(interp, PREG(1), NCONST(2));
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_sub_n_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_p_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    NREG(1) -= NCONST(2);
+    VTABLE_set_string_native(interp, PREG(1), SREG(2));
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_sub_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_p_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_i_subtract(interp, PREG(1), PREG(2));
+    VTABLE_set_string_native(interp, PREG(1), SCONST(2));
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_sub_p_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_i_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_i_subtract_int(interp, PREG(1), IREG(2));
+    IREG(1) = VTABLE_get_integer(interp, PREG(2));
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_sub_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_assign_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_i_subtract_int(interp, PREG(1), ICONST(2));
+    VTABLE_assign_pmc(interp, PREG(1), PREG(2));
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_sub_p_n(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_assign_p_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_i_subtract_float(interp, PREG(1), NREG(2));
+    VTABLE_set_integer_native(interp, PREG(1), IREG(2));
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_sub_p_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_assign_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_i_subtract_float(interp, PREG(1), NCONST(2));
+    VTABLE_set_integer_native(interp, PREG(1), ICONST(2));
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_sub_i_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_assign_p_n(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = IREG(2) - IREG(3);
+    VTABLE_set_number_native(interp, PREG(1), NREG(2));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_sub_i_ic_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_assign_p_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = ICONST(2) - IREG(3);
+    VTABLE_set_number_native(interp, PREG(1), NCONST(2));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_sub_i_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_assign_p_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = IREG(2) - ICONST(3);
+    VTABLE_assign_string_native(interp, PREG(1), SREG(2));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_sub_n_n_n(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_assign_p_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    NREG(1) = NREG(2) - NREG(3);
+    VTABLE_assign_string_native(interp, PREG(1), SCONST(2));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_sub_n_nc_n(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_assign_s_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    NREG(1) = NCONST(2) - NREG(3);
+    SREG(1) = SREG(2);
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_sub_n_n_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_assign_s_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    NREG(1) = NREG(2) - NCONST(3);
+    SREG(1) = SCONST(2);
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_sub_p_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_setref_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_subtract(interp, PREG(2), PREG(3), PREG(1));
+    VTABLE_set_pmc(interp, PREG(1), PREG(2));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_sub_p_p_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_deref_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_subtract_int(interp, PREG(2), IREG(3), PREG(1));
+    PREG(1) = VTABLE_get_pmc(interp, PREG(2));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_sub_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_p_ki_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_subtract_int(interp, PREG(2), ICONST(3), PREG(1));
+    VTABLE_set_integer_keyed_int(interp, PREG(1), IREG(2), IREG(3));
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_sub_p_p_n(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_p_kic_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_subtract_float(interp, PREG(2), NREG(3), PREG(1));
+    VTABLE_set_integer_keyed_int(interp, PREG(1), ICONST(2), IREG(3));
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_sub_p_p_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_p_ki_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_subtract_float(interp, PREG(2), NCONST(3), PREG(1));
+    VTABLE_set_integer_keyed_int(interp, PREG(1), IREG(2), ICONST(3));
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_sqrt_n_n(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_p_kic_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    NREG(1) = sqrt((FLOATVAL)NREG(2));
+    VTABLE_set_integer_keyed_int(interp, PREG(1), ICONST(2), ICONST(3));
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_callmethodcc_p_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_p_ki_n(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC      * const object     = PREG(1);
-    STRING   * const meth       = SREG(2);
-    opcode_t * const next       = cur_opcode + 3;
-
-    PMC      * const method_pmc = VTABLE_find_method(interp, object, meth);
-    opcode_t *dest              = NULL;
-
-    Parrot_pcc_set_pc_func(interp, CURRENT_CONTEXT(interp), next);
-
-    if (!PMC_IS_NULL(method_pmc)) {
-        PMC * const signature = Parrot_pcc_get_signature(interp,
-                                    CURRENT_CONTEXT(interp));
-        if (!PMC_IS_NULL(signature))
-            Parrot_pcc_set_object(interp, signature, object);
+    VTABLE_set_number_keyed_int(interp, PREG(1), IREG(2), NREG(3));
 
-        interp->current_cont = NEED_CONTINUATION;
-        dest                 = VTABLE_invoke(interp, method_pmc, next);
-    }
-    else {
-        PMC * const _class = VTABLE_get_class(interp, object);
-        if (PMC_IS_NULL(_class)) {
-            dest = Parrot_ex_throw_from_op_args(interp, next,
-                EXCEPTION_METHOD_NOT_FOUND,
-                "Method '%Ss' not found for non-object", meth);
-        }
-        else {
-            dest = Parrot_ex_throw_from_op_args(interp, next,
-                EXCEPTION_METHOD_NOT_FOUND,
-                "Method '%Ss' not found for invocant of class '%Ss'", meth,
-                VTABLE_get_string(interp, _class));
-        }
-    }return (opcode_t *)dest;
-}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_callmethodcc_p_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_p_kic_n(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC      * const object     = PREG(1);
-    STRING   * const meth       = SCONST(2);
-    opcode_t * const next       = cur_opcode + 3;
-
-    PMC      * const method_pmc = VTABLE_find_method(interp, object, meth);
-    opcode_t *dest              = NULL;
-
-    Parrot_pcc_set_pc_func(interp, CURRENT_CONTEXT(interp), next);
-
-    if (!PMC_IS_NULL(method_pmc)) {
-        PMC * const signature = Parrot_pcc_get_signature(interp,
-                                    CURRENT_CONTEXT(interp));
-        if (!PMC_IS_NULL(signature))
-            Parrot_pcc_set_object(interp, signature, object);
+    VTABLE_set_number_keyed_int(interp, PREG(1), ICONST(2), NREG(3));
 
-        interp->current_cont = NEED_CONTINUATION;
-        dest                 = VTABLE_invoke(interp, method_pmc, next);
-    }
-    else {
-        PMC * const _class = VTABLE_get_class(interp, object);
-        if (PMC_IS_NULL(_class)) {
-            dest = Parrot_ex_throw_from_op_args(interp, next,
-                EXCEPTION_METHOD_NOT_FOUND,
-                "Method '%Ss' not found for non-object", meth);
-        }
-        else {
-            dest = Parrot_ex_throw_from_op_args(interp, next,
-                EXCEPTION_METHOD_NOT_FOUND,
-                "Method '%Ss' not found for invocant of class '%Ss'", meth,
-                VTABLE_get_string(interp, _class));
-        }
-    }return (opcode_t *)dest;
-}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_callmethodcc_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_p_ki_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    opcode_t        *dest;
-    opcode_t * const next  = cur_opcode + 3;
-    PMC      *       signature  = Parrot_pcc_get_signature(interp,
-                                    CURRENT_CONTEXT(interp));
-
-    Parrot_pcc_set_pc_func(interp, CURRENT_CONTEXT(interp), next);
+    VTABLE_set_number_keyed_int(interp, PREG(1), IREG(2), NCONST(3));
 
-    if (!PMC_IS_NULL(signature))
-        Parrot_pcc_set_object(interp, signature, PREG(1));
-    interp->current_cont   = NEED_CONTINUATION;
-    dest                   = VTABLE_invoke(interp, PREG(2), next);return (opcode_t *)dest;
-}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_callmethod_p_s_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_p_kic_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC      * const object     = PREG(1);
-    STRING   * const meth       = SREG(2);
-    opcode_t * const next       = cur_opcode + 4;
-
-    PMC      * const method_pmc = VTABLE_find_method(interp, object, meth);
-    opcode_t *dest              = NULL;
-    PMC      *       signature  = Parrot_pcc_get_signature(interp,
-                                    CURRENT_CONTEXT(interp));
-
-    Parrot_pcc_set_pc_func(interp, CURRENT_CONTEXT(interp), next);
+    VTABLE_set_number_keyed_int(interp, PREG(1), ICONST(2), NCONST(3));
 
-    if (PMC_IS_NULL(method_pmc)) {
-        dest = Parrot_ex_throw_from_op_args(interp, next, EXCEPTION_METHOD_NOT_FOUND,
-            "Method '%Ss' not found for invocant of class '%Ss'", meth,
-            VTABLE_get_string(interp, VTABLE_get_class(interp, object)));
-    }
-    else {
-        if (!PMC_IS_NULL(signature))
-            Parrot_pcc_set_object(interp, signature, object);
-        interp->current_cont = PREG(3);
-        dest = (opcode_t *)VTABLE_invoke(interp, method_pmc, next);
-    }return (opcode_t *)dest;
-}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_callmethod_p_sc_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_p_ki_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC      * const object     = PREG(1);
-    STRING   * const meth       = SCONST(2);
-    opcode_t * const next       = cur_opcode + 4;
-
-    PMC      * const method_pmc = VTABLE_find_method(interp, object, meth);
-    opcode_t *dest              = NULL;
-    PMC      *       signature  = Parrot_pcc_get_signature(interp,
-                                    CURRENT_CONTEXT(interp));
+    VTABLE_set_string_keyed_int(interp, PREG(1), IREG(2), SREG(3));
 
-    Parrot_pcc_set_pc_func(interp, CURRENT_CONTEXT(interp), next);
+return (opcode_t *)cur_opcode + 4;}
 
-    if (PMC_IS_NULL(method_pmc)) {
-        dest = Parrot_ex_throw_from_op_args(interp, next, EXCEPTION_METHOD_NOT_FOUND,
-            "Method '%Ss' not found for invocant of class '%Ss'", meth,
-            VTABLE_get_string(interp, VTABLE_get_class(interp, object)));
-    }
-    else {
-        if (!PMC_IS_NULL(signature))
-            Parrot_pcc_set_object(interp, signature, object);
-        interp->current_cont = PREG(3);
-        dest = (opcode_t *)VTABLE_invoke(interp, method_pmc, next);
-    }return (opcode_t *)dest;
-}
+opcode_t *
+Parrot_set_p_kic_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_set_string_keyed_int(interp, PREG(1), ICONST(2), SREG(3));
+
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_callmethod_p_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_p_ki_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC      * const object     = PREG(1);
-    PMC      * const method_pmc = PREG(2);
-    opcode_t * const next       = cur_opcode + 4;
+    VTABLE_set_string_keyed_int(interp, PREG(1), IREG(2), SCONST(3));
 
-    opcode_t *dest;
-    PMC      *       signature  = Parrot_pcc_get_signature(interp,
-                                    CURRENT_CONTEXT(interp));
+return (opcode_t *)cur_opcode + 4;}
 
-    Parrot_pcc_set_pc_func(interp, CURRENT_CONTEXT(interp), next);
+opcode_t *
+Parrot_set_p_kic_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_set_string_keyed_int(interp, PREG(1), ICONST(2), SCONST(3));
 
-    if (!PMC_IS_NULL(signature))
-        Parrot_pcc_set_object(interp, signature, object);
-    interp->current_cont = PREG(3);
-    dest = (opcode_t *)VTABLE_invoke(interp, method_pmc, next);return (opcode_t *)dest;
-}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_tailcallmethod_p_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_p_ki_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    opcode_t * const next       = cur_opcode + 3;
-    PMC      * const object     = PREG(1);
-    STRING   * const meth       = SREG(2);
-    PMC      * const method_pmc = VTABLE_find_method(interp, object, meth);
+    VTABLE_set_pmc_keyed_int(interp, PREG(1), IREG(2), PREG(3));
 
-    opcode_t *dest;
-    PMC      *       signature  = Parrot_pcc_get_signature(interp,
-                                    CURRENT_CONTEXT(interp));
+return (opcode_t *)cur_opcode + 4;}
 
-    if (PMC_IS_NULL(method_pmc)) {
-        dest = Parrot_ex_throw_from_op_args(interp, next, EXCEPTION_METHOD_NOT_FOUND,
-            "Method '%Ss' not found for invocant of class '%Ss'", meth,
-            VTABLE_get_string(interp, VTABLE_get_class(interp, object)));
-    }
-    else {
-        interp->current_cont = Parrot_pcc_get_continuation(interp, CURRENT_CONTEXT(interp));
-        PObj_get_FLAGS(interp->current_cont) |= SUB_FLAG_TAILCALL;
-        if (!PMC_IS_NULL(signature))
-            Parrot_pcc_set_object(interp, signature, object);
-        dest = (opcode_t *)VTABLE_invoke(interp, method_pmc, next);
-    }return (opcode_t *)dest;
-}
+opcode_t *
+Parrot_set_p_kic_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_set_pmc_keyed_int(interp, PREG(1), ICONST(2), PREG(3));
+
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_tailcallmethod_p_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_i_p_ki(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    opcode_t * const next       = cur_opcode + 3;
-    PMC      * const object     = PREG(1);
-    STRING   * const meth       = SCONST(2);
-    PMC      * const method_pmc = VTABLE_find_method(interp, object, meth);
+    IREG(1) = VTABLE_get_integer_keyed_int(interp, PREG(2), IREG(3));
 
-    opcode_t *dest;
-    PMC      *       signature  = Parrot_pcc_get_signature(interp,
-                                    CURRENT_CONTEXT(interp));
+return (opcode_t *)cur_opcode + 4;}
 
-    if (PMC_IS_NULL(method_pmc)) {
-        dest = Parrot_ex_throw_from_op_args(interp, next, EXCEPTION_METHOD_NOT_FOUND,
-            "Method '%Ss' not found for invocant of class '%Ss'", meth,
-            VTABLE_get_string(interp, VTABLE_get_class(interp, object)));
-    }
-    else {
-        interp->current_cont = Parrot_pcc_get_continuation(interp, CURRENT_CONTEXT(interp));
-        PObj_get_FLAGS(interp->current_cont) |= SUB_FLAG_TAILCALL;
-        if (!PMC_IS_NULL(signature))
-            Parrot_pcc_set_object(interp, signature, object);
-        dest = (opcode_t *)VTABLE_invoke(interp, method_pmc, next);
-    }return (opcode_t *)dest;
-}
+opcode_t *
+Parrot_set_i_p_kic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = VTABLE_get_integer_keyed_int(interp, PREG(2), ICONST(3));
+
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_tailcallmethod_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_n_p_ki(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    opcode_t * const next       = cur_opcode + 3;
-    PMC      * const object     = PREG(1);
-    PMC      * const method_pmc = PREG(2);
+    NREG(1) = VTABLE_get_number_keyed_int(interp, PREG(2), IREG(3));
 
-    opcode_t *dest;
-    PMC      *       signature  = Parrot_pcc_get_signature(interp,
-                                    CURRENT_CONTEXT(interp));
+return (opcode_t *)cur_opcode + 4;}
 
-    interp->current_cont = Parrot_pcc_get_continuation(interp, CURRENT_CONTEXT(interp));
-    PObj_get_FLAGS(interp->current_cont) |= SUB_FLAG_TAILCALL;
+opcode_t *
+Parrot_set_n_p_kic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    NREG(1) = VTABLE_get_number_keyed_int(interp, PREG(2), ICONST(3));
 
-    if (!PMC_IS_NULL(signature))
-        Parrot_pcc_set_object(interp, signature, object);
-    dest = (opcode_t *)VTABLE_invoke(interp, method_pmc, next);return (opcode_t *)dest;
-}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_addmethod_p_s_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_s_p_ki(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_add_method(interp, PREG(1), SREG(2), PREG(3));
+    SREG(1) = VTABLE_get_string_keyed_int(interp, PREG(2), IREG(3));
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_addmethod_p_sc_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_s_p_kic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_add_method(interp, PREG(1), SCONST(2), PREG(3));
+    SREG(1) = VTABLE_get_string_keyed_int(interp, PREG(2), ICONST(3));
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_can_i_p_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_p_p_ki(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = VTABLE_can(interp, PREG(2), SREG(3));
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PREG(2), IREG(3));
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_can_i_p_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_p_p_kic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = VTABLE_can(interp, PREG(2), SCONST(3));
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PREG(2), ICONST(3));
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_does_i_p_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_p_k_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = SREG(3) ? VTABLE_does(interp, PREG(2), SREG(3)) : 0;
+    VTABLE_set_integer_keyed(interp, PREG(1), PREG(2), IREG(3));
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_does_i_p_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_p_kc_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = SCONST(3) ? VTABLE_does(interp, PREG(2), SCONST(3)) : 0;
+    VTABLE_set_integer_keyed(interp, PREG(1), PCONST(2), IREG(3));
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_does_i_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_p_k_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = PREG(3) ? VTABLE_does_pmc(interp, PREG(2), PREG(3)) : 0;
+    VTABLE_set_integer_keyed(interp, PREG(1), PREG(2), ICONST(3));
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_does_i_p_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_p_kc_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = PCONST(3) ? VTABLE_does_pmc(interp, PREG(2), PCONST(3)) : 0;
+    VTABLE_set_integer_keyed(interp, PREG(1), PCONST(2), ICONST(3));
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_isa_i_p_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_p_k_n(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = SREG(3) ? VTABLE_isa(interp, PREG(2), SREG(3)) : 0;
+    VTABLE_set_number_keyed(interp, PREG(1), PREG(2), NREG(3));
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_isa_i_p_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_p_kc_n(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = SCONST(3) ? VTABLE_isa(interp, PREG(2), SCONST(3)) : 0;
+    VTABLE_set_number_keyed(interp, PREG(1), PCONST(2), NREG(3));
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_isa_i_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_p_k_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = PREG(3) ? VTABLE_isa_pmc(interp, PREG(2), PREG(3)) : 0;
+    VTABLE_set_number_keyed(interp, PREG(1), PREG(2), NCONST(3));
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_isa_i_p_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_p_kc_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = PCONST(3) ? VTABLE_isa_pmc(interp, PREG(2), PCONST(3)) : 0;
+    VTABLE_set_number_keyed(interp, PREG(1), PCONST(2), NCONST(3));
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_newclass_p_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_p_k_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const name = Parrot_pmc_new(interp, enum_class_String);
-    VTABLE_set_string_native(interp, name, SREG(2));
-    PREG(1) = Parrot_pmc_new_init(interp, enum_class_Class, name);
+    VTABLE_set_string_keyed(interp, PREG(1), PREG(2), SREG(3));
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_newclass_p_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_p_kc_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const name = Parrot_pmc_new(interp, enum_class_String);
-    VTABLE_set_string_native(interp, name, SCONST(2));
-    PREG(1) = Parrot_pmc_new_init(interp, enum_class_Class, name);
+    VTABLE_set_string_keyed(interp, PREG(1), PCONST(2), SREG(3));
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_newclass_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_p_k_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = Parrot_pmc_new_init(interp, enum_class_Class, PREG(2));
+    VTABLE_set_string_keyed(interp, PREG(1), PREG(2), SCONST(3));
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_newclass_p_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_p_kc_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = Parrot_pmc_new_init(interp, enum_class_Class, PCONST(2));
+    VTABLE_set_string_keyed(interp, PREG(1), PCONST(2), SCONST(3));
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_subclass_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_p_k_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC      * const parent_class = Parrot_oo_get_class(interp, PREG(2));
-    opcode_t * const next         = cur_opcode + 3;
+    VTABLE_set_pmc_keyed(interp, PREG(1), PREG(2), PREG(3));
 
-    if (PMC_IS_NULL(parent_class)) {
-        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, next,
-            EXCEPTION_NO_CLASS,
-            "Class '%Ss' doesn't exist", VTABLE_get_string(interp, PREG(2)));return (opcode_t *)handler;
-    }
-    PREG(1) = Parrot_pmc_new(interp, enum_class_Class);
-    VTABLE_add_parent(interp, PREG(1), parent_class);return (opcode_t *)next;
-}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_subclass_p_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_p_kc_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC      * const parent_class = Parrot_oo_get_class(interp, PCONST(2));
-    opcode_t * const next         = cur_opcode + 3;
+    VTABLE_set_pmc_keyed(interp, PREG(1), PCONST(2), PREG(3));
 
-    if (PMC_IS_NULL(parent_class)) {
-        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, next,
-            EXCEPTION_NO_CLASS,
-            "Class '%Ss' doesn't exist", VTABLE_get_string(interp, PCONST(2)));return (opcode_t *)handler;
-    }
-    PREG(1) = Parrot_pmc_new(interp, enum_class_Class);
-    VTABLE_add_parent(interp, PREG(1), parent_class);return (opcode_t *)next;
-}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_subclass_p_p_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_i_p_k(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC      * const parent_class = Parrot_oo_get_class(interp, PREG(2));
-    opcode_t * const next         = cur_opcode + 4;
+    IREG(1) = VTABLE_get_integer_keyed(interp, PREG(2), PREG(3));
 
-    if (PMC_IS_NULL(parent_class)) {
-        opcode_t * handler = Parrot_ex_throw_from_op_args(interp, next,
-            EXCEPTION_NO_CLASS,
-            "Class '%Ss' doesn't exist", VTABLE_get_string(interp, PREG(2)));return (opcode_t *)handler;
-    }
-    PREG(1) = Parrot_oo_newclass_from_str(interp, SREG(3));
-    VTABLE_add_parent(interp, PREG(1), parent_class);return (opcode_t *)next;
-}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_subclass_p_pc_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_i_p_kc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC      * const parent_class = Parrot_oo_get_class(interp, PCONST(2));
-    opcode_t * const next         = cur_opcode + 4;
+    IREG(1) = VTABLE_get_integer_keyed(interp, PREG(2), PCONST(3));
 
-    if (PMC_IS_NULL(parent_class)) {
-        opcode_t * handler = Parrot_ex_throw_from_op_args(interp, next,
-            EXCEPTION_NO_CLASS,
-            "Class '%Ss' doesn't exist", VTABLE_get_string(interp, PCONST(2)));return (opcode_t *)handler;
-    }
-    PREG(1) = Parrot_oo_newclass_from_str(interp, SREG(3));
-    VTABLE_add_parent(interp, PREG(1), parent_class);return (opcode_t *)next;
-}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_subclass_p_p_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_n_p_k(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC      * const parent_class = Parrot_oo_get_class(interp, PREG(2));
-    opcode_t * const next         = cur_opcode + 4;
+    NREG(1) = VTABLE_get_number_keyed(interp, PREG(2), PREG(3));
 
-    if (PMC_IS_NULL(parent_class)) {
-        opcode_t * handler = Parrot_ex_throw_from_op_args(interp, next,
-            EXCEPTION_NO_CLASS,
-            "Class '%Ss' doesn't exist", VTABLE_get_string(interp, PREG(2)));return (opcode_t *)handler;
-    }
-    PREG(1) = Parrot_oo_newclass_from_str(interp, SCONST(3));
-    VTABLE_add_parent(interp, PREG(1), parent_class);return (opcode_t *)next;
-}
+return (opcode_t *)cur_opcode + 4;}
+
+opcode_t *
+Parrot_set_n_p_kc(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    NREG(1) = VTABLE_get_number_keyed(interp, PREG(2), PCONST(3));
+
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_subclass_p_pc_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_s_p_k(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC      * const parent_class = Parrot_oo_get_class(interp, PCONST(2));
-    opcode_t * const next         = cur_opcode + 4;
+    SREG(1) = VTABLE_get_string_keyed(interp, PREG(2), PREG(3));
 
-    if (PMC_IS_NULL(parent_class)) {
-        opcode_t * handler = Parrot_ex_throw_from_op_args(interp, next,
-            EXCEPTION_NO_CLASS,
-            "Class '%Ss' doesn't exist", VTABLE_get_string(interp, PCONST(2)));return (opcode_t *)handler;
-    }
-    PREG(1) = Parrot_oo_newclass_from_str(interp, SCONST(3));
-    VTABLE_add_parent(interp, PREG(1), parent_class);return (opcode_t *)next;
-}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_subclass_p_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_s_p_kc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC      * const parent_class = Parrot_oo_get_class(interp, PREG(2));
-    opcode_t * const next         = cur_opcode + 4;
+    SREG(1) = VTABLE_get_string_keyed(interp, PREG(2), PCONST(3));
 
-    if (PMC_IS_NULL(parent_class)) {
-        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, next,
-            EXCEPTION_NO_CLASS,
-            "Class '%Ss' doesn't exist", VTABLE_get_string(interp, PREG(2)));return (opcode_t *)handler;
-    }
-    PREG(1) = Parrot_pmc_new_init(interp, enum_class_Class, PREG(3));
-    VTABLE_add_parent(interp, PREG(1), parent_class);return (opcode_t *)next;
-}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_subclass_p_pc_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_p_p_k(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC      * const parent_class = Parrot_oo_get_class(interp, PCONST(2));
-    opcode_t * const next         = cur_opcode + 4;
+    PREG(1) = VTABLE_get_pmc_keyed(interp, PREG(2), PREG(3));
 
-    if (PMC_IS_NULL(parent_class)) {
-        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, next,
-            EXCEPTION_NO_CLASS,
-            "Class '%Ss' doesn't exist", VTABLE_get_string(interp, PCONST(2)));return (opcode_t *)handler;
-    }
-    PREG(1) = Parrot_pmc_new_init(interp, enum_class_Class, PREG(3));
-    VTABLE_add_parent(interp, PREG(1), parent_class);return (opcode_t *)next;
-}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_subclass_p_p_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_p_p_kc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC      * const parent_class = Parrot_oo_get_class(interp, PREG(2));
-    opcode_t * const next         = cur_opcode + 4;
+    PREG(1) = VTABLE_get_pmc_keyed(interp, PREG(2), PCONST(3));
 
-    if (PMC_IS_NULL(parent_class)) {
-        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, next,
-            EXCEPTION_NO_CLASS,
-            "Class '%Ss' doesn't exist", VTABLE_get_string(interp, PREG(2)));return (opcode_t *)handler;
-    }
-    PREG(1) = Parrot_pmc_new_init(interp, enum_class_Class, PCONST(3));
-    VTABLE_add_parent(interp, PREG(1), parent_class);return (opcode_t *)next;
-}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_subclass_p_pc_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_clone_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC      * const parent_class = Parrot_oo_get_class(interp, PCONST(2));
-    opcode_t * const next         = cur_opcode + 4;
+    PREG(1) = VTABLE_clone(interp, PREG(2));
 
-    if (PMC_IS_NULL(parent_class)) {
-        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, next,
-            EXCEPTION_NO_CLASS,
-            "Class '%Ss' doesn't exist", VTABLE_get_string(interp, PCONST(2)));return (opcode_t *)handler;
-    }
-    PREG(1) = Parrot_pmc_new_init(interp, enum_class_Class, PCONST(3));
-    VTABLE_add_parent(interp, PREG(1), parent_class);return (opcode_t *)next;
-}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_subclass_p_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_clone_p_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC      * const parent_class = Parrot_oo_get_class_str(interp, SREG(2));
-    opcode_t * const next         = cur_opcode + 3;
-
-    if (PMC_IS_NULL(parent_class)) {
-        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, next,
-            EXCEPTION_NO_CLASS,
-            "Class '%Ss' doesn't exist", SREG(2));return (opcode_t *)handler;
-    }
+    PREG(1) = VTABLE_clone_pmc(interp, PREG(2), PREG(3));
 
-    PREG(1) = Parrot_pmc_new(interp, enum_class_Class);
-    VTABLE_add_parent(interp, PREG(1), parent_class);return (opcode_t *)next;
-}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_subclass_p_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_clone_p_p_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC      * const parent_class = Parrot_oo_get_class_str(interp, SCONST(2));
-    opcode_t * const next         = cur_opcode + 3;
-
-    if (PMC_IS_NULL(parent_class)) {
-        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, next,
-            EXCEPTION_NO_CLASS,
-            "Class '%Ss' doesn't exist", SCONST(2));return (opcode_t *)handler;
-    }
+    PREG(1) = VTABLE_clone_pmc(interp, PREG(2), PCONST(3));
 
-    PREG(1) = Parrot_pmc_new(interp, enum_class_Class);
-    VTABLE_add_parent(interp, PREG(1), parent_class);return (opcode_t *)next;
-}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_subclass_p_s_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_copy_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC      * const parent_class = Parrot_oo_get_class_str(interp, SREG(2));
-    opcode_t * const next         = cur_opcode + 4;
-
-    if (PMC_IS_NULL(parent_class)) {
-        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, next,
-            EXCEPTION_NO_CLASS,
-            "Class '%Ss' doesn't exist", SREG(2));return (opcode_t *)handler;
+    if (PMC_IS_NULL(PREG(1))) {
+        opcode_t * const dest = cur_opcode + 3;
+        opcode_t * const handler = Parrot_ex_throw_from_op_args(interp, dest,
+                EXCEPTION_NULL_REG_ACCESS, "Null PMC in copy");return (opcode_t *)handler;
     }
+    else {
+        PMC   * const clone = VTABLE_clone(interp, PREG(2));
+        /* Preserve the metadata on the destination. */
+        PMC   * const meta  = VTABLE_getprops(interp, PREG(1));
 
-    PREG(1)  = Parrot_oo_newclass_from_str(interp, SREG(3));
-    VTABLE_add_parent(interp, PREG(1), parent_class);return (opcode_t *)next;
-}
+        /* avoid leaks and unreachable memory by destroying the destination PMC */
+        Parrot_pmc_destroy(interp, PREG(1));
 
-opcode_t *
-Parrot_subclass_p_sc_s(opcode_t *cur_opcode, PARROT_INTERP)  {
-    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC      * const parent_class = Parrot_oo_get_class_str(interp, SCONST(2));
-    opcode_t * const next         = cur_opcode + 4;
+        /* the source PMC knows how to clone itself, but we must reuse the
+         * destination header */
+        memmove(PREG(1), clone, sizeof (PMC));
 
-    if (PMC_IS_NULL(parent_class)) {
-        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, next,
-            EXCEPTION_NO_CLASS,
-            "Class '%Ss' doesn't exist", SCONST(2));return (opcode_t *)handler;
+        /* don't let the clone's destruction destroy the destination's data */
+        PObj_custom_destroy_CLEAR(clone);
+        PMC_data(clone)        = NULL;
+        PMC_metadata(clone)    = NULL;
+
+        /* Restore metadata. */
+        if (!PMC_IS_NULL(meta)) {
+            PMC * const iter = VTABLE_get_iter(interp, meta);
+            while (VTABLE_get_bool(interp, iter)) {
+                STRING * const key = VTABLE_shift_string(interp, iter);
+                PMC * const value  = VTABLE_get_pmc_keyed_str(interp, meta, key);
+                VTABLE_setprop(interp, PREG(1), key, value);
+            }
+        }
     }
 
-    PREG(1)  = Parrot_oo_newclass_from_str(interp, SREG(3));
-    VTABLE_add_parent(interp, PREG(1), parent_class);return (opcode_t *)next;
-}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_subclass_p_s_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_null_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC      * const parent_class = Parrot_oo_get_class_str(interp, SREG(2));
-    opcode_t * const next         = cur_opcode + 4;
-
-    if (PMC_IS_NULL(parent_class)) {
-        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, next,
-            EXCEPTION_NO_CLASS,
-            "Class '%Ss' doesn't exist", SREG(2));return (opcode_t *)handler;
-    }
+    SREG(1) = STRINGNULL;
 
-    PREG(1)  = Parrot_oo_newclass_from_str(interp, SCONST(3));
-    VTABLE_add_parent(interp, PREG(1), parent_class);return (opcode_t *)next;
-}
+return (opcode_t *)cur_opcode + 2;}
 
 opcode_t *
-Parrot_subclass_p_sc_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_null_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC      * const parent_class = Parrot_oo_get_class_str(interp, SCONST(2));
-    opcode_t * const next         = cur_opcode + 4;
-
-    if (PMC_IS_NULL(parent_class)) {
-        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, next,
-            EXCEPTION_NO_CLASS,
-            "Class '%Ss' doesn't exist", SCONST(2));return (opcode_t *)handler;
-    }
+    IREG(1) = 0;
 
-    PREG(1)  = Parrot_oo_newclass_from_str(interp, SCONST(3));
-    VTABLE_add_parent(interp, PREG(1), parent_class);return (opcode_t *)next;
-}
+return (opcode_t *)cur_opcode + 2;}
 
 opcode_t *
-Parrot_subclass_p_s_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_null_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC      * const parent_class = Parrot_oo_get_class_str(interp, SREG(2));
-    opcode_t * const next         = cur_opcode + 4;
+    PREG(1) = PMCNULL;
 
-    if (PMC_IS_NULL(parent_class)) {
-        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, next,
-            EXCEPTION_NO_CLASS,
-            "Class '%Ss' doesn't exist", SREG(2));return (opcode_t *)handler;
-    }
+return (opcode_t *)cur_opcode + 2;}
 
-    PREG(1) = Parrot_pmc_new_init(interp, enum_class_Class, PREG(3));
-    VTABLE_add_parent(interp, PREG(1), parent_class);return (opcode_t *)next;
-}
+opcode_t *
+Parrot_null_n(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    NREG(1) = 0;
+
+return (opcode_t *)cur_opcode + 2;}
 
 opcode_t *
-Parrot_subclass_p_sc_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_ord_i_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC      * const parent_class = Parrot_oo_get_class_str(interp, SCONST(2));
-    opcode_t * const next         = cur_opcode + 4;
+    IREG(1) = STRING_ord(interp, SREG(2), 0);
 
-    if (PMC_IS_NULL(parent_class)) {
-        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, next,
-            EXCEPTION_NO_CLASS,
-            "Class '%Ss' doesn't exist", SCONST(2));return (opcode_t *)handler;
-    }
+return (opcode_t *)cur_opcode + 3;}
 
-    PREG(1) = Parrot_pmc_new_init(interp, enum_class_Class, PREG(3));
-    VTABLE_add_parent(interp, PREG(1), parent_class);return (opcode_t *)next;
-}
+opcode_t *
+Parrot_ord_i_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = STRING_ord(interp, SCONST(2), 0);
+
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_subclass_p_s_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_ord_i_s_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC      * const parent_class = Parrot_oo_get_class_str(interp, SREG(2));
-    opcode_t * const next         = cur_opcode + 4;
+    IREG(1) = STRING_ord(interp, SREG(2), IREG(3));
 
-    if (PMC_IS_NULL(parent_class)) {
-        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, next,
-            EXCEPTION_NO_CLASS,
-            "Class '%Ss' doesn't exist", SREG(2));return (opcode_t *)handler;
-    }
+return (opcode_t *)cur_opcode + 4;}
 
-    PREG(1) = Parrot_pmc_new_init(interp, enum_class_Class, PCONST(3));
-    VTABLE_add_parent(interp, PREG(1), parent_class);return (opcode_t *)next;
-}
+opcode_t *
+Parrot_ord_i_sc_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = STRING_ord(interp, SCONST(2), IREG(3));
+
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_subclass_p_sc_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_ord_i_s_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC      * const parent_class = Parrot_oo_get_class_str(interp, SCONST(2));
-    opcode_t * const next         = cur_opcode + 4;
+    IREG(1) = STRING_ord(interp, SREG(2), ICONST(3));
 
-    if (PMC_IS_NULL(parent_class)) {
-        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, next,
-            EXCEPTION_NO_CLASS,
-            "Class '%Ss' doesn't exist", SCONST(2));return (opcode_t *)handler;
-    }
+return (opcode_t *)cur_opcode + 4;}
+
+opcode_t *
+Parrot_ord_i_sc_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = STRING_ord(interp, SCONST(2), ICONST(3));
 
-    PREG(1) = Parrot_pmc_new_init(interp, enum_class_Class, PCONST(3));
-    VTABLE_add_parent(interp, PREG(1), parent_class);return (opcode_t *)next;
-}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_get_class_p_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_chr_s_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = Parrot_oo_get_class_str(interp, SREG(2));
+    STRING * const s = Parrot_str_chr(interp, (UINTVAL)IREG(2));
+    SREG(1) = s;
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_get_class_p_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_chr_s_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = Parrot_oo_get_class_str(interp, SCONST(2));
+    STRING * const s = Parrot_str_chr(interp, (UINTVAL)ICONST(2));
+    SREG(1) = s;
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_get_class_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_chopn_s_s_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = Parrot_oo_get_class(interp, PREG(2));
+    SREG(1) = Parrot_str_chopn(interp, SREG(2), IREG(3));
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_get_class_p_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_chopn_s_sc_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = Parrot_oo_get_class(interp, PCONST(2));
+    SREG(1) = Parrot_str_chopn(interp, SCONST(2), IREG(3));
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_class_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_chopn_s_s_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_get_class(interp, PREG(2));
+    SREG(1) = Parrot_str_chopn(interp, SREG(2), ICONST(3));
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_addparent_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_chopn_s_sc_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_add_parent(interp, PREG(1), PREG(2));
+    SREG(1) = Parrot_str_chopn(interp, SCONST(2), ICONST(3));
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_removeparent_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_concat_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_remove_parent(interp, PREG(1), PREG(2));
+    VTABLE_i_concatenate(interp, PREG(1), PREG(2));
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_addrole_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_concat_p_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_add_role(interp, PREG(1), PREG(2));
+    VTABLE_i_concatenate_str(interp, PREG(1), SREG(2));
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_addattribute_p_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_concat_p_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_add_attribute(interp, PREG(1), SREG(2), PMCNULL);
+    VTABLE_i_concatenate_str(interp, PREG(1), SCONST(2));
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_addattribute_p_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_concat_s_s_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_add_attribute(interp, PREG(1), SCONST(2), PMCNULL);
+    SREG(1) = Parrot_str_concat(interp, SREG(2), SREG(3));
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_removeattribute_p_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_concat_s_sc_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_remove_attribute(interp, PREG(1), SREG(2));
+    SREG(1) = Parrot_str_concat(interp, SCONST(2), SREG(3));
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_removeattribute_p_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_concat_s_s_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_remove_attribute(interp, PREG(1), SCONST(2));
+    SREG(1) = Parrot_str_concat(interp, SREG(2), SCONST(3));
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_getattribute_p_p_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_concat_p_p_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_get_attr_str(interp, PREG(2), SREG(3));
+    PREG(1) = VTABLE_concatenate_str(interp, PREG(2), SREG(3), PREG(1));
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_getattribute_p_p_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_concat_p_p_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_get_attr_str(interp, PREG(2), SCONST(3));
+    PREG(1) = VTABLE_concatenate_str(interp, PREG(2), SCONST(3), PREG(1));
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_getattribute_p_p_p_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_concat_p_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_get_attr_keyed(interp, PREG(2), PREG(3), SREG(4));
+    PREG(1) = VTABLE_concatenate(interp, PREG(2), PREG(3), PREG(1));
 
-return (opcode_t *)cur_opcode + 5;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_getattribute_p_p_pc_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_repeat_s_s_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_get_attr_keyed(interp, PREG(2), PCONST(3), SREG(4));
+    if (IREG(3) < 0) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, NULL,
+                EXCEPTION_NEG_REPEAT,
+                "Cannot repeat with negative arg");return (opcode_t *)handler;
+    }
+    SREG(1) = Parrot_str_repeat(interp, SREG(2), (UINTVAL)IREG(3));
 
-return (opcode_t *)cur_opcode + 5;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_getattribute_p_p_p_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_repeat_s_sc_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_get_attr_keyed(interp, PREG(2), PREG(3), SCONST(4));
+    if (IREG(3) < 0) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, NULL,
+                EXCEPTION_NEG_REPEAT,
+                "Cannot repeat with negative arg");return (opcode_t *)handler;
+    }
+    SREG(1) = Parrot_str_repeat(interp, SCONST(2), (UINTVAL)IREG(3));
 
-return (opcode_t *)cur_opcode + 5;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_getattribute_p_p_pc_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_repeat_s_s_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_get_attr_keyed(interp, PREG(2), PCONST(3), SCONST(4));
+    if (ICONST(3) < 0) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, NULL,
+                EXCEPTION_NEG_REPEAT,
+                "Cannot repeat with negative arg");return (opcode_t *)handler;
+    }
+    SREG(1) = Parrot_str_repeat(interp, SREG(2), (UINTVAL)ICONST(3));
 
-return (opcode_t *)cur_opcode + 5;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_setattribute_p_s_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_repeat_s_sc_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_set_attr_str(interp, PREG(1), SREG(2), PREG(3));
+    if (ICONST(3) < 0) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, NULL,
+                EXCEPTION_NEG_REPEAT,
+                "Cannot repeat with negative arg");return (opcode_t *)handler;
+    }
+    SREG(1) = Parrot_str_repeat(interp, SCONST(2), (UINTVAL)ICONST(3));
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_setattribute_p_sc_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_repeat_p_p_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_set_attr_str(interp, PREG(1), SCONST(2), PREG(3));
+    if (IREG(3) < 0) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, NULL,
+                EXCEPTION_NEG_REPEAT,
+                "Cannot repeat with negative arg");return (opcode_t *)handler;
+    }
+    PREG(1) = VTABLE_repeat_int(interp, PREG(2), IREG(3), PREG(1));
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_setattribute_p_p_s_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_repeat_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_set_attr_keyed(interp, PREG(1), PREG(2), SREG(3), PREG(4));
+    if (ICONST(3) < 0) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, NULL,
+                EXCEPTION_NEG_REPEAT,
+                "Cannot repeat with negative arg");return (opcode_t *)handler;
+    }
+    PREG(1) = VTABLE_repeat_int(interp, PREG(2), ICONST(3), PREG(1));
 
-return (opcode_t *)cur_opcode + 5;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_setattribute_p_pc_s_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_repeat_p_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_set_attr_keyed(interp, PREG(1), PCONST(2), SREG(3), PREG(4));
+    if (VTABLE_get_integer(interp, PREG(3)) < 0) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, NULL,
+                EXCEPTION_NEG_REPEAT,
+                "Cannot repeat with negative arg");return (opcode_t *)handler;
+    }
+    PREG(1) = VTABLE_repeat(interp, PREG(2), PREG(3), PREG(1));
 
-return (opcode_t *)cur_opcode + 5;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_setattribute_p_p_sc_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_repeat_p_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_set_attr_keyed(interp, PREG(1), PREG(2), SCONST(3), PREG(4));
+    VTABLE_i_repeat_int(interp, PREG(1), IREG(2));
 
-return (opcode_t *)cur_opcode + 5;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_setattribute_p_pc_sc_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_repeat_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_set_attr_keyed(interp, PREG(1), PCONST(2), SCONST(3), PREG(4));
+    VTABLE_i_repeat_int(interp, PREG(1), ICONST(2));
 
-return (opcode_t *)cur_opcode + 5;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_inspect_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_repeat_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_inspect(interp, PREG(2));
+    VTABLE_i_repeat(interp, PREG(1), PREG(2));
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_inspect_p_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_length_i_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_inspect(interp, PCONST(2));
+    IREG(1) = Parrot_str_length(interp, SREG(2));
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_inspect_p_p_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_length_i_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_inspect_str(interp, PREG(2), SREG(3));
+    IREG(1) = Parrot_str_length(interp, SCONST(2));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_inspect_p_pc_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_bytelength_i_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_inspect_str(interp, PCONST(2), SREG(3));
+    IREG(1) = Parrot_str_byte_length(interp, SREG(2));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_inspect_p_p_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_bytelength_i_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_inspect_str(interp, PREG(2), SCONST(3));
+    IREG(1) = Parrot_str_byte_length(interp, SCONST(2));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_inspect_p_pc_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_pin_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_inspect_str(interp, PCONST(2), SCONST(3));
+    Parrot_str_pin(interp, SREG(1));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 2;}
 
 opcode_t *
-Parrot_new_p_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_unpin_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    STRING * const name   = SREG(2);
-    PMC    * const _class = Parrot_pcc_get_HLL(interp, CURRENT_CONTEXT(interp))
-                          ? Parrot_oo_get_class_str(interp, name)
-                          : PMCNULL;
+    Parrot_str_unpin(interp, SREG(1));
 
-    if (!PMC_IS_NULL(_class))
-        PREG(1) = VTABLE_instantiate(interp, _class, PMCNULL);
-    else {
-        const INTVAL type = Parrot_pmc_get_type_str(interp, name);
-        if (type <= 0) {
-            opcode_t * const dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 3,
-                EXCEPTION_NO_CLASS,
-                "Class '%Ss' not found", name);return (opcode_t *)dest;
-        }
-        PREG(1) = Parrot_pmc_new(interp, type);
-    }
+return (opcode_t *)cur_opcode + 2;}
 
-return (opcode_t *)cur_opcode + 3;}
+opcode_t *
+Parrot_substr_s_s_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    const INTVAL len = Parrot_str_byte_length(interp, SREG(2));
+    SREG(1) = STRING_substr(interp, SREG(2), IREG(3), len);
+
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_new_p_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_substr_s_sc_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    STRING * const name   = SCONST(2);
-    PMC    * const _class = Parrot_pcc_get_HLL(interp, CURRENT_CONTEXT(interp))
-                          ? Parrot_oo_get_class_str(interp, name)
-                          : PMCNULL;
+    const INTVAL len = Parrot_str_byte_length(interp, SCONST(2));
+    SREG(1) = STRING_substr(interp, SCONST(2), IREG(3), len);
 
-    if (!PMC_IS_NULL(_class))
-        PREG(1) = VTABLE_instantiate(interp, _class, PMCNULL);
-    else {
-        const INTVAL type = Parrot_pmc_get_type_str(interp, name);
-        if (type <= 0) {
-            opcode_t * const dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 3,
-                EXCEPTION_NO_CLASS,
-                "Class '%Ss' not found", name);return (opcode_t *)dest;
-        }
-        PREG(1) = Parrot_pmc_new(interp, type);
-    }
+return (opcode_t *)cur_opcode + 4;}
+
+opcode_t *
+Parrot_substr_s_s_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    const INTVAL len = Parrot_str_byte_length(interp, SREG(2));
+    SREG(1) = STRING_substr(interp, SREG(2), ICONST(3), len);
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_new_p_s_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_substr_s_sc_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    STRING * const name   = SREG(2);
-    PMC    * const _class = Parrot_pcc_get_HLL(interp, CURRENT_CONTEXT(interp))
-                          ? Parrot_oo_get_class_str(interp, name)
-                          : PMCNULL;
-
-    if (!PMC_IS_NULL(_class))
-        PREG(1) = VTABLE_instantiate(interp, _class, PREG(3));
-    else {
-        const INTVAL type = Parrot_pmc_get_type_str(interp, name);
-        if (type <= 0) {
-            opcode_t * const dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
-                EXCEPTION_NO_CLASS,
-                "Class '%Ss' not found", name);return (opcode_t *)dest;
-        }
-        PREG(1) = Parrot_pmc_new_init(interp, type, PREG(3));
-    }
+    const INTVAL len = Parrot_str_byte_length(interp, SCONST(2));
+    SREG(1) = STRING_substr(interp, SCONST(2), ICONST(3), len);
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_new_p_sc_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_substr_s_s_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    STRING * const name   = SCONST(2);
-    PMC    * const _class = Parrot_pcc_get_HLL(interp, CURRENT_CONTEXT(interp))
-                          ? Parrot_oo_get_class_str(interp, name)
-                          : PMCNULL;
-
-    if (!PMC_IS_NULL(_class))
-        PREG(1) = VTABLE_instantiate(interp, _class, PREG(3));
-    else {
-        const INTVAL type = Parrot_pmc_get_type_str(interp, name);
-        if (type <= 0) {
-            opcode_t * const dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
-                EXCEPTION_NO_CLASS,
-                "Class '%Ss' not found", name);return (opcode_t *)dest;
-        }
-        PREG(1) = Parrot_pmc_new_init(interp, type, PREG(3));
-    }
+    SREG(1) = STRING_substr(interp, SREG(2), IREG(3), IREG(4));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 5;}
 
 opcode_t *
-Parrot_new_p_s_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_substr_s_sc_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    STRING * const name   = SREG(2);
-    PMC    * const _class = Parrot_pcc_get_HLL(interp, CURRENT_CONTEXT(interp))
-                          ? Parrot_oo_get_class_str(interp, name)
-                          : PMCNULL;
-
-    if (!PMC_IS_NULL(_class))
-        PREG(1) = VTABLE_instantiate(interp, _class, PCONST(3));
-    else {
-        const INTVAL type = Parrot_pmc_get_type_str(interp, name);
-        if (type <= 0) {
-            opcode_t * const dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
-                EXCEPTION_NO_CLASS,
-                "Class '%Ss' not found", name);return (opcode_t *)dest;
-        }
-        PREG(1) = Parrot_pmc_new_init(interp, type, PCONST(3));
-    }
+    SREG(1) = STRING_substr(interp, SCONST(2), IREG(3), IREG(4));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 5;}
 
 opcode_t *
-Parrot_new_p_sc_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_substr_s_s_ic_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    STRING * const name   = SCONST(2);
-    PMC    * const _class = Parrot_pcc_get_HLL(interp, CURRENT_CONTEXT(interp))
-                          ? Parrot_oo_get_class_str(interp, name)
-                          : PMCNULL;
+    SREG(1) = STRING_substr(interp, SREG(2), ICONST(3), IREG(4));
 
-    if (!PMC_IS_NULL(_class))
-        PREG(1) = VTABLE_instantiate(interp, _class, PCONST(3));
-    else {
-        const INTVAL type = Parrot_pmc_get_type_str(interp, name);
-        if (type <= 0) {
-            opcode_t * const dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
-                EXCEPTION_NO_CLASS,
-                "Class '%Ss' not found", name);return (opcode_t *)dest;
-        }
-        PREG(1) = Parrot_pmc_new_init(interp, type, PCONST(3));
-    }
+return (opcode_t *)cur_opcode + 5;}
 
-return (opcode_t *)cur_opcode + 4;}
+opcode_t *
+Parrot_substr_s_sc_ic_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    SREG(1) = STRING_substr(interp, SCONST(2), ICONST(3), IREG(4));
+
+return (opcode_t *)cur_opcode + 5;}
 
 opcode_t *
-Parrot_new_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_substr_s_s_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const name_key = PREG(2);
-    PMC * const _class   = Parrot_oo_get_class(interp, name_key);
+    SREG(1) = STRING_substr(interp, SREG(2), IREG(3), ICONST(4));
 
-    if (!PMC_IS_NULL(_class))
-        PREG(1) = VTABLE_instantiate(interp, _class, PMCNULL);
-    else {
-        const INTVAL type = Parrot_pmc_get_type(interp, name_key);
-        if (type <= 0) {
-            opcode_t * const dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 3,
-                EXCEPTION_NO_CLASS,
-                "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));return (opcode_t *)dest;
-        }
-        PREG(1) = Parrot_pmc_new(interp, type);
-    }
+return (opcode_t *)cur_opcode + 5;}
 
-return (opcode_t *)cur_opcode + 3;}
+opcode_t *
+Parrot_substr_s_sc_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    SREG(1) = STRING_substr(interp, SCONST(2), IREG(3), ICONST(4));
+
+return (opcode_t *)cur_opcode + 5;}
 
 opcode_t *
-Parrot_new_p_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_substr_s_s_ic_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const name_key = PCONST(2);
-    PMC * const _class   = Parrot_oo_get_class(interp, name_key);
+    SREG(1) = STRING_substr(interp, SREG(2), ICONST(3), ICONST(4));
 
-    if (!PMC_IS_NULL(_class))
-        PREG(1) = VTABLE_instantiate(interp, _class, PMCNULL);
-    else {
-        const INTVAL type = Parrot_pmc_get_type(interp, name_key);
-        if (type <= 0) {
-            opcode_t * const dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 3,
-                EXCEPTION_NO_CLASS,
-                "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));return (opcode_t *)dest;
-        }
-        PREG(1) = Parrot_pmc_new(interp, type);
-    }
+return (opcode_t *)cur_opcode + 5;}
 
-return (opcode_t *)cur_opcode + 3;}
+opcode_t *
+Parrot_substr_s_sc_ic_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    SREG(1) = STRING_substr(interp, SCONST(2), ICONST(3), ICONST(4));
+
+return (opcode_t *)cur_opcode + 5;}
 
 opcode_t *
-Parrot_new_p_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_substr_s_p_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const name_key = PREG(2);
-    PMC * const _class   = Parrot_oo_get_class(interp, name_key);
+    SREG(1) = VTABLE_substr_str(interp, PREG(2), IREG(3), IREG(4));
 
-    if (!PMC_IS_NULL(_class))
-        PREG(1) = VTABLE_instantiate(interp, _class, PREG(3));
-    else {
-        const INTVAL type = Parrot_pmc_get_type(interp, name_key);
-        if (type <= 0) {
-            opcode_t * const dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
-                EXCEPTION_NO_CLASS,
-                "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));return (opcode_t *)dest;
-        }
-        PREG(1) = Parrot_pmc_new_init(interp, type, PREG(3));
-    }
+return (opcode_t *)cur_opcode + 5;}
 
-return (opcode_t *)cur_opcode + 4;}
+opcode_t *
+Parrot_substr_s_p_ic_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    SREG(1) = VTABLE_substr_str(interp, PREG(2), ICONST(3), IREG(4));
+
+return (opcode_t *)cur_opcode + 5;}
 
 opcode_t *
-Parrot_new_p_pc_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_substr_s_p_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const name_key = PCONST(2);
-    PMC * const _class   = Parrot_oo_get_class(interp, name_key);
+    SREG(1) = VTABLE_substr_str(interp, PREG(2), IREG(3), ICONST(4));
 
-    if (!PMC_IS_NULL(_class))
-        PREG(1) = VTABLE_instantiate(interp, _class, PREG(3));
-    else {
-        const INTVAL type = Parrot_pmc_get_type(interp, name_key);
-        if (type <= 0) {
-            opcode_t * const dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
-                EXCEPTION_NO_CLASS,
-                "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));return (opcode_t *)dest;
-        }
-        PREG(1) = Parrot_pmc_new_init(interp, type, PREG(3));
-    }
+return (opcode_t *)cur_opcode + 5;}
 
-return (opcode_t *)cur_opcode + 4;}
+opcode_t *
+Parrot_substr_s_p_ic_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    SREG(1) = VTABLE_substr_str(interp, PREG(2), ICONST(3), ICONST(4));
+
+return (opcode_t *)cur_opcode + 5;}
 
 opcode_t *
-Parrot_new_p_p_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_replace_s_s_i_i_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const name_key = PREG(2);
-    PMC * const _class   = Parrot_oo_get_class(interp, name_key);
+    SREG(1) = Parrot_str_replace(interp, SREG(2), IREG(3), IREG(4), SREG(5));
 
-    if (!PMC_IS_NULL(_class))
-        PREG(1) = VTABLE_instantiate(interp, _class, PCONST(3));
-    else {
-        const INTVAL type = Parrot_pmc_get_type(interp, name_key);
-        if (type <= 0) {
-            opcode_t * const dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
-                EXCEPTION_NO_CLASS,
-                "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));return (opcode_t *)dest;
-        }
-        PREG(1) = Parrot_pmc_new_init(interp, type, PCONST(3));
-    }
+return (opcode_t *)cur_opcode + 6;}
 
-return (opcode_t *)cur_opcode + 4;}
+opcode_t *
+Parrot_replace_s_sc_i_i_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    SREG(1) = Parrot_str_replace(interp, SCONST(2), IREG(3), IREG(4), SREG(5));
+
+return (opcode_t *)cur_opcode + 6;}
 
 opcode_t *
-Parrot_new_p_pc_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_replace_s_s_ic_i_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const name_key = PCONST(2);
-    PMC * const _class   = Parrot_oo_get_class(interp, name_key);
+    SREG(1) = Parrot_str_replace(interp, SREG(2), ICONST(3), IREG(4), SREG(5));
 
-    if (!PMC_IS_NULL(_class))
-        PREG(1) = VTABLE_instantiate(interp, _class, PCONST(3));
-    else {
-        const INTVAL type = Parrot_pmc_get_type(interp, name_key);
-        if (type <= 0) {
-            opcode_t * const dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
-                EXCEPTION_NO_CLASS,
-                "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));return (opcode_t *)dest;
-        }
-        PREG(1) = Parrot_pmc_new_init(interp, type, PCONST(3));
-    }
+return (opcode_t *)cur_opcode + 6;}
 
-return (opcode_t *)cur_opcode + 4;}
+opcode_t *
+Parrot_replace_s_sc_ic_i_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    SREG(1) = Parrot_str_replace(interp, SCONST(2), ICONST(3), IREG(4), SREG(5));
+
+return (opcode_t *)cur_opcode + 6;}
 
 opcode_t *
-Parrot_root_new_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_replace_s_s_i_ic_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const key      = PREG(2);
-    PMC * const root_ns  = interp->root_namespace;
-    PMC * const ns       = Parrot_ns_get_namespace_keyed(interp, root_ns, key);
-    PMC * classobj       = PMCNULL;
+    SREG(1) = Parrot_str_replace(interp, SREG(2), IREG(3), ICONST(4), SREG(5));
 
-    if (!PMC_IS_NULL(ns))
-        classobj = Parrot_oo_get_class(interp, ns);
-    if (!PMC_IS_NULL(classobj))
-        PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
-    else {
-        opcode_t * const dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 3,
-            EXCEPTION_NO_CLASS,
-            "Class '%Ss' not found", VTABLE_get_repr(interp, key));return (opcode_t *)dest;
-    }
+return (opcode_t *)cur_opcode + 6;}
+
+opcode_t *
+Parrot_replace_s_sc_i_ic_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    SREG(1) = Parrot_str_replace(interp, SCONST(2), IREG(3), ICONST(4), SREG(5));
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 6;}
 
 opcode_t *
-Parrot_root_new_p_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_replace_s_s_ic_ic_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const key      = PCONST(2);
-    PMC * const root_ns  = interp->root_namespace;
-    PMC * const ns       = Parrot_ns_get_namespace_keyed(interp, root_ns, key);
-    PMC * classobj       = PMCNULL;
-
-    if (!PMC_IS_NULL(ns))
-        classobj = Parrot_oo_get_class(interp, ns);
-    if (!PMC_IS_NULL(classobj))
-        PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
-    else {
-        opcode_t * const dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 3,
-            EXCEPTION_NO_CLASS,
-            "Class '%Ss' not found", VTABLE_get_repr(interp, key));return (opcode_t *)dest;
-    }
+    SREG(1) = Parrot_str_replace(interp, SREG(2), ICONST(3), ICONST(4), SREG(5));
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 6;}
 
 opcode_t *
-Parrot_root_new_p_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_replace_s_sc_ic_ic_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const key      = PREG(2);
-    PMC * const root_ns  = interp->root_namespace;
-    PMC * const ns       = Parrot_ns_get_namespace_keyed(interp, root_ns, key);
-    PMC * classobj       = PMCNULL;
+    SREG(1) = Parrot_str_replace(interp, SCONST(2), ICONST(3), ICONST(4), SREG(5));
 
-    if (!PMC_IS_NULL(ns))
-        classobj = Parrot_oo_get_class(interp, ns);
-    if (!PMC_IS_NULL(classobj))
-        PREG(1) = VTABLE_instantiate(interp, classobj, PREG(3));
-    else {
-        opcode_t * const dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
-            EXCEPTION_NO_CLASS,
-            "Class '%Ss' not found", VTABLE_get_repr(interp, key));return (opcode_t *)dest;
-    }
+return (opcode_t *)cur_opcode + 6;}
 
-return (opcode_t *)cur_opcode + 4;}
+opcode_t *
+Parrot_replace_s_s_i_i_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    SREG(1) = Parrot_str_replace(interp, SREG(2), IREG(3), IREG(4), SCONST(5));
+
+return (opcode_t *)cur_opcode + 6;}
 
 opcode_t *
-Parrot_root_new_p_pc_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_replace_s_sc_i_i_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const key      = PCONST(2);
-    PMC * const root_ns  = interp->root_namespace;
-    PMC * const ns       = Parrot_ns_get_namespace_keyed(interp, root_ns, key);
-    PMC * classobj       = PMCNULL;
+    SREG(1) = Parrot_str_replace(interp, SCONST(2), IREG(3), IREG(4), SCONST(5));
 
-    if (!PMC_IS_NULL(ns))
-        classobj = Parrot_oo_get_class(interp, ns);
-    if (!PMC_IS_NULL(classobj))
-        PREG(1) = VTABLE_instantiate(interp, classobj, PREG(3));
-    else {
-        opcode_t * const dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
-            EXCEPTION_NO_CLASS,
-            "Class '%Ss' not found", VTABLE_get_repr(interp, key));return (opcode_t *)dest;
-    }
+return (opcode_t *)cur_opcode + 6;}
 
-return (opcode_t *)cur_opcode + 4;}
+opcode_t *
+Parrot_replace_s_s_ic_i_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    SREG(1) = Parrot_str_replace(interp, SREG(2), ICONST(3), IREG(4), SCONST(5));
+
+return (opcode_t *)cur_opcode + 6;}
 
 opcode_t *
-Parrot_root_new_p_p_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_replace_s_sc_ic_i_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const key      = PREG(2);
-    PMC * const root_ns  = interp->root_namespace;
-    PMC * const ns       = Parrot_ns_get_namespace_keyed(interp, root_ns, key);
-    PMC * classobj       = PMCNULL;
+    SREG(1) = Parrot_str_replace(interp, SCONST(2), ICONST(3), IREG(4), SCONST(5));
 
-    if (!PMC_IS_NULL(ns))
-        classobj = Parrot_oo_get_class(interp, ns);
-    if (!PMC_IS_NULL(classobj))
-        PREG(1) = VTABLE_instantiate(interp, classobj, PCONST(3));
-    else {
-        opcode_t * const dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
-            EXCEPTION_NO_CLASS,
-            "Class '%Ss' not found", VTABLE_get_repr(interp, key));return (opcode_t *)dest;
-    }
+return (opcode_t *)cur_opcode + 6;}
 
-return (opcode_t *)cur_opcode + 4;}
+opcode_t *
+Parrot_replace_s_s_i_ic_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    SREG(1) = Parrot_str_replace(interp, SREG(2), IREG(3), ICONST(4), SCONST(5));
+
+return (opcode_t *)cur_opcode + 6;}
 
 opcode_t *
-Parrot_root_new_p_pc_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_replace_s_sc_i_ic_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const key      = PCONST(2);
-    PMC * const root_ns  = interp->root_namespace;
-    PMC * const ns       = Parrot_ns_get_namespace_keyed(interp, root_ns, key);
-    PMC * classobj       = PMCNULL;
+    SREG(1) = Parrot_str_replace(interp, SCONST(2), IREG(3), ICONST(4), SCONST(5));
 
-    if (!PMC_IS_NULL(ns))
-        classobj = Parrot_oo_get_class(interp, ns);
-    if (!PMC_IS_NULL(classobj))
-        PREG(1) = VTABLE_instantiate(interp, classobj, PCONST(3));
-    else {
-        opcode_t * const dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
-            EXCEPTION_NO_CLASS,
-            "Class '%Ss' not found", VTABLE_get_repr(interp, key));return (opcode_t *)dest;
-    }
+return (opcode_t *)cur_opcode + 6;}
 
-return (opcode_t *)cur_opcode + 4;}
+opcode_t *
+Parrot_replace_s_s_ic_ic_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    SREG(1) = Parrot_str_replace(interp, SREG(2), ICONST(3), ICONST(4), SCONST(5));
+
+return (opcode_t *)cur_opcode + 6;}
 
 opcode_t *
-Parrot_typeof_s_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_replace_s_sc_ic_ic_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    SREG(1) = VTABLE_name(interp, PREG(2));
+    SREG(1) = Parrot_str_replace(interp, SCONST(2), ICONST(3), ICONST(4), SCONST(5));
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 6;}
 
 opcode_t *
-Parrot_typeof_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_index_i_s_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_get_class(interp, PREG(2));
+    IREG(1) = (SREG(2) && SREG(3)) ? STRING_index(interp, SREG(2), SREG(3), 0) : -1;
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_get_repr_s_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_index_i_sc_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    SREG(1) = VTABLE_get_repr(interp, PREG(2));
+    IREG(1) = (SCONST(2) && SREG(3)) ? STRING_index(interp, SCONST(2), SREG(3), 0) : -1;
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_find_method_p_p_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_index_i_s_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    opcode_t * const resume = cur_opcode + 4;
-    PREG(1) = VTABLE_find_method(interp, PREG(2), SREG(3));
-    if (PMC_IS_NULL(PREG(1)) || !VTABLE_defined(interp, PREG(1))) {
-        opcode_t * const dest = Parrot_ex_throw_from_op_args(interp, resume,
-            EXCEPTION_METHOD_NOT_FOUND,
-            "Method '%Ss' not found for invocant of class '%Ss'", SREG(3),
-            VTABLE_get_string(interp, VTABLE_get_class(interp, PREG(2))));return (opcode_t *)dest;
-    }return (opcode_t *)resume;
-}
+    IREG(1) = (SREG(2) && SCONST(3)) ? STRING_index(interp, SREG(2), SCONST(3), 0) : -1;
+
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_find_method_p_p_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_index_i_sc_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    opcode_t * const resume = cur_opcode + 4;
-    PREG(1) = VTABLE_find_method(interp, PREG(2), SCONST(3));
-    if (PMC_IS_NULL(PREG(1)) || !VTABLE_defined(interp, PREG(1))) {
-        opcode_t * const dest = Parrot_ex_throw_from_op_args(interp, resume,
-            EXCEPTION_METHOD_NOT_FOUND,
-            "Method '%Ss' not found for invocant of class '%Ss'", SCONST(3),
-            VTABLE_get_string(interp, VTABLE_get_class(interp, PREG(2))));return (opcode_t *)dest;
-    }return (opcode_t *)resume;
-}
+    IREG(1) = (SCONST(2) && SCONST(3)) ? STRING_index(interp, SCONST(2), SCONST(3), 0) : -1;
+
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_defined_i_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_index_i_s_s_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = PMC_IS_NULL(PREG(2)) ? 0 : VTABLE_defined(interp, PREG(2));
+    IREG(1) = (SREG(2) && SREG(3)) ? STRING_index(interp, SREG(2), SREG(3), IREG(4)) : -1;
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 5;}
 
 opcode_t *
-Parrot_defined_i_p_ki(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_index_i_sc_s_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = PMC_IS_NULL(PREG(2)) ? 0 : VTABLE_defined_keyed_int(interp, PREG(2), IREG(3));
+    IREG(1) = (SCONST(2) && SREG(3)) ? STRING_index(interp, SCONST(2), SREG(3), IREG(4)) : -1;
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 5;}
 
 opcode_t *
-Parrot_defined_i_p_kic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_index_i_s_sc_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = PMC_IS_NULL(PREG(2)) ? 0 : VTABLE_defined_keyed_int(interp, PREG(2), ICONST(3));
+    IREG(1) = (SREG(2) && SCONST(3)) ? STRING_index(interp, SREG(2), SCONST(3), IREG(4)) : -1;
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 5;}
 
 opcode_t *
-Parrot_defined_i_p_k(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_index_i_sc_sc_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = PMC_IS_NULL(PREG(2)) ? 0 : VTABLE_defined_keyed(interp, PREG(2), PREG(3));
+    IREG(1) = (SCONST(2) && SCONST(3)) ? STRING_index(interp, SCONST(2), SCONST(3), IREG(4)) : -1;
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 5;}
 
 opcode_t *
-Parrot_defined_i_p_kc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_index_i_s_s_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = PMC_IS_NULL(PREG(2)) ? 0 : VTABLE_defined_keyed(interp, PREG(2), PCONST(3));
+    IREG(1) = (SREG(2) && SREG(3)) ? STRING_index(interp, SREG(2), SREG(3), ICONST(4)) : -1;
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 5;}
 
 opcode_t *
-Parrot_exists_i_p_ki(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_index_i_sc_s_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = PMC_IS_NULL(PREG(2)) ? 0 : VTABLE_exists_keyed_int(interp, PREG(2), IREG(3));
+    IREG(1) = (SCONST(2) && SREG(3)) ? STRING_index(interp, SCONST(2), SREG(3), ICONST(4)) : -1;
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 5;}
 
 opcode_t *
-Parrot_exists_i_p_kic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_index_i_s_sc_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = PMC_IS_NULL(PREG(2)) ? 0 : VTABLE_exists_keyed_int(interp, PREG(2), ICONST(3));
+    IREG(1) = (SREG(2) && SCONST(3)) ? STRING_index(interp, SREG(2), SCONST(3), ICONST(4)) : -1;
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 5;}
 
 opcode_t *
-Parrot_exists_i_p_k(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_index_i_sc_sc_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = PMC_IS_NULL(PREG(2)) ? 0: VTABLE_exists_keyed(interp, PREG(2), PREG(3));
+    IREG(1) = (SCONST(2) && SCONST(3)) ? STRING_index(interp, SCONST(2), SCONST(3), ICONST(4)) : -1;
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 5;}
 
 opcode_t *
-Parrot_exists_i_p_kc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_sprintf_s_s_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = PMC_IS_NULL(PREG(2)) ? 0: VTABLE_exists_keyed(interp, PREG(2), PCONST(3));
+    SREG(1)=Parrot_psprintf(interp, SREG(2), PREG(3));
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_delete_p_k(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_sprintf_s_sc_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_delete_keyed(interp, PREG(1), PREG(2));
+    SREG(1)=Parrot_psprintf(interp, SCONST(2), PREG(3));
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_delete_p_kc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_sprintf_p_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_delete_keyed(interp, PREG(1), PCONST(2));
+    VTABLE_set_string_native(interp, PREG(1),
+        Parrot_psprintf(interp, VTABLE_get_string(interp, PREG(2)), PREG(3)));
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_delete_p_ki(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_new_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_delete_keyed_int(interp, PREG(1), IREG(2));
+    SREG(1) = Parrot_str_new_noinit(interp, 0);
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 2;}
 
 opcode_t *
-Parrot_delete_p_kic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_new_s_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_delete_keyed_int(interp, PREG(1), ICONST(2));
+    SREG(1) = Parrot_str_new_noinit(interp, IREG(2));
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_elements_i_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_new_s_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = VTABLE_elements(interp, PREG(2));
+    SREG(1) = Parrot_str_new_noinit(interp, ICONST(2));
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_push_p_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_stringinfo_i_s_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_push_integer(interp, PREG(1), IREG(2));
+    if (SREG(2) == NULL)
+        IREG(1) = 0;
+    else {
+        switch (IREG(3)) {
+          case STRINGINFO_HEADER:
+            IREG(1) = PTR2UINTVAL(SREG(2));
+            break;
+          case STRINGINFO_STRSTART:
+            IREG(1) = PTR2UINTVAL(SREG(2)->strstart);
+            break;
+          case STRINGINFO_BUFLEN:
+            IREG(1) = Buffer_buflen(SREG(2));
+            break;
+          case STRINGINFO_FLAGS:
+            IREG(1) = PObj_get_FLAGS(SREG(2));
+            break;
+          case STRINGINFO_BUFUSED:
+            IREG(1) = SREG(2)->bufused;
+            break;
+          case STRINGINFO_STRLEN:
+            IREG(1) = SREG(2)->strlen;
+            break;
+          default:
+            {
+                opcode_t *handler = Parrot_ex_throw_from_op_args(interp, NULL,
+                    EXCEPTION_INVALID_OPERATION,
+                    "stringinfo: unknown info type: %d", IREG(3));return (opcode_t *)handler;
+            }
+        }
+    }
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_push_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_stringinfo_i_sc_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_push_integer(interp, PREG(1), ICONST(2));
+    if (SCONST(2) == NULL)
+        IREG(1) = 0;
+    else {
+        switch (IREG(3)) {
+          case STRINGINFO_HEADER:
+            IREG(1) = PTR2UINTVAL(SCONST(2));
+            break;
+          case STRINGINFO_STRSTART:
+            IREG(1) = PTR2UINTVAL(SCONST(2)->strstart);
+            break;
+          case STRINGINFO_BUFLEN:
+            IREG(1) = Buffer_buflen(SCONST(2));
+            break;
+          case STRINGINFO_FLAGS:
+            IREG(1) = PObj_get_FLAGS(SCONST(2));
+            break;
+          case STRINGINFO_BUFUSED:
+            IREG(1) = SCONST(2)->bufused;
+            break;
+          case STRINGINFO_STRLEN:
+            IREG(1) = SCONST(2)->strlen;
+            break;
+          default:
+            {
+                opcode_t *handler = Parrot_ex_throw_from_op_args(interp, NULL,
+                    EXCEPTION_INVALID_OPERATION,
+                    "stringinfo: unknown info type: %d", IREG(3));return (opcode_t *)handler;
+            }
+        }
+    }
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_push_p_n(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_stringinfo_i_s_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_push_float(interp, PREG(1), NREG(2));
+    if (SREG(2) == NULL)
+        IREG(1) = 0;
+    else {
+        switch (ICONST(3)) {
+          case STRINGINFO_HEADER:
+            IREG(1) = PTR2UINTVAL(SREG(2));
+            break;
+          case STRINGINFO_STRSTART:
+            IREG(1) = PTR2UINTVAL(SREG(2)->strstart);
+            break;
+          case STRINGINFO_BUFLEN:
+            IREG(1) = Buffer_buflen(SREG(2));
+            break;
+          case STRINGINFO_FLAGS:
+            IREG(1) = PObj_get_FLAGS(SREG(2));
+            break;
+          case STRINGINFO_BUFUSED:
+            IREG(1) = SREG(2)->bufused;
+            break;
+          case STRINGINFO_STRLEN:
+            IREG(1) = SREG(2)->strlen;
+            break;
+          default:
+            {
+                opcode_t *handler = Parrot_ex_throw_from_op_args(interp, NULL,
+                    EXCEPTION_INVALID_OPERATION,
+                    "stringinfo: unknown info type: %d", ICONST(3));return (opcode_t *)handler;
+            }
+        }
+    }
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_push_p_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_stringinfo_i_sc_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_push_float(interp, PREG(1), NCONST(2));
+    if (SCONST(2) == NULL)
+        IREG(1) = 0;
+    else {
+        switch (ICONST(3)) {
+          case STRINGINFO_HEADER:
+            IREG(1) = PTR2UINTVAL(SCONST(2));
+            break;
+          case STRINGINFO_STRSTART:
+            IREG(1) = PTR2UINTVAL(SCONST(2)->strstart);
+            break;
+          case STRINGINFO_BUFLEN:
+            IREG(1) = Buffer_buflen(SCONST(2));
+            break;
+          case STRINGINFO_FLAGS:
+            IREG(1) = PObj_get_FLAGS(SCONST(2));
+            break;
+          case STRINGINFO_BUFUSED:
+            IREG(1) = SCONST(2)->bufused;
+            break;
+          case STRINGINFO_STRLEN:
+            IREG(1) = SCONST(2)->strlen;
+            break;
+          default:
+            {
+                opcode_t *handler = Parrot_ex_throw_from_op_args(interp, NULL,
+                    EXCEPTION_INVALID_OPERATION,
+                    "stringinfo: unknown info type: %d", ICONST(3));return (opcode_t *)handler;
+            }
+        }
+    }
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_push_p_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_upcase_s_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_push_string(interp, PREG(1), SREG(2));
+    SREG(1) = Parrot_str_upcase(interp, SREG(2));
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_push_p_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_upcase_s_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_push_string(interp, PREG(1), SCONST(2));
+    SREG(1) = Parrot_str_upcase(interp, SCONST(2));
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_push_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_downcase_s_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_push_pmc(interp, PREG(1), PREG(2));
+    SREG(1) = Parrot_str_downcase(interp, SREG(2));
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_pop_i_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_downcase_s_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = VTABLE_pop_integer(interp, PREG(2));
+    SREG(1) = Parrot_str_downcase(interp, SCONST(2));
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_pop_n_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_titlecase_s_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    NREG(1) = VTABLE_pop_float(interp, PREG(2));
+    SREG(1) = Parrot_str_titlecase(interp, SREG(2));
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_pop_s_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_titlecase_s_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    SREG(1) = VTABLE_pop_string(interp, PREG(2));
+    SREG(1) = Parrot_str_titlecase(interp, SCONST(2));
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_pop_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_join_s_s_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_pop_pmc(interp, PREG(2));
+    SREG(1) = Parrot_str_join(interp, SREG(2), PREG(3));
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_unshift_p_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_join_s_sc_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_unshift_integer(interp, PREG(1), IREG(2));
+    SREG(1) = Parrot_str_join(interp, SCONST(2), PREG(3));
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_unshift_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_split_p_s_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_unshift_integer(interp, PREG(1), ICONST(2));
+    PREG(1) = Parrot_str_split(interp, SREG(2), SREG(3));
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_unshift_p_n(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_split_p_sc_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_unshift_float(interp, PREG(1), NREG(2));
+    PREG(1) = Parrot_str_split(interp, SCONST(2), SREG(3));
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_unshift_p_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_split_p_s_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_unshift_float(interp, PREG(1), NCONST(2));
+    PREG(1) = Parrot_str_split(interp, SREG(2), SCONST(3));
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_unshift_p_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_split_p_sc_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_unshift_string(interp, PREG(1), SREG(2));
+    PREG(1) = Parrot_str_split(interp, SCONST(2), SCONST(3));
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_unshift_p_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_encoding_i_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_unshift_string(interp, PREG(1), SCONST(2));
+    IREG(1) = Parrot_encoding_number_of_str(interp, SREG(2));
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_unshift_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_encoding_i_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_unshift_pmc(interp, PREG(1), PREG(2));
+    IREG(1) = Parrot_encoding_number_of_str(interp, SCONST(2));
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_shift_i_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_encodingname_s_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = VTABLE_shift_integer(interp, PREG(2));
+    SREG(1) = Parrot_encoding_name(interp, IREG(2));
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_shift_n_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_encodingname_s_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    NREG(1) = VTABLE_shift_float(interp, PREG(2));
+    SREG(1) = Parrot_encoding_name(interp, ICONST(2));
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_shift_s_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_find_encoding_i_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    SREG(1) = VTABLE_shift_string(interp, PREG(2));
+    const INTVAL n = Parrot_encoding_number(interp, SREG(2));
+    if (n < 0) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, NULL,
+                EXCEPTION_INVALID_ENCODING,
+                "encoding '%Ss' not found", SREG(2));return (opcode_t *)handler;
+    }
+    IREG(1) = n;
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_shift_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_find_encoding_i_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_shift_pmc(interp, PREG(2));
+    const INTVAL n = Parrot_encoding_number(interp, SCONST(2));
+    if (n < 0) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, NULL,
+                EXCEPTION_INVALID_ENCODING,
+                "encoding '%Ss' not found", SCONST(2));return (opcode_t *)handler;
+    }
+    IREG(1) = n;
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_splice_p_p_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
-    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_splice(interp, PREG(1), PREG(2), IREG(3), IREG(4));
-
-return (opcode_t *)cur_opcode + 5;}
-
-opcode_t *
-Parrot_splice_p_p_ic_i(opcode_t *cur_opcode, PARROT_INTERP)  {
-    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_splice(interp, PREG(1), PREG(2), ICONST(3), IREG(4));
-
-return (opcode_t *)cur_opcode + 5;}
-
-opcode_t *
-Parrot_splice_p_p_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
-    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_splice(interp, PREG(1), PREG(2), IREG(3), ICONST(4));
-
-return (opcode_t *)cur_opcode + 5;}
-
-opcode_t *
-Parrot_splice_p_p_ic_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_trans_encoding_s_s_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_splice(interp, PREG(1), PREG(2), ICONST(3), ICONST(4));
+    SREG(1) = Parrot_str_change_encoding(interp, SREG(2), IREG(3));
 
-return (opcode_t *)cur_opcode + 5;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_setprop_p_s_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_trans_encoding_s_sc_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_setprop(interp, PREG(1), SREG(2), PREG(3));
+    SREG(1) = Parrot_str_change_encoding(interp, SCONST(2), IREG(3));
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_setprop_p_sc_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_trans_encoding_s_s_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_setprop(interp, PREG(1), SCONST(2), PREG(3));
+    SREG(1) = Parrot_str_change_encoding(interp, SREG(2), ICONST(3));
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_getprop_p_s_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_trans_encoding_s_sc_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_getprop(interp, PREG(3), SREG(2));
+    SREG(1) = Parrot_str_change_encoding(interp, SCONST(2), ICONST(3));
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_getprop_p_sc_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_is_cclass_i_i_s_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_getprop(interp, PREG(3), SCONST(2));
+    IREG(1) = Parrot_str_is_cclass(interp, IREG(2), SREG(3), IREG(4));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 5;}
 
 opcode_t *
-Parrot_delprop_p_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_is_cclass_i_ic_s_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_delprop(interp, PREG(1), SREG(2));
+    IREG(1) = Parrot_str_is_cclass(interp, ICONST(2), SREG(3), IREG(4));
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 5;}
 
 opcode_t *
-Parrot_delprop_p_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_is_cclass_i_i_sc_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_delprop(interp, PREG(1), SCONST(2));
+    IREG(1) = Parrot_str_is_cclass(interp, IREG(2), SCONST(3), IREG(4));
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 5;}
 
 opcode_t *
-Parrot_prophash_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_is_cclass_i_ic_sc_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_getprops(interp, PREG(2));
+    IREG(1) = Parrot_str_is_cclass(interp, ICONST(2), SCONST(3), IREG(4));
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 5;}
 
 opcode_t *
-Parrot_freeze_s_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_is_cclass_i_i_s_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    SREG(1) = Parrot_freeze(interp, PREG(2));
+    IREG(1) = Parrot_str_is_cclass(interp, IREG(2), SREG(3), ICONST(4));
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 5;}
 
 opcode_t *
-Parrot_thaw_p_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_is_cclass_i_ic_s_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = Parrot_thaw(interp, SREG(2));
+    IREG(1) = Parrot_str_is_cclass(interp, ICONST(2), SREG(3), ICONST(4));
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 5;}
 
 opcode_t *
-Parrot_thaw_p_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_is_cclass_i_i_sc_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = Parrot_thaw(interp, SCONST(2));
+    IREG(1) = Parrot_str_is_cclass(interp, IREG(2), SCONST(3), ICONST(4));
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 5;}
 
 opcode_t *
-Parrot_add_multi_s_s_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_is_cclass_i_ic_sc_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    Parrot_mmd_add_multi_from_long_sig(interp, SREG(1), SREG(2), PREG(3));
+    IREG(1) = Parrot_str_is_cclass(interp, ICONST(2), SCONST(3), ICONST(4));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 5;}
 
 opcode_t *
-Parrot_add_multi_sc_s_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_find_cclass_i_i_s_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    Parrot_mmd_add_multi_from_long_sig(interp, SCONST(1), SREG(2), PREG(3));
+    IREG(1) = Parrot_str_find_cclass(interp, IREG(2), SREG(3), IREG(4), IREG(5));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 6;}
 
 opcode_t *
-Parrot_add_multi_s_sc_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_find_cclass_i_ic_s_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    Parrot_mmd_add_multi_from_long_sig(interp, SREG(1), SCONST(2), PREG(3));
+    IREG(1) = Parrot_str_find_cclass(interp, ICONST(2), SREG(3), IREG(4), IREG(5));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 6;}
 
 opcode_t *
-Parrot_add_multi_sc_sc_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_find_cclass_i_i_sc_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    Parrot_mmd_add_multi_from_long_sig(interp, SCONST(1), SCONST(2), PREG(3));
+    IREG(1) = Parrot_str_find_cclass(interp, IREG(2), SCONST(3), IREG(4), IREG(5));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 6;}
 
 opcode_t *
-Parrot_find_multi_p_s_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_find_cclass_i_ic_sc_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = Parrot_mmd_find_multi_from_long_sig(interp, SREG(2), SREG(3));
+    IREG(1) = Parrot_str_find_cclass(interp, ICONST(2), SCONST(3), IREG(4), IREG(5));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 6;}
 
 opcode_t *
-Parrot_find_multi_p_sc_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_find_cclass_i_i_s_ic_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = Parrot_mmd_find_multi_from_long_sig(interp, SCONST(2), SREG(3));
+    IREG(1) = Parrot_str_find_cclass(interp, IREG(2), SREG(3), ICONST(4), IREG(5));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 6;}
 
 opcode_t *
-Parrot_find_multi_p_s_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_find_cclass_i_ic_s_ic_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = Parrot_mmd_find_multi_from_long_sig(interp, SREG(2), SCONST(3));
+    IREG(1) = Parrot_str_find_cclass(interp, ICONST(2), SREG(3), ICONST(4), IREG(5));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 6;}
 
 opcode_t *
-Parrot_find_multi_p_sc_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_find_cclass_i_i_sc_ic_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = Parrot_mmd_find_multi_from_long_sig(interp, SCONST(2), SCONST(3));
+    IREG(1) = Parrot_str_find_cclass(interp, IREG(2), SCONST(3), ICONST(4), IREG(5));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 6;}
 
 opcode_t *
-Parrot_register_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_find_cclass_i_ic_sc_ic_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    Parrot_pmc_gc_register(interp, PREG(1));
+    IREG(1) = Parrot_str_find_cclass(interp, ICONST(2), SCONST(3), ICONST(4), IREG(5));
 
-return (opcode_t *)cur_opcode + 2;}
+return (opcode_t *)cur_opcode + 6;}
 
 opcode_t *
-Parrot_unregister_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_find_cclass_i_i_s_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    Parrot_pmc_gc_unregister(interp, PREG(1));
+    IREG(1) = Parrot_str_find_cclass(interp, IREG(2), SREG(3), IREG(4), ICONST(5));
 
-return (opcode_t *)cur_opcode + 2;}
+return (opcode_t *)cur_opcode + 6;}
 
 opcode_t *
-Parrot_box_p_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_find_cclass_i_ic_s_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = Parrot_pmc_box_integer(interp, IREG(2));
+    IREG(1) = Parrot_str_find_cclass(interp, ICONST(2), SREG(3), IREG(4), ICONST(5));
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 6;}
 
 opcode_t *
-Parrot_box_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_find_cclass_i_i_sc_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = Parrot_pmc_box_integer(interp, ICONST(2));
+    IREG(1) = Parrot_str_find_cclass(interp, IREG(2), SCONST(3), IREG(4), ICONST(5));
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 6;}
 
 opcode_t *
-Parrot_box_p_n(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_find_cclass_i_ic_sc_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = Parrot_pmc_box_number(interp, NREG(2));
+    IREG(1) = Parrot_str_find_cclass(interp, ICONST(2), SCONST(3), IREG(4), ICONST(5));
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 6;}
 
 opcode_t *
-Parrot_box_p_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_find_cclass_i_i_s_ic_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = Parrot_pmc_box_number(interp, NCONST(2));
+    IREG(1) = Parrot_str_find_cclass(interp, IREG(2), SREG(3), ICONST(4), ICONST(5));
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 6;}
 
 opcode_t *
-Parrot_box_p_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_find_cclass_i_ic_s_ic_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = Parrot_pmc_box_string(interp, SREG(2));
+    IREG(1) = Parrot_str_find_cclass(interp, ICONST(2), SREG(3), ICONST(4), ICONST(5));
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 6;}
 
 opcode_t *
-Parrot_box_p_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_find_cclass_i_i_sc_ic_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = Parrot_pmc_box_string(interp, SCONST(2));
+    IREG(1) = Parrot_str_find_cclass(interp, IREG(2), SCONST(3), ICONST(4), ICONST(5));
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 6;}
 
 opcode_t *
-Parrot_iter_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_find_cclass_i_ic_sc_ic_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_get_iter(interp, PREG(2));
+    IREG(1) = Parrot_str_find_cclass(interp, ICONST(2), SCONST(3), ICONST(4), ICONST(5));
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 6;}
 
 opcode_t *
-Parrot_morph_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_find_not_cclass_i_i_s_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_morph(interp, PREG(1), PREG(2));
+    IREG(1) = Parrot_str_find_not_cclass(interp, IREG(2), SREG(3), IREG(4), IREG(5));
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 6;}
 
 opcode_t *
-Parrot_morph_p_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_find_not_cclass_i_ic_s_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_morph(interp, PREG(1), PCONST(2));
+    IREG(1) = Parrot_str_find_not_cclass(interp, ICONST(2), SREG(3), IREG(4), IREG(5));
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 6;}
 
 opcode_t *
-Parrot_clone_s_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_find_not_cclass_i_i_sc_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    /* cloning a NULL STRING produces an empty STRING; TT #964 */
-    SREG(1) = STRING_IS_NULL(SREG(2))
-       ? Parrot_str_new(interp, NULL, 0)
-       : SREG(2);
+    IREG(1) = Parrot_str_find_not_cclass(interp, IREG(2), SCONST(3), IREG(4), IREG(5));
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 6;}
 
 opcode_t *
-Parrot_clone_s_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_find_not_cclass_i_ic_sc_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    /* cloning a NULL STRING produces an empty STRING; TT #964 */
-    SREG(1) = STRING_IS_NULL(SCONST(2))
-       ? Parrot_str_new(interp, NULL, 0)
-       : SCONST(2);
+    IREG(1) = Parrot_str_find_not_cclass(interp, ICONST(2), SCONST(3), IREG(4), IREG(5));
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 6;}
 
 opcode_t *
-Parrot_set_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_find_not_cclass_i_i_s_ic_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = IREG(2);
+    IREG(1) = Parrot_str_find_not_cclass(interp, IREG(2), SREG(3), ICONST(4), IREG(5));
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 6;}
 
 opcode_t *
-Parrot_set_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_find_not_cclass_i_ic_s_ic_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = ICONST(2);
+    IREG(1) = Parrot_str_find_not_cclass(interp, ICONST(2), SREG(3), ICONST(4), IREG(5));
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 6;}
 
 opcode_t *
-Parrot_set_i_n(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_find_not_cclass_i_i_sc_ic_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = (INTVAL)(NREG(2));
+    IREG(1) = Parrot_str_find_not_cclass(interp, IREG(2), SCONST(3), ICONST(4), IREG(5));
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 6;}
 
 opcode_t *
-Parrot_set_i_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_find_not_cclass_i_ic_sc_ic_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = (INTVAL)(NCONST(2));
+    IREG(1) = Parrot_str_find_not_cclass(interp, ICONST(2), SCONST(3), ICONST(4), IREG(5));
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 6;}
 
 opcode_t *
-Parrot_set_i_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_find_not_cclass_i_i_s_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = Parrot_str_to_int(interp, SREG(2));
+    IREG(1) = Parrot_str_find_not_cclass(interp, IREG(2), SREG(3), IREG(4), ICONST(5));
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 6;}
 
 opcode_t *
-Parrot_set_i_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_find_not_cclass_i_ic_s_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = Parrot_str_to_int(interp, SCONST(2));
+    IREG(1) = Parrot_str_find_not_cclass(interp, ICONST(2), SREG(3), IREG(4), ICONST(5));
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 6;}
 
 opcode_t *
-Parrot_set_n_n(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_find_not_cclass_i_i_sc_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    NREG(1) = NREG(2);
+    IREG(1) = Parrot_str_find_not_cclass(interp, IREG(2), SCONST(3), IREG(4), ICONST(5));
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 6;}
 
 opcode_t *
-Parrot_set_n_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_find_not_cclass_i_ic_sc_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    NREG(1) = NCONST(2);
+    IREG(1) = Parrot_str_find_not_cclass(interp, ICONST(2), SCONST(3), IREG(4), ICONST(5));
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 6;}
 
 opcode_t *
-Parrot_set_n_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_find_not_cclass_i_i_s_ic_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    NREG(1) = (FLOATVAL)IREG(2);
+    IREG(1) = Parrot_str_find_not_cclass(interp, IREG(2), SREG(3), ICONST(4), ICONST(5));
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 6;}
 
 opcode_t *
-Parrot_set_n_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_find_not_cclass_i_ic_s_ic_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    NREG(1) = (FLOATVAL)ICONST(2);
+    IREG(1) = Parrot_str_find_not_cclass(interp, ICONST(2), SREG(3), ICONST(4), ICONST(5));
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 6;}
 
 opcode_t *
-Parrot_set_n_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_find_not_cclass_i_i_sc_ic_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    NREG(1) = Parrot_str_to_num(interp, SREG(2));
+    IREG(1) = Parrot_str_find_not_cclass(interp, IREG(2), SCONST(3), ICONST(4), ICONST(5));
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 6;}
 
 opcode_t *
-Parrot_set_n_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_find_not_cclass_i_ic_sc_ic_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    NREG(1) = Parrot_str_to_num(interp, SCONST(2));
+    IREG(1) = Parrot_str_find_not_cclass(interp, ICONST(2), SCONST(3), ICONST(4), ICONST(5));
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 6;}
 
 opcode_t *
-Parrot_set_n_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_escape_s_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    NREG(1) = VTABLE_get_number(interp, PREG(2));
+    SREG(1) = Parrot_str_escape(interp, SREG(2));
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_set_s_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_compose_s_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    SREG(1) = VTABLE_get_string(interp, PREG(2));
+    SREG(1) = Parrot_str_compose(interp, SREG(2));
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_set_s_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_compose_s_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    SREG(1) = SREG(2);
+    SREG(1) = Parrot_str_compose(interp, SCONST(2));
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_set_s_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_find_codepoint_i_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    SREG(1) = SCONST(2);
+#if PARROT_HAS_ICU
+    UErrorCode   err       = U_ZERO_ERROR;
+    char * const cstr      = Parrot_str_to_cstring(interp, SREG(2));
+    UChar32      codepoint = u_charFromName(U_EXTENDED_CHAR_NAME, cstr, &err);
+    Parrot_str_free_cstring(cstr);
+    IREG(1) = U_SUCCESS(err) ? (INTVAL) codepoint : -1;
+#else
+    opcode_t * const dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 3,
+        EXCEPTION_LIBRARY_ERROR, "no ICU lib loaded");return (opcode_t *)dest;
+#endif
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_set_s_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_find_codepoint_i_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    SREG(1) = Parrot_str_from_int(interp, IREG(2));
+#if PARROT_HAS_ICU
+    UErrorCode   err       = U_ZERO_ERROR;
+    char * const cstr      = Parrot_str_to_cstring(interp, SCONST(2));
+    UChar32      codepoint = u_charFromName(U_EXTENDED_CHAR_NAME, cstr, &err);
+    Parrot_str_free_cstring(cstr);
+    IREG(1) = U_SUCCESS(err) ? (INTVAL) codepoint : -1;
+#else
+    opcode_t * const dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 3,
+        EXCEPTION_LIBRARY_ERROR, "no ICU lib loaded");return (opcode_t *)dest;
+#endif
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_set_s_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_spawnw_i_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    SREG(1) = Parrot_str_from_int(interp, ICONST(2));
+    IREG(1) = Parrot_Run_OS_Command(interp, SREG(2));
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_set_s_n(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_spawnw_i_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    SREG(1) = Parrot_str_from_num(interp, NREG(2));
+    IREG(1) = Parrot_Run_OS_Command(interp, SCONST(2));
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_set_s_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_spawnw_i_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    SREG(1) = Parrot_str_from_num(interp, NCONST(2));
+    IREG(1) = Parrot_Run_OS_Command_Argv(interp, PREG(2));
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_set_p_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_err_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = PCONST(2);
+    IREG(1) = errno;
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 2;}
 
 opcode_t *
-Parrot_set_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_err_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = PREG(2);
+    const char * const tmp = strerror(errno);
+    SREG(1) = Parrot_str_new_init(interp, tmp, strlen(tmp),
+            Parrot_ascii_encoding_ptr, 0);
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 2;}
 
 opcode_t *
-Parrot_set_p_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_err_s_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_set_integer_native(interp, PREG(1), IREG(2));
+    const char * const tmp = strerror(IREG(2));
+    SREG(1) = Parrot_str_new_init(interp, tmp, strlen(tmp),
+            Parrot_ascii_encoding_ptr, 0);
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_set_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_err_s_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_set_integer_native(interp, PREG(1), ICONST(2));
+    const char * const tmp = strerror(ICONST(2));
+    SREG(1) = Parrot_str_new_init(interp, tmp, strlen(tmp),
+            Parrot_ascii_encoding_ptr, 0);
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_set_p_n(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_time_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_set_number_native(interp, PREG(1), NREG(2));
+    IREG(1) = Parrot_intval_time();
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 2;}
 
 opcode_t *
-Parrot_set_p_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_time_n(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_set_number_native(interp, PREG(1), NCONST(2));
+    NREG(1) = Parrot_floatval_time();
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 2;}
 
 opcode_t *
-Parrot_set_p_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_sleep_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_set_string_native(interp, PREG(1), SREG(2));
+    opcode_t *next = cur_opcode + 2;
+    if (IREG(1) < 0) {
+        opcode_t * const handler = Parrot_ex_throw_from_op_args(interp, next,
+            EXCEPTION_NEG_SLEEP,
+            "Cannot go back in time");return (opcode_t *)handler;
+    }
+    next = (opcode_t *)Parrot_cx_schedule_sleep(interp, (FLOATVAL) IREG(1), next);return (opcode_t *)next;
+}
 
-return (opcode_t *)cur_opcode + 3;}
+opcode_t *
+Parrot_sleep_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    opcode_t *next = cur_opcode + 2;
+    if (ICONST(1) < 0) {
+        opcode_t * const handler = Parrot_ex_throw_from_op_args(interp, next,
+            EXCEPTION_NEG_SLEEP,
+            "Cannot go back in time");return (opcode_t *)handler;
+    }
+    next = (opcode_t *)Parrot_cx_schedule_sleep(interp, (FLOATVAL) ICONST(1), next);return (opcode_t *)next;
+}
 
 opcode_t *
-Parrot_set_p_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_sleep_n(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_set_string_native(interp, PREG(1), SCONST(2));
+    opcode_t *next = cur_opcode + 2;
+    if (NREG(1) < 0.0) {
+        opcode_t * const handler = Parrot_ex_throw_from_op_args(interp, next,
+            EXCEPTION_NEG_SLEEP,
+            "Cannot go back in time");return (opcode_t *)handler;
+    }
+    next = (opcode_t *)Parrot_cx_schedule_sleep(interp, NREG(1), next);return (opcode_t *)next;
+}
 
-return (opcode_t *)cur_opcode + 3;}
+opcode_t *
+Parrot_sleep_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    opcode_t *next = cur_opcode + 2;
+    if (NCONST(1) < 0.0) {
+        opcode_t * const handler = Parrot_ex_throw_from_op_args(interp, next,
+            EXCEPTION_NEG_SLEEP,
+            "Cannot go back in time");return (opcode_t *)handler;
+    }
+    next = (opcode_t *)Parrot_cx_schedule_sleep(interp, NCONST(1), next);return (opcode_t *)next;
+}
 
 opcode_t *
-Parrot_set_i_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_store_lex_s_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = VTABLE_get_integer(interp, PREG(2));
+    PMC     * const ctx      = CURRENT_CONTEXT(interp);
+    STRING  * const lex_name = SREG(1);
+    PMC     * const lex_pad  = Parrot_sub_find_pad(interp, lex_name, ctx);
+
+    if (PMC_IS_NULL(lex_pad)) {
+        opcode_t * const handler = Parrot_ex_throw_from_op_args(interp, NULL,
+                EXCEPTION_LEX_NOT_FOUND,
+                "Lexical '%Ss' not found", lex_name);return (opcode_t *)handler;
+    }
+    VTABLE_set_pmc_keyed_str(interp, lex_pad, lex_name, PREG(2));
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_assign_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_store_lex_sc_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_assign_pmc(interp, PREG(1), PREG(2));
+    PMC     * const ctx      = CURRENT_CONTEXT(interp);
+    STRING  * const lex_name = SCONST(1);
+    PMC     * const lex_pad  = Parrot_sub_find_pad(interp, lex_name, ctx);
+
+    if (PMC_IS_NULL(lex_pad)) {
+        opcode_t * const handler = Parrot_ex_throw_from_op_args(interp, NULL,
+                EXCEPTION_LEX_NOT_FOUND,
+                "Lexical '%Ss' not found", lex_name);return (opcode_t *)handler;
+    }
+    VTABLE_set_pmc_keyed_str(interp, lex_pad, lex_name, PREG(2));
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_assign_p_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_store_dynamic_lex_s_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_set_integer_native(interp, PREG(1), IREG(2));
+    STRING  * const lex_name = SREG(1);
+    PMC     * const ctx      =
+        Parrot_pcc_get_caller_ctx(interp, CURRENT_CONTEXT(interp));
+    PMC     * const lex_pad  =
+        PMC_IS_NULL(ctx)
+            ? PMCNULL
+            : Parrot_sub_find_dynamic_pad(interp, lex_name, ctx);
+
+    if (PMC_IS_NULL(lex_pad)) {
+        opcode_t * const handler = Parrot_ex_throw_from_op_args(interp, NULL,
+                EXCEPTION_LEX_NOT_FOUND,
+                "Lexical '%Ss' not found in dynamic scope", lex_name);return (opcode_t *)handler;
+    }
+    VTABLE_set_pmc_keyed_str(interp, lex_pad, lex_name, PREG(2));
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_assign_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_store_dynamic_lex_sc_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_set_integer_native(interp, PREG(1), ICONST(2));
+    STRING  * const lex_name = SCONST(1);
+    PMC     * const ctx      =
+        Parrot_pcc_get_caller_ctx(interp, CURRENT_CONTEXT(interp));
+    PMC     * const lex_pad  =
+        PMC_IS_NULL(ctx)
+            ? PMCNULL
+            : Parrot_sub_find_dynamic_pad(interp, lex_name, ctx);
+
+    if (PMC_IS_NULL(lex_pad)) {
+        opcode_t * const handler = Parrot_ex_throw_from_op_args(interp, NULL,
+                EXCEPTION_LEX_NOT_FOUND,
+                "Lexical '%Ss' not found in dynamic scope", lex_name);return (opcode_t *)handler;
+    }
+    VTABLE_set_pmc_keyed_str(interp, lex_pad, lex_name, PREG(2));
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_assign_p_n(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_find_lex_p_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_set_number_native(interp, PREG(1), NREG(2));
+    PMC     * const ctx      = CURRENT_CONTEXT(interp);
+    STRING  * const lex_name = SREG(2);
+    PMC     * const lex_pad  = Parrot_sub_find_pad(interp, lex_name, ctx);
+
+    PMC * const result =
+        PMC_IS_NULL(lex_pad)
+            ? PMCNULL
+            : VTABLE_get_pmc_keyed_str(interp, lex_pad, lex_name);
+    PREG(1) = result;
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_assign_p_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_find_lex_p_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_set_number_native(interp, PREG(1), NCONST(2));
+    PMC     * const ctx      = CURRENT_CONTEXT(interp);
+    STRING  * const lex_name = SCONST(2);
+    PMC     * const lex_pad  = Parrot_sub_find_pad(interp, lex_name, ctx);
+
+    PMC * const result =
+        PMC_IS_NULL(lex_pad)
+            ? PMCNULL
+            : VTABLE_get_pmc_keyed_str(interp, lex_pad, lex_name);
+    PREG(1) = result;
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_assign_p_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_find_dynamic_lex_p_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_assign_string_native(interp, PREG(1), SREG(2));
+    STRING  * const lex_name = SREG(2);
+    PMC     * const ctx      =
+        Parrot_pcc_get_caller_ctx(interp, CURRENT_CONTEXT(interp));
+    PMC     * const lex_pad  =
+        PMC_IS_NULL(ctx)
+            ? PMCNULL
+            : Parrot_sub_find_dynamic_pad(interp, lex_name, ctx);
+    PMC     * const result =
+        PMC_IS_NULL(lex_pad)
+            ? PMCNULL
+            : VTABLE_get_pmc_keyed_str(interp, lex_pad, lex_name);
+    PREG(1) = result;
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_assign_p_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_find_dynamic_lex_p_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_assign_string_native(interp, PREG(1), SCONST(2));
+    STRING  * const lex_name = SCONST(2);
+    PMC     * const ctx      =
+        Parrot_pcc_get_caller_ctx(interp, CURRENT_CONTEXT(interp));
+    PMC     * const lex_pad  =
+        PMC_IS_NULL(ctx)
+            ? PMCNULL
+            : Parrot_sub_find_dynamic_pad(interp, lex_name, ctx);
+    PMC     * const result =
+        PMC_IS_NULL(lex_pad)
+            ? PMCNULL
+            : VTABLE_get_pmc_keyed_str(interp, lex_pad, lex_name);
+    PREG(1) = result;
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_assign_s_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_find_caller_lex_p_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    SREG(1) = SREG(2);
+    STRING  * const lex_name = SREG(2);
+    PMC     * ctx            = CURRENT_CONTEXT(interp);
+    PMC     * result         = PMCNULL;
+
+    for (ctx = Parrot_pcc_get_caller_ctx(interp, ctx);
+            !PMC_IS_NULL(ctx) && PMC_IS_NULL(result);
+            ctx = Parrot_pcc_get_caller_ctx(interp, ctx))
+    {
+        PMC * const lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+        if (!PMC_IS_NULL(lex_pad)) {
+            result = VTABLE_get_pmc_keyed_str(interp, lex_pad, lex_name);
+        }
+        if (!result) result = PMCNULL;
+    }
+    PREG(1) = result;
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_assign_s_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_find_caller_lex_p_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    SREG(1) = SCONST(2);
-
-return (opcode_t *)cur_opcode + 3;}
+    STRING  * const lex_name = SCONST(2);
+    PMC     * ctx            = CURRENT_CONTEXT(interp);
+    PMC     * result         = PMCNULL;
 
-opcode_t *
-Parrot_setref_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
-    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_set_pmc(interp, PREG(1), PREG(2));
+    for (ctx = Parrot_pcc_get_caller_ctx(interp, ctx);
+            !PMC_IS_NULL(ctx) && PMC_IS_NULL(result);
+            ctx = Parrot_pcc_get_caller_ctx(interp, ctx))
+    {
+        PMC * const lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+        if (!PMC_IS_NULL(lex_pad)) {
+            result = VTABLE_get_pmc_keyed_str(interp, lex_pad, lex_name);
+        }
+        if (!result) result = PMCNULL;
+    }
+    PREG(1) = result;
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_deref_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_get_namespace_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_get_pmc(interp, PREG(2));
+    PMC * const cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
+    PREG(1) = cur_ns;
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 2;}
 
 opcode_t *
-Parrot_set_p_ki_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_get_namespace_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_set_integer_keyed_int(interp, PREG(1), IREG(2), IREG(3));
-
-return (opcode_t *)cur_opcode + 4;}
+    PMC * const cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
+    PMC * const ns     = Parrot_ns_get_namespace_keyed(interp, cur_ns, PREG(2));
 
-opcode_t *
-Parrot_set_p_kic_i(opcode_t *cur_opcode, PARROT_INTERP)  {
-    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_set_integer_keyed_int(interp, PREG(1), ICONST(2), IREG(3));
+    PREG(1) = PMC_IS_NULL(ns) ? PMCNULL : ns;
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_set_p_ki_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_get_namespace_p_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_set_integer_keyed_int(interp, PREG(1), IREG(2), ICONST(3));
+    PMC * const cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
+    PMC * const ns     = Parrot_ns_get_namespace_keyed(interp, cur_ns, PCONST(2));
 
-return (opcode_t *)cur_opcode + 4;}
+    PREG(1) = PMC_IS_NULL(ns) ? PMCNULL : ns;
+
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_set_p_kic_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_get_hll_namespace_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_set_integer_keyed_int(interp, PREG(1), ICONST(2), ICONST(3));
+    PMC * const hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
+    PREG(1) = hll_ns;
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 2;}
 
 opcode_t *
-Parrot_set_p_ki_n(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_get_hll_namespace_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_set_number_keyed_int(interp, PREG(1), IREG(2), NREG(3));
+    PMC * const hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
+    if (PMC_IS_NULL(hll_ns))
+        PREG(1) = PMCNULL;
+    else {
+        PMC * const ns = Parrot_ns_get_namespace_keyed(interp, hll_ns, PREG(2));
+        PREG(1) = ns;
+    }
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_set_p_kic_n(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_get_hll_namespace_p_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_set_number_keyed_int(interp, PREG(1), ICONST(2), NREG(3));
+    PMC * const hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
+    if (PMC_IS_NULL(hll_ns))
+        PREG(1) = PMCNULL;
+    else {
+        PMC * const ns = Parrot_ns_get_namespace_keyed(interp, hll_ns, PCONST(2));
+        PREG(1) = ns;
+    }
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_set_p_ki_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_get_root_namespace_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_set_number_keyed_int(interp, PREG(1), IREG(2), NCONST(3));
+    PMC * const root_ns = interp->root_namespace;
+    PREG(1) = root_ns;
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 2;}
 
 opcode_t *
-Parrot_set_p_kic_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_get_root_namespace_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_set_number_keyed_int(interp, PREG(1), ICONST(2), NCONST(3));
+    PMC * const root_ns = interp->root_namespace;
+    if (PMC_IS_NULL(root_ns))
+        PREG(1) = PMCNULL;
+    else {
+        PMC * const ns = Parrot_ns_get_namespace_keyed(interp, root_ns, PREG(2));
+        PREG(1) = ns;
+    }
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_set_p_ki_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_get_root_namespace_p_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_set_string_keyed_int(interp, PREG(1), IREG(2), SREG(3));
+    PMC * const root_ns = interp->root_namespace;
+    if (PMC_IS_NULL(root_ns))
+        PREG(1) = PMCNULL;
+    else {
+        PMC * const ns = Parrot_ns_get_namespace_keyed(interp, root_ns, PCONST(2));
+        PREG(1) = ns;
+    }
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_set_p_kic_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_get_global_p_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_set_string_keyed_int(interp, PREG(1), ICONST(2), SREG(3));
+    PMC * const cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
+    PREG(1) = Parrot_ns_find_global_from_op(interp, cur_ns, SREG(2), cur_opcode + 3);
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_set_p_ki_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_get_global_p_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_set_string_keyed_int(interp, PREG(1), IREG(2), SCONST(3));
+    PMC * const cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
+    PREG(1) = Parrot_ns_find_global_from_op(interp, cur_ns, SCONST(2), cur_opcode + 3);
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_set_p_kic_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_get_global_p_p_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_set_string_keyed_int(interp, PREG(1), ICONST(2), SCONST(3));
+    PMC * const cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
+    if (PMC_IS_NULL(cur_ns)) {
+        PREG(1) = PMCNULL;
+    }
+    else {
+        PMC * const ns = Parrot_ns_get_namespace_keyed(interp, cur_ns, PREG(2));
+        if (PMC_IS_NULL(ns))
+            PREG(1) = PMCNULL;
+        else
+            PREG(1) = Parrot_ns_find_global_from_op(interp, ns, SREG(3), cur_opcode + 4);
+    }
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_set_p_ki_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_get_global_p_pc_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_set_pmc_keyed_int(interp, PREG(1), IREG(2), PREG(3));
+    PMC * const cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
+    if (PMC_IS_NULL(cur_ns)) {
+        PREG(1) = PMCNULL;
+    }
+    else {
+        PMC * const ns = Parrot_ns_get_namespace_keyed(interp, cur_ns, PCONST(2));
+        if (PMC_IS_NULL(ns))
+            PREG(1) = PMCNULL;
+        else
+            PREG(1) = Parrot_ns_find_global_from_op(interp, ns, SREG(3), cur_opcode + 4);
+    }
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_set_p_kic_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_get_global_p_p_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_set_pmc_keyed_int(interp, PREG(1), ICONST(2), PREG(3));
+    PMC * const cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
+    if (PMC_IS_NULL(cur_ns)) {
+        PREG(1) = PMCNULL;
+    }
+    else {
+        PMC * const ns = Parrot_ns_get_namespace_keyed(interp, cur_ns, PREG(2));
+        if (PMC_IS_NULL(ns))
+            PREG(1) = PMCNULL;
+        else
+            PREG(1) = Parrot_ns_find_global_from_op(interp, ns, SCONST(3), cur_opcode + 4);
+    }
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_set_i_p_ki(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_get_global_p_pc_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = VTABLE_get_integer_keyed_int(interp, PREG(2), IREG(3));
+    PMC * const cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
+    if (PMC_IS_NULL(cur_ns)) {
+        PREG(1) = PMCNULL;
+    }
+    else {
+        PMC * const ns = Parrot_ns_get_namespace_keyed(interp, cur_ns, PCONST(2));
+        if (PMC_IS_NULL(ns))
+            PREG(1) = PMCNULL;
+        else
+            PREG(1) = Parrot_ns_find_global_from_op(interp, ns, SCONST(3), cur_opcode + 4);
+    }
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_set_i_p_kic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_get_hll_global_p_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = VTABLE_get_integer_keyed_int(interp, PREG(2), ICONST(3));
+    PMC * const hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
+    PREG(1) = Parrot_ns_find_global_from_op(interp, hll_ns, SREG(2), cur_opcode + 3);
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_set_n_p_ki(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_get_hll_global_p_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    NREG(1) = VTABLE_get_number_keyed_int(interp, PREG(2), IREG(3));
+    PMC * const hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
+    PREG(1) = Parrot_ns_find_global_from_op(interp, hll_ns, SCONST(2), cur_opcode + 3);
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_set_n_p_kic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_get_hll_global_p_p_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    NREG(1) = VTABLE_get_number_keyed_int(interp, PREG(2), ICONST(3));
+    PMC * const hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
+    if (PMC_IS_NULL(hll_ns)) {
+        PREG(1) = hll_ns;
+    }
+    else {
+        PMC * const ns = Parrot_ns_get_namespace_keyed(interp, hll_ns, PREG(2));
+        if (PMC_IS_NULL(ns))
+            PREG(1) = PMCNULL;
+        else
+            PREG(1) = Parrot_ns_find_global_from_op(interp, ns, SREG(3), cur_opcode + 4);
+    }
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_set_s_p_ki(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_get_hll_global_p_pc_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    SREG(1) = VTABLE_get_string_keyed_int(interp, PREG(2), IREG(3));
+    PMC * const hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
+    if (PMC_IS_NULL(hll_ns)) {
+        PREG(1) = hll_ns;
+    }
+    else {
+        PMC * const ns = Parrot_ns_get_namespace_keyed(interp, hll_ns, PCONST(2));
+        if (PMC_IS_NULL(ns))
+            PREG(1) = PMCNULL;
+        else
+            PREG(1) = Parrot_ns_find_global_from_op(interp, ns, SREG(3), cur_opcode + 4);
+    }
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_set_s_p_kic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_get_hll_global_p_p_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    SREG(1) = VTABLE_get_string_keyed_int(interp, PREG(2), ICONST(3));
+    PMC * const hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
+    if (PMC_IS_NULL(hll_ns)) {
+        PREG(1) = hll_ns;
+    }
+    else {
+        PMC * const ns = Parrot_ns_get_namespace_keyed(interp, hll_ns, PREG(2));
+        if (PMC_IS_NULL(ns))
+            PREG(1) = PMCNULL;
+        else
+            PREG(1) = Parrot_ns_find_global_from_op(interp, ns, SCONST(3), cur_opcode + 4);
+    }
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_set_p_p_ki(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_get_hll_global_p_pc_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PREG(2), IREG(3));
+    PMC * const hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
+    if (PMC_IS_NULL(hll_ns)) {
+        PREG(1) = hll_ns;
+    }
+    else {
+        PMC * const ns = Parrot_ns_get_namespace_keyed(interp, hll_ns, PCONST(2));
+        if (PMC_IS_NULL(ns))
+            PREG(1) = PMCNULL;
+        else
+            PREG(1) = Parrot_ns_find_global_from_op(interp, ns, SCONST(3), cur_opcode + 4);
+    }
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_set_p_p_kic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_get_root_global_p_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PREG(2), ICONST(3));
+    PMC * const root_ns = interp->root_namespace;
+    PREG(1) = Parrot_ns_find_global_from_op(interp, root_ns, SREG(2), cur_opcode + 3);
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_set_p_k_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_get_root_global_p_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_set_integer_keyed(interp, PREG(1), PREG(2), IREG(3));
+    PMC * const root_ns = interp->root_namespace;
+    PREG(1) = Parrot_ns_find_global_from_op(interp, root_ns, SCONST(2), cur_opcode + 3);
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_set_p_kc_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_get_root_global_p_p_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_set_integer_keyed(interp, PREG(1), PCONST(2), IREG(3));
+    PMC * const root_ns = interp->root_namespace;
+    if (PMC_IS_NULL(root_ns))
+        PREG(1) = PMCNULL;
+    else {
+        PMC * const ns = Parrot_ns_get_namespace_keyed(interp, root_ns, PREG(2));
+        if (PMC_IS_NULL(ns))
+            PREG(1) = PMCNULL;
+        else
+            PREG(1) = Parrot_ns_find_global_from_op(interp, ns, SREG(3), cur_opcode + 4);
+    }
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_set_p_k_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_get_root_global_p_pc_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_set_integer_keyed(interp, PREG(1), PREG(2), ICONST(3));
+    PMC * const root_ns = interp->root_namespace;
+    if (PMC_IS_NULL(root_ns))
+        PREG(1) = PMCNULL;
+    else {
+        PMC * const ns = Parrot_ns_get_namespace_keyed(interp, root_ns, PCONST(2));
+        if (PMC_IS_NULL(ns))
+            PREG(1) = PMCNULL;
+        else
+            PREG(1) = Parrot_ns_find_global_from_op(interp, ns, SREG(3), cur_opcode + 4);
+    }
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_set_p_kc_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_get_root_global_p_p_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_set_integer_keyed(interp, PREG(1), PCONST(2), ICONST(3));
+    PMC * const root_ns = interp->root_namespace;
+    if (PMC_IS_NULL(root_ns))
+        PREG(1) = PMCNULL;
+    else {
+        PMC * const ns = Parrot_ns_get_namespace_keyed(interp, root_ns, PREG(2));
+        if (PMC_IS_NULL(ns))
+            PREG(1) = PMCNULL;
+        else
+            PREG(1) = Parrot_ns_find_global_from_op(interp, ns, SCONST(3), cur_opcode + 4);
+    }
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_set_p_k_n(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_get_root_global_p_pc_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_set_number_keyed(interp, PREG(1), PREG(2), NREG(3));
+    PMC * const root_ns = interp->root_namespace;
+    if (PMC_IS_NULL(root_ns))
+        PREG(1) = PMCNULL;
+    else {
+        PMC * const ns = Parrot_ns_get_namespace_keyed(interp, root_ns, PCONST(2));
+        if (PMC_IS_NULL(ns))
+            PREG(1) = PMCNULL;
+        else
+            PREG(1) = Parrot_ns_find_global_from_op(interp, ns, SCONST(3), cur_opcode + 4);
+    }
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_set_p_kc_n(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_global_s_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_set_number_keyed(interp, PREG(1), PCONST(2), NREG(3));
+    PMC * const cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
+    Parrot_ns_set_global(interp, cur_ns, SREG(1), PREG(2));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_set_p_k_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_global_sc_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_set_number_keyed(interp, PREG(1), PREG(2), NCONST(3));
+    PMC * const cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
+    Parrot_ns_set_global(interp, cur_ns, SCONST(1), PREG(2));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_set_p_kc_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_global_p_s_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_set_number_keyed(interp, PREG(1), PCONST(2), NCONST(3));
+    PMC * const cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
+    PMC * const ns     = Parrot_ns_make_namespace_keyed(interp, cur_ns, PREG(1));
+
+    Parrot_ns_set_global(interp, ns, SREG(2), PREG(3));
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_set_p_k_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_global_pc_s_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_set_string_keyed(interp, PREG(1), PREG(2), SREG(3));
+    PMC * const cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
+    PMC * const ns     = Parrot_ns_make_namespace_keyed(interp, cur_ns, PCONST(1));
+
+    Parrot_ns_set_global(interp, ns, SREG(2), PREG(3));
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_set_p_kc_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_global_p_sc_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_set_string_keyed(interp, PREG(1), PCONST(2), SREG(3));
+    PMC * const cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
+    PMC * const ns     = Parrot_ns_make_namespace_keyed(interp, cur_ns, PREG(1));
+
+    Parrot_ns_set_global(interp, ns, SCONST(2), PREG(3));
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_set_p_k_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_global_pc_sc_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_set_string_keyed(interp, PREG(1), PREG(2), SCONST(3));
+    PMC * const cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
+    PMC * const ns     = Parrot_ns_make_namespace_keyed(interp, cur_ns, PCONST(1));
+
+    Parrot_ns_set_global(interp, ns, SCONST(2), PREG(3));
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_set_p_kc_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_hll_global_s_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_set_string_keyed(interp, PREG(1), PCONST(2), SCONST(3));
+    PMC * const hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
+    Parrot_ns_set_global(interp, hll_ns, SREG(1), PREG(2));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_set_p_k_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_hll_global_sc_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_set_pmc_keyed(interp, PREG(1), PREG(2), PREG(3));
+    PMC * const hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
+    Parrot_ns_set_global(interp, hll_ns, SCONST(1), PREG(2));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_set_p_kc_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_hll_global_p_s_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_set_pmc_keyed(interp, PREG(1), PCONST(2), PREG(3));
+    PMC * const hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
+    PMC * const ns     = Parrot_ns_make_namespace_keyed(interp, hll_ns, PREG(1));
+
+    Parrot_ns_set_global(interp, ns, SREG(2), PREG(3));
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_set_i_p_k(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_hll_global_pc_s_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = VTABLE_get_integer_keyed(interp, PREG(2), PREG(3));
+    PMC * const hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
+    PMC * const ns     = Parrot_ns_make_namespace_keyed(interp, hll_ns, PCONST(1));
+
+    Parrot_ns_set_global(interp, ns, SREG(2), PREG(3));
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_set_i_p_kc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_hll_global_p_sc_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = VTABLE_get_integer_keyed(interp, PREG(2), PCONST(3));
+    PMC * const hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
+    PMC * const ns     = Parrot_ns_make_namespace_keyed(interp, hll_ns, PREG(1));
+
+    Parrot_ns_set_global(interp, ns, SCONST(2), PREG(3));
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_set_n_p_k(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_hll_global_pc_sc_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    NREG(1) = VTABLE_get_number_keyed(interp, PREG(2), PREG(3));
+    PMC * const hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
+    PMC * const ns     = Parrot_ns_make_namespace_keyed(interp, hll_ns, PCONST(1));
+
+    Parrot_ns_set_global(interp, ns, SCONST(2), PREG(3));
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_set_n_p_kc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_root_global_s_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    NREG(1) = VTABLE_get_number_keyed(interp, PREG(2), PCONST(3));
+    PMC * const root_ns = interp->root_namespace;
+    Parrot_ns_set_global(interp, root_ns, SREG(1), PREG(2));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_set_s_p_k(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_root_global_sc_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    SREG(1) = VTABLE_get_string_keyed(interp, PREG(2), PREG(3));
+    PMC * const root_ns = interp->root_namespace;
+    Parrot_ns_set_global(interp, root_ns, SCONST(1), PREG(2));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_set_s_p_kc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_root_global_p_s_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    SREG(1) = VTABLE_get_string_keyed(interp, PREG(2), PCONST(3));
+    PMC * const root_ns = interp->root_namespace;
+    PMC * const ns      = Parrot_ns_make_namespace_keyed(interp, root_ns, PREG(1));
+
+    Parrot_ns_set_global(interp, ns, SREG(2), PREG(3));
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_set_p_p_k(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_root_global_pc_s_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_get_pmc_keyed(interp, PREG(2), PREG(3));
+    PMC * const root_ns = interp->root_namespace;
+    PMC * const ns      = Parrot_ns_make_namespace_keyed(interp, root_ns, PCONST(1));
+
+    Parrot_ns_set_global(interp, ns, SREG(2), PREG(3));
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_set_p_p_kc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_root_global_p_sc_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_get_pmc_keyed(interp, PREG(2), PCONST(3));
+    PMC * const root_ns = interp->root_namespace;
+    PMC * const ns      = Parrot_ns_make_namespace_keyed(interp, root_ns, PREG(1));
+
+    Parrot_ns_set_global(interp, ns, SCONST(2), PREG(3));
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_clone_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_root_global_pc_sc_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_clone(interp, PREG(2));
-
-return (opcode_t *)cur_opcode + 3;}
+    PMC * const root_ns = interp->root_namespace;
+    PMC * const ns      = Parrot_ns_make_namespace_keyed(interp, root_ns, PCONST(1));
 
-opcode_t *
-Parrot_clone_p_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
-    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_clone_pmc(interp, PREG(2), PREG(3));
+    Parrot_ns_set_global(interp, ns, SCONST(2), PREG(3));
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_clone_p_p_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_find_name_p_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_clone_pmc(interp, PREG(2), PCONST(3));
+    if (!SREG(2)) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, NULL,
+                EXCEPTION_INVALID_OPERATION,
+                "Tried to find null name");return (opcode_t *)handler;
+    }
 
-return (opcode_t *)cur_opcode + 4;}
+    PREG(1) = Parrot_ns_find_named_item(interp, SREG(2), cur_opcode + 3);
+
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_copy_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_find_name_p_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (PMC_IS_NULL(PREG(1))) {
-        opcode_t * const dest = cur_opcode + 3;
-        opcode_t * const handler = Parrot_ex_throw_from_op_args(interp, dest,
-                EXCEPTION_NULL_REG_ACCESS, "Null PMC in copy");return (opcode_t *)handler;
+    if (!SCONST(2)) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, NULL,
+                EXCEPTION_INVALID_OPERATION,
+                "Tried to find null name");return (opcode_t *)handler;
     }
-    else {
-        PMC   * const clone = VTABLE_clone(interp, PREG(2));
-        /* Preserve the metadata on the destination. */
-        PMC   * const meta  = VTABLE_getprops(interp, PREG(1));
 
-        /* avoid leaks and unreachable memory by destroying the destination PMC */
-        Parrot_pmc_destroy(interp, PREG(1));
+    PREG(1) = Parrot_ns_find_named_item(interp, SCONST(2), cur_opcode + 3);
 
-        /* the source PMC knows how to clone itself, but we must reuse the
-         * destination header */
-        memmove(PREG(1), clone, sizeof (PMC));
+return (opcode_t *)cur_opcode + 3;}
 
-        /* don't let the clone's destruction destroy the destination's data */
-        PObj_custom_destroy_CLEAR(clone);
-        PMC_data(clone)        = NULL;
-        PMC_metadata(clone)    = NULL;
+opcode_t *
+Parrot_find_sub_not_null_p_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    opcode_t *dest = cur_opcode + 3;
+    PMC *sub = Parrot_ns_find_named_item(interp, SREG(2), dest);
 
-        /* Restore metadata. */
-        if (!PMC_IS_NULL(meta)) {
-            PMC * const iter = VTABLE_get_iter(interp, meta);
-            while (VTABLE_get_bool(interp, iter)) {
-                STRING * const key = VTABLE_shift_string(interp, iter);
-                PMC * const value  = VTABLE_get_pmc_keyed_str(interp, meta, key);
-                VTABLE_setprop(interp, PREG(1), key, value);
-            }
-        }
+    if (PMC_IS_NULL(sub)) {
+        opcode_t *handler;
+        Parrot_pcc_set_pc_func(interp, CURRENT_CONTEXT(interp), dest);
+        handler = Parrot_ex_throw_from_op_args(interp, dest,
+                       EXCEPTION_GLOBAL_NOT_FOUND,
+                       "Could not find sub %Ss", SREG(2));return (opcode_t *)handler;
     }
 
-return (opcode_t *)cur_opcode + 3;}
-
-opcode_t *
-Parrot_null_s(opcode_t *cur_opcode, PARROT_INTERP)  {
-    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    SREG(1) = STRINGNULL;
+    PREG(1) = sub;
 
-return (opcode_t *)cur_opcode + 2;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_null_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_find_sub_not_null_p_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = 0;
+    opcode_t *dest = cur_opcode + 3;
+    PMC *sub = Parrot_ns_find_named_item(interp, SCONST(2), dest);
 
-return (opcode_t *)cur_opcode + 2;}
+    if (PMC_IS_NULL(sub)) {
+        opcode_t *handler;
+        Parrot_pcc_set_pc_func(interp, CURRENT_CONTEXT(interp), dest);
+        handler = Parrot_ex_throw_from_op_args(interp, dest,
+                       EXCEPTION_GLOBAL_NOT_FOUND,
+                       "Could not find sub %Ss", SCONST(2));return (opcode_t *)handler;
+    }
 
-opcode_t *
-Parrot_null_p(opcode_t *cur_opcode, PARROT_INTERP)  {
-    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = PMCNULL;
+    PREG(1) = sub;
 
-return (opcode_t *)cur_opcode + 2;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_null_n(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_trap(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    NREG(1) = 0;
+#if defined(__GNUC__) && defined(i386)
+    __asm__("int3");       /* opcode 0xcc */
+#endif
+#if defined(__GNUC__) && defined(PPC)
+    __asm__("trap");       /* opcode tr 31, 0, 0 */
+#endif
 
-return (opcode_t *)cur_opcode + 2;}
+return (opcode_t *)cur_opcode + 1;}
 
 opcode_t *
-Parrot_ord_i_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_label_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = STRING_ord(interp, SREG(2), 0);
+    VTABLE_set_pointer(interp, PREG(1), (CUR_OPCODE + ICONST(2)));
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_ord_i_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_get_label_i_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = STRING_ord(interp, SCONST(2), 0);
+    void * const ptr = VTABLE_get_pointer(interp, PREG(2));
+    IREG(1) =  PTR2INTVAL(ptr);
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_ord_i_s_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_fetch_p_p_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = STRING_ord(interp, SREG(2), IREG(3));
+    PREG(1) = VTABLE_get_pmc_keyed(interp, PREG(2), PREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PREG(4));
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PREG(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PREG(4)));return (opcode_t *)dest;
+            }
 
-return (opcode_t *)cur_opcode + 4;}
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
+    }
+
+return (opcode_t *)cur_opcode + 5;}
 
 opcode_t *
-Parrot_ord_i_sc_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_fetch_p_pc_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = STRING_ord(interp, SCONST(2), IREG(3));
+    PREG(1) = VTABLE_get_pmc_keyed(interp, PCONST(2), PREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PREG(4));
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PREG(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PREG(4)));return (opcode_t *)dest;
+            }
 
-return (opcode_t *)cur_opcode + 4;}
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
+    }
+
+return (opcode_t *)cur_opcode + 5;}
 
 opcode_t *
-Parrot_ord_i_s_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_fetch_p_p_pc_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = STRING_ord(interp, SREG(2), ICONST(3));
+    PREG(1) = VTABLE_get_pmc_keyed(interp, PREG(2), PCONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PREG(4));
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PREG(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PREG(4)));return (opcode_t *)dest;
+            }
 
-return (opcode_t *)cur_opcode + 4;}
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
+    }
+
+return (opcode_t *)cur_opcode + 5;}
 
 opcode_t *
-Parrot_ord_i_sc_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_fetch_p_pc_pc_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = STRING_ord(interp, SCONST(2), ICONST(3));
+    PREG(1) = VTABLE_get_pmc_keyed(interp, PCONST(2), PCONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PREG(4));
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PREG(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PREG(4)));return (opcode_t *)dest;
+            }
 
-return (opcode_t *)cur_opcode + 4;}
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
+    }
+
+return (opcode_t *)cur_opcode + 5;}
 
 opcode_t *
-Parrot_chr_s_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_fetch_p_p_p_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    STRING * const s = Parrot_str_chr(interp, (UINTVAL)IREG(2));
-    SREG(1) = s;
+    PREG(1) = VTABLE_get_pmc_keyed(interp, PREG(2), PREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PCONST(4));
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PCONST(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PCONST(4)));return (opcode_t *)dest;
+            }
 
-return (opcode_t *)cur_opcode + 3;}
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
+    }
+
+return (opcode_t *)cur_opcode + 5;}
 
 opcode_t *
-Parrot_chr_s_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_fetch_p_pc_p_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    STRING * const s = Parrot_str_chr(interp, (UINTVAL)ICONST(2));
-    SREG(1) = s;
+    PREG(1) = VTABLE_get_pmc_keyed(interp, PCONST(2), PREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PCONST(4));
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PCONST(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PCONST(4)));return (opcode_t *)dest;
+            }
 
-return (opcode_t *)cur_opcode + 3;}
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
+    }
+
+return (opcode_t *)cur_opcode + 5;}
 
 opcode_t *
-Parrot_chopn_s_s_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_fetch_p_p_pc_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    SREG(1) = Parrot_str_chopn(interp, SREG(2), IREG(3));
+    PREG(1) = VTABLE_get_pmc_keyed(interp, PREG(2), PCONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PCONST(4));
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PCONST(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PCONST(4)));return (opcode_t *)dest;
+            }
 
-return (opcode_t *)cur_opcode + 4;}
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
+    }
+
+return (opcode_t *)cur_opcode + 5;}
 
 opcode_t *
-Parrot_chopn_s_sc_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_fetch_p_pc_pc_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    SREG(1) = Parrot_str_chopn(interp, SCONST(2), IREG(3));
+    PREG(1) = VTABLE_get_pmc_keyed(interp, PCONST(2), PCONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PCONST(4));
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PCONST(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PCONST(4)));return (opcode_t *)dest;
+            }
 
-return (opcode_t *)cur_opcode + 4;}
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
+    }
+
+return (opcode_t *)cur_opcode + 5;}
 
 opcode_t *
-Parrot_chopn_s_s_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_fetch_p_p_i_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    SREG(1) = Parrot_str_chopn(interp, SREG(2), ICONST(3));
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PREG(2), IREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PREG(4));
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PREG(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PREG(4)));return (opcode_t *)dest;
+            }
 
-return (opcode_t *)cur_opcode + 4;}
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
+    }
+
+return (opcode_t *)cur_opcode + 5;}
 
 opcode_t *
-Parrot_chopn_s_sc_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_fetch_p_pc_i_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    SREG(1) = Parrot_str_chopn(interp, SCONST(2), ICONST(3));
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PCONST(2), IREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PREG(4));
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PREG(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PREG(4)));return (opcode_t *)dest;
+            }
+
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
+    }
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 5;}
 
 opcode_t *
-Parrot_concat_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_fetch_p_p_ic_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_i_concatenate(interp, PREG(1), PREG(2));
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PREG(2), ICONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PREG(4));
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PREG(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PREG(4)));return (opcode_t *)dest;
+            }
 
-return (opcode_t *)cur_opcode + 3;}
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
+    }
+
+return (opcode_t *)cur_opcode + 5;}
 
 opcode_t *
-Parrot_concat_p_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_fetch_p_pc_ic_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_i_concatenate_str(interp, PREG(1), SREG(2));
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PCONST(2), ICONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PREG(4));
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PREG(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PREG(4)));return (opcode_t *)dest;
+            }
 
-return (opcode_t *)cur_opcode + 3;}
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
+    }
+
+return (opcode_t *)cur_opcode + 5;}
 
 opcode_t *
-Parrot_concat_p_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_fetch_p_p_i_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_i_concatenate_str(interp, PREG(1), SCONST(2));
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PREG(2), IREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PCONST(4));
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PCONST(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PCONST(4)));return (opcode_t *)dest;
+            }
 
-return (opcode_t *)cur_opcode + 3;}
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
+    }
+
+return (opcode_t *)cur_opcode + 5;}
 
 opcode_t *
-Parrot_concat_s_s_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_fetch_p_pc_i_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    SREG(1) = Parrot_str_concat(interp, SREG(2), SREG(3));
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PCONST(2), IREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PCONST(4));
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PCONST(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PCONST(4)));return (opcode_t *)dest;
+            }
 
-return (opcode_t *)cur_opcode + 4;}
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
+    }
+
+return (opcode_t *)cur_opcode + 5;}
 
 opcode_t *
-Parrot_concat_s_sc_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_fetch_p_p_ic_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    SREG(1) = Parrot_str_concat(interp, SCONST(2), SREG(3));
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PREG(2), ICONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PCONST(4));
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PCONST(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PCONST(4)));return (opcode_t *)dest;
+            }
 
-return (opcode_t *)cur_opcode + 4;}
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
+    }
+
+return (opcode_t *)cur_opcode + 5;}
 
 opcode_t *
-Parrot_concat_s_s_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_fetch_p_pc_ic_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    SREG(1) = Parrot_str_concat(interp, SREG(2), SCONST(3));
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PCONST(2), ICONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PCONST(4));
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PCONST(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PCONST(4)));return (opcode_t *)dest;
+            }
 
-return (opcode_t *)cur_opcode + 4;}
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
+    }
+
+return (opcode_t *)cur_opcode + 5;}
 
 opcode_t *
-Parrot_concat_p_p_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_fetch_p_p_s_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_concatenate_str(interp, PREG(2), SREG(3), PREG(1));
+    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PREG(2), SREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PREG(4));
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PREG(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PREG(4)));return (opcode_t *)dest;
+            }
 
-return (opcode_t *)cur_opcode + 4;}
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
+    }
+
+return (opcode_t *)cur_opcode + 5;}
 
 opcode_t *
-Parrot_concat_p_p_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_fetch_p_pc_s_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_concatenate_str(interp, PREG(2), SCONST(3), PREG(1));
+    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PCONST(2), SREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PREG(4));
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PREG(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PREG(4)));return (opcode_t *)dest;
+            }
 
-return (opcode_t *)cur_opcode + 4;}
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
+    }
+
+return (opcode_t *)cur_opcode + 5;}
 
 opcode_t *
-Parrot_concat_p_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_fetch_p_p_sc_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_concatenate(interp, PREG(2), PREG(3), PREG(1));
+    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PREG(2), SCONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PREG(4));
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PREG(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PREG(4)));return (opcode_t *)dest;
+            }
 
-return (opcode_t *)cur_opcode + 4;}
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
+    }
+
+return (opcode_t *)cur_opcode + 5;}
 
 opcode_t *
-Parrot_repeat_s_s_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_fetch_p_pc_sc_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (IREG(3) < 0) {
-        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, NULL,
-                EXCEPTION_NEG_REPEAT,
-                "Cannot repeat with negative arg");return (opcode_t *)handler;
+    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PCONST(2), SCONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PREG(4));
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PREG(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PREG(4)));return (opcode_t *)dest;
+            }
+
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
     }
-    SREG(1) = Parrot_str_repeat(interp, SREG(2), (UINTVAL)IREG(3));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 5;}
 
 opcode_t *
-Parrot_repeat_s_sc_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_fetch_p_p_s_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (IREG(3) < 0) {
-        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, NULL,
-                EXCEPTION_NEG_REPEAT,
-                "Cannot repeat with negative arg");return (opcode_t *)handler;
+    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PREG(2), SREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PCONST(4));
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PCONST(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PCONST(4)));return (opcode_t *)dest;
+            }
+
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
     }
-    SREG(1) = Parrot_str_repeat(interp, SCONST(2), (UINTVAL)IREG(3));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 5;}
 
 opcode_t *
-Parrot_repeat_s_s_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_fetch_p_pc_s_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (ICONST(3) < 0) {
-        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, NULL,
-                EXCEPTION_NEG_REPEAT,
-                "Cannot repeat with negative arg");return (opcode_t *)handler;
+    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PCONST(2), SREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PCONST(4));
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PCONST(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PCONST(4)));return (opcode_t *)dest;
+            }
+
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
     }
-    SREG(1) = Parrot_str_repeat(interp, SREG(2), (UINTVAL)ICONST(3));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 5;}
 
 opcode_t *
-Parrot_repeat_s_sc_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_fetch_p_p_sc_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (ICONST(3) < 0) {
-        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, NULL,
-                EXCEPTION_NEG_REPEAT,
-                "Cannot repeat with negative arg");return (opcode_t *)handler;
+    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PREG(2), SCONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PCONST(4));
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PCONST(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PCONST(4)));return (opcode_t *)dest;
+            }
+
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
     }
-    SREG(1) = Parrot_str_repeat(interp, SCONST(2), (UINTVAL)ICONST(3));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 5;}
 
 opcode_t *
-Parrot_repeat_p_p_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_fetch_p_pc_sc_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (IREG(3) < 0) {
-        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, NULL,
-                EXCEPTION_NEG_REPEAT,
-                "Cannot repeat with negative arg");return (opcode_t *)handler;
+    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PCONST(2), SCONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PCONST(4));
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PCONST(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PCONST(4)));return (opcode_t *)dest;
+            }
+
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
     }
-    PREG(1) = VTABLE_repeat_int(interp, PREG(2), IREG(3), PREG(1));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 5;}
 
 opcode_t *
-Parrot_repeat_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_vivify_p_p_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (ICONST(3) < 0) {
-        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, NULL,
-                EXCEPTION_NEG_REPEAT,
-                "Cannot repeat with negative arg");return (opcode_t *)handler;
-    }
-    PREG(1) = VTABLE_repeat_int(interp, PREG(2), ICONST(3), PREG(1));
+    PREG(1) = VTABLE_get_pmc_keyed(interp, PREG(2), PREG(3));
 
-return (opcode_t *)cur_opcode + 4;}
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PREG(4));
 
-opcode_t *
-Parrot_repeat_p_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
-    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (VTABLE_get_integer(interp, PREG(3)) < 0) {
-        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, NULL,
-                EXCEPTION_NEG_REPEAT,
-                "Cannot repeat with negative arg");return (opcode_t *)handler;
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PREG(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PREG(4)));return (opcode_t *)dest;
+            }
+
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
+        VTABLE_set_pmc_keyed(interp, PREG(2), PREG(3), PREG(1));
     }
-    PREG(1) = VTABLE_repeat(interp, PREG(2), PREG(3), PREG(1));
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 5;}
 
 opcode_t *
-Parrot_repeat_p_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_vivify_p_pc_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_i_repeat_int(interp, PREG(1), IREG(2));
+    PREG(1) = VTABLE_get_pmc_keyed(interp, PCONST(2), PREG(3));
 
-return (opcode_t *)cur_opcode + 3;}
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PREG(4));
 
-opcode_t *
-Parrot_repeat_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
-    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_i_repeat_int(interp, PREG(1), ICONST(2));
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PREG(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PREG(4)));return (opcode_t *)dest;
+            }
 
-return (opcode_t *)cur_opcode + 3;}
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
+        VTABLE_set_pmc_keyed(interp, PCONST(2), PREG(3), PREG(1));
+    }
+
+return (opcode_t *)cur_opcode + 5;}
 
 opcode_t *
-Parrot_repeat_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_vivify_p_p_pc_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_i_repeat(interp, PREG(1), PREG(2));
+    PREG(1) = VTABLE_get_pmc_keyed(interp, PREG(2), PCONST(3));
 
-return (opcode_t *)cur_opcode + 3;}
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PREG(4));
 
-opcode_t *
-Parrot_length_i_s(opcode_t *cur_opcode, PARROT_INTERP)  {
-    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = Parrot_str_length(interp, SREG(2));
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PREG(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PREG(4)));return (opcode_t *)dest;
+            }
 
-return (opcode_t *)cur_opcode + 3;}
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
+        VTABLE_set_pmc_keyed(interp, PREG(2), PCONST(3), PREG(1));
+    }
+
+return (opcode_t *)cur_opcode + 5;}
 
 opcode_t *
-Parrot_length_i_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_vivify_p_pc_pc_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = Parrot_str_length(interp, SCONST(2));
+    PREG(1) = VTABLE_get_pmc_keyed(interp, PCONST(2), PCONST(3));
 
-return (opcode_t *)cur_opcode + 3;}
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PREG(4));
 
-opcode_t *
-Parrot_bytelength_i_s(opcode_t *cur_opcode, PARROT_INTERP)  {
-    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = Parrot_str_byte_length(interp, SREG(2));
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PREG(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PREG(4)));return (opcode_t *)dest;
+            }
 
-return (opcode_t *)cur_opcode + 3;}
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
+        VTABLE_set_pmc_keyed(interp, PCONST(2), PCONST(3), PREG(1));
+    }
+
+return (opcode_t *)cur_opcode + 5;}
 
 opcode_t *
-Parrot_bytelength_i_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_vivify_p_p_p_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = Parrot_str_byte_length(interp, SCONST(2));
+    PREG(1) = VTABLE_get_pmc_keyed(interp, PREG(2), PREG(3));
 
-return (opcode_t *)cur_opcode + 3;}
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PCONST(4));
 
-opcode_t *
-Parrot_pin_s(opcode_t *cur_opcode, PARROT_INTERP)  {
-    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    Parrot_str_pin(interp, SREG(1));
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PCONST(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PCONST(4)));return (opcode_t *)dest;
+            }
 
-return (opcode_t *)cur_opcode + 2;}
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
+        VTABLE_set_pmc_keyed(interp, PREG(2), PREG(3), PREG(1));
+    }
+
+return (opcode_t *)cur_opcode + 5;}
 
 opcode_t *
-Parrot_unpin_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_vivify_p_pc_p_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    Parrot_str_unpin(interp, SREG(1));
+    PREG(1) = VTABLE_get_pmc_keyed(interp, PCONST(2), PREG(3));
 
-return (opcode_t *)cur_opcode + 2;}
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PCONST(4));
 
-opcode_t *
-Parrot_substr_s_s_i(opcode_t *cur_opcode, PARROT_INTERP)  {
-    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    const INTVAL len = Parrot_str_byte_length(interp, SREG(2));
-    SREG(1) = STRING_substr(interp, SREG(2), IREG(3), len);
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PCONST(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PCONST(4)));return (opcode_t *)dest;
+            }
 
-return (opcode_t *)cur_opcode + 4;}
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
+        VTABLE_set_pmc_keyed(interp, PCONST(2), PREG(3), PREG(1));
+    }
+
+return (opcode_t *)cur_opcode + 5;}
 
 opcode_t *
-Parrot_substr_s_sc_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_vivify_p_p_pc_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    const INTVAL len = Parrot_str_byte_length(interp, SCONST(2));
-    SREG(1) = STRING_substr(interp, SCONST(2), IREG(3), len);
+    PREG(1) = VTABLE_get_pmc_keyed(interp, PREG(2), PCONST(3));
 
-return (opcode_t *)cur_opcode + 4;}
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PCONST(4));
 
-opcode_t *
-Parrot_substr_s_s_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
-    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    const INTVAL len = Parrot_str_byte_length(interp, SREG(2));
-    SREG(1) = STRING_substr(interp, SREG(2), ICONST(3), len);
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PCONST(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PCONST(4)));return (opcode_t *)dest;
+            }
+
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
+        VTABLE_set_pmc_keyed(interp, PREG(2), PCONST(3), PREG(1));
+    }
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 5;}
 
 opcode_t *
-Parrot_substr_s_sc_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_vivify_p_pc_pc_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    const INTVAL len = Parrot_str_byte_length(interp, SCONST(2));
-    SREG(1) = STRING_substr(interp, SCONST(2), ICONST(3), len);
-
-return (opcode_t *)cur_opcode + 4;}
+    PREG(1) = VTABLE_get_pmc_keyed(interp, PCONST(2), PCONST(3));
 
-opcode_t *
-Parrot_substr_s_s_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
-    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    SREG(1) = STRING_substr(interp, SREG(2), IREG(3), IREG(4));
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PCONST(4));
 
-return (opcode_t *)cur_opcode + 5;}
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PCONST(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PCONST(4)));return (opcode_t *)dest;
+            }
 
-opcode_t *
-Parrot_substr_s_sc_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
-    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    SREG(1) = STRING_substr(interp, SCONST(2), IREG(3), IREG(4));
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
+        VTABLE_set_pmc_keyed(interp, PCONST(2), PCONST(3), PREG(1));
+    }
 
 return (opcode_t *)cur_opcode + 5;}
 
 opcode_t *
-Parrot_substr_s_s_ic_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_vivify_p_p_i_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    SREG(1) = STRING_substr(interp, SREG(2), ICONST(3), IREG(4));
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PREG(2), IREG(3));
 
-return (opcode_t *)cur_opcode + 5;}
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PREG(4));
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PREG(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PREG(4)));return (opcode_t *)dest;
+            }
 
-opcode_t *
-Parrot_substr_s_sc_ic_i(opcode_t *cur_opcode, PARROT_INTERP)  {
-    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    SREG(1) = STRING_substr(interp, SCONST(2), ICONST(3), IREG(4));
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
+
+        VTABLE_set_pmc_keyed_int(interp, PREG(2), IREG(3), PREG(1));
+    }
 
 return (opcode_t *)cur_opcode + 5;}
 
 opcode_t *
-Parrot_substr_s_s_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_vivify_p_pc_i_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    SREG(1) = STRING_substr(interp, SREG(2), IREG(3), ICONST(4));
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PCONST(2), IREG(3));
 
-return (opcode_t *)cur_opcode + 5;}
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PREG(4));
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PREG(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PREG(4)));return (opcode_t *)dest;
+            }
 
-opcode_t *
-Parrot_substr_s_sc_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
-    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    SREG(1) = STRING_substr(interp, SCONST(2), IREG(3), ICONST(4));
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
+
+        VTABLE_set_pmc_keyed_int(interp, PCONST(2), IREG(3), PREG(1));
+    }
 
 return (opcode_t *)cur_opcode + 5;}
 
 opcode_t *
-Parrot_substr_s_s_ic_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_vivify_p_p_ic_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    SREG(1) = STRING_substr(interp, SREG(2), ICONST(3), ICONST(4));
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PREG(2), ICONST(3));
 
-return (opcode_t *)cur_opcode + 5;}
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PREG(4));
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PREG(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PREG(4)));return (opcode_t *)dest;
+            }
 
-opcode_t *
-Parrot_substr_s_sc_ic_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
-    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    SREG(1) = STRING_substr(interp, SCONST(2), ICONST(3), ICONST(4));
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
+
+        VTABLE_set_pmc_keyed_int(interp, PREG(2), ICONST(3), PREG(1));
+    }
 
 return (opcode_t *)cur_opcode + 5;}
 
 opcode_t *
-Parrot_substr_s_p_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_vivify_p_pc_ic_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    SREG(1) = VTABLE_substr_str(interp, PREG(2), IREG(3), IREG(4));
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PCONST(2), ICONST(3));
 
-return (opcode_t *)cur_opcode + 5;}
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PREG(4));
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PREG(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PREG(4)));return (opcode_t *)dest;
+            }
 
-opcode_t *
-Parrot_substr_s_p_ic_i(opcode_t *cur_opcode, PARROT_INTERP)  {
-    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    SREG(1) = VTABLE_substr_str(interp, PREG(2), ICONST(3), IREG(4));
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
+
+        VTABLE_set_pmc_keyed_int(interp, PCONST(2), ICONST(3), PREG(1));
+    }
 
 return (opcode_t *)cur_opcode + 5;}
 
 opcode_t *
-Parrot_substr_s_p_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_vivify_p_p_i_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    SREG(1) = VTABLE_substr_str(interp, PREG(2), IREG(3), ICONST(4));
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PREG(2), IREG(3));
 
-return (opcode_t *)cur_opcode + 5;}
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PCONST(4));
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PCONST(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PCONST(4)));return (opcode_t *)dest;
+            }
 
-opcode_t *
-Parrot_substr_s_p_ic_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
-    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    SREG(1) = VTABLE_substr_str(interp, PREG(2), ICONST(3), ICONST(4));
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
+
+        VTABLE_set_pmc_keyed_int(interp, PREG(2), IREG(3), PREG(1));
+    }
 
 return (opcode_t *)cur_opcode + 5;}
 
 opcode_t *
-Parrot_replace_s_s_i_i_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_vivify_p_pc_i_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    SREG(1) = Parrot_str_replace(interp, SREG(2), IREG(3), IREG(4), SREG(5));
-
-return (opcode_t *)cur_opcode + 6;}
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PCONST(2), IREG(3));
 
-opcode_t *
-Parrot_replace_s_sc_i_i_s(opcode_t *cur_opcode, PARROT_INTERP)  {
-    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    SREG(1) = Parrot_str_replace(interp, SCONST(2), IREG(3), IREG(4), SREG(5));
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PCONST(4));
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PCONST(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PCONST(4)));return (opcode_t *)dest;
+            }
 
-return (opcode_t *)cur_opcode + 6;}
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
 
-opcode_t *
-Parrot_replace_s_s_ic_i_s(opcode_t *cur_opcode, PARROT_INTERP)  {
-    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    SREG(1) = Parrot_str_replace(interp, SREG(2), ICONST(3), IREG(4), SREG(5));
+        VTABLE_set_pmc_keyed_int(interp, PCONST(2), IREG(3), PREG(1));
+    }
 
-return (opcode_t *)cur_opcode + 6;}
+return (opcode_t *)cur_opcode + 5;}
 
 opcode_t *
-Parrot_replace_s_sc_ic_i_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_vivify_p_p_ic_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    SREG(1) = Parrot_str_replace(interp, SCONST(2), ICONST(3), IREG(4), SREG(5));
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PREG(2), ICONST(3));
 
-return (opcode_t *)cur_opcode + 6;}
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PCONST(4));
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PCONST(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PCONST(4)));return (opcode_t *)dest;
+            }
 
-opcode_t *
-Parrot_replace_s_s_i_ic_s(opcode_t *cur_opcode, PARROT_INTERP)  {
-    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    SREG(1) = Parrot_str_replace(interp, SREG(2), IREG(3), ICONST(4), SREG(5));
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
 
-return (opcode_t *)cur_opcode + 6;}
+        VTABLE_set_pmc_keyed_int(interp, PREG(2), ICONST(3), PREG(1));
+    }
+
+return (opcode_t *)cur_opcode + 5;}
 
 opcode_t *
-Parrot_replace_s_sc_i_ic_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_vivify_p_pc_ic_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    SREG(1) = Parrot_str_replace(interp, SCONST(2), IREG(3), ICONST(4), SREG(5));
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PCONST(2), ICONST(3));
 
-return (opcode_t *)cur_opcode + 6;}
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PCONST(4));
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PCONST(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PCONST(4)));return (opcode_t *)dest;
+            }
 
-opcode_t *
-Parrot_replace_s_s_ic_ic_s(opcode_t *cur_opcode, PARROT_INTERP)  {
-    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    SREG(1) = Parrot_str_replace(interp, SREG(2), ICONST(3), ICONST(4), SREG(5));
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
 
-return (opcode_t *)cur_opcode + 6;}
+        VTABLE_set_pmc_keyed_int(interp, PCONST(2), ICONST(3), PREG(1));
+    }
+
+return (opcode_t *)cur_opcode + 5;}
 
 opcode_t *
-Parrot_replace_s_sc_ic_ic_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_vivify_p_p_s_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    SREG(1) = Parrot_str_replace(interp, SCONST(2), ICONST(3), ICONST(4), SREG(5));
+    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PREG(2), SREG(3));
+
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PREG(4));
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PREG(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PREG(4)));return (opcode_t *)dest;
+            }
 
-return (opcode_t *)cur_opcode + 6;}
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
 
-opcode_t *
-Parrot_replace_s_s_i_i_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
-    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    SREG(1) = Parrot_str_replace(interp, SREG(2), IREG(3), IREG(4), SCONST(5));
+        VTABLE_set_pmc_keyed_str(interp, PREG(2), SREG(3), PREG(1));
+    }
 
-return (opcode_t *)cur_opcode + 6;}
+return (opcode_t *)cur_opcode + 5;}
 
 opcode_t *
-Parrot_replace_s_sc_i_i_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_vivify_p_pc_s_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    SREG(1) = Parrot_str_replace(interp, SCONST(2), IREG(3), IREG(4), SCONST(5));
-
-return (opcode_t *)cur_opcode + 6;}
+    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PCONST(2), SREG(3));
 
-opcode_t *
-Parrot_replace_s_s_ic_i_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
-    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    SREG(1) = Parrot_str_replace(interp, SREG(2), ICONST(3), IREG(4), SCONST(5));
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PREG(4));
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PREG(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PREG(4)));return (opcode_t *)dest;
+            }
 
-return (opcode_t *)cur_opcode + 6;}
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
 
-opcode_t *
-Parrot_replace_s_sc_ic_i_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
-    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    SREG(1) = Parrot_str_replace(interp, SCONST(2), ICONST(3), IREG(4), SCONST(5));
+        VTABLE_set_pmc_keyed_str(interp, PCONST(2), SREG(3), PREG(1));
+    }
 
-return (opcode_t *)cur_opcode + 6;}
+return (opcode_t *)cur_opcode + 5;}
 
 opcode_t *
-Parrot_replace_s_s_i_ic_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_vivify_p_p_sc_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    SREG(1) = Parrot_str_replace(interp, SREG(2), IREG(3), ICONST(4), SCONST(5));
-
-return (opcode_t *)cur_opcode + 6;}
+    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PREG(2), SCONST(3));
 
-opcode_t *
-Parrot_replace_s_sc_i_ic_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
-    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    SREG(1) = Parrot_str_replace(interp, SCONST(2), IREG(3), ICONST(4), SCONST(5));
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PREG(4));
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PREG(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PREG(4)));return (opcode_t *)dest;
+            }
 
-return (opcode_t *)cur_opcode + 6;}
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
 
-opcode_t *
-Parrot_replace_s_s_ic_ic_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
-    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    SREG(1) = Parrot_str_replace(interp, SREG(2), ICONST(3), ICONST(4), SCONST(5));
+        VTABLE_set_pmc_keyed_str(interp, PREG(2), SCONST(3), PREG(1));
+    }
 
-return (opcode_t *)cur_opcode + 6;}
+return (opcode_t *)cur_opcode + 5;}
 
 opcode_t *
-Parrot_replace_s_sc_ic_ic_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_vivify_p_pc_sc_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    SREG(1) = Parrot_str_replace(interp, SCONST(2), ICONST(3), ICONST(4), SCONST(5));
+    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PCONST(2), SCONST(3));
 
-return (opcode_t *)cur_opcode + 6;}
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PREG(4));
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PREG(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PREG(4)));return (opcode_t *)dest;
+            }
 
-opcode_t *
-Parrot_index_i_s_s(opcode_t *cur_opcode, PARROT_INTERP)  {
-    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = (SREG(2) && SREG(3)) ? STRING_index(interp, SREG(2), SREG(3), 0) : -1;
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
 
-return (opcode_t *)cur_opcode + 4;}
+        VTABLE_set_pmc_keyed_str(interp, PCONST(2), SCONST(3), PREG(1));
+    }
+
+return (opcode_t *)cur_opcode + 5;}
 
 opcode_t *
-Parrot_index_i_sc_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_vivify_p_p_s_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = (SCONST(2) && SREG(3)) ? STRING_index(interp, SCONST(2), SREG(3), 0) : -1;
+    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PREG(2), SREG(3));
 
-return (opcode_t *)cur_opcode + 4;}
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PCONST(4));
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PCONST(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PCONST(4)));return (opcode_t *)dest;
+            }
 
-opcode_t *
-Parrot_index_i_s_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
-    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = (SREG(2) && SCONST(3)) ? STRING_index(interp, SREG(2), SCONST(3), 0) : -1;
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
 
-return (opcode_t *)cur_opcode + 4;}
+        VTABLE_set_pmc_keyed_str(interp, PREG(2), SREG(3), PREG(1));
+    }
+
+return (opcode_t *)cur_opcode + 5;}
 
 opcode_t *
-Parrot_index_i_sc_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_vivify_p_pc_s_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = (SCONST(2) && SCONST(3)) ? STRING_index(interp, SCONST(2), SCONST(3), 0) : -1;
+    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PCONST(2), SREG(3));
 
-return (opcode_t *)cur_opcode + 4;}
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PCONST(4));
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PCONST(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PCONST(4)));return (opcode_t *)dest;
+            }
 
-opcode_t *
-Parrot_index_i_s_s_i(opcode_t *cur_opcode, PARROT_INTERP)  {
-    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = (SREG(2) && SREG(3)) ? STRING_index(interp, SREG(2), SREG(3), IREG(4)) : -1;
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
+
+        VTABLE_set_pmc_keyed_str(interp, PCONST(2), SREG(3), PREG(1));
+    }
 
 return (opcode_t *)cur_opcode + 5;}
 
 opcode_t *
-Parrot_index_i_sc_s_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_vivify_p_p_sc_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = (SCONST(2) && SREG(3)) ? STRING_index(interp, SCONST(2), SREG(3), IREG(4)) : -1;
+    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PREG(2), SCONST(3));
 
-return (opcode_t *)cur_opcode + 5;}
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PCONST(4));
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PCONST(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PCONST(4)));return (opcode_t *)dest;
+            }
 
-opcode_t *
-Parrot_index_i_s_sc_i(opcode_t *cur_opcode, PARROT_INTERP)  {
-    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = (SREG(2) && SCONST(3)) ? STRING_index(interp, SREG(2), SCONST(3), IREG(4)) : -1;
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
+
+        VTABLE_set_pmc_keyed_str(interp, PREG(2), SCONST(3), PREG(1));
+    }
 
 return (opcode_t *)cur_opcode + 5;}
 
 opcode_t *
-Parrot_index_i_sc_sc_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_vivify_p_pc_sc_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = (SCONST(2) && SCONST(3)) ? STRING_index(interp, SCONST(2), SCONST(3), IREG(4)) : -1;
+    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PCONST(2), SCONST(3));
 
-return (opcode_t *)cur_opcode + 5;}
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PCONST(4));
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PCONST(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PCONST(4)));return (opcode_t *)dest;
+            }
 
-opcode_t *
-Parrot_index_i_s_s_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
-    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = (SREG(2) && SREG(3)) ? STRING_index(interp, SREG(2), SREG(3), ICONST(4)) : -1;
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
+
+        VTABLE_set_pmc_keyed_str(interp, PCONST(2), SCONST(3), PREG(1));
+    }
 
 return (opcode_t *)cur_opcode + 5;}
 
 opcode_t *
-Parrot_index_i_sc_s_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_new_p_s_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = (SCONST(2) && SREG(3)) ? STRING_index(interp, SCONST(2), SREG(3), ICONST(4)) : -1;
+    STRING * const name   = SREG(2);
+    PMC    * const _class = Parrot_pcc_get_HLL(interp, CURRENT_CONTEXT(interp))
+                          ? Parrot_oo_get_class_str(interp, name)
+                          : PMCNULL;
 
-return (opcode_t *)cur_opcode + 5;}
+    if (!PMC_IS_NULL(_class)) {
+        PMC *initial = Parrot_pmc_new(interp,
+                                      Parrot_hll_get_ctx_HLL_type(interp, enum_class_Integer));
+        VTABLE_set_integer_native(interp, initial, IREG(3));
+        PREG(1) = VTABLE_instantiate(interp, _class, initial);
+    }
+    else {
+        const INTVAL type = Parrot_pmc_get_type_str(interp, name);
+        if (type <= 0) {
+            opcode_t *dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
+                EXCEPTION_NO_CLASS,
+                "Class '%Ss' not found", name);return (opcode_t *)dest;
+        }
+        PREG(1) = Parrot_pmc_new_init_int(interp, type, IREG(3));
+    }
+
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_index_i_s_sc_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_new_p_sc_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = (SREG(2) && SCONST(3)) ? STRING_index(interp, SREG(2), SCONST(3), ICONST(4)) : -1;
+    STRING * const name   = SCONST(2);
+    PMC    * const _class = Parrot_pcc_get_HLL(interp, CURRENT_CONTEXT(interp))
+                          ? Parrot_oo_get_class_str(interp, name)
+                          : PMCNULL;
+
+    if (!PMC_IS_NULL(_class)) {
+        PMC *initial = Parrot_pmc_new(interp,
+                                      Parrot_hll_get_ctx_HLL_type(interp, enum_class_Integer));
+        VTABLE_set_integer_native(interp, initial, IREG(3));
+        PREG(1) = VTABLE_instantiate(interp, _class, initial);
+    }
+    else {
+        const INTVAL type = Parrot_pmc_get_type_str(interp, name);
+        if (type <= 0) {
+            opcode_t *dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
+                EXCEPTION_NO_CLASS,
+                "Class '%Ss' not found", name);return (opcode_t *)dest;
+        }
+        PREG(1) = Parrot_pmc_new_init_int(interp, type, IREG(3));
+    }
 
-return (opcode_t *)cur_opcode + 5;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_index_i_sc_sc_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_new_p_s_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = (SCONST(2) && SCONST(3)) ? STRING_index(interp, SCONST(2), SCONST(3), ICONST(4)) : -1;
-
-return (opcode_t *)cur_opcode + 5;}
+    STRING * const name   = SREG(2);
+    PMC    * const _class = Parrot_pcc_get_HLL(interp, CURRENT_CONTEXT(interp))
+                          ? Parrot_oo_get_class_str(interp, name)
+                          : PMCNULL;
 
-opcode_t *
-Parrot_sprintf_s_s_p(opcode_t *cur_opcode, PARROT_INTERP)  {
-    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    SREG(1)=Parrot_psprintf(interp, SREG(2), PREG(3));
+    if (!PMC_IS_NULL(_class)) {
+        PMC *initial = Parrot_pmc_new(interp,
+                                      Parrot_hll_get_ctx_HLL_type(interp, enum_class_Integer));
+        VTABLE_set_integer_native(interp, initial, ICONST(3));
+        PREG(1) = VTABLE_instantiate(interp, _class, initial);
+    }
+    else {
+        const INTVAL type = Parrot_pmc_get_type_str(interp, name);
+        if (type <= 0) {
+            opcode_t *dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
+                EXCEPTION_NO_CLASS,
+                "Class '%Ss' not found", name);return (opcode_t *)dest;
+        }
+        PREG(1) = Parrot_pmc_new_init_int(interp, type, ICONST(3));
+    }
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_sprintf_s_sc_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_new_p_sc_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    SREG(1)=Parrot_psprintf(interp, SCONST(2), PREG(3));
-
-return (opcode_t *)cur_opcode + 4;}
+    STRING * const name   = SCONST(2);
+    PMC    * const _class = Parrot_pcc_get_HLL(interp, CURRENT_CONTEXT(interp))
+                          ? Parrot_oo_get_class_str(interp, name)
+                          : PMCNULL;
 
-opcode_t *
-Parrot_sprintf_p_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
-    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_set_string_native(interp, PREG(1),
-        Parrot_psprintf(interp, VTABLE_get_string(interp, PREG(2)), PREG(3)));
+    if (!PMC_IS_NULL(_class)) {
+        PMC *initial = Parrot_pmc_new(interp,
+                                      Parrot_hll_get_ctx_HLL_type(interp, enum_class_Integer));
+        VTABLE_set_integer_native(interp, initial, ICONST(3));
+        PREG(1) = VTABLE_instantiate(interp, _class, initial);
+    }
+    else {
+        const INTVAL type = Parrot_pmc_get_type_str(interp, name);
+        if (type <= 0) {
+            opcode_t *dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
+                EXCEPTION_NO_CLASS,
+                "Class '%Ss' not found", name);return (opcode_t *)dest;
+        }
+        PREG(1) = Parrot_pmc_new_init_int(interp, type, ICONST(3));
+    }
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_new_s(opcode_t *cur_opcode, PARROT_INTERP)  {
-    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    SREG(1) = Parrot_str_new_noinit(interp, 0);
-
-return (opcode_t *)cur_opcode + 2;}
-
-opcode_t *
-Parrot_new_s_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_new_p_p_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    SREG(1) = Parrot_str_new_noinit(interp, IREG(2));
+    PMC * const  name_key = PREG(2);
 
-return (opcode_t *)cur_opcode + 3;}
+    /* get_class() returns a PMCProxy for core types, so check for core PMCs */
+    const INTVAL type = Parrot_pmc_get_type(interp, name_key);
 
-opcode_t *
-Parrot_new_s_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
-    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    SREG(1) = Parrot_str_new_noinit(interp, ICONST(2));
+    /* if it's clearly a PIR-level PMC */
+    if (type > enum_class_core_max) {
+        PMC * const _class = Parrot_oo_get_class(interp, name_key);
+        if (!PMC_IS_NULL(_class)) {
+            PMC *initial = Parrot_pmc_new(interp,
+                Parrot_hll_get_ctx_HLL_type(interp, enum_class_Integer));
+            VTABLE_set_integer_native(interp, initial, IREG(3));
+            PREG(1) = VTABLE_instantiate(interp, _class, initial);
+        }
+    }
 
-return (opcode_t *)cur_opcode + 3;}
+    /* if it's a core PMC */
+    else if (type > enum_class_default)
+        PREG(1) = Parrot_pmc_new_init_int(interp, type, IREG(3));
 
-opcode_t *
-Parrot_stringinfo_i_s_i(opcode_t *cur_opcode, PARROT_INTERP)  {
-    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (SREG(2) == NULL)
-        IREG(1) = 0;
+    /* it's a typo */
     else {
-        switch (IREG(3)) {
-          case STRINGINFO_HEADER:
-            IREG(1) = PTR2UINTVAL(SREG(2));
-            break;
-          case STRINGINFO_STRSTART:
-            IREG(1) = PTR2UINTVAL(SREG(2)->strstart);
-            break;
-          case STRINGINFO_BUFLEN:
-            IREG(1) = Buffer_buflen(SREG(2));
-            break;
-          case STRINGINFO_FLAGS:
-            IREG(1) = PObj_get_FLAGS(SREG(2));
-            break;
-          case STRINGINFO_BUFUSED:
-            IREG(1) = SREG(2)->bufused;
-            break;
-          case STRINGINFO_STRLEN:
-            IREG(1) = SREG(2)->strlen;
-            break;
-          default:
-            {
-                opcode_t *handler = Parrot_ex_throw_from_op_args(interp, NULL,
-                    EXCEPTION_INVALID_OPERATION,
-                    "stringinfo: unknown info type: %d", IREG(3));return (opcode_t *)handler;
-            }
-        }
+        opcode_t *dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
+            EXCEPTION_NO_CLASS,
+            "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));return (opcode_t *)dest;
     }
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_stringinfo_i_sc_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_new_p_pc_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (SCONST(2) == NULL)
-        IREG(1) = 0;
-    else {
-        switch (IREG(3)) {
-          case STRINGINFO_HEADER:
-            IREG(1) = PTR2UINTVAL(SCONST(2));
-            break;
-          case STRINGINFO_STRSTART:
-            IREG(1) = PTR2UINTVAL(SCONST(2)->strstart);
-            break;
-          case STRINGINFO_BUFLEN:
-            IREG(1) = Buffer_buflen(SCONST(2));
-            break;
-          case STRINGINFO_FLAGS:
-            IREG(1) = PObj_get_FLAGS(SCONST(2));
-            break;
-          case STRINGINFO_BUFUSED:
-            IREG(1) = SCONST(2)->bufused;
-            break;
-          case STRINGINFO_STRLEN:
-            IREG(1) = SCONST(2)->strlen;
-            break;
-          default:
-            {
-                opcode_t *handler = Parrot_ex_throw_from_op_args(interp, NULL,
-                    EXCEPTION_INVALID_OPERATION,
-                    "stringinfo: unknown info type: %d", IREG(3));return (opcode_t *)handler;
-            }
+    PMC * const  name_key = PCONST(2);
+
+    /* get_class() returns a PMCProxy for core types, so check for core PMCs */
+    const INTVAL type = Parrot_pmc_get_type(interp, name_key);
+
+    /* if it's clearly a PIR-level PMC */
+    if (type > enum_class_core_max) {
+        PMC * const _class = Parrot_oo_get_class(interp, name_key);
+        if (!PMC_IS_NULL(_class)) {
+            PMC *initial = Parrot_pmc_new(interp,
+                Parrot_hll_get_ctx_HLL_type(interp, enum_class_Integer));
+            VTABLE_set_integer_native(interp, initial, IREG(3));
+            PREG(1) = VTABLE_instantiate(interp, _class, initial);
         }
     }
 
-return (opcode_t *)cur_opcode + 4;}
+    /* if it's a core PMC */
+    else if (type > enum_class_default)
+        PREG(1) = Parrot_pmc_new_init_int(interp, type, IREG(3));
 
-opcode_t *
-Parrot_stringinfo_i_s_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
-    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (SREG(2) == NULL)
-        IREG(1) = 0;
+    /* it's a typo */
     else {
-        switch (ICONST(3)) {
-          case STRINGINFO_HEADER:
-            IREG(1) = PTR2UINTVAL(SREG(2));
-            break;
-          case STRINGINFO_STRSTART:
-            IREG(1) = PTR2UINTVAL(SREG(2)->strstart);
-            break;
-          case STRINGINFO_BUFLEN:
-            IREG(1) = Buffer_buflen(SREG(2));
-            break;
-          case STRINGINFO_FLAGS:
-            IREG(1) = PObj_get_FLAGS(SREG(2));
-            break;
-          case STRINGINFO_BUFUSED:
-            IREG(1) = SREG(2)->bufused;
-            break;
-          case STRINGINFO_STRLEN:
-            IREG(1) = SREG(2)->strlen;
-            break;
-          default:
-            {
-                opcode_t *handler = Parrot_ex_throw_from_op_args(interp, NULL,
-                    EXCEPTION_INVALID_OPERATION,
-                    "stringinfo: unknown info type: %d", ICONST(3));return (opcode_t *)handler;
-            }
-        }
+        opcode_t *dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
+            EXCEPTION_NO_CLASS,
+            "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));return (opcode_t *)dest;
     }
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_stringinfo_i_sc_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_new_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (SCONST(2) == NULL)
-        IREG(1) = 0;
-    else {
-        switch (ICONST(3)) {
-          case STRINGINFO_HEADER:
-            IREG(1) = PTR2UINTVAL(SCONST(2));
-            break;
-          case STRINGINFO_STRSTART:
-            IREG(1) = PTR2UINTVAL(SCONST(2)->strstart);
-            break;
-          case STRINGINFO_BUFLEN:
-            IREG(1) = Buffer_buflen(SCONST(2));
-            break;
-          case STRINGINFO_FLAGS:
-            IREG(1) = PObj_get_FLAGS(SCONST(2));
-            break;
-          case STRINGINFO_BUFUSED:
-            IREG(1) = SCONST(2)->bufused;
-            break;
-          case STRINGINFO_STRLEN:
-            IREG(1) = SCONST(2)->strlen;
-            break;
-          default:
-            {
-                opcode_t *handler = Parrot_ex_throw_from_op_args(interp, NULL,
-                    EXCEPTION_INVALID_OPERATION,
-                    "stringinfo: unknown info type: %d", ICONST(3));return (opcode_t *)handler;
-            }
+    PMC * const  name_key = PREG(2);
+
+    /* get_class() returns a PMCProxy for core types, so check for core PMCs */
+    const INTVAL type = Parrot_pmc_get_type(interp, name_key);
+
+    /* if it's clearly a PIR-level PMC */
+    if (type > enum_class_core_max) {
+        PMC * const _class = Parrot_oo_get_class(interp, name_key);
+        if (!PMC_IS_NULL(_class)) {
+            PMC *initial = Parrot_pmc_new(interp,
+                Parrot_hll_get_ctx_HLL_type(interp, enum_class_Integer));
+            VTABLE_set_integer_native(interp, initial, ICONST(3));
+            PREG(1) = VTABLE_instantiate(interp, _class, initial);
         }
     }
 
+    /* if it's a core PMC */
+    else if (type > enum_class_default)
+        PREG(1) = Parrot_pmc_new_init_int(interp, type, ICONST(3));
+
+    /* it's a typo */
+    else {
+        opcode_t *dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
+            EXCEPTION_NO_CLASS,
+            "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));return (opcode_t *)dest;
+    }
+
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_upcase_s_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_new_p_pc_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    SREG(1) = Parrot_str_upcase(interp, SREG(2));
+    PMC * const  name_key = PCONST(2);
 
-return (opcode_t *)cur_opcode + 3;}
+    /* get_class() returns a PMCProxy for core types, so check for core PMCs */
+    const INTVAL type = Parrot_pmc_get_type(interp, name_key);
 
-opcode_t *
-Parrot_upcase_s_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
-    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    SREG(1) = Parrot_str_upcase(interp, SCONST(2));
+    /* if it's clearly a PIR-level PMC */
+    if (type > enum_class_core_max) {
+        PMC * const _class = Parrot_oo_get_class(interp, name_key);
+        if (!PMC_IS_NULL(_class)) {
+            PMC *initial = Parrot_pmc_new(interp,
+                Parrot_hll_get_ctx_HLL_type(interp, enum_class_Integer));
+            VTABLE_set_integer_native(interp, initial, ICONST(3));
+            PREG(1) = VTABLE_instantiate(interp, _class, initial);
+        }
+    }
 
-return (opcode_t *)cur_opcode + 3;}
+    /* if it's a core PMC */
+    else if (type > enum_class_default)
+        PREG(1) = Parrot_pmc_new_init_int(interp, type, ICONST(3));
 
-opcode_t *
-Parrot_downcase_s_s(opcode_t *cur_opcode, PARROT_INTERP)  {
-    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    SREG(1) = Parrot_str_downcase(interp, SREG(2));
+    /* it's a typo */
+    else {
+        opcode_t *dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
+            EXCEPTION_NO_CLASS,
+            "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));return (opcode_t *)dest;
+    }
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_downcase_s_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_root_new_p_p_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    SREG(1) = Parrot_str_downcase(interp, SCONST(2));
+    PMC * const  name_key = PREG(2);
 
-return (opcode_t *)cur_opcode + 3;}
+    /* get_class() returns a PMCProxy for core types, so check for core PMCs */
+    const INTVAL type = Parrot_pmc_get_type(interp, name_key);
 
-opcode_t *
-Parrot_titlecase_s_s(opcode_t *cur_opcode, PARROT_INTERP)  {
-    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    SREG(1) = Parrot_str_titlecase(interp, SREG(2));
+    /* if it's clearly a PIR-level PMC */
+    if (type > enum_class_core_max) {
+        PMC * const root_ns  = interp->root_namespace;
+        PMC * const ns       = Parrot_ns_get_namespace_keyed(interp, root_ns, name_key);
+        PMC * const _class   = Parrot_oo_get_class(interp, ns);
+        if (!PMC_IS_NULL(_class)) {
+            PMC *initial = Parrot_pmc_new(interp,
+                Parrot_hll_get_ctx_HLL_type(interp, enum_class_Integer));
+            VTABLE_set_integer_native(interp, initial, IREG(3));
+            PREG(1) = VTABLE_instantiate(interp, _class, initial);
+        }
+    }
 
-return (opcode_t *)cur_opcode + 3;}
+    /* if it's a core PMC */
+    else if (type > enum_class_default)
+        PREG(1) = Parrot_pmc_new_init_int(interp, type, IREG(3));
 
-opcode_t *
-Parrot_titlecase_s_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
-    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    SREG(1) = Parrot_str_titlecase(interp, SCONST(2));
+    /* it's a typo */
+    else {
+        opcode_t *dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
+            EXCEPTION_NO_CLASS,
+            "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));return (opcode_t *)dest;
+    }
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_join_s_s_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_root_new_p_pc_i(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    SREG(1) = Parrot_str_join(interp, SREG(2), PREG(3));
+    PMC * const  name_key = PCONST(2);
 
-return (opcode_t *)cur_opcode + 4;}
+    /* get_class() returns a PMCProxy for core types, so check for core PMCs */
+    const INTVAL type = Parrot_pmc_get_type(interp, name_key);
 
-opcode_t *
-Parrot_join_s_sc_p(opcode_t *cur_opcode, PARROT_INTERP)  {
-    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    SREG(1) = Parrot_str_join(interp, SCONST(2), PREG(3));
+    /* if it's clearly a PIR-level PMC */
+    if (type > enum_class_core_max) {
+        PMC * const root_ns  = interp->root_namespace;
+        PMC * const ns       = Parrot_ns_get_namespace_keyed(interp, root_ns, name_key);
+        PMC * const _class   = Parrot_oo_get_class(interp, ns);
+        if (!PMC_IS_NULL(_class)) {
+            PMC *initial = Parrot_pmc_new(interp,
+                Parrot_hll_get_ctx_HLL_type(interp, enum_class_Integer));
+            VTABLE_set_integer_native(interp, initial, IREG(3));
+            PREG(1) = VTABLE_instantiate(interp, _class, initial);
+        }
+    }
 
-return (opcode_t *)cur_opcode + 4;}
+    /* if it's a core PMC */
+    else if (type > enum_class_default)
+        PREG(1) = Parrot_pmc_new_init_int(interp, type, IREG(3));
 
-opcode_t *
-Parrot_split_p_s_s(opcode_t *cur_opcode, PARROT_INTERP)  {
-    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = Parrot_str_split(interp, SREG(2), SREG(3));
+    /* it's a typo */
+    else {
+        opcode_t *dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
+            EXCEPTION_NO_CLASS,
+            "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));return (opcode_t *)dest;
+    }
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_split_p_sc_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_root_new_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = Parrot_str_split(interp, SCONST(2), SREG(3));
+    PMC * const  name_key = PREG(2);
+
+    /* get_class() returns a PMCProxy for core types, so check for core PMCs */
+    const INTVAL type = Parrot_pmc_get_type(interp, name_key);
+
+    /* if it's clearly a PIR-level PMC */
+    if (type > enum_class_core_max) {
+        PMC * const root_ns  = interp->root_namespace;
+        PMC * const ns       = Parrot_ns_get_namespace_keyed(interp, root_ns, name_key);
+        PMC * const _class   = Parrot_oo_get_class(interp, ns);
+        if (!PMC_IS_NULL(_class)) {
+            PMC *initial = Parrot_pmc_new(interp,
+                Parrot_hll_get_ctx_HLL_type(interp, enum_class_Integer));
+            VTABLE_set_integer_native(interp, initial, ICONST(3));
+            PREG(1) = VTABLE_instantiate(interp, _class, initial);
+        }
+    }
+
+    /* if it's a core PMC */
+    else if (type > enum_class_default)
+        PREG(1) = Parrot_pmc_new_init_int(interp, type, ICONST(3));
+
+    /* it's a typo */
+    else {
+        opcode_t *dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
+            EXCEPTION_NO_CLASS,
+            "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));return (opcode_t *)dest;
+    }
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_split_p_s_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_root_new_p_pc_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = Parrot_str_split(interp, SREG(2), SCONST(3));
+    PMC * const  name_key = PCONST(2);
+
+    /* get_class() returns a PMCProxy for core types, so check for core PMCs */
+    const INTVAL type = Parrot_pmc_get_type(interp, name_key);
+
+    /* if it's clearly a PIR-level PMC */
+    if (type > enum_class_core_max) {
+        PMC * const root_ns  = interp->root_namespace;
+        PMC * const ns       = Parrot_ns_get_namespace_keyed(interp, root_ns, name_key);
+        PMC * const _class   = Parrot_oo_get_class(interp, ns);
+        if (!PMC_IS_NULL(_class)) {
+            PMC *initial = Parrot_pmc_new(interp,
+                Parrot_hll_get_ctx_HLL_type(interp, enum_class_Integer));
+            VTABLE_set_integer_native(interp, initial, ICONST(3));
+            PREG(1) = VTABLE_instantiate(interp, _class, initial);
+        }
+    }
+
+    /* if it's a core PMC */
+    else if (type > enum_class_default)
+        PREG(1) = Parrot_pmc_new_init_int(interp, type, ICONST(3));
+
+    /* it's a typo */
+    else {
+        opcode_t *dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
+            EXCEPTION_NO_CLASS,
+            "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));return (opcode_t *)dest;
+    }
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_split_p_sc_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_finalize_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = Parrot_str_split(interp, SCONST(2), SCONST(3));
+    /* Go to the next op after loop unrolling */
+    opcode_t * const dest = cur_opcode + 2;
+    PMC *eh = PMCNULL;
+    Parrot_warn_experimental(interp, "finalize is experimental");
+    if (!PMC_IS_NULL(PREG(1))) {
+        /* If isa ExceptionHandler, use it. If isa Exception, get its active handler */
+        if (VTABLE_isa(interp, PREG(1), Parrot_str_new_constant(interp, "ExceptionHandler")))
+            eh = PREG(1);
+        else if (VTABLE_isa(interp, PREG(1), Parrot_str_new_constant(interp, "Exception"))) {
+            PMC *iter = VTABLE_get_attr_str(interp,
+                                            PREG(1), Parrot_str_new_constant(interp, "handler_iter"));
+            if (!PMC_IS_NULL(iter))
+                eh = VTABLE_get_pmc_keyed_int(interp, iter, -1);
+        }
+    }
+    if (!PMC_IS_NULL(eh)) {
+        /* Get the runloop_id from the continuation and jump to it. */
+        Parrot_runloop *rl = interp->current_runloop;
+        INTVAL rid;
+        Parrot_pcc_invoke_method_from_c_args(interp,
+                                             eh, Parrot_str_new_constant(interp, "rid"),
+                                             "->I", &rid);
+        while (rl && rl->id != rid)
+            rl = rl->prev;
+        if (rl) {
+            if (rl != interp->current_runloop) {
+                rl->handler_start      = dest;
+                interp->gc_root_frames = rl->gc_root_frames;
+                longjmp(rl->resume, 3);
+            }
+        }
+        else
+            Parrot_ex_throw_from_c_args(interp, NULL,
+                    EXCEPTION_INVALID_OPERATION, "missing runloop");
+    }
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 2;}
 
 opcode_t *
-Parrot_encoding_i_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_finalize_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = Parrot_encoding_number_of_str(interp, SREG(2));
+    /* Go to the next op after loop unrolling */
+    opcode_t * const dest = cur_opcode + 2;
+    PMC *eh = PMCNULL;
+    Parrot_warn_experimental(interp, "finalize is experimental");
+    if (!PMC_IS_NULL(PCONST(1))) {
+        /* If isa ExceptionHandler, use it. If isa Exception, get its active handler */
+        if (VTABLE_isa(interp, PCONST(1), Parrot_str_new_constant(interp, "ExceptionHandler")))
+            eh = PCONST(1);
+        else if (VTABLE_isa(interp, PCONST(1), Parrot_str_new_constant(interp, "Exception"))) {
+            PMC *iter = VTABLE_get_attr_str(interp,
+                                            PCONST(1), Parrot_str_new_constant(interp, "handler_iter"));
+            if (!PMC_IS_NULL(iter))
+                eh = VTABLE_get_pmc_keyed_int(interp, iter, -1);
+        }
+    }
+    if (!PMC_IS_NULL(eh)) {
+        /* Get the runloop_id from the continuation and jump to it. */
+        Parrot_runloop *rl = interp->current_runloop;
+        INTVAL rid;
+        Parrot_pcc_invoke_method_from_c_args(interp,
+                                             eh, Parrot_str_new_constant(interp, "rid"),
+                                             "->I", &rid);
+        while (rl && rl->id != rid)
+            rl = rl->prev;
+        if (rl) {
+            if (rl != interp->current_runloop) {
+                rl->handler_start      = dest;
+                interp->gc_root_frames = rl->gc_root_frames;
+                longjmp(rl->resume, 3);
+            }
+        }
+        else
+            Parrot_ex_throw_from_c_args(interp, NULL,
+                    EXCEPTION_INVALID_OPERATION, "missing runloop");
+    }
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 2;}
 
 opcode_t *
-Parrot_encoding_i_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_le_i_ic_ic__mod_i_i_i__unless_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = Parrot_encoding_number_of_str(interp, SCONST(2));
+    if (IREG(1) <= ICONST(2)) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
 
-return (opcode_t *)cur_opcode + 3;}
+  }
+  cur_opcode += 4;
+  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = Parrot_util_intval_mod(IREG(2), IREG(3));
 
-opcode_t *
-Parrot_encodingname_s_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+  }
+  cur_opcode += 4;
+  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    SREG(1) = Parrot_encoding_name(interp, IREG(2));
+    if (IREG(1) == 0)return (opcode_t *)cur_opcode + ICONST(2);
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 3;
+  }
+}
 
 opcode_t *
-Parrot_encodingname_s_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_dec_i__branch_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    SREG(1) = Parrot_encoding_name(interp, ICONST(2));
+    IREG(1)--;
 
-return (opcode_t *)cur_opcode + 3;}
+  }
+  cur_opcode += 2;
+  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);return (opcode_t *)cur_opcode + ICONST(1);
+
+  }
+}
 
 opcode_t *
-Parrot_find_encoding_i_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_inc_i__eq_i_i_ic__branch_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    const INTVAL n = Parrot_encoding_number(interp, SREG(2));
-    if (n < 0) {
-        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, NULL,
-                EXCEPTION_INVALID_ENCODING,
-                "encoding '%Ss' not found", SREG(2));return (opcode_t *)handler;
-    }
-    IREG(1) = n;
-
-return (opcode_t *)cur_opcode + 3;}
+    IREG(1)++;
 
-opcode_t *
-Parrot_find_encoding_i_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+  }
+  cur_opcode += 2;
+  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    const INTVAL n = Parrot_encoding_number(interp, SCONST(2));
-    if (n < 0) {
-        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, NULL,
-                EXCEPTION_INVALID_ENCODING,
-                "encoding '%Ss' not found", SCONST(2));return (opcode_t *)handler;
+    if (IREG(1) == IREG(2)) {return (opcode_t *)cur_opcode + ICONST(3);
     }
-    IREG(1) = n;
-
-return (opcode_t *)cur_opcode + 3;}
 
-opcode_t *
-Parrot_trans_encoding_s_s_i(opcode_t *cur_opcode, PARROT_INTERP)  {
-    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    SREG(1) = Parrot_str_change_encoding(interp, SREG(2), IREG(3));
+  }
+  cur_opcode += 4;
+  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);return (opcode_t *)cur_opcode + ICONST(1);
 
-return (opcode_t *)cur_opcode + 4;}
+  }
+}
 
 opcode_t *
-Parrot_trans_encoding_s_sc_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_i_ic__lt_i_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    SREG(1) = Parrot_str_change_encoding(interp, SCONST(2), IREG(3));
-
-return (opcode_t *)cur_opcode + 4;}
+    IREG(1) = ICONST(2);
 
-opcode_t *
-Parrot_trans_encoding_s_s_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+  }
+  cur_opcode += 3;
+  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    SREG(1) = Parrot_str_change_encoding(interp, SREG(2), ICONST(3));
+    if (IREG(1) < IREG(2)) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 4;
+  }
+}
 
 opcode_t *
-Parrot_trans_encoding_s_sc_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_inc_i__lt_i_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    SREG(1) = Parrot_str_change_encoding(interp, SCONST(2), ICONST(3));
-
-return (opcode_t *)cur_opcode + 4;}
+    IREG(1)++;
 
-opcode_t *
-Parrot_is_cclass_i_i_s_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+  }
+  cur_opcode += 2;
+  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = Parrot_str_is_cclass(interp, IREG(2), SREG(3), IREG(4));
+    if (IREG(1) < IREG(2)) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
 
-return (opcode_t *)cur_opcode + 5;}
+return (opcode_t *)cur_opcode + 4;
+  }
+}
 
 opcode_t *
-Parrot_is_cclass_i_ic_s_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_inc_i__branch_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = Parrot_str_is_cclass(interp, ICONST(2), SREG(3), IREG(4));
-
-return (opcode_t *)cur_opcode + 5;}
+    IREG(1)++;
 
-opcode_t *
-Parrot_is_cclass_i_i_sc_i(opcode_t *cur_opcode, PARROT_INTERP)  {
-    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = Parrot_str_is_cclass(interp, IREG(2), SCONST(3), IREG(4));
+  }
+  cur_opcode += 2;
+  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);return (opcode_t *)cur_opcode + ICONST(1);
 
-return (opcode_t *)cur_opcode + 5;}
+  }
+}
 
 opcode_t *
-Parrot_is_cclass_i_ic_sc_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_inc_i__I0(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = Parrot_str_is_cclass(interp, ICONST(2), SCONST(3), IREG(4));
+    IREG_AT(0)++;
 
-return (opcode_t *)cur_opcode + 5;}
+return (opcode_t *)cur_opcode + 2;}
 
 opcode_t *
-Parrot_is_cclass_i_i_s_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_inc_i__I1(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = Parrot_str_is_cclass(interp, IREG(2), SREG(3), ICONST(4));
+    IREG_AT(1)++;
 
-return (opcode_t *)cur_opcode + 5;}
+return (opcode_t *)cur_opcode + 2;}
 
 opcode_t *
-Parrot_is_cclass_i_ic_s_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_inc_i__I2(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = Parrot_str_is_cclass(interp, ICONST(2), SREG(3), ICONST(4));
+    IREG_AT(2)++;
 
-return (opcode_t *)cur_opcode + 5;}
+return (opcode_t *)cur_opcode + 2;}
 
 opcode_t *
-Parrot_is_cclass_i_i_sc_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_inc_i__I3(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = Parrot_str_is_cclass(interp, IREG(2), SCONST(3), ICONST(4));
+    IREG_AT(3)++;
 
-return (opcode_t *)cur_opcode + 5;}
+return (opcode_t *)cur_opcode + 2;}
 
 opcode_t *
-Parrot_is_cclass_i_ic_sc_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_inc_i__I4(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = Parrot_str_is_cclass(interp, ICONST(2), SCONST(3), ICONST(4));
+    IREG_AT(4)++;
 
-return (opcode_t *)cur_opcode + 5;}
+return (opcode_t *)cur_opcode + 2;}
 
 opcode_t *
-Parrot_find_cclass_i_i_s_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_inc_i__I5(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = Parrot_str_find_cclass(interp, IREG(2), SREG(3), IREG(4), IREG(5));
+    IREG_AT(5)++;
 
-return (opcode_t *)cur_opcode + 6;}
+return (opcode_t *)cur_opcode + 2;}
 
 opcode_t *
-Parrot_find_cclass_i_ic_s_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_inc_i__I6(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = Parrot_str_find_cclass(interp, ICONST(2), SREG(3), IREG(4), IREG(5));
+    IREG_AT(6)++;
 
-return (opcode_t *)cur_opcode + 6;}
+return (opcode_t *)cur_opcode + 2;}
 
 opcode_t *
-Parrot_find_cclass_i_i_sc_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_inc_i__I7(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = Parrot_str_find_cclass(interp, IREG(2), SCONST(3), IREG(4), IREG(5));
+    IREG_AT(7)++;
 
-return (opcode_t *)cur_opcode + 6;}
+return (opcode_t *)cur_opcode + 2;}
 
 opcode_t *
-Parrot_find_cclass_i_ic_sc_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_dec_i__I0(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = Parrot_str_find_cclass(interp, ICONST(2), SCONST(3), IREG(4), IREG(5));
+    IREG_AT(0)--;
 
-return (opcode_t *)cur_opcode + 6;}
+return (opcode_t *)cur_opcode + 2;}
 
 opcode_t *
-Parrot_find_cclass_i_i_s_ic_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_dec_i__I1(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = Parrot_str_find_cclass(interp, IREG(2), SREG(3), ICONST(4), IREG(5));
+    IREG_AT(1)--;
 
-return (opcode_t *)cur_opcode + 6;}
+return (opcode_t *)cur_opcode + 2;}
 
 opcode_t *
-Parrot_find_cclass_i_ic_s_ic_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_dec_i__I2(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = Parrot_str_find_cclass(interp, ICONST(2), SREG(3), ICONST(4), IREG(5));
+    IREG_AT(2)--;
 
-return (opcode_t *)cur_opcode + 6;}
+return (opcode_t *)cur_opcode + 2;}
 
 opcode_t *
-Parrot_find_cclass_i_i_sc_ic_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_dec_i__I3(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = Parrot_str_find_cclass(interp, IREG(2), SCONST(3), ICONST(4), IREG(5));
+    IREG_AT(3)--;
 
-return (opcode_t *)cur_opcode + 6;}
+return (opcode_t *)cur_opcode + 2;}
 
 opcode_t *
-Parrot_find_cclass_i_ic_sc_ic_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_dec_i__I4(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = Parrot_str_find_cclass(interp, ICONST(2), SCONST(3), ICONST(4), IREG(5));
+    IREG_AT(4)--;
 
-return (opcode_t *)cur_opcode + 6;}
+return (opcode_t *)cur_opcode + 2;}
 
 opcode_t *
-Parrot_find_cclass_i_i_s_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_dec_i__I5(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = Parrot_str_find_cclass(interp, IREG(2), SREG(3), IREG(4), ICONST(5));
+    IREG_AT(5)--;
 
-return (opcode_t *)cur_opcode + 6;}
+return (opcode_t *)cur_opcode + 2;}
 
 opcode_t *
-Parrot_find_cclass_i_ic_s_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_dec_i__I6(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = Parrot_str_find_cclass(interp, ICONST(2), SREG(3), IREG(4), ICONST(5));
+    IREG_AT(6)--;
 
-return (opcode_t *)cur_opcode + 6;}
+return (opcode_t *)cur_opcode + 2;}
 
 opcode_t *
-Parrot_find_cclass_i_i_sc_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_dec_i__I7(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = Parrot_str_find_cclass(interp, IREG(2), SCONST(3), IREG(4), ICONST(5));
+    IREG_AT(7)--;
 
-return (opcode_t *)cur_opcode + 6;}
+return (opcode_t *)cur_opcode + 2;}
 
 opcode_t *
-Parrot_find_cclass_i_ic_sc_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_i_ic__I0(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = Parrot_str_find_cclass(interp, ICONST(2), SCONST(3), IREG(4), ICONST(5));
+    IREG_AT(0) = ICONST(2);
 
-return (opcode_t *)cur_opcode + 6;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_find_cclass_i_i_s_ic_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_i_ic__I1(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = Parrot_str_find_cclass(interp, IREG(2), SREG(3), ICONST(4), ICONST(5));
+    IREG_AT(1) = ICONST(2);
 
-return (opcode_t *)cur_opcode + 6;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_find_cclass_i_ic_s_ic_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_i_ic__I2(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = Parrot_str_find_cclass(interp, ICONST(2), SREG(3), ICONST(4), ICONST(5));
+    IREG_AT(2) = ICONST(2);
 
-return (opcode_t *)cur_opcode + 6;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_find_cclass_i_i_sc_ic_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_i_ic__I3(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = Parrot_str_find_cclass(interp, IREG(2), SCONST(3), ICONST(4), ICONST(5));
+    IREG_AT(3) = ICONST(2);
 
-return (opcode_t *)cur_opcode + 6;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_find_cclass_i_ic_sc_ic_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_i_ic__I4(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = Parrot_str_find_cclass(interp, ICONST(2), SCONST(3), ICONST(4), ICONST(5));
+    IREG_AT(4) = ICONST(2);
 
-return (opcode_t *)cur_opcode + 6;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_find_not_cclass_i_i_s_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_i_ic__I5(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = Parrot_str_find_not_cclass(interp, IREG(2), SREG(3), IREG(4), IREG(5));
+    IREG_AT(5) = ICONST(2);
 
-return (opcode_t *)cur_opcode + 6;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_find_not_cclass_i_ic_s_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_i_ic__I6(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = Parrot_str_find_not_cclass(interp, ICONST(2), SREG(3), IREG(4), IREG(5));
+    IREG_AT(6) = ICONST(2);
 
-return (opcode_t *)cur_opcode + 6;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_find_not_cclass_i_i_sc_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_i_ic__I7(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = Parrot_str_find_not_cclass(interp, IREG(2), SCONST(3), IREG(4), IREG(5));
+    IREG_AT(7) = ICONST(2);
 
-return (opcode_t *)cur_opcode + 6;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_find_not_cclass_i_ic_sc_i_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_lt_i_i_ic__I0_I0(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = Parrot_str_find_not_cclass(interp, ICONST(2), SCONST(3), IREG(4), IREG(5));
+    if (IREG_AT(0) < IREG_AT(0)) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
 
-return (opcode_t *)cur_opcode + 6;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_find_not_cclass_i_i_s_ic_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_lt_i_i_ic__I0_I1(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = Parrot_str_find_not_cclass(interp, IREG(2), SREG(3), ICONST(4), IREG(5));
+    if (IREG_AT(0) < IREG_AT(1)) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
 
-return (opcode_t *)cur_opcode + 6;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_find_not_cclass_i_ic_s_ic_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_lt_i_i_ic__I0_I2(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = Parrot_str_find_not_cclass(interp, ICONST(2), SREG(3), ICONST(4), IREG(5));
+    if (IREG_AT(0) < IREG_AT(2)) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
 
-return (opcode_t *)cur_opcode + 6;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_find_not_cclass_i_i_sc_ic_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_lt_i_i_ic__I0_I3(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = Parrot_str_find_not_cclass(interp, IREG(2), SCONST(3), ICONST(4), IREG(5));
+    if (IREG_AT(0) < IREG_AT(3)) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
 
-return (opcode_t *)cur_opcode + 6;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_find_not_cclass_i_ic_sc_ic_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_lt_i_i_ic__I0_I4(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = Parrot_str_find_not_cclass(interp, ICONST(2), SCONST(3), ICONST(4), IREG(5));
+    if (IREG_AT(0) < IREG_AT(4)) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
 
-return (opcode_t *)cur_opcode + 6;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_find_not_cclass_i_i_s_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_lt_i_i_ic__I0_I5(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = Parrot_str_find_not_cclass(interp, IREG(2), SREG(3), IREG(4), ICONST(5));
+    if (IREG_AT(0) < IREG_AT(5)) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
 
-return (opcode_t *)cur_opcode + 6;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_find_not_cclass_i_ic_s_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_lt_i_i_ic__I0_I6(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = Parrot_str_find_not_cclass(interp, ICONST(2), SREG(3), IREG(4), ICONST(5));
+    if (IREG_AT(0) < IREG_AT(6)) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
 
-return (opcode_t *)cur_opcode + 6;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_find_not_cclass_i_i_sc_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_lt_i_i_ic__I0_I7(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = Parrot_str_find_not_cclass(interp, IREG(2), SCONST(3), IREG(4), ICONST(5));
+    if (IREG_AT(0) < IREG_AT(7)) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
 
-return (opcode_t *)cur_opcode + 6;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_find_not_cclass_i_ic_sc_i_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_lt_i_i_ic__I1_I0(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = Parrot_str_find_not_cclass(interp, ICONST(2), SCONST(3), IREG(4), ICONST(5));
+    if (IREG_AT(1) < IREG_AT(0)) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
 
-return (opcode_t *)cur_opcode + 6;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_find_not_cclass_i_i_s_ic_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_lt_i_i_ic__I1_I1(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = Parrot_str_find_not_cclass(interp, IREG(2), SREG(3), ICONST(4), ICONST(5));
+    if (IREG_AT(1) < IREG_AT(1)) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
 
-return (opcode_t *)cur_opcode + 6;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_find_not_cclass_i_ic_s_ic_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_lt_i_i_ic__I1_I2(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = Parrot_str_find_not_cclass(interp, ICONST(2), SREG(3), ICONST(4), ICONST(5));
+    if (IREG_AT(1) < IREG_AT(2)) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
 
-return (opcode_t *)cur_opcode + 6;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_find_not_cclass_i_i_sc_ic_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_lt_i_i_ic__I1_I3(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = Parrot_str_find_not_cclass(interp, IREG(2), SCONST(3), ICONST(4), ICONST(5));
+    if (IREG_AT(1) < IREG_AT(3)) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
 
-return (opcode_t *)cur_opcode + 6;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_find_not_cclass_i_ic_sc_ic_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_lt_i_i_ic__I1_I4(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = Parrot_str_find_not_cclass(interp, ICONST(2), SCONST(3), ICONST(4), ICONST(5));
+    if (IREG_AT(1) < IREG_AT(4)) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
 
-return (opcode_t *)cur_opcode + 6;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_escape_s_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_lt_i_i_ic__I1_I5(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    SREG(1) = Parrot_str_escape(interp, SREG(2));
+    if (IREG_AT(1) < IREG_AT(5)) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_compose_s_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_lt_i_i_ic__I1_I6(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    SREG(1) = Parrot_str_compose(interp, SREG(2));
+    if (IREG_AT(1) < IREG_AT(6)) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_compose_s_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_lt_i_i_ic__I1_I7(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    SREG(1) = Parrot_str_compose(interp, SCONST(2));
+    if (IREG_AT(1) < IREG_AT(7)) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_find_codepoint_i_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_lt_i_i_ic__I2_I0(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-#if PARROT_HAS_ICU
-    UErrorCode   err       = U_ZERO_ERROR;
-    char * const cstr      = Parrot_str_to_cstring(interp, SREG(2));
-    UChar32      codepoint = u_charFromName(U_EXTENDED_CHAR_NAME, cstr, &err);
-    Parrot_str_free_cstring(cstr);
-    IREG(1) = U_SUCCESS(err) ? (INTVAL) codepoint : -1;
-#else
-    opcode_t * const dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 3,
-        EXCEPTION_LIBRARY_ERROR, "no ICU lib loaded");return (opcode_t *)dest;
-#endif
+    if (IREG_AT(2) < IREG_AT(0)) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_find_codepoint_i_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_lt_i_i_ic__I2_I1(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-#if PARROT_HAS_ICU
-    UErrorCode   err       = U_ZERO_ERROR;
-    char * const cstr      = Parrot_str_to_cstring(interp, SCONST(2));
-    UChar32      codepoint = u_charFromName(U_EXTENDED_CHAR_NAME, cstr, &err);
-    Parrot_str_free_cstring(cstr);
-    IREG(1) = U_SUCCESS(err) ? (INTVAL) codepoint : -1;
-#else
-    opcode_t * const dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 3,
-        EXCEPTION_LIBRARY_ERROR, "no ICU lib loaded");return (opcode_t *)dest;
-#endif
+    if (IREG_AT(2) < IREG_AT(1)) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_spawnw_i_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_lt_i_i_ic__I2_I2(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = Parrot_Run_OS_Command(interp, SREG(2));
+    if (IREG_AT(2) < IREG_AT(2)) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_spawnw_i_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_lt_i_i_ic__I2_I3(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = Parrot_Run_OS_Command(interp, SCONST(2));
+    if (IREG_AT(2) < IREG_AT(3)) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_spawnw_i_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_lt_i_i_ic__I2_I4(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = Parrot_Run_OS_Command_Argv(interp, PREG(2));
+    if (IREG_AT(2) < IREG_AT(4)) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_err_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_lt_i_i_ic__I2_I5(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = errno;
+    if (IREG_AT(2) < IREG_AT(5)) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
 
-return (opcode_t *)cur_opcode + 2;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_err_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_lt_i_i_ic__I2_I6(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    const char * const tmp = strerror(errno);
-    SREG(1) = Parrot_str_new_init(interp, tmp, strlen(tmp),
-            Parrot_ascii_encoding_ptr, 0);
+    if (IREG_AT(2) < IREG_AT(6)) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
 
-return (opcode_t *)cur_opcode + 2;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_err_s_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_lt_i_i_ic__I2_I7(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    const char * const tmp = strerror(IREG(2));
-    SREG(1) = Parrot_str_new_init(interp, tmp, strlen(tmp),
-            Parrot_ascii_encoding_ptr, 0);
+    if (IREG_AT(2) < IREG_AT(7)) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_err_s_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_lt_i_i_ic__I3_I0(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    const char * const tmp = strerror(ICONST(2));
-    SREG(1) = Parrot_str_new_init(interp, tmp, strlen(tmp),
-            Parrot_ascii_encoding_ptr, 0);
+    if (IREG_AT(3) < IREG_AT(0)) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_time_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_lt_i_i_ic__I3_I1(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    IREG(1) = Parrot_intval_time();
+    if (IREG_AT(3) < IREG_AT(1)) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
 
-return (opcode_t *)cur_opcode + 2;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_time_n(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_lt_i_i_ic__I3_I2(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    NREG(1) = Parrot_floatval_time();
+    if (IREG_AT(3) < IREG_AT(2)) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
 
-return (opcode_t *)cur_opcode + 2;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_sleep_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_lt_i_i_ic__I3_I3(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    opcode_t *next = cur_opcode + 2;
-    if (IREG(1) < 0) {
-        opcode_t * const handler = Parrot_ex_throw_from_op_args(interp, next,
-            EXCEPTION_NEG_SLEEP,
-            "Cannot go back in time");return (opcode_t *)handler;
+    if (IREG_AT(3) < IREG_AT(3)) {return (opcode_t *)cur_opcode + ICONST(3);
     }
-    next = (opcode_t *)Parrot_cx_schedule_sleep(interp, (FLOATVAL) IREG(1), next);return (opcode_t *)next;
-}
+
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_sleep_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_lt_i_i_ic__I3_I4(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    opcode_t *next = cur_opcode + 2;
-    if (ICONST(1) < 0) {
-        opcode_t * const handler = Parrot_ex_throw_from_op_args(interp, next,
-            EXCEPTION_NEG_SLEEP,
-            "Cannot go back in time");return (opcode_t *)handler;
+    if (IREG_AT(3) < IREG_AT(4)) {return (opcode_t *)cur_opcode + ICONST(3);
     }
-    next = (opcode_t *)Parrot_cx_schedule_sleep(interp, (FLOATVAL) ICONST(1), next);return (opcode_t *)next;
-}
+
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_sleep_n(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_lt_i_i_ic__I3_I5(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    opcode_t *next = cur_opcode + 2;
-    if (NREG(1) < 0.0) {
-        opcode_t * const handler = Parrot_ex_throw_from_op_args(interp, next,
-            EXCEPTION_NEG_SLEEP,
-            "Cannot go back in time");return (opcode_t *)handler;
+    if (IREG_AT(3) < IREG_AT(5)) {return (opcode_t *)cur_opcode + ICONST(3);
     }
-    next = (opcode_t *)Parrot_cx_schedule_sleep(interp, NREG(1), next);return (opcode_t *)next;
-}
+
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_sleep_nc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_lt_i_i_ic__I3_I6(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    opcode_t *next = cur_opcode + 2;
-    if (NCONST(1) < 0.0) {
-        opcode_t * const handler = Parrot_ex_throw_from_op_args(interp, next,
-            EXCEPTION_NEG_SLEEP,
-            "Cannot go back in time");return (opcode_t *)handler;
+    if (IREG_AT(3) < IREG_AT(6)) {return (opcode_t *)cur_opcode + ICONST(3);
     }
-    next = (opcode_t *)Parrot_cx_schedule_sleep(interp, NCONST(1), next);return (opcode_t *)next;
-}
+
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_store_lex_s_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_lt_i_i_ic__I3_I7(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC     * const ctx      = CURRENT_CONTEXT(interp);
-    STRING  * const lex_name = SREG(1);
-    PMC     * const lex_pad  = Parrot_sub_find_pad(interp, lex_name, ctx);
-
-    if (PMC_IS_NULL(lex_pad)) {
-        opcode_t * const handler = Parrot_ex_throw_from_op_args(interp, NULL,
-                EXCEPTION_LEX_NOT_FOUND,
-                "Lexical '%Ss' not found", lex_name);return (opcode_t *)handler;
+    if (IREG_AT(3) < IREG_AT(7)) {return (opcode_t *)cur_opcode + ICONST(3);
     }
-    VTABLE_set_pmc_keyed_str(interp, lex_pad, lex_name, PREG(2));
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_store_lex_sc_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_lt_i_i_ic__I4_I0(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC     * const ctx      = CURRENT_CONTEXT(interp);
-    STRING  * const lex_name = SCONST(1);
-    PMC     * const lex_pad  = Parrot_sub_find_pad(interp, lex_name, ctx);
-
-    if (PMC_IS_NULL(lex_pad)) {
-        opcode_t * const handler = Parrot_ex_throw_from_op_args(interp, NULL,
-                EXCEPTION_LEX_NOT_FOUND,
-                "Lexical '%Ss' not found", lex_name);return (opcode_t *)handler;
+    if (IREG_AT(4) < IREG_AT(0)) {return (opcode_t *)cur_opcode + ICONST(3);
     }
-    VTABLE_set_pmc_keyed_str(interp, lex_pad, lex_name, PREG(2));
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_store_dynamic_lex_s_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_lt_i_i_ic__I4_I1(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    STRING  * const lex_name = SREG(1);
-    PMC     * const ctx      =
-        Parrot_pcc_get_caller_ctx(interp, CURRENT_CONTEXT(interp));
-    PMC     * const lex_pad  =
-        PMC_IS_NULL(ctx)
-            ? PMCNULL
-            : Parrot_sub_find_dynamic_pad(interp, lex_name, ctx);
-
-    if (PMC_IS_NULL(lex_pad)) {
-        opcode_t * const handler = Parrot_ex_throw_from_op_args(interp, NULL,
-                EXCEPTION_LEX_NOT_FOUND,
-                "Lexical '%Ss' not found in dynamic scope", lex_name);return (opcode_t *)handler;
+    if (IREG_AT(4) < IREG_AT(1)) {return (opcode_t *)cur_opcode + ICONST(3);
     }
-    VTABLE_set_pmc_keyed_str(interp, lex_pad, lex_name, PREG(2));
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_store_dynamic_lex_sc_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_lt_i_i_ic__I4_I2(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    STRING  * const lex_name = SCONST(1);
-    PMC     * const ctx      =
-        Parrot_pcc_get_caller_ctx(interp, CURRENT_CONTEXT(interp));
-    PMC     * const lex_pad  =
-        PMC_IS_NULL(ctx)
-            ? PMCNULL
-            : Parrot_sub_find_dynamic_pad(interp, lex_name, ctx);
-
-    if (PMC_IS_NULL(lex_pad)) {
-        opcode_t * const handler = Parrot_ex_throw_from_op_args(interp, NULL,
-                EXCEPTION_LEX_NOT_FOUND,
-                "Lexical '%Ss' not found in dynamic scope", lex_name);return (opcode_t *)handler;
+    if (IREG_AT(4) < IREG_AT(2)) {return (opcode_t *)cur_opcode + ICONST(3);
     }
-    VTABLE_set_pmc_keyed_str(interp, lex_pad, lex_name, PREG(2));
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_find_lex_p_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_lt_i_i_ic__I4_I3(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC     * const ctx      = CURRENT_CONTEXT(interp);
-    STRING  * const lex_name = SREG(2);
-    PMC     * const lex_pad  = Parrot_sub_find_pad(interp, lex_name, ctx);
-
-    PMC * const result =
-        PMC_IS_NULL(lex_pad)
-            ? PMCNULL
-            : VTABLE_get_pmc_keyed_str(interp, lex_pad, lex_name);
-    PREG(1) = result;
+    if (IREG_AT(4) < IREG_AT(3)) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_find_lex_p_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_lt_i_i_ic__I4_I4(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC     * const ctx      = CURRENT_CONTEXT(interp);
-    STRING  * const lex_name = SCONST(2);
-    PMC     * const lex_pad  = Parrot_sub_find_pad(interp, lex_name, ctx);
-
-    PMC * const result =
-        PMC_IS_NULL(lex_pad)
-            ? PMCNULL
-            : VTABLE_get_pmc_keyed_str(interp, lex_pad, lex_name);
-    PREG(1) = result;
+    if (IREG_AT(4) < IREG_AT(4)) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_find_dynamic_lex_p_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_lt_i_i_ic__I4_I5(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    STRING  * const lex_name = SREG(2);
-    PMC     * const ctx      =
-        Parrot_pcc_get_caller_ctx(interp, CURRENT_CONTEXT(interp));
-    PMC     * const lex_pad  =
-        PMC_IS_NULL(ctx)
-            ? PMCNULL
-            : Parrot_sub_find_dynamic_pad(interp, lex_name, ctx);
-    PMC     * const result =
-        PMC_IS_NULL(lex_pad)
-            ? PMCNULL
-            : VTABLE_get_pmc_keyed_str(interp, lex_pad, lex_name);
-    PREG(1) = result;
+    if (IREG_AT(4) < IREG_AT(5)) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_find_dynamic_lex_p_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_lt_i_i_ic__I4_I6(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    STRING  * const lex_name = SCONST(2);
-    PMC     * const ctx      =
-        Parrot_pcc_get_caller_ctx(interp, CURRENT_CONTEXT(interp));
-    PMC     * const lex_pad  =
-        PMC_IS_NULL(ctx)
-            ? PMCNULL
-            : Parrot_sub_find_dynamic_pad(interp, lex_name, ctx);
-    PMC     * const result =
-        PMC_IS_NULL(lex_pad)
-            ? PMCNULL
-            : VTABLE_get_pmc_keyed_str(interp, lex_pad, lex_name);
-    PREG(1) = result;
+    if (IREG_AT(4) < IREG_AT(6)) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_find_caller_lex_p_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_lt_i_i_ic__I4_I7(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    STRING  * const lex_name = SREG(2);
-    PMC     * ctx            = CURRENT_CONTEXT(interp);
-    PMC     * result         = PMCNULL;
+    if (IREG_AT(4) < IREG_AT(7)) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
 
-    for (ctx = Parrot_pcc_get_caller_ctx(interp, ctx);
-            !PMC_IS_NULL(ctx) && PMC_IS_NULL(result);
-            ctx = Parrot_pcc_get_caller_ctx(interp, ctx))
-    {
-        PMC * const lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
-        if (!PMC_IS_NULL(lex_pad)) {
-            result = VTABLE_get_pmc_keyed_str(interp, lex_pad, lex_name);
-        }
-        if (!result) result = PMCNULL;
+return (opcode_t *)cur_opcode + 4;}
+
+opcode_t *
+Parrot_lt_i_i_ic__I5_I0(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (IREG_AT(5) < IREG_AT(0)) {return (opcode_t *)cur_opcode + ICONST(3);
     }
-    PREG(1) = result;
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_find_caller_lex_p_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_lt_i_i_ic__I5_I1(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    STRING  * const lex_name = SCONST(2);
-    PMC     * ctx            = CURRENT_CONTEXT(interp);
-    PMC     * result         = PMCNULL;
-
-    for (ctx = Parrot_pcc_get_caller_ctx(interp, ctx);
-            !PMC_IS_NULL(ctx) && PMC_IS_NULL(result);
-            ctx = Parrot_pcc_get_caller_ctx(interp, ctx))
-    {
-        PMC * const lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
-        if (!PMC_IS_NULL(lex_pad)) {
-            result = VTABLE_get_pmc_keyed_str(interp, lex_pad, lex_name);
-        }
-        if (!result) result = PMCNULL;
+    if (IREG_AT(5) < IREG_AT(1)) {return (opcode_t *)cur_opcode + ICONST(3);
     }
-    PREG(1) = result;
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_get_namespace_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_lt_i_i_ic__I5_I2(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
-    PREG(1) = cur_ns;
+    if (IREG_AT(5) < IREG_AT(2)) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
 
-return (opcode_t *)cur_opcode + 2;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_get_namespace_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_lt_i_i_ic__I5_I3(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
-    PMC * const ns     = Parrot_ns_get_namespace_keyed(interp, cur_ns, PREG(2));
-
-    PREG(1) = PMC_IS_NULL(ns) ? PMCNULL : ns;
+    if (IREG_AT(5) < IREG_AT(3)) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_get_namespace_p_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_lt_i_i_ic__I5_I4(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
-    PMC * const ns     = Parrot_ns_get_namespace_keyed(interp, cur_ns, PCONST(2));
-
-    PREG(1) = PMC_IS_NULL(ns) ? PMCNULL : ns;
+    if (IREG_AT(5) < IREG_AT(4)) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_get_hll_namespace_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_lt_i_i_ic__I5_I5(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
-    PREG(1) = hll_ns;
+    if (IREG_AT(5) < IREG_AT(5)) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
 
-return (opcode_t *)cur_opcode + 2;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_get_hll_namespace_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_lt_i_i_ic__I5_I6(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
-    if (PMC_IS_NULL(hll_ns))
-        PREG(1) = PMCNULL;
-    else {
-        PMC * const ns = Parrot_ns_get_namespace_keyed(interp, hll_ns, PREG(2));
-        PREG(1) = ns;
+    if (IREG_AT(5) < IREG_AT(6)) {return (opcode_t *)cur_opcode + ICONST(3);
     }
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_get_hll_namespace_p_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_lt_i_i_ic__I5_I7(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
-    if (PMC_IS_NULL(hll_ns))
-        PREG(1) = PMCNULL;
-    else {
-        PMC * const ns = Parrot_ns_get_namespace_keyed(interp, hll_ns, PCONST(2));
-        PREG(1) = ns;
+    if (IREG_AT(5) < IREG_AT(7)) {return (opcode_t *)cur_opcode + ICONST(3);
     }
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_get_root_namespace_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_lt_i_i_ic__I6_I0(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const root_ns = interp->root_namespace;
-    PREG(1) = root_ns;
+    if (IREG_AT(6) < IREG_AT(0)) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
 
-return (opcode_t *)cur_opcode + 2;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_get_root_namespace_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_lt_i_i_ic__I6_I1(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const root_ns = interp->root_namespace;
-    if (PMC_IS_NULL(root_ns))
-        PREG(1) = PMCNULL;
-    else {
-        PMC * const ns = Parrot_ns_get_namespace_keyed(interp, root_ns, PREG(2));
-        PREG(1) = ns;
+    if (IREG_AT(6) < IREG_AT(1)) {return (opcode_t *)cur_opcode + ICONST(3);
     }
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_get_root_namespace_p_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_lt_i_i_ic__I6_I2(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const root_ns = interp->root_namespace;
-    if (PMC_IS_NULL(root_ns))
-        PREG(1) = PMCNULL;
-    else {
-        PMC * const ns = Parrot_ns_get_namespace_keyed(interp, root_ns, PCONST(2));
-        PREG(1) = ns;
+    if (IREG_AT(6) < IREG_AT(2)) {return (opcode_t *)cur_opcode + ICONST(3);
     }
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_get_global_p_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_lt_i_i_ic__I6_I3(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
-    PREG(1) = Parrot_ns_find_global_from_op(interp, cur_ns, SREG(2), cur_opcode + 3);
+    if (IREG_AT(6) < IREG_AT(3)) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_get_global_p_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_lt_i_i_ic__I6_I4(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
-    PREG(1) = Parrot_ns_find_global_from_op(interp, cur_ns, SCONST(2), cur_opcode + 3);
+    if (IREG_AT(6) < IREG_AT(4)) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_get_global_p_p_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_lt_i_i_ic__I6_I5(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
-    if (PMC_IS_NULL(cur_ns)) {
-        PREG(1) = PMCNULL;
-    }
-    else {
-        PMC * const ns = Parrot_ns_get_namespace_keyed(interp, cur_ns, PREG(2));
-        if (PMC_IS_NULL(ns))
-            PREG(1) = PMCNULL;
-        else
-            PREG(1) = Parrot_ns_find_global_from_op(interp, ns, SREG(3), cur_opcode + 4);
+    if (IREG_AT(6) < IREG_AT(5)) {return (opcode_t *)cur_opcode + ICONST(3);
     }
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_get_global_p_pc_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_lt_i_i_ic__I6_I6(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
-    if (PMC_IS_NULL(cur_ns)) {
-        PREG(1) = PMCNULL;
-    }
-    else {
-        PMC * const ns = Parrot_ns_get_namespace_keyed(interp, cur_ns, PCONST(2));
-        if (PMC_IS_NULL(ns))
-            PREG(1) = PMCNULL;
-        else
-            PREG(1) = Parrot_ns_find_global_from_op(interp, ns, SREG(3), cur_opcode + 4);
+    if (IREG_AT(6) < IREG_AT(6)) {return (opcode_t *)cur_opcode + ICONST(3);
     }
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_get_global_p_p_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_lt_i_i_ic__I6_I7(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
-    if (PMC_IS_NULL(cur_ns)) {
-        PREG(1) = PMCNULL;
-    }
-    else {
-        PMC * const ns = Parrot_ns_get_namespace_keyed(interp, cur_ns, PREG(2));
-        if (PMC_IS_NULL(ns))
-            PREG(1) = PMCNULL;
-        else
-            PREG(1) = Parrot_ns_find_global_from_op(interp, ns, SCONST(3), cur_opcode + 4);
+    if (IREG_AT(6) < IREG_AT(7)) {return (opcode_t *)cur_opcode + ICONST(3);
     }
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_get_global_p_pc_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_lt_i_i_ic__I7_I0(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
-    if (PMC_IS_NULL(cur_ns)) {
-        PREG(1) = PMCNULL;
-    }
-    else {
-        PMC * const ns = Parrot_ns_get_namespace_keyed(interp, cur_ns, PCONST(2));
-        if (PMC_IS_NULL(ns))
-            PREG(1) = PMCNULL;
-        else
-            PREG(1) = Parrot_ns_find_global_from_op(interp, ns, SCONST(3), cur_opcode + 4);
+    if (IREG_AT(7) < IREG_AT(0)) {return (opcode_t *)cur_opcode + ICONST(3);
     }
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_get_hll_global_p_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_lt_i_i_ic__I7_I1(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
-    PREG(1) = Parrot_ns_find_global_from_op(interp, hll_ns, SREG(2), cur_opcode + 3);
+    if (IREG_AT(7) < IREG_AT(1)) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_get_hll_global_p_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_lt_i_i_ic__I7_I2(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
-    PREG(1) = Parrot_ns_find_global_from_op(interp, hll_ns, SCONST(2), cur_opcode + 3);
+    if (IREG_AT(7) < IREG_AT(2)) {return (opcode_t *)cur_opcode + ICONST(3);
+    }
 
-return (opcode_t *)cur_opcode + 3;}
+return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_get_hll_global_p_p_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_lt_i_i_ic__I7_I3(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
-    if (PMC_IS_NULL(hll_ns)) {
-        PREG(1) = hll_ns;
-    }
-    else {
-        PMC * const ns = Parrot_ns_get_namespace_keyed(interp, hll_ns, PREG(2));
-        if (PMC_IS_NULL(ns))
-            PREG(1) = PMCNULL;
-        else
-            PREG(1) = Parrot_ns_find_global_from_op(interp, ns, SREG(3), cur_opcode + 4);
+    if (IREG_AT(7) < IREG_AT(3)) {return (opcode_t *)cur_opcode + ICONST(3);
     }
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_get_hll_global_p_pc_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_lt_i_i_ic__I7_I4(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
-    if (PMC_IS_NULL(hll_ns)) {
-        PREG(1) = hll_ns;
-    }
-    else {
-        PMC * const ns = Parrot_ns_get_namespace_keyed(interp, hll_ns, PCONST(2));
-        if (PMC_IS_NULL(ns))
-            PREG(1) = PMCNULL;
-        else
-            PREG(1) = Parrot_ns_find_global_from_op(interp, ns, SREG(3), cur_opcode + 4);
+    if (IREG_AT(7) < IREG_AT(4)) {return (opcode_t *)cur_opcode + ICONST(3);
     }
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_get_hll_global_p_p_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_lt_i_i_ic__I7_I5(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
-    if (PMC_IS_NULL(hll_ns)) {
-        PREG(1) = hll_ns;
-    }
-    else {
-        PMC * const ns = Parrot_ns_get_namespace_keyed(interp, hll_ns, PREG(2));
-        if (PMC_IS_NULL(ns))
-            PREG(1) = PMCNULL;
-        else
-            PREG(1) = Parrot_ns_find_global_from_op(interp, ns, SCONST(3), cur_opcode + 4);
+    if (IREG_AT(7) < IREG_AT(5)) {return (opcode_t *)cur_opcode + ICONST(3);
     }
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_get_hll_global_p_pc_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_lt_i_i_ic__I7_I6(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
-    if (PMC_IS_NULL(hll_ns)) {
-        PREG(1) = hll_ns;
+    if (IREG_AT(7) < IREG_AT(6)) {return (opcode_t *)cur_opcode + ICONST(3);
     }
-    else {
-        PMC * const ns = Parrot_ns_get_namespace_keyed(interp, hll_ns, PCONST(2));
-        if (PMC_IS_NULL(ns))
-            PREG(1) = PMCNULL;
-        else
-            PREG(1) = Parrot_ns_find_global_from_op(interp, ns, SCONST(3), cur_opcode + 4);
+
+return (opcode_t *)cur_opcode + 4;}
+
+opcode_t *
+Parrot_lt_i_i_ic__I7_I7(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (IREG_AT(7) < IREG_AT(7)) {return (opcode_t *)cur_opcode + ICONST(3);
     }
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
-Parrot_get_root_global_p_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_i_i__I0_I0(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG_AT(0) += IREG_AT(0);
+
+return (opcode_t *)cur_opcode + 3;}
+
+opcode_t *
+Parrot_add_i_i__I0_I1(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG_AT(0) += IREG_AT(1);
+
+return (opcode_t *)cur_opcode + 3;}
+
+opcode_t *
+Parrot_add_i_i__I0_I2(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG_AT(0) += IREG_AT(2);
+
+return (opcode_t *)cur_opcode + 3;}
+
+opcode_t *
+Parrot_add_i_i__I0_I3(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG_AT(0) += IREG_AT(3);
+
+return (opcode_t *)cur_opcode + 3;}
+
+opcode_t *
+Parrot_add_i_i__I0_I4(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG_AT(0) += IREG_AT(4);
+
+return (opcode_t *)cur_opcode + 3;}
+
+opcode_t *
+Parrot_add_i_i__I0_I5(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG_AT(0) += IREG_AT(5);
+
+return (opcode_t *)cur_opcode + 3;}
+
+opcode_t *
+Parrot_add_i_i__I0_I6(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG_AT(0) += IREG_AT(6);
+
+return (opcode_t *)cur_opcode + 3;}
+
+opcode_t *
+Parrot_add_i_i__I0_I7(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG_AT(0) += IREG_AT(7);
+
+return (opcode_t *)cur_opcode + 3;}
+
+opcode_t *
+Parrot_add_i_i__I1_I0(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG_AT(1) += IREG_AT(0);
+
+return (opcode_t *)cur_opcode + 3;}
+
+opcode_t *
+Parrot_add_i_i__I1_I1(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG_AT(1) += IREG_AT(1);
+
+return (opcode_t *)cur_opcode + 3;}
+
+opcode_t *
+Parrot_add_i_i__I1_I2(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const root_ns = interp->root_namespace;
-    PREG(1) = Parrot_ns_find_global_from_op(interp, root_ns, SREG(2), cur_opcode + 3);
+    IREG_AT(1) += IREG_AT(2);
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_get_root_global_p_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_i_i__I1_I3(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const root_ns = interp->root_namespace;
-    PREG(1) = Parrot_ns_find_global_from_op(interp, root_ns, SCONST(2), cur_opcode + 3);
+    IREG_AT(1) += IREG_AT(3);
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_get_root_global_p_p_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_i_i__I1_I4(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const root_ns = interp->root_namespace;
-    if (PMC_IS_NULL(root_ns))
-        PREG(1) = PMCNULL;
-    else {
-        PMC * const ns = Parrot_ns_get_namespace_keyed(interp, root_ns, PREG(2));
-        if (PMC_IS_NULL(ns))
-            PREG(1) = PMCNULL;
-        else
-            PREG(1) = Parrot_ns_find_global_from_op(interp, ns, SREG(3), cur_opcode + 4);
-    }
+    IREG_AT(1) += IREG_AT(4);
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_get_root_global_p_pc_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_i_i__I1_I5(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const root_ns = interp->root_namespace;
-    if (PMC_IS_NULL(root_ns))
-        PREG(1) = PMCNULL;
-    else {
-        PMC * const ns = Parrot_ns_get_namespace_keyed(interp, root_ns, PCONST(2));
-        if (PMC_IS_NULL(ns))
-            PREG(1) = PMCNULL;
-        else
-            PREG(1) = Parrot_ns_find_global_from_op(interp, ns, SREG(3), cur_opcode + 4);
-    }
+    IREG_AT(1) += IREG_AT(5);
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_get_root_global_p_p_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_i_i__I1_I6(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const root_ns = interp->root_namespace;
-    if (PMC_IS_NULL(root_ns))
-        PREG(1) = PMCNULL;
-    else {
-        PMC * const ns = Parrot_ns_get_namespace_keyed(interp, root_ns, PREG(2));
-        if (PMC_IS_NULL(ns))
-            PREG(1) = PMCNULL;
-        else
-            PREG(1) = Parrot_ns_find_global_from_op(interp, ns, SCONST(3), cur_opcode + 4);
-    }
+    IREG_AT(1) += IREG_AT(6);
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_get_root_global_p_pc_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_i_i__I1_I7(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const root_ns = interp->root_namespace;
-    if (PMC_IS_NULL(root_ns))
-        PREG(1) = PMCNULL;
-    else {
-        PMC * const ns = Parrot_ns_get_namespace_keyed(interp, root_ns, PCONST(2));
-        if (PMC_IS_NULL(ns))
-            PREG(1) = PMCNULL;
-        else
-            PREG(1) = Parrot_ns_find_global_from_op(interp, ns, SCONST(3), cur_opcode + 4);
-    }
+    IREG_AT(1) += IREG_AT(7);
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_set_global_s_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_i_i__I2_I0(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
-    Parrot_ns_set_global(interp, cur_ns, SREG(1), PREG(2));
+    IREG_AT(2) += IREG_AT(0);
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_set_global_sc_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_i_i__I2_I1(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
-    Parrot_ns_set_global(interp, cur_ns, SCONST(1), PREG(2));
+    IREG_AT(2) += IREG_AT(1);
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_set_global_p_s_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_i_i__I2_I2(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
-    PMC * const ns     = Parrot_ns_make_namespace_keyed(interp, cur_ns, PREG(1));
+    IREG_AT(2) += IREG_AT(2);
 
-    Parrot_ns_set_global(interp, ns, SREG(2), PREG(3));
-
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_set_global_pc_s_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_i_i__I2_I3(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
-    PMC * const ns     = Parrot_ns_make_namespace_keyed(interp, cur_ns, PCONST(1));
-
-    Parrot_ns_set_global(interp, ns, SREG(2), PREG(3));
+    IREG_AT(2) += IREG_AT(3);
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_set_global_p_sc_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_i_i__I2_I4(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
-    PMC * const ns     = Parrot_ns_make_namespace_keyed(interp, cur_ns, PREG(1));
-
-    Parrot_ns_set_global(interp, ns, SCONST(2), PREG(3));
+    IREG_AT(2) += IREG_AT(4);
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_set_global_pc_sc_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_i_i__I2_I5(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
-    PMC * const ns     = Parrot_ns_make_namespace_keyed(interp, cur_ns, PCONST(1));
-
-    Parrot_ns_set_global(interp, ns, SCONST(2), PREG(3));
+    IREG_AT(2) += IREG_AT(5);
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_set_hll_global_s_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_i_i__I2_I6(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
-    Parrot_ns_set_global(interp, hll_ns, SREG(1), PREG(2));
+    IREG_AT(2) += IREG_AT(6);
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_set_hll_global_sc_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_i_i__I2_I7(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
-    Parrot_ns_set_global(interp, hll_ns, SCONST(1), PREG(2));
+    IREG_AT(2) += IREG_AT(7);
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_set_hll_global_p_s_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_i_i__I3_I0(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
-    PMC * const ns     = Parrot_ns_make_namespace_keyed(interp, hll_ns, PREG(1));
-
-    Parrot_ns_set_global(interp, ns, SREG(2), PREG(3));
+    IREG_AT(3) += IREG_AT(0);
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_set_hll_global_pc_s_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_i_i__I3_I1(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
-    PMC * const ns     = Parrot_ns_make_namespace_keyed(interp, hll_ns, PCONST(1));
-
-    Parrot_ns_set_global(interp, ns, SREG(2), PREG(3));
+    IREG_AT(3) += IREG_AT(1);
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_set_hll_global_p_sc_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_i_i__I3_I2(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
-    PMC * const ns     = Parrot_ns_make_namespace_keyed(interp, hll_ns, PREG(1));
+    IREG_AT(3) += IREG_AT(2);
 
-    Parrot_ns_set_global(interp, ns, SCONST(2), PREG(3));
-
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_set_hll_global_pc_sc_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_i_i__I3_I3(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
-    PMC * const ns     = Parrot_ns_make_namespace_keyed(interp, hll_ns, PCONST(1));
-
-    Parrot_ns_set_global(interp, ns, SCONST(2), PREG(3));
+    IREG_AT(3) += IREG_AT(3);
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_set_root_global_s_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_i_i__I3_I4(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const root_ns = interp->root_namespace;
-    Parrot_ns_set_global(interp, root_ns, SREG(1), PREG(2));
+    IREG_AT(3) += IREG_AT(4);
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_set_root_global_sc_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_i_i__I3_I5(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const root_ns = interp->root_namespace;
-    Parrot_ns_set_global(interp, root_ns, SCONST(1), PREG(2));
+    IREG_AT(3) += IREG_AT(5);
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_set_root_global_p_s_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_i_i__I3_I6(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const root_ns = interp->root_namespace;
-    PMC * const ns      = Parrot_ns_make_namespace_keyed(interp, root_ns, PREG(1));
+    IREG_AT(3) += IREG_AT(6);
 
-    Parrot_ns_set_global(interp, ns, SREG(2), PREG(3));
-
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_set_root_global_pc_s_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_i_i__I3_I7(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const root_ns = interp->root_namespace;
-    PMC * const ns      = Parrot_ns_make_namespace_keyed(interp, root_ns, PCONST(1));
-
-    Parrot_ns_set_global(interp, ns, SREG(2), PREG(3));
+    IREG_AT(3) += IREG_AT(7);
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_set_root_global_p_sc_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_i_i__I4_I0(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const root_ns = interp->root_namespace;
-    PMC * const ns      = Parrot_ns_make_namespace_keyed(interp, root_ns, PREG(1));
-
-    Parrot_ns_set_global(interp, ns, SCONST(2), PREG(3));
+    IREG_AT(4) += IREG_AT(0);
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_set_root_global_pc_sc_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_i_i__I4_I1(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const root_ns = interp->root_namespace;
-    PMC * const ns      = Parrot_ns_make_namespace_keyed(interp, root_ns, PCONST(1));
-
-    Parrot_ns_set_global(interp, ns, SCONST(2), PREG(3));
+    IREG_AT(4) += IREG_AT(1);
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_find_name_p_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_i_i__I4_I2(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (!SREG(2)) {
-        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, NULL,
-                EXCEPTION_INVALID_OPERATION,
-                "Tried to find null name");return (opcode_t *)handler;
-    }
-
-    PREG(1) = Parrot_ns_find_named_item(interp, SREG(2), cur_opcode + 3);
+    IREG_AT(4) += IREG_AT(2);
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_find_name_p_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_i_i__I4_I3(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    if (!SCONST(2)) {
-        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, NULL,
-                EXCEPTION_INVALID_OPERATION,
-                "Tried to find null name");return (opcode_t *)handler;
-    }
-
-    PREG(1) = Parrot_ns_find_named_item(interp, SCONST(2), cur_opcode + 3);
+    IREG_AT(4) += IREG_AT(3);
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_find_sub_not_null_p_s(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_i_i__I4_I4(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    opcode_t *dest = cur_opcode + 3;
-    PMC *sub = Parrot_ns_find_named_item(interp, SREG(2), dest);
+    IREG_AT(4) += IREG_AT(4);
 
-    if (PMC_IS_NULL(sub)) {
-        opcode_t *handler;
-        Parrot_pcc_set_pc_func(interp, CURRENT_CONTEXT(interp), dest);
-        handler = Parrot_ex_throw_from_op_args(interp, dest,
-                       EXCEPTION_GLOBAL_NOT_FOUND,
-                       "Could not find sub %Ss", SREG(2));return (opcode_t *)handler;
-    }
+return (opcode_t *)cur_opcode + 3;}
 
-    PREG(1) = sub;
+opcode_t *
+Parrot_add_i_i__I4_I5(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG_AT(4) += IREG_AT(5);
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_find_sub_not_null_p_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_i_i__I4_I6(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    opcode_t *dest = cur_opcode + 3;
-    PMC *sub = Parrot_ns_find_named_item(interp, SCONST(2), dest);
+    IREG_AT(4) += IREG_AT(6);
 
-    if (PMC_IS_NULL(sub)) {
-        opcode_t *handler;
-        Parrot_pcc_set_pc_func(interp, CURRENT_CONTEXT(interp), dest);
-        handler = Parrot_ex_throw_from_op_args(interp, dest,
-                       EXCEPTION_GLOBAL_NOT_FOUND,
-                       "Could not find sub %Ss", SCONST(2));return (opcode_t *)handler;
-    }
+return (opcode_t *)cur_opcode + 3;}
 
-    PREG(1) = sub;
+opcode_t *
+Parrot_add_i_i__I4_I7(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG_AT(4) += IREG_AT(7);
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_trap(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_i_i__I5_I0(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-#if defined(__GNUC__) && defined(i386)
-    __asm__("int3");       /* opcode 0xcc */
-#endif
-#if defined(__GNUC__) && defined(PPC)
-    __asm__("trap");       /* opcode tr 31, 0, 0 */
-#endif
+    IREG_AT(5) += IREG_AT(0);
 
-return (opcode_t *)cur_opcode + 1;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_set_label_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_i_i__I5_I1(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_set_pointer(interp, PREG(1), (CUR_OPCODE + ICONST(2)));
+    IREG_AT(5) += IREG_AT(1);
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_get_label_i_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_i_i__I5_I2(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    void * const ptr = VTABLE_get_pointer(interp, PREG(2));
-    IREG(1) =  PTR2INTVAL(ptr);
+    IREG_AT(5) += IREG_AT(2);
 
 return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_fetch_p_p_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_i_i__I5_I3(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_get_pmc_keyed(interp, PREG(2), PREG(3));
-    if (PMC_IS_NULL(PREG(1))) {
-        PMC * const classobj = Parrot_oo_get_class(interp, PREG(4));
-        if (!PMC_IS_NULL(classobj))
-            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
-        else {
-            const INTVAL type = Parrot_pmc_get_type(interp, PREG(4));
-            if (type <= 0) {
-                opcode_t *dest = Parrot_ex_throw_from_op_args(
-                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
-                    "Class '%Ss' not found", VTABLE_get_repr(interp, PREG(4)));return (opcode_t *)dest;
-            }
+    IREG_AT(5) += IREG_AT(3);
 
-            PREG(1) = Parrot_pmc_new(interp, type);
-        }
-    }
-
-return (opcode_t *)cur_opcode + 5;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_fetch_p_pc_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_i_i__I5_I4(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_get_pmc_keyed(interp, PCONST(2), PREG(3));
-    if (PMC_IS_NULL(PREG(1))) {
-        PMC * const classobj = Parrot_oo_get_class(interp, PREG(4));
-        if (!PMC_IS_NULL(classobj))
-            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
-        else {
-            const INTVAL type = Parrot_pmc_get_type(interp, PREG(4));
-            if (type <= 0) {
-                opcode_t *dest = Parrot_ex_throw_from_op_args(
-                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
-                    "Class '%Ss' not found", VTABLE_get_repr(interp, PREG(4)));return (opcode_t *)dest;
-            }
-
-            PREG(1) = Parrot_pmc_new(interp, type);
-        }
-    }
+    IREG_AT(5) += IREG_AT(4);
 
-return (opcode_t *)cur_opcode + 5;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_fetch_p_p_pc_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_i_i__I5_I5(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_get_pmc_keyed(interp, PREG(2), PCONST(3));
-    if (PMC_IS_NULL(PREG(1))) {
-        PMC * const classobj = Parrot_oo_get_class(interp, PREG(4));
-        if (!PMC_IS_NULL(classobj))
-            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
-        else {
-            const INTVAL type = Parrot_pmc_get_type(interp, PREG(4));
-            if (type <= 0) {
-                opcode_t *dest = Parrot_ex_throw_from_op_args(
-                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
-                    "Class '%Ss' not found", VTABLE_get_repr(interp, PREG(4)));return (opcode_t *)dest;
-            }
-
-            PREG(1) = Parrot_pmc_new(interp, type);
-        }
-    }
+    IREG_AT(5) += IREG_AT(5);
 
-return (opcode_t *)cur_opcode + 5;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_fetch_p_pc_pc_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_i_i__I5_I6(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_get_pmc_keyed(interp, PCONST(2), PCONST(3));
-    if (PMC_IS_NULL(PREG(1))) {
-        PMC * const classobj = Parrot_oo_get_class(interp, PREG(4));
-        if (!PMC_IS_NULL(classobj))
-            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
-        else {
-            const INTVAL type = Parrot_pmc_get_type(interp, PREG(4));
-            if (type <= 0) {
-                opcode_t *dest = Parrot_ex_throw_from_op_args(
-                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
-                    "Class '%Ss' not found", VTABLE_get_repr(interp, PREG(4)));return (opcode_t *)dest;
-            }
+    IREG_AT(5) += IREG_AT(6);
 
-            PREG(1) = Parrot_pmc_new(interp, type);
-        }
-    }
+return (opcode_t *)cur_opcode + 3;}
 
-return (opcode_t *)cur_opcode + 5;}
+opcode_t *
+Parrot_add_i_i__I5_I7(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG_AT(5) += IREG_AT(7);
+
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_fetch_p_p_p_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_i_i__I6_I0(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_get_pmc_keyed(interp, PREG(2), PREG(3));
-    if (PMC_IS_NULL(PREG(1))) {
-        PMC * const classobj = Parrot_oo_get_class(interp, PCONST(4));
-        if (!PMC_IS_NULL(classobj))
-            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
-        else {
-            const INTVAL type = Parrot_pmc_get_type(interp, PCONST(4));
-            if (type <= 0) {
-                opcode_t *dest = Parrot_ex_throw_from_op_args(
-                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
-                    "Class '%Ss' not found", VTABLE_get_repr(interp, PCONST(4)));return (opcode_t *)dest;
-            }
+    IREG_AT(6) += IREG_AT(0);
 
-            PREG(1) = Parrot_pmc_new(interp, type);
-        }
-    }
+return (opcode_t *)cur_opcode + 3;}
 
-return (opcode_t *)cur_opcode + 5;}
+opcode_t *
+Parrot_add_i_i__I6_I1(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG_AT(6) += IREG_AT(1);
+
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_fetch_p_pc_p_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_i_i__I6_I2(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_get_pmc_keyed(interp, PCONST(2), PREG(3));
-    if (PMC_IS_NULL(PREG(1))) {
-        PMC * const classobj = Parrot_oo_get_class(interp, PCONST(4));
-        if (!PMC_IS_NULL(classobj))
-            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
-        else {
-            const INTVAL type = Parrot_pmc_get_type(interp, PCONST(4));
-            if (type <= 0) {
-                opcode_t *dest = Parrot_ex_throw_from_op_args(
-                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
-                    "Class '%Ss' not found", VTABLE_get_repr(interp, PCONST(4)));return (opcode_t *)dest;
-            }
+    IREG_AT(6) += IREG_AT(2);
 
-            PREG(1) = Parrot_pmc_new(interp, type);
-        }
-    }
+return (opcode_t *)cur_opcode + 3;}
 
-return (opcode_t *)cur_opcode + 5;}
+opcode_t *
+Parrot_add_i_i__I6_I3(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG_AT(6) += IREG_AT(3);
+
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_fetch_p_p_pc_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_i_i__I6_I4(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_get_pmc_keyed(interp, PREG(2), PCONST(3));
-    if (PMC_IS_NULL(PREG(1))) {
-        PMC * const classobj = Parrot_oo_get_class(interp, PCONST(4));
-        if (!PMC_IS_NULL(classobj))
-            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
-        else {
-            const INTVAL type = Parrot_pmc_get_type(interp, PCONST(4));
-            if (type <= 0) {
-                opcode_t *dest = Parrot_ex_throw_from_op_args(
-                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
-                    "Class '%Ss' not found", VTABLE_get_repr(interp, PCONST(4)));return (opcode_t *)dest;
-            }
+    IREG_AT(6) += IREG_AT(4);
 
-            PREG(1) = Parrot_pmc_new(interp, type);
-        }
-    }
+return (opcode_t *)cur_opcode + 3;}
 
-return (opcode_t *)cur_opcode + 5;}
+opcode_t *
+Parrot_add_i_i__I6_I5(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG_AT(6) += IREG_AT(5);
+
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_fetch_p_pc_pc_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_i_i__I6_I6(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_get_pmc_keyed(interp, PCONST(2), PCONST(3));
-    if (PMC_IS_NULL(PREG(1))) {
-        PMC * const classobj = Parrot_oo_get_class(interp, PCONST(4));
-        if (!PMC_IS_NULL(classobj))
-            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
-        else {
-            const INTVAL type = Parrot_pmc_get_type(interp, PCONST(4));
-            if (type <= 0) {
-                opcode_t *dest = Parrot_ex_throw_from_op_args(
-                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
-                    "Class '%Ss' not found", VTABLE_get_repr(interp, PCONST(4)));return (opcode_t *)dest;
-            }
+    IREG_AT(6) += IREG_AT(6);
 
-            PREG(1) = Parrot_pmc_new(interp, type);
-        }
-    }
+return (opcode_t *)cur_opcode + 3;}
 
-return (opcode_t *)cur_opcode + 5;}
+opcode_t *
+Parrot_add_i_i__I6_I7(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG_AT(6) += IREG_AT(7);
+
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_fetch_p_p_i_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_i_i__I7_I0(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PREG(2), IREG(3));
-    if (PMC_IS_NULL(PREG(1))) {
-        PMC * const classobj = Parrot_oo_get_class(interp, PREG(4));
-        if (!PMC_IS_NULL(classobj))
-            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
-        else {
-            const INTVAL type = Parrot_pmc_get_type(interp, PREG(4));
-            if (type <= 0) {
-                opcode_t *dest = Parrot_ex_throw_from_op_args(
-                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
-                    "Class '%Ss' not found", VTABLE_get_repr(interp, PREG(4)));return (opcode_t *)dest;
-            }
+    IREG_AT(7) += IREG_AT(0);
 
-            PREG(1) = Parrot_pmc_new(interp, type);
-        }
-    }
+return (opcode_t *)cur_opcode + 3;}
 
-return (opcode_t *)cur_opcode + 5;}
+opcode_t *
+Parrot_add_i_i__I7_I1(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG_AT(7) += IREG_AT(1);
+
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_fetch_p_pc_i_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_i_i__I7_I2(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PCONST(2), IREG(3));
-    if (PMC_IS_NULL(PREG(1))) {
-        PMC * const classobj = Parrot_oo_get_class(interp, PREG(4));
-        if (!PMC_IS_NULL(classobj))
-            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
-        else {
-            const INTVAL type = Parrot_pmc_get_type(interp, PREG(4));
-            if (type <= 0) {
-                opcode_t *dest = Parrot_ex_throw_from_op_args(
-                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
-                    "Class '%Ss' not found", VTABLE_get_repr(interp, PREG(4)));return (opcode_t *)dest;
-            }
+    IREG_AT(7) += IREG_AT(2);
 
-            PREG(1) = Parrot_pmc_new(interp, type);
-        }
-    }
+return (opcode_t *)cur_opcode + 3;}
 
-return (opcode_t *)cur_opcode + 5;}
+opcode_t *
+Parrot_add_i_i__I7_I3(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG_AT(7) += IREG_AT(3);
+
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_fetch_p_p_ic_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_i_i__I7_I4(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PREG(2), ICONST(3));
-    if (PMC_IS_NULL(PREG(1))) {
-        PMC * const classobj = Parrot_oo_get_class(interp, PREG(4));
-        if (!PMC_IS_NULL(classobj))
-            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
-        else {
-            const INTVAL type = Parrot_pmc_get_type(interp, PREG(4));
-            if (type <= 0) {
-                opcode_t *dest = Parrot_ex_throw_from_op_args(
-                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
-                    "Class '%Ss' not found", VTABLE_get_repr(interp, PREG(4)));return (opcode_t *)dest;
-            }
+    IREG_AT(7) += IREG_AT(4);
 
-            PREG(1) = Parrot_pmc_new(interp, type);
-        }
-    }
+return (opcode_t *)cur_opcode + 3;}
 
-return (opcode_t *)cur_opcode + 5;}
+opcode_t *
+Parrot_add_i_i__I7_I5(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG_AT(7) += IREG_AT(5);
+
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_fetch_p_pc_ic_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_i_i__I7_I6(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PCONST(2), ICONST(3));
-    if (PMC_IS_NULL(PREG(1))) {
-        PMC * const classobj = Parrot_oo_get_class(interp, PREG(4));
-        if (!PMC_IS_NULL(classobj))
-            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
-        else {
-            const INTVAL type = Parrot_pmc_get_type(interp, PREG(4));
-            if (type <= 0) {
-                opcode_t *dest = Parrot_ex_throw_from_op_args(
-                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
-                    "Class '%Ss' not found", VTABLE_get_repr(interp, PREG(4)));return (opcode_t *)dest;
-            }
+    IREG_AT(7) += IREG_AT(6);
 
-            PREG(1) = Parrot_pmc_new(interp, type);
-        }
-    }
+return (opcode_t *)cur_opcode + 3;}
 
-return (opcode_t *)cur_opcode + 5;}
+opcode_t *
+Parrot_add_i_i__I7_I7(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG_AT(7) += IREG_AT(7);
+
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_fetch_p_p_i_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_i_i__I0_I0(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PREG(2), IREG(3));
-    if (PMC_IS_NULL(PREG(1))) {
-        PMC * const classobj = Parrot_oo_get_class(interp, PCONST(4));
-        if (!PMC_IS_NULL(classobj))
-            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
-        else {
-            const INTVAL type = Parrot_pmc_get_type(interp, PCONST(4));
-            if (type <= 0) {
-                opcode_t *dest = Parrot_ex_throw_from_op_args(
-                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
-                    "Class '%Ss' not found", VTABLE_get_repr(interp, PCONST(4)));return (opcode_t *)dest;
-            }
+    IREG_AT(0) = IREG_AT(0);
 
-            PREG(1) = Parrot_pmc_new(interp, type);
-        }
-    }
+return (opcode_t *)cur_opcode + 3;}
 
-return (opcode_t *)cur_opcode + 5;}
+opcode_t *
+Parrot_set_i_i__I0_I1(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG_AT(0) = IREG_AT(1);
+
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_fetch_p_pc_i_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_i_i__I0_I2(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PCONST(2), IREG(3));
-    if (PMC_IS_NULL(PREG(1))) {
-        PMC * const classobj = Parrot_oo_get_class(interp, PCONST(4));
-        if (!PMC_IS_NULL(classobj))
-            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
-        else {
-            const INTVAL type = Parrot_pmc_get_type(interp, PCONST(4));
-            if (type <= 0) {
-                opcode_t *dest = Parrot_ex_throw_from_op_args(
-                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
-                    "Class '%Ss' not found", VTABLE_get_repr(interp, PCONST(4)));return (opcode_t *)dest;
-            }
+    IREG_AT(0) = IREG_AT(2);
+
+return (opcode_t *)cur_opcode + 3;}
+
+opcode_t *
+Parrot_set_i_i__I0_I3(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG_AT(0) = IREG_AT(3);
 
-            PREG(1) = Parrot_pmc_new(interp, type);
-        }
-    }
+return (opcode_t *)cur_opcode + 3;}
 
-return (opcode_t *)cur_opcode + 5;}
+opcode_t *
+Parrot_set_i_i__I0_I4(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG_AT(0) = IREG_AT(4);
+
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_fetch_p_p_ic_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_i_i__I0_I5(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PREG(2), ICONST(3));
-    if (PMC_IS_NULL(PREG(1))) {
-        PMC * const classobj = Parrot_oo_get_class(interp, PCONST(4));
-        if (!PMC_IS_NULL(classobj))
-            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
-        else {
-            const INTVAL type = Parrot_pmc_get_type(interp, PCONST(4));
-            if (type <= 0) {
-                opcode_t *dest = Parrot_ex_throw_from_op_args(
-                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
-                    "Class '%Ss' not found", VTABLE_get_repr(interp, PCONST(4)));return (opcode_t *)dest;
-            }
+    IREG_AT(0) = IREG_AT(5);
 
-            PREG(1) = Parrot_pmc_new(interp, type);
-        }
-    }
+return (opcode_t *)cur_opcode + 3;}
 
-return (opcode_t *)cur_opcode + 5;}
+opcode_t *
+Parrot_set_i_i__I0_I6(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG_AT(0) = IREG_AT(6);
+
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_fetch_p_pc_ic_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_i_i__I0_I7(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PCONST(2), ICONST(3));
-    if (PMC_IS_NULL(PREG(1))) {
-        PMC * const classobj = Parrot_oo_get_class(interp, PCONST(4));
-        if (!PMC_IS_NULL(classobj))
-            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
-        else {
-            const INTVAL type = Parrot_pmc_get_type(interp, PCONST(4));
-            if (type <= 0) {
-                opcode_t *dest = Parrot_ex_throw_from_op_args(
-                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
-                    "Class '%Ss' not found", VTABLE_get_repr(interp, PCONST(4)));return (opcode_t *)dest;
-            }
+    IREG_AT(0) = IREG_AT(7);
 
-            PREG(1) = Parrot_pmc_new(interp, type);
-        }
-    }
+return (opcode_t *)cur_opcode + 3;}
 
-return (opcode_t *)cur_opcode + 5;}
+opcode_t *
+Parrot_set_i_i__I1_I0(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG_AT(1) = IREG_AT(0);
+
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_fetch_p_p_s_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_i_i__I1_I1(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PREG(2), SREG(3));
-    if (PMC_IS_NULL(PREG(1))) {
-        PMC * const classobj = Parrot_oo_get_class(interp, PREG(4));
-        if (!PMC_IS_NULL(classobj))
-            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
-        else {
-            const INTVAL type = Parrot_pmc_get_type(interp, PREG(4));
-            if (type <= 0) {
-                opcode_t *dest = Parrot_ex_throw_from_op_args(
-                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
-                    "Class '%Ss' not found", VTABLE_get_repr(interp, PREG(4)));return (opcode_t *)dest;
-            }
+    IREG_AT(1) = IREG_AT(1);
 
-            PREG(1) = Parrot_pmc_new(interp, type);
-        }
-    }
+return (opcode_t *)cur_opcode + 3;}
 
-return (opcode_t *)cur_opcode + 5;}
+opcode_t *
+Parrot_set_i_i__I1_I2(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG_AT(1) = IREG_AT(2);
+
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_fetch_p_pc_s_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_i_i__I1_I3(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PCONST(2), SREG(3));
-    if (PMC_IS_NULL(PREG(1))) {
-        PMC * const classobj = Parrot_oo_get_class(interp, PREG(4));
-        if (!PMC_IS_NULL(classobj))
-            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
-        else {
-            const INTVAL type = Parrot_pmc_get_type(interp, PREG(4));
-            if (type <= 0) {
-                opcode_t *dest = Parrot_ex_throw_from_op_args(
-                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
-                    "Class '%Ss' not found", VTABLE_get_repr(interp, PREG(4)));return (opcode_t *)dest;
-            }
+    IREG_AT(1) = IREG_AT(3);
 
-            PREG(1) = Parrot_pmc_new(interp, type);
-        }
-    }
+return (opcode_t *)cur_opcode + 3;}
 
-return (opcode_t *)cur_opcode + 5;}
+opcode_t *
+Parrot_set_i_i__I1_I4(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG_AT(1) = IREG_AT(4);
+
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_fetch_p_p_sc_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_i_i__I1_I5(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PREG(2), SCONST(3));
-    if (PMC_IS_NULL(PREG(1))) {
-        PMC * const classobj = Parrot_oo_get_class(interp, PREG(4));
-        if (!PMC_IS_NULL(classobj))
-            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
-        else {
-            const INTVAL type = Parrot_pmc_get_type(interp, PREG(4));
-            if (type <= 0) {
-                opcode_t *dest = Parrot_ex_throw_from_op_args(
-                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
-                    "Class '%Ss' not found", VTABLE_get_repr(interp, PREG(4)));return (opcode_t *)dest;
-            }
+    IREG_AT(1) = IREG_AT(5);
 
-            PREG(1) = Parrot_pmc_new(interp, type);
-        }
-    }
+return (opcode_t *)cur_opcode + 3;}
 
-return (opcode_t *)cur_opcode + 5;}
+opcode_t *
+Parrot_set_i_i__I1_I6(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG_AT(1) = IREG_AT(6);
+
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_fetch_p_pc_sc_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_i_i__I1_I7(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PCONST(2), SCONST(3));
-    if (PMC_IS_NULL(PREG(1))) {
-        PMC * const classobj = Parrot_oo_get_class(interp, PREG(4));
-        if (!PMC_IS_NULL(classobj))
-            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
-        else {
-            const INTVAL type = Parrot_pmc_get_type(interp, PREG(4));
-            if (type <= 0) {
-                opcode_t *dest = Parrot_ex_throw_from_op_args(
-                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
-                    "Class '%Ss' not found", VTABLE_get_repr(interp, PREG(4)));return (opcode_t *)dest;
-            }
+    IREG_AT(1) = IREG_AT(7);
 
-            PREG(1) = Parrot_pmc_new(interp, type);
-        }
-    }
+return (opcode_t *)cur_opcode + 3;}
 
-return (opcode_t *)cur_opcode + 5;}
+opcode_t *
+Parrot_set_i_i__I2_I0(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG_AT(2) = IREG_AT(0);
+
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_fetch_p_p_s_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_i_i__I2_I1(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PREG(2), SREG(3));
-    if (PMC_IS_NULL(PREG(1))) {
-        PMC * const classobj = Parrot_oo_get_class(interp, PCONST(4));
-        if (!PMC_IS_NULL(classobj))
-            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
-        else {
-            const INTVAL type = Parrot_pmc_get_type(interp, PCONST(4));
-            if (type <= 0) {
-                opcode_t *dest = Parrot_ex_throw_from_op_args(
-                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
-                    "Class '%Ss' not found", VTABLE_get_repr(interp, PCONST(4)));return (opcode_t *)dest;
-            }
+    IREG_AT(2) = IREG_AT(1);
 
-            PREG(1) = Parrot_pmc_new(interp, type);
-        }
-    }
+return (opcode_t *)cur_opcode + 3;}
 
-return (opcode_t *)cur_opcode + 5;}
+opcode_t *
+Parrot_set_i_i__I2_I2(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG_AT(2) = IREG_AT(2);
+
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_fetch_p_pc_s_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_i_i__I2_I3(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PCONST(2), SREG(3));
-    if (PMC_IS_NULL(PREG(1))) {
-        PMC * const classobj = Parrot_oo_get_class(interp, PCONST(4));
-        if (!PMC_IS_NULL(classobj))
-            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
-        else {
-            const INTVAL type = Parrot_pmc_get_type(interp, PCONST(4));
-            if (type <= 0) {
-                opcode_t *dest = Parrot_ex_throw_from_op_args(
-                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
-                    "Class '%Ss' not found", VTABLE_get_repr(interp, PCONST(4)));return (opcode_t *)dest;
-            }
+    IREG_AT(2) = IREG_AT(3);
 
-            PREG(1) = Parrot_pmc_new(interp, type);
-        }
-    }
+return (opcode_t *)cur_opcode + 3;}
 
-return (opcode_t *)cur_opcode + 5;}
+opcode_t *
+Parrot_set_i_i__I2_I4(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG_AT(2) = IREG_AT(4);
+
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_fetch_p_p_sc_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_i_i__I2_I5(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PREG(2), SCONST(3));
-    if (PMC_IS_NULL(PREG(1))) {
-        PMC * const classobj = Parrot_oo_get_class(interp, PCONST(4));
-        if (!PMC_IS_NULL(classobj))
-            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
-        else {
-            const INTVAL type = Parrot_pmc_get_type(interp, PCONST(4));
-            if (type <= 0) {
-                opcode_t *dest = Parrot_ex_throw_from_op_args(
-                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
-                    "Class '%Ss' not found", VTABLE_get_repr(interp, PCONST(4)));return (opcode_t *)dest;
-            }
+    IREG_AT(2) = IREG_AT(5);
 
-            PREG(1) = Parrot_pmc_new(interp, type);
-        }
-    }
+return (opcode_t *)cur_opcode + 3;}
 
-return (opcode_t *)cur_opcode + 5;}
+opcode_t *
+Parrot_set_i_i__I2_I6(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG_AT(2) = IREG_AT(6);
+
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_fetch_p_pc_sc_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_i_i__I2_I7(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PCONST(2), SCONST(3));
-    if (PMC_IS_NULL(PREG(1))) {
-        PMC * const classobj = Parrot_oo_get_class(interp, PCONST(4));
-        if (!PMC_IS_NULL(classobj))
-            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
-        else {
-            const INTVAL type = Parrot_pmc_get_type(interp, PCONST(4));
-            if (type <= 0) {
-                opcode_t *dest = Parrot_ex_throw_from_op_args(
-                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
-                    "Class '%Ss' not found", VTABLE_get_repr(interp, PCONST(4)));return (opcode_t *)dest;
-            }
+    IREG_AT(2) = IREG_AT(7);
 
-            PREG(1) = Parrot_pmc_new(interp, type);
-        }
-    }
+return (opcode_t *)cur_opcode + 3;}
 
-return (opcode_t *)cur_opcode + 5;}
+opcode_t *
+Parrot_set_i_i__I3_I0(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG_AT(3) = IREG_AT(0);
+
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_vivify_p_p_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_i_i__I3_I1(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_get_pmc_keyed(interp, PREG(2), PREG(3));
+    IREG_AT(3) = IREG_AT(1);
 
-    if (PMC_IS_NULL(PREG(1))) {
-        PMC * const classobj = Parrot_oo_get_class(interp, PREG(4));
+return (opcode_t *)cur_opcode + 3;}
 
-        if (!PMC_IS_NULL(classobj))
-            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
-        else {
-            const INTVAL type = Parrot_pmc_get_type(interp, PREG(4));
-            if (type <= 0) {
-                opcode_t *dest = Parrot_ex_throw_from_op_args(
-                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
-                    "Class '%Ss' not found", VTABLE_get_repr(interp, PREG(4)));return (opcode_t *)dest;
-            }
+opcode_t *
+Parrot_set_i_i__I3_I2(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG_AT(3) = IREG_AT(2);
 
-            PREG(1) = Parrot_pmc_new(interp, type);
-        }
-        VTABLE_set_pmc_keyed(interp, PREG(2), PREG(3), PREG(1));
-    }
+return (opcode_t *)cur_opcode + 3;}
 
-return (opcode_t *)cur_opcode + 5;}
+opcode_t *
+Parrot_set_i_i__I3_I3(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG_AT(3) = IREG_AT(3);
+
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_vivify_p_pc_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_i_i__I3_I4(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_get_pmc_keyed(interp, PCONST(2), PREG(3));
-
-    if (PMC_IS_NULL(PREG(1))) {
-        PMC * const classobj = Parrot_oo_get_class(interp, PREG(4));
+    IREG_AT(3) = IREG_AT(4);
 
-        if (!PMC_IS_NULL(classobj))
-            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
-        else {
-            const INTVAL type = Parrot_pmc_get_type(interp, PREG(4));
-            if (type <= 0) {
-                opcode_t *dest = Parrot_ex_throw_from_op_args(
-                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
-                    "Class '%Ss' not found", VTABLE_get_repr(interp, PREG(4)));return (opcode_t *)dest;
-            }
+return (opcode_t *)cur_opcode + 3;}
 
-            PREG(1) = Parrot_pmc_new(interp, type);
-        }
-        VTABLE_set_pmc_keyed(interp, PCONST(2), PREG(3), PREG(1));
-    }
+opcode_t *
+Parrot_set_i_i__I3_I5(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG_AT(3) = IREG_AT(5);
 
-return (opcode_t *)cur_opcode + 5;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_vivify_p_p_pc_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_i_i__I3_I6(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_get_pmc_keyed(interp, PREG(2), PCONST(3));
+    IREG_AT(3) = IREG_AT(6);
 
-    if (PMC_IS_NULL(PREG(1))) {
-        PMC * const classobj = Parrot_oo_get_class(interp, PREG(4));
+return (opcode_t *)cur_opcode + 3;}
 
-        if (!PMC_IS_NULL(classobj))
-            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
-        else {
-            const INTVAL type = Parrot_pmc_get_type(interp, PREG(4));
-            if (type <= 0) {
-                opcode_t *dest = Parrot_ex_throw_from_op_args(
-                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
-                    "Class '%Ss' not found", VTABLE_get_repr(interp, PREG(4)));return (opcode_t *)dest;
-            }
+opcode_t *
+Parrot_set_i_i__I3_I7(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG_AT(3) = IREG_AT(7);
 
-            PREG(1) = Parrot_pmc_new(interp, type);
-        }
-        VTABLE_set_pmc_keyed(interp, PREG(2), PCONST(3), PREG(1));
-    }
+return (opcode_t *)cur_opcode + 3;}
 
-return (opcode_t *)cur_opcode + 5;}
+opcode_t *
+Parrot_set_i_i__I4_I0(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG_AT(4) = IREG_AT(0);
+
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_vivify_p_pc_pc_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_i_i__I4_I1(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_get_pmc_keyed(interp, PCONST(2), PCONST(3));
+    IREG_AT(4) = IREG_AT(1);
 
-    if (PMC_IS_NULL(PREG(1))) {
-        PMC * const classobj = Parrot_oo_get_class(interp, PREG(4));
+return (opcode_t *)cur_opcode + 3;}
 
-        if (!PMC_IS_NULL(classobj))
-            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
-        else {
-            const INTVAL type = Parrot_pmc_get_type(interp, PREG(4));
-            if (type <= 0) {
-                opcode_t *dest = Parrot_ex_throw_from_op_args(
-                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
-                    "Class '%Ss' not found", VTABLE_get_repr(interp, PREG(4)));return (opcode_t *)dest;
-            }
+opcode_t *
+Parrot_set_i_i__I4_I2(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG_AT(4) = IREG_AT(2);
 
-            PREG(1) = Parrot_pmc_new(interp, type);
-        }
-        VTABLE_set_pmc_keyed(interp, PCONST(2), PCONST(3), PREG(1));
-    }
+return (opcode_t *)cur_opcode + 3;}
 
-return (opcode_t *)cur_opcode + 5;}
+opcode_t *
+Parrot_set_i_i__I4_I3(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG_AT(4) = IREG_AT(3);
+
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_vivify_p_p_p_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_i_i__I4_I4(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_get_pmc_keyed(interp, PREG(2), PREG(3));
+    IREG_AT(4) = IREG_AT(4);
 
-    if (PMC_IS_NULL(PREG(1))) {
-        PMC * const classobj = Parrot_oo_get_class(interp, PCONST(4));
+return (opcode_t *)cur_opcode + 3;}
 
-        if (!PMC_IS_NULL(classobj))
-            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
-        else {
-            const INTVAL type = Parrot_pmc_get_type(interp, PCONST(4));
-            if (type <= 0) {
-                opcode_t *dest = Parrot_ex_throw_from_op_args(
-                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
-                    "Class '%Ss' not found", VTABLE_get_repr(interp, PCONST(4)));return (opcode_t *)dest;
-            }
+opcode_t *
+Parrot_set_i_i__I4_I5(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG_AT(4) = IREG_AT(5);
 
-            PREG(1) = Parrot_pmc_new(interp, type);
-        }
-        VTABLE_set_pmc_keyed(interp, PREG(2), PREG(3), PREG(1));
-    }
+return (opcode_t *)cur_opcode + 3;}
 
-return (opcode_t *)cur_opcode + 5;}
+opcode_t *
+Parrot_set_i_i__I4_I6(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG_AT(4) = IREG_AT(6);
+
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_vivify_p_pc_p_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_i_i__I4_I7(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_get_pmc_keyed(interp, PCONST(2), PREG(3));
+    IREG_AT(4) = IREG_AT(7);
 
-    if (PMC_IS_NULL(PREG(1))) {
-        PMC * const classobj = Parrot_oo_get_class(interp, PCONST(4));
+return (opcode_t *)cur_opcode + 3;}
 
-        if (!PMC_IS_NULL(classobj))
-            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
-        else {
-            const INTVAL type = Parrot_pmc_get_type(interp, PCONST(4));
-            if (type <= 0) {
-                opcode_t *dest = Parrot_ex_throw_from_op_args(
-                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
-                    "Class '%Ss' not found", VTABLE_get_repr(interp, PCONST(4)));return (opcode_t *)dest;
-            }
+opcode_t *
+Parrot_set_i_i__I5_I0(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG_AT(5) = IREG_AT(0);
 
-            PREG(1) = Parrot_pmc_new(interp, type);
-        }
-        VTABLE_set_pmc_keyed(interp, PCONST(2), PREG(3), PREG(1));
-    }
+return (opcode_t *)cur_opcode + 3;}
 
-return (opcode_t *)cur_opcode + 5;}
+opcode_t *
+Parrot_set_i_i__I5_I1(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG_AT(5) = IREG_AT(1);
+
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_vivify_p_p_pc_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_i_i__I5_I2(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_get_pmc_keyed(interp, PREG(2), PCONST(3));
+    IREG_AT(5) = IREG_AT(2);
 
-    if (PMC_IS_NULL(PREG(1))) {
-        PMC * const classobj = Parrot_oo_get_class(interp, PCONST(4));
+return (opcode_t *)cur_opcode + 3;}
 
-        if (!PMC_IS_NULL(classobj))
-            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
-        else {
-            const INTVAL type = Parrot_pmc_get_type(interp, PCONST(4));
-            if (type <= 0) {
-                opcode_t *dest = Parrot_ex_throw_from_op_args(
-                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
-                    "Class '%Ss' not found", VTABLE_get_repr(interp, PCONST(4)));return (opcode_t *)dest;
-            }
+opcode_t *
+Parrot_set_i_i__I5_I3(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG_AT(5) = IREG_AT(3);
 
-            PREG(1) = Parrot_pmc_new(interp, type);
-        }
-        VTABLE_set_pmc_keyed(interp, PREG(2), PCONST(3), PREG(1));
-    }
+return (opcode_t *)cur_opcode + 3;}
 
-return (opcode_t *)cur_opcode + 5;}
+opcode_t *
+Parrot_set_i_i__I5_I4(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG_AT(5) = IREG_AT(4);
+
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_vivify_p_pc_pc_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_i_i__I5_I5(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_get_pmc_keyed(interp, PCONST(2), PCONST(3));
+    IREG_AT(5) = IREG_AT(5);
 
-    if (PMC_IS_NULL(PREG(1))) {
-        PMC * const classobj = Parrot_oo_get_class(interp, PCONST(4));
+return (opcode_t *)cur_opcode + 3;}
 
-        if (!PMC_IS_NULL(classobj))
-            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
-        else {
-            const INTVAL type = Parrot_pmc_get_type(interp, PCONST(4));
-            if (type <= 0) {
-                opcode_t *dest = Parrot_ex_throw_from_op_args(
-                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
-                    "Class '%Ss' not found", VTABLE_get_repr(interp, PCONST(4)));return (opcode_t *)dest;
-            }
+opcode_t *
+Parrot_set_i_i__I5_I6(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG_AT(5) = IREG_AT(6);
 
-            PREG(1) = Parrot_pmc_new(interp, type);
-        }
-        VTABLE_set_pmc_keyed(interp, PCONST(2), PCONST(3), PREG(1));
-    }
+return (opcode_t *)cur_opcode + 3;}
 
-return (opcode_t *)cur_opcode + 5;}
+opcode_t *
+Parrot_set_i_i__I5_I7(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG_AT(5) = IREG_AT(7);
+
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_vivify_p_p_i_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_i_i__I6_I0(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PREG(2), IREG(3));
+    IREG_AT(6) = IREG_AT(0);
 
-    if (PMC_IS_NULL(PREG(1))) {
-        PMC * const classobj = Parrot_oo_get_class(interp, PREG(4));
-        if (!PMC_IS_NULL(classobj))
-            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
-        else {
-            const INTVAL type = Parrot_pmc_get_type(interp, PREG(4));
-            if (type <= 0) {
-                opcode_t *dest = Parrot_ex_throw_from_op_args(
-                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
-                    "Class '%Ss' not found", VTABLE_get_repr(interp, PREG(4)));return (opcode_t *)dest;
-            }
+return (opcode_t *)cur_opcode + 3;}
 
-            PREG(1) = Parrot_pmc_new(interp, type);
-        }
+opcode_t *
+Parrot_set_i_i__I6_I1(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG_AT(6) = IREG_AT(1);
 
-        VTABLE_set_pmc_keyed_int(interp, PREG(2), IREG(3), PREG(1));
-    }
+return (opcode_t *)cur_opcode + 3;}
 
-return (opcode_t *)cur_opcode + 5;}
+opcode_t *
+Parrot_set_i_i__I6_I2(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG_AT(6) = IREG_AT(2);
+
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_vivify_p_pc_i_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_i_i__I6_I3(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PCONST(2), IREG(3));
+    IREG_AT(6) = IREG_AT(3);
 
-    if (PMC_IS_NULL(PREG(1))) {
-        PMC * const classobj = Parrot_oo_get_class(interp, PREG(4));
-        if (!PMC_IS_NULL(classobj))
-            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
-        else {
-            const INTVAL type = Parrot_pmc_get_type(interp, PREG(4));
-            if (type <= 0) {
-                opcode_t *dest = Parrot_ex_throw_from_op_args(
-                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
-                    "Class '%Ss' not found", VTABLE_get_repr(interp, PREG(4)));return (opcode_t *)dest;
-            }
+return (opcode_t *)cur_opcode + 3;}
 
-            PREG(1) = Parrot_pmc_new(interp, type);
-        }
+opcode_t *
+Parrot_set_i_i__I6_I4(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG_AT(6) = IREG_AT(4);
 
-        VTABLE_set_pmc_keyed_int(interp, PCONST(2), IREG(3), PREG(1));
-    }
+return (opcode_t *)cur_opcode + 3;}
 
-return (opcode_t *)cur_opcode + 5;}
+opcode_t *
+Parrot_set_i_i__I6_I5(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG_AT(6) = IREG_AT(5);
+
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_vivify_p_p_ic_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_i_i__I6_I6(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PREG(2), ICONST(3));
+    IREG_AT(6) = IREG_AT(6);
 
-    if (PMC_IS_NULL(PREG(1))) {
-        PMC * const classobj = Parrot_oo_get_class(interp, PREG(4));
-        if (!PMC_IS_NULL(classobj))
-            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
-        else {
-            const INTVAL type = Parrot_pmc_get_type(interp, PREG(4));
-            if (type <= 0) {
-                opcode_t *dest = Parrot_ex_throw_from_op_args(
-                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
-                    "Class '%Ss' not found", VTABLE_get_repr(interp, PREG(4)));return (opcode_t *)dest;
-            }
+return (opcode_t *)cur_opcode + 3;}
 
-            PREG(1) = Parrot_pmc_new(interp, type);
-        }
+opcode_t *
+Parrot_set_i_i__I6_I7(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG_AT(6) = IREG_AT(7);
 
-        VTABLE_set_pmc_keyed_int(interp, PREG(2), ICONST(3), PREG(1));
-    }
+return (opcode_t *)cur_opcode + 3;}
+
+opcode_t *
+Parrot_set_i_i__I7_I0(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG_AT(7) = IREG_AT(0);
 
-return (opcode_t *)cur_opcode + 5;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_vivify_p_pc_ic_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_i_i__I7_I1(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PCONST(2), ICONST(3));
-
-    if (PMC_IS_NULL(PREG(1))) {
-        PMC * const classobj = Parrot_oo_get_class(interp, PREG(4));
-        if (!PMC_IS_NULL(classobj))
-            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
-        else {
-            const INTVAL type = Parrot_pmc_get_type(interp, PREG(4));
-            if (type <= 0) {
-                opcode_t *dest = Parrot_ex_throw_from_op_args(
-                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
-                    "Class '%Ss' not found", VTABLE_get_repr(interp, PREG(4)));return (opcode_t *)dest;
-            }
+    IREG_AT(7) = IREG_AT(1);
 
-            PREG(1) = Parrot_pmc_new(interp, type);
-        }
+return (opcode_t *)cur_opcode + 3;}
 
-        VTABLE_set_pmc_keyed_int(interp, PCONST(2), ICONST(3), PREG(1));
-    }
+opcode_t *
+Parrot_set_i_i__I7_I2(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG_AT(7) = IREG_AT(2);
 
-return (opcode_t *)cur_opcode + 5;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_vivify_p_p_i_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_i_i__I7_I3(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PREG(2), IREG(3));
-
-    if (PMC_IS_NULL(PREG(1))) {
-        PMC * const classobj = Parrot_oo_get_class(interp, PCONST(4));
-        if (!PMC_IS_NULL(classobj))
-            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
-        else {
-            const INTVAL type = Parrot_pmc_get_type(interp, PCONST(4));
-            if (type <= 0) {
-                opcode_t *dest = Parrot_ex_throw_from_op_args(
-                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
-                    "Class '%Ss' not found", VTABLE_get_repr(interp, PCONST(4)));return (opcode_t *)dest;
-            }
+    IREG_AT(7) = IREG_AT(3);
 
-            PREG(1) = Parrot_pmc_new(interp, type);
-        }
+return (opcode_t *)cur_opcode + 3;}
 
-        VTABLE_set_pmc_keyed_int(interp, PREG(2), IREG(3), PREG(1));
-    }
+opcode_t *
+Parrot_set_i_i__I7_I4(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG_AT(7) = IREG_AT(4);
 
-return (opcode_t *)cur_opcode + 5;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_vivify_p_pc_i_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_set_i_i__I7_I5(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PCONST(2), IREG(3));
+    IREG_AT(7) = IREG_AT(5);
 
-    if (PMC_IS_NULL(PREG(1))) {
-        PMC * const classobj = Parrot_oo_get_class(interp, PCONST(4));
-        if (!PMC_IS_NULL(classobj))
-            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
-        else {
-            const INTVAL type = Parrot_pmc_get_type(interp, PCONST(4));
-            if (type <= 0) {
-                opcode_t *dest = Parrot_ex_throw_from_op_args(
-                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
-                    "Class '%Ss' not found", VTABLE_get_repr(interp, PCONST(4)));return (opcode_t *)dest;
-            }
+return (opcode_t *)cur_opcode + 3;}
 
-            PREG(1) = Parrot_pmc_new(interp, type);
-        }
+opcode_t *
+Parrot_set_i_i__I7_I6(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG_AT(7) = IREG_AT(6);
 
-        VTABLE_set_pmc_keyed_int(interp, PCONST(2), IREG(3), PREG(1));
-    }
+return (opcode_t *)cur_opcode + 3;}
 
-return (opcode_t *)cur_opcode + 5;}
+opcode_t *
+Parrot_set_i_i__I7_I7(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG_AT(7) = IREG_AT(7);
+
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_vivify_p_p_ic_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_n_n__N0_N0(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PREG(2), ICONST(3));
+    NREG_AT(0) += NREG_AT(0);
 
-    if (PMC_IS_NULL(PREG(1))) {
-        PMC * const classobj = Parrot_oo_get_class(interp, PCONST(4));
-        if (!PMC_IS_NULL(classobj))
-            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
-        else {
-            const INTVAL type = Parrot_pmc_get_type(interp, PCONST(4));
-            if (type <= 0) {
-                opcode_t *dest = Parrot_ex_throw_from_op_args(
-                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
-                    "Class '%Ss' not found", VTABLE_get_repr(interp, PCONST(4)));return (opcode_t *)dest;
-            }
+return (opcode_t *)cur_opcode + 3;}
 
-            PREG(1) = Parrot_pmc_new(interp, type);
-        }
+opcode_t *
+Parrot_add_n_n__N0_N1(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    NREG_AT(0) += NREG_AT(1);
 
-        VTABLE_set_pmc_keyed_int(interp, PREG(2), ICONST(3), PREG(1));
-    }
+return (opcode_t *)cur_opcode + 3;}
 
-return (opcode_t *)cur_opcode + 5;}
+opcode_t *
+Parrot_add_n_n__N0_N2(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    NREG_AT(0) += NREG_AT(2);
+
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_vivify_p_pc_ic_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_n_n__N0_N3(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PCONST(2), ICONST(3));
+    NREG_AT(0) += NREG_AT(3);
 
-    if (PMC_IS_NULL(PREG(1))) {
-        PMC * const classobj = Parrot_oo_get_class(interp, PCONST(4));
-        if (!PMC_IS_NULL(classobj))
-            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
-        else {
-            const INTVAL type = Parrot_pmc_get_type(interp, PCONST(4));
-            if (type <= 0) {
-                opcode_t *dest = Parrot_ex_throw_from_op_args(
-                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
-                    "Class '%Ss' not found", VTABLE_get_repr(interp, PCONST(4)));return (opcode_t *)dest;
-            }
+return (opcode_t *)cur_opcode + 3;}
 
-            PREG(1) = Parrot_pmc_new(interp, type);
-        }
+opcode_t *
+Parrot_add_n_n__N0_N4(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    NREG_AT(0) += NREG_AT(4);
 
-        VTABLE_set_pmc_keyed_int(interp, PCONST(2), ICONST(3), PREG(1));
-    }
+return (opcode_t *)cur_opcode + 3;}
 
-return (opcode_t *)cur_opcode + 5;}
+opcode_t *
+Parrot_add_n_n__N0_N5(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    NREG_AT(0) += NREG_AT(5);
+
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_vivify_p_p_s_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_n_n__N0_N6(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PREG(2), SREG(3));
+    NREG_AT(0) += NREG_AT(6);
 
-    if (PMC_IS_NULL(PREG(1))) {
-        PMC * const classobj = Parrot_oo_get_class(interp, PREG(4));
-        if (!PMC_IS_NULL(classobj))
-            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
-        else {
-            const INTVAL type = Parrot_pmc_get_type(interp, PREG(4));
-            if (type <= 0) {
-                opcode_t *dest = Parrot_ex_throw_from_op_args(
-                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
-                    "Class '%Ss' not found", VTABLE_get_repr(interp, PREG(4)));return (opcode_t *)dest;
-            }
+return (opcode_t *)cur_opcode + 3;}
 
-            PREG(1) = Parrot_pmc_new(interp, type);
-        }
+opcode_t *
+Parrot_add_n_n__N0_N7(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    NREG_AT(0) += NREG_AT(7);
 
-        VTABLE_set_pmc_keyed_str(interp, PREG(2), SREG(3), PREG(1));
-    }
+return (opcode_t *)cur_opcode + 3;}
 
-return (opcode_t *)cur_opcode + 5;}
+opcode_t *
+Parrot_add_n_n__N1_N0(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    NREG_AT(1) += NREG_AT(0);
+
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_vivify_p_pc_s_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_n_n__N1_N1(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PCONST(2), SREG(3));
+    NREG_AT(1) += NREG_AT(1);
 
-    if (PMC_IS_NULL(PREG(1))) {
-        PMC * const classobj = Parrot_oo_get_class(interp, PREG(4));
-        if (!PMC_IS_NULL(classobj))
-            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
-        else {
-            const INTVAL type = Parrot_pmc_get_type(interp, PREG(4));
-            if (type <= 0) {
-                opcode_t *dest = Parrot_ex_throw_from_op_args(
-                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
-                    "Class '%Ss' not found", VTABLE_get_repr(interp, PREG(4)));return (opcode_t *)dest;
-            }
+return (opcode_t *)cur_opcode + 3;}
 
-            PREG(1) = Parrot_pmc_new(interp, type);
-        }
+opcode_t *
+Parrot_add_n_n__N1_N2(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    NREG_AT(1) += NREG_AT(2);
 
-        VTABLE_set_pmc_keyed_str(interp, PCONST(2), SREG(3), PREG(1));
-    }
+return (opcode_t *)cur_opcode + 3;}
 
-return (opcode_t *)cur_opcode + 5;}
+opcode_t *
+Parrot_add_n_n__N1_N3(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    NREG_AT(1) += NREG_AT(3);
+
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_vivify_p_p_sc_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_n_n__N1_N4(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PREG(2), SCONST(3));
+    NREG_AT(1) += NREG_AT(4);
 
-    if (PMC_IS_NULL(PREG(1))) {
-        PMC * const classobj = Parrot_oo_get_class(interp, PREG(4));
-        if (!PMC_IS_NULL(classobj))
-            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
-        else {
-            const INTVAL type = Parrot_pmc_get_type(interp, PREG(4));
-            if (type <= 0) {
-                opcode_t *dest = Parrot_ex_throw_from_op_args(
-                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
-                    "Class '%Ss' not found", VTABLE_get_repr(interp, PREG(4)));return (opcode_t *)dest;
-            }
+return (opcode_t *)cur_opcode + 3;}
 
-            PREG(1) = Parrot_pmc_new(interp, type);
-        }
+opcode_t *
+Parrot_add_n_n__N1_N5(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    NREG_AT(1) += NREG_AT(5);
 
-        VTABLE_set_pmc_keyed_str(interp, PREG(2), SCONST(3), PREG(1));
-    }
+return (opcode_t *)cur_opcode + 3;}
 
-return (opcode_t *)cur_opcode + 5;}
+opcode_t *
+Parrot_add_n_n__N1_N6(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    NREG_AT(1) += NREG_AT(6);
+
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_vivify_p_pc_sc_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_n_n__N1_N7(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PCONST(2), SCONST(3));
+    NREG_AT(1) += NREG_AT(7);
 
-    if (PMC_IS_NULL(PREG(1))) {
-        PMC * const classobj = Parrot_oo_get_class(interp, PREG(4));
-        if (!PMC_IS_NULL(classobj))
-            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
-        else {
-            const INTVAL type = Parrot_pmc_get_type(interp, PREG(4));
-            if (type <= 0) {
-                opcode_t *dest = Parrot_ex_throw_from_op_args(
-                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
-                    "Class '%Ss' not found", VTABLE_get_repr(interp, PREG(4)));return (opcode_t *)dest;
-            }
+return (opcode_t *)cur_opcode + 3;}
 
-            PREG(1) = Parrot_pmc_new(interp, type);
-        }
+opcode_t *
+Parrot_add_n_n__N2_N0(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    NREG_AT(2) += NREG_AT(0);
 
-        VTABLE_set_pmc_keyed_str(interp, PCONST(2), SCONST(3), PREG(1));
-    }
+return (opcode_t *)cur_opcode + 3;}
 
-return (opcode_t *)cur_opcode + 5;}
+opcode_t *
+Parrot_add_n_n__N2_N1(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    NREG_AT(2) += NREG_AT(1);
+
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_vivify_p_p_s_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_n_n__N2_N2(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PREG(2), SREG(3));
+    NREG_AT(2) += NREG_AT(2);
 
-    if (PMC_IS_NULL(PREG(1))) {
-        PMC * const classobj = Parrot_oo_get_class(interp, PCONST(4));
-        if (!PMC_IS_NULL(classobj))
-            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
-        else {
-            const INTVAL type = Parrot_pmc_get_type(interp, PCONST(4));
-            if (type <= 0) {
-                opcode_t *dest = Parrot_ex_throw_from_op_args(
-                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
-                    "Class '%Ss' not found", VTABLE_get_repr(interp, PCONST(4)));return (opcode_t *)dest;
-            }
+return (opcode_t *)cur_opcode + 3;}
 
-            PREG(1) = Parrot_pmc_new(interp, type);
-        }
+opcode_t *
+Parrot_add_n_n__N2_N3(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    NREG_AT(2) += NREG_AT(3);
 
-        VTABLE_set_pmc_keyed_str(interp, PREG(2), SREG(3), PREG(1));
-    }
+return (opcode_t *)cur_opcode + 3;}
 
-return (opcode_t *)cur_opcode + 5;}
+opcode_t *
+Parrot_add_n_n__N2_N4(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    NREG_AT(2) += NREG_AT(4);
+
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_vivify_p_pc_s_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_n_n__N2_N5(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PCONST(2), SREG(3));
-
-    if (PMC_IS_NULL(PREG(1))) {
-        PMC * const classobj = Parrot_oo_get_class(interp, PCONST(4));
-        if (!PMC_IS_NULL(classobj))
-            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
-        else {
-            const INTVAL type = Parrot_pmc_get_type(interp, PCONST(4));
-            if (type <= 0) {
-                opcode_t *dest = Parrot_ex_throw_from_op_args(
-                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
-                    "Class '%Ss' not found", VTABLE_get_repr(interp, PCONST(4)));return (opcode_t *)dest;
-            }
+    NREG_AT(2) += NREG_AT(5);
 
-            PREG(1) = Parrot_pmc_new(interp, type);
-        }
+return (opcode_t *)cur_opcode + 3;}
 
-        VTABLE_set_pmc_keyed_str(interp, PCONST(2), SREG(3), PREG(1));
-    }
+opcode_t *
+Parrot_add_n_n__N2_N6(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    NREG_AT(2) += NREG_AT(6);
 
-return (opcode_t *)cur_opcode + 5;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_vivify_p_p_sc_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_n_n__N2_N7(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PREG(2), SCONST(3));
+    NREG_AT(2) += NREG_AT(7);
 
-    if (PMC_IS_NULL(PREG(1))) {
-        PMC * const classobj = Parrot_oo_get_class(interp, PCONST(4));
-        if (!PMC_IS_NULL(classobj))
-            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
-        else {
-            const INTVAL type = Parrot_pmc_get_type(interp, PCONST(4));
-            if (type <= 0) {
-                opcode_t *dest = Parrot_ex_throw_from_op_args(
-                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
-                    "Class '%Ss' not found", VTABLE_get_repr(interp, PCONST(4)));return (opcode_t *)dest;
-            }
+return (opcode_t *)cur_opcode + 3;}
 
-            PREG(1) = Parrot_pmc_new(interp, type);
-        }
+opcode_t *
+Parrot_add_n_n__N3_N0(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    NREG_AT(3) += NREG_AT(0);
 
-        VTABLE_set_pmc_keyed_str(interp, PREG(2), SCONST(3), PREG(1));
-    }
+return (opcode_t *)cur_opcode + 3;}
 
-return (opcode_t *)cur_opcode + 5;}
+opcode_t *
+Parrot_add_n_n__N3_N1(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    NREG_AT(3) += NREG_AT(1);
+
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_vivify_p_pc_sc_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_n_n__N3_N2(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PCONST(2), SCONST(3));
+    NREG_AT(3) += NREG_AT(2);
 
-    if (PMC_IS_NULL(PREG(1))) {
-        PMC * const classobj = Parrot_oo_get_class(interp, PCONST(4));
-        if (!PMC_IS_NULL(classobj))
-            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
-        else {
-            const INTVAL type = Parrot_pmc_get_type(interp, PCONST(4));
-            if (type <= 0) {
-                opcode_t *dest = Parrot_ex_throw_from_op_args(
-                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
-                    "Class '%Ss' not found", VTABLE_get_repr(interp, PCONST(4)));return (opcode_t *)dest;
-            }
+return (opcode_t *)cur_opcode + 3;}
 
-            PREG(1) = Parrot_pmc_new(interp, type);
-        }
+opcode_t *
+Parrot_add_n_n__N3_N3(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    NREG_AT(3) += NREG_AT(3);
 
-        VTABLE_set_pmc_keyed_str(interp, PCONST(2), SCONST(3), PREG(1));
-    }
+return (opcode_t *)cur_opcode + 3;}
 
-return (opcode_t *)cur_opcode + 5;}
+opcode_t *
+Parrot_add_n_n__N3_N4(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    NREG_AT(3) += NREG_AT(4);
+
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_new_p_s_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_n_n__N3_N5(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    STRING * const name   = SREG(2);
-    PMC    * const _class = Parrot_pcc_get_HLL(interp, CURRENT_CONTEXT(interp))
-                          ? Parrot_oo_get_class_str(interp, name)
-                          : PMCNULL;
+    NREG_AT(3) += NREG_AT(5);
 
-    if (!PMC_IS_NULL(_class)) {
-        PMC *initial = Parrot_pmc_new(interp,
-                                      Parrot_hll_get_ctx_HLL_type(interp, enum_class_Integer));
-        VTABLE_set_integer_native(interp, initial, IREG(3));
-        PREG(1) = VTABLE_instantiate(interp, _class, initial);
-    }
-    else {
-        const INTVAL type = Parrot_pmc_get_type_str(interp, name);
-        if (type <= 0) {
-            opcode_t *dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
-                EXCEPTION_NO_CLASS,
-                "Class '%Ss' not found", name);return (opcode_t *)dest;
-        }
-        PREG(1) = Parrot_pmc_new_init_int(interp, type, IREG(3));
-    }
+return (opcode_t *)cur_opcode + 3;}
 
-return (opcode_t *)cur_opcode + 4;}
+opcode_t *
+Parrot_add_n_n__N3_N6(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    NREG_AT(3) += NREG_AT(6);
+
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_new_p_sc_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_n_n__N3_N7(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    STRING * const name   = SCONST(2);
-    PMC    * const _class = Parrot_pcc_get_HLL(interp, CURRENT_CONTEXT(interp))
-                          ? Parrot_oo_get_class_str(interp, name)
-                          : PMCNULL;
+    NREG_AT(3) += NREG_AT(7);
 
-    if (!PMC_IS_NULL(_class)) {
-        PMC *initial = Parrot_pmc_new(interp,
-                                      Parrot_hll_get_ctx_HLL_type(interp, enum_class_Integer));
-        VTABLE_set_integer_native(interp, initial, IREG(3));
-        PREG(1) = VTABLE_instantiate(interp, _class, initial);
-    }
-    else {
-        const INTVAL type = Parrot_pmc_get_type_str(interp, name);
-        if (type <= 0) {
-            opcode_t *dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
-                EXCEPTION_NO_CLASS,
-                "Class '%Ss' not found", name);return (opcode_t *)dest;
-        }
-        PREG(1) = Parrot_pmc_new_init_int(interp, type, IREG(3));
-    }
+return (opcode_t *)cur_opcode + 3;}
 
-return (opcode_t *)cur_opcode + 4;}
+opcode_t *
+Parrot_add_n_n__N4_N0(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    NREG_AT(4) += NREG_AT(0);
+
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_new_p_s_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_n_n__N4_N1(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    STRING * const name   = SREG(2);
-    PMC    * const _class = Parrot_pcc_get_HLL(interp, CURRENT_CONTEXT(interp))
-                          ? Parrot_oo_get_class_str(interp, name)
-                          : PMCNULL;
+    NREG_AT(4) += NREG_AT(1);
 
-    if (!PMC_IS_NULL(_class)) {
-        PMC *initial = Parrot_pmc_new(interp,
-                                      Parrot_hll_get_ctx_HLL_type(interp, enum_class_Integer));
-        VTABLE_set_integer_native(interp, initial, ICONST(3));
-        PREG(1) = VTABLE_instantiate(interp, _class, initial);
-    }
-    else {
-        const INTVAL type = Parrot_pmc_get_type_str(interp, name);
-        if (type <= 0) {
-            opcode_t *dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
-                EXCEPTION_NO_CLASS,
-                "Class '%Ss' not found", name);return (opcode_t *)dest;
-        }
-        PREG(1) = Parrot_pmc_new_init_int(interp, type, ICONST(3));
-    }
+return (opcode_t *)cur_opcode + 3;}
 
-return (opcode_t *)cur_opcode + 4;}
+opcode_t *
+Parrot_add_n_n__N4_N2(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    NREG_AT(4) += NREG_AT(2);
+
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_new_p_sc_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_n_n__N4_N3(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    STRING * const name   = SCONST(2);
-    PMC    * const _class = Parrot_pcc_get_HLL(interp, CURRENT_CONTEXT(interp))
-                          ? Parrot_oo_get_class_str(interp, name)
-                          : PMCNULL;
+    NREG_AT(4) += NREG_AT(3);
 
-    if (!PMC_IS_NULL(_class)) {
-        PMC *initial = Parrot_pmc_new(interp,
-                                      Parrot_hll_get_ctx_HLL_type(interp, enum_class_Integer));
-        VTABLE_set_integer_native(interp, initial, ICONST(3));
-        PREG(1) = VTABLE_instantiate(interp, _class, initial);
-    }
-    else {
-        const INTVAL type = Parrot_pmc_get_type_str(interp, name);
-        if (type <= 0) {
-            opcode_t *dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
-                EXCEPTION_NO_CLASS,
-                "Class '%Ss' not found", name);return (opcode_t *)dest;
-        }
-        PREG(1) = Parrot_pmc_new_init_int(interp, type, ICONST(3));
-    }
+return (opcode_t *)cur_opcode + 3;}
 
-return (opcode_t *)cur_opcode + 4;}
+opcode_t *
+Parrot_add_n_n__N4_N4(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    NREG_AT(4) += NREG_AT(4);
+
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_new_p_p_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_n_n__N4_N5(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const  name_key = PREG(2);
+    NREG_AT(4) += NREG_AT(5);
 
-    /* get_class() returns a PMCProxy for core types, so check for core PMCs */
-    const INTVAL type = Parrot_pmc_get_type(interp, name_key);
+return (opcode_t *)cur_opcode + 3;}
 
-    /* if it's clearly a PIR-level PMC */
-    if (type > enum_class_core_max) {
-        PMC * const _class = Parrot_oo_get_class(interp, name_key);
-        if (!PMC_IS_NULL(_class)) {
-            PMC *initial = Parrot_pmc_new(interp,
-                Parrot_hll_get_ctx_HLL_type(interp, enum_class_Integer));
-            VTABLE_set_integer_native(interp, initial, IREG(3));
-            PREG(1) = VTABLE_instantiate(interp, _class, initial);
-        }
-    }
+opcode_t *
+Parrot_add_n_n__N4_N6(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    NREG_AT(4) += NREG_AT(6);
 
-    /* if it's a core PMC */
-    else if (type > enum_class_default)
-        PREG(1) = Parrot_pmc_new_init_int(interp, type, IREG(3));
+return (opcode_t *)cur_opcode + 3;}
 
-    /* it's a typo */
-    else {
-        opcode_t *dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
-            EXCEPTION_NO_CLASS,
-            "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));return (opcode_t *)dest;
-    }
+opcode_t *
+Parrot_add_n_n__N4_N7(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    NREG_AT(4) += NREG_AT(7);
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_new_p_pc_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_n_n__N5_N0(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const  name_key = PCONST(2);
+    NREG_AT(5) += NREG_AT(0);
 
-    /* get_class() returns a PMCProxy for core types, so check for core PMCs */
-    const INTVAL type = Parrot_pmc_get_type(interp, name_key);
+return (opcode_t *)cur_opcode + 3;}
 
-    /* if it's clearly a PIR-level PMC */
-    if (type > enum_class_core_max) {
-        PMC * const _class = Parrot_oo_get_class(interp, name_key);
-        if (!PMC_IS_NULL(_class)) {
-            PMC *initial = Parrot_pmc_new(interp,
-                Parrot_hll_get_ctx_HLL_type(interp, enum_class_Integer));
-            VTABLE_set_integer_native(interp, initial, IREG(3));
-            PREG(1) = VTABLE_instantiate(interp, _class, initial);
-        }
-    }
+opcode_t *
+Parrot_add_n_n__N5_N1(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    NREG_AT(5) += NREG_AT(1);
 
-    /* if it's a core PMC */
-    else if (type > enum_class_default)
-        PREG(1) = Parrot_pmc_new_init_int(interp, type, IREG(3));
+return (opcode_t *)cur_opcode + 3;}
 
-    /* it's a typo */
-    else {
-        opcode_t *dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
-            EXCEPTION_NO_CLASS,
-            "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));return (opcode_t *)dest;
-    }
+opcode_t *
+Parrot_add_n_n__N5_N2(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    NREG_AT(5) += NREG_AT(2);
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_new_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_n_n__N5_N3(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const  name_key = PREG(2);
+    NREG_AT(5) += NREG_AT(3);
 
-    /* get_class() returns a PMCProxy for core types, so check for core PMCs */
-    const INTVAL type = Parrot_pmc_get_type(interp, name_key);
+return (opcode_t *)cur_opcode + 3;}
 
-    /* if it's clearly a PIR-level PMC */
-    if (type > enum_class_core_max) {
-        PMC * const _class = Parrot_oo_get_class(interp, name_key);
-        if (!PMC_IS_NULL(_class)) {
-            PMC *initial = Parrot_pmc_new(interp,
-                Parrot_hll_get_ctx_HLL_type(interp, enum_class_Integer));
-            VTABLE_set_integer_native(interp, initial, ICONST(3));
-            PREG(1) = VTABLE_instantiate(interp, _class, initial);
-        }
-    }
+opcode_t *
+Parrot_add_n_n__N5_N4(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    NREG_AT(5) += NREG_AT(4);
 
-    /* if it's a core PMC */
-    else if (type > enum_class_default)
-        PREG(1) = Parrot_pmc_new_init_int(interp, type, ICONST(3));
+return (opcode_t *)cur_opcode + 3;}
 
-    /* it's a typo */
-    else {
-        opcode_t *dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
-            EXCEPTION_NO_CLASS,
-            "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));return (opcode_t *)dest;
-    }
+opcode_t *
+Parrot_add_n_n__N5_N5(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    NREG_AT(5) += NREG_AT(5);
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_new_p_pc_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_n_n__N5_N6(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const  name_key = PCONST(2);
+    NREG_AT(5) += NREG_AT(6);
 
-    /* get_class() returns a PMCProxy for core types, so check for core PMCs */
-    const INTVAL type = Parrot_pmc_get_type(interp, name_key);
+return (opcode_t *)cur_opcode + 3;}
 
-    /* if it's clearly a PIR-level PMC */
-    if (type > enum_class_core_max) {
-        PMC * const _class = Parrot_oo_get_class(interp, name_key);
-        if (!PMC_IS_NULL(_class)) {
-            PMC *initial = Parrot_pmc_new(interp,
-                Parrot_hll_get_ctx_HLL_type(interp, enum_class_Integer));
-            VTABLE_set_integer_native(interp, initial, ICONST(3));
-            PREG(1) = VTABLE_instantiate(interp, _class, initial);
-        }
-    }
+opcode_t *
+Parrot_add_n_n__N5_N7(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    NREG_AT(5) += NREG_AT(7);
 
-    /* if it's a core PMC */
-    else if (type > enum_class_default)
-        PREG(1) = Parrot_pmc_new_init_int(interp, type, ICONST(3));
+return (opcode_t *)cur_opcode + 3;}
 
-    /* it's a typo */
-    else {
-        opcode_t *dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
-            EXCEPTION_NO_CLASS,
-            "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));return (opcode_t *)dest;
-    }
+opcode_t *
+Parrot_add_n_n__N6_N0(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    NREG_AT(6) += NREG_AT(0);
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_root_new_p_p_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_n_n__N6_N1(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const  name_key = PREG(2);
+    NREG_AT(6) += NREG_AT(1);
 
-    /* get_class() returns a PMCProxy for core types, so check for core PMCs */
-    const INTVAL type = Parrot_pmc_get_type(interp, name_key);
+return (opcode_t *)cur_opcode + 3;}
 
-    /* if it's clearly a PIR-level PMC */
-    if (type > enum_class_core_max) {
-        PMC * const root_ns  = interp->root_namespace;
-        PMC * const ns       = Parrot_ns_get_namespace_keyed(interp, root_ns, name_key);
-        PMC * const _class   = Parrot_oo_get_class(interp, ns);
-        if (!PMC_IS_NULL(_class)) {
-            PMC *initial = Parrot_pmc_new(interp,
-                Parrot_hll_get_ctx_HLL_type(interp, enum_class_Integer));
-            VTABLE_set_integer_native(interp, initial, IREG(3));
-            PREG(1) = VTABLE_instantiate(interp, _class, initial);
-        }
-    }
+opcode_t *
+Parrot_add_n_n__N6_N2(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    NREG_AT(6) += NREG_AT(2);
 
-    /* if it's a core PMC */
-    else if (type > enum_class_default)
-        PREG(1) = Parrot_pmc_new_init_int(interp, type, IREG(3));
+return (opcode_t *)cur_opcode + 3;}
 
-    /* it's a typo */
-    else {
-        opcode_t *dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
-            EXCEPTION_NO_CLASS,
-            "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));return (opcode_t *)dest;
-    }
+opcode_t *
+Parrot_add_n_n__N6_N3(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    NREG_AT(6) += NREG_AT(3);
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_root_new_p_pc_i(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_n_n__N6_N4(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const  name_key = PCONST(2);
+    NREG_AT(6) += NREG_AT(4);
 
-    /* get_class() returns a PMCProxy for core types, so check for core PMCs */
-    const INTVAL type = Parrot_pmc_get_type(interp, name_key);
+return (opcode_t *)cur_opcode + 3;}
 
-    /* if it's clearly a PIR-level PMC */
-    if (type > enum_class_core_max) {
-        PMC * const root_ns  = interp->root_namespace;
-        PMC * const ns       = Parrot_ns_get_namespace_keyed(interp, root_ns, name_key);
-        PMC * const _class   = Parrot_oo_get_class(interp, ns);
-        if (!PMC_IS_NULL(_class)) {
-            PMC *initial = Parrot_pmc_new(interp,
-                Parrot_hll_get_ctx_HLL_type(interp, enum_class_Integer));
-            VTABLE_set_integer_native(interp, initial, IREG(3));
-            PREG(1) = VTABLE_instantiate(interp, _class, initial);
-        }
-    }
+opcode_t *
+Parrot_add_n_n__N6_N5(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    NREG_AT(6) += NREG_AT(5);
 
-    /* if it's a core PMC */
-    else if (type > enum_class_default)
-        PREG(1) = Parrot_pmc_new_init_int(interp, type, IREG(3));
+return (opcode_t *)cur_opcode + 3;}
 
-    /* it's a typo */
-    else {
-        opcode_t *dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
-            EXCEPTION_NO_CLASS,
-            "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));return (opcode_t *)dest;
-    }
+opcode_t *
+Parrot_add_n_n__N6_N6(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    NREG_AT(6) += NREG_AT(6);
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_root_new_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_n_n__N6_N7(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const  name_key = PREG(2);
+    NREG_AT(6) += NREG_AT(7);
 
-    /* get_class() returns a PMCProxy for core types, so check for core PMCs */
-    const INTVAL type = Parrot_pmc_get_type(interp, name_key);
+return (opcode_t *)cur_opcode + 3;}
 
-    /* if it's clearly a PIR-level PMC */
-    if (type > enum_class_core_max) {
-        PMC * const root_ns  = interp->root_namespace;
-        PMC * const ns       = Parrot_ns_get_namespace_keyed(interp, root_ns, name_key);
-        PMC * const _class   = Parrot_oo_get_class(interp, ns);
-        if (!PMC_IS_NULL(_class)) {
-            PMC *initial = Parrot_pmc_new(interp,
-                Parrot_hll_get_ctx_HLL_type(interp, enum_class_Integer));
-            VTABLE_set_integer_native(interp, initial, ICONST(3));
-            PREG(1) = VTABLE_instantiate(interp, _class, initial);
-        }
-    }
+opcode_t *
+Parrot_add_n_n__N7_N0(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    NREG_AT(7) += NREG_AT(0);
 
-    /* if it's a core PMC */
-    else if (type > enum_class_default)
-        PREG(1) = Parrot_pmc_new_init_int(interp, type, ICONST(3));
+return (opcode_t *)cur_opcode + 3;}
 
-    /* it's a typo */
-    else {
-        opcode_t *dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
-            EXCEPTION_NO_CLASS,
-            "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));return (opcode_t *)dest;
-    }
+opcode_t *
+Parrot_add_n_n__N7_N1(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    NREG_AT(7) += NREG_AT(1);
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_root_new_p_pc_ic(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_n_n__N7_N2(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PMC * const  name_key = PCONST(2);
+    NREG_AT(7) += NREG_AT(2);
 
-    /* get_class() returns a PMCProxy for core types, so check for core PMCs */
-    const INTVAL type = Parrot_pmc_get_type(interp, name_key);
+return (opcode_t *)cur_opcode + 3;}
 
-    /* if it's clearly a PIR-level PMC */
-    if (type > enum_class_core_max) {
-        PMC * const root_ns  = interp->root_namespace;
-        PMC * const ns       = Parrot_ns_get_namespace_keyed(interp, root_ns, name_key);
-        PMC * const _class   = Parrot_oo_get_class(interp, ns);
-        if (!PMC_IS_NULL(_class)) {
-            PMC *initial = Parrot_pmc_new(interp,
-                Parrot_hll_get_ctx_HLL_type(interp, enum_class_Integer));
-            VTABLE_set_integer_native(interp, initial, ICONST(3));
-            PREG(1) = VTABLE_instantiate(interp, _class, initial);
-        }
-    }
+opcode_t *
+Parrot_add_n_n__N7_N3(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    NREG_AT(7) += NREG_AT(3);
 
-    /* if it's a core PMC */
-    else if (type > enum_class_default)
-        PREG(1) = Parrot_pmc_new_init_int(interp, type, ICONST(3));
+return (opcode_t *)cur_opcode + 3;}
 
-    /* it's a typo */
-    else {
-        opcode_t *dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
-            EXCEPTION_NO_CLASS,
-            "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));return (opcode_t *)dest;
-    }
+opcode_t *
+Parrot_add_n_n__N7_N4(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    NREG_AT(7) += NREG_AT(4);
 
-return (opcode_t *)cur_opcode + 4;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_finalize_p(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_n_n__N7_N5(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    /* Go to the next op after loop unrolling */
-    opcode_t * const dest = cur_opcode + 2;
-    PMC *eh = PMCNULL;
-    Parrot_warn_experimental(interp, "finalize is experimental");
-    if (!PMC_IS_NULL(PREG(1))) {
-        /* If isa ExceptionHandler, use it. If isa Exception, get its active handler */
-        if (VTABLE_isa(interp, PREG(1), Parrot_str_new_constant(interp, "ExceptionHandler")))
-            eh = PREG(1);
-        else if (VTABLE_isa(interp, PREG(1), Parrot_str_new_constant(interp, "Exception"))) {
-            PMC *iter = VTABLE_get_attr_str(interp,
-                                            PREG(1), Parrot_str_new_constant(interp, "handler_iter"));
-            if (!PMC_IS_NULL(iter))
-                eh = VTABLE_get_pmc_keyed_int(interp, iter, -1);
-        }
-    }
-    if (!PMC_IS_NULL(eh)) {
-        /* Get the runloop_id from the continuation and jump to it. */
-        Parrot_runloop *rl = interp->current_runloop;
-        INTVAL rid;
-        Parrot_pcc_invoke_method_from_c_args(interp,
-                                             eh, Parrot_str_new_constant(interp, "rid"),
-                                             "->I", &rid);
-        while (rl && rl->id != rid)
-            rl = rl->prev;
-        if (rl) {
-            if (rl != interp->current_runloop) {
-                rl->handler_start = dest;
-                longjmp(rl->resume, 3);
-            }
-        }
-        else
-            Parrot_ex_throw_from_c_args(interp, NULL,
-                    EXCEPTION_INVALID_OPERATION, "missing runloop");
-    }
+    NREG_AT(7) += NREG_AT(5);
 
-return (opcode_t *)cur_opcode + 2;}
+return (opcode_t *)cur_opcode + 3;}
 
 opcode_t *
-Parrot_finalize_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
+Parrot_add_n_n__N7_N6(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    /* Go to the next op after loop unrolling */
-    opcode_t * const dest = cur_opcode + 2;
-    PMC *eh = PMCNULL;
-    Parrot_warn_experimental(interp, "finalize is experimental");
-    if (!PMC_IS_NULL(PCONST(1))) {
-        /* If isa ExceptionHandler, use it. If isa Exception, get its active handler */
-        if (VTABLE_isa(interp, PCONST(1), Parrot_str_new_constant(interp, "ExceptionHandler")))
-            eh = PCONST(1);
-        else if (VTABLE_isa(interp, PCONST(1), Parrot_str_new_constant(interp, "Exception"))) {
-            PMC *iter = VTABLE_get_attr_str(interp,
-                                            PCONST(1), Parrot_str_new_constant(interp, "handler_iter"));
-            if (!PMC_IS_NULL(iter))
-                eh = VTABLE_get_pmc_keyed_int(interp, iter, -1);
-        }
-    }
-    if (!PMC_IS_NULL(eh)) {
-        /* Get the runloop_id from the continuation and jump to it. */
-        Parrot_runloop *rl = interp->current_runloop;
-        INTVAL rid;
-        Parrot_pcc_invoke_method_from_c_args(interp,
-                                             eh, Parrot_str_new_constant(interp, "rid"),
-                                             "->I", &rid);
-        while (rl && rl->id != rid)
-            rl = rl->prev;
-        if (rl) {
-            if (rl != interp->current_runloop) {
-                rl->handler_start = dest;
-                longjmp(rl->resume, 3);
-            }
-        }
-        else
-            Parrot_ex_throw_from_c_args(interp, NULL,
-                    EXCEPTION_INVALID_OPERATION, "missing runloop");
-    }
+    NREG_AT(7) += NREG_AT(6);
 
-return (opcode_t *)cur_opcode + 2;}
+return (opcode_t *)cur_opcode + 3;}
+
+opcode_t *
+Parrot_add_n_n__N7_N7(opcode_t *cur_opcode, PARROT_INTERP)  {
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    NREG_AT(7) += NREG_AT(7);
+
+return (opcode_t *)cur_opcode + 3;}
 
 
 /*
@@ -25831,7 +31987,7 @@ op_lib_t core_op_lib = {
   2,    /* major_version */
   11,    /* minor_version */
   0,    /* patch_version */
-  1071,             /* op_count */
+  1357,             /* op_count */
   core_op_info_table,       /* op_info_table */
   core_op_func_table,       /* op_func_table */
   get_op          /* op_code() */ 
@@ -25939,8 +32095,9 @@ static void hop_init(PARROT_INTERP)
     for (i = 0; i < core_op_lib.op_count; i++) {
         store_op(interp, info + i, hops++, info[i].full_name);
 
-        /* plus one short name */
-        if (i && info[i - 1].name != info[i].name)
+        /* plus one short name, except for the register specialized ops
+         * at the end, which share the short name of their general op */
+        if (i && i < 1077 && info[i - 1].name != info[i].name)
             store_op(interp, info + i, hops++, info[i].name);
     }
 }
@@ -29,6 +29,7 @@ about the structure of the frozen bytecode.
 #include "parrot/extend.h"
 #include "parrot/dynext.h"
 #include "parrot/runcore_api.h"
+#include "parrot/runcore_jit.h"
 #include "../compilers/imcc/imc.h"
 #include "api.str"
 #include "pmc/pmc_sub.h"
@@ -935,6 +936,7 @@ do_sub_pragmas(PARROT_INTERP, ARGIN(PackFile_ByteCode *self),
 
             PMC_get_sub(interp, sub_pmc, sub);
             sub->eval_pmc = eval_pmc;
+            PARROT_GC_WRITE_BARRIER(interp, sub_pmc);
 
             if (((PObj_get_FLAGS(sub_pmc) & SUB_FLAG_PF_MASK)
             ||   (Sub_comp_get_FLAGS(sub) & SUB_COMP_FLAG_MASK))
@@ -1208,6 +1210,9 @@ PackFile_unpack(PARROT_INTERP, ARGMOD(PackFile *self),
                                      &self->directory.base, cursor);
     Parrot_unblock_GC_mark(interp);
 
+    /* ... and checks its bytecode, so the runcores can trust it */
+    PackFile_verify(interp, self);
+
 #ifdef PARROT_HAS_HEADER_SYSMMAN
     if (self->is_mmap_ped
     && (self->need_endianize || self->need_wordsize)) {
@@ -2587,6 +2592,16 @@ byte_code_destroy(PARROT_INTERP, ARGMOD(PackFile_Segment *self))
         mem_gc_free(interp, byte_code->op_func_table);
     if (byte_code->op_info_table)
         mem_gc_free(interp, byte_code->op_info_table);
+    if (byte_code->threaded_code)
+        mem_gc_free(interp, byte_code->threaded_code);
+    if (byte_code->bounds_steps)
+        mem_gc_free(interp, byte_code->bounds_steps);
+    if (byte_code->cg_ops_table)
+        mem_gc_free(interp, byte_code->cg_ops_table);
+    if (byte_code->method_ics)
+        Parrot_destroy_method_inline_caches(interp, byte_code);
+    if (byte_code->jit_loops)
+        Parrot_jit_destroy_loops(interp, byte_code);
     if (byte_code->op_mapping.libs) {
         opcode_t n_libs = byte_code->op_mapping.n_libs;
         opcode_t i;
@@ -2610,6 +2625,14 @@ byte_code_destroy(PARROT_INTERP, ARGMOD(PackFile_Segment *self))
     byte_code->debugs          = NULL;
     byte_code->op_func_table   = NULL;
     byte_code->op_info_table   = NULL;
+    byte_code->threaded_code   = NULL;
+    byte_code->threaded_size   = 0;
+    byte_code->bounds_steps    = NULL;
+    byte_code->bounds_size     = 0;
+    byte_code->verified        = 0;
+    byte_code->cg_ops_addr     = NULL;
+    byte_code->cg_ops_table    = NULL;
+    byte_code->cg_op_count     = 0;
     byte_code->op_mapping.libs = NULL;
     byte_code->libdeps         = NULL;
 }
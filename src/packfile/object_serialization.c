@@ -348,6 +348,10 @@ Parrot_visit_loop_visit(PARROT_INTERP, ARGIN(PMC *info))
         VTABLE_visit(interp, current, info);
 
         VISIT_PMC(interp, info, PMC_metadata(current));
+
+        /* visit stores the thawed children into current */
+        if (action != VISIT_FREEZE_NORMAL)
+            PARROT_GC_WRITE_BARRIER(interp, current);
     }
 }
 
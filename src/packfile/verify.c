@@ -0,0 +1,539 @@
+/*
+Copyright (C) 2011, Parrot Foundation.
+This program is free software. It is subject to the same license as
+Parrot itself.
+
+=head1 NAME
+
+src/packfile/verify.c - Bytecode verifier
+
+=head1 DESCRIPTION
+
+This file checks, once after a packfile is unpacked, that the bytecode in it
+can be run without the runcores checking it op by op.  A bytecode segment
+passes if:
+
+=over 4
+
+=item * it is made only of ops in its op table, each of which fits in the
+segment and in the sub it belongs to,
+
+=item * every register an op names, including the arguments of the calling
+convention ops, is below the C<n_regs_used> of its sub,
+
+=item * every constant an op names is in the segment's constant table,
+
+=item * every constant label, and every sub, starts at an op.
+
+=back
+
+The verifier never throws: a segment which doesn't pass just isn't flagged
+as C<verified>, and runs as it did before.
+
+=head2 Functions
+
+=over 4
+
+=cut
+
+*/
+
+#include "parrot/parrot.h"
+#include "parrot/packfile.h"
+#include "pmc/pmc_sub.h"
+#include "parrot/oplib/ops.h"
+#include "parrot/oplib/core_ops.h"
+
+/* HEADERIZER HFILE: include/parrot/packfile.h */
+
+/* a sub in the segment being verified */
+typedef struct verify_sub_t {
+    size_t         start;
+    size_t         end;
+    const UINTVAL *n_regs_used;
+} verify_sub_t;
+
+/* HEADERIZER BEGIN: static */
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+
+PARROT_WARN_UNUSED_RESULT
+static int verify_arg(
+    ARGIN(const PackFile_ConstTable *ct),
+    ARGIN(const verify_sub_t *sub),
+    INTVAL type,
+    opcode_t arg)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+PARROT_WARN_UNUSED_RESULT
+static int verify_code(PARROT_INTERP,
+    ARGIN(const PackFile_ByteCode *bc),
+    ARGIN(const verify_sub_t *subs),
+    size_t n_subs,
+    ARGMOD(char *op_starts))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(5)
+        FUNC_MODIFIES(*op_starts);
+
+PARROT_WARN_UNUSED_RESULT
+static int verify_labels(
+    ARGIN(const PackFile_ByteCode *bc),
+    ARGIN(const char *op_starts))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+static INTVAL verify_segment_iter(PARROT_INTERP,
+    ARGMOD(PackFile_Segment *seg),
+    SHIM(void *user_data))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*seg);
+
+static int verify_sub_cmp(ARGIN(const void *a), ARGIN(const void *b))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+PARROT_WARN_UNUSED_RESULT
+static opcode_t verify_var_args(PARROT_INTERP,
+    ARGIN(const PackFile_ByteCode *bc),
+    ARGIN(const opcode_t *pc),
+    size_t room)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
+#define ASSERT_ARGS_verify_arg __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(ct) \
+    , PARROT_ASSERT_ARG(sub))
+#define ASSERT_ARGS_verify_code __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(bc) \
+    , PARROT_ASSERT_ARG(subs) \
+    , PARROT_ASSERT_ARG(op_starts))
+#define ASSERT_ARGS_verify_labels __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(bc) \
+    , PARROT_ASSERT_ARG(op_starts))
+#define ASSERT_ARGS_verify_segment_iter __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(seg))
+#define ASSERT_ARGS_verify_sub_cmp __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(a) \
+    , PARROT_ASSERT_ARG(b))
+#define ASSERT_ARGS_verify_var_args __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(bc) \
+    , PARROT_ASSERT_ARG(pc))
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+/* HEADERIZER END: static */
+
+
+/*
+
+=item C<void PackFile_verify(PARROT_INTERP, PackFile *self)>
+
+Runs C<PackFile_ByteCode_verify> on every bytecode segment of the packfile
+C<self>.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+void
+PackFile_verify(PARROT_INTERP, ARGMOD(PackFile *self))
+{
+    ASSERT_ARGS(PackFile_verify)
+
+    PackFile_map_segments(interp, &self->directory, verify_segment_iter, NULL);
+}
+
+
+/*
+
+=item C<static INTVAL verify_segment_iter(PARROT_INTERP, PackFile_Segment *seg,
+void *user_data)>
+
+Verifies C<seg> if it is a bytecode segment, and the segments in it if it is
+a directory.  Always returns 0, so every segment is visited.
+
+=cut
+
+*/
+
+static INTVAL
+verify_segment_iter(PARROT_INTERP, ARGMOD(PackFile_Segment *seg),
+        SHIM(void *user_data))
+{
+    ASSERT_ARGS(verify_segment_iter)
+
+    switch (seg->type) {
+      case PF_DIR_SEG:
+        PackFile_map_segments(interp, (const PackFile_Directory *)seg,
+                verify_segment_iter, NULL);
+        break;
+
+      case PF_BYTEC_SEG:
+        (void)PackFile_ByteCode_verify(interp, (PackFile_ByteCode *)seg);
+        break;
+
+      default:
+        break;
+    }
+
+    return 0;
+}
+
+
+/*
+
+=item C<INTVAL PackFile_ByteCode_verify(PARROT_INTERP, PackFile_ByteCode *self)>
+
+Verifies the bytecode segment C<self>, setting its C<verified> flag if it
+passes.  Returns the flag.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+INTVAL
+PackFile_ByteCode_verify(PARROT_INTERP, ARGMOD(PackFile_ByteCode *self))
+{
+    ASSERT_ARGS(PackFile_ByteCode_verify)
+    const PackFile_ConstTable * const ct   = self->const_table;
+    const size_t                      size = self->base.size;
+    STRING       * const              SUB  = Parrot_str_new_constant(interp, "Sub");
+    verify_sub_t *subs;
+    char         *op_starts;
+    size_t        n_subs = 0;
+    int           ok     = 1;
+    opcode_t      i;
+
+    self->verified = 0;
+
+    if (!ct || !self->base.data || !size)
+        return 0;
+
+    subs = mem_gc_allocate_n_zeroed_typed(interp, ct->pmc.const_count + 1, verify_sub_t);
+
+    for (i = 0; i < ct->pmc.const_count; ++i) {
+        PMC * const sub_pmc = ct->pmc.constants[i];
+        Parrot_Sub_attributes *sub;
+
+        if (PMC_IS_NULL(sub_pmc) || !VTABLE_isa(interp, sub_pmc, SUB))
+            continue;
+
+        PMC_get_sub(interp, sub_pmc, sub);
+
+        if (sub->seg != self)
+            continue;
+
+        if (sub->start_offs >= sub->end_offs || sub->end_offs > size) {
+            ok = 0;
+            break;
+        }
+
+        subs[n_subs].start       = sub->start_offs;
+        subs[n_subs].end         = sub->end_offs;
+        subs[n_subs].n_regs_used = sub->n_regs_used;
+        ++n_subs;
+    }
+
+    if (ok && n_subs) {
+        size_t s;
+
+        qsort(subs, n_subs, sizeof (verify_sub_t), verify_sub_cmp);
+
+        /* subs mustn't overlap, and registers are only known inside them */
+        for (s = 1; s < n_subs; ++s)
+            if (subs[s].start < subs[s - 1].end)
+                ok = 0;
+    }
+    else
+        ok = 0;
+
+    if (ok) {
+        size_t s;
+
+        op_starts = mem_gc_allocate_n_zeroed_typed(interp, size, char);
+        ok        = verify_code(interp, self, subs, n_subs, op_starts)
+                 && verify_labels(self, op_starts);
+
+        for (s = 0; ok && s < n_subs; ++s)
+            if (!op_starts[subs[s].start])
+                ok = 0;
+
+        mem_gc_free(interp, op_starts);
+    }
+
+    mem_gc_free(interp, subs);
+
+    self->verified = ok;
+    return ok;
+}
+
+
+/*
+
+=item C<static int verify_sub_cmp(const void *a, const void *b)>
+
+Orders subs by their start offset, for C<qsort>.
+
+=cut
+
+*/
+
+static int
+verify_sub_cmp(ARGIN(const void *a), ARGIN(const void *b))
+{
+    ASSERT_ARGS(verify_sub_cmp)
+    const verify_sub_t * const sa = (const verify_sub_t *)a;
+    const verify_sub_t * const sb = (const verify_sub_t *)b;
+
+    return sa->start < sb->start ? -1 : sa->start > sb->start;
+}
+
+
+/*
+
+=item C<static int verify_code(PARROT_INTERP, const PackFile_ByteCode *bc, const
+verify_sub_t *subs, size_t n_subs, char *op_starts)>
+
+Walks the ops of C<bc>, checking each against the op table and checking its
+arguments against the registers of its sub and the constant table, and marks
+where each op starts in C<op_starts>.  C<subs> are sorted and don't overlap.
+Returns whether all ops pass.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static int
+verify_code(PARROT_INTERP, ARGIN(const PackFile_ByteCode *bc),
+        ARGIN(const verify_sub_t *subs), size_t n_subs, ARGMOD(char *op_starts))
+{
+    ASSERT_ARGS(verify_code)
+    const PackFile_ConstTable * const ct   = bc->const_table;
+    const opcode_t            * const base = bc->base.data;
+    const size_t                      size = bc->base.size;
+    size_t                            n    = 0;
+    size_t                            s    = 0;
+
+    while (n < size) {
+        const opcode_t * const pc = base + n;
+        const op_info_t       *info;
+        const verify_sub_t    *sub;
+        opcode_t               var_args;
+        size_t                 step;
+        int                    a;
+
+        while (s < n_subs && subs[s].end <= n)
+            ++s;
+
+        if (s == n_subs || n < subs[s].start)
+            return 0;
+
+        sub = &subs[s];
+
+        if (*pc < 0 || (size_t)*pc >= bc->op_count || !bc->op_info_table[*pc])
+            return 0;
+
+        info = bc->op_info_table[*pc];
+
+        if ((size_t)info->op_count > sub->end - n)
+            return 0;
+
+        var_args = verify_var_args(interp, bc, pc, sub->end - n - info->op_count);
+
+        if (var_args < 0)
+            return 0;
+
+        for (a = 1; a < info->op_count; ++a)
+            if (!verify_arg(ct, sub, info->types[a - 1], pc[a]))
+                return 0;
+
+        /* the arguments of the calling convention ops, typed by the flags
+         * in their signature */
+        if (var_args) {
+            PMC * const sig = ct->pmc.constants[pc[1]];
+
+            for (a = 0; a < var_args; ++a) {
+                const INTVAL flags = VTABLE_get_integer_keyed_int(interp, sig, a);
+                const INTVAL type  = flags & (PARROT_ARG_TYPE_MASK | PARROT_ARG_CONSTANT);
+
+                if (!verify_arg(ct, sub, type, pc[info->op_count + a]))
+                    return 0;
+            }
+        }
+
+        step          = info->op_count + var_args;
+        op_starts[n]  = 1;
+        n            += step;
+    }
+
+    return 1;
+}
+
+
+/*
+
+=item C<static opcode_t verify_var_args(PARROT_INTERP, const PackFile_ByteCode
+*bc, const opcode_t *pc, size_t room)>
+
+Returns the number of variable arguments of the op at C<pc>, like
+C<ADD_OP_VAR_PART> does, or -1 if its signature is not a constant
+C<FixedIntegerArray> or the arguments don't fit in the C<room> left in the
+sub.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static opcode_t
+verify_var_args(PARROT_INTERP, ARGIN(const PackFile_ByteCode *bc),
+        ARGIN(const opcode_t *pc), size_t room)
+{
+    ASSERT_ARGS(verify_var_args)
+    op_lib_t * const core_ops = PARROT_GET_CORE_OPLIB(interp);
+    PMC             *sig;
+    INTVAL           n;
+
+    if (!OPCODE_IS(interp, bc, *pc, core_ops, PARROT_OP_set_args_pc)
+    &&  !OPCODE_IS(interp, bc, *pc, core_ops, PARROT_OP_get_results_pc)
+    &&  !OPCODE_IS(interp, bc, *pc, core_ops, PARROT_OP_get_params_pc)
+    &&  !OPCODE_IS(interp, bc, *pc, core_ops, PARROT_OP_set_returns_pc))
+        return 0;
+
+    if (pc[1] < 0 || pc[1] >= bc->const_table->pmc.const_count)
+        return -1;
+
+    sig = bc->const_table->pmc.constants[pc[1]];
+
+    if (PMC_IS_NULL(sig) || sig->vtable->base_type != enum_class_FixedIntegerArray)
+        return -1;
+
+    n = VTABLE_elements(interp, sig);
+
+    return n < 0 || (size_t)n > room ? -1 : (opcode_t)n;
+}
+
+
+/*
+
+=item C<static int verify_arg(const PackFile_ConstTable *ct, const verify_sub_t
+*sub, INTVAL type, opcode_t arg)>
+
+Checks the argument C<arg> of type C<type>, as in C<op_info_t>, against the
+registers used by the sub C<sub>, or against the constant table C<ct>.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static int
+verify_arg(ARGIN(const PackFile_ConstTable *ct), ARGIN(const verify_sub_t *sub),
+        INTVAL type, opcode_t arg)
+{
+    ASSERT_ARGS(verify_arg)
+
+    if (type & PARROT_ARG_CONSTANT) {
+        switch (type & PARROT_ARG_TYPE_MASK) {
+          case PARROT_ARG_INTVAL:
+            return 1;
+          case PARROT_ARG_FLOATVAL:
+            return arg >= 0 && arg < ct->num.const_count;
+          case PARROT_ARG_STRING:
+            return arg >= 0 && arg < ct->str.const_count;
+          case PARROT_ARG_PMC:
+            return arg >= 0 && arg < ct->pmc.const_count;
+          default:
+            return 0;
+        }
+    }
+
+    if (arg < 0)
+        return 0;
+
+    switch (type & PARROT_ARG_TYPE_MASK) {
+      case PARROT_ARG_INTVAL:
+        return (UINTVAL)arg < sub->n_regs_used[REGNO_INT];
+      case PARROT_ARG_FLOATVAL:
+        return (UINTVAL)arg < sub->n_regs_used[REGNO_NUM];
+      case PARROT_ARG_STRING:
+        return (UINTVAL)arg < sub->n_regs_used[REGNO_STR];
+      case PARROT_ARG_PMC:
+        return (UINTVAL)arg < sub->n_regs_used[REGNO_PMC];
+      default:
+        return 0;
+    }
+}
+
+
+/*
+
+=item C<static int verify_labels(const PackFile_ByteCode *bc, const char
+*op_starts)>
+
+Checks that every constant label argument in C<bc> is the offset of an op,
+given the op starts marked by C<verify_code>.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static int
+verify_labels(ARGIN(const PackFile_ByteCode *bc), ARGIN(const char *op_starts))
+{
+    ASSERT_ARGS(verify_labels)
+    const opcode_t * const base = bc->base.data;
+    const size_t           size = bc->base.size;
+    size_t                 n;
+
+    for (n = 0; n < size; ++n) {
+        const op_info_t *info;
+        int              a;
+
+        if (!op_starts[n])
+            continue;
+
+        info = bc->op_info_table[base[n]];
+
+        for (a = 1; a < info->op_count; ++a) {
+            if (info->labels[a - 1] && info->types[a - 1] == PARROT_ARG_IC) {
+                const opcode_t target = (opcode_t)n + base[n + a];
+
+                if (target < 0 || (size_t)target >= size || !op_starts[target])
+                    return 0;
+            }
+        }
+    }
+
+    return 1;
+}
+
+
+/*
+
+=back
+
+=head1 SEE ALSO
+
+F<src/packfile/api.c>, F<examples/tools/pbc_checker.cpp>.
+
+=cut
+
+*/
+
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
@@ -195,6 +195,7 @@ Parrot_pmc_reuse(PARROT_INTERP, ARGIN(PMC *pmc), INTVAL new_type, SHIM(UINTVAL f
     /* Call the base init for the redone pmc. Warning, this should not
        be called on Object PMCs. */
     VTABLE_init(interp, pmc);
+    PARROT_GC_WRITE_BARRIER(interp, pmc);
 
     return pmc;
 }
@@ -229,6 +230,7 @@ Parrot_pmc_reuse_init(PARROT_INTERP, ARGIN(PMC *pmc), INTVAL new_type, ARGIN(PMC
     /* Call the base init for the redone pmc. Warning, this should not
        be called on Object PMCs. */
     VTABLE_init_pmc(interp, pmc, init);
+    PARROT_GC_WRITE_BARRIER(interp, pmc);
 
     return pmc;
 }
@@ -253,13 +255,16 @@ Parrot_pmc_reuse_noinit(PARROT_INTERP, ARGIN(PMC *pmc), INTVAL new_type)
     if (pmc->vtable->base_type != new_type) {
         VTABLE * const new_vtable = interp->vtables[new_type];
 
+        /* Keep the generation of the header */
+        const UINTVAL  generation = PObj_get_FLAGS(pmc) & PObj_GC_generation_FLAGS;
+
         /* Singleton/const PMCs/types are not eligible */
         check_pmc_reuse_flags(interp, pmc->vtable->flags, new_vtable->flags);
 
         /* Free the old PMC resources. */
         Parrot_pmc_destroy(interp, pmc);
 
-        PObj_flags_SETTO(pmc, PObj_is_PMC_FLAG);
+        PObj_flags_SETTO(pmc, PObj_is_PMC_FLAG | generation);
 
         /* Set the right vtable */
         pmc->vtable = new_vtable;
@@ -298,13 +303,14 @@ Parrot_pmc_reuse_by_class(PARROT_INTERP, ARGMOD(PMC *pmc), ARGIN(PMC *class_), U
 
     if (pmc->vtable->base_type != new_type) {
         VTABLE * const new_vtable = interp->vtables[new_type];
+        const UINTVAL  generation = PObj_get_FLAGS(pmc) & PObj_GC_generation_FLAGS;
 
         /* Singleton/const PMCs/types are not eligible */
         check_pmc_reuse_flags(interp, pmc->vtable->flags, new_vtable->flags);
 
         Parrot_pmc_destroy(interp, pmc);
 
-        PObj_flags_SETTO(pmc, PObj_is_PMC_FLAG | flags);
+        PObj_flags_SETTO(pmc, PObj_is_PMC_FLAG | flags | generation);
 
         /* Set the right vtable */
         pmc->vtable = new_vtable;
@@ -313,6 +319,8 @@ Parrot_pmc_reuse_by_class(PARROT_INTERP, ARGMOD(PMC *pmc), ARGIN(PMC *class_), U
             Parrot_gc_allocate_pmc_attributes(interp, pmc);
         else
             PMC_data(pmc) = NULL;
+
+        PARROT_GC_WRITE_BARRIER(interp, pmc);
     }
 
     return pmc;
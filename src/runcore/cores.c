@@ -66,6 +66,47 @@ current context for each dispatch.
       DISPATCH_OPCODE(pc);
   }
 
+Nor does the fast core switch its op function table to handle events.  The
+scheduler only sets a flag, which the core checks when a branch goes backward
+and when the context changes, on calls and returns.  A loop or a call chain
+thus can't run without seeing events, and straight-line code doesn't pay for
+checking them.
+
+=head2 Bounds Core
+
+The bounds core checks the program counter like the slow core, but only
+where control leaves straight-line code.  When a code segment is loaded, the
+core records the size of every op in it, and which positions are operands
+rather than ops.  An op which falls through to the next one can't leave the
+segment then, so the core only checks a C<pc> which is not the next op's,
+after branches, invokes and returns:
+
+  while(1) {
+      last = pc;
+      DISPATCH_OPCODE(pc);
+      if(pc != last + SIZE_OF(last))
+          if(pc < LOW_BOUND || pc > HIGH_BOUND || !OP_STARTS_AT(pc))
+              throw exception;
+  }
+
+Unlike the slow core, this also catches jumps into the operands of an op.
+
+=head2 Threaded Core
+
+The threaded core is a direct-threaded variant of the fast core. Before a
+code segment is run, each opcode in it is translated into the address of
+its handler function, stored in an array parallel to the bytecode. The
+core then dispatches with a single load from that array instead of going
+through the segment's op function table:
+
+  while(1) {
+      pc = HANDLER_AT(pc)(pc);
+  }
+
+The translation is done once per segment, when the interpreter switches
+to it or when the core first enters it, and is redone if the segment has
+grown since.
+
 =head2 Switch Core
 
 As its name implies, the switch core uses a gigantic C C<switch / case>
@@ -147,6 +188,16 @@ the actual code has been optimized quite a bit from what has been
 presented here. However, as we shall see with the precomputed goto core,
 it isn't optimized as aggressively as is possible.
 
+Parrot's computed goto core, C<cgoto>, is the function C<Parrot_cg_core()>
+which F<ops2c> generates into F<src/ops/core_ops_cg.c> from the same F<.ops>
+files as the function core. Opcode numbers in bytecode are local to their
+code segment, so rather than the core's own label array the core indexes a
+label table built per segment when it is first run. Ops of dynamic op
+libraries map to the label of C<wrapper__>, which calls their function.
+Right behind the labels the table holds an entry for every op pointing to
+C<check_events__>; C<enable_event_checking()> switches to those entries, so
+events still get handled without any check in the dispatch itself.
+
 =head2 Precomputed Goto Core
 
 The precomputed goto core is an amazingly fast optimized core that uses
@@ -250,6 +301,10 @@ next opcode, or examine and manipulate data from the executing program.
 #include "parrot/oplib/core_ops.h"
 #include "parrot/dynext.h"
 
+#ifdef PARROT_HAS_COMPUTED_GOTO
+#  include "parrot/oplib/core_ops_cg.h"
+#endif
+
 #include "pmc/pmc_sub.h"
 #include "pmc/pmc_callcontext.h"
 
@@ -257,11 +312,47 @@ next opcode, or examine and manipulate data from the executing program.
 #  define getpid _getpid
 #endif
 
+/* bounds_steps entries which aren't op sizes; an op returning its own pc
+ * runs again unchecked, which is safe as it was checked already */
+#define BOUNDS_OPERAND   -1  /* no op starts here */
+#define BOUNDS_UNCHECKED  0  /* op start, check the pc after running it */
+
 /* HEADERIZER HFILE: include/parrot/runcore_api.h */
 
 /* HEADERIZER BEGIN: static */
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 
+PARROT_CAN_RETURN_NULL
+static void * bounds_prepare_run(PARROT_INTERP,
+    SHIM(Parrot_runcore_t *runcore))
+        __attribute__nonnull__(1);
+
+static void bounds_translate(PARROT_INTERP, ARGMOD(PackFile_ByteCode *cs))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*cs);
+
+PARROT_CAN_RETURN_NULL
+static void * cgoto_prepare_run(PARROT_INTERP,
+    SHIM(Parrot_runcore_t *runcore))
+        __attribute__nonnull__(1);
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static opcode_t * runops_bounds_core(PARROT_INTERP,
+    SHIM(Parrot_runcore_t *runcore),
+    ARGIN(opcode_t *pc))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(3);
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static opcode_t * runops_cgoto_core(PARROT_INTERP,
+    SHIM(Parrot_runcore_t *runcore),
+    ARGIN(opcode_t *pc))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(3);
+
 PARROT_WARN_UNUSED_RESULT
 PARROT_CAN_RETURN_NULL
 static opcode_t * runops_debugger_core(PARROT_INTERP,
@@ -303,12 +394,43 @@ static opcode_t * runops_slow_core(PARROT_INTERP,
         __attribute__nonnull__(1)
         __attribute__nonnull__(3);
 
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static opcode_t * runops_threaded_core(PARROT_INTERP,
+    SHIM(Parrot_runcore_t *runcore),
+    ARGIN(opcode_t *pc))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(3);
+
 PARROT_WARN_UNUSED_RESULT
 PARROT_CAN_RETURN_NULL
 static opcode_t * runops_trace_core(PARROT_INTERP, ARGIN(opcode_t *pc))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
+PARROT_CAN_RETURN_NULL
+static void * threaded_prepare_run(PARROT_INTERP,
+    SHIM(Parrot_runcore_t *runcore))
+        __attribute__nonnull__(1);
+
+static void threaded_translate(PARROT_INTERP, ARGMOD(PackFile_ByteCode *cs))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*cs);
+
+#define ASSERT_ARGS_bounds_prepare_run __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_bounds_translate __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(cs))
+#define ASSERT_ARGS_cgoto_prepare_run __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_runops_bounds_core __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pc))
+#define ASSERT_ARGS_runops_cgoto_core __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pc))
 #define ASSERT_ARGS_runops_debugger_core __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(pc))
@@ -325,9 +447,17 @@ static opcode_t * runops_trace_core(PARROT_INTERP, ARGIN(opcode_t *pc))
 #define ASSERT_ARGS_runops_slow_core __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(pc))
+#define ASSERT_ARGS_runops_threaded_core __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pc))
 #define ASSERT_ARGS_runops_trace_core __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(pc))
+#define ASSERT_ARGS_threaded_prepare_run __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_threaded_translate __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(cs))
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 /* HEADERIZER END: static */
 
@@ -386,6 +516,68 @@ Parrot_runcore_fast_init(PARROT_INTERP)
     coredata->prepare_run      = NULL;
     coredata->flags            = 0;
 
+    PARROT_RUNCORE_FUNC_TABLE_SET(coredata);
+    PARROT_RUNCORE_EVENT_POLL_SET(coredata);
+
+    Parrot_runcore_register(interp, coredata);
+}
+
+
+/*
+
+=item C<void Parrot_runcore_bounds_init(PARROT_INTERP)>
+
+Registers the bounds runcore with Parrot.
+
+=cut
+
+*/
+
+void
+Parrot_runcore_bounds_init(PARROT_INTERP)
+{
+    ASSERT_ARGS(Parrot_runcore_bounds_init)
+
+    Parrot_runcore_t * const coredata = mem_gc_allocate_zeroed_typed(interp, Parrot_runcore_t);
+    coredata->name             = CONST_STRING(interp, "bounds");
+    coredata->id               = PARROT_BOUNDS_CORE;
+    coredata->opinit           = PARROT_CORE_OPLIB_INIT;
+    coredata->runops           = runops_bounds_core;
+    coredata->destroy          = NULL;
+    coredata->prepare_run      = bounds_prepare_run;
+    coredata->flags            = 0;
+
+    PARROT_RUNCORE_FUNC_TABLE_SET(coredata);
+    PARROT_RUNCORE_EVENT_POLL_SET(coredata);
+
+    Parrot_runcore_register(interp, coredata);
+}
+
+
+/*
+
+=item C<void Parrot_runcore_threaded_init(PARROT_INTERP)>
+
+Registers the threaded runcore with Parrot.
+
+=cut
+
+*/
+
+void
+Parrot_runcore_threaded_init(PARROT_INTERP)
+{
+    ASSERT_ARGS(Parrot_runcore_threaded_init)
+
+    Parrot_runcore_t * const coredata = mem_gc_allocate_zeroed_typed(interp, Parrot_runcore_t);
+    coredata->name             = CONST_STRING(interp, "threaded");
+    coredata->id               = PARROT_THREADED_CORE;
+    coredata->opinit           = PARROT_CORE_OPLIB_INIT;
+    coredata->runops           = runops_threaded_core;
+    coredata->destroy          = NULL;
+    coredata->prepare_run      = threaded_prepare_run;
+    coredata->flags            = 0;
+
     PARROT_RUNCORE_FUNC_TABLE_SET(coredata);
 
     Parrot_runcore_register(interp, coredata);
@@ -487,6 +679,8 @@ Parrot_runcore_debugger_init(PARROT_INTERP)
 
 Runs the Parrot operations starting at C<pc> until there are no more
 operations.  This performs no bounds checking, profiling, or tracing.
+Events are polled for on entry, at backward branches and when the current
+context changes.
 
 =cut
 
@@ -498,25 +692,448 @@ static opcode_t *
 runops_fast_core(PARROT_INTERP, SHIM(Parrot_runcore_t *runcore), ARGIN(opcode_t *pc))
 {
     ASSERT_ARGS(runops_fast_core)
+    PMC *ctx = CURRENT_CONTEXT(interp);
 
     /* disable pc */
-    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), NULL);
+    Parrot_pcc_set_pc(interp, ctx, NULL);
+
+    if (interp->events_pending)
+        Parrot_runcore_handle_events(interp);
 
     while (pc) {
-        /* TODO
-         * Decide do we need check here.
-         * Fast-core cause segfaults even on test suite
-        if (pc < code_start || pc >= code_end)
+        opcode_t * const prev = pc;
+
+        /* no bounds checks here; the bounds core does them where control
+         * leaves straight-line code */
+        DO_OP(pc, interp);
+
+        if (pc < prev || CURRENT_CONTEXT(interp) != ctx) {
+            ctx = CURRENT_CONTEXT(interp);
+
+            if (interp->events_pending && pc)
+                Parrot_runcore_handle_events(interp);
+        }
+    }
+
+    return pc;
+}
+
+
+/*
+
+=item C<static void bounds_translate(PARROT_INTERP, PackFile_ByteCode *cs)>
+
+Records, for every position in the code segment C<cs>, what the bounds core
+needs to know about it: the size of the op starting there, C<BOUNDS_OPERAND>
+if no op starts there, or C<BOUNDS_UNCHECKED> for an op whose fall through
+would leave the segment.  Past an unknown opcode, ops can't be told from
+operands, so every position there is C<BOUNDS_UNCHECKED>.  A segment which
+passed C<PackFile_ByteCode_verify> has no unknown opcodes and isn't checked
+for them.
+
+=cut
+
+*/
+
+static void
+bounds_translate(PARROT_INTERP, ARGMOD(PackFile_ByteCode *cs))
+{
+    ASSERT_ARGS(bounds_translate)
+    const size_t  size = cs->base.size;
+    opcode_t     *pc   = cs->base.data;
+    size_t        n    = 0;
+
+    if (cs->bounds_steps)
+        mem_gc_free(interp, cs->bounds_steps);
+
+    cs->bounds_steps = mem_gc_allocate_n_typed(interp, size, opcode_t);
+
+    while (n < size) {
+        opcode_t var_args = 0;
+        size_t   step, i;
+
+        if (!cs->verified
+        && (*pc < 0 || (size_t)*pc >= cs->op_count || !cs->op_info_table[*pc])) {
+            while (n < size)
+                cs->bounds_steps[n++] = BOUNDS_UNCHECKED;
+            break;
+        }
+
+        ADD_OP_VAR_PART(interp, cs, pc, var_args);
+        step = cs->op_info_table[*pc]->op_count + var_args;
+
+        cs->bounds_steps[n] = n + step < size ? (opcode_t)step : BOUNDS_UNCHECKED;
+
+        for (i = 1; i < step && n + i < size; ++i)
+            cs->bounds_steps[n + i] = BOUNDS_OPERAND;
+
+        n  += step;
+        pc += step;
+    }
+
+    cs->bounds_size = size;
+}
+
+
+/*
+
+=item C<static void * bounds_prepare_run(PARROT_INTERP, Parrot_runcore_t
+*runcore)>
+
+Records the op boundaries of the code segment the interpreter is about to
+run, so they are known before its first branch.
+
+=cut
+
+*/
+
+PARROT_CAN_RETURN_NULL
+static void *
+bounds_prepare_run(PARROT_INTERP, SHIM(Parrot_runcore_t *runcore))
+{
+    ASSERT_ARGS(bounds_prepare_run)
+    PackFile_ByteCode * const cs = interp->code;
+
+    if (cs && cs->base.data && cs->bounds_size != cs->base.size)
+        bounds_translate(interp, cs);
+
+    return NULL;
+}
+
+
+/*
+
+=item C<static opcode_t * runops_bounds_core(PARROT_INTERP, Parrot_runcore_t
+*runcore, opcode_t *pc)>
+
+Runs the Parrot operations starting at C<pc> until there are no more
+operations, throwing an exception if control reaches anything but the start
+of an op in the current code segment, like the slow core.  The C<pc> is only
+checked when it doesn't fall through to the next op, which the op boundaries
+recorded by C<bounds_translate> guarantee is safe; that is, on branches,
+invokes and returns.  Events are polled for there too, as in the fast core.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static opcode_t *
+runops_bounds_core(PARROT_INTERP, SHIM(Parrot_runcore_t *runcore), ARGIN(opcode_t *pc))
+{
+    ASSERT_ARGS(runops_bounds_core)
+    PMC               *ctx  = CURRENT_CONTEXT(interp);
+    PackFile_ByteCode *cs   = NULL;
+    opcode_t          *base = NULL;
+    size_t             size = 0;
+
+    /* disable pc */
+    Parrot_pcc_set_pc(interp, ctx, NULL);
+
+    if (interp->events_pending)
+        Parrot_runcore_handle_events(interp);
+
+    while (pc) {
+        opcode_t *prev;
+
+        if (interp->code != cs || base != cs->base.data || size != cs->base.size) {
+            cs = interp->code;
+
+            if (cs->bounds_size != cs->base.size)
+                bounds_translate(interp, cs);
+
+            base = cs->base.data;
+            size = cs->base.size;
+        }
+
+        if (pc < base || pc >= base + size)
             Parrot_ex_throw_from_c_args(interp, NULL, 1,
                 "attempt to access code outside of current code segment");
-        */
-        DO_OP(pc, interp);
+
+        if (cs->bounds_steps[pc - base] == BOUNDS_OPERAND)
+            Parrot_ex_throw_from_c_args(interp, NULL, 1,
+                "attempt to jump into the middle of an op");
+
+        /* straight-line code */
+        do {
+            prev = pc;
+            DO_OP(pc, interp);
+        } while (pc == prev + cs->bounds_steps[prev - base] && interp->code == cs);
+
+        if (pc && (pc < prev || CURRENT_CONTEXT(interp) != ctx)) {
+            ctx = CURRENT_CONTEXT(interp);
+
+            if (interp->events_pending)
+                Parrot_runcore_handle_events(interp);
+        }
+    }
+
+    return pc;
+}
+
+
+/*
+
+=item C<static void threaded_translate(PARROT_INTERP, PackFile_ByteCode *cs)>
+
+Translates the code segment C<cs> for the threaded core: every opcode
+position in the bytecode gets the address of its handler from the
+segment's op function table, all operand positions stay C<NULL>.  Opcodes
+are only checked if the segment didn't pass C<PackFile_ByteCode_verify>.
+
+=cut
+
+*/
+
+static void
+threaded_translate(PARROT_INTERP, ARGMOD(PackFile_ByteCode *cs))
+{
+    ASSERT_ARGS(threaded_translate)
+    const size_t  size = cs->base.size;
+    opcode_t     *pc   = cs->base.data;
+    size_t        n    = 0;
+
+    if (cs->threaded_code)
+        mem_gc_free(interp, cs->threaded_code);
+
+    cs->threaded_code = mem_gc_allocate_n_zeroed_typed(interp, size, op_func_t);
+
+    /* unverified code is only trusted as far as the ops are known; anything
+     * past an unknown opcode stays NULL and is dispatched the slow way */
+    while (n < size) {
+        opcode_t var_args = 0;
+
+        if (!cs->verified
+        && (*pc < 0 || (size_t)*pc >= cs->op_count || !cs->op_info_table[*pc]))
+            break;
+
+        cs->threaded_code[n] = cs->op_func_table[*pc];
+
+        ADD_OP_VAR_PART(interp, cs, pc, var_args);
+        n  += cs->op_info_table[*pc]->op_count + var_args;
+        pc += cs->op_info_table[*pc]->op_count + var_args;
+    }
+
+    cs->threaded_size = size;
+}
+
+
+/*
+
+=item C<static void * threaded_prepare_run(PARROT_INTERP, Parrot_runcore_t
+*runcore)>
+
+Translates the code segment the interpreter is about to run, so the cost of
+threading is paid when the segment is loaded instead of on its first
+dispatch.
+
+=cut
+
+*/
+
+PARROT_CAN_RETURN_NULL
+static void *
+threaded_prepare_run(PARROT_INTERP, SHIM(Parrot_runcore_t *runcore))
+{
+    ASSERT_ARGS(threaded_prepare_run)
+    PackFile_ByteCode * const cs = interp->code;
+
+    if (cs && cs->base.data && cs->threaded_size != cs->base.size)
+        threaded_translate(interp, cs);
+
+    return NULL;
+}
+
+
+/*
+
+=item C<static opcode_t * runops_threaded_core(PARROT_INTERP, Parrot_runcore_t
+*runcore, opcode_t *pc)>
+
+Runs the Parrot operations starting at C<pc> until there are no more
+operations, dispatching through the per-pc handler array of the current code
+segment.  Like the fast core, this does no bounds checking of its own; a
+C<pc> outside of the translated segment, or a function table replaced to
+check for events, falls back to C<DO_OP>.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static opcode_t *
+runops_threaded_core(PARROT_INTERP, SHIM(Parrot_runcore_t *runcore), ARGIN(opcode_t *pc))
+{
+    ASSERT_ARGS(runops_threaded_core)
+    PackFile_ByteCode *cs       = NULL;
+    op_func_t         *handlers = NULL;
+    opcode_t          *base     = NULL;
+    size_t             size     = 0;
+
+    /* disable pc */
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), NULL);
+
+    while (pc) {
+        op_func_t func = NULL;
+        size_t    offs;
+
+        if (interp->code != cs) {
+            cs = interp->code;
+
+            if (cs->threaded_size != cs->base.size)
+                threaded_translate(interp, cs);
+
+            handlers = cs->threaded_code;
+            base     = cs->base.data;
+            size     = cs->threaded_size;
+        }
+
+        offs = pc - base;
+
+        if (offs < size && !cs->save_func_table)
+            func = handlers[offs];
+
+        if (func)
+            pc = (func)(pc, interp);
+        else
+            DO_OP(pc, interp);
     }
 
     return pc;
 }
 
 
+#ifdef PARROT_HAS_COMPUTED_GOTO
+
+/*
+
+=item C<void Parrot_runcore_cgoto_init(PARROT_INTERP)>
+
+Registers the computed goto runcore with Parrot.
+
+=cut
+
+*/
+
+void
+Parrot_runcore_cgoto_init(PARROT_INTERP)
+{
+    ASSERT_ARGS(Parrot_runcore_cgoto_init)
+
+    Parrot_runcore_t * const coredata = mem_gc_allocate_zeroed_typed(interp, Parrot_runcore_t);
+    coredata->name             = CONST_STRING(interp, "cgoto");
+    coredata->id               = PARROT_CGOTO_CORE;
+    coredata->opinit           = PARROT_CORE_OPLIB_INIT;
+    coredata->runops           = runops_cgoto_core;
+    coredata->destroy          = NULL;
+    coredata->prepare_run      = cgoto_prepare_run;
+    coredata->flags            = 0;
+
+    PARROT_RUNCORE_FUNC_TABLE_SET(coredata);
+
+    Parrot_runcore_register(interp, coredata);
+}
+
+
+/*
+
+=item C<void Parrot_runcore_cgoto_prepare(PARROT_INTERP, PackFile_ByteCode *cs)>
+
+Builds the label table of the code segment C<cs> for the computed goto core.
+The first C<op_count> entries map the segment's opcode numbers to the labels
+of their ops in C<Parrot_cg_core()>, the second C<op_count> all point to
+C<check_events__>.  Called whenever the core enters a segment whose table
+doesn't cover all of its ops.
+
+=cut
+
+*/
+
+void
+Parrot_runcore_cgoto_prepare(PARROT_INTERP, ARGMOD(PackFile_ByteCode *cs))
+{
+    ASSERT_ARGS(Parrot_runcore_cgoto_prepare)
+    void * const * const labels   = (void * const *)Parrot_cg_core(NULL, interp);
+    const op_lib_t * const core_lib = PARROT_GET_CORE_OPLIB(interp);
+    const size_t         n        = cs->op_count;
+    size_t               i;
+
+    if (cs->cg_ops_table)
+        mem_gc_free(interp, cs->cg_ops_table);
+
+    cs->cg_ops_table = mem_gc_allocate_n_typed(interp, 2 * n, void *);
+
+    for (i = 0; i < n; ++i) {
+        const op_info_t * const info = cs->op_info_table[i];
+
+        cs->cg_ops_table[i]     = info && info->lib == core_lib
+                                ? labels[info - core_lib->op_info_table]
+                                : labels[PARROT_OP_wrapper__];
+        cs->cg_ops_table[n + i] = labels[PARROT_OP_check_events__];
+    }
+
+    cs->cg_op_count = n;
+    cs->cg_ops_addr = cs->save_func_table
+                    ? cs->cg_ops_table + n
+                    : cs->cg_ops_table;
+}
+
+
+/*
+
+=item C<static void * cgoto_prepare_run(PARROT_INTERP, Parrot_runcore_t
+*runcore)>
+
+Builds the label table of the code segment the interpreter is about to run.
+
+=cut
+
+*/
+
+PARROT_CAN_RETURN_NULL
+static void *
+cgoto_prepare_run(PARROT_INTERP, SHIM(Parrot_runcore_t *runcore))
+{
+    ASSERT_ARGS(cgoto_prepare_run)
+    PackFile_ByteCode * const cs = interp->code;
+
+    if (cs && cs->cg_op_count != cs->op_count)
+        Parrot_runcore_cgoto_prepare(interp, cs);
+
+    return NULL;
+}
+
+
+/*
+
+=item C<static opcode_t * runops_cgoto_core(PARROT_INTERP, Parrot_runcore_t
+*runcore, opcode_t *pc)>
+
+Runs the Parrot operations starting at C<pc> in C<Parrot_cg_core()>, which
+only returns once there are no more operations to run.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static opcode_t *
+runops_cgoto_core(PARROT_INTERP, SHIM(Parrot_runcore_t *runcore), ARGIN(opcode_t *pc))
+{
+    ASSERT_ARGS(runops_cgoto_core)
+
+    /* disable pc */
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), NULL);
+
+    return Parrot_cg_core(pc, interp);
+}
+
+#endif /* PARROT_HAS_COMPUTED_GOTO */
+
+
 #ifdef code_start
 #  undef code_start
 #endif
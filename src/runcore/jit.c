@@ -0,0 +1,1702 @@
+/*
+Copyright (C) 2011, Parrot Foundation.
+
+=head1 NAME
+
+src/runcore/jit.c - Parrot's tracing JIT runcore
+
+=head1 DESCRIPTION
+
+The jit core runs like the fast core, and compiles hot loops of integer and
+float register ops to native x86-64 code.
+
+Every backward branch counts the entries of the loop header it jumps to.
+Once a header has been entered C<PARROT_JIT_HOT_LOOP> times, the core records
+the next iteration of the loop: it runs the ops one by one, noting each op
+and the direction every conditional branch took, until it is back at the
+header.  The recorded trace is compiled into a native loop, which is entered
+from then on instead of interpreting the loop.
+
+Only ops from the core op library whose arguments are all C<I> or C<N>
+registers and constants can be compiled: the arithmetic ops of F<math.ops>,
+the comparisons of F<cmp.ops>, C<set> and C<null>, and the branches
+C<if>, C<unless> and C<branch>.  A loop with any other op in it, such as one
+touching a PMC or a string, is never traced.  The native code keeps the
+registers of the context in memory, so it needs no deoptimization: leaving a
+trace is returning the pc to resume interpreting at.  Traces are left
+
+=over 4
+
+=item * where a conditional branch goes the other way than it did when the
+trace was recorded,
+
+=item * before an op which would throw an exception, like an integer division
+by zero, so the interpreter runs the op and throws,
+
+=item * at the end of an iteration, if events are pending.
+
+=back
+
+=head2 Functions
+
+=over 4
+
+=cut
+
+*/
+
+#include "parrot/runcore_api.h"
+#include "parrot/runcore_jit.h"
+#include "parrot/oplib/core_ops.h"
+#include "jit.str"
+
+/* HEADERIZER HFILE: include/parrot/runcore_jit.h */
+
+/* native registers used by traces */
+#define JIT_RAX 0
+#define JIT_RCX 1
+#define JIT_RDX 2
+#define JIT_RBX 3
+#define JIT_RBP 5
+
+/* condition codes of jcc and setcc; flipping the low bit negates one */
+#define JIT_CC_B   0x2
+#define JIT_CC_AE  0x3
+#define JIT_CC_E   0x4
+#define JIT_CC_NE  0x5
+#define JIT_CC_A   0x7
+#define JIT_CC_P   0xA
+#define JIT_CC_NP  0xB
+#define JIT_CC_L   0xC
+#define JIT_CC_LE  0xE
+#define JIT_CC_G   0xF
+
+#define JIT_IS_INT(t) (((t) & ~PARROT_ARG_CONSTANT) == PARROT_ARG_INTVAL)
+#define JIT_IS_NUM(t) (((t) & ~PARROT_ARG_CONSTANT) == PARROT_ARG_FLOATVAL)
+
+/* one op of a recorded trace */
+typedef struct jit_trace_op {
+    opcode_t *pc;
+    int       taken;        /* did the op branch, rather than fall through */
+} Jit_trace_op;
+
+/* a jump to a side exit, patched once the exit stubs are placed */
+typedef struct jit_exit {
+    size_t    at;           /* offset of the rel32 to patch */
+    const opcode_t *pc;     /* where the interpreter resumes */
+} Jit_exit;
+
+/* native code being emitted */
+typedef struct jit_buffer {
+    unsigned char *code;
+    size_t         size;
+    size_t         alloc;
+    Jit_exit      *exits;
+    size_t         n_exits;
+    size_t         alloc_exits;
+} Jit_buffer;
+
+/* HEADERIZER BEGIN: static */
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static Parrot_jit_trace_fn jit_compile(PARROT_INTERP,
+    ARGIN(PackFile_ByteCode *code),
+    ARGIN(const Jit_trace_op *trace),
+    size_t n,
+    ARGOUT(size_t *size))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(5)
+        FUNC_MODIFIES(*size);
+
+static void jit_emit(PARROT_INTERP,
+    ARGMOD(Jit_buffer *buf),
+    ARGIN(const unsigned char *bytes),
+    size_t n)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*buf);
+
+PARROT_WARN_UNUSED_RESULT
+static int jit_emit_arith(PARROT_INTERP,
+    ARGMOD(Jit_buffer *buf),
+    ARGIN(const op_info_t *info),
+    ARGIN(const opcode_t *pc))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4)
+        FUNC_MODIFIES(*buf);
+
+static void jit_emit_byte(PARROT_INTERP,
+    ARGMOD(Jit_buffer *buf),
+    unsigned char byte)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*buf);
+
+static void jit_emit_call(PARROT_INTERP,
+    ARGMOD(Jit_buffer *buf),
+    ARGIN(void *fn))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*buf);
+
+PARROT_WARN_UNUSED_RESULT
+static int jit_emit_cmp_branch(PARROT_INTERP,
+    ARGMOD(Jit_buffer *buf),
+    ARGIN(const op_info_t *info),
+    ARGIN(const opcode_t *pc),
+    int taken)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4)
+        FUNC_MODIFIES(*buf);
+
+static void jit_emit_cmp_int(PARROT_INTERP,
+    ARGMOD(Jit_buffer *buf),
+    ARGIN(const op_info_t *info),
+    ARGIN(const opcode_t *pc))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4)
+        FUNC_MODIFIES(*buf);
+
+PARROT_WARN_UNUSED_RESULT
+static int jit_emit_cmp_set(PARROT_INTERP,
+    ARGMOD(Jit_buffer *buf),
+    ARGIN(const op_info_t *info),
+    ARGIN(const opcode_t *pc))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4)
+        FUNC_MODIFIES(*buf);
+
+static void jit_emit_exit(PARROT_INTERP,
+    ARGMOD(Jit_buffer *buf),
+    int cc,
+    ARGIN(const opcode_t *pc))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(4)
+        FUNC_MODIFIES(*buf);
+
+static void jit_emit_int32(PARROT_INTERP,
+    ARGMOD(Jit_buffer *buf),
+    int value)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*buf);
+
+static void jit_emit_is_zero(PARROT_INTERP,
+    ARGMOD(Jit_buffer *buf),
+    ARGIN(const op_info_t *info),
+    ARGIN(const opcode_t *pc),
+    int arg)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4)
+        FUNC_MODIFIES(*buf);
+
+static void jit_emit_mem(PARROT_INTERP,
+    ARGMOD(Jit_buffer *buf),
+    int op,
+    int reg,
+    int base,
+    INTVAL disp)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*buf);
+
+static void jit_emit_modrm_disp(PARROT_INTERP,
+    ARGMOD(Jit_buffer *buf),
+    int reg,
+    int base,
+    INTVAL disp)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*buf);
+
+static void jit_emit_mov_imm(PARROT_INTERP,
+    ARGMOD(Jit_buffer *buf),
+    int reg,
+    INTVAL value)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*buf);
+
+static void jit_emit_movq_from_xmm(PARROT_INTERP,
+    ARGMOD(Jit_buffer *buf),
+    int xmm)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*buf);
+
+static void jit_emit_movq_to_xmm(PARROT_INTERP,
+    ARGMOD(Jit_buffer *buf),
+    int xmm)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*buf);
+
+PARROT_WARN_UNUSED_RESULT
+static int jit_emit_op(PARROT_INTERP,
+    ARGIN(PackFile_ByteCode *code),
+    ARGMOD(Jit_buffer *buf),
+    ARGIN(const opcode_t *pc),
+    int taken)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4)
+        FUNC_MODIFIES(*buf);
+
+static void jit_emit_setcc(PARROT_INTERP,
+    ARGMOD(Jit_buffer *buf),
+    int cc,
+    int reg)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*buf);
+
+static void jit_emit_sse(PARROT_INTERP, ARGMOD(Jit_buffer *buf), int op)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*buf);
+
+static void jit_emit_ucomisd(PARROT_INTERP,
+    ARGMOD(Jit_buffer *buf),
+    ARGIN(const op_info_t *info),
+    ARGIN(const opcode_t *pc),
+    int x,
+    int y)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4)
+        FUNC_MODIFIES(*buf);
+
+static void jit_emit_ucomisd_regs(PARROT_INTERP,
+    ARGMOD(Jit_buffer *buf),
+    int x,
+    int y)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*buf);
+
+static void jit_load_int(PARROT_INTERP,
+    ARGMOD(Jit_buffer *buf),
+    int reg,
+    ARGIN(const op_info_t *info),
+    ARGIN(const opcode_t *pc),
+    int arg)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(4)
+        __attribute__nonnull__(5)
+        FUNC_MODIFIES(*buf);
+
+static void jit_load_num(PARROT_INTERP,
+    ARGMOD(Jit_buffer *buf),
+    int xmm,
+    ARGIN(const op_info_t *info),
+    ARGIN(const opcode_t *pc),
+    int arg)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(4)
+        __attribute__nonnull__(5)
+        FUNC_MODIFIES(*buf);
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static opcode_t * jit_loop_entered(PARROT_INTERP, ARGIN(opcode_t *pc))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+PARROT_WARN_UNUSED_RESULT
+static int jit_op_traceable(PARROT_INTERP,
+    ARGIN(const PackFile_ByteCode *code),
+    ARGIN(const opcode_t *pc))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static opcode_t * jit_record(PARROT_INTERP,
+    ARGIN(PackFile_ByteCode *code),
+    ARGMOD(Parrot_jit_loop *loop),
+    ARGIN(opcode_t *header))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4)
+        FUNC_MODIFIES(*loop);
+
+static void jit_store_int(PARROT_INTERP,
+    ARGMOD(Jit_buffer *buf),
+    int reg,
+    ARGIN(const opcode_t *pc),
+    int arg)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(4)
+        FUNC_MODIFIES(*buf);
+
+static void jit_store_num(PARROT_INTERP,
+    ARGMOD(Jit_buffer *buf),
+    int xmm,
+    ARGIN(const opcode_t *pc),
+    int arg)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(4)
+        FUNC_MODIFIES(*buf);
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static opcode_t * runops_jit_core(PARROT_INTERP,
+    SHIM(Parrot_runcore_t *runcore),
+    ARGIN(opcode_t *pc))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(3);
+
+#define ASSERT_ARGS_jit_compile __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(code) \
+    , PARROT_ASSERT_ARG(trace) \
+    , PARROT_ASSERT_ARG(size))
+#define ASSERT_ARGS_jit_emit __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(buf) \
+    , PARROT_ASSERT_ARG(bytes))
+#define ASSERT_ARGS_jit_emit_arith __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(buf) \
+    , PARROT_ASSERT_ARG(info) \
+    , PARROT_ASSERT_ARG(pc))
+#define ASSERT_ARGS_jit_emit_byte __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(buf))
+#define ASSERT_ARGS_jit_emit_call __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(buf) \
+    , PARROT_ASSERT_ARG(fn))
+#define ASSERT_ARGS_jit_emit_cmp_branch __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(buf) \
+    , PARROT_ASSERT_ARG(info) \
+    , PARROT_ASSERT_ARG(pc))
+#define ASSERT_ARGS_jit_emit_cmp_int __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(buf) \
+    , PARROT_ASSERT_ARG(info) \
+    , PARROT_ASSERT_ARG(pc))
+#define ASSERT_ARGS_jit_emit_cmp_set __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(buf) \
+    , PARROT_ASSERT_ARG(info) \
+    , PARROT_ASSERT_ARG(pc))
+#define ASSERT_ARGS_jit_emit_exit __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(buf) \
+    , PARROT_ASSERT_ARG(pc))
+#define ASSERT_ARGS_jit_emit_int32 __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(buf))
+#define ASSERT_ARGS_jit_emit_is_zero __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(buf) \
+    , PARROT_ASSERT_ARG(info) \
+    , PARROT_ASSERT_ARG(pc))
+#define ASSERT_ARGS_jit_emit_mem __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(buf))
+#define ASSERT_ARGS_jit_emit_modrm_disp __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(buf))
+#define ASSERT_ARGS_jit_emit_mov_imm __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(buf))
+#define ASSERT_ARGS_jit_emit_movq_from_xmm __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(buf))
+#define ASSERT_ARGS_jit_emit_movq_to_xmm __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(buf))
+#define ASSERT_ARGS_jit_emit_op __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(code) \
+    , PARROT_ASSERT_ARG(buf) \
+    , PARROT_ASSERT_ARG(pc))
+#define ASSERT_ARGS_jit_emit_setcc __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(buf))
+#define ASSERT_ARGS_jit_emit_sse __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(buf))
+#define ASSERT_ARGS_jit_emit_ucomisd __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(buf) \
+    , PARROT_ASSERT_ARG(info) \
+    , PARROT_ASSERT_ARG(pc))
+#define ASSERT_ARGS_jit_emit_ucomisd_regs __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(buf))
+#define ASSERT_ARGS_jit_load_int __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(buf) \
+    , PARROT_ASSERT_ARG(info) \
+    , PARROT_ASSERT_ARG(pc))
+#define ASSERT_ARGS_jit_load_num __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(buf) \
+    , PARROT_ASSERT_ARG(info) \
+    , PARROT_ASSERT_ARG(pc))
+#define ASSERT_ARGS_jit_loop_entered __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pc))
+#define ASSERT_ARGS_jit_op_traceable __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(code) \
+    , PARROT_ASSERT_ARG(pc))
+#define ASSERT_ARGS_jit_record __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(code) \
+    , PARROT_ASSERT_ARG(loop) \
+    , PARROT_ASSERT_ARG(header))
+#define ASSERT_ARGS_jit_store_int __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(buf) \
+    , PARROT_ASSERT_ARG(pc))
+#define ASSERT_ARGS_jit_store_num __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(buf) \
+    , PARROT_ASSERT_ARG(pc))
+#define ASSERT_ARGS_runops_jit_core __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pc))
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+/* HEADERIZER END: static */
+
+
+/*
+
+=item C<void Parrot_runcore_jit_init(PARROT_INTERP)>
+
+Registers the jit runcore with Parrot.
+
+=cut
+
+*/
+
+void
+Parrot_runcore_jit_init(PARROT_INTERP)
+{
+    ASSERT_ARGS(Parrot_runcore_jit_init)
+
+    Parrot_runcore_t * const coredata = mem_gc_allocate_zeroed_typed(interp, Parrot_runcore_t);
+    coredata->name             = CONST_STRING(interp, "jit");
+    coredata->id               = PARROT_JIT_CORE;
+    coredata->opinit           = PARROT_CORE_OPLIB_INIT;
+    coredata->runops           = runops_jit_core;
+    coredata->destroy          = NULL;
+    coredata->prepare_run      = NULL;
+    coredata->flags            = 0;
+
+    PARROT_RUNCORE_FUNC_TABLE_SET(coredata);
+    PARROT_RUNCORE_EVENT_POLL_SET(coredata);
+
+    Parrot_runcore_register(interp, coredata);
+}
+
+
+/*
+
+=item C<void Parrot_jit_destroy_loops(PARROT_INTERP, PackFile_ByteCode *code)>
+
+Frees the loop counters and native traces of the code segment C<code>.
+
+=cut
+
+*/
+
+void
+Parrot_jit_destroy_loops(PARROT_INTERP, ARGMOD(PackFile_ByteCode *code))
+{
+    ASSERT_ARGS(Parrot_jit_destroy_loops)
+    size_t i;
+
+    for (i = 0; i < code->jit_loops_size; ++i) {
+        Parrot_jit_loop * const loop = code->jit_loops[i];
+
+        if (!loop)
+            continue;
+
+        if (loop->code)
+            mem_free_executable(F2DPTR(loop->code), loop->code_size);
+
+        mem_gc_free(interp, loop);
+    }
+
+    mem_gc_free(interp, code->jit_loops);
+    code->jit_loops      = NULL;
+    code->jit_loops_size = 0;
+}
+
+
+/*
+
+=item C<static opcode_t * runops_jit_core(PARROT_INTERP, Parrot_runcore_t
+*runcore, opcode_t *pc)>
+
+Runs the Parrot operations starting at C<pc> until there are no more
+operations, like the fast core, polling for events the same way.  Every
+backward branch is handed to C<jit_loop_entered>, which may run the loop
+natively.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static opcode_t *
+runops_jit_core(PARROT_INTERP, SHIM(Parrot_runcore_t *runcore), ARGIN(opcode_t *pc))
+{
+    ASSERT_ARGS(runops_jit_core)
+    PMC *ctx = CURRENT_CONTEXT(interp);
+
+    /* disable pc */
+    Parrot_pcc_set_pc(interp, ctx, NULL);
+
+    if (interp->events_pending)
+        Parrot_runcore_handle_events(interp);
+
+    while (pc) {
+        opcode_t * const prev = pc;
+
+        DO_OP(pc, interp);
+
+        if (pc < prev || CURRENT_CONTEXT(interp) != ctx) {
+            ctx = CURRENT_CONTEXT(interp);
+
+            if (!pc)
+                break;
+
+            if (interp->events_pending)
+                Parrot_runcore_handle_events(interp);
+            else if (pc < prev)
+                pc = jit_loop_entered(interp, pc);
+        }
+    }
+
+    return pc;
+}
+
+
+/*
+
+=item C<static opcode_t * jit_loop_entered(PARROT_INTERP, opcode_t *pc)>
+
+Counts an entry of the loop header at C<pc>, reached by a backward branch.
+Runs the native trace of the loop if there is one, records and compiles the
+trace if the loop just became hot, and returns the pc to go on interpreting
+at.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static opcode_t *
+jit_loop_entered(PARROT_INTERP, ARGIN(opcode_t *pc))
+{
+    ASSERT_ARGS(jit_loop_entered)
+    PackFile_ByteCode * const code = interp->code;
+    Parrot_jit_loop          *loop;
+    size_t                    offset;
+
+    /* child interpreters share code segments, and events are handled by
+     * the interpreter */
+    if (interp->parent_interpreter || !code
+    ||  interp->events_pending || code->save_func_table
+    ||  pc < code->base.data || pc >= code->base.data + code->base.size)
+        return pc;
+
+    offset = pc - code->base.data;
+
+    /* IMCC appends to the segment it runs */
+    if (offset >= code->jit_loops_size) {
+        const size_t size = code->base.size;
+
+        if (code->jit_loops)
+            code->jit_loops = mem_gc_realloc_n_typed_zeroed(interp,
+                    code->jit_loops, size, code->jit_loops_size, Parrot_jit_loop *);
+        else
+            code->jit_loops = mem_gc_allocate_n_zeroed_typed(interp, size,
+                    Parrot_jit_loop *);
+
+        code->jit_loops_size = size;
+    }
+
+    loop = code->jit_loops[offset];
+
+    if (!loop)
+        loop = code->jit_loops[offset] = mem_gc_allocate_zeroed_typed(interp, Parrot_jit_loop);
+
+    /* the exits of a trace are absolute, so it's only valid as long as the
+     * bytecode stays where it was compiled */
+    if (loop->code && loop->header != pc) {
+        mem_free_executable(F2DPTR(loop->code), loop->code_size);
+        loop->code  = NULL;
+        loop->count = 0;
+    }
+
+    if (loop->code) {
+        Regs_ni * const regs = Parrot_pcc_get_regs_ni(interp, CURRENT_CONTEXT(interp));
+        return (loop->code)(regs->regs_i, regs->regs_n);
+    }
+
+    if (loop->count < 0 || ++loop->count < PARROT_JIT_HOT_LOOP)
+        return pc;
+
+    return jit_record(interp, code, loop, pc);
+}
+
+
+/*
+
+=item C<static opcode_t * jit_record(PARROT_INTERP, PackFile_ByteCode *code,
+Parrot_jit_loop *loop, opcode_t *header)>
+
+Runs one iteration of the loop at C<header>, recording its ops, and compiles
+the trace if the iteration came back to the header with only ops which can
+be compiled.  Otherwise the loop is marked as not traceable.  Returns the pc
+to go on interpreting at.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static opcode_t *
+jit_record(PARROT_INTERP, ARGIN(PackFile_ByteCode *code),
+        ARGMOD(Parrot_jit_loop *loop), ARGIN(opcode_t *header))
+{
+    ASSERT_ARGS(jit_record)
+    Jit_trace_op  trace[PARROT_JIT_MAX_TRACE];
+    size_t        n  = 0;
+    opcode_t     *pc = header;
+
+    do {
+        const op_info_t *info;
+        opcode_t        *next;
+
+        /* try again later, once the events are handled */
+        if (interp->events_pending || code->save_func_table) {
+            loop->count = 0;
+            return pc;
+        }
+
+        if (n == PARROT_JIT_MAX_TRACE
+        ||  pc < code->base.data || pc >= code->base.data + code->base.size
+        ||  !jit_op_traceable(interp, code, pc)) {
+            loop->count = -1;
+            return pc;
+        }
+
+        info        = code->op_info_table[*pc];
+        next        = pc + info->op_count;
+        trace[n].pc = pc;
+
+        DO_OP(pc, interp);
+
+        trace[n++].taken = pc != next;
+    } while (pc != header);
+
+    loop->code = jit_compile(interp, code, trace, n, &loop->code_size);
+
+    if (loop->code)
+        loop->header = header;
+    else
+        loop->count = -1;
+
+    return pc;
+}
+
+
+/*
+
+=item C<static int jit_op_traceable(PARROT_INTERP, const PackFile_ByteCode
+*code, const opcode_t *pc)>
+
+Returns whether the op at C<pc> can be compiled: it must be one of the core
+ops handled by C<jit_emit_op>, and all its arguments must be C<I> or C<N>
+registers or constants.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static int
+jit_op_traceable(PARROT_INTERP, ARGIN(const PackFile_ByteCode *code), ARGIN(const opcode_t *pc))
+{
+    ASSERT_ARGS(jit_op_traceable)
+    static const char * const names[] = {
+        "set", "null", "add", "sub", "mul", "div", "mod", "inc", "dec", "neg",
+        "eq", "ne", "lt", "le", "if", "unless", "branch",
+        "iseq", "isne", "islt", "isle", "cmp"
+    };
+    const op_info_t *info;
+    size_t           i;
+    int              arg;
+
+    if (*pc < 0 || (size_t)*pc >= code->op_count)
+        return 0;
+
+    info = code->op_info_table[*pc];
+
+    if (!info || info->lib != PARROT_GET_CORE_OPLIB(interp))
+        return 0;
+
+    for (arg = 0; arg < info->op_count - 1; ++arg)
+        if (!JIT_IS_INT(info->types[arg]) && !JIT_IS_NUM(info->types[arg]))
+            return 0;
+
+    for (i = 0; i < sizeof (names) / sizeof (*names); ++i)
+        if (STREQ(info->name, names[i]))
+            return 1;
+
+    return 0;
+}
+
+
+/*
+
+=item C<static Parrot_jit_trace_fn jit_compile(PARROT_INTERP, PackFile_ByteCode
+*code, const Jit_trace_op *trace, size_t n, size_t *size)>
+
+Compiles the C<n> ops of C<trace> into a native loop, storing the size of the
+code in C<size>.  Returns NULL if an op can't be compiled.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static Parrot_jit_trace_fn
+jit_compile(PARROT_INTERP, ARGIN(PackFile_ByteCode *code),
+        ARGIN(const Jit_trace_op *trace), size_t n, ARGOUT(size_t *size))
+{
+    ASSERT_ARGS(jit_compile)
+    static const unsigned char prologue[] = {
+        0x53,                           /* push rbx */
+        0x55,                           /* push rbp */
+        0x48, 0x83, 0xEC, 0x08,         /* sub rsp, 8 */
+        0x48, 0x89, 0xFB,               /* mov rbx, rdi */
+        0x48, 0x89, 0xF5                /* mov rbp, rsi */
+    };
+    static const unsigned char epilogue[] = {
+        0x48, 0x83, 0xC4, 0x08,         /* add rsp, 8 */
+        0x5D,                           /* pop rbp */
+        0x5B,                           /* pop rbx */
+        0xC3                            /* ret */
+    };
+    Jit_buffer  buf;
+    size_t      loop_start, i;
+    void       *native;
+    int         ok = 1;
+
+    memset(&buf, 0, sizeof (buf));
+
+    jit_emit(interp, &buf, prologue, sizeof (prologue));
+    loop_start = buf.size;
+
+    for (i = 0; ok && i < n; ++i)
+        ok = jit_emit_op(interp, code, &buf, trace[i].pc, trace[i].taken);
+
+    if (ok) {
+        static const unsigned char poll[] = {
+            0x48, 0x8B, 0x00,           /* mov rax, [rax] */
+            0x48, 0x85, 0xC0            /* test rax, rax */
+        };
+
+        /* leave at the header for the interpreter to handle events */
+        jit_emit_mov_imm(interp, &buf, JIT_RAX, (INTVAL)PTR2UINTVAL(&interp->events_pending));
+        jit_emit(interp, &buf, poll, sizeof (poll));
+        jit_emit_exit(interp, &buf, JIT_CC_NE, trace[0].pc);
+
+        jit_emit_byte(interp, &buf, 0xE9);  /* jmp loop_start */
+        jit_emit_int32(interp, &buf, (int)loop_start - (int)(buf.size + 4));
+
+        for (i = 0; i < buf.n_exits; ++i) {
+            const Jit_exit * const e   = buf.exits + i;
+            const int              rel = (int)(buf.size - (e->at + 4));
+
+            memcpy(buf.code + e->at, &rel, 4);
+            jit_emit_mov_imm(interp, &buf, JIT_RAX, (INTVAL)PTR2UINTVAL(e->pc));
+            jit_emit(interp, &buf, epilogue, sizeof (epilogue));
+        }
+
+        native = mem_alloc_executable(buf.size);
+
+        if (native) {
+            memcpy(native, buf.code, buf.size);
+            *size = buf.size;
+        }
+    }
+
+    if (buf.code)
+        mem_gc_free(interp, buf.code);
+    if (buf.exits)
+        mem_gc_free(interp, buf.exits);
+
+    if (!ok || !native)
+        return NULL;
+
+    return (Parrot_jit_trace_fn)D2FPTR(native);
+}
+
+
+/*
+
+=item C<static int jit_emit_op(PARROT_INTERP, PackFile_ByteCode *code,
+Jit_buffer *buf, const opcode_t *pc, int taken)>
+
+Emits the native code of the op at C<pc>.  C<taken> tells whether the op
+branched when the trace was recorded, for conditional branches to leave the
+trace when they go the other way.  Returns 0 if the op can't be compiled.
+
+Integer registers are addressed off C<rbx>, float registers off C<rbp>;
+C<rax>, C<rcx>, C<rdx>, C<xmm0> and C<xmm1> are scratch.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static int
+jit_emit_op(PARROT_INTERP, ARGIN(PackFile_ByteCode *code), ARGMOD(Jit_buffer *buf),
+        ARGIN(const opcode_t *pc), int taken)
+{
+    ASSERT_ARGS(jit_emit_op)
+    const op_info_t * const info  = code->op_info_table[*pc];
+    const char      * const name  = info->name;
+    const int               nargs = info->op_count - 1;
+    const arg_type_t * const t    = info->types;
+
+    /* the recorded direction of a branch to a register isn't fixed */
+    if (STREQ(name, "branch"))
+        return t[0] == PARROT_ARG_IC;
+
+    if (STREQ(name, "set")) {
+        if (JIT_IS_INT(t[0])) {
+            if (JIT_IS_INT(t[1]))
+                jit_load_int(interp, buf, JIT_RAX, info, pc, 1);
+            else {
+                static const unsigned char cvttsd2si[] = { 0xF2, 0x48, 0x0F, 0x2C, 0xC0 };
+                jit_load_num(interp, buf, 0, info, pc, 1);
+                jit_emit(interp, buf, cvttsd2si, sizeof (cvttsd2si));
+            }
+            jit_store_int(interp, buf, JIT_RAX, pc, 0);
+        }
+        else {
+            if (JIT_IS_NUM(t[1]))
+                jit_load_num(interp, buf, 0, info, pc, 1);
+            else {
+                static const unsigned char cvtsi2sd[] = { 0xF2, 0x48, 0x0F, 0x2A, 0xC0 };
+                jit_load_int(interp, buf, JIT_RAX, info, pc, 1);
+                jit_emit(interp, buf, cvtsi2sd, sizeof (cvtsi2sd));
+            }
+            jit_store_num(interp, buf, 0, pc, 0);
+        }
+        return 1;
+    }
+
+    if (STREQ(name, "null")) {
+        static const unsigned char xor_eax[] = { 0x31, 0xC0 };
+        jit_emit(interp, buf, xor_eax, sizeof (xor_eax));
+        if (JIT_IS_INT(t[0]))
+            jit_store_int(interp, buf, JIT_RAX, pc, 0);
+        else
+            jit_emit_mem(interp, buf, 0x89, JIT_RAX, JIT_RBP, -8 * (pc[1] + 1));
+        return 1;
+    }
+
+    if (STREQ(name, "add") || STREQ(name, "sub") || STREQ(name, "mul")
+    ||  STREQ(name, "div") || STREQ(name, "mod"))
+        return jit_emit_arith(interp, buf, info, pc);
+
+    if (STREQ(name, "inc") || STREQ(name, "dec")) {
+        const int inc = STREQ(name, "inc");
+
+        if (JIT_IS_INT(t[0])) {
+            /* add/sub qword [rbx + disp], 1 */
+            jit_emit_mem(interp, buf, 0x83, inc ? 0 : 5, JIT_RBX, 8 * pc[1]);
+            jit_emit_byte(interp, buf, 0x01);
+        }
+        else {
+            const FLOATVAL one = 1.0;
+            INTVAL         bits;
+
+            memcpy(&bits, &one, sizeof (bits));
+            jit_load_num(interp, buf, 0, info, pc, 0);
+            jit_emit_mov_imm(interp, buf, JIT_RAX, bits);
+            jit_emit_movq_to_xmm(interp, buf, 1);
+            jit_emit_sse(interp, buf, inc ? 0x58 : 0x5C);
+            jit_store_num(interp, buf, 0, pc, 0);
+        }
+        return 1;
+    }
+
+    if (STREQ(name, "neg")) {
+        const int src = nargs - 1;
+
+        if (JIT_IS_INT(t[0])) {
+            static const unsigned char neg[] = { 0x48, 0xF7, 0xD8 };
+            jit_load_int(interp, buf, JIT_RAX, info, pc, src);
+            jit_emit(interp, buf, neg, sizeof (neg));
+            jit_store_int(interp, buf, JIT_RAX, pc, 0);
+        }
+        else {
+            /* flip the sign bit, so -0.0 comes out as the C op makes it */
+            static const unsigned char btc[] = { 0x48, 0x0F, 0xBA, 0xF8, 0x3F };
+            jit_load_num(interp, buf, 0, info, pc, src);
+            jit_emit_movq_from_xmm(interp, buf, 0);
+            jit_emit(interp, buf, btc, sizeof (btc));
+            jit_emit_mem(interp, buf, 0x89, JIT_RAX, JIT_RBP, -8 * (pc[1] + 1));
+        }
+        return 1;
+    }
+
+    if (STREQ(name, "if") || STREQ(name, "unless")) {
+        const int       cc     = STREQ(name, "if") ? JIT_CC_NE : JIT_CC_E;
+        const opcode_t *target = pc + pc[2];
+        const opcode_t *next   = pc + info->op_count;
+
+        jit_emit_is_zero(interp, buf, info, pc, 0);
+        jit_emit_exit(interp, buf, taken ? cc ^ 1 : cc, taken ? next : target);
+        return 1;
+    }
+
+    if (STREQ(name, "eq") || STREQ(name, "ne")
+    ||  STREQ(name, "lt") || STREQ(name, "le"))
+        return jit_emit_cmp_branch(interp, buf, info, pc, taken);
+
+    if (STREQ(name, "iseq") || STREQ(name, "isne")
+    ||  STREQ(name, "islt") || STREQ(name, "isle") || STREQ(name, "cmp"))
+        return jit_emit_cmp_set(interp, buf, info, pc);
+
+    return 0;
+}
+
+
+/*
+
+=item C<static int jit_emit_arith(PARROT_INTERP, Jit_buffer *buf, const
+op_info_t *info, const opcode_t *pc)>
+
+Emits C<add>, C<sub>, C<mul>, C<div> or C<mod>, in their two and three
+argument forms.  Divisions leave the trace before dividing by zero, and
+before the integer division overflowing on C<-1>, for the op to handle those
+cases.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static int
+jit_emit_arith(PARROT_INTERP, ARGMOD(Jit_buffer *buf), ARGIN(const op_info_t *info),
+        ARGIN(const opcode_t *pc))
+{
+    ASSERT_ARGS(jit_emit_arith)
+    const char      * const name = info->name;
+    const arg_type_t * const t   = info->types;
+    const int         a          = info->op_count == 4 ? 1 : 0;
+    const int         b          = a + 1;
+
+    if (JIT_IS_INT(t[0]) && JIT_IS_INT(t[a]) && JIT_IS_INT(t[b])) {
+        if (STREQ(name, "div")) {
+            static const unsigned char test_rcx[]  = { 0x48, 0x85, 0xC9 };
+            static const unsigned char cmp_rcx_m1[] = { 0x48, 0x83, 0xF9, 0xFF };
+            static const unsigned char idiv[]      = { 0x48, 0x99, 0x48, 0xF7, 0xF9 };
+
+            jit_load_int(interp, buf, JIT_RCX, info, pc, b);
+            jit_emit(interp, buf, test_rcx, sizeof (test_rcx));
+            jit_emit_exit(interp, buf, JIT_CC_E, pc);
+            jit_emit(interp, buf, cmp_rcx_m1, sizeof (cmp_rcx_m1));
+            jit_emit_exit(interp, buf, JIT_CC_E, pc);
+            jit_load_int(interp, buf, JIT_RAX, info, pc, a);
+            jit_emit(interp, buf, idiv, sizeof (idiv));
+        }
+        else if (STREQ(name, "mod")) {
+            static const unsigned char args[] = {
+                0x48, 0x89, 0xC7,       /* mov rdi, rax */
+                0x48, 0x89, 0xCE        /* mov rsi, rcx */
+            };
+
+            jit_load_int(interp, buf, JIT_RAX, info, pc, a);
+            jit_load_int(interp, buf, JIT_RCX, info, pc, b);
+            jit_emit(interp, buf, args, sizeof (args));
+            jit_emit_call(interp, buf, F2DPTR(Parrot_util_intval_mod));
+        }
+        else {
+            static const unsigned char add[] = { 0x48, 0x01, 0xC8 };
+            static const unsigned char sub[] = { 0x48, 0x29, 0xC8 };
+            static const unsigned char mul[] = { 0x48, 0x0F, 0xAF, 0xC1 };
+
+            jit_load_int(interp, buf, JIT_RAX, info, pc, a);
+            jit_load_int(interp, buf, JIT_RCX, info, pc, b);
+
+            if (STREQ(name, "add"))
+                jit_emit(interp, buf, add, sizeof (add));
+            else if (STREQ(name, "sub"))
+                jit_emit(interp, buf, sub, sizeof (sub));
+            else
+                jit_emit(interp, buf, mul, sizeof (mul));
+        }
+
+        jit_store_int(interp, buf, JIT_RAX, pc, 0);
+        return 1;
+    }
+
+    if (JIT_IS_NUM(t[0]) && JIT_IS_NUM(t[a]) && JIT_IS_NUM(t[b])) {
+        jit_load_num(interp, buf, 1, info, pc, b);
+
+        if (STREQ(name, "div")) {
+            /* shifting out the sign leaves zero for both zeros */
+            static const unsigned char shl_rax[] = { 0x48, 0xD1, 0xE0 };
+
+            jit_emit_movq_from_xmm(interp, buf, 1);
+            jit_emit(interp, buf, shl_rax, sizeof (shl_rax));
+            jit_emit_exit(interp, buf, JIT_CC_E, pc);
+        }
+
+        jit_load_num(interp, buf, 0, info, pc, a);
+
+        if (STREQ(name, "mod"))
+            jit_emit_call(interp, buf, F2DPTR(Parrot_util_floatval_mod));
+        else
+            jit_emit_sse(interp, buf,
+                  STREQ(name, "add") ? 0x58
+                : STREQ(name, "sub") ? 0x5C
+                : STREQ(name, "mul") ? 0x59
+                :                      0x5E);
+
+        jit_store_num(interp, buf, 0, pc, 0);
+        return 1;
+    }
+
+    return 0;
+}
+
+
+/*
+
+=item C<static int jit_emit_cmp_branch(PARROT_INTERP, Jit_buffer *buf, const
+op_info_t *info, const opcode_t *pc, int taken)>
+
+Emits C<eq>, C<ne>, C<lt> or C<le>, leaving the trace if the branch doesn't
+go the way it did when recorded.  Float comparisons with a NaN are false, as
+in C.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static int
+jit_emit_cmp_branch(PARROT_INTERP, ARGMOD(Jit_buffer *buf), ARGIN(const op_info_t *info),
+        ARGIN(const opcode_t *pc), int taken)
+{
+    ASSERT_ARGS(jit_emit_cmp_branch)
+    const char      * const name   = info->name;
+    const opcode_t  * const target = pc + pc[3];
+    const opcode_t  * const next   = pc + info->op_count;
+    const opcode_t  * const resume = taken ? next : target;
+    int                     cc;
+
+    if (JIT_IS_INT(info->types[0]) && JIT_IS_INT(info->types[1])) {
+        jit_emit_cmp_int(interp, buf, info, pc);
+        cc = STREQ(name, "eq") ? JIT_CC_E
+           : STREQ(name, "ne") ? JIT_CC_NE
+           : STREQ(name, "lt") ? JIT_CC_L
+           :                     JIT_CC_LE;
+        jit_emit_exit(interp, buf, taken ? cc ^ 1 : cc, resume);
+        return 1;
+    }
+
+    if (!JIT_IS_NUM(info->types[0]) || !JIT_IS_NUM(info->types[1]))
+        return 0;
+
+    if (STREQ(name, "lt") || STREQ(name, "le")) {
+        /* b above a is a < b, and is false on NaN */
+        jit_emit_ucomisd(interp, buf, info, pc, 1, 0);
+        cc = STREQ(name, "lt") ? JIT_CC_A : JIT_CC_AE;
+        jit_emit_exit(interp, buf, taken ? cc ^ 1 : cc, resume);
+    }
+    else {
+        /* equal is ZF set and PF clear */
+        const int want_equal = STREQ(name, "eq") ? taken : !taken;
+
+        jit_emit_ucomisd(interp, buf, info, pc, 0, 1);
+
+        if (want_equal) {
+            jit_emit_exit(interp, buf, JIT_CC_P, resume);
+            jit_emit_exit(interp, buf, JIT_CC_NE, resume);
+        }
+        else {
+            jit_emit_byte(interp, buf, 0x7A);   /* jp over the exit */
+            jit_emit_byte(interp, buf, 0x06);
+            jit_emit_exit(interp, buf, JIT_CC_E, resume);
+        }
+    }
+
+    return 1;
+}
+
+
+/*
+
+=item C<static int jit_emit_cmp_set(PARROT_INTERP, Jit_buffer *buf, const
+op_info_t *info, const opcode_t *pc)>
+
+Emits C<iseq>, C<isne>, C<islt>, C<isle> or C<cmp>, setting an integer
+register from a comparison.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static int
+jit_emit_cmp_set(PARROT_INTERP, ARGMOD(Jit_buffer *buf), ARGIN(const op_info_t *info),
+        ARGIN(const opcode_t *pc))
+{
+    ASSERT_ARGS(jit_emit_cmp_set)
+    static const unsigned char movzx_eax_al[] = { 0x0F, 0xB6, 0xC0 };
+    static const unsigned char cmp_result[]   = {
+        0x28, 0xC1,                 /* sub cl, al */
+        0x48, 0x0F, 0xBE, 0xC1      /* movsx rax, cl */
+    };
+    const char * const name = info->name;
+    const int          cmp  = STREQ(name, "cmp");
+
+    if (!JIT_IS_INT(info->types[0]))
+        return 0;
+
+    if (JIT_IS_INT(info->types[1]) && JIT_IS_INT(info->types[2])) {
+        jit_emit_cmp_int(interp, buf, info, pc);
+
+        if (cmp) {
+            jit_emit_setcc(interp, buf, JIT_CC_G, JIT_RCX);
+            jit_emit_setcc(interp, buf, JIT_CC_L, JIT_RAX);
+            jit_emit(interp, buf, cmp_result, sizeof (cmp_result));
+            jit_store_int(interp, buf, JIT_RAX, pc, 0);
+            return 1;
+        }
+
+        jit_emit_setcc(interp, buf,
+              STREQ(name, "iseq") ? JIT_CC_E
+            : STREQ(name, "isne") ? JIT_CC_NE
+            : STREQ(name, "islt") ? JIT_CC_L
+            :                       JIT_CC_LE, JIT_RAX);
+    }
+    else if (JIT_IS_NUM(info->types[1]) && JIT_IS_NUM(info->types[2])) {
+        if (cmp) {
+            /* (a > b) - (a < b), so 0 if either is NaN */
+            jit_emit_ucomisd(interp, buf, info, pc, 1, 2);
+            jit_emit_setcc(interp, buf, JIT_CC_A, JIT_RCX);
+            jit_emit_ucomisd_regs(interp, buf, 1, 0);
+            jit_emit_setcc(interp, buf, JIT_CC_A, JIT_RAX);
+            jit_emit(interp, buf, cmp_result, sizeof (cmp_result));
+            jit_store_int(interp, buf, JIT_RAX, pc, 0);
+            return 1;
+        }
+
+        if (STREQ(name, "islt") || STREQ(name, "isle")) {
+            jit_emit_ucomisd(interp, buf, info, pc, 2, 1);
+            jit_emit_setcc(interp, buf, STREQ(name, "islt") ? JIT_CC_A : JIT_CC_AE, JIT_RAX);
+        }
+        else {
+            const int iseq = STREQ(name, "iseq");
+
+            jit_emit_ucomisd(interp, buf, info, pc, 1, 2);
+            jit_emit_setcc(interp, buf, iseq ? JIT_CC_E  : JIT_CC_NE, JIT_RAX);
+            jit_emit_setcc(interp, buf, iseq ? JIT_CC_NP : JIT_CC_P,  JIT_RCX);
+            jit_emit_byte(interp, buf, iseq ? 0x20 : 0x08);    /* and/or al, cl */
+            jit_emit_byte(interp, buf, 0xC8);
+        }
+    }
+    else
+        return 0;
+
+    jit_emit(interp, buf, movzx_eax_al, sizeof (movzx_eax_al));
+    jit_store_int(interp, buf, JIT_RAX, pc, 0);
+    return 1;
+}
+
+
+/*
+
+=item C<static void jit_emit_cmp_int(PARROT_INTERP, Jit_buffer *buf, const
+op_info_t *info, const opcode_t *pc)>
+
+Emits a comparison of the last two integer arguments of the op at C<pc>,
+setting the flags for C<rax> against C<rcx>.
+
+=cut
+
+*/
+
+static void
+jit_emit_cmp_int(PARROT_INTERP, ARGMOD(Jit_buffer *buf), ARGIN(const op_info_t *info),
+        ARGIN(const opcode_t *pc))
+{
+    ASSERT_ARGS(jit_emit_cmp_int)
+    static const unsigned char cmp[] = { 0x48, 0x39, 0xC8 };
+    const int a = info->op_count - 3;
+
+    /* the branches compare their first two arguments, the others their last
+     * two */
+    const int first = info->labels[info->op_count - 2] ? 0 : a;
+
+    jit_load_int(interp, buf, JIT_RAX, info, pc, first);
+    jit_load_int(interp, buf, JIT_RCX, info, pc, first + 1);
+    jit_emit(interp, buf, cmp, sizeof (cmp));
+}
+
+
+/*
+
+=item C<static void jit_emit_ucomisd(PARROT_INTERP, Jit_buffer *buf, const
+op_info_t *info, const opcode_t *pc, int x, int y)>
+
+Loads the float arguments C<x> and C<y> of the op at C<pc> into C<xmm0> and
+C<xmm1>, and compares C<xmm0> against C<xmm1>.
+
+=cut
+
+*/
+
+static void
+jit_emit_ucomisd(PARROT_INTERP, ARGMOD(Jit_buffer *buf), ARGIN(const op_info_t *info),
+        ARGIN(const opcode_t *pc), int x, int y)
+{
+    ASSERT_ARGS(jit_emit_ucomisd)
+
+    jit_load_num(interp, buf, 0, info, pc, x);
+    jit_load_num(interp, buf, 1, info, pc, y);
+    jit_emit_ucomisd_regs(interp, buf, 0, 1);
+}
+
+
+/*
+
+=item C<static void jit_emit_ucomisd_regs(PARROT_INTERP, Jit_buffer *buf, int x,
+int y)>
+
+Compares C<xmm>I<x> against C<xmm>I<y>.
+
+=cut
+
+*/
+
+static void
+jit_emit_ucomisd_regs(PARROT_INTERP, ARGMOD(Jit_buffer *buf), int x, int y)
+{
+    ASSERT_ARGS(jit_emit_ucomisd_regs)
+    const unsigned char ucomisd[] = {
+        0x66, 0x0F, 0x2E, (unsigned char)(0xC0 | x << 3 | y)
+    };
+
+    jit_emit(interp, buf, ucomisd, sizeof (ucomisd));
+}
+
+
+/*
+
+=item C<static void jit_emit_is_zero(PARROT_INTERP, Jit_buffer *buf, const
+op_info_t *info, const opcode_t *pc, int arg)>
+
+Sets the zero flag if argument C<arg> of the op at C<pc> is zero.  A float is
+zero if it's either zero, as C<if> and C<unless> have it.
+
+=cut
+
+*/
+
+static void
+jit_emit_is_zero(PARROT_INTERP, ARGMOD(Jit_buffer *buf), ARGIN(const op_info_t *info),
+        ARGIN(const opcode_t *pc), int arg)
+{
+    ASSERT_ARGS(jit_emit_is_zero)
+
+    if (JIT_IS_INT(info->types[arg])) {
+        static const unsigned char test_rax[] = { 0x48, 0x85, 0xC0 };
+        jit_load_int(interp, buf, JIT_RAX, info, pc, arg);
+        jit_emit(interp, buf, test_rax, sizeof (test_rax));
+    }
+    else {
+        static const unsigned char shl_rax[] = { 0x48, 0xD1, 0xE0 };
+        jit_load_num(interp, buf, 0, info, pc, arg);
+        jit_emit_movq_from_xmm(interp, buf, 0);
+        jit_emit(interp, buf, shl_rax, sizeof (shl_rax));
+    }
+}
+
+
+/*
+
+=item C<static void jit_load_int(PARROT_INTERP, Jit_buffer *buf, int reg, const
+op_info_t *info, const opcode_t *pc, int arg)>
+
+Loads the integer argument C<arg> of the op at C<pc> into the native register
+C<reg>.
+
+=item C<static void jit_store_int(PARROT_INTERP, Jit_buffer *buf, int reg, const
+opcode_t *pc, int arg)>
+
+Stores the native register C<reg> into the integer register argument C<arg>
+of the op at C<pc>.
+
+=cut
+
+*/
+
+static void
+jit_load_int(PARROT_INTERP, ARGMOD(Jit_buffer *buf), int reg, ARGIN(const op_info_t *info),
+        ARGIN(const opcode_t *pc), int arg)
+{
+    ASSERT_ARGS(jit_load_int)
+
+    if (info->types[arg] & PARROT_ARG_CONSTANT)
+        jit_emit_mov_imm(interp, buf, reg, pc[arg + 1]);
+    else
+        jit_emit_mem(interp, buf, 0x8B, reg, JIT_RBX, 8 * pc[arg + 1]);
+}
+
+static void
+jit_store_int(PARROT_INTERP, ARGMOD(Jit_buffer *buf), int reg, ARGIN(const opcode_t *pc), int arg)
+{
+    ASSERT_ARGS(jit_store_int)
+
+    jit_emit_mem(interp, buf, 0x89, reg, JIT_RBX, 8 * pc[arg + 1]);
+}
+
+
+/*
+
+=item C<static void jit_load_num(PARROT_INTERP, Jit_buffer *buf, int xmm, const
+op_info_t *info, const opcode_t *pc, int arg)>
+
+Loads the float argument C<arg> of the op at C<pc> into C<xmm>I<xmm>.
+Constants go through C<rax>.
+
+=item C<static void jit_store_num(PARROT_INTERP, Jit_buffer *buf, int xmm, const
+opcode_t *pc, int arg)>
+
+Stores C<xmm>I<xmm> into the float register argument C<arg> of the op at
+C<pc>.
+
+=cut
+
+*/
+
+static void
+jit_load_num(PARROT_INTERP, ARGMOD(Jit_buffer *buf), int xmm, ARGIN(const op_info_t *info),
+        ARGIN(const opcode_t *pc), int arg)
+{
+    ASSERT_ARGS(jit_load_num)
+
+    if (info->types[arg] & PARROT_ARG_CONSTANT) {
+        const FLOATVAL value =
+            Parrot_pcc_get_num_constants(interp, CURRENT_CONTEXT(interp))[pc[arg + 1]];
+        INTVAL         bits;
+
+        memcpy(&bits, &value, sizeof (bits));
+        jit_emit_mov_imm(interp, buf, JIT_RAX, bits);
+        jit_emit_movq_to_xmm(interp, buf, xmm);
+    }
+    else {
+        jit_emit_byte(interp, buf, 0xF2);
+        jit_emit_byte(interp, buf, 0x0F);
+        jit_emit_byte(interp, buf, 0x10);
+        jit_emit_modrm_disp(interp, buf, xmm, JIT_RBP, -8 * (pc[arg + 1] + 1));
+    }
+}
+
+static void
+jit_store_num(PARROT_INTERP, ARGMOD(Jit_buffer *buf), int xmm, ARGIN(const opcode_t *pc), int arg)
+{
+    ASSERT_ARGS(jit_store_num)
+
+    jit_emit_byte(interp, buf, 0xF2);
+    jit_emit_byte(interp, buf, 0x0F);
+    jit_emit_byte(interp, buf, 0x11);
+    jit_emit_modrm_disp(interp, buf, xmm, JIT_RBP, -8 * (pc[arg + 1] + 1));
+}
+
+
+/*
+
+=item C<static void jit_emit_sse(PARROT_INTERP, Jit_buffer *buf, int op)>
+
+Emits the scalar double instruction C<op> of C<xmm0> with C<xmm1>, like
+C<addsd> for C<0x58>.
+
+=item C<static void jit_emit_movq_to_xmm(PARROT_INTERP, Jit_buffer *buf, int
+xmm)>
+
+Moves the bits of C<rax> to C<xmm>I<xmm>.
+
+=item C<static void jit_emit_movq_from_xmm(PARROT_INTERP, Jit_buffer *buf, int
+xmm)>
+
+Moves the bits of C<xmm>I<xmm> to C<rax>.
+
+=cut
+
+*/
+
+static void
+jit_emit_sse(PARROT_INTERP, ARGMOD(Jit_buffer *buf), int op)
+{
+    ASSERT_ARGS(jit_emit_sse)
+    const unsigned char sse[] = { 0xF2, 0x0F, (unsigned char)op, 0xC1 };
+
+    jit_emit(interp, buf, sse, sizeof (sse));
+}
+
+static void
+jit_emit_movq_to_xmm(PARROT_INTERP, ARGMOD(Jit_buffer *buf), int xmm)
+{
+    ASSERT_ARGS(jit_emit_movq_to_xmm)
+    const unsigned char movq[] = { 0x66, 0x48, 0x0F, 0x6E, (unsigned char)(0xC0 | xmm << 3) };
+
+    jit_emit(interp, buf, movq, sizeof (movq));
+}
+
+static void
+jit_emit_movq_from_xmm(PARROT_INTERP, ARGMOD(Jit_buffer *buf), int xmm)
+{
+    ASSERT_ARGS(jit_emit_movq_from_xmm)
+    const unsigned char movq[] = { 0x66, 0x48, 0x0F, 0x7E, (unsigned char)(0xC0 | xmm << 3) };
+
+    jit_emit(interp, buf, movq, sizeof (movq));
+}
+
+
+/*
+
+=item C<static void jit_emit_setcc(PARROT_INTERP, Jit_buffer *buf, int cc, int
+reg)>
+
+Sets the low byte of C<reg> to 1 if the condition C<cc> holds, else to 0.
+
+=item C<static void jit_emit_call(PARROT_INTERP, Jit_buffer *buf, void *fn)>
+
+Calls the C function at C<fn>.  Its arguments must already be in place.
+
+=item C<static void jit_emit_exit(PARROT_INTERP, Jit_buffer *buf, int cc, const
+opcode_t *pc)>
+
+Leaves the trace, resuming at C<pc>, if the condition C<cc> holds.
+
+=cut
+
+*/
+
+static void
+jit_emit_setcc(PARROT_INTERP, ARGMOD(Jit_buffer *buf), int cc, int reg)
+{
+    ASSERT_ARGS(jit_emit_setcc)
+    const unsigned char setcc[] = { 0x0F, (unsigned char)(0x90 | cc), (unsigned char)(0xC0 | reg) };
+
+    jit_emit(interp, buf, setcc, sizeof (setcc));
+}
+
+static void
+jit_emit_call(PARROT_INTERP, ARGMOD(Jit_buffer *buf), ARGIN(void *fn))
+{
+    ASSERT_ARGS(jit_emit_call)
+    static const unsigned char call_rax[] = { 0xFF, 0xD0 };
+
+    jit_emit_mov_imm(interp, buf, JIT_RAX, (INTVAL)PTR2UINTVAL(fn));
+    jit_emit(interp, buf, call_rax, sizeof (call_rax));
+}
+
+static void
+jit_emit_exit(PARROT_INTERP, ARGMOD(Jit_buffer *buf), int cc, ARGIN(const opcode_t *pc))
+{
+    ASSERT_ARGS(jit_emit_exit)
+    Jit_exit *e;
+
+    if (buf->n_exits == buf->alloc_exits) {
+        const size_t alloc = buf->alloc_exits ? 2 * buf->alloc_exits : 16;
+
+        if (buf->exits)
+            buf->exits = mem_gc_realloc_n_typed(interp, buf->exits, alloc, Jit_exit);
+        else
+            buf->exits = mem_gc_allocate_n_typed(interp, alloc, Jit_exit);
+
+        buf->alloc_exits = alloc;
+    }
+
+    jit_emit_byte(interp, buf, 0x0F);
+    jit_emit_byte(interp, buf, (unsigned char)(0x80 | cc));
+
+    e     = buf->exits + buf->n_exits++;
+    e->at = buf->size;
+    e->pc = pc;
+
+    jit_emit_int32(interp, buf, 0);
+}
+
+
+/*
+
+=item C<static void jit_emit_mov_imm(PARROT_INTERP, Jit_buffer *buf, int reg,
+INTVAL value)>
+
+Loads C<value> into C<reg>.
+
+=item C<static void jit_emit_mem(PARROT_INTERP, Jit_buffer *buf, int op, int
+reg, int base, INTVAL disp)>
+
+Emits the 64-bit instruction C<op> between C<reg> and the memory at C<base>
+plus C<disp>, like C<mov> for C<0x8B>.  For group instructions, C<reg> is the
+opcode extension.
+
+=item C<static void jit_emit_modrm_disp(PARROT_INTERP, Jit_buffer *buf, int reg,
+int base, INTVAL disp)>
+
+Emits the ModRM byte and 32-bit displacement addressing C<base> plus C<disp>.
+
+=cut
+
+*/
+
+static void
+jit_emit_mov_imm(PARROT_INTERP, ARGMOD(Jit_buffer *buf), int reg, INTVAL value)
+{
+    ASSERT_ARGS(jit_emit_mov_imm)
+
+    jit_emit_byte(interp, buf, 0x48);
+    jit_emit_byte(interp, buf, (unsigned char)(0xB8 | reg));
+    jit_emit(interp, buf, (const unsigned char *)&value, sizeof (value));
+}
+
+static void
+jit_emit_mem(PARROT_INTERP, ARGMOD(Jit_buffer *buf), int op, int reg, int base, INTVAL disp)
+{
+    ASSERT_ARGS(jit_emit_mem)
+
+    jit_emit_byte(interp, buf, 0x48);
+    jit_emit_byte(interp, buf, (unsigned char)op);
+    jit_emit_modrm_disp(interp, buf, reg, base, disp);
+}
+
+static void
+jit_emit_modrm_disp(PARROT_INTERP, ARGMOD(Jit_buffer *buf), int reg, int base, INTVAL disp)
+{
+    ASSERT_ARGS(jit_emit_modrm_disp)
+
+    jit_emit_byte(interp, buf, (unsigned char)(0x80 | reg << 3 | base));
+    jit_emit_int32(interp, buf, (int)disp);
+}
+
+
+/*
+
+=item C<static void jit_emit_int32(PARROT_INTERP, Jit_buffer *buf, int value)>
+
+Emits C<value> as 32 bits.
+
+=item C<static void jit_emit_byte(PARROT_INTERP, Jit_buffer *buf, unsigned char
+byte)>
+
+Emits C<byte>.
+
+=item C<static void jit_emit(PARROT_INTERP, Jit_buffer *buf, const unsigned char
+*bytes, size_t n)>
+
+Emits the C<n> bytes at C<bytes>, growing the buffer as needed.
+
+=cut
+
+*/
+
+static void
+jit_emit_int32(PARROT_INTERP, ARGMOD(Jit_buffer *buf), int value)
+{
+    ASSERT_ARGS(jit_emit_int32)
+    const Parrot_Int4 v = value;
+
+    jit_emit(interp, buf, (const unsigned char *)&v, 4);
+}
+
+static void
+jit_emit_byte(PARROT_INTERP, ARGMOD(Jit_buffer *buf), unsigned char byte)
+{
+    ASSERT_ARGS(jit_emit_byte)
+
+    jit_emit(interp, buf, &byte, 1);
+}
+
+static void
+jit_emit(PARROT_INTERP, ARGMOD(Jit_buffer *buf), ARGIN(const unsigned char *bytes), size_t n)
+{
+    ASSERT_ARGS(jit_emit)
+
+    if (buf->size + n > buf->alloc) {
+        const size_t alloc = buf->alloc ? 2 * buf->alloc + n : 1024;
+
+        if (buf->code)
+            buf->code = mem_gc_realloc_n_typed(interp, buf->code, alloc, unsigned char);
+        else
+            buf->code = mem_gc_allocate_n_typed(interp, alloc, unsigned char);
+
+        buf->alloc = alloc;
+    }
+
+    memcpy(buf->code + buf->size, bytes, n);
+    buf->size += n;
+}
+
+
+/*
+
+=back
+
+=head1 SEE ALSO
+
+F<src/runcore/cores.c>, F<include/parrot/runcore_jit.h>
+
+=cut
+
+*/
+
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
@@ -20,6 +20,7 @@ The runcore API handles running the operations.
 #include "parrot/parrot.h"
 #include "parrot/runcore_api.h"
 #include "parrot/runcore_profiling.h"
+#include "parrot/runcore_jit.h"
 #include "parrot/oplib/core_ops.h"
 #include "parrot/oplib/ops.h"
 #include "main.str"
@@ -67,6 +68,14 @@ Parrot_runcore_init(PARROT_INTERP)
 
     Parrot_runcore_slow_init(interp);
     Parrot_runcore_fast_init(interp);
+    Parrot_runcore_bounds_init(interp);
+    Parrot_runcore_threaded_init(interp);
+#ifdef PARROT_HAS_COMPUTED_GOTO
+    Parrot_runcore_cgoto_init(interp);
+#endif
+#if PARROT_JIT_CAPABLE
+    Parrot_runcore_jit_init(interp);
+#endif
 
     Parrot_runcore_exec_init(interp);
     Parrot_runcore_gc_debug_init(interp);
@@ -131,7 +140,18 @@ Parrot_runcore_switch(PARROT_INTERP, ARGIN(STRING *name))
 
     for (i = 0; i < num_cores; ++i) {
         if (STRING_equal(interp, name, interp->cores[i]->name)) {
+            /* pending events have to be found by the new core */
+            const int pending = interp->events_pending
+                             || (interp->code && interp->code->save_func_table);
+
+            if (pending)
+                disable_event_checking(interp);
+
             interp->run_core = interp->cores[i];
+
+            if (pending)
+                enable_event_checking(interp);
+
             return;
         }
     }
@@ -356,9 +376,11 @@ parrot_hash_oplib(PARROT_INTERP, ARGIN(op_lib_t *lib))
 
 =item C<void disable_event_checking(PARROT_INTERP)>
 
-Restore old function table.
+Restore old function table, or clear the flag polled by runcores which don't
+switch tables.
 
-XXX This is only implemented for the function core at present.
+XXX This is only implemented for the function cores and the computed goto
+core at present.
 
 =cut
 
@@ -370,10 +392,19 @@ disable_event_checking(PARROT_INTERP)
 {
     ASSERT_ARGS(disable_event_checking)
     PackFile_ByteCode *cs = interp->code;
+
+    interp->events_pending = 0;
+
+    if (!cs || !cs->save_func_table)
+        return;
+
     /* restore func table */
-    PARROT_ASSERT(cs->save_func_table);
     cs->op_func_table   = cs->save_func_table;
     cs->save_func_table = NULL;
+
+    /* and the label table of the computed goto core */
+    if (cs->cg_ops_table)
+        cs->cg_ops_addr = cs->cg_ops_table;
 }
 
 
@@ -383,10 +414,15 @@ disable_event_checking(PARROT_INTERP)
 
 Replace func table with one that does event checking for all opcodes.
 
+Runcores flagged with C<RUNCORE_EVENT_POLL_FLAG> don't need the table: for
+them this only sets C<interp-E<gt>events_pending>, which they poll at
+backward branches and at calls and returns.
+
 NOTE: C<enable_event_checking()> is called async by the event handler
 thread. All action done from here has to be async safe.
 
-XXX This is only implemented for the function core at present.
+XXX This is only implemented for the function cores and the computed goto
+core at present.
 
 =cut
 
@@ -399,6 +435,11 @@ enable_event_checking(PARROT_INTERP)
     ASSERT_ARGS(enable_event_checking)
     PackFile_ByteCode *cs = interp->code;
 
+    if (interp->run_core && PARROT_RUNCORE_EVENT_POLL_TEST(interp->run_core)) {
+        interp->events_pending = 1;
+        return;
+    }
+
     /* only save if we're not already event checking */
     if (cs->save_func_table == NULL)
         cs->save_func_table = cs->op_func_table;
@@ -424,6 +465,33 @@ enable_event_checking(PARROT_INTERP)
 
     /* put evc table in place */
     cs->op_func_table   = interp->evc_func_table;
+
+    /* the computed goto core keeps its event checking labels right
+     * behind the op labels, so switching is a single store */
+    if (cs->cg_ops_table)
+        cs->cg_ops_addr = cs->cg_ops_table + cs->cg_op_count;
+}
+
+
+/*
+
+=item C<void Parrot_runcore_handle_events(PARROT_INTERP)>
+
+Handles the events a polling runcore found pending, like the
+C<check_events__> op does for the other cores.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+void
+Parrot_runcore_handle_events(PARROT_INTERP)
+{
+    ASSERT_ARGS(Parrot_runcore_handle_events)
+
+    disable_event_checking(interp);
+    Parrot_cx_handle_tasks(interp, interp->scheduler);
 }
 
 
@@ -42,6 +42,10 @@ Functions controlling Parrot's profiling runcore.
 /* HEADERIZER BEGIN: static */
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 
+static int compare_op_seqs(ARGIN(const void *a), ARGIN(const void *b))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
 PARROT_MALLOC
 PARROT_CANNOT_RETURN_NULL
 static char* get_filename_cstr(PARROT_INTERP,
@@ -112,6 +116,13 @@ static void record_op(PARROT_INTERP,
         __attribute__nonnull__(3)
         __attribute__nonnull__(4);
 
+static void record_op_seq(PARROT_INTERP,
+    ARGIN(Parrot_profiling_runcore_t *runcore),
+    ARGIN(opcode_t *pc))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
 static void record_values_ascii_pprof(
     ARGIN(Parrot_profiling_runcore_t * runcore),
     ARGIN(PPROF_DATA *pprof_data),
@@ -147,6 +158,14 @@ static void store_postop_time(PARROT_INTERP,
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
+static void write_op_seqs(PARROT_INTERP,
+    ARGIN(Parrot_profiling_runcore_t *runcore))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+#define ASSERT_ARGS_compare_op_seqs __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(a) \
+    , PARROT_ASSERT_ARG(b))
 #define ASSERT_ARGS_get_filename_cstr __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(runcore) \
@@ -182,6 +201,10 @@ static void store_postop_time(PARROT_INTERP,
     , PARROT_ASSERT_ARG(runcore) \
     , PARROT_ASSERT_ARG(pprof_data) \
     , PARROT_ASSERT_ARG(op_name))
+#define ASSERT_ARGS_record_op_seq __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(runcore) \
+    , PARROT_ASSERT_ARG(pc))
 #define ASSERT_ARGS_record_values_ascii_pprof __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(runcore) \
     , PARROT_ASSERT_ARG(pprof_data))
@@ -199,6 +222,9 @@ static void store_postop_time(PARROT_INTERP,
 #define ASSERT_ARGS_store_postop_time __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(runcore))
+#define ASSERT_ARGS_write_op_seqs __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(runcore))
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 /* HEADERIZER END: static */
 
@@ -252,7 +278,7 @@ init_profiling_core(PARROT_INTERP, ARGIN(Parrot_profiling_runcore_t *runcore), A
 {
     ASSERT_ARGS(init_profiling_core)
 
-    char *profile_filename_cstr, *output_cstr, *env_filename_cstr;
+    char *profile_filename_cstr, *output_cstr, *env_filename_cstr, *op_seqs_cstr;
 
     /* initialize the runcore struct */
     runcore->runops  = (Parrot_runcore_runops_fn_t)  runops_profiling_core;
@@ -338,6 +364,18 @@ init_profiling_core(PARROT_INTERP, ARGIN(Parrot_profiling_runcore_t *runcore), A
         Profiling_canonical_output_SET(runcore);
     }
 
+    /* figure out if op pair and triple counts are wanted, and where to */
+    op_seqs_cstr = Parrot_getenv(interp, CONST_STRING(interp, "PARROT_PROFILING_OPSEQS"));
+
+    if (op_seqs_cstr) {
+        Profiling_report_op_seqs_SET(runcore);
+        runcore->op_seqs          = parrot_create_hash(interp, enum_type_ptr, Hash_key_type_int);
+        runcore->op_seqs_filename = Parrot_str_new(interp, op_seqs_cstr, 0);
+        runcore->seq_next_pc      = NULL;
+        runcore->seq_len          = 0;
+        Parrot_str_gc_register(interp, runcore->op_seqs_filename);
+    }
+
     /* put profile_filename in the gc root set so it won't get collected */
     Parrot_str_gc_register(interp, runcore->profile_filename);
 
@@ -418,6 +456,9 @@ ARGIN(opcode_t *pc))
         preop_opname          = interp->code->op_info_table[*pc]->name;
         preop_line_num        = get_line_num_from_cache(interp, runcore, preop_ctx_pmc);
 
+        if (Profiling_report_op_seqs_TEST(runcore))
+            record_op_seq(interp, runcore, pc);
+
         Profiling_exit_check_CLEAR(runcore);
 
         runcore->op_start  = Parrot_hires_get_time();
@@ -608,6 +649,73 @@ INTVAL line_num)
     runcore->output_fn(runcore, pprof_data, PPROF_LINE_OP);
 }
 
+/*
+
+=item C<static void record_op_seq(PARROT_INTERP, Parrot_profiling_runcore_t
+*runcore, opcode_t *pc)>
+
+Count the op at C<pc> as the end of a pair and a triple of ops, if it was
+reached by falling through from the ops before it.  Only such sequences can be
+replaced by superinstructions, so branches and ops outside the core op library
+start a new sequence.
+
+=cut
+
+*/
+
+static void
+record_op_seq(PARROT_INTERP, ARGIN(Parrot_profiling_runcore_t *runcore),
+ARGIN(opcode_t *pc))
+{
+    ASSERT_ARGS(record_op_seq)
+
+    op_lib_t  * const core_ops = PARROT_GET_CORE_OPLIB(interp);
+    op_info_t * const info     = interp->code->op_info_table[*pc];
+    const INTVAL      op       = info - core_ops->op_info_table;
+
+    if (info->lib != core_ops) {
+        runcore->seq_len     = 0;
+        runcore->seq_next_pc = NULL;
+        return;
+    }
+
+    if (pc != runcore->seq_next_pc)
+        runcore->seq_len = 0;
+
+    if (runcore->seq_len > 0) {
+        /* keys are offset by one, as a zero key marks an empty bucket */
+        const INTVAL key = runcore->seq_ops[1] * core_ops->op_count + op + 1;
+        Parrot_profiling_op_seq_t *pair = (Parrot_profiling_op_seq_t *)
+                parrot_hash_get(interp, runcore->op_seqs, (void *)key);
+
+        if (!pair) {
+            pair       = mem_gc_allocate_zeroed_typed(interp, Parrot_profiling_op_seq_t);
+            pair->next = parrot_new_intval_hash(interp);
+            parrot_hash_put(interp, runcore->op_seqs, (void *)key, pair);
+        }
+
+        ++pair->count;
+
+        if (runcore->seq_len > 1) {
+            const INTVAL prev_key = runcore->seq_ops[0] * core_ops->op_count
+                                  + runcore->seq_ops[1] + 1;
+            Parrot_profiling_op_seq_t * const prev = (Parrot_profiling_op_seq_t *)
+                    parrot_hash_get(interp, runcore->op_seqs, (void *)prev_key);
+            const INTVAL count = hash_value_to_int(interp, prev->next,
+                    parrot_hash_get(interp, prev->next, (void *)(op + 1)));
+
+            parrot_hash_put(interp, prev->next, (void *)(op + 1), (void *)(count + 1));
+        }
+    }
+
+    runcore->seq_ops[0]  = runcore->seq_ops[1];
+    runcore->seq_ops[1]  = op;
+    runcore->seq_next_pc = pc + info->op_count;
+
+    if (runcore->seq_len < 2)
+        ++runcore->seq_len;
+}
+
 
 
 
@@ -894,6 +1002,126 @@ ARGIN(PPROF_DATA *pprof_data), ARGIN_NULLOK(Parrot_profiling_line type))
 }
 
 
+/*
+
+=item C<static int compare_op_seqs(const void *a, const void *b)>
+
+C<qsort> comparison function, ordering the op sequences in C<write_op_seqs>
+by descending count.  Ties are broken by the op numbers, to keep the output
+stable.
+
+=cut
+
+*/
+
+static int
+compare_op_seqs(ARGIN(const void *a), ARGIN(const void *b))
+{
+    ASSERT_ARGS(compare_op_seqs)
+
+    const UHUGEINTVAL * const seq_a = (const UHUGEINTVAL *)a;
+    const UHUGEINTVAL * const seq_b = (const UHUGEINTVAL *)b;
+    int i;
+
+    if (seq_a[0] != seq_b[0])
+        return seq_a[0] < seq_b[0] ? 1 : -1;
+
+    for (i = 1; i < 4; ++i) {
+        if (seq_a[i] != seq_b[i])
+            return seq_a[i] < seq_b[i] ? -1 : 1;
+    }
+
+    return 0;
+}
+
+/*
+
+=item C<static void write_op_seqs(PARROT_INTERP, Parrot_profiling_runcore_t
+*runcore)>
+
+Write the op pairs and triples counted by C<record_op_seq> to the file named by
+C<PARROT_PROFILING_OPSEQS>, most frequent first, and free the counts.  Each
+line lists the full op names of a sequence followed by its count as a comment,
+so the top of the file can be copied into F<src/ops/ops.super>.
+
+=cut
+
+*/
+
+static void
+write_op_seqs(PARROT_INTERP, ARGIN(Parrot_profiling_runcore_t *runcore))
+{
+    ASSERT_ARGS(write_op_seqs)
+
+    op_lib_t    * const core_ops = PARROT_GET_CORE_OPLIB(interp);
+    char        * const filename = Parrot_str_to_cstring(interp, runcore->op_seqs_filename);
+    FILE        * const fd       = fopen(filename, "w");
+    const size_t n_pairs         = runcore->op_seqs->entries;
+    Parrot_profiling_op_seq_t **pairs;
+    UHUGEINTVAL *seqs;
+    size_t       n_seqs = n_pairs;
+    size_t       i      = 0;
+    size_t       j;
+
+    if (!fd) {
+        fprintf(stderr, "unable to open %s for writing", filename);
+        Parrot_str_free_cstring(filename);
+        exit(1);
+    }
+
+    pairs = mem_gc_allocate_n_zeroed_typed(interp, n_pairs + 1, Parrot_profiling_op_seq_t *);
+
+    parrot_hash_iterate(runcore->op_seqs,
+        pairs[i] = (Parrot_profiling_op_seq_t *)_bucket->value;
+        n_seqs  += pairs[i]->next->entries;
+        ++i;);
+
+    /* each sequence is a count and three op numbers plus one, with zero
+     * standing for no third op */
+    seqs = mem_gc_allocate_n_zeroed_typed(interp, n_seqs * 4 + 1, UHUGEINTVAL);
+    i    = 0;
+
+    parrot_hash_iterate(runcore->op_seqs,
+        const UHUGEINTVAL key = (INTVAL)_bucket->key - 1;
+        seqs[i++] = ((Parrot_profiling_op_seq_t *)_bucket->value)->count;
+        seqs[i++] = key / core_ops->op_count + 1;
+        seqs[i++] = key % core_ops->op_count + 1;
+        seqs[i++] = 0;);
+
+    for (j = 0; j < n_pairs; ++j) {
+        const UHUGEINTVAL op1 = seqs[j * 4 + 1];
+        const UHUGEINTVAL op2 = seqs[j * 4 + 2];
+
+        parrot_hash_iterate(pairs[j]->next,
+            seqs[i++] = (INTVAL)_bucket->value;
+            seqs[i++] = op1;
+            seqs[i++] = op2;
+            seqs[i++] = (INTVAL)_bucket->key;);
+
+        parrot_hash_destroy(interp, pairs[j]->next);
+        mem_gc_free(interp, pairs[j]);
+    }
+
+    qsort(seqs, n_seqs, 4 * sizeof (UHUGEINTVAL), compare_op_seqs);
+
+    fprintf(fd, "# op sequences by number of runs; see src/ops/ops.super\n");
+
+    for (i = 0; i < n_seqs * 4; i += 4) {
+        fprintf(fd, "%s %s", core_ops->op_info_table[seqs[i + 1] - 1].full_name,
+                core_ops->op_info_table[seqs[i + 2] - 1].full_name);
+        if (seqs[i + 3])
+            fprintf(fd, " %s", core_ops->op_info_table[seqs[i + 3] - 1].full_name);
+        fprintf(fd, "  # %lu\n", (unsigned long)seqs[i]);
+    }
+
+    fclose(fd);
+    mem_gc_free(interp, seqs);
+    mem_gc_free(interp, pairs);
+    parrot_hash_destroy(interp, runcore->op_seqs);
+    Parrot_str_free_cstring(filename);
+    Parrot_str_gc_unregister(interp, runcore->op_seqs_filename);
+}
+
 /*
 
 =item C<void * destroy_profiling_core(PARROT_INTERP, Parrot_profiling_runcore_t
@@ -924,6 +1152,9 @@ destroy_profiling_core(PARROT_INTERP, ARGIN(Parrot_profiling_runcore_t *runcore)
         fclose(runcore->profile_fd);
     mem_gc_free(interp, runcore->time);
 
+    if (Profiling_report_op_seqs_TEST(runcore))
+        write_op_seqs(interp, runcore);
+
     return NULL;
 }
 
@@ -1047,6 +1047,12 @@ Parrot_cx_schedule_sleep(PARROT_INTERP, FLOATVAL time, ARGIN_NULLOK(opcode_t *ne
     }
     Parrot_usleep((UINTVAL) time*1000000);
 #endif
+
+    /* Runcores which poll for events only do so at branches and calls, so
+     * handle the tasks which came due while sleeping before going on. */
+    if (interp->events_pending)
+        Parrot_runcore_handle_events(interp);
+
     return next;
 }
 
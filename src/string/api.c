@@ -403,8 +403,9 @@ Parrot_str_copy(PARROT_INTERP, ARGIN(const STRING *s))
      * to do */
     STRUCT_COPY(d, s);
 
-    /* Clear live flag. It might be set on constant strings */
-    PObj_live_CLEAR(d);
+    /* Clear live flag and generation. They might be set on constant and
+     * old strings */
+    PObj_GC_generation_CLEARALL(d);
 
     /* Set the string copy flag */
     PObj_is_string_copy_SET(d);
@@ -409,6 +409,7 @@ Parrot_sub_capture_lex(PARROT_INTERP, ARGMOD(PMC *sub_pmc))
     Parrot_Sub_attributes *current_sub;
     Parrot_Sub_attributes *sub;
 
+    PARROT_CONTEXT_CAPTURED(interp);
     PMC_get_sub(interp, Parrot_pcc_get_sub(interp, ctx), current_sub);
 
     /* MultiSub gets special treatment */
@@ -428,6 +429,7 @@ Parrot_sub_capture_lex(PARROT_INTERP, ARGMOD(PMC *sub_pmc))
                 if (STRING_equal(interp, current_sub->subid,
                                       child_outer_sub->subid)) {
                     child_sub->outer_ctx = ctx;
+                    PARROT_GC_WRITE_BARRIER(interp, child_pmc);
                 }
             }
         }
@@ -441,6 +443,7 @@ Parrot_sub_capture_lex(PARROT_INTERP, ARGMOD(PMC *sub_pmc))
 
     /* set the sub's outer context to the current context */
     sub->outer_ctx = ctx;
+    PARROT_GC_WRITE_BARRIER(interp, sub_pmc);
 }
 
 
@@ -111,6 +111,7 @@ compilers/imcc/imclexer.c
 compilers/imcc/imcparser.c
 # generated files
 src/ops/core_ops.c
+src/ops/core_ops_cg.c
 # generated by tools/dev/nci_thunk_gen.pir
 src/nci/core_thunks.c
 src/nci/extra_thunks.c
@@ -0,0 +1,116 @@
+#!perl
+# Copyright (C) 2011, Parrot Foundation.
+
+use strict;
+use warnings;
+use lib qw( . lib ../lib ../../lib );
+use Test::More;
+use Parrot::Config;
+use Parrot::Test tests => 4;
+
+##############################
+# Ops of src/ops/ops.lowreg emitted specialized for low registers.
+
+$ENV{TEST_PROG_ARGS} = '-Or';
+
+pir_output_is( <<'CODE', <<'OUT', "counting loop" );
+.sub main :main
+    .local int i, sum
+    .local num f
+    sum = 0
+    f = 0.0
+    i = 0
+  loop:
+    sum += i
+    $N0 = i
+    f += $N0
+    inc i
+    if i < 10 goto loop
+    say sum
+    say f
+.end
+CODE
+45
+45
+OUT
+
+pir_output_is( <<'CODE', <<'OUT', "more registers than specialized for" );
+.sub main :main
+    .local int a, b, c, d, e, f, g, h, i, j
+    a = 1
+    b = 2
+    c = 3
+    d = 4
+    e = 5
+    f = 6
+    g = 7
+    h = 8
+    i = 9
+    j = 10
+    a += j
+    b += i
+    i = h
+    j = g
+    inc j
+    dec i
+    $P0 = new ['ResizableIntegerArray']
+    push $P0, a
+    push $P0, b
+    push $P0, c
+    push $P0, d
+    push $P0, e
+    push $P0, f
+    push $P0, g
+    push $P0, h
+    push $P0, i
+    push $P0, j
+    $S0 = join ' ', $P0
+    say $S0
+.end
+CODE
+11 11 3 4 5 6 7 8 7 8
+OUT
+
+pasm_output_is( <<'CODE', <<'OUT', "PASM registers" );
+    set I9, 3
+    set I3, 0
+  again:
+    inc I3
+    lt I3, I9, again
+    print I3
+    print "\n"
+    set I7, I3
+    add I7, I9
+    print I7
+    print "\n"
+    end
+CODE
+3
+6
+OUT
+
+{
+    local $ENV{TEST_PROG_ARGS} = '-Osr';
+
+pir_output_is( <<'CODE', <<'OUT', "with superinstructions" );
+.sub main :main
+    .local int i, sum
+    sum = 0
+    i = 0
+  loop:
+    sum += i
+    inc i
+    if i < 10 goto loop
+    say sum
+.end
+CODE
+45
+OUT
+}
+
+# Local Variables:
+#   mode: cperl
+#   cperl-indent-level: 4
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4:
@@ -0,0 +1,90 @@
+#!perl
+# Copyright (C) 2011, Parrot Foundation.
+
+use strict;
+use warnings;
+use lib qw( . lib ../lib ../../lib );
+use Test::More;
+use Parrot::Config;
+use Parrot::Test tests => 4;
+
+##############################
+# Superinstructions: sequences of src/ops/ops.super emitted as one op.
+
+$ENV{TEST_PROG_ARGS} = '-Os';
+
+pir_output_is( <<'CODE', <<'OUT', "counting loop" );
+.sub main :main
+    .local int i, sum
+    sum = 0
+    i = 0
+  loop:
+    sum += i
+    inc i
+    if i < 10 goto loop
+    say sum
+.end
+CODE
+45
+OUT
+
+pir_output_is( <<'CODE', <<'OUT', "branch into a fused sequence" );
+.sub main :main
+    .local int i
+    i = 0
+    goto test
+  loop:
+    inc i
+  test:
+    if i < 3 goto loop
+    say i
+.end
+CODE
+3
+OUT
+
+pasm_output_is( <<'CODE', <<'OUT', "fused sequence of three ops" );
+    set I0, 0
+    set I1, 0
+  again:
+    inc I0
+    eq I0, 5, done
+    branch again
+  done:
+    print I0
+    print "\n"
+    end
+CODE
+5
+OUT
+
+pir_output_is( <<'CODE', <<'OUT', "primes" );
+.sub main :main
+    .local int n, i, j, count
+    count = 0
+    n = 2
+  next_n:
+    j = n - 1
+  next_j:
+    if j <= 1 goto prime
+    i = n % j
+    unless i goto not_prime
+    dec j
+    goto next_j
+  prime:
+    inc count
+  not_prime:
+    inc n
+    if n < 100 goto next_n
+    say count
+.end
+CODE
+25
+OUT
+
+# Local Variables:
+#   mode: cperl
+#   cperl-indent-level: 4
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4:
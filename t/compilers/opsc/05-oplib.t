@@ -1,18 +1,26 @@
 #!./parrot-nqp
 # Copyright (C) 2010, Parrot Foundation.
 
-# Checking for OpLib num and skip files parsing.
+# Checking for OpLib skip and super files parsing.
 
 pir::load_bytecode("opsc.pbc");
 
-plan(2);
+plan(4);
 
 my $lib := Ops::OpLib.new(
     :skip_file('src/ops/ops.skip'),
+    :super_file('src/ops/ops.super'),
 );
 
 ok( $lib.op_skip_table<abs_i_ic>,       "'abs_i_ic' in skiptable");
 ok( $lib.op_skip_table<ne_nc_nc_ic>,    "'ne_nc_nc_ic' in skiptable");
 #_dumper($lib.skiptable);
 
+ok( +$lib.super_ops > 0,                "super_ops loaded");
+my $found := 0;
+for $lib.super_ops -> @seq {
+    $found := 1 if +@seq == 2 && @seq[0] eq 'dec_i' && @seq[1] eq 'branch_ic';
+}
+ok( $found,                             "'dec_i branch_ic' in super_ops");
+
 # vim: expandtab shiftwidth=4 ft=perl6:
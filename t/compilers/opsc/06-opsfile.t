@@ -21,7 +21,9 @@ my @ops := $f.ops;
 say( "# Parsed " ~ +@ops);
 # There is more than 200 ops in this 2 files.
 # Feel free to update number if you change them.
-ok(+@ops == 264, "Ops parsed correctly");
+# The last 2 are superinstructions of src/ops/ops.super made of these ops,
+# followed by 144 ops of src/ops/ops.lowreg specialized for low registers.
+ok(+@ops == 410, "Ops parsed correctly");
 say('# ' ~ +@ops);
 
 my $op := @ops[0];
@@ -30,7 +32,7 @@ my $op := @ops[0];
 ok($op.name eq 'end',   "First op is end");
 ok($op<code> == 0,      "... with code 0");
 
-$op := @ops[(+@ops)-1];
+$op := @ops[(+@ops)-147];
 ok($op.name eq 'sqrt',  "Last op is tanh");
 say('# ' ~ $op.name);
 ok($op<code> > 84 + 116,    "... with non zero code");
@@ -0,0 +1,99 @@
+#! ./parrot-nqp
+# Copyright (C) 2011, Parrot Foundation.
+
+pir::load_bytecode("opsc.pbc");
+
+plan(14);
+
+my $trans := Ops::Trans::CGoto.new();
+
+my @files := <
+    src/ops/io.ops
+    src/ops/sys.ops
+    src/ops/cmp.ops
+>;
+
+my $lib := Ops::OpLib.new();
+my $emitter := Ops::Emitter.new(
+    :ops_file(Ops::File.new(
+        :oplib($lib),
+        :core(1),
+        |@files)
+    ),
+    :trans($trans),
+    :script('ops2c'),
+    :flags(
+        hash( dir => 'tmp/', core => 1 )
+    ),
+);
+
+ok( $emitter, "Emitter created");
+ok( $emitter<include> eq 'parrot/oplib/core_ops_cg.h', 'Include is correct');
+say('# ' ~ $emitter<include>);
+
+my $fh := pir::new__Ps('StringHandle');
+$fh.open('header.h', 'w');
+$emitter.emit_c_op_func_header($fh);
+
+$fh.close();
+my $header := $fh.readall();
+
+ok($header ~~ /define \s PARROT_OPLIB_CORE_OPS_CG_H_GUARD/, 'Guard generated');
+ok($header ~~ /Parrot_cg_core/, 'Core function declared');
+ok($header ~! /Parrot_DynOp_core/, 'No init_func declared');
+
+$fh := pir::new__Ps('StringHandle');
+$fh.open('core.c', 'w');
+$emitter.emit_c_source_file($fh);
+
+$fh.close();
+my $source := $fh.readall();
+
+ok($source ~~ /Parrot_pcc_get_pmc_constants/, 'defines from Trans::C generated');
+ok($source ~~ /define \s CG_DISPATCH/, 'dispatch macro generated');
+ok($source ~! /static \s int \s get_op/, 'no op lookup declared');
+ok($source ~! /op_lib_t/, 'no op lib generated');
+ok($source ~~ /'&&PC_0,'/, 'label table generated');
+ok($source ~~ /'PC_0: /* '/, 'labels generated');
+
+my $op_body := '
+inline op branch(in LABEL) :base_loop :flow {
+    goto OFFSET($1);
+}';
+my $new_body := translate_op_body($trans, $op_body);
+ok($new_body ~~ /'goto *CG_OPS_ADDR[*(cur_opcode += IREG(1))];'/,
+    "goto OFFSET() translated ok");
+
+$op_body := '
+inline op do_stuff(invar PMC)
+{
+    goto ADDRESS(234);
+}';
+$new_body := translate_op_body($trans, $op_body);
+ok($new_body ~~ /'cur_opcode = (opcode_t *)(234)'/, "goto ADDRESS() translated ok");
+
+$op_body := '
+inline op thingy(in PMC) {
+    opcode * next = expr NEXT();
+}';
+$new_body := translate_op_body($trans, $op_body);
+ok($new_body ~~ /'(cur_opcode += 2)]'/, "implicit goto NEXT() translated ok");
+
+sub translate_op_body($trans, $body) {
+    my $file  := Ops::File.new_str(
+        :oplib($lib), $body);
+    my $emitter := Ops::Emitter.new(
+        :ops_file($file),
+        :trans($trans),
+        :script("opsc"),
+        :flags( hash(core => '1') )
+    );
+
+    my $sh := pir::new__Ps('StringHandle');
+    $sh.open('your_bank_account_information.txt', 'w');
+    $emitter.emit_c_source_file($sh);
+    $sh.close();
+    $sh.readall();
+}
+
+# vim: expandtab shiftwidth=4 ft=perl6:
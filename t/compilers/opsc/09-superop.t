@@ -0,0 +1,52 @@
+#! ./parrot-nqp
+# Copyright (C) 2011, Parrot Foundation.
+
+# Checking Ops::SuperOp
+
+pir::load_bytecode("opsc.pbc");
+
+plan(14);
+
+my $file := Ops::File.new(
+    :oplib(Ops::OpLib.new()),
+    :core(0),
+    :quiet(1),
+    'src/ops/core.ops',
+    'src/ops/math.ops',
+    'src/ops/cmp.ops',
+);
+
+my %ops;
+for $file.ops -> $op {
+    %ops{$op.full_name} := $op;
+}
+
+my $super := Ops::SuperOp.fuse(%ops<inc_i>, %ops<lt_i_i_ic>);
+
+ok( $super,                                     "SuperOp created");
+ok( $super.full_name eq 'inc_i__lt_i_i_ic',     "... with proper full_name");
+ok( $super.name eq $super.full_name,            "... which is also its name");
+ok( $super.size == 6,                           "... with the size of both ops");
+ok( join(' ', |$super.arg_types) eq 'i ic i i ic', "... with the opcode of lt as argument");
+ok( !$super<normalized_args>[4]<is_label>,      "... and the offset of lt no label");
+ok( $super.get_jump eq 'PARROT_JUMP_RELATIVE',  "... which jumps like lt");
+
+my $trans := Ops::Trans::C.new();
+my $src   := $super.source($trans);
+ok( $src ~~ /'IREG(1)++'/,                      "inc body emitted");
+ok( $src ~~ /'cur_opcode += 2;'/,               "... advancing to lt");
+ok( $src ~~ /'ICONST(3)'/,                      "lt body emitted with its own args");
+ok( $src ~~ /'cur_opcode + 4'/,                 "... and its own implicit goto NEXT");
+ok( $src ~! /'cur_opcode + 2'/,                "implicit goto NEXT of inc dropped");
+
+$super := Ops::SuperOp.fuse(%ops<inc_i>, %ops<inc_i>, %ops<branch_ic>);
+ok( $super.size == 6,                           "Three ops fused");
+
+my $error := 0;
+try {
+    Ops::SuperOp.fuse(%ops<branch_ic>, %ops<inc_i>);
+    CATCH { $error := 1 }
+}
+ok( $error,                                     "Can't fuse ops after a :flow op");
+
+# vim: expandtab shiftwidth=4 ft=perl6:
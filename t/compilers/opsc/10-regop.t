@@ -0,0 +1,58 @@
+#! ./parrot-nqp
+# Copyright (C) 2011, Parrot Foundation.
+
+# Checking Ops::RegOp
+
+pir::load_bytecode("opsc.pbc");
+
+plan(13);
+
+my $file := Ops::File.new(
+    :oplib(Ops::OpLib.new()),
+    :core(0),
+    :quiet(1),
+    'src/ops/core.ops',
+    'src/ops/math.ops',
+    'src/ops/cmp.ops',
+);
+
+my %ops;
+for $file.ops -> $op {
+    %ops{$op.full_name} := $op;
+}
+
+my @variants := Ops::RegOp.variants(%ops<lt_i_i_ic>);
+ok( +@variants == 64,                           "Variants for two registers below 8");
+
+my $reg_op := @variants[10];
+ok( $reg_op.full_name eq 'lt_i_i_ic__I1_I2',    "... with proper full_name");
+ok( $reg_op.name eq 'lt',                       "... keeping the short name");
+ok( $reg_op.size == 4,                          "... and the size of the op");
+ok( join(' ', |$reg_op.arg_types) eq 'i i ic',  "... and its arguments");
+ok( $reg_op.get_jump eq 'PARROT_JUMP_RELATIVE', "... which jumps like the op");
+
+my $trans := Ops::Trans::C.new();
+my $src   := $reg_op.source($trans);
+ok( $src ~~ /'IREG_AT(1) < IREG_AT(2)'/,        "Registers accessed by number");
+ok( $src ~~ /'ICONST(3)'/,                      "... constants as in the op");
+ok( $src ~! /'IREG(' /,                         "... and no register through the bytecode");
+
+@variants := Ops::RegOp.variants(%ops<inc_i>);
+ok( +@variants == 8,                            "Variants for one register below 8");
+ok( @variants[7].full_name eq 'inc_i__I7',      "... up to the last one");
+
+my $error := 0;
+try {
+    Ops::RegOp.variants(%ops<add_i_i_i>);
+    CATCH { $error := 1 }
+}
+ok( $error,                                     "Can't specialize three registers");
+
+$error := 0;
+try {
+    Ops::RegOp.variants(%ops<branch_ic>);
+    CATCH { $error := 1 }
+}
+ok( $error,                                     "... nor no register");
+
+# vim: expandtab shiftwidth=4 ft=perl6:
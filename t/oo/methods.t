@@ -22,7 +22,7 @@ Tests features related to the creation, addition, and execution of OO methods.
 
     create_library()
 
-    plan(6)
+    plan(10)
 
     loading_methods_from_file()
     loading_methods_from_eval()
@@ -30,6 +30,9 @@ Tests features related to the creation, addition, and execution of OO methods.
 
     overridden_core_pmc()
 
+    polymorphic_call_site()
+    redefined_core_pmc_method()
+
     try_delete_library()
 
 .end
@@ -149,6 +152,96 @@ END
     .return(1)
 .end
 
+.namespace []
+
+.sub 'polymorphic_call_site'
+    .local pmc classes, objects, it
+    .local string names
+    .const 'Sub' poly_name = 'poly_name'
+    classes = split ' ', 'PolyA PolyB PolyC PolyD PolyE PolyF'
+    objects = new 'ResizablePMCArray'
+    it = iter classes
+  add_class:
+    unless it goto classes_done
+    $S0 = shift it
+    $P0 = newclass $S0
+    $P0.'add_method'('name', poly_name)
+    $P2 = new $S0
+    push objects, $P2
+    goto add_class
+  classes_done:
+
+    # and a core PMC, more receiver types than the call site caches
+    $P0 = new 'Integer'
+    push objects, $P0
+
+    names = ''
+    $I0 = 0
+  call_loop:
+    if $I0 == 14 goto call_done
+    $I1 = $I0 % 7
+    $P0 = objects[$I1]
+    $S0 = $P0.'name'()
+    names = concat names, $S0
+    inc $I0
+    goto call_loop
+  call_done:
+    $S0 = repeat 'PolyAPolyBPolyCPolyDPolyEPolyFInteger', 2
+    is(names, $S0, 'call site with more receiver types than it caches')
+
+    names = ''
+    it = iter objects
+  find_loop:
+    unless it goto find_done
+    $P0 = shift it
+    $P1 = find_method $P0, 'name'
+    $S0 = $P0.$P1()
+    names = concat names, $S0
+    goto find_loop
+  find_done:
+    is(names, 'PolyAPolyBPolyCPolyDPolyEPolyFInteger', 'find_method with several receiver types')
+.end
+
+.sub 'poly_name' :method
+    $P0 = typeof self
+    $S0 = $P0
+    .return ($S0)
+.end
+
+.sub 'redefined_core_pmc_method'
+    .local pmc compiler
+    $I0 = call_answer()
+    is($I0, 1, 'method of core PMC')
+
+    compiler = compreg 'PIR'
+    $S0 = <<'END'
+        .namespace ['Integer']
+        .sub 'answer' :method
+            .return (2)
+        .end
+END
+    compiler($S0)
+
+    $I0 = call_answer()
+    is($I0, 2, 'redefined method of core PMC found at the same call site')
+.end
+
+.sub 'call_answer'
+    $P0 = new 'Integer'
+    $I0 = $P0.'answer'()
+    .return ($I0)
+.end
+
+.namespace ['Integer']
+.sub 'answer' :method
+    .return (1)
+.end
+
+.sub 'name' :method
+    .return ('Integer')
+.end
+.namespace []
+
 # Local Variables:
 #   mode: pir
 #   fill-column: 100
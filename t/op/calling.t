@@ -6,7 +6,7 @@ use warnings;
 use lib qw( . lib ../lib ../../lib );
 
 use Test::More;
-use Parrot::Test tests => 103;
+use Parrot::Test tests => 106;
 
 =head1 NAME
 
@@ -2646,6 +2646,237 @@ CODE
 /Null PMC access/
 OUTPUT
 
+pir_output_is( <<'CODE', <<'OUTPUT', "positional args copied straight into fixed-arity subs" );
+.sub main :main
+    $P0 = get_global 'ints'
+    $I0 = $P0.'comp_flags'()
+    $I0 &= 4096
+    say $I0
+    $P0 = get_global 'opt'
+    $I0 = $P0.'comp_flags'()
+    $I0 &= 4096
+    say $I0
+
+    $I1 = 3
+    $I0 = ints($I1, 4)
+    say $I0
+    $N0 = 1.5
+    $N0 = nums($N0, 2.25)
+    say $N0
+    $S0 = strs('ab', "cd")
+    say $S0
+    $P1 = new ['Hash']
+    $P1['k'] = 'keyed'
+    $S0 = lookup($P1, 'k')
+    say $S0
+    $I0 = countdown(5)
+    say $I0
+    $P2 = newclass 'Fast'
+    $P3 = new 'Fast'
+    $I0 = $P3.'mul'(6, 7)
+    say $I0
+.end
+
+.sub ints
+    .param int a
+    .param int b
+    $I0 = a + b
+    .return ($I0)
+.end
+
+.sub nums
+    .param num a
+    .param num b
+    $N0 = a + b
+    .return ($N0)
+.end
+
+.sub strs
+    .param string a
+    .param string b
+    $S0 = a . b
+    .return ($S0)
+.end
+
+.sub lookup
+    .param pmc hash
+    .param pmc key
+    $S0 = hash[key]
+    .return ($S0)
+.end
+
+.sub countdown
+    .param int n
+    if n == 0 goto done
+    dec n
+    .tailcall countdown(n)
+  done:
+    .return (42)
+.end
+
+.sub opt
+    .param int a :optional
+.end
+
+.namespace ['Fast']
+
+.sub mul :method
+    .param int a
+    .param int b
+    $I0 = a * b
+    .return ($I0)
+.end
+CODE
+4096
+0
+7
+3.75
+abcd
+keyed
+42
+42
+OUTPUT
+
+pir_output_is( <<'CODE', <<'OUTPUT', "fixed-arity subs still convert and check args" );
+.sub main :main
+    $P0 = box 5
+    $I0 = ints($P0, 4)
+    say $I0
+    $S0 = pmcs(1, 2.5)
+    say $S0
+    push_eh too_few
+    ints(1)
+    say "not caught"
+  too_few:
+    pop_eh
+    say "too few caught"
+    $P1 = get_global 'ints'
+    $I0 = $P1(2, 3)
+    say $I0
+.end
+
+.sub ints
+    .param int a
+    .param int b
+    $I0 = a + b
+    .return ($I0)
+.end
+
+.sub pmcs
+    .param pmc a
+    .param pmc b
+    $S0 = typeof a
+    $S1 = typeof b
+    $S0 .= ' '
+    $S0 .= $S1
+    .return ($S0)
+.end
+CODE
+9
+Integer Float
+too few caught
+5
+OUTPUT
+
+pir_output_is( <<'CODE', <<'OUTPUT', "contexts of calls from C are reused unless captured" );
+.sub main :main
+    .local pmc arr, closures, contexts, it
+    arr = new ['ResizablePMCArray']
+    push arr, 4
+    push arr, 1
+    push arr, 5
+    push arr, 3
+    push arr, 2
+    closures = new ['ResizablePMCArray']
+    set_global 'closures', closures
+    contexts = new ['ResizablePMCArray']
+    set_global 'contexts', contexts
+    sort_often(arr, 'cmp_plain')
+    sort_often(arr, 'cmp_closure')
+    sort_often(arr, 'cmp_context')
+    sort_often(arr, 'cmp_plain')
+    it = iter closures
+  check_closures:
+    unless it goto check_contexts
+    $P0 = shift it
+    $P1 = $P0()
+    if $P1 < 1 goto bad
+    if $P1 > 5 goto bad
+    goto check_closures
+  check_contexts:
+    it = iter contexts
+  check_context:
+    unless it goto done
+    $P0 = shift it
+    $P0 = getattribute $P0, 'caller_ctx'
+    $P0 = getattribute $P0, 'current_sub'
+    $S0 = $P0
+    if $S0 != 'sort_often' goto bad
+    goto check_context
+  done:
+    say "captured contexts ok"
+    .return ()
+  bad:
+    say "captured context was reused"
+.end
+
+.sub sort_often
+    .param pmc arr
+    .param string name
+    .local pmc cmp
+    cmp = get_global name
+    $I0 = 0
+  loop:
+    $P0 = clone arr
+    $P0.'sort'(cmp)
+    inc $I0
+    if $I0 < 50 goto loop
+    $S0 = join ' ', $P0
+    say $S0
+.end
+
+.sub cmp_plain
+    .param pmc a
+    .param pmc b
+    $I0 = cmp a, b
+    .return ($I0)
+.end
+
+.sub cmp_closure
+    .param pmc a
+    .param pmc b
+    .lex '$a', a
+    $P0 = get_global 'inner'
+    $P0 = newclosure $P0
+    $P1 = get_global 'closures'
+    push $P1, $P0
+    $I0 = cmp a, b
+    .return ($I0)
+.end
+
+.sub inner :outer('cmp_closure')
+    $P0 = find_lex '$a'
+    .return ($P0)
+.end
+
+.sub cmp_context
+    .param pmc a
+    .param pmc b
+    $P0 = getinterp
+    $P0 = $P0['context']
+    $P1 = get_global 'contexts'
+    push $P1, $P0
+    $I0 = cmp a, b
+    .return ($I0)
+.end
+CODE
+1 2 3 4 5
+1 2 3 4 5
+1 2 3 4 5
+1 2 3 4 5
+captured contexts ok
+OUTPUT
+
 # Local Variables:
 #   mode: cperl
 #   cperl-indent-level: 4
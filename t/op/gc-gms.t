@@ -0,0 +1,151 @@
+#! perl
+# Copyright (C) 2011, Parrot Foundation.
+
+=head1 NAME
+
+t/op/gc-gms.t - test the generational garbage collector
+
+=head1 SYNOPSIS
+
+    % prove t/op/gc-gms.t
+
+=head1 DESCRIPTION
+
+Runs code on the generational GC, checking that young objects stored into old
+aggregates survive the minor collections.
+
+=cut
+
+use strict;
+use warnings;
+use lib qw( . lib ../lib ../../lib );
+
+use Test::More;
+use Parrot::Test tests => 4;
+
+$ENV{TEST_PROG_ARGS} = ( $ENV{TEST_PROG_ARGS} || '' ) . ' --gc GMS';
+
+pir_output_is( <<'CODE', <<'OUTPUT', 'GC_SYS_NAME' );
+.include 'interpinfo.pasm'
+.sub main :main
+    $S0 = interpinfo .INTERPINFO_GC_SYS_NAME
+    say $S0
+.end
+CODE
+gms
+OUTPUT
+
+pir_output_is( <<'CODE', <<'OUTPUT', 'young values in old aggregates' );
+.sub main :main
+    .local pmc hash, array
+    .local int i, sum
+    hash  = new ['Hash']
+    array = new ['ResizablePMCArray']
+    sweep 1
+
+    i = 0
+  fill:
+    $P0 = box i
+    $S0 = i
+    hash[$S0] = $P0
+    push array, $S0
+    $P1 = new ['Integer']
+    inc i
+    if i < 100000 goto fill
+
+    sweep 1
+    sum = 0
+    i = 0
+  check:
+    $S0 = array[i]
+    $P0 = hash[$S0]
+    $I0 = $P0
+    sum += $I0
+    inc i
+    if i < 100000 goto check
+    say sum
+.end
+CODE
+4999950000
+OUTPUT
+
+pir_output_is( <<'CODE', <<'OUTPUT', 'clone collecting while it fills the copy' );
+.sub main :main
+    .local pmc hash, copy
+    .local int i, sum
+    hash = new ['Hash']
+    i = 0
+  fill:
+    $P0 = new ['ResizablePMCArray']
+    $P1 = box i
+    push $P0, $P1
+    $S0 = i
+    hash[$S0] = $P0
+    inc i
+    if i < 20000 goto fill
+
+    copy = clone hash
+    hash = new ['Hash']
+    sweep 1
+
+    sum = 0
+    i = 0
+  check:
+    $S0 = i
+    $P0 = copy[$S0]
+    $P1 = $P0[0]
+    $I0 = $P1
+    sum += $I0
+    inc i
+    if i < 20000 goto check
+    say sum
+.end
+CODE
+199990000
+OUTPUT
+
+pir_output_is( <<'CODE', <<'OUTPUT', 'attributes of old objects' );
+.sub main :main
+    .local pmc cls, head, tail
+    .local int i
+    cls = newclass 'Node'
+    addattribute cls, 'value'
+    addattribute cls, 'next'
+    head = new ['Node']
+    $P0 = box 0
+    setattribute head, 'value', $P0
+    tail = head
+    sweep 1
+
+    i = 1
+  grow:
+    $P1 = new ['Node']
+    $P0 = box i
+    setattribute $P1, 'value', $P0
+    setattribute tail, 'next', $P1
+    tail = $P1
+    $P2 = new ['String']
+    inc i
+    if i < 50000 goto grow
+
+    sweep 1
+    i = 0
+  walk:
+    $P0 = getattribute head, 'value'
+    $I0 = $P0
+    i += $I0
+    head = getattribute head, 'next'
+    $I1 = isnull head
+    unless $I1 goto walk
+    say i
+.end
+CODE
+1249975000
+OUTPUT
+
+# Local Variables:
+#   mode: cperl
+#   cperl-indent-level: 4
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4:
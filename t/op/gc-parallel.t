@@ -0,0 +1,112 @@
+#! perl
+# Copyright (C) 2011, Parrot Foundation.
+
+=head1 NAME
+
+t/op/gc-parallel.t - test marking on several threads
+
+=head1 SYNOPSIS
+
+    % prove t/op/gc-parallel.t
+
+=head1 DESCRIPTION
+
+Runs code with several marking threads on a heap big enough to mark in
+parallel, checking that everything reachable survives the collections.
+
+=cut
+
+use strict;
+use warnings;
+use lib qw( . lib ../lib ../../lib );
+
+use Test::More;
+use Parrot::Test tests => 2;
+
+$ENV{TEST_PROG_ARGS} = ( $ENV{TEST_PROG_ARGS} || '' ) . ' --gc-mark-threads=4';
+
+pir_output_is( <<'CODE', <<'OUTPUT', 'arrays and hashes' );
+.sub main :main
+    .local pmc hash, array
+    .local int i, sum
+    hash  = new ['Hash']
+    array = new ['ResizablePMCArray']
+
+    i = 0
+  fill:
+    $P0 = box i
+    $S0 = i
+    hash[$S0] = $P0
+    $P1 = new ['ResizablePMCArray']
+    push $P1, $P0
+    push array, $P1
+    inc i
+    if i < 200000 goto fill
+
+    sweep 1
+    sweep 1
+    sum = 0
+    i = 0
+  check:
+    $S0 = i
+    $P0 = hash[$S0]
+    $I0 = $P0
+    sum += $I0
+    $P1 = array[i]
+    $P0 = $P1[0]
+    $I0 = $P0
+    sum += $I0
+    inc i
+    if i < 200000 goto check
+    say sum
+.end
+CODE
+39999800000
+OUTPUT
+
+pir_output_is( <<'CODE', <<'OUTPUT', 'objects' );
+.sub main :main
+    .local pmc cls, head
+    .local int i
+    cls = newclass 'Node'
+    addattribute cls, 'value'
+    addattribute cls, 'next'
+    null head
+
+    i = 0
+  grow:
+    $P0 = new ['Node']
+    $P1 = box i
+    setattribute $P0, 'value', $P1
+    setattribute $P0, 'next', head
+    head = $P0
+    inc i
+    if i < 100000 goto grow
+
+    sweep 1
+    $P3 = get_sum(head)
+    say $P3
+.end
+
+.sub get_sum
+    .param pmc head
+    .local int sum
+    sum = 0
+  walk:
+    $P0 = getattribute head, 'value'
+    $I0 = $P0
+    sum += $I0
+    head = getattribute head, 'next'
+    unless_null head, walk
+    .return (sum)
+.end
+CODE
+4999950000
+OUTPUT
+
+# Local Variables:
+#   mode: cperl
+#   cperl-indent-level: 4
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4:
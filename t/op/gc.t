@@ -20,7 +20,7 @@ GC related bugs.
 
 .sub main :main
     .include 'test_more.pir'
-    plan(139)
+    plan(147)
 
     sweep_1()
     sweep_0()
@@ -29,6 +29,9 @@ GC related bugs.
     collect_count()
     collect_toggle()
     collect_toggle_nested()
+    collect_evacuates_attributes()
+    collect_compacts_sparse_strings()
+    sweep_records_gc_event()
     vanishing_singleton_PMC()
     vanishing_ret_continuation()
     regsave_marked()
@@ -99,6 +102,115 @@ GC related bugs.
 .end
 
 
+.sub collect_evacuates_attributes
+    .local pmc cls, keep, obj
+    .local int i, sum
+    cls  = newclass 'GCPoint'
+    addattribute cls, 'x'
+    keep = new ['ResizablePMCArray']
+
+    # leave the attribute arenas sparse
+    i = 0
+  fill:
+    $P0 = box i
+    obj = new ['GCPoint']
+    setattribute obj, 'x', $P0
+    $P1 = new ['Hash']
+    $I0 = i % 10
+    if $I0 goto next
+    push keep, obj
+    $P2 = new ['String']
+    $P2 = i
+    push keep, $P2
+  next:
+    inc i
+    if i < 20000 goto fill
+
+    sweep 1
+    collect
+
+    sum = 0
+    i = 0
+    $I1 = elements keep
+  check:
+    obj = keep[i]
+    $P0 = getattribute obj, 'x'
+    $I0 = $P0
+    sum += $I0
+    inc i
+    $P2 = keep[i]
+    $I0 = $P2
+    sum += $I0
+    inc i
+    if i < $I1 goto check
+    is($I1, 4000, "collect_evacuates_attributes keeps the PMCs")
+    is(sum, 39980000, "collect_evacuates_attributes keeps the attributes")
+.end
+
+.sub collect_compacts_sparse_strings
+    .local pmc keep
+    .local int i, same
+    keep = new ['ResizableStringArray']
+
+    # leave the string blocks sparse
+    i = 0
+  fill:
+    $S0 = repeat 'x', 100
+    $S1 = i
+    $S0 .= $S1
+    $I0 = i % 10
+    if $I0 goto next
+    push keep, $S0
+  next:
+    inc i
+    if i < 20000 goto fill
+
+    sweep 1
+    collect
+    $I1 = interpinfo .INTERPINFO_TOTAL_COPIED
+    collect
+    $I2 = interpinfo .INTERPINFO_TOTAL_COPIED
+
+    same = 1
+    i  = 0
+  check:
+    $S0 = repeat 'x', 100
+    $S1 = i
+    $S0 .= $S1
+    $I0 = i / 10
+    $S2 = keep[$I0]
+    if $S0 == $S2 goto good
+    same = 0
+  good:
+    i += 10
+    if i < 20000 goto check
+    $I0 = elements keep
+    is($I0, 2000, "collect_compacts_sparse_strings keeps the STRINGs")
+    ok(same, "collect_compacts_sparse_strings keeps the contents")
+    $I3 = $I2 - $I1
+    is($I3, 0, "collect_compacts_sparse_strings leaves dense blocks in place")
+.end
+
+.sub sweep_records_gc_event
+    $S0 = interpinfo .INTERPINFO_GC_SYS_NAME
+    if $S0 == 'ms2' goto recorded
+    skip(3, "only ms2 records GC events")
+    .return ()
+
+  recorded:
+    sweep 1
+    $I0 = interpinfo .INTERPINFO_GC_MARK_RUNS
+    $P0 = interpinfo .INTERPINFO_GC_EVENTS
+    $I1 = elements $P0
+    $I1 = $I1 > 0
+    ok($I1, "sweep_records_gc_event records the run")
+    $P1 = $P0[-1]
+    $I2 = $P1['run']
+    is($I2, $I0, "sweep_records_gc_event records the latest run last")
+    $I3 = exists $P1['freed_bytes']
+    ok($I3, "sweep_records_gc_event records the bytes freed")
+.end
+
 .sub collect_toggle
     $I1 = interpinfo .INTERPINFO_GC_COLLECT_RUNS
     collectoff
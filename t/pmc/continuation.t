@@ -17,7 +17,7 @@ Tests the Continuation PMC.
 
 .sub main :main
     .include 'test_more.pir'
-    plan(9)
+    plan(12)
 
     test_new()
     invoke_with_init()
@@ -25,6 +25,7 @@ Tests the Continuation PMC.
     returns_tt1528()
     experimental_caller()
     get_pointer_and_string()
+    made_on_demand()
 .end
 
 .sub test_new
@@ -173,6 +174,33 @@ end:
    dummy:
 .end
 
+.include 'interpinfo.pasm'
+
+.sub made_on_demand
+    $I0 = return_through_current_cont(21)
+    is($I0, 42, 'return through the continuation of interpinfo')
+
+    ($P0, $P1) = current_cont_twice()
+    $S0 = typeof $P0
+    is($S0, 'Continuation', 'return continuation made when asked for')
+    $I0 = issame $P0, $P1
+    ok($I0, '... and only once')
+.end
+
+.sub return_through_current_cont
+    .param int n
+    $P0 = interpinfo .INTERPINFO_CURRENT_CONT
+    $I0 = n * 2
+    $P0($I0)
+    .return (0)
+.end
+
+.sub current_cont_twice
+    $P0 = interpinfo .INTERPINFO_CURRENT_CONT
+    $P1 = interpinfo .INTERPINFO_CURRENT_CONT
+    .return ($P0, $P1)
+.end
+
 # end of tests.
 
 # Local Variables:
@@ -1,5 +1,5 @@
 #!./parrot
-# Copyright (C) 2001-2008, Parrot Foundation.
+# Copyright (C) 2001-2011, Parrot Foundation.
 
 =head1 NAME
 
@@ -19,7 +19,7 @@ Tests the creation and invocation of Perl6 multi subs.
 .sub main :main
     .include 'test_more.pir'
 
-    plan( 8 )
+    plan( 22 )
 
     $P0 = new ['MultiSub']
     $I0 = defined $P0
@@ -51,6 +51,83 @@ Tests the creation and invocation of Perl6 multi subs.
     $S0 = foo($P1 :flat, $P2 :flat)
     is($S0, "testing 42, goodbye", "Int and String double :flat")
 
+    polymorphic_calls()
+    candidates_changed()
+.end
+
+.sub polymorphic_calls
+    .local int i
+    i = 0
+  loop:
+    $S0 = what(1)
+    is($S0, "int", "int, from the candidate cache")
+    $S0 = what(1.5)
+    is($S0, "num", "num, from the candidate cache")
+    $S0 = what("a")
+    is($S0, "string", "string, from the candidate cache")
+    $P0 = box 1
+    $S0 = what($P0)
+    is($S0, "Integer", "Integer, from the candidate cache")
+    $P0 = box 1.5
+    $S0 = what($P0)
+    is($S0, "Float", "Float, from the candidate cache")
+    $P0 = new ['Hash']
+    $S0 = what($P0)
+    is($S0, "any", "other PMC, from the candidate cache")
+    inc i
+    if i < 2 goto loop
+.end
+
+.sub candidates_changed
+    $P0 = box 1
+    $S0 = which($P0)
+    is($S0, "any", "generic candidate chosen")
+
+    .const 'Sub' which_integer = 'which_integer'
+    $P1 = get_global 'which'
+    push $P1, which_integer
+    $S0 = which($P0)
+    is($S0, "Integer", "new candidate chosen after push")
+.end
+
+.sub what :multi(int)
+    .param int x
+    .return ('int')
+.end
+
+.sub what :multi(num)
+    .param num x
+    .return ('num')
+.end
+
+.sub what :multi(string)
+    .param string x
+    .return ('string')
+.end
+
+.sub what :multi(Integer)
+    .param pmc x
+    .return ('Integer')
+.end
+
+.sub what :multi(Float)
+    .param pmc x
+    .return ('Float')
+.end
+
+.sub what :multi(_)
+    .param pmc x
+    .return ('any')
+.end
+
+.sub which :multi(_)
+    .param pmc x
+    .return ('any')
+.end
+
+.sub which_integer :multi(Integer) :subid('which_integer')
+    .param pmc x
+    .return ('Integer')
 .end
 
 .sub foo :multi()
@@ -18,11 +18,12 @@ Tests the concurrency scheduler PMC.
 
 .sub main :main
     .include 'test_more.pir'
-    plan(6)
+    plan(7)
 
     create_and_set_attributes()
     create_concurrent_scheduler_with_init()
     add_event_and_handler_to_scheduler()
+    handle_event_in_loop()
 .end
 
 .sub create_and_set_attributes
@@ -113,6 +114,45 @@ bad_initializer:
     ok(1, "called event handler")
 .end
 
+.sub handle_event_in_loop
+    .local pmc handler, handler_init, handler_sub
+    .local pmc event, event_init, handled
+    handled = new ['Integer']
+    set_global 'loop_event_handled', handled
+
+    handler_init = new ['Hash']
+    handler_init['type'] = 'loopevent'
+    handler_sub = get_global 'loop_event_handler'
+    handler_init['code'] = handler_sub
+    handler = new ['EventHandler'], handler_init
+
+    addhandler handler
+
+    event_init = new ['Hash']
+    event_init['type'] = 'event'
+    event_init['subtype'] = 'loopevent'
+    event = new ['Task'], event_init
+
+    schedule event
+
+    # No calls in the loop: the event must be handled at its backward branch.
+    $I0 = 0
+  loop:
+    if handled goto done
+    inc $I0
+    if $I0 < 1000 goto loop
+
+  done:
+    ok(handled, "event handled inside a loop")
+.end
+
+.sub loop_event_handler
+    .param pmc handler
+    .param pmc handledtask
+    $P0 = get_global 'loop_event_handled'
+    $P0 = 1
+.end
+
 # Local Variables:
 #   mode: pir
 #   fill-column: 100
@@ -0,0 +1,102 @@
+#! perl
+# Copyright (C) 2011, Parrot Foundation.
+
+=head1 NAME
+
+t/run/bounds.t - test the bounds checking runcore
+
+=head1 SYNOPSIS
+
+    % prove t/run/bounds.t
+
+=head1 DESCRIPTION
+
+Runs code on the bounds core, checking that branches, calls and returns to
+ops in the code segment work, and that jumps outside of the segment or into
+the operands of an op throw.
+
+=cut
+
+use strict;
+use warnings;
+use lib qw( . lib ../lib ../../lib );
+
+use Test::More;
+use Parrot::Test tests => 4;
+use Parrot::Config;
+
+$ENV{TEST_PROG_ARGS} = ( $ENV{TEST_PROG_ARGS} || '' ) . ' -R bounds';
+
+my $opsize = $PConfig{opcode_t_size};
+
+pir_output_is( <<'CODE', <<'OUTPUT', 'loops, calls and returns' );
+.sub main :main
+    .local int i, s
+    s = 0
+    i = 0
+  loop:
+    $I0 = fib(i)
+    s += $I0
+    inc i
+    if i < 15 goto loop
+    say s
+.end
+
+.sub fib
+    .param int n
+    if n < 2 goto done
+    $I0 = n - 1
+    $I0 = fib($I0)
+    $I1 = n - 2
+    $I1 = fib($I1)
+    n = $I0 + $I1
+  done:
+    .return (n)
+.end
+CODE
+986
+OUTPUT
+
+pasm_output_is( <<'CODE', <<'OUTPUT', 'jump to an op' );
+    set_addr I1, FOO
+    jump I1
+    say "not reached"
+    end
+FOO:
+    say "jumped"
+    end
+CODE
+jumped
+OUTPUT
+
+pasm_error_output_like( <<"CODE", <<'OUTPUT', 'jump into the operands of an op' );
+    set_addr I1, FOO
+    add I1, $opsize
+    jump I1
+    end
+FOO:
+    set I2, 42
+    say I2
+    end
+CODE
+/attempt to jump into the middle of an op/
+OUTPUT
+
+pasm_error_output_like( <<"CODE", <<'OUTPUT', 'jump outside of the code segment' );
+    set_addr I1, FOO
+    add I1, 100000
+    jump I1
+    end
+FOO:
+    say "not reached"
+    end
+CODE
+/attempt to access code outside of current code segment/
+OUTPUT
+
+# Local Variables:
+#   mode: cperl
+#   cperl-indent-level: 4
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4:
@@ -0,0 +1,235 @@
+#! perl
+# Copyright (C) 2011, Parrot Foundation.
+
+=head1 NAME
+
+t/run/jit.t - test the tracing JIT runcore
+
+=head1 SYNOPSIS
+
+    % prove t/run/jit.t
+
+=head1 DESCRIPTION
+
+Runs loops hot enough to be traced by the jit core, checking that the native
+traces compute what the interpreter does, and that they hand control back to
+it where they must: when a branch goes the other way than it was recorded,
+and before an op which throws.
+
+=cut
+
+use strict;
+use warnings;
+use lib qw( . lib ../lib ../../lib );
+
+use Test::More;
+use Parrot::Test;
+use Parrot::Config;
+
+if ( $PConfig{jitcapable} ) {
+    plan tests => 7;
+}
+else {
+    plan skip_all => 'no JIT on this platform';
+}
+
+$ENV{TEST_PROG_ARGS} = ( $ENV{TEST_PROG_ARGS} || '' ) . ' -R jit';
+
+pir_output_is( <<'CODE', <<'OUTPUT', 'integer loop, branch flipping in the trace' );
+.sub main :main
+    .local int i, s
+    s = 0
+    i = 0
+  loop:
+    s += i
+    $I0 = i % 7
+    unless $I0 goto skip
+    s -= 1
+  skip:
+    inc i
+    if i < 10000 goto loop
+    say s
+    say i
+.end
+CODE
+49986429
+10000
+OUTPUT
+
+pir_output_is( <<'CODE', <<'OUTPUT', 'float loop' );
+.sub main :main
+    .local num f, g
+    .local int i, n
+    f = 0.0
+    g = 1.0
+    n = 0
+    i = 0
+  loop:
+    f += 0.5
+    g *= 1.0001
+    $N0 = f / 4
+    $N1 = $N0 - g
+    $I0 = islt $N1, 100.0
+    n  += $I0
+    $I1 = f
+    inc i
+    le i, 1000, loop
+    say f
+    say n
+    say $I1
+    $S0 = g
+    say $S0
+.end
+CODE
+500.5
+808
+500
+1.10527590914248
+OUTPUT
+
+pir_output_is( <<'CODE', <<'OUTPUT', 'nested loops' );
+.sub main :main
+    .local int i, j, s
+    s = 0
+    i = 0
+  outer:
+    j = 0
+  inner:
+    $I0 = i * j
+    s += $I0
+    inc j
+    lt j, 100, inner
+    inc i
+    lt i, 100, outer
+    say s
+.end
+CODE
+24502500
+OUTPUT
+
+pir_output_is( <<'CODE', <<'OUTPUT', 'comparisons' );
+.sub main :main
+    .local int i, a, b, c, d
+    .local num x
+    a = 0
+    b = 0
+    c = 0
+    d = 0
+    i = -100
+  loop:
+    $I0 = cmp i, 0
+    a  += $I0
+    x   = i
+    $I1 = cmp x, 0.0
+    b  += $I1
+    $I2 = iseq x, 50.0
+    c  += $I2
+    $I3 = isle i, 0
+    d  += $I3
+    ne i, 0, nonzero
+    d  += 1000
+  nonzero:
+    inc i
+    lt i, 100, loop
+    say a
+    say b
+    say c
+    say d
+.end
+CODE
+-1
+-1
+1
+1101
+OUTPUT
+
+pir_output_is( <<'CODE', <<'OUTPUT', 'mod of negative numbers' );
+.sub main :main
+    .local int i, s
+    .local num f
+    s = 0
+    f = 0.0
+    i = -500
+  loop:
+    $I0 = i % 7
+    s  += $I0
+    $N0 = i
+    $N0 = $N0 % 3.0
+    f  += $N0
+    inc i
+    lt i, 500, loop
+    say s
+    say f
+.end
+CODE
+3000
+1000
+OUTPUT
+
+pir_output_is( <<'CODE', <<'OUTPUT', 'division by zero in a traced loop' );
+.sub main :main
+    .local int i, s, d
+    s = 0
+    d = 1000
+    i = 0
+    push_eh caught
+  loop:
+    $I0 = 1000000 / d
+    s  += $I0
+    dec d
+    inc i
+    lt i, 2000, loop
+    say 'not caught'
+    end
+  caught:
+    pop_eh
+    say s
+    say i
+    say d
+.end
+CODE
+7485017
+1000
+0
+OUTPUT
+
+pir_output_is( <<'CODE', <<'OUTPUT', 'not a number' );
+.sub main :main
+    .local num nan, f
+    .local int i, equal, unequal, less
+    nan     = 'NaN'
+    equal   = 0
+    unequal = 0
+    less    = 0
+    i       = 0
+  loop:
+    f = i
+    ne f, nan, check_eq
+    inc equal
+  check_eq:
+    eq f, nan, check_lt
+    inc unequal
+  check_lt:
+    lt f, nan, is_less
+    goto next
+  is_less:
+    inc less
+  next:
+    inc i
+    lt i, 200, loop
+    say equal
+    say unequal
+    say less
+.end
+CODE
+0
+200
+0
+OUTPUT
+
+# Local Variables:
+#   mode: cperl
+#   cperl-indent-level: 4
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4:
@@ -19,7 +19,7 @@ use strict;
 use warnings;
 use lib qw( lib . ../lib ../../lib );
 
-use Test::More tests => 31;
+use Test::More tests => 51;
 use Parrot::Config;
 use File::Temp 0.13 qw/tempfile/;
 use File::Spec;
@@ -76,13 +76,22 @@ is( `"$PARROT" --trace "$first_pir_file" "$second_pir_file" $redir`,
     my $cmd;
 
     ## this test assumes these cores work on all platforms (a safe assumption)
-    for my $val (qw/ slow fast bounds trace /) {
+    for my $val (qw/ slow fast threaded jit bounds trace /) {
         for my $opt ( '-R ', '--runcore ', '--runcore=' ) {
             $cmd = qq{"$PARROT" $opt$val "$second_pir_file" $redir};
             is( qx{$cmd}, "second\n", "<$opt$val> option)" ) or diag $cmd;
         }
     }
 
+    SKIP: {
+        skip 'computed goto core not available', 3 unless $PConfig{cgoto};
+
+        for my $opt ( '-R ', '--runcore ', '--runcore=' ) {
+            $cmd = qq{"$PARROT" ${opt}cgoto "$second_pir_file" $redir};
+            is( qx{$cmd}, "second\n", "<${opt}cgoto> option)" ) or diag $cmd;
+        }
+    }
+
     $cmd = qq{"$PARROT" -D 8 -R slow "$second_pir_file" $redir};
     is( qx{$cmd}, "second\n", "-r option <$cmd>" );
 
@@ -102,15 +111,53 @@ like( $output, qr/--gc-threshold needs an argument/,
                  '--gc-threshold needs argument warning' );
 is( $exit, 0, '... and should not crash' );
 
+# Test --gc-max-pause
+is( qx{$PARROT --gc-max-pause=100 "$first_pir_file"}, "first\n", '--gc-max-pause' );
+
+$output = qx{$PARROT --gc-max-pause 2>&1 };
+like( $output, qr/--gc-max-pause needs an argument/,
+                 '--gc-max-pause needs argument warning' );
+
+# Test --gc-mark-threads
+is( qx{$PARROT --gc-mark-threads=4 "$first_pir_file"}, "first\n", '--gc-mark-threads' );
+
+$output = qx{$PARROT --gc-mark-threads 2>&1 };
+like( $output, qr/--gc-mark-threads needs an argument/,
+                 '--gc-mark-threads needs argument warning' );
+
+# Test --gc-overhead
+is( qx{$PARROT --gc-overhead=10 "$first_pir_file"}, "first\n", '--gc-overhead' );
+
+$output = qx{$PARROT --gc-overhead=200 "$first_pir_file" 2>&1 };
+like( $output, qr/Error parsing option/, '--gc-overhead above 100' );
+
+# Test --gc-max-threshold
+is( qx{$PARROT --gc-overhead=0 --gc-max-threshold=1024 "$first_pir_file"},
+    "first\n", '--gc-max-threshold' );
+
+# Test --gc-log
+my $sweep_pir_file = create_pir_file('sweep', 'sweep 1');
+$output = qx{$PARROT --gc-log=- "$sweep_pir_file" 2>&1 };
+like( $output, qr/^gc run=\d+ trace=\d+ mark=\d+ .* freed_bytes=\d+$/m, '--gc-log to stderr' );
+like( $output, qr/^sweep$/m, '--gc-log runs the program' );
+
+$output = qx{$PARROT --gc-log=no/such/dir/gc.log "$first_pir_file" 2>&1 };
+like( $output, qr/Error parsing option/, '--gc-log with a bad file' );
+
+# Test --gc-precise-roots
+is( qx{$PARROT --gc-precise-roots "$first_pir_file"}, "first\n", '--gc-precise-roots' );
+
 # Test --leak-test
 is( qx{$PARROT --leak-test "$first_pir_file"}, "first\n", '--leak-test' );
 
 # clean up temporary files
 unlink $first_pir_file;
 unlink $second_pir_file;
+unlink $sweep_pir_file;
 
 sub create_pir_file {
     my $word = shift;
+    my $ops  = @_ ? "  $_[0]\n" : '';
 
     my ( $fh, $filename ) = tempfile( UNLINK => 0, SUFFIX => '.pir', UNLINK => 1 );
     print $fh <<"END_PIR";
@@ -120,7 +167,7 @@ sub create_pir_file {
 .endm
 
 .sub main :main
-  .println( "$word" )
+$ops  .println( "$word" )
 .end
 END_PIR
     close $fh;
@@ -0,0 +1,115 @@
+#!perl
+# Copyright (C) 2011, Parrot Foundation.
+
+use strict;
+use warnings;
+use lib qw( . lib ../lib ../../lib );
+
+use Test::More;
+use Parrot::Test::Util 'create_tempfile';
+
+use Parrot::Test;
+use Parrot::Config;
+use File::Spec::Functions;
+
+plan skip_all => 'src/parrot_config.o does not exist' unless -e catfile(qw/src parrot_config.o/);
+
+plan tests => 1;
+
+=head1 NAME
+
+t/src/verify.t - Bytecode verifier
+
+=head1 SYNOPSIS
+
+    % prove t/src/verify.t
+
+=head1 DESCRIPTION
+
+Checks that bytecode read from a packfile is verified, and that bytecode
+with an unknown opcode or a register its sub doesn't have is not.
+
+=cut
+
+my ($TEMP, $temp_pir) = create_tempfile( SUFFIX => '.pir', UNLINK => 1 );
+
+print $TEMP <<'EOF';
+.sub main :main
+    $I0 = 42
+    say $I0
+.end
+EOF
+close $TEMP;
+
+# compile to pbc
+my (undef, $temp_pbc) = create_tempfile( SUFFIX => '.pbc', UNLINK => 1 );
+system(".$PConfig{slash}parrot$PConfig{exe}", '-o', $temp_pbc, $temp_pir);
+
+c_output_is( <<"CODE", <<'OUTPUT', 'verify bytecode' );
+
+#include <stdio.h>
+#include <string.h>
+#include <parrot/parrot.h>
+#include <parrot/embed.h>
+#include <parrot/packfile.h>
+
+static opcode_t *the_test(Parrot_Interp, opcode_t *, opcode_t *);
+
+int
+main(int argc, const char *argv[])
+{
+    Parrot_Interp interp = Parrot_new(NULL);
+    if (interp) {
+        Parrot_run_native(interp, the_test);
+
+        Parrot_destroy(interp);
+    }
+    return 0;
+}
+
+static opcode_t*
+the_test(PARROT_INTERP, opcode_t *cur_op, opcode_t *start)
+{
+    PackFile          *pf = Parrot_pbc_read(interp, "$temp_pbc", 0);
+    PackFile_ByteCode *cs;
+    opcode_t          *data, *copy;
+
+    Parrot_pbc_load(interp, pf);
+    cs = interp->code;
+    printf("loaded %d\\n", (int)cs->verified);
+
+    /* the packed code may be mapped read only, so corrupt a copy */
+    data = cs->base.data;
+    copy = (opcode_t *)mem_sys_allocate(cs->base.size * sizeof (opcode_t));
+    memcpy(copy, data, cs->base.size * sizeof (opcode_t));
+    cs->base.data = copy;
+
+    /* set_i_ic I0, 42 */
+    copy[0] = (opcode_t)cs->op_count;
+    printf("unknown opcode %d\\n", (int)PackFile_ByteCode_verify(interp, cs));
+
+    copy[0] = data[0];
+    copy[1] = 1000;
+    printf("unknown register %d\\n", (int)PackFile_ByteCode_verify(interp, cs));
+
+    copy[1] = data[1];
+    printf("restored %d\\n", (int)PackFile_ByteCode_verify(interp, cs));
+
+    cs->base.data = data;
+    mem_sys_free(copy);
+
+    return NULL;
+}
+CODE
+loaded 1
+unknown opcode 0
+unknown register 0
+restored 1
+OUTPUT
+
+# Local Variables:
+#   mode: cperl
+#   cperl-indent-level: 4
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4:
@@ -0,0 +1,107 @@
+#! perl
+# Copyright (C) 2011, Parrot Foundation.
+# auto/cgoto-01.t
+
+use strict;
+use warnings;
+use Test::More tests => 18;
+use Carp;
+use lib qw( lib t/configure/testlib );
+use_ok('config::auto::cgoto');
+use Parrot::Configure::Options qw( process_options );
+use Parrot::Configure::Step::Test;
+use Parrot::Configure::Test qw(
+    test_step_constructor_and_description
+);
+use IO::CaptureOutput qw| capture |;
+
+########## regular ##########
+
+my ($args, $step_list_ref) = process_options( {
+    argv            => [],
+    mode            => q{configure},
+} );
+
+my $conf = Parrot::Configure::Step::Test->new;
+$conf->include_config_results( $args );
+
+my $pkg = q{auto::cgoto};
+
+$conf->add_steps($pkg);
+
+my $serialized = $conf->pcfreeze();
+
+$conf->options->set(%{$args});
+my $step = test_step_constructor_and_description($conf);
+ok($step->runstep($conf), "runstep() returned true value");
+
+$conf->replenish($serialized);
+
+########## _evaluate_cgoto() ##########
+
+$conf->options->set(%{$args});
+$step = test_step_constructor_and_description($conf);
+{
+    my $anyerror;
+    my $stdout;
+    my $ret = capture(
+        sub { $step->_evaluate_cgoto($conf, $anyerror) },
+        \$stdout
+    );
+    ok($ret, "_evaluate_cgoto returned true value");
+    is($conf->data->get('cgoto'), 1, "'cgoto' set to true value as expected");
+    is($step->result, 'yes', "Got expected result");
+}
+
+$conf->replenish($serialized);
+
+########## _evaluate_cgoto(); --verbose ##########
+
+($args, $step_list_ref) = process_options( {
+    argv            => [ q{--verbose} ],
+    mode            => q{configure},
+} );
+$conf->options->set(%{$args});
+$step = test_step_constructor_and_description($conf);
+{
+    my $anyerror = 1;
+    my $stdout;
+    my $ret = capture(
+        sub { $step->_evaluate_cgoto($conf, $anyerror) },
+        \$stdout
+    );
+    ok($ret, "_evaluate_cgoto returned true value");
+    is($conf->data->get('cgoto'), 0, "'cgoto' set to false value as expected");
+    is($step->result, 'no', "Got expected result");
+}
+
+pass("Completed all tests in $0");
+
+################### DOCUMENTATION ###################
+
+=head1 NAME
+
+auto/cgoto-01.t - test auto::cgoto
+
+=head1 SYNOPSIS
+
+    % prove t/steps/auto/cgoto-01.t
+
+=head1 DESCRIPTION
+
+The files in this directory test functionality used by F<Configure.pl>.
+
+The tests in this file test auto::cgoto.
+
+=head1 SEE ALSO
+
+config::auto::cgoto, F<Configure.pl>.
+
+=cut
+
+# Local Variables:
+#   mode: cperl
+#   cperl-indent-level: 4
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4:
@@ -106,6 +106,9 @@ $conf->data->set( osname => 'linux' );
 
 my $rv;
 
+# auto::jit may have set it for the JIT
+$conf->data->set( 'has_exec_protect' => undef );
+
 $can_build_call_frames = 0;
 $rv = $step->_handle_can_build_call_frames( $conf, $can_build_call_frames );
 ok( $rv, "_handle_can_build_call_frames() returned true value" );
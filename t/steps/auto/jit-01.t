@@ -4,7 +4,7 @@
 
 use strict;
 use warnings;
-use Test::More tests =>  4;
+use Test::More tests =>  8;
 use Carp;
 use Cwd;
 use File::Temp qw( tempdir );
@@ -34,6 +34,26 @@ $conf->add_steps($pkg);
 $conf->options->set( %{$args} );
 my $step = test_step_constructor_and_description($conf);
 
+##### _jit_capable() #####
+
+my $cpuarch = $conf->data->get('cpuarch');
+
+$conf->data->set( cpuarch => 'i386' );
+ok( ! auto::jit::_jit_capable($conf), "no JIT for i386" );
+
+$conf->data->set( cpuarch => 'amd64' );
+$conf->options->set( jitcapable => 0 );
+ok( ! auto::jit::_jit_capable($conf), "--jitcapable=0 disables the JIT" );
+
+$conf->options->set( jitcapable => 1 );
+ok( auto::jit::_jit_capable($conf), "--jitcapable=1 enables the JIT" );
+is( $conf->data->get('has_exec_protect'), 1,
+    "executable memory is mapped for the JIT" );
+
+$conf->options->set( jitcapable => undef );
+$conf->data->set( cpuarch => $cpuarch );
+$conf->data->set( has_exec_protect => undef );
+
 ################### DOCUMENTATION ###################
 
 =head1 NAME